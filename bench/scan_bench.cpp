@@ -0,0 +1,418 @@
+/*
+    Copyright 2018 Brick
+
+    Permission is hereby granted, free of charge, to any person obtaining a copy of this software
+    and associated documentation files (the "Software"), to deal in the Software without restriction,
+    including without limitation the rights to use, copy, modify, merge, publish, distribute,
+    sublicense, and/or sell copies of the Software, and to permit persons to whom the Software is
+    furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included in all copies or
+    substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING
+    BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+    NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM,
+    DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+    OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+*/
+// Scanner benchmark, which reports hardware counters for each pattern shape.
+// Usage: mem_bench [size in MiB] [iterations]
+
+#include <mem/bigram_frequencies.h>
+#include <mem/boyer_moore_scanner.h>
+#include <mem/module.h>
+#include <mem/pattern.h>
+#include <mem/simd_scanner.h>
+
+#if defined(MEM_ARCH_X86) || defined(MEM_ARCH_X86_64)
+#    include <mem/arch.h>
+#endif
+
+#if defined(__linux__)
+#    include <linux/perf_event.h>
+#    include <sys/ioctl.h>
+#    include <sys/syscall.h>
+#    include <unistd.h>
+#endif
+
+#include <cerrno>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <vector>
+
+namespace
+{
+    enum counter_id
+    {
+        counter_cycles,
+        counter_instructions,
+        counter_branches,
+        counter_branch_misses,
+        counter_l1d_misses,
+        counter_count
+    };
+
+    struct counter_sample
+    {
+        bool valid[counter_count] {};
+        std::uint64_t values[counter_count] {};
+
+        // Used when the hardware counters are unavailable
+        std::uint64_t ticks {0};
+        double seconds {0.0};
+    };
+
+    std::uint64_t read_ticks() noexcept
+    {
+#if defined(MEM_ARCH_X86) || defined(MEM_ARCH_X86_64)
+        return mem::rdtsc();
+#else
+        return static_cast<std::uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(
+            std::chrono::steady_clock::now().time_since_epoch())
+                                              .count());
+#endif
+    }
+
+    class perf_counters
+    {
+    public:
+        perf_counters();
+        ~perf_counters();
+
+        perf_counters(const perf_counters&) = delete;
+        perf_counters& operator=(const perf_counters&) = delete;
+
+        bool available() const noexcept;
+        int error() const noexcept;
+
+        void start();
+        counter_sample stop();
+
+    private:
+        int fds_[counter_count];
+        int error_ {0};
+
+        std::uint64_t start_ticks_ {0};
+        std::chrono::steady_clock::time_point start_time_ {};
+    };
+
+    perf_counters::perf_counters()
+    {
+        for (int& fd : fds_)
+            fd = -1;
+
+#if defined(__linux__)
+        const std::uint32_t types[counter_count] {PERF_TYPE_HARDWARE, PERF_TYPE_HARDWARE, PERF_TYPE_HARDWARE,
+            PERF_TYPE_HARDWARE, PERF_TYPE_HW_CACHE};
+
+        const std::uint64_t configs[counter_count] {PERF_COUNT_HW_CPU_CYCLES, PERF_COUNT_HW_INSTRUCTIONS,
+            PERF_COUNT_HW_BRANCH_INSTRUCTIONS, PERF_COUNT_HW_BRANCH_MISSES,
+            PERF_COUNT_HW_CACHE_L1D | (PERF_COUNT_HW_CACHE_OP_READ << 8) | (PERF_COUNT_HW_CACHE_RESULT_MISS << 16)};
+
+        for (int i = 0; i < counter_count; ++i)
+        {
+            perf_event_attr attr;
+            std::memset(&attr, 0, sizeof(attr));
+
+            attr.size = sizeof(attr);
+            attr.type = types[i];
+            attr.config = configs[i];
+            attr.disabled = (i == 0);
+            attr.exclude_kernel = 1;
+            attr.exclude_hv = 1;
+            attr.read_format = PERF_FORMAT_TOTAL_TIME_ENABLED | PERF_FORMAT_TOTAL_TIME_RUNNING;
+
+            // Everything is grouped under the cycle counter, so they are all scheduled together
+            fds_[i] = static_cast<int>(syscall(SYS_perf_event_open, &attr, 0, -1, fds_[0], 0));
+
+            if (fds_[i] == -1 && i == 0)
+            {
+                error_ = errno;
+
+                break;
+            }
+        }
+#else
+        error_ = ENOSYS;
+#endif
+    }
+
+    perf_counters::~perf_counters()
+    {
+#if defined(__linux__)
+        for (int fd : fds_)
+        {
+            if (fd != -1)
+                close(fd);
+        }
+#endif
+    }
+
+    bool perf_counters::available() const noexcept
+    {
+        return fds_[0] != -1;
+    }
+
+    int perf_counters::error() const noexcept
+    {
+        return error_;
+    }
+
+    void perf_counters::start()
+    {
+#if defined(__linux__)
+        if (available())
+        {
+            ioctl(fds_[0], PERF_EVENT_IOC_RESET, PERF_IOC_FLAG_GROUP);
+            ioctl(fds_[0], PERF_EVENT_IOC_ENABLE, PERF_IOC_FLAG_GROUP);
+        }
+#endif
+
+        start_time_ = std::chrono::steady_clock::now();
+        start_ticks_ = read_ticks();
+    }
+
+    counter_sample perf_counters::stop()
+    {
+        const std::uint64_t end_ticks = read_ticks();
+        const auto end_time = std::chrono::steady_clock::now();
+
+        counter_sample result;
+
+#if defined(__linux__)
+        if (available())
+        {
+            ioctl(fds_[0], PERF_EVENT_IOC_DISABLE, PERF_IOC_FLAG_GROUP);
+
+            for (int i = 0; i < counter_count; ++i)
+            {
+                std::uint64_t values[3] {}; // value, time enabled, time running
+
+                if (fds_[i] == -1 || read(fds_[i], values, sizeof(values)) != static_cast<ssize_t>(sizeof(values)))
+                    continue;
+
+                if (values[2] == 0)
+                    continue;
+
+                // Scale up if the counters were multiplexed
+                if (values[2] < values[1])
+                    values[0] = static_cast<std::uint64_t>(static_cast<double>(values[0]) *
+                        static_cast<double>(values[1]) / static_cast<double>(values[2]));
+
+                result.valid[i] = true;
+                result.values[i] = values[0];
+            }
+        }
+#endif
+
+        result.ticks = end_ticks - start_ticks_;
+        result.seconds = std::chrono::duration<double>(end_time - start_time_).count();
+
+        return result;
+    }
+
+    struct pattern_shape
+    {
+        const char* name;
+        const char* pattern;
+    };
+
+    const pattern_shape pattern_shapes[] {
+        {"literal-3", "48 8B 05"},
+        {"literal-8-absent", "DE AD BE EF CA FE BA BE"},
+        {"literal-16", "48 89 5C 24 08 48 89 74 24 10 57 48 83 EC 20 48"},
+        {"masked-call", "E8 ? ? ? ? 48 8B ? ? ? ? ? 48 85 C0"},
+        {"masked-rip", "48 8D 0D ? ? ? ? E8 ? ? ? ? 90"},
+        {"nibble-mask", "48 8? ? 24 ? 89"},
+        {"zero-run", "00 00 00 00 00 00 00 00 01"},
+    };
+
+    std::vector<mem::byte> make_random_haystack(std::size_t size)
+    {
+        std::vector<mem::byte> result(size);
+        std::uint64_t state = 0x9E3779B97F4A7C15;
+
+        for (mem::byte& value : result)
+        {
+            state ^= state << 13;
+            state ^= state >> 7;
+            state ^= state << 17;
+            value = static_cast<mem::byte>(state >> 24);
+        }
+
+        return result;
+    }
+
+    // Repeats the executable segments of this binary, to get something with the byte distribution of real code
+    std::vector<mem::byte> make_code_haystack(std::size_t size)
+    {
+        std::vector<mem::byte> code;
+
+        mem::module::main().enum_segments([&](mem::region range, mem::prot_flags prot) {
+            const mem::byte* const start = range.start.as<const mem::byte*>();
+
+            if (prot & mem::prot_flags::X)
+                code.insert(code.end(), start, start + range.size);
+
+            return false;
+        });
+
+        if (code.empty())
+            return make_random_haystack(size);
+
+        std::vector<mem::byte> result(size);
+
+        for (std::size_t i = 0; i < size; i += code.size())
+            std::memcpy(&result[i], code.data(), std::min(code.size(), size - i));
+
+        return result;
+    }
+
+    void print_header(bool hardware)
+    {
+        if (hardware)
+        {
+            std::printf("%-18s %-20s %10s %9s %9s %9s %12s %8s\n", "shape", "scanner", "matches", "cycles/B", "instr/B",
+                "br-miss%", "L1D-miss/KB", "GB/s");
+        }
+        else
+        {
+            std::printf("%-18s %-20s %10s %9s %8s\n", "shape", "scanner", "matches", "ticks/B", "GB/s");
+        }
+    }
+
+    void print_counter(bool valid, double value, const char* format, int width)
+    {
+        if (valid)
+            std::printf(format, width, value);
+        else
+            std::printf(" %*s", width, "-");
+    }
+
+    template <typename Scanner>
+    void run_scanner(perf_counters& counters, const char* shape, const char* name, Scanner& scanner,
+        mem::region range, std::size_t iterations)
+    {
+        counter_sample best;
+        std::size_t matches = 0;
+
+        // The first run only warms up the caches and the branch predictor
+        for (std::size_t i = 0; i <= iterations; ++i)
+        {
+            std::size_t count = 0;
+
+            counters.start();
+
+            scanner(range, [&](mem::pointer) {
+                ++count;
+
+                return false;
+            });
+
+            const counter_sample sample = counters.stop();
+
+            matches = count;
+
+            if (i == 0)
+                continue;
+
+            const bool hardware = sample.valid[counter_cycles];
+            const std::uint64_t cost = hardware ? sample.values[counter_cycles] : sample.ticks;
+            const std::uint64_t best_cost = hardware ? best.values[counter_cycles] : best.ticks;
+
+            if (i == 1 || cost < best_cost)
+                best = sample;
+        }
+
+        const double bytes = static_cast<double>(range.size);
+
+        std::printf("%-18s %-20s %10zu", shape, name, matches);
+
+        if (counters.available())
+        {
+            const bool* valid = best.valid;
+            const std::uint64_t* values = best.values;
+
+            print_counter(valid[counter_cycles], static_cast<double>(values[counter_cycles]) / bytes, " %*.3f", 9);
+            print_counter(valid[counter_instructions], static_cast<double>(values[counter_instructions]) / bytes,
+                " %*.3f", 9);
+            print_counter(valid[counter_branches] && valid[counter_branch_misses] && values[counter_branches],
+                100.0 * static_cast<double>(values[counter_branch_misses]) /
+                    static_cast<double>(values[counter_branches] ? values[counter_branches] : 1),
+                " %*.3f", 9);
+            print_counter(valid[counter_l1d_misses], 1024.0 * static_cast<double>(values[counter_l1d_misses]) / bytes,
+                " %*.2f", 12);
+        }
+        else
+        {
+            std::printf(" %9.3f", static_cast<double>(best.ticks) / bytes);
+        }
+
+        std::printf(" %8.2f\n", bytes / best.seconds / 1e9);
+    }
+
+    void run_haystack(perf_counters& counters, const char* name, const std::vector<mem::byte>& haystack,
+        std::size_t iterations)
+    {
+        const mem::region range(haystack.data(), haystack.size());
+
+        std::printf("\n%s haystack, %zu MiB\n", name, haystack.size() >> 20);
+        print_header(counters.available());
+
+        for (const pattern_shape& shape : pattern_shapes)
+        {
+            const mem::pattern pattern(shape.pattern);
+
+            mem::simd_scanner simd(pattern);
+            run_scanner(counters, shape.name, "simd_scanner", simd, range, iterations);
+
+            mem::simd_scanner simd_bigrams(
+                pattern, mem::simd_scanner::default_frequencies(), 1, mem::bigram_frequencies());
+            run_scanner(counters, shape.name, "simd_scanner+bigrams", simd_bigrams, range, iterations);
+
+            mem::boyer_moore_scanner boyer_moore(pattern);
+            run_scanner(counters, shape.name, "boyer_moore_scanner", boyer_moore, range, iterations);
+        }
+    }
+} // namespace
+
+int main(int argc, char** argv)
+{
+    std::size_t size_mib = 32;
+    std::size_t iterations = 5;
+
+    if (argc > 1)
+        size_mib = std::strtoul(argv[1], nullptr, 10);
+
+    if (argc > 2)
+        iterations = std::strtoul(argv[2], nullptr, 10);
+
+    if (size_mib == 0 || iterations == 0)
+    {
+        std::fprintf(stderr, "Usage: %s [size in MiB] [iterations]\n", argv[0]);
+
+        return 1;
+    }
+
+    perf_counters counters;
+
+    if (!counters.available())
+    {
+#if defined(MEM_ARCH_X86) || defined(MEM_ARCH_X86_64)
+        const char* fallback = "rdtsc";
+#else
+        const char* fallback = "steady_clock (ns)";
+#endif
+
+        std::printf("Hardware counters unavailable (%s), falling back to %s\n", std::strerror(counters.error()),
+            fallback);
+    }
+
+    const std::size_t size = size_mib << 20;
+
+    run_haystack(counters, "Random", make_random_haystack(size), iterations);
+    run_haystack(counters, "Code", make_code_haystack(size), iterations);
+}
@@ -54,6 +54,28 @@ namespace mem
         unsigned int result;
         asm("bsf %1, %0" : "=r"(result) : "rm"(x));
         return result;
+#endif
+    }
+
+    MEM_STRONG_INLINE unsigned int bsf64(std::uint64_t x) noexcept
+    {
+#if defined(__GNUC__)
+        return static_cast<unsigned int>(__builtin_ctzll(x));
+#else
+        const unsigned int low = static_cast<unsigned int>(x);
+
+        return low ? bsf(low) : (bsf(static_cast<unsigned int>(x >> 32)) + 32);
+#endif
+    }
+
+    MEM_STRONG_INLINE unsigned int popcount(unsigned int x) noexcept
+    {
+#if defined(__GNUC__)
+        return static_cast<unsigned int>(__builtin_popcount(x));
+#else
+        x = x - ((x >> 1) & 0x55555555);
+        x = (x & 0x33333333) + ((x >> 2) & 0x33333333);
+        return (((x + (x >> 4)) & 0x0F0F0F0F) * 0x01010101) >> 24;
 #endif
     }
 } // namespace mem
@@ -0,0 +1,105 @@
+/*
+    Copyright 2018 Brick
+
+    Permission is hereby granted, free of charge, to any person obtaining a copy of this software
+    and associated documentation files (the "Software"), to deal in the Software without restriction,
+    including without limitation the rights to use, copy, modify, merge, publish, distribute,
+    sublicense, and/or sell copies of the Software, and to permit persons to whom the Software is
+    furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included in all copies or
+    substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING
+    BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+    NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM,
+    DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+    OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+*/
+
+#ifndef MEM_ASYNC_SCAN_BRICK_H
+#define MEM_ASYNC_SCAN_BRICK_H
+
+#include "resumable_scan.h"
+
+#if defined(__cpp_impl_coroutine) && (__cpp_impl_coroutine >= 201902L)
+#    include <coroutine>
+#    include <utility>
+#    include <vector>
+
+namespace mem
+{
+    // Awaits a scan, which runs on the executor one chunk at a time so other work can run in between.
+    // The executor only needs an execute(func) member, as the executors of asio do. The awaiting coroutine is
+    // resumed on the executor with all of the matches.
+    template <typename Executor, typename Scanner>
+    class async_scan_awaitable
+    {
+    private:
+        Executor executor_;
+        resumable_scan<Scanner> scan_;
+        std::size_t chunk_size_;
+        std::coroutine_handle<> handle_ {};
+
+        void run();
+
+    public:
+        async_scan_awaitable(Executor executor, Scanner scanner, region range, std::size_t chunk_size);
+
+        bool await_ready() const noexcept;
+        void await_suspend(std::coroutine_handle<> handle);
+        std::vector<pointer> await_resume();
+    };
+
+    template <typename Executor, typename Scanner>
+    async_scan_awaitable<Executor, Scanner> async_scan(
+        Executor executor, Scanner scanner, region range, std::size_t chunk_size = internal::max_scan_chunk);
+
+    template <typename Executor, typename Scanner>
+    inline async_scan_awaitable<Executor, Scanner>::async_scan_awaitable(
+        Executor executor, Scanner scanner, region range, std::size_t chunk_size)
+        : executor_(std::move(executor))
+        , scan_(std::move(scanner), range)
+        , chunk_size_(chunk_size ? chunk_size : internal::max_scan_chunk)
+    {}
+
+    template <typename Executor, typename Scanner>
+    inline void async_scan_awaitable<Executor, Scanner>::run()
+    {
+        // The awaitable lives in the frame of the suspended coroutine, so it is safe to capture
+        if (scan_.step(chunk_size_))
+            handle_.resume();
+        else
+            executor_.execute([this] { run(); });
+    }
+
+    template <typename Executor, typename Scanner>
+    MEM_STRONG_INLINE bool async_scan_awaitable<Executor, Scanner>::await_ready() const noexcept
+    {
+        return scan_.done();
+    }
+
+    template <typename Executor, typename Scanner>
+    inline void async_scan_awaitable<Executor, Scanner>::await_suspend(std::coroutine_handle<> handle)
+    {
+        handle_ = handle;
+
+        executor_.execute([this] { run(); });
+    }
+
+    template <typename Executor, typename Scanner>
+    inline std::vector<pointer> async_scan_awaitable<Executor, Scanner>::await_resume()
+    {
+        return scan_.results();
+    }
+
+    template <typename Executor, typename Scanner>
+    inline async_scan_awaitable<Executor, Scanner> async_scan(
+        Executor executor, Scanner scanner, region range, std::size_t chunk_size)
+    {
+        return {std::move(executor), std::move(scanner), range, chunk_size};
+    }
+} // namespace mem
+#endif
+
+#endif // MEM_ASYNC_SCAN_BRICK_H
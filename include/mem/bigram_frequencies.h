@@ -0,0 +1,4137 @@
+/*
+    Copyright 2018 Brick
+
+    Permission is hereby granted, free of charge, to any person obtaining a copy of this software
+    and associated documentation files (the "Software"), to deal in the Software without restriction,
+    including without limitation the rights to use, copy, modify, merge, publish, distribute,
+    sublicense, and/or sell copies of the Software, and to permit persons to whom the Software is
+    furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included in all copies or
+    substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING
+    BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+    NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM,
+    DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+    OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+*/
+// Generated by mem_make_frequencies from 0x2A9B259C bytes of code in 1609 files
+
+#ifndef MEM_BIGRAM_FREQUENCIES_BRICK_H
+#define MEM_BIGRAM_FREQUENCIES_BRICK_H
+
+#include "defines.h"
+
+namespace mem
+{
+    // Cost of each pair of adjacent bytes (first * 0x100 + second), as -log2(p) in eighths of a bit
+    inline const byte* bigram_frequencies() noexcept
+    {
+        // clang-format off
+        static constexpr const byte frequencies[0x10000]
+        {
+            0x1E,0x50,0x5E,0x69,0x62,0x70,0x72,0x7A,0x68,0x6E,0x79,0x7C,0x7D,0x7C,0x7C,0x3F,
+            0x69,0x82,0x8B,0x8C,0x89,0x8B,0x89,0x8E,0x80,0x84,0x8F,0x8E,0x88,0x85,0x89,0x8D,
+            0x6C,0x85,0x84,0x86,0x87,0x78,0x88,0x8B,0x89,0x74,0x93,0x89,0x8B,0x82,0x8F,0x8A,
+            0x80,0x4D,0x91,0x8C,0x84,0x95,0x95,0x99,0x80,0x66,0x8F,0x74,0x6E,0x6F,0x8E,0x8B,
+            0x62,0x45,0x72,0x7B,0x50,0x53,0x81,0x8A,0x30,0x46,0x70,0x74,0x41,0x55,0x7D,0x83,
+            0x66,0x81,0x7C,0x63,0x96,0x5D,0x85,0x86,0x81,0x85,0x86,0x5D,0x99,0x74,0x8C,0x8B,
+            0x82,0x98,0x79,0x99,0x5F,0x98,0x49,0x99,0x61,0x7D,0x69,0x97,0x97,0x9C,0x9A,0x9B,
+            0x88,0xA0,0x7B,0x77,0x57,0x58,0x6F,0x6D,0x82,0x83,0x88,0x9A,0x8D,0x89,0x77,0x7B,
+            0x56,0x64,0x95,0x52,0x61,0x55,0x97,0x75,0x69,0x4F,0x7A,0x4E,0x9F,0x5F,0xA1,0x9D,
+            0x62,0x9A,0x9F,0xA3,0xA0,0xA1,0x9B,0xA0,0x8F,0x87,0xA1,0x9F,0xA1,0xA4,0xA6,0x96,
+            0x89,0xA2,0x9A,0xA0,0x97,0xA0,0xA4,0xA2,0x73,0x83,0x9F,0xA5,0x9D,0xA0,0xA2,0xA0,
+            0x81,0x8E,0x96,0x92,0xA1,0xA0,0xA4,0xA3,0x5F,0x60,0x56,0x78,0x9C,0x78,0x54,0x60,
+            0x70,0x69,0x8F,0x5D,0x6D,0x64,0x5D,0x56,0x91,0x8D,0x85,0x8B,0x90,0x8C,0x9D,0x9C,
+            0x8A,0x7F,0x93,0x75,0x90,0x9A,0x86,0x9A,0x85,0x7F,0x8F,0x83,0x8A,0x87,0x7F,0x8A,
+            0x72,0x92,0x95,0x99,0x82,0x9A,0x9A,0x97,0x45,0x4B,0x98,0x5A,0x99,0x8E,0x97,0x8E,
+            0x63,0x90,0x64,0x56,0x91,0x8E,0x66,0x74,0x82,0x8C,0x83,0x83,0x73,0x79,0x74,0x54,
+            0x36,0x66,0x79,0x81,0x70,0x7B,0x8F,0x91,0x7E,0x82,0x8C,0x96,0x87,0x8F,0x9B,0x51,
+            0x84,0x9B,0x9C,0x9B,0x8F,0x81,0x9A,0x9B,0x94,0x7B,0xA2,0x9E,0x9B,0x7D,0x9A,0xA0,
+            0x7C,0x7C,0x99,0x9B,0x97,0x78,0x9E,0x9E,0x97,0x8A,0x9F,0x9F,0x9A,0x7D,0x98,0x9C,
+            0x98,0x6E,0xA3,0xA1,0x9D,0x80,0xA7,0xA7,0x8B,0x75,0x92,0x8A,0x82,0x80,0x8B,0xA1,
+            0x78,0x5F,0x87,0x8B,0x67,0x6C,0x92,0x8D,0x4C,0x5F,0x88,0x8E,0x5F,0x6F,0x8F,0x94,
+            0x8B,0x97,0x99,0x83,0x94,0x8C,0x96,0x9A,0x96,0x94,0x98,0x7F,0x8E,0x84,0x9F,0x98,
+            0x9C,0x9F,0x6B,0x9B,0x6F,0x9D,0x67,0xA4,0x7F,0x9C,0x76,0x95,0x94,0x9E,0x9E,0x9E,
+            0x9E,0xA7,0x8F,0x8D,0x61,0x5F,0x74,0x75,0x8F,0x9D,0x9A,0x9E,0x8F,0x91,0x80,0x81,
+            0x76,0x81,0xA4,0x67,0x76,0x76,0x9F,0x9B,0x76,0x60,0x90,0x6D,0x98,0x76,0xA6,0xA6,
+            0x91,0xA1,0xA5,0x9E,0x99,0x9E,0xA3,0xA5,0xA1,0x9A,0xA6,0xA7,0x99,0xA0,0xA7,0xA7,
+            0x9B,0xA7,0xA6,0xA5,0x9E,0x9E,0xA6,0xA4,0x8D,0x9A,0xA9,0x9E,0x9C,0xA3,0xA4,0xA6,
+            0x90,0x93,0x9F,0x99,0x98,0x9D,0xA7,0xA2,0x7C,0x75,0x75,0x94,0x98,0x93,0x6F,0x80,
+            0x6A,0x6A,0x6C,0x6C,0x6E,0x6D,0x6A,0x6B,0x68,0x77,0x6C,0x80,0x87,0x84,0x78,0x79,
+            0x66,0x72,0x78,0x7A,0x8A,0x81,0x71,0x7B,0x71,0x7C,0x78,0x83,0x86,0x7E,0x7C,0x79,
+            0x79,0x82,0x81,0x85,0x90,0x82,0x82,0x80,0x5A,0x64,0x7A,0x6A,0x82,0x7F,0x7A,0x79,
+            0x6D,0x74,0x6D,0x70,0x88,0x7F,0x73,0x77,0x6F,0x78,0x74,0x7E,0x82,0x7C,0x75,0x69,
+            0x41,0x64,0x7C,0x7E,0x86,0x78,0x91,0x94,0x87,0x84,0x8F,0x99,0x96,0x98,0x9A,0x59,
+            0x88,0x93,0x93,0x9E,0x9B,0x9A,0x98,0x99,0x9A,0x8E,0xA2,0x9F,0x9E,0x9E,0xA0,0x9A,
+            0x87,0x9A,0x9C,0xA2,0x9E,0x96,0xA5,0x9D,0x9B,0x8C,0xA4,0xA4,0x9D,0x8B,0x90,0x9C,
+            0x98,0x6F,0xA5,0xA0,0xA1,0xA0,0xA6,0xA8,0x9C,0x83,0xA1,0x9C,0x89,0x93,0xA4,0xA4,
+            0x83,0x6A,0x8F,0x92,0x74,0x7A,0x95,0x99,0x58,0x6E,0x93,0x96,0x6B,0x7C,0x96,0x94,
+            0x92,0xA4,0x9E,0x93,0x98,0x98,0xA4,0xA0,0x98,0x97,0x9D,0x7F,0xA1,0x97,0xA7,0x9D,
+            0x9A,0xA2,0x74,0xA2,0x91,0xA1,0x6A,0x98,0x8C,0x9A,0x8E,0x9C,0xA2,0x99,0x99,0x9A,
+            0x9F,0xA1,0x81,0x89,0x68,0x6E,0x87,0x83,0x9B,0xA4,0xA3,0xA1,0x94,0x8F,0x8A,0x88,
+            0x7C,0x81,0xA7,0x6A,0x85,0x85,0xA6,0xA3,0x82,0x72,0x92,0x7C,0xA2,0x81,0xA7,0xA8,
+            0x93,0xA0,0xA2,0xA5,0xA4,0xA5,0xA5,0xA6,0xA4,0xA4,0xA4,0xA7,0xA3,0xA5,0xA5,0xA6,
+            0xA2,0xA8,0xA5,0xA8,0xA4,0xA5,0xA6,0xA1,0x93,0xA2,0xA6,0xA7,0xA3,0xA7,0xA3,0xA8,
+            0x94,0xA0,0xA2,0x9E,0xA5,0xA2,0xA8,0xA7,0x81,0x8A,0x7D,0x9B,0xA7,0x9D,0x74,0x84,
+            0x86,0x80,0xA2,0x7C,0x83,0x7E,0x88,0x84,0x9E,0x9D,0x9E,0xA1,0xA1,0x9F,0x9F,0xA4,
+            0x99,0x98,0xA3,0x95,0xA1,0xA1,0xA2,0xA4,0x9F,0x9D,0xA1,0xA1,0x95,0x9A,0xA1,0xA2,
+            0x99,0xA3,0xA2,0xA3,0x9F,0x95,0x9F,0xA4,0x6E,0x72,0xA0,0x74,0x9C,0x9F,0x95,0x9E,
+            0x98,0x9C,0x89,0x7C,0x9C,0x9D,0x88,0x90,0x92,0x96,0x94,0x93,0x8B,0x8B,0x83,0x74,
+            0x47,0x6E,0x7D,0x81,0x7E,0x86,0x8D,0x8C,0x85,0x81,0x95,0x8B,0x8D,0x97,0x99,0x5F,
+            0x89,0x9B,0xA1,0x9D,0x8F,0x94,0x9B,0x9F,0x95,0x95,0xA1,0xA1,0x91,0x9D,0x99,0x9C,
+            0x87,0xA0,0xA2,0x9F,0x99,0x93,0x9E,0xA1,0x91,0x92,0xA3,0x9F,0x92,0x9C,0x9B,0x9E,
+            0x95,0x74,0xA2,0x9B,0x95,0x9A,0xA3,0x9E,0x94,0x80,0xA0,0x99,0x83,0x93,0x8C,0x9B,
+            0x81,0x6E,0x81,0x88,0x72,0x76,0x8A,0x87,0x56,0x6B,0x8D,0x8F,0x6B,0x7B,0x91,0x91,
+            0x8A,0x94,0xA1,0x8F,0x89,0x8D,0x95,0x93,0x8C,0x98,0x9E,0x84,0x8E,0x8F,0x98,0x95,
+            0x97,0xA2,0x86,0x95,0x91,0x96,0x71,0x9F,0x8F,0x90,0x93,0x90,0x8F,0x98,0x98,0x99,
+            0x8F,0x97,0x8B,0x8C,0x70,0x74,0x86,0x81,0x90,0xA1,0x9E,0x94,0x8E,0x8E,0x8B,0x90,
+            0x81,0x84,0x92,0x6E,0x80,0x79,0x94,0x8D,0x7C,0x73,0x91,0x7C,0x92,0x84,0xA2,0x9F,
+            0x8C,0x9A,0xA5,0x9B,0x8E,0x8F,0xA0,0x9E,0x9B,0xA1,0xA7,0xA8,0x94,0x9C,0xA2,0xA0,
+            0x9D,0xA8,0xA4,0xA4,0x9E,0xA1,0xA3,0xA2,0x8E,0x9D,0xA6,0x9D,0x94,0xA1,0xA0,0xA0,
+            0x96,0x9B,0x9F,0x9C,0x92,0x9C,0xA3,0x9E,0x8A,0x8B,0x82,0x97,0x94,0x97,0x79,0x8E,
+            0x83,0x80,0xA1,0x85,0x8B,0x8D,0x86,0x80,0xA0,0xA3,0xA3,0xA3,0xA6,0xA6,0x9E,0xA3,
+            0x9C,0xA1,0xA6,0x91,0xA7,0xA4,0xA4,0xA2,0xA1,0xA0,0xA3,0xA4,0xA1,0xA6,0xA5,0xA1,
+            0x9F,0xA0,0xA2,0xA1,0xA1,0xA3,0xA1,0xA3,0x73,0x74,0xA3,0x77,0xA2,0xA1,0xA1,0x9F,
+            0x93,0x9C,0x8E,0x79,0x9C,0x9D,0x8F,0x92,0x94,0x95,0x93,0x91,0x8D,0x8A,0x84,0x73,
+            0x49,0x69,0x72,0x7B,0x7D,0x89,0x81,0x7D,0x77,0x7E,0x7F,0x85,0x8C,0x93,0x86,0x5E,
+            0x75,0x7F,0x81,0x84,0x8A,0x99,0x85,0x7C,0x83,0x8C,0x8B,0x92,0x8A,0xA1,0x8F,0x87,
+            0x82,0x93,0x96,0x94,0x51,0x52,0x97,0x90,0x83,0x87,0x8F,0x88,0x8E,0x9E,0x8B,0x88,
+            0x7B,0x73,0x88,0x87,0x87,0x9D,0x8C,0x84,0x84,0x7B,0x83,0x82,0x86,0x99,0x8A,0x89,
+            0x6E,0x68,0x84,0x8D,0x6D,0x78,0x8E,0x8C,0x54,0x66,0x80,0x8B,0x68,0x75,0x8F,0x90,
+            0x7D,0x91,0x87,0x92,0x99,0x9A,0x98,0x98,0x91,0x96,0xA2,0x87,0x9D,0x9F,0xA0,0xA0,
+            0x95,0x9C,0x7E,0xA6,0x8A,0xA0,0x6B,0xA5,0x95,0x96,0x93,0xA1,0x9F,0x91,0xA3,0xA0,
+            0x8E,0x97,0x88,0x8B,0x6F,0x69,0x7E,0x80,0x93,0x9F,0x96,0x98,0x91,0x9E,0x92,0x86,
+            0x71,0x70,0x6F,0x6A,0x7C,0x6B,0x7E,0x7D,0x7B,0x6A,0x79,0x71,0x84,0x7E,0x89,0x90,
+            0x77,0x82,0x7A,0x8D,0x86,0x8D,0x89,0x8E,0x90,0x93,0x97,0x93,0x96,0x91,0x99,0x9C,
+            0x93,0x98,0x9F,0xA0,0x9A,0x9A,0xA2,0x9F,0x88,0x95,0x95,0x9D,0x9C,0x91,0x9A,0x9B,
+            0x86,0x8B,0x84,0x94,0x88,0x8F,0x8F,0x8A,0x84,0x85,0x7B,0x93,0x8E,0x90,0x83,0x8D,
+            0x78,0x76,0x76,0x7C,0x7B,0x74,0x79,0x78,0x79,0x92,0x8E,0x92,0x96,0x89,0x90,0x91,
+            0x7A,0x80,0x90,0x86,0x8F,0x82,0x83,0x87,0x88,0x8F,0x94,0x94,0x94,0x8B,0x8F,0x92,
+            0x8C,0x8F,0x97,0x94,0x97,0x93,0x94,0x96,0x72,0x75,0x93,0x7C,0x91,0x87,0x8C,0x8E,
+            0x81,0x87,0x80,0x6F,0x93,0x87,0x87,0x88,0x85,0x8B,0x87,0x8C,0x89,0x83,0x80,0x75,
+            0x4E,0x71,0x7D,0x7E,0x7F,0x7E,0x83,0x84,0x81,0x7C,0x84,0x83,0x85,0x84,0x85,0x6A,
+            0x81,0x81,0x85,0x86,0x7D,0x85,0x86,0x85,0x83,0x7E,0x85,0x86,0x85,0x85,0x86,0x86,
+            0x82,0x82,0x86,0x86,0x86,0x84,0x86,0x86,0x84,0x7E,0x85,0x83,0x83,0x85,0x85,0x85,
+            0x84,0x79,0x86,0x86,0x85,0x85,0x85,0x86,0x84,0x7C,0x86,0x84,0x85,0x85,0x86,0x86,
+            0x7B,0x72,0x85,0x85,0x79,0x7B,0x85,0x85,0x61,0x73,0x83,0x85,0x71,0x7C,0x85,0x85,
+            0x83,0x81,0x85,0x85,0x86,0x85,0x86,0x85,0x84,0x7E,0x85,0x84,0x85,0x84,0x86,0x86,
+            0x84,0x82,0x83,0x86,0x86,0x85,0x77,0x86,0x84,0x7F,0x83,0x85,0x86,0x85,0x86,0x86,
+            0x85,0x81,0x81,0x85,0x79,0x7B,0x83,0x81,0x85,0x7F,0x86,0x86,0x85,0x86,0x84,0x84,
+            0x7D,0x7F,0x85,0x72,0x84,0x84,0x86,0x85,0x81,0x7A,0x83,0x7F,0x86,0x82,0x86,0x86,
+            0x83,0x81,0x86,0x86,0x86,0x85,0x86,0x86,0x83,0x7F,0x85,0x85,0x85,0x85,0x86,0x86,
+            0x84,0x81,0x86,0x86,0x85,0x85,0x86,0x85,0x84,0x7F,0x85,0x86,0x85,0x85,0x86,0x86,
+            0x84,0x81,0x83,0x86,0x86,0x85,0x86,0x85,0x7F,0x7D,0x81,0x84,0x86,0x84,0x83,0x80,
+            0x80,0x7E,0x85,0x80,0x7F,0x81,0x84,0x83,0x84,0x7E,0x85,0x86,0x86,0x85,0x86,0x86,
+            0x83,0x81,0x85,0x84,0x85,0x85,0x86,0x85,0x84,0x7E,0x85,0x85,0x85,0x85,0x86,0x86,
+            0x83,0x82,0x85,0x86,0x86,0x85,0x86,0x85,0x61,0x7A,0x85,0x7F,0x85,0x84,0x85,0x84,
+            0x80,0x80,0x85,0x82,0x85,0x84,0x83,0x84,0x82,0x7E,0x83,0x83,0x81,0x7F,0x7D,0x76,
+            0x52,0x72,0x81,0x87,0x82,0x8D,0x90,0x93,0x88,0x84,0x97,0x98,0x94,0x9B,0x9C,0x67,
+            0x8D,0x9D,0x9D,0x9F,0x72,0x9F,0x9F,0xA0,0x99,0x9A,0xA2,0xA1,0xA0,0xA2,0xA2,0xA2,
+            0x91,0xA2,0xA1,0xA3,0x95,0x93,0xA4,0xA5,0x9D,0x98,0xA6,0xA2,0xA4,0xA4,0xA5,0xA3,
+            0x9A,0x84,0xA5,0xA5,0xA5,0xA3,0xA6,0xAA,0x9E,0x8D,0xA6,0x9E,0x8D,0x9E,0xA7,0xA1,
+            0x86,0x71,0x90,0x9E,0x7E,0x83,0x99,0x91,0x5F,0x75,0x96,0x9D,0x73,0x83,0x9D,0x9E,
+            0x99,0xA1,0xA4,0x99,0xA1,0x9D,0xA5,0xA5,0xA3,0xA6,0xA6,0x8F,0xA5,0xA2,0xA5,0xA4,
+            0xA2,0xA7,0x77,0xA8,0x97,0xA7,0x6B,0xA8,0x9C,0xA0,0x9F,0xA4,0xA7,0xA6,0xA7,0xA8,
+            0xA0,0xAA,0x8D,0x9E,0x81,0x81,0x92,0x8B,0xA2,0xA7,0xA6,0xA3,0xA2,0xA3,0x96,0x96,
+            0x83,0x8E,0xA9,0x6F,0x92,0x82,0xAA,0xA6,0x83,0x7C,0x93,0x7B,0xA5,0x8B,0xA7,0xA8,
+            0x9B,0xA6,0xA2,0xA8,0xA9,0xA7,0xA6,0xA9,0x8D,0xA3,0xA5,0xA7,0xA1,0xA7,0xA7,0xA9,
+            0xA1,0xA8,0xA7,0xA9,0xA9,0xA9,0xA7,0xA6,0x95,0xA6,0xA8,0xAB,0xA7,0xA6,0xA2,0xA6,
+            0x9C,0xA3,0xA8,0xA4,0xA7,0xA6,0xA6,0xA7,0x8F,0x8F,0x90,0xA2,0xA6,0xA2,0x96,0x9E,
+            0x95,0x86,0xA5,0x87,0x85,0x81,0x92,0x86,0xA3,0xA8,0xA4,0xA7,0xA7,0xA7,0xA6,0xA8,
+            0x9C,0xA3,0xA6,0x9A,0xA3,0xA7,0xA6,0xA4,0x9E,0xA1,0xA6,0xA4,0x9F,0xA0,0xA6,0xA5,
+            0x9C,0xA6,0xA2,0xA4,0xA1,0xA3,0xA2,0xA5,0x86,0x80,0xA1,0x86,0xA1,0xA1,0xA2,0xA2,
+            0x82,0x9D,0x8E,0x81,0x9D,0x9D,0x89,0x92,0x91,0x95,0x93,0x93,0x8D,0x8A,0x83,0x76,
+            0x54,0x73,0x80,0x86,0x87,0x90,0x93,0x92,0x86,0x83,0x94,0x9C,0x9A,0x9E,0x9D,0x69,
+            0x89,0xA0,0x9F,0xA1,0x9D,0xA2,0xA0,0xA1,0x99,0x98,0xA2,0xA2,0xA0,0xA5,0xA3,0xA3,
+            0x8D,0x9C,0xA3,0x9D,0x9F,0x98,0xA6,0xA4,0x9B,0x94,0xA8,0xA3,0xA3,0xA5,0xA4,0xA4,
+            0x96,0x7C,0xA5,0xA4,0xA5,0x9E,0xA9,0xA7,0x9C,0x8C,0xA0,0x9C,0x84,0x94,0x90,0xA7,
+            0x87,0x70,0x96,0x9F,0x7C,0x84,0x9E,0x9D,0x5C,0x72,0x96,0x9E,0x70,0x83,0x9E,0xA1,
+            0x99,0xA3,0xA3,0x9D,0xA2,0x9B,0xA7,0xA9,0x93,0xA6,0xA6,0x8E,0xA7,0xA4,0xA4,0xA7,
+            0x95,0xA2,0x83,0xA1,0x9C,0xA6,0x75,0xA7,0xA4,0x9A,0x9E,0xA9,0xA6,0xA7,0xA5,0xA6,
+            0x9C,0xA8,0x8E,0x9D,0x7E,0x83,0x8C,0x86,0x9C,0xA3,0xA7,0xA9,0xA0,0xA1,0x93,0x96,
+            0x83,0x8C,0xA8,0x70,0x8F,0x80,0xA8,0xA9,0x84,0x7C,0x94,0x7F,0xA9,0x89,0xA7,0xA6,
+            0x9C,0xA5,0xA8,0xA9,0xA8,0xA8,0xA7,0xAC,0xA3,0xA3,0xA6,0xA8,0xA1,0xAA,0xA9,0xA9,
+            0xA2,0xA6,0xA7,0xA9,0xA9,0xA8,0xA8,0xA4,0x92,0xA0,0xA9,0xA8,0xA8,0xAB,0xA2,0xA8,
+            0x9B,0xA6,0xA8,0xA6,0xA8,0xA2,0xA6,0xA9,0x89,0x8E,0x8D,0x9F,0xA3,0xA0,0x8E,0x98,
+            0x93,0x81,0xA7,0x7D,0x89,0x83,0x88,0x84,0xA2,0xA9,0xA7,0xA7,0xAA,0xA4,0xA4,0xA8,
+            0x9A,0xA1,0xA8,0x95,0xA1,0xA5,0xA7,0xA7,0xA3,0xA3,0xA4,0xA4,0xA0,0xA4,0xA6,0xA5,
+            0x9A,0xA2,0xA3,0xA4,0xA2,0xA6,0xA3,0xA4,0x7E,0x7D,0xA2,0x83,0xA2,0xA0,0xA1,0x9F,
+            0x8D,0x9B,0x8E,0x80,0x9C,0x9C,0x8F,0x90,0x92,0x96,0x95,0x94,0x8F,0x8A,0x83,0x66,
+            0x4D,0x5D,0x6E,0x78,0x78,0x80,0x85,0x86,0x7B,0x76,0x88,0x8F,0x8D,0x8D,0x94,0x5A,
+            0x7F,0x91,0x92,0x8C,0x95,0x95,0x95,0x9A,0x89,0x88,0x9C,0x97,0x9C,0x9B,0x9D,0x9C,
+            0x84,0x93,0x9A,0xA0,0x98,0x8D,0xA0,0xA1,0x96,0x8B,0x9D,0x9B,0xA0,0x9C,0x9F,0x95,
+            0x91,0x64,0xA0,0x9E,0x95,0xA2,0xA2,0xA5,0x92,0x7B,0x9E,0x85,0x8A,0x8C,0xA1,0x9F,
+            0x7B,0x60,0x83,0x8E,0x64,0x6B,0x96,0x9B,0x45,0x59,0x80,0x88,0x56,0x66,0x8E,0x94,
+            0x8B,0x99,0x93,0x91,0x9D,0x98,0x9E,0x9C,0x98,0x97,0xA2,0x5F,0xA0,0x9B,0x9E,0xA2,
+            0x9F,0xA2,0x7F,0xA2,0x6E,0x9F,0x65,0xA0,0x9F,0xA0,0x86,0xA3,0x9F,0xA6,0x9B,0x8A,
+            0x96,0xA4,0x80,0x81,0x70,0x6F,0x89,0x8A,0x9B,0xA0,0x9B,0xA7,0x93,0x9B,0x8B,0x8B,
+            0x74,0x7E,0xA5,0x67,0x7C,0x70,0xA3,0xA0,0x7C,0x65,0x8F,0x64,0xA4,0x75,0xA8,0xA5,
+            0x93,0xA7,0xA6,0xA3,0xA3,0xA2,0xA0,0x97,0x9C,0x9D,0xA2,0xA7,0xA1,0xA7,0xA6,0xA6,
+            0xA4,0xA6,0xA4,0xA3,0xA8,0xA8,0xA9,0xA8,0x8A,0x9E,0xA8,0xA6,0xA3,0xA6,0xA4,0xA7,
+            0x91,0x9E,0xA4,0xA0,0xA3,0xA3,0xA5,0xA6,0x76,0x78,0x72,0x8E,0xA0,0x93,0x72,0x80,
+            0x86,0x7B,0x91,0x6C,0x7A,0x76,0x78,0x73,0x8D,0xA1,0x94,0xA0,0xA0,0xA1,0xA0,0xA1,
+            0x89,0x93,0xA1,0x91,0xA1,0xA2,0xA1,0xA2,0x99,0x98,0x9F,0xA2,0xA3,0x9C,0xA1,0x9F,
+            0x9A,0xA1,0xA1,0xA0,0x9F,0xA0,0xA2,0xA3,0x58,0x65,0x9B,0x6C,0xA0,0x9F,0x9F,0x9A,
+            0x88,0x8E,0x74,0x6E,0x98,0x99,0x7A,0x8B,0x8C,0x8E,0x8F,0x89,0x86,0x83,0x7B,0x67,
+            0x58,0x77,0x85,0x86,0x8A,0x90,0x96,0x96,0x8F,0x89,0x99,0x9D,0x99,0x9D,0x9F,0x6F,
+            0x94,0x9F,0xA0,0xA0,0x93,0xA0,0x9E,0xA1,0xA0,0x98,0xA4,0xA0,0xA0,0xA4,0xA2,0xA5,
+            0x9A,0xA0,0xA4,0xA6,0xA3,0x9C,0xA4,0xA7,0xA0,0x9D,0xA6,0xA6,0xA2,0xA6,0x9E,0xA6,
+            0xA0,0x74,0xA7,0xA5,0x99,0xA9,0xA7,0xA7,0x9F,0x94,0xA4,0x9B,0x91,0xA6,0xA6,0xA6,
+            0x8F,0x7C,0x97,0x9A,0x82,0x82,0x9E,0xA1,0x69,0x7A,0x9E,0xA3,0x7E,0x89,0x9E,0x9F,
+            0x9C,0xA5,0xA6,0x9F,0x96,0x9C,0xA3,0xA3,0xA0,0xA2,0xA5,0x93,0xA2,0xA2,0xA8,0xA9,
+            0xA5,0xA7,0x92,0x9D,0xA0,0xA5,0x81,0xA3,0xA5,0xA8,0x9A,0xA7,0xA4,0xA3,0xA7,0xA5,
+            0xA3,0xA7,0x88,0x9A,0x87,0x8A,0x88,0x87,0x9C,0xA5,0xA7,0xA7,0x99,0xA2,0x9E,0xA2,
+            0x83,0x8F,0xA3,0x77,0x94,0x91,0x99,0x91,0x92,0x87,0x97,0x89,0xA3,0x94,0xA6,0xA8,
+            0x92,0xA3,0xA6,0xA2,0xA0,0x9B,0xA5,0xA2,0xA6,0xA7,0xA4,0xA7,0xA4,0xA7,0xA5,0xA6,
+            0xA5,0xA5,0xA7,0xA6,0xA6,0xA5,0xAA,0xA3,0x9B,0xA3,0xA9,0xA5,0xA7,0xA6,0xA4,0xA5,
+            0xA0,0xA5,0xA4,0xA4,0xA3,0xA3,0xA5,0xA1,0x97,0x9C,0x9A,0x9D,0xA0,0xA1,0x97,0xA0,
+            0x7C,0x6E,0x72,0x7E,0x84,0x7B,0x79,0x80,0x6A,0x8D,0x71,0x89,0x97,0x8A,0x7F,0x86,
+            0x67,0x7D,0x8D,0x89,0x91,0x8B,0x82,0x88,0x7D,0x8D,0x86,0x98,0x99,0x8D,0x8E,0x90,
+            0x83,0x95,0x92,0x96,0x9F,0x91,0x99,0x9C,0x78,0x85,0x8C,0x84,0x95,0x95,0x8F,0x90,
+            0x70,0x7F,0x7A,0x82,0x93,0x8D,0x8C,0x8A,0x74,0x83,0x80,0x88,0x8D,0x84,0x7D,0x7A,
+            0x59,0x76,0x82,0x88,0x8C,0x93,0x95,0x97,0x8E,0x8D,0x99,0x9C,0x9B,0x9E,0x9F,0x70,
+            0x8A,0xA0,0xA1,0xA2,0x93,0xA0,0x98,0xA2,0x9F,0x9A,0xA4,0xA2,0xA4,0xA5,0xA2,0xA2,
+            0x90,0xA2,0x81,0xA5,0x9D,0x90,0xA6,0xA5,0x9F,0x9E,0xA6,0xA8,0xA7,0xA3,0xA4,0xA4,
+            0x97,0x84,0xA4,0xA6,0xA3,0xA5,0xA9,0xAA,0xA3,0x95,0xA7,0xA2,0x96,0xA3,0xA5,0xA3,
+            0x8D,0x78,0x9F,0xA3,0x81,0x8C,0xA2,0xA3,0x67,0x7C,0x9B,0xA5,0x80,0x8D,0xA3,0xA3,
+            0x9B,0xA2,0xA6,0xA4,0x9F,0xA4,0xA4,0xA7,0xA4,0xA6,0xA7,0x91,0xA3,0xA2,0xA8,0xA6,
+            0x9E,0xA4,0x7F,0xA7,0x9F,0xA8,0x78,0xA8,0xA8,0xA8,0x9F,0xA9,0xA5,0xA6,0xA8,0xA7,
+            0x9F,0xAA,0x94,0x9B,0x86,0x83,0x9A,0x8D,0xA0,0xAA,0xA8,0xA8,0xA3,0xA8,0x9F,0xA0,
+            0x85,0x8B,0xA8,0x7B,0x90,0x94,0xA5,0x9B,0x8F,0x85,0x99,0x84,0xA7,0x94,0xA6,0xA7,
+            0x92,0xA8,0xA5,0xA7,0xA6,0xA6,0xA7,0xAC,0xA7,0xA0,0xA5,0xA8,0xA5,0xA7,0xA9,0xA6,
+            0xA6,0xA6,0xA8,0xAB,0xA9,0x9F,0xA8,0xA6,0x9F,0xA6,0xA9,0xA8,0xA7,0xAA,0xA4,0xA9,
+            0x9F,0xA3,0xA1,0xA6,0xA2,0xA6,0xA5,0xA4,0x90,0x99,0x91,0x9D,0xA7,0x9F,0x92,0x97,
+            0x9E,0x83,0xA6,0x8F,0x8F,0x84,0x96,0x88,0xA9,0xA8,0xA8,0xA9,0xA8,0xA4,0xA5,0xA7,
+            0xA2,0xA4,0xA6,0xA3,0xA6,0xA6,0xA4,0x9C,0xA5,0xA3,0xA4,0xA3,0xA2,0xA4,0xA6,0xA5,
+            0xA1,0xA4,0xA5,0xA3,0xA0,0xA5,0xA2,0xA4,0x8B,0x8B,0xA3,0x8A,0xA1,0xA0,0xA0,0xA0,
+            0x8C,0x9D,0x94,0x81,0x9D,0x9C,0x8C,0x96,0x92,0x95,0x95,0x93,0x8D,0x8C,0x84,0x7C,
+            0x5B,0x7B,0x85,0x89,0x8C,0x8D,0x95,0x96,0x8F,0x88,0x9B,0x9C,0x95,0x9C,0x9F,0x6C,
+            0x93,0xA0,0xA4,0x9E,0x93,0xA1,0xA0,0xA4,0x99,0x9F,0xA3,0xA2,0xA0,0xA1,0xA6,0xA6,
+            0x97,0xA4,0xA8,0xA5,0xA1,0x9B,0xA5,0xA8,0x9D,0x9E,0xA6,0xA5,0xA2,0xA3,0xA2,0xA6,
+            0x9F,0x84,0xA5,0xA2,0xA1,0xA2,0xA8,0xA7,0xA1,0x9D,0xAA,0xA2,0x9E,0x94,0xA8,0xA6,
+            0x93,0x79,0x9A,0x9A,0x82,0x89,0x9C,0x9E,0x61,0x74,0x9A,0x9E,0x6F,0x8B,0x9E,0x9D,
+            0x99,0x9E,0xA1,0x9E,0x98,0x93,0x9F,0xA2,0xA2,0xA2,0xA1,0x97,0x9E,0x9D,0xA6,0xA2,
+            0xA4,0xA3,0x97,0xA6,0xA1,0xA2,0x6C,0xA5,0xA1,0x98,0xA0,0xA6,0xA1,0xA6,0xA5,0xA8,
+            0xA3,0xA6,0x9E,0x96,0x87,0x89,0x9A,0x8F,0xA2,0xA6,0xA6,0xA6,0xA0,0xA5,0x98,0x97,
+            0x8C,0x8E,0xA2,0x7D,0x8C,0x8F,0xA4,0x9A,0x8F,0x84,0x99,0x7D,0x95,0x93,0xA7,0xA5,
+            0x86,0x9C,0xA6,0xA0,0xA1,0xA3,0xA5,0xA3,0xA5,0xA2,0xA3,0xA8,0xA3,0xA8,0xA8,0xA9,
+            0xA7,0xA7,0xA6,0xA6,0xA8,0xA7,0xA9,0xA8,0x99,0x9D,0xA8,0xA6,0xA5,0xA8,0xA8,0xA6,
+            0xA1,0xA5,0xA1,0xA2,0xA2,0xA4,0xA6,0xA2,0x8C,0x9E,0x85,0xA4,0xA4,0xA1,0x8C,0x92,
+            0x9B,0x95,0x9F,0x87,0x90,0x93,0x92,0x8C,0xA1,0xA1,0x9E,0x9E,0x9F,0x9B,0x9D,0x95,
+            0x9F,0xA3,0xA1,0x9E,0x99,0xA5,0xA2,0x98,0x9E,0xA1,0xA1,0xA0,0x9E,0xA2,0xA1,0x93,
+            0x9F,0xA2,0x9D,0x9C,0x9B,0x9D,0xA0,0x97,0x8D,0x88,0x9C,0x82,0x9B,0xA1,0x9F,0x91,
+            0x8F,0x9E,0x95,0x8F,0x97,0x9B,0x91,0x93,0x95,0x94,0x94,0x91,0x8D,0x8B,0x82,0x6C,
+            0x5A,0x6F,0x76,0x7A,0x82,0x8D,0x81,0x7F,0x85,0x81,0x84,0x8E,0x90,0x99,0x8D,0x6C,
+            0x7B,0x89,0x8C,0x8E,0x95,0x99,0x83,0x82,0x8A,0x91,0x93,0x95,0x9B,0xA4,0x98,0x95,
+            0x8D,0x98,0x9D,0x9D,0x62,0x74,0x9D,0x9D,0x88,0x94,0x96,0x94,0x9C,0xA3,0x94,0x94,
+            0x82,0x7D,0x90,0x95,0x8B,0xA4,0x90,0x83,0x8C,0x88,0x8E,0x8D,0x8F,0x9B,0x95,0x93,
+            0x82,0x71,0x8D,0x8E,0x75,0x7E,0x94,0x97,0x62,0x6F,0x8B,0x99,0x76,0x87,0x99,0x9B,
+            0x95,0x8D,0x8C,0x9E,0x9F,0xA3,0x98,0x9F,0xA1,0x9E,0xA5,0x8D,0xA4,0xA4,0xA6,0xA3,
+            0xA3,0xA5,0x8C,0xA8,0x89,0xA6,0x75,0xA6,0xA3,0x9E,0x95,0xA1,0xA7,0x99,0xA9,0xA6,
+            0x9C,0x99,0x94,0x88,0x85,0x7E,0x87,0x87,0x9C,0xA2,0x9F,0xA5,0xA3,0xA7,0x9C,0x91,
+            0x7C,0x7F,0x86,0x76,0x8A,0x78,0x8C,0x8E,0x83,0x70,0x83,0x75,0x9D,0x7F,0x8B,0x8D,
+            0x81,0x92,0x8E,0x96,0x96,0x8E,0x90,0x95,0x98,0x9A,0x9E,0x9E,0xA2,0x97,0xA0,0x9F,
+            0x9E,0xA4,0xA4,0xA5,0xA2,0xA0,0xA4,0xA5,0x96,0x94,0x9F,0xA4,0xA2,0x99,0x97,0xA2,
+            0x91,0x94,0x91,0x9D,0x95,0x94,0x95,0x92,0x88,0x86,0x89,0x9A,0x98,0x93,0x8B,0x95,
+            0x8E,0x7D,0x7F,0x72,0x85,0x7B,0x85,0x82,0x85,0x92,0x80,0x93,0x99,0x8E,0x91,0x8E,
+            0x88,0x8D,0x97,0x8A,0x98,0x8D,0x8A,0x8A,0x97,0x99,0x9F,0xA1,0xA1,0x94,0x9C,0x96,
+            0x97,0xA1,0x9E,0xA2,0x9C,0x9A,0x9D,0x9E,0x74,0x78,0x9C,0x7E,0x9B,0x95,0x94,0x9B,
+            0x88,0x93,0x8C,0x77,0x94,0x8D,0x8A,0x8E,0x8E,0x91,0x8B,0x91,0x8D,0x87,0x83,0x77,
+            0x5E,0x78,0x80,0x84,0x87,0x8A,0x8C,0x8D,0x87,0x83,0x8E,0x90,0x8F,0x90,0x8F,0x77,
+            0x8B,0x8D,0x8D,0x90,0x90,0x91,0x90,0x91,0x8E,0x8C,0x90,0x92,0x8F,0x91,0x90,0x91,
+            0x8E,0x8F,0x92,0x92,0x91,0x90,0x91,0x92,0x8F,0x8C,0x91,0x92,0x91,0x92,0x92,0x91,
+            0x90,0x83,0x92,0x92,0x90,0x91,0x91,0x92,0x8F,0x8C,0x91,0x91,0x8F,0x91,0x93,0x92,
+            0x7A,0x7E,0x91,0x92,0x85,0x8B,0x90,0x92,0x67,0x7B,0x90,0x91,0x7F,0x8A,0x91,0x8F,
+            0x91,0x8E,0x90,0x92,0x90,0x92,0x92,0x92,0x90,0x8D,0x92,0x8F,0x91,0x92,0x92,0x92,
+            0x90,0x8E,0x91,0x92,0x91,0x92,0x84,0x92,0x91,0x8C,0x90,0x91,0x91,0x92,0x92,0x93,
+            0x91,0x90,0x8F,0x91,0x89,0x87,0x8F,0x8B,0x90,0x8D,0x92,0x93,0x92,0x92,0x91,0x91,
+            0x7F,0x88,0x91,0x80,0x88,0x8F,0x8E,0x8B,0x8B,0x82,0x8E,0x88,0x92,0x8E,0x8F,0x92,
+            0x8F,0x8F,0x90,0x92,0x92,0x92,0x90,0x91,0x91,0x8D,0x92,0x93,0x92,0x8F,0x92,0x93,
+            0x91,0x8F,0x91,0x91,0x92,0x91,0x91,0x92,0x91,0x8D,0x91,0x92,0x91,0x91,0x92,0x92,
+            0x90,0x8F,0x92,0x91,0x91,0x92,0x91,0x92,0x8C,0x8D,0x81,0x92,0x90,0x91,0x8E,0x91,
+            0x8F,0x8B,0x92,0x7A,0x8F,0x8E,0x8E,0x8E,0x91,0x8C,0x92,0x93,0x92,0x91,0x93,0x91,
+            0x90,0x8D,0x91,0x91,0x91,0x92,0x90,0x91,0x91,0x8D,0x91,0x92,0x91,0x91,0x92,0x90,
+            0x90,0x8F,0x91,0x91,0x91,0x90,0x91,0x92,0x85,0x89,0x90,0x89,0x91,0x90,0x91,0x8F,
+            0x8E,0x8E,0x8E,0x89,0x8E,0x8D,0x88,0x8E,0x8C,0x89,0x8B,0x8A,0x89,0x85,0x81,0x7B,
+            0x5F,0x7A,0x83,0x8A,0x8E,0x94,0x96,0x97,0x8F,0x87,0x9C,0x9A,0x8A,0x9D,0xA0,0x71,
+            0x90,0xA2,0xA3,0xA1,0x9E,0xA2,0xA4,0xA2,0x9E,0xA1,0xA4,0xA3,0xA3,0xA5,0xA4,0xA5,
+            0x93,0xA4,0xA8,0xA9,0xA4,0x9A,0xA5,0xA5,0xA2,0xA1,0xA7,0xA9,0xA7,0xA5,0xA8,0xA7,
+            0xA2,0x88,0xA8,0xA5,0xA3,0xA4,0xA9,0xA9,0xA1,0x96,0xA6,0xA3,0x9B,0xA2,0xA9,0xA6,
+            0x91,0x7A,0xA0,0xA5,0x85,0x8A,0xA4,0xA8,0x65,0x7B,0x9A,0xA2,0x7E,0x8E,0xA2,0xA2,
+            0xA4,0xA4,0xA6,0xA7,0xA4,0xA7,0xA5,0xA9,0xA6,0xA7,0xA6,0x9C,0xA7,0xA5,0xA7,0xA8,
+            0xA3,0xA6,0x90,0xAA,0x9F,0xA9,0x7B,0xAA,0xA5,0xA7,0xA3,0xA9,0xA9,0xAA,0xA7,0xA6,
+            0xA8,0xA8,0xA5,0xA4,0x8D,0x90,0x96,0x8F,0xA1,0xA7,0xA9,0xA9,0xA8,0xA7,0xA3,0xA4,
+            0x8B,0x8E,0xA6,0x82,0x9D,0x96,0xA9,0xAB,0x8D,0x86,0x9A,0x84,0xA6,0x94,0xAB,0xA7,
+            0x95,0xA7,0xA6,0xA8,0xA7,0xA8,0xA6,0xA0,0xA5,0xA5,0xA6,0xA8,0xAC,0x9E,0xAA,0xA8,
+            0xA8,0xA6,0xA7,0xAB,0xA7,0xA9,0xA4,0xAA,0xA1,0xA5,0xA8,0xA9,0xA7,0xA8,0xA4,0xA9,
+            0xA2,0xA5,0xAA,0xA6,0xA9,0xA6,0xA8,0xA7,0x92,0x9A,0x8B,0xA3,0xA8,0xA2,0x94,0xA1,
+            0x9C,0x94,0xA6,0x98,0x91,0x91,0x95,0x97,0xA2,0xA8,0xA7,0xA8,0xA6,0xA7,0xA6,0xAA,
+            0xA2,0xA3,0xA7,0xA3,0xA4,0xA6,0xA6,0xA4,0xA6,0xA2,0xA5,0xA4,0xA5,0xA3,0xA4,0xA4,
+            0xA4,0xA6,0xA3,0xA5,0xA0,0xA4,0xA0,0xA3,0x8E,0x8E,0xA1,0x89,0xA1,0xA1,0x9F,0xA1,
+            0x98,0x9E,0x90,0x8B,0x99,0x9D,0x8E,0x97,0x94,0x96,0x95,0x92,0x8D,0x89,0x85,0x7C,
+            0x5E,0x77,0x82,0x89,0x78,0x8F,0x95,0x99,0x8F,0x85,0x9B,0x5D,0x97,0x80,0x9D,0x6A,
+            0x4B,0x47,0x68,0x70,0x69,0x83,0x61,0x77,0x73,0xA5,0xA6,0xA6,0xA2,0xA7,0x72,0x39,
+            0x90,0xA4,0xA7,0xA7,0xA5,0x9A,0xA7,0x8F,0x52,0x4E,0x65,0xA6,0x70,0x8B,0x69,0x67,
+            0x9E,0x83,0xA6,0xA7,0xA9,0xA4,0xA7,0xA9,0x69,0x93,0x79,0xA0,0x8C,0xA3,0xA6,0xA7,
+            0x84,0x76,0x69,0x6E,0x5E,0x60,0x70,0x6B,0x60,0x70,0x9C,0xA0,0x70,0x7A,0x76,0x71,
+            0x94,0x85,0xA3,0x9F,0x6B,0x86,0x7C,0x64,0x55,0x53,0x72,0x83,0x65,0x7C,0x6B,0x79,
+            0x6D,0x70,0x65,0x90,0x8E,0x8E,0x77,0x7D,0x81,0x78,0x83,0x70,0x5F,0x87,0x54,0x4C,
+            0x5B,0x76,0x68,0x78,0x71,0x83,0x78,0x83,0xA3,0xA9,0xAA,0xA9,0x91,0xA8,0x5A,0x62,
+            0x7C,0x8B,0x60,0x5C,0x3E,0x44,0x5D,0x5A,0x63,0x6F,0x81,0x83,0x71,0x70,0x5C,0x63,
+            0x93,0x8E,0x74,0x7C,0x5F,0x62,0x7D,0x7B,0x9E,0x99,0x80,0x80,0x85,0x8A,0x87,0x7C,
+            0xA3,0xA9,0x9B,0x6D,0x90,0x9F,0xA9,0xA4,0x9D,0xA3,0xAB,0x87,0x8F,0xA0,0x95,0x58,
+            0x9B,0x73,0xA9,0x91,0xA9,0xA9,0x46,0x50,0x82,0x9B,0x79,0x91,0x6F,0x78,0x67,0x6A,
+            0x91,0x75,0x82,0x95,0x88,0x81,0x6C,0x8E,0x82,0x8C,0x8B,0x9A,0x9E,0x9B,0x93,0x98,
+            0x88,0x96,0x9D,0x92,0x7E,0x85,0x6C,0x6F,0x94,0x77,0x95,0x75,0xA1,0x91,0x9B,0x82,
+            0x92,0x9D,0x84,0x94,0x94,0x98,0x95,0x9E,0x81,0x82,0x7E,0x6F,0x9B,0x8A,0x79,0x54,
+            0x8A,0x97,0x8F,0x87,0x89,0x62,0x80,0x94,0x8D,0x71,0x79,0x8B,0x85,0x70,0x5D,0x7A,
+            0x53,0x5D,0x6B,0x72,0x69,0x6D,0x74,0x7B,0x7A,0x76,0x84,0x85,0x7A,0x72,0x84,0x57,
+            0x7E,0x88,0x8C,0x8C,0x80,0x76,0x8B,0x85,0x89,0x8D,0x91,0x8B,0x88,0x7C,0x8E,0x93,
+            0x84,0x90,0x92,0x97,0x8A,0x7E,0x86,0x90,0x92,0x8B,0x96,0x99,0x8F,0x84,0x8E,0x94,
+            0x90,0x6D,0x92,0x97,0x87,0x87,0x8D,0x9C,0x90,0x7F,0x93,0x8C,0x84,0x82,0x8E,0x9C,
+            0x70,0x61,0x78,0x79,0x5D,0x6C,0x75,0x79,0x47,0x5C,0x7A,0x7C,0x57,0x69,0x78,0x80,
+            0x80,0x84,0x83,0x82,0x72,0x86,0x7D,0x85,0x84,0x86,0x88,0x6F,0x78,0x8A,0x81,0x8B,
+            0x88,0x8C,0x83,0x91,0x73,0x91,0x62,0x90,0x89,0x8C,0x87,0x97,0x83,0x95,0x87,0x94,
+            0x8D,0x8F,0x82,0x88,0x6F,0x71,0x84,0x85,0x8D,0x8E,0x90,0x99,0x83,0x92,0x86,0x8E,
+            0x75,0x7B,0x9D,0x6C,0x67,0x6F,0x98,0x95,0x80,0x68,0x91,0x69,0x79,0x7B,0x96,0x9A,
+            0x90,0xA2,0xA2,0x9D,0x80,0x99,0x91,0x9C,0x99,0x9F,0xA3,0x9F,0x83,0x9A,0x99,0x9F,
+            0x9F,0xA1,0x9C,0xA0,0x8A,0x9D,0xA3,0xA2,0x8E,0x9E,0xA6,0xA5,0x8E,0x9F,0x95,0xA4,
+            0x97,0xA0,0xA2,0xA1,0x8D,0x9A,0xA5,0xA4,0x7C,0x75,0x76,0x96,0x8C,0x91,0x73,0x81,
+            0x8B,0x7D,0x91,0x81,0x75,0x72,0x79,0x76,0x9B,0xA0,0x90,0x98,0xA1,0xA0,0xA2,0xA1,
+            0x8D,0x9A,0xA2,0x8C,0x93,0xA0,0x94,0x95,0x92,0x90,0x9D,0x8F,0x99,0x9C,0x97,0x9E,
+            0x99,0x9E,0x98,0x9E,0x9B,0x94,0x9F,0x9F,0x5F,0x68,0xA0,0x71,0x9E,0x9D,0x94,0x9A,
+            0x89,0x98,0x7A,0x6B,0x97,0x96,0x7F,0x87,0x84,0x8D,0x8A,0x85,0x84,0x81,0x7A,0x69,
+            0x5E,0x75,0x7A,0x76,0x66,0x84,0x7B,0x76,0x7F,0x87,0x8D,0x8C,0x7B,0x9B,0x90,0x74,
+            0x86,0x8D,0x94,0x93,0x80,0x9E,0x93,0x95,0x8D,0x96,0x97,0x97,0x88,0xA1,0x98,0x9A,
+            0x8D,0x96,0x99,0x99,0x88,0x94,0x99,0x94,0x91,0x9B,0x9C,0x9B,0x89,0xA1,0x9E,0x9F,
+            0x92,0x89,0x9C,0x9E,0x8B,0x9E,0x9D,0xA0,0x90,0x93,0x9D,0x9A,0x89,0x9D,0x9E,0xA1,
+            0x68,0x74,0x76,0x6D,0x5F,0x6D,0x77,0x71,0x62,0x79,0x84,0x7E,0x6B,0x7D,0x83,0x81,
+            0x7B,0x8A,0x8B,0x84,0x73,0x84,0x8A,0x88,0x7E,0x91,0x8E,0x88,0x79,0x88,0x8E,0x8E,
+            0x83,0x93,0x8B,0x8F,0x7C,0x8D,0x7E,0x92,0x83,0x96,0x93,0x90,0x7E,0x8E,0x93,0x94,
+            0x84,0x97,0x91,0x91,0x78,0x86,0x92,0x90,0x85,0x9A,0x95,0x90,0x7E,0x8B,0x94,0x95,
+            0x72,0x8D,0x89,0x6D,0x69,0x75,0x7C,0x78,0x80,0x83,0x8A,0x81,0x7B,0x87,0x90,0x86,
+            0x88,0x99,0x98,0x89,0x80,0x8B,0x8A,0x8E,0x8B,0x9D,0x9D,0x8F,0x84,0x8F,0x98,0x93,
+            0x8B,0x9B,0x9F,0x91,0x84,0x8F,0x96,0x94,0x8A,0x9F,0xA0,0x92,0x86,0x91,0x97,0x92,
+            0x89,0x9F,0xA0,0x92,0x87,0x91,0x97,0x95,0x81,0x9C,0x8F,0x90,0x86,0x90,0x91,0x93,
+            0x9D,0x95,0xA3,0x99,0x91,0x90,0x99,0x95,0xA1,0xA5,0xA4,0xA3,0xA7,0xA6,0xA7,0xA5,
+            0x9B,0x96,0xA0,0x99,0x9D,0x9E,0x9A,0x96,0xA0,0xA2,0xA0,0xA1,0xA4,0xA2,0xA2,0xA2,
+            0xA1,0xA1,0xA3,0xA3,0xA1,0xA4,0xA3,0xA2,0x8C,0x8C,0xA1,0x89,0xA1,0x9F,0x9F,0x9A,
+            0x93,0x9C,0x95,0x8B,0x9D,0x9B,0x95,0x97,0x8F,0x95,0x93,0x91,0x8B,0x8A,0x83,0x7A,
+            0x61,0x78,0x83,0x85,0x8C,0x92,0x95,0x95,0x91,0x8A,0x92,0x9A,0x8F,0x95,0x99,0x76,
+            0x9A,0x9C,0xA1,0x9F,0x9E,0xA1,0x9F,0xA3,0x9B,0x9E,0xA4,0xA3,0x9C,0xA1,0x9D,0x9C,
+            0x9D,0x9D,0x9C,0x98,0x98,0x9C,0x9F,0xA3,0xA1,0xA0,0xA5,0xA5,0xA3,0xA5,0xA2,0xA4,
+            0xA2,0x8D,0xA7,0xA7,0xA6,0xA6,0xA4,0xA9,0xA4,0x95,0xA8,0xA2,0x9C,0x9F,0xA1,0xA5,
+            0x94,0x81,0x9E,0x9F,0x86,0x8D,0x9C,0x8F,0x66,0x7D,0x97,0x9F,0x79,0x8D,0x8C,0x9D,
+            0x9C,0xA2,0x9F,0xA1,0x8D,0x98,0x98,0x97,0x9A,0x9E,0xA1,0x9C,0x83,0x9F,0x8E,0xA0,
+            0x9D,0xA2,0x95,0x97,0x87,0x9D,0x7A,0xA3,0xA1,0xA1,0xA0,0xA1,0x82,0x95,0x9C,0xA4,
+            0xA0,0xA7,0xA2,0xA2,0x82,0x80,0x9D,0x99,0x9F,0xA2,0xA6,0xA7,0x8C,0xA2,0xA2,0xA5,
+            0x8C,0x8F,0xA5,0x80,0x9D,0x91,0xA8,0xA6,0x96,0x88,0x9A,0x88,0xA0,0x93,0x8B,0xA6,
+            0x98,0xA6,0x9F,0xA0,0xA4,0xA5,0xA6,0xA9,0xAA,0xA3,0xA3,0xA7,0x9E,0x9C,0x8B,0xA4,
+            0xA3,0xA5,0xA3,0xA9,0xA5,0xA5,0xA7,0xA7,0xA1,0xA3,0xA9,0x9F,0xA0,0x9E,0x8A,0xA7,
+            0xA4,0xA8,0xA8,0xA6,0xAA,0xA7,0xA8,0xA8,0x93,0x98,0x94,0xA5,0xA6,0x9E,0x89,0xA1,
+            0x95,0x8C,0x96,0x97,0x92,0x91,0x9B,0x92,0x95,0x9F,0xA2,0xA8,0xA2,0xA2,0xA2,0xA3,
+            0x8A,0x9E,0x9F,0xA3,0xA2,0xA4,0xA4,0xA2,0x9C,0x8B,0xA0,0x9F,0xA1,0xA1,0xA2,0x9F,
+            0x9C,0x9B,0x9F,0x9F,0xA1,0xA3,0x9F,0xA3,0x8E,0x8B,0xA0,0x8A,0xA0,0x9F,0xA0,0x9F,
+            0x92,0x9A,0x92,0x8E,0x9C,0x9B,0x92,0x97,0x96,0x94,0x94,0x91,0x8F,0x8B,0x85,0x7C,
+            0x65,0x7B,0x84,0x86,0x88,0x94,0x8F,0x8E,0x90,0x92,0x99,0x9A,0x99,0x9C,0x9E,0x78,
+            0x90,0x97,0x9D,0x9E,0x92,0xA4,0x9B,0x9E,0x98,0xA0,0xA3,0xA0,0xA1,0xA5,0xA2,0xA2,
+            0x98,0x9E,0xA7,0xA5,0xA0,0xA3,0xA4,0xA5,0x9E,0xA1,0xA4,0xA5,0xA1,0xA6,0x9B,0xA7,
+            0x9B,0x8C,0xA6,0xA7,0xA2,0xA6,0xA7,0xAC,0xA2,0x98,0xA6,0x9E,0x9F,0xA3,0xA7,0xA9,
+            0x8C,0x80,0x9C,0x9D,0x7F,0x8D,0x99,0x9D,0x6A,0x80,0x9E,0xA1,0x79,0x8E,0x9A,0x9F,
+            0x9D,0x9C,0x9D,0xA4,0x98,0x9D,0x99,0xA3,0x9F,0xA0,0xA2,0x9B,0x9C,0xA2,0x99,0xA0,
+            0xA2,0x9A,0x9F,0xA7,0x9B,0xA2,0x7F,0x9F,0xA2,0xA4,0x9A,0xA7,0xA0,0xA1,0xA0,0xA4,
+            0xA2,0x9A,0xA3,0xA4,0x91,0x8E,0x9D,0x90,0x9E,0xA5,0xA6,0xAB,0x9E,0xA1,0xA0,0xA5,
+            0x8D,0x96,0xAA,0x84,0x90,0x86,0xAC,0xA8,0x8F,0x87,0x9C,0x87,0x9C,0x98,0xA8,0xAA,
+            0x99,0xA6,0xA4,0xA6,0x9F,0xA4,0xA8,0xA6,0xA8,0xA6,0xA7,0xA4,0x9F,0x88,0xA6,0xA6,
+            0xA5,0xA7,0xA5,0xA9,0xA2,0xA5,0xA8,0xA9,0x96,0xA8,0xA9,0xA9,0xA3,0xA7,0xA6,0xA6,
+            0xA5,0xA8,0xA8,0xA5,0xA2,0xA8,0xA8,0xA9,0x8A,0x99,0x83,0xA3,0x90,0xA5,0x84,0x9C,
+            0x79,0x96,0xA9,0xA4,0x9C,0x97,0x9D,0x98,0xA6,0x93,0xA7,0xA7,0xA7,0xA4,0xA6,0xA9,
+            0xA2,0xA8,0xA1,0xA5,0xA4,0xA7,0xA5,0xA1,0xA4,0xA4,0xA3,0xA5,0xA3,0xA5,0xA4,0xA7,
+            0x9D,0xA0,0xA5,0xA5,0xA2,0xA4,0xA2,0xA5,0x93,0x8B,0xA2,0x8B,0xA1,0xA1,0xA2,0xA2,
+            0x8D,0x9E,0x98,0x90,0x9F,0x9D,0x8F,0x99,0x90,0x95,0x93,0x91,0x8F,0x8A,0x85,0x7A,
+            0x61,0x6E,0x7B,0x7D,0x84,0x8E,0x82,0x80,0x7F,0x83,0x7B,0x8A,0x92,0x98,0x8C,0x6D,
+            0x83,0x89,0x8A,0x90,0x97,0x9A,0x90,0x8C,0x89,0x94,0x97,0x94,0x97,0xA7,0x95,0x94,
+            0x8A,0x99,0x9D,0x9F,0x63,0x6A,0x9A,0x98,0x8A,0x93,0x97,0x92,0x9B,0xA6,0x95,0x94,
+            0x7F,0x83,0x92,0x91,0x8F,0xA6,0x94,0x87,0x88,0x89,0x96,0x8A,0x96,0x9A,0x93,0x94,
+            0x80,0x78,0x8E,0x97,0x7B,0x84,0x97,0x9A,0x68,0x79,0x7C,0x9A,0x7A,0x8B,0xA0,0xA0,
+            0x84,0x95,0x7F,0x9A,0x9B,0xA6,0x96,0x95,0xA1,0xA1,0xA0,0x92,0xA1,0xA4,0xA5,0xA4,
+            0x9C,0xA3,0xA0,0xA9,0x8F,0xA1,0x7C,0xA5,0x9E,0xA4,0x9F,0xA1,0xA5,0x9F,0xA5,0xA8,
+            0x9E,0x9C,0x90,0x98,0x8F,0x85,0x89,0x86,0x9D,0xA0,0x98,0x9F,0xA3,0xA5,0x8E,0x8E,
+            0x77,0x7E,0x88,0x7E,0x89,0x7D,0x8B,0x8F,0x84,0x79,0x7E,0x7C,0x96,0x81,0x93,0x95,
+            0x82,0x85,0x86,0x92,0x99,0x89,0x87,0x8B,0x9A,0x9E,0xA0,0x9B,0x9F,0x94,0xA3,0xA0,
+            0x98,0xA0,0xA1,0xA4,0xA0,0x9A,0xA4,0xA2,0x97,0x88,0x9E,0xA5,0xA3,0x92,0xA1,0xA2,
+            0x8F,0x90,0x92,0x9D,0x96,0x94,0x96,0x96,0x8C,0x8A,0x84,0x9C,0x9A,0x92,0x92,0x94,
+            0x84,0x76,0x74,0x85,0x89,0x7B,0x85,0x82,0x7B,0x8C,0x83,0x86,0x97,0x87,0x92,0x90,
+            0x7F,0x84,0x8A,0x85,0x92,0x8A,0x8B,0x84,0x90,0x93,0x94,0x92,0x97,0x8E,0x97,0x96,
+            0x94,0x97,0x99,0x95,0x91,0x92,0x98,0x95,0x7F,0x81,0x98,0x85,0x98,0x8D,0x96,0x96,
+            0x8D,0x92,0x8A,0x7E,0x96,0x8C,0x8D,0x86,0x8B,0x8E,0x8A,0x8E,0x8A,0x85,0x81,0x78,
+            0x64,0x79,0x7F,0x81,0x7D,0x86,0x86,0x87,0x86,0x83,0x87,0x88,0x88,0x88,0x88,0x7B,
+            0x87,0x88,0x88,0x89,0x88,0x88,0x88,0x88,0x88,0x88,0x89,0x8A,0x88,0x89,0x89,0x88,
+            0x88,0x89,0x89,0x89,0x88,0x88,0x88,0x89,0x89,0x88,0x89,0x8A,0x89,0x88,0x89,0x89,
+            0x89,0x85,0x88,0x89,0x88,0x88,0x89,0x89,0x89,0x86,0x89,0x8A,0x88,0x88,0x89,0x89,
+            0x75,0x82,0x88,0x89,0x84,0x87,0x89,0x88,0x6E,0x7D,0x88,0x89,0x7C,0x83,0x89,0x89,
+            0x89,0x89,0x88,0x89,0x88,0x89,0x89,0x88,0x89,0x88,0x89,0x89,0x89,0x88,0x89,0x89,
+            0x8A,0x88,0x88,0x89,0x88,0x89,0x80,0x89,0x8A,0x88,0x89,0x8A,0x89,0x89,0x89,0x8A,
+            0x89,0x88,0x86,0x89,0x87,0x87,0x89,0x87,0x89,0x88,0x89,0x8A,0x88,0x89,0x89,0x89,
+            0x87,0x87,0x89,0x82,0x88,0x87,0x89,0x89,0x88,0x85,0x88,0x83,0x88,0x88,0x89,0x8A,
+            0x88,0x88,0x88,0x89,0x88,0x88,0x88,0x89,0x8A,0x87,0x89,0x89,0x89,0x89,0x88,0x89,
+            0x8A,0x88,0x89,0x88,0x87,0x88,0x88,0x89,0x89,0x88,0x89,0x89,0x89,0x89,0x89,0x8A,
+            0x89,0x88,0x89,0x89,0x88,0x89,0x88,0x89,0x85,0x87,0x87,0x89,0x88,0x89,0x85,0x89,
+            0x86,0x87,0x88,0x88,0x89,0x89,0x88,0x87,0x89,0x86,0x89,0x88,0x89,0x89,0x89,0x89,
+            0x87,0x88,0x87,0x88,0x88,0x87,0x89,0x87,0x89,0x86,0x88,0x88,0x89,0x88,0x88,0x87,
+            0x89,0x88,0x88,0x88,0x87,0x88,0x88,0x88,0x87,0x83,0x88,0x83,0x89,0x87,0x88,0x86,
+            0x87,0x88,0x87,0x86,0x87,0x85,0x85,0x87,0x85,0x85,0x85,0x85,0x84,0x81,0x7D,0x77,
+            0x67,0x79,0x84,0x89,0x77,0x7A,0x91,0x94,0x91,0x90,0x99,0x9A,0x92,0x91,0x9A,0x7A,
+            0x93,0x98,0x99,0xA0,0x92,0x98,0xA0,0x9D,0x9E,0x9F,0xA0,0xA2,0x97,0x9C,0xA0,0xA3,
+            0x99,0xA2,0xA7,0xA5,0x98,0x9B,0x96,0xA5,0xA2,0x9F,0x9E,0x9F,0x9B,0x9C,0x98,0x97,
+            0x9E,0x8C,0xA4,0xA5,0x9C,0x9F,0x99,0xA8,0xA2,0x92,0xA4,0xA2,0x9E,0x9A,0x9B,0xA9,
+            0x95,0x7E,0x97,0x8E,0x82,0x88,0x93,0x93,0x6B,0x7D,0x9A,0x98,0x80,0x88,0x9A,0x9D,
+            0x9D,0x95,0x9E,0x9F,0x95,0x9B,0x96,0x9B,0xA0,0x94,0xA2,0x9E,0x9D,0x9C,0x97,0x7D,
+            0xA2,0x9C,0x96,0x9C,0x96,0xA1,0x7A,0x75,0xA4,0x9D,0x9F,0xA4,0x99,0x9F,0x92,0x7D,
+            0xA6,0x9D,0xA4,0xA2,0x91,0x91,0x94,0x99,0xA1,0x9F,0xA3,0xA5,0x9F,0xA7,0x95,0xA2,
+            0x8C,0x98,0xA5,0x84,0x91,0x85,0xA0,0xA0,0x91,0x85,0x9C,0x8A,0xA0,0x91,0xA9,0xA5,
+            0x99,0xA6,0xA2,0xA7,0xA4,0xA7,0xA5,0xAA,0xAA,0xA5,0xA7,0xA5,0xA1,0x9F,0xAA,0xA6,
+            0xA5,0xA7,0xA7,0xA8,0xA4,0xA6,0xA6,0xA7,0xA3,0xA7,0xA8,0xAA,0xA5,0x9E,0xA5,0xA8,
+            0xA4,0xA8,0xA9,0xA5,0xA5,0xA7,0xA8,0xA6,0x95,0x92,0x97,0xA5,0xA4,0x9E,0x95,0xA2,
+            0x98,0x81,0x8B,0x94,0x92,0x92,0x99,0x93,0x8E,0x9C,0x93,0x9B,0x9E,0x9F,0xA2,0xA3,
+            0x94,0x9A,0x9C,0x9B,0x9F,0xA1,0xA0,0x9F,0x9C,0x9D,0x9D,0x9E,0x9C,0x9F,0xA3,0xA1,
+            0x9C,0x9F,0xA2,0xA1,0x9F,0x9F,0xA1,0xA2,0x94,0x8B,0x9F,0x88,0xA0,0x9D,0xA0,0x9F,
+            0x96,0x9C,0x93,0x8C,0x97,0x9C,0x90,0x97,0x8F,0x94,0x94,0x91,0x8D,0x8A,0x83,0x7A,
+            0x64,0x77,0x85,0x87,0x89,0x89,0x92,0x96,0x90,0x8E,0x9B,0x9D,0x91,0x9F,0xA1,0x7B,
+            0x8E,0xA1,0xA2,0xA2,0x8F,0xA2,0xA3,0xA2,0x9F,0xA4,0xA5,0xA4,0x99,0xA5,0xA4,0xA5,
+            0x96,0xA5,0xA4,0xA8,0x99,0xA1,0xA6,0xA9,0xA4,0xA0,0xA6,0xA9,0x9C,0xA9,0xA8,0xA4,
+            0x9B,0x8C,0xA7,0xA4,0x9C,0xA6,0xA7,0xA8,0xA4,0x9A,0xA6,0xA4,0x9D,0x9E,0xA5,0xAA,
+            0x99,0x81,0x9E,0x96,0x89,0x8F,0x9B,0x98,0x69,0x7D,0x9F,0x9D,0x7F,0x8D,0xA1,0x9A,
+            0xA4,0x9E,0xA3,0x9D,0x95,0x9B,0x97,0xA4,0xA6,0xA3,0xA4,0x9F,0x9B,0x9D,0x9D,0xA3,
+            0xA5,0x99,0x8C,0xA1,0x97,0xA4,0x7F,0xA0,0xA7,0xA4,0xA2,0xA6,0xA1,0xA0,0xA5,0xA7,
+            0xA5,0x9A,0xA6,0xA3,0x92,0x94,0x9B,0x9B,0xA6,0xA1,0xA7,0xA2,0x9E,0xA1,0xA3,0xA2,
+            0x91,0x98,0xA9,0x83,0x97,0x8A,0xA7,0xA7,0x93,0x8B,0x9E,0x88,0xA4,0x93,0xA8,0xA8,
+            0x9B,0xA8,0xA8,0xA8,0xA9,0xA9,0xA6,0xA9,0xA8,0xA7,0xA5,0xA7,0xA7,0xA9,0xA9,0xA4,
+            0xA5,0xA8,0xA8,0xAA,0xAA,0xA5,0xA7,0xA5,0x9E,0xA5,0xA7,0xA7,0xA6,0xA8,0xA5,0xA8,
+            0xA3,0xA7,0xA8,0xA8,0xA0,0xA7,0xA8,0xA2,0x87,0x92,0x96,0xA6,0xA8,0xA5,0x94,0xA0,
+            0xA1,0x98,0xA7,0x9A,0x94,0x92,0x9C,0x9A,0xA7,0xA7,0xA6,0xA6,0xA6,0xA8,0xA8,0xA5,
+            0xA1,0x9F,0xA8,0xA5,0xA7,0xA7,0xA4,0xA5,0xA4,0xA7,0xA2,0xA6,0xA5,0xA6,0xA5,0xA6,
+            0xA3,0xA2,0xA1,0xA4,0xA1,0xA4,0xA4,0xA5,0x91,0x8A,0xA4,0x8B,0xA0,0xA1,0xA1,0xA4,
+            0x96,0x9D,0x93,0x8A,0x9C,0x9E,0x93,0x96,0x94,0x95,0x94,0x91,0x8E,0x8A,0x83,0x79,
+            0x5C,0x60,0x70,0x79,0x78,0x7E,0x83,0x86,0x81,0x83,0x8C,0x90,0x8C,0x93,0x91,0x63,
+            0x87,0x93,0x95,0x97,0x94,0x9A,0x9A,0x92,0x95,0x9C,0xA0,0x9C,0x9C,0x9F,0x9D,0x99,
+            0x91,0x9A,0xA0,0x9E,0x91,0x90,0xA2,0xA3,0x9F,0x94,0xA3,0x9F,0x9E,0x9F,0xA3,0x99,
+            0x9B,0x6C,0x96,0x9E,0x91,0xA3,0xA4,0xA0,0x99,0x83,0xA3,0x89,0x8F,0x8C,0xA2,0xA4,
+            0x84,0x68,0x8F,0x95,0x6B,0x75,0x98,0x9F,0x4E,0x63,0x88,0x90,0x5E,0x6D,0x91,0x95,
+            0x90,0x9E,0x99,0x99,0x8B,0x98,0x9C,0x9E,0x96,0x9C,0xA1,0x68,0x90,0x98,0x9F,0x9E,
+            0xA3,0xA1,0x9B,0xA5,0x6B,0xA4,0x6D,0xA6,0x9B,0xA4,0x93,0xA5,0x80,0xA5,0xA7,0xA5,
+            0xA3,0xA4,0x8D,0x85,0x76,0x7B,0x9B,0x94,0x9C,0x9F,0xA3,0xA6,0x86,0x9D,0x9B,0x9A,
+            0x79,0x83,0xA7,0x70,0x84,0x77,0x73,0xA4,0x88,0x6B,0x90,0x6B,0x7C,0x85,0x94,0x8F,
+            0x95,0xA6,0xA6,0xA2,0xA7,0x9B,0xA4,0xA6,0xA3,0x9F,0xA6,0xA6,0xA6,0xA5,0xA8,0xA6,
+            0xA3,0xA9,0xA7,0x99,0xA8,0xA8,0xA7,0xA5,0x94,0xA5,0xA6,0xA6,0xA7,0xA7,0xA5,0xA6,
+            0x9D,0xA4,0xA5,0xA3,0xA6,0xA4,0xA5,0xA7,0x80,0x82,0x77,0x99,0xA1,0x98,0x76,0x8D,
+            0x94,0x82,0x9A,0x7B,0x85,0x85,0x80,0x7E,0x9A,0x9E,0x9A,0xA3,0xA5,0xA4,0xA5,0xA5,
+            0x99,0x9C,0x9F,0x96,0xA2,0xA1,0x9D,0xA4,0x9D,0x9B,0x9F,0x9E,0xA2,0xA5,0x9F,0xA3,
+            0x9F,0xA2,0x9F,0xA1,0x9C,0x9F,0xA2,0xA0,0x63,0x6D,0xA2,0x75,0xA2,0x9F,0x9E,0x9E,
+            0x93,0x9C,0x7E,0x78,0x98,0x98,0x84,0x8B,0x8D,0x8F,0x90,0x89,0x87,0x84,0x7D,0x6D,
+            0x68,0x79,0x82,0x89,0x80,0x8E,0x96,0x96,0x91,0x94,0x9B,0x9B,0x9D,0x9F,0xA0,0x7A,
+            0x93,0xA0,0xA0,0xA1,0x9C,0xA1,0x9F,0xA5,0x9A,0xA3,0x9F,0xA4,0x96,0xA5,0xA5,0x9E,
+            0x74,0xA4,0xA4,0xA6,0x9F,0x9F,0xA7,0xA3,0xA6,0xA5,0xA7,0xA4,0xA4,0xA6,0xA9,0xA5,
+            0x9C,0x91,0xA7,0xA4,0x97,0xA4,0xA8,0xA2,0xA5,0x9D,0xA6,0xA7,0x9E,0xA2,0xA8,0xA9,
+            0x99,0x87,0xA3,0xA5,0x8F,0x95,0xA3,0x97,0x6D,0x7F,0x9A,0xA4,0x84,0x94,0xA2,0x9F,
+            0xA2,0xA5,0xA3,0xA4,0x9A,0x9F,0xA4,0xA1,0x99,0xA5,0xA1,0xA0,0x90,0x9A,0xA6,0xA0,
+            0xA6,0xA0,0x99,0xA6,0x97,0xA3,0x84,0xA4,0xA4,0x9F,0xA3,0xA5,0x97,0xA5,0xA8,0xA9,
+            0xA7,0xA6,0xA1,0xA4,0x90,0x8B,0x98,0x94,0x9D,0xA6,0xA6,0xA7,0x93,0xA6,0xA9,0xA1,
+            0x95,0x9A,0xA6,0x8B,0xA0,0x9B,0x7B,0xA4,0x9A,0x8E,0xA0,0x8C,0xA4,0x9B,0xA9,0xA5,
+            0x9D,0xA6,0xA6,0xA6,0xA7,0xA8,0xA5,0xA8,0xA7,0xA6,0xA4,0xA7,0xA1,0xA7,0xAA,0xA5,
+            0xA5,0xA7,0xA8,0xAB,0xA8,0xA6,0xA8,0xA4,0xA1,0xA7,0xA7,0xA6,0xA8,0xA7,0xA6,0xA7,
+            0xA6,0xA7,0xA6,0xA5,0xA8,0xA6,0xA6,0xA8,0x96,0x91,0x95,0xA4,0xA8,0xA4,0x9C,0xA0,
+            0x79,0x99,0xA3,0x9F,0x92,0x92,0x9A,0x98,0xA5,0x88,0xA5,0xA7,0xA6,0xA1,0xA6,0xA5,
+            0x9C,0xA2,0x83,0xA2,0xA1,0xA2,0xA0,0xA2,0xA3,0x9E,0x9F,0x93,0xA0,0xA3,0xA2,0xA0,
+            0xA5,0xA2,0xA2,0xA4,0x94,0xA1,0xA1,0x9E,0x93,0x8C,0xA3,0x8E,0xA1,0x8E,0x9F,0x9A,
+            0x99,0x9C,0x99,0x93,0x9B,0x9A,0x84,0x96,0x97,0x94,0x93,0x93,0x8F,0x89,0x83,0x79,
+            0x6B,0x7A,0x84,0x80,0x8D,0x8C,0x97,0x98,0x96,0x8F,0x9C,0x9D,0x9E,0x9C,0x9E,0x7C,
+            0x9A,0xA2,0xA3,0xA2,0xA2,0xA4,0xA3,0xA3,0x9E,0x9C,0xA5,0xA3,0x98,0xA4,0xA0,0x9D,
+            0xA1,0xA4,0xA5,0xA9,0xA3,0x9D,0xA7,0xA8,0xA4,0xA2,0xA7,0xA8,0x9F,0xA5,0xA4,0xA2,
+            0xA6,0x8E,0xA7,0xA4,0xA7,0xA6,0xA6,0xA8,0xA4,0x9D,0xA3,0xA7,0xA0,0xA2,0xA7,0xA6,
+            0x9D,0x86,0xA4,0xA3,0x8E,0x94,0xA5,0xA7,0x6F,0x7E,0x9F,0xA2,0x86,0x91,0xA6,0xA3,
+            0xA4,0xA6,0xA7,0xA5,0xA2,0xA7,0xA7,0xA8,0xA1,0xA4,0xA9,0x9F,0x95,0x9A,0xA7,0xA2,
+            0x9C,0xAA,0x9A,0xA1,0xA2,0xA5,0x7E,0xA7,0xA4,0xA6,0xA4,0xA8,0xA6,0xA5,0xA6,0xA5,
+            0xA7,0xA6,0xA0,0xA3,0x99,0x97,0xA1,0x98,0xA7,0xA7,0xAB,0xA9,0xA6,0xA7,0xA6,0xA7,
+            0x94,0x97,0xA5,0x8B,0x9E,0x97,0xA9,0xA9,0x9A,0x8D,0x9F,0x8B,0x9D,0x99,0xA8,0xA5,
+            0x96,0xA6,0xA8,0xA6,0xA8,0xA8,0xA4,0xA9,0xA8,0xA6,0xA6,0xA5,0xA8,0xA5,0xA9,0xA7,
+            0xA9,0xA7,0xA5,0xA9,0xA7,0xA7,0xA8,0xA2,0xA4,0x9D,0xA9,0xA7,0xA6,0xA9,0xA6,0xA9,
+            0xA4,0xA4,0xA5,0xA7,0xA7,0xA8,0xA7,0xA7,0x99,0x9C,0x9B,0xA4,0xA8,0xA7,0x9A,0xA1,
+            0xA5,0x99,0xA7,0xA1,0x98,0x96,0xA0,0x9A,0xA5,0xA5,0xA9,0xA5,0xA6,0xA4,0xA6,0xA7,
+            0xA4,0xA7,0xA7,0xA8,0xA3,0xA7,0xA4,0xA6,0xA7,0xA2,0xA2,0xA5,0xA5,0xA1,0xA6,0xA4,
+            0xA4,0xA2,0xA4,0xA2,0xA1,0xA3,0xA3,0xA0,0x96,0x8E,0xA3,0x90,0xA2,0xA3,0xA2,0x9F,
+            0x9C,0x9E,0x9A,0x89,0x9C,0x9E,0x95,0x96,0x98,0x96,0x94,0x93,0x91,0x8A,0x85,0x7B,
+            0x6A,0x79,0x87,0x83,0x8E,0x90,0x95,0x98,0x98,0x8F,0x9D,0x9D,0x9B,0x9D,0x9E,0x7C,
+            0x9F,0xA0,0xA3,0xA2,0x9E,0xA5,0xA4,0xA3,0xA1,0xA4,0xA6,0xA1,0xA4,0xA5,0xA6,0xA3,
+            0xA3,0xA7,0xA5,0xA7,0xA5,0xA2,0xA7,0xA7,0xA0,0xA6,0xA9,0xA6,0xA7,0xA6,0xA5,0xA9,
+            0xA8,0x90,0xA9,0xA6,0xA8,0xA9,0xA6,0xA8,0xA5,0x97,0xA7,0xA6,0xA1,0xA4,0xAB,0xA8,
+            0x9E,0x86,0xA4,0x9A,0x8F,0x93,0xA5,0xA7,0x6E,0x81,0xA2,0xA5,0x83,0x8E,0xA5,0xA6,
+            0xA5,0xA5,0xA5,0x9E,0xA0,0xA6,0xA5,0xA8,0xA6,0xA5,0xA6,0xA1,0xA8,0xA8,0xA8,0xA0,
+            0x9E,0xA7,0xA0,0xA6,0xA8,0xA8,0x84,0xA9,0xA6,0xAA,0xA4,0xA7,0xA6,0xA6,0xA8,0xA6,
+            0xAA,0xA9,0x8A,0x9E,0x9C,0x99,0xA2,0x9B,0xA3,0xA8,0xA7,0xA9,0xA7,0xA8,0xA9,0xA6,
+            0x94,0x9A,0xA9,0x8B,0x9F,0x9A,0xA7,0xA7,0x9D,0x8D,0xA0,0x8E,0xA3,0x9A,0xAA,0x95,
+            0x9E,0xA6,0xA8,0xA7,0xA4,0xA7,0xA6,0xA7,0xA8,0xA8,0xA8,0xA7,0xA9,0xA8,0xA6,0xAA,
+            0xA5,0xA6,0xA9,0xAB,0xA9,0xA8,0xAA,0xA3,0xA6,0xA9,0xA9,0xAA,0xA8,0xA9,0xA4,0xA7,
+            0xA8,0xA9,0xA6,0xA5,0xA9,0xA8,0xA4,0x9B,0x98,0x9B,0x9A,0xA6,0xA2,0xA7,0x8F,0xA4,
+            0xA2,0x99,0xA7,0xA4,0x97,0x96,0x9F,0x99,0xA5,0xA6,0xA7,0xA8,0xA7,0xA6,0xA7,0x9F,
+            0x9F,0xA3,0xA7,0xA4,0xA1,0xA5,0xA5,0xA7,0xA7,0xA1,0xA5,0xA7,0xA6,0xA4,0xA4,0xA4,
+            0xA4,0xA3,0xA5,0xA4,0xA1,0xA3,0xA4,0xA2,0x90,0x8E,0x9F,0x8E,0xA2,0xA1,0xA0,0xA1,
+            0x9E,0x9E,0x98,0x8C,0x9C,0x9D,0x95,0x97,0x99,0x96,0x92,0x92,0x8F,0x8A,0x84,0x78,
+            0x69,0x72,0x7C,0x82,0x89,0x8F,0x89,0x86,0x7F,0x89,0x8A,0x92,0x97,0x9A,0x8D,0x73,
+            0x85,0x89,0x94,0x97,0x9C,0x9C,0x95,0x90,0x8D,0x91,0x92,0x9C,0xA0,0xA6,0x9B,0x98,
+            0x90,0x9B,0xA2,0xA0,0x6A,0x97,0xA1,0x95,0x8F,0x96,0x99,0xA0,0x9D,0xA4,0x9A,0x95,
+            0x82,0x86,0x94,0x98,0x8E,0xA4,0x97,0x83,0x8C,0x88,0x8F,0x9A,0x9A,0x9F,0x9B,0x98,
+            0x89,0x7C,0x9A,0x9C,0x7E,0x87,0x9A,0xA2,0x6B,0x7C,0x95,0x9B,0x7C,0x89,0xA3,0xA4,
+            0x93,0xA0,0x99,0xA3,0xA1,0xA6,0xA4,0xA1,0x9F,0xA2,0x9F,0x91,0x9C,0xA7,0x9F,0x9F,
+            0x9B,0xA3,0xA2,0xA7,0x97,0xA6,0x7F,0xA3,0xA2,0xA8,0xA4,0xA9,0xA7,0xA1,0xA7,0xA4,
+            0xA3,0xA3,0x9A,0x8E,0x91,0x91,0x95,0x92,0x9F,0xA7,0xA5,0xA7,0xA7,0xA8,0xA3,0x99,
+            0x89,0x8F,0x94,0x82,0x94,0x84,0x99,0x9B,0x93,0x7E,0x93,0x7F,0xA1,0x8A,0x9C,0x9E,
+            0x93,0x9E,0x9C,0x9D,0xA2,0x99,0x9D,0x9E,0x99,0xA3,0xA1,0x9A,0xA4,0x9B,0xA1,0x9D,
+            0xA1,0xA4,0xA6,0xA8,0xA4,0xA4,0xA7,0xA1,0x9C,0xA4,0xA7,0xA5,0xA3,0x9D,0xA4,0xA4,
+            0x9A,0xA0,0x9F,0xA0,0x9D,0x9C,0x9F,0x9A,0x96,0x95,0x8A,0x98,0x9F,0x9A,0x93,0x9B,
+            0x8C,0x8B,0x8D,0x92,0x93,0x87,0x93,0x89,0x8F,0xA3,0x91,0x9D,0xA3,0x94,0x9E,0x98,
+            0x8F,0x91,0x7F,0x95,0x9F,0x96,0x8B,0x98,0x98,0x98,0x9B,0x9F,0xA4,0x9B,0x9E,0x9E,
+            0x9B,0xA2,0xA6,0xA1,0x9F,0x9E,0xA1,0xA0,0x80,0x83,0x9F,0x8C,0x9F,0x99,0x9B,0x99,
+            0x90,0x94,0x8F,0x83,0x9A,0x95,0x94,0x94,0x8F,0x91,0x8A,0x91,0x8C,0x87,0x82,0x79,
+            0x6A,0x7B,0x85,0x89,0x84,0x90,0x92,0x95,0x88,0x91,0x96,0x94,0x98,0x99,0x9C,0x7D,
+            0x90,0x98,0x9B,0x9B,0x97,0x99,0x9B,0x9A,0x94,0x9A,0x9B,0x9D,0x9C,0x9C,0x9E,0x9B,
+            0x95,0x9C,0x9C,0x9C,0x9D,0x9D,0x9C,0x9C,0x99,0x9B,0x9C,0x9C,0x9D,0x9D,0x9D,0x9C,
+            0x99,0x90,0x9D,0x9D,0x9D,0x9B,0x9C,0x9F,0x98,0x9A,0x9E,0x9C,0x98,0x95,0xA0,0x9D,
+            0x74,0x8A,0x9E,0x9D,0x90,0x95,0x9B,0x9E,0x74,0x84,0x9A,0x9A,0x86,0x91,0x9D,0x9C,
+            0x9A,0x9B,0x9C,0x9C,0x9B,0x9D,0x9D,0x9B,0x9B,0x9B,0x9D,0x9A,0x9C,0x9E,0x9E,0x9C,
+            0x9C,0x9A,0x9A,0x9C,0x9B,0x9D,0x86,0x9C,0x9B,0x9B,0x9B,0x9B,0x9B,0x9C,0x9F,0x9E,
+            0x9D,0x9C,0x96,0x9B,0x97,0x94,0x97,0x97,0x9B,0x9B,0x9D,0x9D,0x9D,0x9D,0x9F,0x9C,
+            0x93,0x94,0x9D,0x8D,0x99,0x99,0x9D,0x9C,0x96,0x8F,0x98,0x8F,0x9B,0x95,0x9F,0x9D,
+            0x95,0x9C,0x9C,0x9C,0x9B,0x9C,0x9D,0x9E,0x9D,0x9B,0x9D,0x9D,0x99,0x9D,0x9F,0x9D,
+            0x9C,0x9C,0x9C,0x9D,0x9D,0x9B,0x9D,0x94,0x9B,0x9B,0x9D,0x9E,0x9B,0x9D,0x9F,0x9F,
+            0x9C,0x9B,0x9D,0x9D,0x9D,0x9D,0x9D,0x9C,0x96,0x91,0x97,0x9D,0x8F,0x9C,0x9A,0x9B,
+            0x82,0x97,0x9C,0x9B,0x9A,0x9A,0x9A,0x99,0x9A,0x8E,0x9D,0x9C,0x9C,0x9D,0x9C,0x9D,
+            0x98,0x9B,0x90,0x9C,0x9A,0x9A,0x9C,0x9C,0x99,0x9C,0x9A,0x8D,0x9A,0x9C,0x9B,0x9C,
+            0x9A,0x97,0x99,0x9B,0x8B,0x9B,0x99,0x9B,0x92,0x8E,0x9A,0x8F,0x99,0x8C,0x9A,0x96,
+            0x94,0x97,0x97,0x93,0x97,0x91,0x8D,0x94,0x94,0x92,0x90,0x8F,0x8D,0x88,0x81,0x79,
+            0x6A,0x7A,0x87,0x89,0x8B,0x92,0x96,0x98,0x91,0x91,0x9B,0x9C,0x9E,0x9F,0x9F,0x7E,
+            0x94,0xA3,0xA3,0xA2,0xA4,0xA5,0xA3,0xA3,0x9A,0xA2,0xA5,0xA5,0xA4,0xA4,0xA3,0xA4,
+            0x9C,0xA6,0xA7,0xA7,0xA6,0xA2,0xA4,0xA8,0xA3,0xA3,0xA7,0xA8,0xA6,0xA4,0xA9,0xA7,
+            0x9E,0x8F,0xA7,0xA7,0xA6,0xA6,0xA9,0xA9,0xA7,0x9F,0xAA,0xA3,0x9F,0xA2,0xA8,0xA2,
+            0x9F,0x85,0xA3,0xA5,0x8A,0x93,0xA8,0xA5,0x70,0x81,0xA1,0xA0,0x83,0x90,0xA5,0xA6,
+            0xA4,0xA6,0xA7,0xA6,0xA3,0xA5,0xA7,0xA8,0xA6,0xA8,0xA8,0xA3,0xA9,0xA8,0xA8,0xA9,
+            0xA8,0xA9,0x9F,0xA7,0x9A,0xA7,0x80,0xA9,0xA7,0xA9,0xA8,0xA9,0xAA,0xA7,0xA9,0xA7,
+            0xA8,0xAA,0xA3,0xA5,0x9A,0x9A,0x9D,0x98,0xA2,0xA9,0xAC,0xA9,0xAB,0xA7,0xA8,0xA8,
+            0x94,0x98,0xA9,0x8E,0x9D,0x9B,0xA6,0xA5,0x9A,0x8F,0xA0,0x8C,0xA6,0x98,0xA9,0xA6,
+            0x9E,0xA9,0xA9,0xA9,0xA7,0xA6,0xA6,0xA8,0xA8,0xA2,0xA2,0xA8,0xA4,0xA6,0xA4,0xA7,
+            0xA6,0xA8,0xA5,0xAA,0xA8,0xA8,0xA8,0x9F,0xA4,0xA9,0xA8,0xA7,0xA7,0xAB,0xA6,0xA9,
+            0xA3,0xAA,0xA8,0xA5,0xA7,0xA6,0xA8,0xA8,0x99,0x9A,0x8A,0xA6,0xA6,0xA6,0x9A,0xA1,
+            0x9F,0x92,0xAA,0xA3,0x97,0x96,0xA1,0x9B,0xA4,0xA2,0xA7,0xA8,0xA5,0xA6,0xA5,0xA6,
+            0xA3,0xA6,0xA0,0xA1,0xA6,0xA5,0xA3,0xA6,0xA3,0xA3,0xA1,0xA2,0xA6,0xA4,0xA6,0xA7,
+            0xA4,0xA2,0xA4,0xA2,0xA1,0xA2,0xA3,0xA1,0x93,0x8F,0xA1,0x8F,0xA3,0x9F,0xA1,0xA0,
+            0x9B,0x9F,0x9A,0x90,0x9C,0x9C,0x96,0x99,0x97,0x95,0x71,0x92,0x90,0x89,0x83,0x7B,
+            0x4E,0x77,0x87,0x88,0x8E,0x93,0x95,0x99,0x8D,0x8F,0x9B,0x9C,0x9C,0x9E,0xA1,0x74,
+            0x95,0xA2,0xA1,0xA3,0xA3,0xA5,0xA4,0xA3,0x9C,0xA4,0xA5,0xA3,0xA3,0xA7,0xA5,0x8F,
+            0x9D,0x9F,0xA7,0xA7,0xA7,0xA1,0xA7,0xA6,0xA1,0x97,0xA8,0xA9,0xA7,0xA6,0xA8,0xA4,
+            0xA2,0x8E,0xA6,0xA8,0xA8,0xA9,0xA7,0xAB,0xA2,0x9B,0xA5,0xA4,0x92,0xA1,0xA9,0xA9,
+            0x51,0x7C,0x9E,0xA6,0x49,0x8E,0xA0,0xA9,0x6A,0x7D,0xA0,0xA2,0x7A,0x88,0xA4,0xA3,
+            0xA2,0xA4,0xA6,0xA2,0xA4,0xA4,0xA9,0xA8,0xA7,0xA7,0xA8,0xA0,0xA9,0xA6,0xAA,0xA9,
+            0xA7,0xA7,0x96,0xA6,0x98,0xA5,0x7F,0xA7,0xA5,0xA6,0xA7,0xA9,0xA8,0xA3,0xAA,0xAB,
+            0xAA,0xA9,0xA5,0xA5,0x94,0x90,0x95,0x8D,0xA1,0xA9,0xAA,0xA9,0xA4,0xA6,0x97,0x9C,
+            0x52,0x92,0xAA,0x80,0x45,0x8F,0xA9,0xA9,0x95,0x82,0xA1,0x89,0xA8,0x91,0xA5,0xA4,
+            0x9D,0xA6,0xA5,0xA8,0xA7,0xA9,0xA6,0xAB,0xA8,0xA6,0xA6,0xA8,0xAA,0xA6,0xAB,0xAA,
+            0xA9,0xA6,0xA8,0xAB,0xA8,0xA7,0xA8,0x9D,0xA0,0xA5,0xAB,0xA9,0xAA,0xAA,0xA8,0xA8,
+            0xA4,0xA8,0xA9,0xA9,0xA6,0xA5,0xA7,0xA9,0x9D,0x9A,0x96,0xA5,0xA8,0xA4,0x9B,0x9C,
+            0xA1,0x7F,0xA8,0x9B,0x97,0x93,0xA0,0x9A,0xAA,0xA6,0xA8,0xAA,0xA8,0xA5,0xA7,0xA6,
+            0x9F,0xA5,0xA9,0xA0,0xA7,0xA7,0xA1,0xA6,0xA3,0xA4,0xA5,0xA5,0xA6,0xA6,0xA6,0xA5,
+            0xA1,0xA1,0xA4,0xA1,0xA2,0xA4,0xA2,0xA2,0x8A,0x87,0xA2,0x8C,0xA1,0xA3,0xA1,0xA0,
+            0x97,0x9D,0x97,0x8F,0x9C,0x9D,0x95,0x97,0x97,0x95,0x95,0x92,0x90,0x89,0x84,0x79,
+            0x59,0x5F,0x6D,0x75,0x7A,0x80,0x83,0x86,0x80,0x7E,0x8B,0x8C,0x8D,0x8E,0x93,0x5B,
+            0x8B,0x92,0x85,0x97,0x97,0x98,0x9B,0x8B,0x97,0x9A,0x9C,0x99,0x97,0x9D,0x9C,0x9C,
+            0x88,0x97,0x9B,0x9A,0x9D,0x91,0x9E,0x9D,0x96,0x89,0xA2,0x9E,0xA1,0x98,0xA1,0x9F,
+            0x89,0x73,0x96,0x9F,0x8C,0xA1,0x9F,0xA3,0x98,0x85,0xA1,0x94,0x94,0x8A,0x9E,0x9F,
+            0x80,0x67,0x8B,0x8B,0x6D,0x74,0x9A,0x98,0x4E,0x62,0x89,0x92,0x5F,0x70,0x93,0x95,
+            0x8C,0x9C,0x9A,0x94,0x9C,0x99,0x9F,0x9D,0x98,0x9D,0xA0,0x76,0xA0,0x9E,0x9C,0xA1,
+            0x9C,0x9C,0x8F,0x9E,0x7B,0x9E,0x68,0xA2,0xA0,0x9A,0x90,0xA2,0x9B,0x9B,0x9F,0x9F,
+            0xA1,0x97,0x8A,0x88,0x70,0x74,0x93,0x8C,0x9C,0xA2,0xA4,0xA3,0x96,0x95,0x94,0x92,
+            0x7C,0x84,0xA5,0x72,0x86,0x76,0x9A,0xA6,0x87,0x6D,0x98,0x6E,0xA7,0x83,0xA7,0xA2,
+            0x95,0xA6,0xA5,0xA3,0xA2,0xA6,0xA6,0xA4,0xA4,0x9D,0xA7,0xA4,0xA8,0xA2,0xA6,0xA4,
+            0xA5,0xA1,0xA5,0xA7,0xA7,0xA4,0xA7,0x90,0x8D,0x9C,0xA5,0x9E,0xA6,0xA5,0xA7,0xA7,
+            0x9C,0xA4,0xA5,0xA1,0xA6,0x9B,0xA8,0xA8,0x86,0x80,0x74,0x99,0x95,0x9B,0x7D,0x87,
+            0x95,0x7B,0x94,0x88,0x78,0x73,0x7D,0x7A,0x8F,0x9E,0x94,0x9D,0xA1,0xA2,0xA1,0xA2,
+            0x92,0x98,0x9C,0x95,0x9E,0x94,0x9F,0x9B,0x97,0x93,0x9B,0x94,0x90,0x97,0x9A,0x9D,
+            0x99,0xA0,0x9B,0x99,0x98,0x99,0x9D,0x9E,0x63,0x6D,0x9A,0x77,0x9C,0x9C,0x99,0x9B,
+            0x91,0x96,0x80,0x72,0x96,0x94,0x85,0x8B,0x8D,0x89,0x8A,0x88,0x82,0x80,0x79,0x6B,
+            0x6C,0x7B,0x87,0x89,0x89,0x8A,0x95,0x96,0x94,0x97,0x97,0x9C,0x98,0x8C,0x9D,0x7C,
+            0x9B,0xA0,0xA0,0xA0,0x99,0x91,0xA0,0x9F,0xA2,0xA3,0xA3,0xA0,0x9D,0x8C,0xA3,0xA3,
+            0x91,0xA2,0xA3,0xA7,0xA1,0x8B,0xA5,0xA6,0x99,0x9C,0xA4,0xA4,0xA5,0x87,0xA7,0xA5,
+            0xA4,0x93,0xA8,0xA6,0x9B,0x87,0xA7,0xA8,0xA7,0xA1,0xA7,0xA4,0x9F,0x87,0xA7,0xA6,
+            0x8D,0x86,0x99,0x99,0x8C,0x96,0x99,0x9C,0x72,0x85,0x98,0xA0,0x88,0x94,0x9E,0x9F,
+            0x9C,0x9B,0x9D,0xA3,0x99,0xA2,0x9F,0x9D,0x9F,0xA1,0xA4,0xA2,0xA3,0x9D,0xA3,0xA5,
+            0xA3,0x9D,0x97,0xA1,0xA0,0xA7,0x87,0xA6,0xA4,0xA2,0xA2,0xA3,0xA3,0xA4,0xA8,0xA8,
+            0xA4,0xA4,0x99,0xA2,0x97,0x93,0xA3,0x9C,0x9F,0xA0,0x9B,0xA4,0x9C,0x9B,0x87,0xA3,
+            0x96,0x9F,0xA6,0x87,0x96,0x98,0xA5,0x9E,0x9C,0x91,0xA1,0x93,0xA4,0x9A,0xA7,0xA6,
+            0x99,0xA7,0xA7,0xA1,0xA2,0xA5,0xA3,0xA8,0xA6,0xA5,0xA6,0xA7,0xA3,0xA6,0xAA,0xA7,
+            0xA4,0xA8,0xA7,0xA7,0x9D,0xA5,0xA5,0xA2,0xA3,0xA3,0xA7,0xA3,0xA5,0xA6,0xA7,0xA9,
+            0xA2,0xAB,0xA8,0xA5,0xA2,0xA7,0xA7,0xA5,0x9A,0x9C,0x9D,0x9F,0xA3,0xA3,0x9D,0xA1,
+            0x8A,0x83,0x7B,0x86,0x88,0x83,0x83,0x84,0x7E,0x91,0x7E,0x89,0x95,0x8B,0x7C,0x83,
+            0x7A,0x80,0x8F,0x89,0x97,0x8A,0x80,0x85,0x88,0x90,0x8D,0x97,0x98,0x92,0x92,0x90,
+            0x8D,0x94,0x92,0x99,0xA2,0x98,0x93,0x98,0x82,0x87,0x8B,0x8B,0x9B,0x97,0x90,0x8D,
+            0x82,0x86,0x7F,0x89,0x96,0x8E,0x8F,0x84,0x7E,0x86,0x7F,0x89,0x8D,0x85,0x7E,0x7A,
+            0x6D,0x7D,0x87,0x8A,0x8D,0x93,0x96,0x99,0x94,0x9A,0x9A,0x9F,0x99,0x9F,0x9C,0x7E,
+            0x9B,0x9F,0x9E,0xA2,0x9E,0xA4,0xA1,0xA2,0xA4,0xA3,0xA5,0xA2,0xA2,0x8E,0xA3,0xA2,
+            0xA0,0xA3,0xA0,0xA7,0xA2,0x8D,0xA7,0x81,0xA5,0x98,0xA6,0xA7,0xA1,0x8B,0xA3,0xA5,
+            0xA5,0x8F,0xA7,0xA4,0xA4,0x90,0xA9,0xA8,0xA6,0xA2,0xA7,0xA4,0x9F,0x88,0xA4,0xA2,
+            0x99,0x89,0x9F,0xA4,0x8F,0x8C,0xA4,0xA5,0x73,0x80,0xA1,0xA0,0x88,0x92,0xA6,0xA3,
+            0xA3,0xA5,0xA3,0xA6,0xA0,0xA5,0xA8,0xA7,0xA3,0xA5,0xA8,0xA0,0xA4,0xA5,0xA5,0xA8,
+            0xA9,0xA5,0x95,0xA4,0xA5,0xA5,0x82,0xA9,0xA5,0xAA,0xA2,0xA6,0xA5,0xA3,0xA6,0xA6,
+            0xA8,0xA6,0xA6,0xA5,0x8A,0x8F,0xA5,0x9B,0xA5,0xA8,0xA8,0xA7,0x9E,0xA2,0xA4,0xA3,
+            0x95,0x9D,0xA8,0x8D,0x9F,0x9C,0xA8,0xA1,0x9C,0x90,0xA2,0x92,0xA8,0x9B,0xA6,0xA2,
+            0xA2,0xA7,0xA6,0xA7,0xA7,0xA8,0xA5,0xA8,0xA9,0xA5,0xA7,0xA9,0xA6,0xA7,0xA6,0xA6,
+            0xA7,0xA8,0xA6,0xA7,0xAA,0xA5,0xA7,0xA5,0xA0,0xA6,0xA7,0xA6,0xA7,0xA9,0xA7,0xA6,
+            0xA6,0xA8,0xA5,0xA9,0xA7,0xA9,0xA6,0xA5,0x9A,0x9D,0x9C,0xA4,0xA6,0xA6,0x9D,0x9C,
+            0xA1,0xA0,0xA7,0xA2,0x98,0x94,0x9E,0x9C,0xA7,0xA6,0xA8,0xA6,0xA5,0xA4,0xA7,0xA8,
+            0xA6,0xA5,0xA5,0xA6,0xA5,0xA7,0xA6,0xA5,0xA4,0xA8,0xA4,0xA5,0xA4,0xA1,0xA4,0xA7,
+            0xA5,0xA3,0xA3,0xA0,0xA2,0xA0,0xA3,0xA2,0x95,0x90,0xA3,0x94,0xA1,0x99,0xA0,0x9E,
+            0x8F,0x9E,0x9A,0x90,0x9B,0x9D,0x97,0x98,0x98,0x95,0x94,0x92,0x8F,0x89,0x84,0x7B,
+            0x6F,0x7E,0x87,0x88,0x89,0x90,0x95,0x93,0x94,0x9A,0x9A,0x9E,0x97,0x9F,0x9F,0x80,
+            0x97,0x9F,0xA1,0xA1,0x98,0xA3,0xA1,0xA3,0xA3,0xA1,0xA5,0xA4,0x9F,0xA5,0xA3,0xA4,
+            0x9F,0xA5,0xA2,0xA4,0xA1,0x9C,0xA5,0xA6,0xA1,0x9E,0xA8,0xAA,0xA5,0xA7,0xA6,0xA8,
+            0xA5,0x92,0xA5,0xA3,0xA0,0xA4,0xA8,0xA6,0xA5,0xA0,0xA8,0xA6,0x9C,0xA1,0xA9,0xA2,
+            0x97,0x88,0x9A,0x8D,0x86,0x89,0x97,0x91,0x73,0x85,0x9E,0x9D,0x86,0x90,0xA1,0xA1,
+            0x92,0x99,0xA7,0x9C,0x93,0x9C,0xA1,0xA1,0x9A,0xA3,0xA8,0x9D,0xA0,0xA2,0xA7,0xA6,
+            0xA5,0xA7,0x99,0xA8,0x9C,0xA7,0x89,0xA6,0xA6,0xA8,0xA8,0xA2,0xA2,0xA4,0xA6,0xA7,
+            0xA4,0xA1,0xA4,0xA6,0x93,0x98,0xA8,0x9D,0xA1,0xA6,0xA5,0xA8,0x9F,0x9D,0xA5,0xA6,
+            0x94,0xA0,0xA0,0x88,0x8D,0x96,0x9B,0x98,0x9B,0x90,0xA2,0x8E,0xA1,0x98,0xA5,0xA2,
+            0x9E,0xA3,0xA3,0xA3,0x98,0x9D,0xA2,0xA3,0xAA,0xA4,0xA3,0xA9,0xA3,0xA6,0xA8,0xA7,
+            0xA7,0xA7,0xA9,0xA7,0xA5,0xA4,0xAB,0xA9,0xA2,0xA6,0xA8,0xA5,0xA6,0xA8,0xA8,0xA6,
+            0xA5,0xA7,0xA3,0xA3,0xA3,0xA4,0xA9,0xA3,0x9E,0x9F,0x9B,0x9B,0xA1,0x9F,0x9B,0x9D,
+            0x98,0x9B,0xA5,0xA3,0x99,0xA1,0xA0,0x99,0xA0,0xA1,0xA4,0xA7,0xA5,0xA5,0xA6,0xA4,
+            0xA0,0xA7,0xA3,0xA8,0xA1,0xA7,0xA7,0xA7,0xA3,0xA3,0xA2,0xA3,0xA5,0xA6,0xA3,0xA3,
+            0xA0,0xA1,0xA4,0xA0,0xA1,0xA2,0xA4,0x9F,0x95,0x91,0xA3,0x92,0xA3,0xA1,0xA0,0x9F,
+            0x96,0x9B,0x99,0x94,0x9C,0x9E,0x98,0x99,0x97,0x94,0x94,0x91,0x90,0x8A,0x83,0x7C,
+            0x59,0x69,0x74,0x75,0x61,0x82,0x7D,0x76,0x45,0x84,0x81,0x83,0x5C,0x88,0x7F,0x63,
+            0x46,0x86,0x83,0x87,0x63,0x8E,0x86,0x7F,0x4A,0x82,0x89,0x89,0x65,0x8E,0x86,0x7E,
+            0x4A,0x8A,0x89,0x8A,0x65,0x90,0x8B,0x85,0x4E,0x8A,0x8B,0x8C,0x69,0x89,0x88,0x81,
+            0x4D,0x76,0x8C,0x8C,0x6B,0x94,0x8B,0x86,0x50,0x85,0x88,0x88,0x6C,0x90,0x8A,0x83,
+            0x4F,0x6D,0x85,0x88,0x68,0x79,0x8D,0x8C,0x4C,0x68,0x85,0x8C,0x5F,0x74,0x86,0x87,
+            0x51,0x8F,0x91,0x91,0x71,0x91,0x8C,0x8D,0x56,0x91,0x91,0x8A,0x70,0x94,0x85,0x85,
+            0x53,0x90,0x91,0x90,0x71,0x91,0x72,0x91,0x58,0x93,0x8F,0x96,0x75,0x94,0x94,0x8E,
+            0x54,0x8F,0x8D,0x8E,0x72,0x84,0x8F,0x7E,0x5A,0x95,0x90,0x98,0x76,0x89,0x90,0x8A,
+            0x55,0x89,0x91,0x76,0x74,0x74,0x94,0x92,0x5A,0x71,0x8F,0x73,0x79,0x7F,0x96,0x90,
+            0x57,0x90,0x95,0x96,0x79,0x99,0x98,0x96,0x5C,0x92,0x95,0x9A,0x79,0x97,0x98,0x95,
+            0x58,0x99,0x95,0x95,0x7A,0x9A,0x9A,0x96,0x5D,0x96,0x98,0x9F,0x7B,0x9A,0x92,0x94,
+            0x59,0x93,0x94,0x93,0x7B,0x9B,0x98,0x88,0x60,0x81,0x80,0x96,0x7C,0x97,0x7E,0x87,
+            0x5A,0x88,0x90,0x8A,0x7A,0x81,0x81,0x7F,0x60,0x94,0x8E,0x9B,0x7C,0x91,0x9A,0x91,
+            0x5C,0x92,0x96,0x93,0x7D,0x90,0x98,0x95,0x62,0x91,0x98,0x91,0x7D,0x94,0x98,0x94,
+            0x5C,0x93,0x99,0x8C,0x7D,0x9C,0x9A,0x98,0x5B,0x6F,0x96,0x79,0x7D,0x96,0x91,0x8D,
+            0x5D,0x95,0x86,0x78,0x7B,0x94,0x86,0x8E,0x63,0x8E,0x8A,0x8E,0x76,0x83,0x7C,0x70,
+            0x66,0x7C,0x7E,0x86,0x8C,0x8F,0x90,0x93,0x8B,0x94,0x85,0x96,0x97,0x99,0x95,0x7F,
+            0x88,0x99,0x86,0x9B,0x98,0x9B,0x9B,0x9A,0x94,0x99,0x86,0x9D,0x9A,0x9B,0x96,0x9A,
+            0x87,0x9A,0x86,0x9B,0x95,0x9A,0x9D,0x9C,0x51,0x97,0x86,0x9C,0x9D,0x9B,0x97,0x9C,
+            0x90,0x92,0x86,0x9A,0x9B,0x9D,0x9D,0x9B,0x96,0x99,0x86,0x9C,0x99,0x9B,0x97,0x94,
+            0x71,0x8C,0x86,0x9E,0x92,0x96,0x9C,0x9C,0x77,0x85,0x85,0x9C,0x8A,0x95,0x98,0x9D,
+            0x98,0x9B,0x86,0x9D,0x9D,0x9A,0x9E,0x9B,0x93,0x9B,0x85,0x99,0x9E,0x9D,0x98,0x9F,
+            0x99,0x9A,0x86,0xA0,0x9C,0x96,0x8A,0x9B,0x9B,0x9B,0x86,0x97,0x9B,0x9C,0x98,0x9E,
+            0x96,0x9D,0x84,0x9D,0x95,0x95,0x9B,0x99,0x9A,0x9B,0x86,0x9E,0x9C,0x9D,0x97,0x96,
+            0x8F,0x99,0x85,0x8E,0x99,0x9A,0x9D,0x9B,0x99,0x92,0x85,0x91,0x9D,0x99,0x98,0x9D,
+            0x8E,0x9B,0x85,0x9E,0x9D,0x9D,0x9C,0x9C,0x9D,0x99,0x86,0x9D,0x9A,0x9C,0x97,0x9D,
+            0x95,0x9D,0x86,0x9F,0x9D,0x9B,0x9D,0x9D,0x9A,0x99,0x85,0x9C,0x9D,0x9C,0x97,0x9C,
+            0x97,0x9C,0x85,0x9D,0x9D,0x9D,0x9C,0x9B,0x97,0x94,0x84,0x9C,0x9B,0x9C,0x96,0x9A,
+            0x8C,0x9A,0x85,0x9D,0x9D,0x9B,0x9B,0x97,0x9B,0x98,0x85,0x9D,0x95,0x9D,0x97,0x9B,
+            0x99,0x9B,0x86,0x9F,0x9C,0x9C,0x9D,0x9C,0x97,0x9A,0x86,0x9A,0x9B,0x9A,0x96,0x99,
+            0x8B,0x9B,0x86,0x9C,0x99,0x9A,0x9B,0x99,0x95,0x91,0x86,0x91,0x9C,0x98,0x96,0x94,
+            0x8C,0x96,0x85,0x94,0x97,0x84,0x94,0x94,0x8F,0x91,0x84,0x8F,0x8A,0x86,0x7E,0x6B,
+            0x6F,0x7D,0x84,0x8B,0x8E,0x92,0x8D,0x98,0x96,0x9A,0x9D,0x9E,0x9E,0x9F,0x9F,0x81,
+            0x9C,0xA0,0xA4,0xA2,0xA2,0xA4,0xA4,0xA3,0xA1,0xA5,0xA4,0xA3,0xA3,0xA3,0xA6,0xA4,
+            0xA4,0xA7,0xA8,0xAA,0xA9,0xA5,0xA5,0xA7,0xA0,0xA2,0xAA,0xA7,0xA6,0xA7,0xA7,0xA9,
+            0x9F,0x93,0xA6,0xA8,0xA8,0xA6,0xA6,0xA8,0xA6,0xA3,0xA7,0xA5,0xA2,0xA7,0xA9,0xA8,
+            0xA1,0x8B,0xA9,0xA3,0x94,0x98,0xA8,0xA8,0x73,0x85,0xA0,0xA1,0x88,0x91,0xA6,0xA5,
+            0xA5,0xA5,0xAA,0xA7,0xA2,0xA3,0xA8,0xA7,0xA6,0xA7,0xAA,0xA4,0xA9,0xA6,0xA9,0xAC,
+            0xA6,0xA9,0x9C,0xAB,0xA0,0xA5,0x82,0xAA,0xA7,0xA8,0xA5,0xA9,0xA9,0xA6,0xAA,0xA9,
+            0xAA,0xA5,0xA9,0xA6,0x99,0x99,0xA6,0xA1,0xAA,0xA8,0xA9,0xA9,0xA8,0xAA,0xA7,0xA8,
+            0x98,0x9F,0xA8,0x93,0xA3,0xA0,0xA5,0xA9,0xA1,0x8E,0xA1,0x92,0xA5,0x9D,0xA6,0xA9,
+            0xA0,0xA7,0xA5,0xA6,0xA6,0xA9,0xA6,0xA9,0xA9,0xA9,0xA8,0xA8,0xA9,0xA8,0xA7,0xA7,
+            0xA7,0xA7,0xAA,0xAA,0xA8,0xA5,0xA8,0xA9,0xA5,0xA8,0xAA,0xAA,0xA7,0xA7,0xA9,0xA8,
+            0xA7,0xA8,0xAA,0xA8,0xA8,0xA8,0xA8,0xA8,0x9E,0xA2,0x9A,0xA7,0xA6,0xA6,0x96,0x9E,
+            0xA6,0xA3,0xA7,0xA4,0x9C,0x9A,0x9E,0x9F,0xA6,0xA8,0xA5,0xA8,0xA5,0xA6,0xA6,0xA7,
+            0xA4,0xA6,0xAA,0xA7,0xA6,0xA4,0xA8,0xA8,0xA4,0xA6,0xA6,0xA1,0xA5,0xA5,0xA5,0xA5,
+            0xA6,0xA4,0xA5,0xA3,0xA1,0xA3,0xA3,0xA3,0x94,0x91,0xA3,0x95,0xA1,0xA1,0xA1,0xA1,
+            0x93,0x9F,0x93,0x92,0x9C,0x9C,0x99,0x98,0x99,0x94,0x95,0x93,0x8E,0x89,0x84,0x7B,
+            0x6F,0x7C,0x83,0x89,0x88,0x92,0x94,0x98,0x95,0x98,0x9B,0x9E,0x9F,0x9E,0xA2,0x7F,
+            0x9A,0xA2,0xA3,0xA3,0xA2,0xA2,0xA4,0xA5,0xA1,0xA4,0xA5,0xA2,0xA5,0xA4,0xA3,0xA6,
+            0xA0,0xA5,0xA7,0xA7,0xA7,0xA2,0xA7,0xA4,0xA6,0xA3,0xA9,0xA8,0xA8,0xA7,0xA4,0xA7,
+            0xA3,0x93,0xA8,0xA8,0xA6,0xA6,0xA8,0xA8,0xA6,0xA4,0xA7,0xA3,0xA1,0x8F,0xA9,0xA9,
+            0x9F,0x8B,0xA7,0xA0,0x92,0x98,0xA7,0xA8,0x73,0x82,0x9C,0x9E,0x84,0x8B,0xA6,0xA4,
+            0xA3,0xA4,0xA6,0xA3,0xA2,0xA6,0xA9,0xA7,0xA7,0xA8,0xAA,0xA2,0xA7,0xA8,0xA8,0xA7,
+            0xA6,0xA7,0x96,0xA9,0x9B,0xA9,0x82,0xA9,0xA6,0x9C,0xA6,0xAA,0xAA,0xA8,0xA8,0xA1,
+            0xA6,0xA9,0xA6,0xA9,0x9A,0x9A,0xA1,0xA2,0xA8,0xA8,0xA8,0xAA,0xAB,0xA7,0xA5,0xA8,
+            0x96,0xA0,0x9B,0x90,0xA3,0x9D,0xA6,0xA5,0x9D,0x8E,0xA4,0x90,0xA6,0x9E,0xAC,0xA7,
+            0x9F,0xA8,0xA7,0xA8,0xA6,0xA8,0xA7,0xA9,0xA9,0xA8,0xA6,0xA8,0xA9,0xA7,0xA8,0xA8,
+            0xA7,0xA7,0xA7,0xA8,0xA9,0xA7,0xAA,0xAA,0xA5,0xA9,0xA9,0xA9,0xA9,0xA7,0xA7,0xA8,
+            0xA7,0xA8,0xAA,0xA6,0xA5,0xA8,0xA5,0x81,0xA0,0xA0,0x9E,0xA8,0xA5,0xA6,0x9C,0xA0,
+            0xA5,0x9D,0xA7,0xA8,0x94,0x95,0xA0,0x9E,0xA7,0xA9,0xA6,0xA6,0xA5,0xA6,0xA5,0xA5,
+            0xA5,0xA7,0xA9,0xA5,0xA8,0xA4,0xA5,0xA6,0xA7,0xA5,0xA2,0xA6,0xA3,0xA7,0xA5,0xA4,
+            0xA4,0xA6,0xA6,0xA5,0xA1,0xA5,0xA5,0xA5,0x96,0x8E,0x9D,0x94,0xA1,0xA1,0xA0,0xA2,
+            0x97,0x9E,0x96,0x90,0x9C,0x9E,0x99,0x99,0x98,0x95,0x95,0x93,0x90,0x89,0x84,0x7C,
+            0x4E,0x62,0x70,0x77,0x77,0x76,0x86,0x88,0x81,0x86,0x8E,0x92,0x8B,0x8E,0x8B,0x69,
+            0x8B,0x96,0x8B,0x99,0x95,0x94,0x99,0x9D,0x94,0x9C,0xA1,0x9F,0x9E,0x9B,0x9D,0xA2,
+            0x93,0x9E,0xA1,0xA0,0x99,0x93,0x98,0xA0,0x99,0x96,0xA1,0xA2,0x9E,0x9E,0x9B,0xA0,
+            0x98,0x71,0x9C,0xA2,0x89,0xA1,0xA2,0xA8,0x9B,0x89,0xA3,0x8F,0x8F,0x99,0xA7,0xA7,
+            0x88,0x6E,0x92,0x96,0x6C,0x78,0x8E,0x7E,0x53,0x67,0x8C,0x93,0x61,0x74,0x7E,0x8B,
+            0x90,0x8B,0x9B,0x99,0x84,0x8F,0x82,0x8A,0x96,0x88,0xA0,0x6F,0x7F,0x9B,0x81,0x9E,
+            0xA1,0x98,0xA0,0xA2,0x6F,0x97,0x72,0x97,0x9E,0x98,0x95,0xA5,0x84,0x9E,0x87,0x79,
+            0xA2,0x98,0x92,0x98,0x7E,0x81,0x8D,0x92,0x9A,0x99,0xA3,0xA5,0x88,0x9F,0x89,0x83,
+            0x81,0x8B,0xA3,0x78,0x74,0x7A,0x9D,0x97,0x8F,0x72,0x94,0x6F,0x7E,0x89,0x88,0xA3,
+            0x9B,0xA8,0xA6,0xA8,0x87,0x94,0x9C,0x97,0xA2,0x9C,0xA6,0xA7,0x7E,0xA1,0x86,0xA7,
+            0xA3,0xAA,0xA6,0xA4,0x93,0x93,0xA7,0x96,0x9A,0xA6,0xA8,0xA7,0x83,0xA4,0x83,0xA5,
+            0x9E,0xA3,0xA5,0xA3,0x93,0x91,0xA6,0x96,0x82,0x86,0x82,0x9B,0x8A,0x9C,0x7D,0x8F,
+            0x8C,0x79,0x7E,0x7B,0x82,0x84,0x80,0x7D,0x79,0x94,0x85,0x89,0x8A,0x8F,0x90,0x8F,
+            0x7C,0x81,0x96,0x88,0x88,0x8F,0x8B,0x8C,0x81,0x87,0x87,0x98,0x8D,0x91,0x8D,0x92,
+            0x85,0x87,0x85,0x8A,0x97,0x8F,0x90,0x92,0x68,0x73,0x8E,0x7B,0x89,0x9A,0x90,0x8E,
+            0x89,0x8C,0x80,0x7B,0x8C,0x8A,0x8B,0x87,0x85,0x86,0x84,0x88,0x82,0x81,0x7A,0x6F,
+            0x6E,0x7B,0x86,0x89,0x6F,0x7D,0x8C,0x92,0x90,0x93,0x98,0x9C,0x87,0x97,0x9E,0x7F,
+            0x96,0x9D,0xA1,0xA0,0x8F,0x9B,0x9B,0xA1,0x9E,0xA2,0xA1,0xA2,0x96,0x9E,0xA2,0xA6,
+            0x9E,0x9D,0xA2,0xA5,0x96,0x9E,0xA4,0xA7,0xA2,0xA0,0xA8,0xA4,0x97,0xA0,0xA0,0xA5,
+            0xA3,0x93,0xA5,0xA6,0x95,0xA0,0xA8,0xAA,0xA3,0x9F,0xA5,0xA2,0x95,0x9C,0xA4,0xA9,
+            0x8F,0x81,0x9B,0x9A,0x61,0x7D,0x91,0x9B,0x74,0x7D,0x9B,0x9E,0x6E,0x8C,0x91,0x9C,
+            0x9C,0x8D,0xA1,0xA0,0x76,0x8F,0x8D,0x9D,0x9B,0x8C,0xA5,0x9F,0x7C,0x92,0x95,0xA0,
+            0xA1,0x92,0x9B,0xA1,0x83,0x94,0x86,0xA6,0xA0,0x95,0xA4,0xA2,0x84,0x92,0x98,0xA2,
+            0xA0,0x91,0x9B,0xA0,0x84,0x8F,0x99,0x9B,0xA0,0x95,0xA5,0xA3,0x85,0x92,0x9A,0xA3,
+            0x90,0x99,0x9E,0x8A,0x61,0x76,0x99,0x9C,0x9A,0x8D,0xA2,0x90,0x72,0x87,0x9F,0xA3,
+            0x9D,0xA7,0xA3,0xA3,0x74,0x86,0x9C,0xA5,0xA3,0xA2,0xA2,0xA4,0x74,0x8E,0x9E,0xA5,
+            0xA1,0xA4,0xA8,0xA2,0x78,0x89,0x86,0xA4,0x9E,0xA7,0xA4,0xA1,0x77,0x90,0xA1,0xA4,
+            0xA1,0xAA,0xA3,0xA4,0x78,0x8D,0x9F,0xA3,0x9B,0x9E,0x9D,0xA2,0x78,0x8E,0x98,0x9E,
+            0x7E,0x6D,0x6C,0x7C,0x80,0x7F,0x75,0x76,0x70,0x89,0x74,0x89,0x90,0x89,0x7E,0x83,
+            0x6C,0x75,0x88,0x84,0x8C,0x86,0x7B,0x7D,0x77,0x82,0x7D,0x8F,0x8F,0x87,0x7D,0x87,
+            0x7D,0x89,0x86,0x8E,0xA3,0x8C,0x85,0x8F,0x75,0x80,0x7E,0x84,0x8A,0x8C,0x7F,0x86,
+            0x72,0x7C,0x77,0x85,0x8A,0x84,0x87,0x81,0x71,0x79,0x7B,0x85,0x88,0x80,0x72,0x7B,
+            0x6D,0x7C,0x86,0x8A,0x8C,0x94,0x95,0x96,0x96,0x99,0x91,0x9C,0x9B,0x9F,0x9E,0x80,
+            0x9E,0xA2,0xA2,0xA2,0xA1,0xA3,0xA4,0xA5,0xA1,0xA3,0xA2,0xA4,0xA2,0xA5,0xA1,0xA3,
+            0x9E,0xA5,0xA6,0xA9,0xA6,0xA4,0xA5,0xA7,0xA1,0xA2,0xA4,0xA6,0xA6,0xA8,0xA3,0xA2,
+            0xA3,0x93,0xA8,0xA6,0xA7,0xA5,0xA9,0xA8,0xA4,0xA3,0xA7,0xA6,0xA1,0xA1,0xA5,0xA7,
+            0x9B,0x8C,0xA4,0x9B,0x8C,0x8F,0xA1,0xA4,0x73,0x86,0xA1,0xA1,0x88,0x93,0x9F,0xA0,
+            0xA4,0xA5,0xA5,0xA3,0xA2,0xA4,0xA2,0xA4,0x9D,0xA1,0xA8,0xA2,0xA3,0xA6,0xA6,0xA5,
+            0xA5,0xAA,0x9B,0xA5,0xA3,0xAA,0x85,0xA6,0xA8,0xAB,0xA7,0xAA,0xA7,0xA6,0xA7,0xA8,
+            0xA8,0xAA,0xA5,0xA7,0x91,0x92,0xA3,0xA3,0xA5,0xA8,0xA5,0xA8,0xA7,0xA7,0xA7,0xA4,
+            0x98,0x9F,0xA5,0x8C,0x9C,0x98,0xA4,0xA4,0xA0,0x89,0xA3,0x8E,0x9A,0x9B,0xA6,0xA5,
+            0x9F,0xA8,0xA8,0xA6,0xA9,0xA8,0xA6,0xA9,0xA9,0xA8,0xA7,0xA8,0xA7,0xA6,0xA7,0xA6,
+            0xA4,0xA6,0xAB,0xA9,0xA8,0xA6,0x8C,0xA4,0xA3,0xA7,0xA7,0xA7,0xA7,0xA8,0xA8,0xA5,
+            0xA7,0xA7,0xA5,0xA5,0xA5,0xA7,0xA7,0xA5,0x9F,0xA1,0x9D,0xA7,0xA6,0xA5,0x9F,0xA0,
+            0x74,0x86,0x7F,0x93,0x97,0x8E,0x8C,0x8F,0x7F,0x8D,0x89,0x9B,0x98,0x99,0x93,0x98,
+            0x8A,0x95,0x90,0xA3,0xA0,0xA1,0x99,0x99,0x8E,0x98,0x95,0x9D,0xA1,0x9D,0x9F,0x9F,
+            0x96,0x9E,0x9F,0xA0,0xA1,0x9F,0xA0,0xA0,0x94,0x92,0xA0,0x96,0xA0,0x9F,0xA0,0xA0,
+            0x99,0x9C,0x98,0x93,0x9D,0x9B,0x97,0x98,0x94,0x95,0x94,0x93,0x90,0x88,0x84,0x7B,
+            0x6C,0x73,0x85,0x85,0x5E,0x91,0x93,0x91,0x8C,0x9A,0x9A,0x9C,0x93,0x9E,0x9C,0x82,
+            0x92,0xA0,0xA0,0xA0,0x6D,0xA3,0x9E,0x9D,0x95,0xA2,0xA3,0xA3,0xA0,0xA4,0x8B,0xA5,
+            0x9A,0xA5,0xA8,0xA3,0xA4,0xA2,0xA7,0xA3,0x9E,0xA4,0xA8,0xA3,0xA3,0xA4,0xA3,0xA3,
+            0x9E,0x91,0xA1,0xA3,0x9F,0xA4,0xA8,0x9F,0xA2,0xA4,0xA8,0xA2,0x9F,0xA3,0xA5,0xA8,
+            0x94,0x88,0x93,0x87,0x7B,0x88,0x8C,0x88,0x70,0x85,0x96,0x8C,0x82,0x8D,0x98,0x91,
+            0x95,0x98,0xA5,0x8A,0x90,0x8C,0x97,0x90,0x94,0x9E,0xA6,0x9C,0x99,0xA0,0x9E,0x99,
+            0xA3,0xA3,0xA0,0x9B,0x9D,0x9F,0x82,0x9F,0xA1,0xA7,0xA3,0x9D,0x98,0xA2,0x9E,0x9E,
+            0x9B,0xA2,0x9B,0x9A,0x94,0x92,0x9D,0x91,0x9A,0xA4,0x9F,0x9F,0x9C,0x9D,0x97,0x97,
+            0x96,0x99,0x9F,0x85,0x88,0x8E,0x95,0x96,0x98,0x8D,0x9E,0x89,0x94,0x98,0x99,0x9C,
+            0x9B,0x9F,0xA6,0x91,0x9A,0x9A,0x9F,0x9A,0xA5,0xA8,0xA2,0xA7,0xA0,0xA0,0xA5,0xA6,
+            0xA5,0xA6,0xA8,0xA4,0xA5,0xA3,0xA5,0xA7,0xA1,0xA7,0xA8,0xA2,0x9F,0xA6,0xA3,0xA5,
+            0xA0,0xA5,0xA2,0x98,0x9C,0xA1,0xA5,0xA0,0x99,0x9D,0x94,0x9E,0xA1,0xA2,0x9E,0x9A,
+            0x9F,0x99,0xA3,0xA2,0xA2,0xA1,0x9E,0x9B,0x9F,0xA3,0xA1,0xA6,0xA5,0xA4,0xA6,0xA4,
+            0x9A,0x9C,0xA6,0x95,0xA2,0xA6,0xA5,0xA4,0x9F,0xA1,0xA4,0xA0,0xA2,0x9F,0xA4,0xA3,
+            0xA2,0x9C,0xA2,0x9E,0xA1,0x9C,0xA1,0xA2,0x8E,0x90,0xA2,0x91,0x9E,0x9F,0x9C,0xA0,
+            0x99,0x9A,0x9A,0x92,0x9D,0x9D,0x98,0x97,0x87,0x94,0x93,0x91,0x8F,0x89,0x84,0x7A,
+            0x6E,0x70,0x7E,0x83,0x84,0x8F,0x8C,0x88,0x7E,0x90,0x85,0x8D,0x98,0x9C,0x94,0x77,
+            0x86,0x8B,0x93,0x8F,0x96,0x9E,0x96,0x8A,0x8D,0x98,0x9D,0x9A,0x9C,0xA5,0x99,0x97,
+            0x8B,0x9C,0xA1,0xA0,0x6B,0x99,0xA0,0x9E,0x8E,0x93,0x98,0x9B,0x9F,0xA5,0x9B,0x99,
+            0x87,0x87,0x95,0x99,0x91,0xA5,0x99,0x83,0x8F,0x89,0x94,0x98,0x9C,0x9E,0x8F,0x98,
+            0x87,0x7F,0x98,0x9C,0x84,0x8B,0x9E,0x9E,0x6F,0x7F,0x97,0xA0,0x7F,0x90,0x9E,0xA3,
+            0x97,0xA1,0x98,0xA2,0xA2,0xA2,0xA3,0x9F,0x98,0xA4,0xA7,0x9C,0xA5,0xA7,0xA6,0xA6,
+            0xA0,0xA0,0xA7,0xA6,0x9A,0xA5,0x85,0xA4,0xA2,0xA4,0xA1,0xA8,0xA7,0x93,0xA5,0xA9,
+            0x9C,0xA5,0x9E,0x98,0x93,0x92,0x97,0x96,0xA5,0xA8,0xA3,0xAA,0xA5,0x9E,0xA2,0x9A,
+            0x8B,0x91,0x94,0x80,0x93,0x87,0x97,0x97,0x94,0x81,0x9A,0x86,0xA1,0x8A,0xA0,0x9F,
+            0x91,0x98,0xA0,0xA2,0x97,0x9C,0xA1,0x9F,0x9F,0xA2,0xA3,0xA1,0xA2,0x9C,0xA4,0xA4,
+            0xA1,0xA6,0xA8,0xA3,0xA6,0x9F,0xA4,0xA4,0x91,0xA2,0xA4,0xA1,0xA5,0x92,0x9F,0x9D,
+            0x96,0x9F,0x9E,0x9D,0x99,0x9B,0x9F,0x9E,0x97,0x9B,0x95,0xA2,0x9E,0xA0,0x98,0x9C,
+            0x7F,0x83,0x8E,0x8B,0x91,0x84,0x91,0x87,0x87,0x98,0x95,0x9F,0xA2,0x96,0x9C,0x9C,
+            0x83,0x89,0x9A,0x97,0x9D,0x95,0x98,0x96,0x90,0x9B,0x96,0xA1,0x9E,0x97,0x9E,0x9B,
+            0x8F,0x94,0xA2,0x9E,0xA3,0x99,0xA1,0x9F,0x82,0x86,0x9C,0x8E,0x9C,0x97,0x9A,0x9B,
+            0x8C,0x92,0x94,0x8B,0x96,0x92,0x90,0x91,0x8C,0x8D,0x91,0x91,0x8E,0x87,0x81,0x78,
+            0x6D,0x78,0x86,0x88,0x8C,0x92,0x93,0x93,0x8D,0x91,0x96,0x95,0x98,0x99,0x9A,0x81,
+            0x91,0x97,0x99,0x9A,0x9A,0x9A,0x9B,0x99,0x95,0x99,0x99,0x9A,0x9C,0x9D,0x9A,0x9C,
+            0x93,0x95,0x9A,0x9D,0x9D,0x9C,0x9B,0x9B,0x99,0x99,0x9C,0x9C,0x9C,0x96,0x9B,0x9C,
+            0x99,0x91,0x9C,0x9D,0x9B,0x9C,0x9C,0x9B,0x91,0x96,0x9C,0x9D,0x97,0x9B,0x9B,0x9C,
+            0x71,0x8A,0x9C,0x9C,0x91,0x92,0x9A,0x9C,0x76,0x84,0x9B,0x9C,0x89,0x92,0x9B,0x9C,
+            0x9A,0x99,0x9B,0x9A,0x9C,0x9D,0x9C,0x9B,0x99,0x9A,0x9D,0x9B,0x9D,0x9D,0x9D,0x9B,
+            0x9A,0x97,0x99,0x9C,0x9A,0x99,0x89,0x9C,0x9B,0x98,0x9B,0x97,0x9B,0x9A,0x9B,0x9A,
+            0x9A,0x9C,0x91,0x9A,0x91,0x90,0x99,0x8F,0x9B,0x9C,0x9B,0x9D,0x9F,0x9D,0x9B,0x9E,
+            0x8D,0x98,0x99,0x8D,0x9C,0x9A,0x9C,0x9B,0x99,0x8C,0x9C,0x8F,0x9F,0x99,0x9C,0x9E,
+            0x98,0x9B,0x9B,0x9E,0x9D,0x9C,0x9C,0x9C,0x99,0x9A,0x9D,0x9F,0x9D,0x9E,0x9B,0x9D,
+            0x9A,0x9A,0x9B,0x9E,0x9C,0x9D,0x9C,0x9C,0x9A,0x98,0x9B,0x9D,0x9D,0x9D,0x9A,0x9C,
+            0x9B,0x9C,0x9B,0x9D,0x9C,0x9B,0x9B,0x9C,0x99,0x96,0x93,0x9C,0x9C,0x9C,0x98,0x9B,
+            0x92,0x98,0x9A,0x9C,0x9B,0x9A,0x99,0x98,0x95,0x99,0x99,0x9C,0x9C,0x9D,0x9B,0x9C,
+            0x93,0x9C,0x9B,0x9D,0x9B,0x9B,0x9B,0x9A,0x99,0x99,0x99,0x9C,0x97,0x9B,0x9B,0x9B,
+            0x98,0x9A,0x98,0x9A,0x9A,0x9C,0x9B,0x99,0x8F,0x8F,0x98,0x92,0x9A,0x9A,0x96,0x95,
+            0x94,0x97,0x95,0x95,0x95,0x84,0x94,0x95,0x92,0x91,0x90,0x91,0x8D,0x88,0x7D,0x7A,
+            0x70,0x6E,0x85,0x8A,0x8C,0x7A,0x96,0x98,0x93,0x99,0x93,0x9C,0x9C,0x92,0x9F,0x4B,
+            0x98,0x9E,0xA3,0xA2,0xA1,0x9B,0xA2,0xA0,0x9E,0xA4,0xA5,0xA2,0xA3,0x9E,0xA5,0xA6,
+            0x9D,0xA7,0xA6,0xA5,0xA4,0x9F,0xA5,0xA7,0x9C,0xA4,0xA6,0xA9,0xA8,0xA2,0x9C,0xA5,
+            0xA2,0x92,0xA4,0xA2,0xA4,0xA3,0xA7,0xAA,0xA4,0xA3,0xA8,0xA5,0xA2,0xA2,0xA8,0xAA,
+            0x96,0x7F,0x96,0x97,0x8D,0x93,0x9C,0x9D,0x72,0x83,0xA2,0xA3,0x83,0x8F,0xA4,0xA1,
+            0xA3,0xA3,0xA5,0xA8,0x95,0xA3,0xA5,0xA9,0xA6,0xA3,0xAA,0xA2,0xA5,0xA9,0xAA,0xA7,
+            0xA8,0xA5,0xA0,0xA1,0x92,0xA6,0x85,0xA3,0xA4,0xA4,0xA1,0xA7,0xA2,0xA2,0xA7,0xA3,
+            0xA0,0xA5,0xA3,0x9D,0x8F,0x90,0xA2,0x9F,0xA4,0xA7,0xA3,0xA7,0xA6,0xA6,0x9F,0xA7,
+            0x94,0x9D,0xA4,0x8D,0x9B,0x9A,0xA6,0xA1,0x9F,0x92,0xA7,0x91,0xA7,0x9C,0xA7,0xA7,
+            0xA0,0xA6,0xA9,0xA6,0xA6,0xA8,0xA8,0xA7,0xA7,0xA3,0xA9,0x9E,0xA5,0xA7,0xA8,0xA9,
+            0xA4,0xA6,0xA9,0xA9,0xA8,0xA6,0xAB,0xA9,0xA4,0xA9,0xAA,0xA8,0xA7,0xA5,0xA8,0xA7,
+            0xA3,0xA6,0xA8,0xA6,0xA5,0xA8,0xA8,0xA6,0x9C,0xA1,0x94,0xA2,0xA5,0xA4,0x9E,0x9D,
+            0x96,0x85,0x8B,0x97,0x96,0x99,0x9C,0x9B,0x89,0x9D,0x93,0x9E,0x9F,0x9F,0xA5,0xA3,
+            0x93,0x9B,0xA1,0x9E,0x9D,0xA0,0xA4,0xA2,0x94,0x96,0x9C,0xA1,0x9E,0x9F,0xA3,0xA1,
+            0x9C,0x9A,0x9E,0xA0,0xA1,0x9F,0xA1,0xA2,0x93,0x90,0x9B,0x93,0x9F,0x9F,0x9E,0xA1,
+            0x99,0x9D,0x9B,0x94,0x98,0x9D,0x99,0x99,0x95,0x93,0x94,0x91,0x8E,0x89,0x83,0x7A,
+            0x6E,0x6F,0x85,0x85,0x8C,0x7F,0x96,0x97,0x91,0x99,0x9C,0x9E,0x9D,0x94,0xA1,0x7C,
+            0x99,0xA1,0xA1,0xA4,0xA3,0x9D,0xA4,0xA1,0xA1,0xA4,0xA4,0xA3,0xA4,0xA1,0xA6,0xA5,
+            0x9C,0xA7,0xA6,0xA6,0xAA,0x9F,0xA7,0xA8,0x9B,0xA4,0xA6,0xA8,0xA6,0xA3,0xA3,0xA4,
+            0xA3,0x95,0xA7,0xA6,0xA7,0xA3,0xAA,0xA7,0xA5,0xA2,0xA7,0xA5,0x9F,0xA5,0xA8,0xAC,
+            0x9A,0x8B,0xA2,0xA5,0x8E,0x94,0xA1,0xA7,0x70,0x83,0xA2,0xA3,0x81,0x8E,0xA5,0xA7,
+            0xA4,0xA6,0xA5,0xA8,0xA3,0xA4,0xA6,0xA9,0xA8,0xA3,0xAB,0xA4,0xA5,0xA8,0xA8,0xAB,
+            0xA6,0xA5,0x9A,0xA6,0x95,0xA8,0x88,0xA5,0xA8,0xA6,0xA5,0xA9,0xA4,0xA7,0xA6,0xA8,
+            0xA6,0xAA,0xA6,0xA2,0x8C,0x8B,0x98,0x98,0xA4,0xA6,0xA6,0xA7,0xA3,0xA6,0xA0,0xA7,
+            0x97,0x9E,0xA6,0x8E,0x95,0x9E,0xA7,0xA6,0xA1,0x93,0xA6,0x91,0xA2,0x9E,0xAA,0xAA,
+            0xA1,0xA6,0xA7,0xA8,0xA5,0xA8,0xA8,0xA9,0xA7,0xA3,0xA7,0xA8,0xA5,0xA6,0xA9,0xA9,
+            0xA5,0xA6,0xA9,0xA9,0xA5,0xA5,0xA9,0xA5,0x9F,0xA5,0xA7,0xAA,0xA5,0xAA,0xA9,0xAA,
+            0xA5,0xA9,0xAA,0xA7,0xA4,0xA8,0xAA,0xA7,0x97,0xA4,0x9D,0xA5,0xA5,0xA5,0x9D,0x9D,
+            0x98,0x79,0x87,0x92,0x97,0x95,0x9D,0x9C,0x7B,0xA4,0x96,0x9D,0x9D,0xA1,0xA2,0xA1,
+            0x89,0x94,0xA5,0x9C,0x9D,0xA1,0x99,0xA1,0x8E,0x9A,0x96,0xA2,0x9E,0x9E,0x96,0xA2,
+            0x92,0x9C,0x99,0x9D,0xA1,0x9F,0x9F,0xA0,0x8B,0x90,0x9C,0x89,0x9B,0xA0,0x9C,0x9E,
+            0x92,0x9B,0x96,0x90,0x94,0x99,0x97,0x97,0x8F,0x92,0x91,0x92,0x8E,0x89,0x83,0x78,
+            0x61,0x60,0x6D,0x74,0x7C,0x81,0x81,0x87,0x84,0x85,0x8D,0x91,0x72,0x92,0x96,0x63,
+            0x8B,0x95,0x96,0x94,0x93,0x99,0x9B,0x9C,0x94,0x9D,0x9F,0x9C,0x93,0xA2,0xA2,0x9A,
+            0x92,0x9C,0x98,0xA2,0x96,0x99,0xA1,0xA2,0x99,0x95,0xA4,0xA2,0x9A,0xA3,0x9F,0x97,
+            0x93,0x76,0xA1,0x9D,0x9F,0xA0,0xA2,0xA5,0x99,0x89,0x99,0x97,0x86,0x97,0xA2,0xA6,
+            0x87,0x6C,0x89,0x98,0x70,0x79,0x9B,0xA1,0x53,0x68,0x8B,0x92,0x63,0x74,0x96,0x9D,
+            0x92,0x9E,0x9C,0x9A,0x9D,0x9C,0xA1,0x9D,0x9D,0x9E,0x9F,0x7D,0x99,0x9F,0xA4,0x9F,
+            0x9D,0xA3,0x8C,0xA0,0x83,0xA3,0x6B,0xA6,0xA1,0xA2,0x96,0xA8,0xA5,0xA6,0xA4,0xA4,
+            0xA2,0xA7,0x99,0x99,0x7E,0x7D,0x9E,0x97,0x9D,0xA3,0xA2,0xA4,0xA1,0x9E,0x9F,0x9D,
+            0x84,0x8E,0xA6,0x74,0x86,0x7C,0xA2,0xA4,0x88,0x71,0x90,0x72,0xA7,0x85,0xA5,0xA7,
+            0x9A,0xA4,0xA5,0xA6,0xA6,0xA5,0x8B,0xA6,0xA3,0xA0,0xA7,0xA6,0xA3,0xA8,0x9F,0xA7,
+            0x9D,0xA6,0xAA,0xA3,0xA7,0xA6,0xA8,0xA2,0x96,0xA1,0xA7,0xA6,0xA6,0xA5,0xA9,0xA6,
+            0x9D,0xA3,0xA3,0xA1,0xA2,0xA1,0xA8,0xA7,0x8D,0x87,0x83,0xA0,0xA4,0x9E,0x7C,0x8F,
+            0x87,0x82,0xA4,0x8E,0x84,0x82,0x86,0x79,0x9E,0x9A,0x9E,0xA3,0xA4,0xA3,0xA5,0xA3,
+            0x9D,0x9A,0x98,0x96,0xA3,0xA6,0xA6,0xA1,0x9B,0x99,0xA1,0x97,0xA0,0xA2,0x9B,0x9C,
+            0x9D,0x9A,0x9F,0xA0,0x98,0x9E,0x9F,0x96,0x67,0x6D,0x9D,0x7C,0x9F,0x99,0x9D,0x9A,
+            0x95,0x9A,0x83,0x74,0x98,0x96,0x89,0x8E,0x8E,0x8D,0x8C,0x88,0x82,0x7E,0x78,0x6B,
+            0x6F,0x7A,0x86,0x88,0x8D,0x92,0x96,0x98,0x8E,0x97,0x99,0x9C,0x97,0x9E,0xA1,0x7F,
+            0x92,0xA1,0xA3,0xA1,0x9C,0x9C,0xA0,0xA0,0x97,0xA6,0xA4,0xA3,0xA4,0xA4,0xA4,0xA3,
+            0x9B,0xA2,0xA3,0xA6,0xA2,0xA5,0xA6,0xA7,0xA0,0xA0,0xA6,0xA6,0xA7,0xA5,0xA0,0xA4,
+            0x9D,0x95,0x9D,0xA1,0xA3,0xA3,0x9E,0xA8,0xA0,0x9A,0xA5,0xA3,0xA0,0xA2,0xAA,0xA6,
+            0x99,0x87,0x9D,0xA0,0x92,0x96,0xA5,0xA4,0x73,0x85,0xA0,0xA0,0x86,0x92,0xA2,0xA4,
+            0xA5,0xA5,0xA7,0xA7,0xA1,0xA4,0xA8,0xA0,0xA1,0xA5,0xAA,0x9F,0xA5,0xA4,0xA9,0xA6,
+            0xA2,0x9F,0x97,0xA6,0xA0,0xA6,0x88,0xA6,0xA5,0xA0,0xA7,0xA8,0xA7,0xA5,0xA5,0xA8,
+            0xA7,0xAA,0xA1,0xA2,0x98,0x97,0xA2,0x9E,0xA7,0xAA,0xA3,0xAB,0x9E,0xA1,0xA6,0xA2,
+            0x97,0x9F,0xA8,0x87,0x9E,0x99,0xAA,0xA4,0xA2,0x90,0xA6,0x8F,0xA3,0x9A,0xA7,0xA8,
+            0x99,0xA7,0xA7,0xAA,0xA7,0xA7,0xA2,0xA8,0xA7,0xA3,0xA7,0xA9,0xA6,0xA4,0xA6,0xA7,
+            0xA3,0xA5,0xA7,0xA9,0xA4,0xA5,0xA6,0xA1,0xA2,0xA6,0xA7,0xA7,0xA7,0xA8,0xA7,0xA6,
+            0xA4,0xA8,0xA8,0xA9,0xA4,0xA8,0xA8,0xA5,0xA0,0x9F,0x9D,0xA5,0xA8,0xA3,0x9D,0xA1,
+            0x48,0x82,0x83,0x8A,0x8D,0x86,0x80,0x84,0x80,0x52,0x84,0x91,0x9A,0x91,0x8A,0x8B,
+            0x7D,0x84,0x50,0x8E,0x97,0x8D,0x88,0x8D,0x8B,0x8F,0x8E,0x5F,0x94,0x92,0x8F,0x8E,
+            0x95,0x96,0x97,0x97,0x68,0x97,0x95,0x98,0x8A,0x89,0x8D,0x8B,0x96,0x5F,0x8E,0x8D,
+            0x83,0x87,0x82,0x8A,0x97,0x8F,0x54,0x89,0x87,0x8A,0x87,0x8C,0x8C,0x84,0x7F,0x5A,
+            0x6D,0x7B,0x88,0x8C,0x8D,0x92,0x96,0x98,0x93,0x99,0x9B,0x9C,0x9C,0x9E,0xA1,0x81,
+            0x9A,0xA1,0xA2,0x9F,0xA1,0xA3,0xA3,0xA2,0xA2,0xA4,0xA5,0xA2,0xA4,0xA5,0xA2,0xA5,
+            0x9E,0xA5,0xA6,0xA6,0xA5,0xA4,0xA6,0xA6,0xA3,0x9B,0xA7,0xA9,0xA7,0xA4,0x9D,0xA3,
+            0xA2,0x93,0xA4,0xA3,0xA1,0xA4,0xA5,0xA7,0xA3,0x9C,0xA6,0xA3,0xA4,0xA3,0xA5,0xA6,
+            0x99,0x88,0x9F,0xA1,0x90,0x93,0xA2,0xA2,0x71,0x86,0xA0,0xA2,0x88,0x93,0x9D,0xA1,
+            0xA4,0xA3,0xA6,0xA5,0x9E,0xA5,0xA6,0xA6,0x9E,0xA4,0xA9,0x9F,0xA6,0xA7,0xAA,0x9F,
+            0xAA,0xA7,0xA0,0xA3,0xA1,0xA6,0x84,0xAB,0xA5,0xA7,0xA5,0xA9,0xA8,0xA7,0xA6,0xA7,
+            0xA7,0xA1,0xA5,0xA3,0x94,0x94,0xA3,0x96,0xA7,0x9D,0xA3,0xA8,0xA6,0xA2,0xA5,0xA5,
+            0x96,0x9B,0xA7,0x8D,0xA2,0x98,0xA7,0x9F,0xA3,0x89,0xA4,0x8F,0xA8,0x9B,0xA6,0xA6,
+            0xA1,0xA9,0xA9,0xA5,0xA3,0xA8,0xAB,0xA7,0xAB,0xA7,0xA9,0xA8,0xA8,0xA5,0xA9,0xA2,
+            0xA6,0xA6,0xA8,0xAB,0xA6,0xA6,0xA5,0xA1,0xA6,0xA6,0xA7,0xA9,0xA7,0xA8,0xA7,0xA9,
+            0xA7,0xAA,0xA8,0xA7,0xA5,0xA9,0xA6,0xA7,0x9E,0xA3,0x96,0xA5,0xA8,0xA5,0xA1,0xA2,
+            0x9C,0xA0,0xA8,0xA3,0x99,0x93,0xA2,0x9E,0xA7,0xA5,0xA5,0xAB,0xA8,0xA4,0xA6,0xA7,
+            0xA4,0xA4,0xA6,0xA5,0xA7,0xA5,0xA6,0xA6,0xA5,0xA6,0xA4,0xA7,0xA2,0xA7,0xA4,0xA3,
+            0xA3,0xA1,0xA5,0xA3,0xA3,0xA1,0xA5,0xA3,0x98,0x93,0xA3,0x96,0xA0,0xA0,0x9F,0x9F,
+            0x9A,0x9E,0x9B,0x94,0x9E,0x9C,0x97,0x97,0x95,0x96,0x94,0x93,0x8F,0x89,0x84,0x78,
+            0x6B,0x7D,0x85,0x86,0x88,0x92,0x90,0x8E,0x87,0x99,0x99,0x9A,0x92,0x9C,0x9C,0x81,
+            0x97,0x9E,0xA3,0x9E,0x91,0x9F,0x9C,0x9C,0x99,0xA4,0xA5,0xA3,0x9A,0xA6,0xA4,0xA3,
+            0x9D,0xA5,0xA9,0xA7,0x9E,0xA7,0xA6,0xA9,0xA2,0xA3,0xA7,0xA6,0x9A,0xA7,0xA5,0xA3,
+            0x9D,0x90,0x99,0x7F,0x9C,0xA8,0xA9,0xA6,0xA2,0x9E,0xA4,0xA6,0x9D,0xA4,0xA5,0xA9,
+            0x99,0x88,0x96,0x9D,0x8A,0x8D,0x94,0x96,0x6F,0x82,0x99,0x9D,0x80,0x8F,0x99,0x95,
+            0x91,0x9D,0xA6,0x9D,0x93,0x9B,0x9B,0x99,0x9C,0xA3,0xA7,0xA0,0xA1,0xA4,0xA4,0xA4,
+            0xA5,0xA8,0xA1,0xA3,0xA1,0xA6,0x87,0xA9,0xA5,0xA7,0xA4,0xA9,0x9E,0xA7,0xA5,0xA7,
+            0xA0,0xA5,0x99,0xA2,0x99,0x98,0xA5,0x96,0xA1,0xA7,0xA5,0xA8,0xA3,0xA1,0xA2,0xA6,
+            0x96,0x9F,0xAA,0x8D,0x92,0x96,0xA6,0x9F,0x9C,0x8F,0xA6,0x8D,0x94,0x97,0xA6,0xA5,
+            0x9D,0xA8,0xA5,0xA2,0x94,0xA5,0xA7,0xA4,0xA4,0xA5,0xA6,0xA9,0x9A,0xA3,0xA8,0xA4,
+            0xA6,0xA5,0xA5,0xA8,0xA0,0xA7,0xA9,0x9F,0xA4,0xA8,0xA6,0xAA,0x9A,0xA8,0xA7,0xA7,
+            0xA6,0xA8,0xAA,0xA9,0x9C,0xA6,0xA9,0xA6,0x9D,0x9C,0x9A,0xA4,0x9F,0xA4,0x9F,0x9A,
+            0x93,0x9F,0xA7,0xA8,0x9F,0xA0,0xA0,0x9A,0xA6,0x9B,0xA5,0xA7,0xA8,0xA3,0xA5,0xA5,
+            0xA0,0xA5,0xA1,0xA1,0xA5,0xA7,0xA8,0xA5,0xA4,0xA2,0xA5,0x9D,0xA5,0xA3,0xA5,0xA8,
+            0xA2,0xA0,0xA4,0xA4,0xA2,0xA2,0xA2,0xA5,0x91,0x91,0xA2,0x95,0xA0,0xA0,0xA0,0xA0,
+            0x9F,0x9E,0x96,0x96,0x9B,0x9C,0x90,0x98,0x97,0x93,0x93,0x92,0x8F,0x87,0x84,0x78,
+            0x67,0x70,0x7A,0x81,0x87,0x90,0x89,0x88,0x7F,0x8B,0x8B,0x91,0x98,0x9B,0x91,0x7B,
+            0x86,0x84,0x83,0x91,0x9A,0x9A,0x96,0x8E,0x8C,0x95,0x94,0x95,0x98,0xA4,0x97,0x92,
+            0x8E,0x9E,0x9E,0x9D,0x65,0x92,0x9E,0x9A,0x8A,0x97,0x98,0x91,0x95,0xA3,0x96,0x91,
+            0x85,0x8B,0x94,0x92,0x9C,0xA3,0x9A,0x8E,0x8C,0x8F,0x97,0x95,0x99,0xA1,0x9B,0x96,
+            0x83,0x82,0x98,0x9A,0x87,0x8E,0x8D,0x9E,0x72,0x81,0x92,0x9C,0x84,0x94,0x91,0xA3,
+            0x97,0x9D,0x92,0xA1,0xA3,0xA5,0x98,0x9D,0x9F,0xA2,0xA6,0x98,0xA5,0xA8,0xA7,0xA0,
+            0x9E,0xA8,0xA4,0xA5,0x9B,0xA3,0x83,0xA4,0xA1,0x9F,0xA3,0xA6,0xA6,0xA0,0xA6,0xA7,
+            0x9A,0x9B,0x9B,0x9F,0x99,0x9A,0x8C,0x8F,0x9F,0xA7,0xA4,0xA0,0xA3,0xA3,0x9A,0x9B,
+            0x87,0x8D,0x8A,0x85,0x93,0x80,0x88,0x8F,0x91,0x82,0x8D,0x85,0x98,0x8D,0x93,0x9B,
+            0x8C,0x90,0x97,0x9A,0x98,0x93,0x94,0x98,0x9B,0xA1,0xA2,0xA2,0x9F,0x99,0x9F,0xA1,
+            0xA0,0xA3,0xA6,0xA2,0xA6,0x9B,0xA8,0x9B,0x9B,0xA1,0xA3,0xA2,0xA4,0x95,0x8E,0xA1,
+            0x8E,0x93,0x97,0x98,0x98,0x94,0x91,0x91,0x94,0x99,0x93,0x9F,0x9B,0x87,0x94,0x99,
+            0x8F,0x88,0x8B,0x8D,0x94,0x7D,0x8B,0x89,0x8B,0x9F,0x89,0x9B,0xA2,0x88,0x98,0x97,
+            0x87,0x89,0x98,0x8E,0x9E,0x89,0x95,0x95,0x93,0x9E,0x9C,0xA4,0x9B,0x92,0x9C,0x9C,
+            0x95,0x9B,0xA0,0xA0,0xA0,0x91,0xA2,0x9D,0x86,0x8D,0x9C,0x91,0x99,0x8D,0x90,0x99,
+            0x8B,0x92,0x91,0x8B,0x97,0x8E,0x93,0x8F,0x8E,0x90,0x91,0x91,0x8D,0x85,0x81,0x77,
+            0x6C,0x79,0x82,0x85,0x86,0x89,0x8A,0x8B,0x88,0x88,0x8B,0x8A,0x8C,0x8C,0x8C,0x82,
+            0x8A,0x8A,0x8C,0x8D,0x8B,0x8D,0x8D,0x8D,0x8B,0x8A,0x8D,0x8D,0x8D,0x8D,0x8B,0x8D,
+            0x8B,0x8B,0x8C,0x8E,0x8D,0x8E,0x8E,0x8D,0x8D,0x8A,0x8D,0x8D,0x8D,0x8D,0x8D,0x8D,
+            0x8C,0x88,0x8C,0x8E,0x8E,0x8C,0x8E,0x8E,0x8B,0x89,0x8C,0x8E,0x8D,0x8C,0x8E,0x8D,
+            0x75,0x85,0x8C,0x8E,0x8C,0x8B,0x8C,0x8E,0x78,0x83,0x8C,0x8E,0x88,0x8B,0x8D,0x8C,
+            0x8D,0x8C,0x8C,0x8E,0x8D,0x8E,0x8D,0x8E,0x8D,0x8A,0x8E,0x8D,0x8E,0x8D,0x8E,0x8D,
+            0x8B,0x8A,0x8B,0x8D,0x8D,0x8C,0x88,0x8D,0x8C,0x89,0x8C,0x8D,0x8D,0x8D,0x8D,0x8C,
+            0x8C,0x8A,0x87,0x8E,0x8C,0x8C,0x8D,0x8C,0x8C,0x8A,0x8D,0x8E,0x8E,0x8D,0x8D,0x8D,
+            0x8B,0x8A,0x8C,0x88,0x8D,0x8B,0x8E,0x8E,0x8C,0x87,0x8D,0x8A,0x8E,0x8C,0x8D,0x8C,
+            0x8C,0x8B,0x8C,0x8E,0x8D,0x8D,0x8E,0x8E,0x8D,0x8A,0x8D,0x8D,0x8E,0x8D,0x8D,0x8D,
+            0x8C,0x8B,0x8C,0x8E,0x8D,0x8E,0x8E,0x8C,0x8C,0x8A,0x8D,0x8D,0x8E,0x8D,0x8D,0x8D,
+            0x8C,0x8B,0x8D,0x8E,0x8D,0x8E,0x8E,0x8D,0x8C,0x8A,0x8D,0x8E,0x8E,0x8D,0x8D,0x8C,
+            0x8C,0x8A,0x8C,0x8E,0x8D,0x8D,0x8D,0x8C,0x8C,0x89,0x8A,0x8D,0x8D,0x8D,0x8E,0x8D,
+            0x8C,0x8A,0x8C,0x8E,0x8C,0x8D,0x8F,0x8D,0x8C,0x8B,0x8C,0x8D,0x8D,0x8D,0x8E,0x8C,
+            0x8C,0x8B,0x8B,0x8D,0x8C,0x8C,0x8D,0x8E,0x8A,0x88,0x8C,0x8B,0x8D,0x8C,0x8C,0x8A,
+            0x8B,0x8A,0x89,0x8C,0x8B,0x83,0x8A,0x8A,0x8A,0x87,0x88,0x88,0x87,0x84,0x7B,0x78,
+            0x75,0x7D,0x87,0x8A,0x91,0x94,0x96,0x99,0x99,0x9B,0x9B,0x9E,0x9F,0x9F,0xA1,0x82,
+            0x9D,0xA2,0xA1,0xA1,0xA2,0xA3,0xA4,0xA4,0xA5,0xA5,0xA5,0xA3,0xA3,0xA3,0xA5,0xA5,
+            0xA2,0xA6,0xA7,0xA8,0xA3,0xA3,0xA9,0xA6,0xA5,0xA4,0xA9,0xA6,0xA7,0xA6,0xA4,0xA6,
+            0xA1,0x94,0xA3,0xA4,0x9C,0xA4,0xA3,0xA0,0xA2,0x9B,0xA9,0xA5,0xA3,0xA5,0xA9,0xA5,
+            0x9A,0x86,0xA5,0xA3,0x91,0x94,0xA8,0xA8,0x71,0x82,0xA2,0xA4,0x84,0x8E,0xA7,0xA5,
+            0xA4,0xA6,0xA7,0xA8,0xA5,0xA3,0xAA,0xA8,0xA8,0xA9,0xA7,0xA4,0xA9,0xAA,0xAA,0xA1,
+            0xA7,0xAA,0xA6,0xA9,0x9B,0xA5,0x84,0xA2,0xA6,0xA9,0xA6,0xAB,0xA9,0xA7,0xA8,0xAA,
+            0xA8,0xA9,0xA6,0xAA,0x9F,0x9E,0xA4,0xA0,0xA5,0xA9,0xAA,0xA9,0xAA,0xA8,0xA8,0xA6,
+            0x96,0x9D,0xA9,0x8D,0xA2,0x96,0xA7,0xA8,0xA5,0x8C,0xA7,0x90,0xA8,0x97,0xA9,0xA4,
+            0xA2,0xA8,0xA8,0xA8,0xA9,0xAA,0xA7,0xA9,0xA4,0xA7,0xA7,0xAA,0xAA,0xA6,0xAA,0xA7,
+            0xA6,0xA8,0xA6,0xA9,0xA7,0xA7,0xA7,0xA7,0xA5,0xAA,0xA6,0xA6,0xAB,0xAA,0xA8,0xA8,
+            0xA6,0xA8,0xA9,0xA6,0xA8,0xAA,0xA8,0xA8,0xA2,0x9D,0x9C,0xA3,0xA9,0xA2,0x9E,0x9C,
+            0x91,0x9A,0xA7,0xA6,0xA0,0x9B,0xA1,0xA0,0xA6,0x94,0xA5,0xA7,0xA9,0xA5,0xA7,0xA8,
+            0xA6,0xA3,0x97,0xA6,0xA6,0xA7,0xA5,0xA6,0xA5,0xA6,0xA3,0x98,0xA2,0xA4,0xA4,0xA6,
+            0xA4,0xA5,0xA4,0xA4,0x97,0xA4,0xA5,0xA2,0x90,0x90,0xA3,0x96,0xA1,0x9E,0x9E,0xA2,
+            0x9F,0x9F,0x98,0x94,0x9D,0x9E,0x97,0x98,0x98,0x95,0x93,0x92,0x90,0x8A,0x84,0x7A,
+            0x75,0x79,0x84,0x89,0x8F,0x93,0x94,0x98,0x8C,0x9B,0x9D,0x9C,0x9E,0x9E,0xA0,0x7D,
+            0x8C,0xA2,0xA1,0x86,0x9E,0xA6,0xA1,0xA3,0x9E,0xA5,0xA5,0xA4,0xA1,0xA6,0xA4,0xA4,
+            0x92,0xA7,0xA7,0xA7,0xA5,0xA7,0xA7,0xA8,0x9E,0xA4,0xA8,0xA8,0xA7,0xA7,0xA4,0xA5,
+            0x9B,0x89,0xA7,0xA5,0xA8,0xA9,0xA7,0xA3,0xA4,0x99,0xA8,0xA4,0xA3,0xA8,0xA9,0xA8,
+            0x97,0x87,0xA4,0xA8,0x91,0x96,0xA6,0xA7,0x6F,0x82,0xA1,0xA4,0x83,0x8D,0xA7,0xA5,
+            0x9C,0xA5,0xA8,0xA1,0xA4,0xA5,0xA6,0xA8,0xA5,0xA9,0xA9,0xA4,0xA9,0xA8,0xA9,0xA3,
+            0xA0,0xA7,0x80,0xA6,0x9A,0xA6,0x7D,0xA8,0xA9,0xAB,0xA5,0xAA,0xAA,0xA8,0xA8,0xA5,
+            0xA2,0xA5,0xA7,0xA5,0x98,0x99,0xA3,0xA0,0xA8,0xA9,0xA9,0xA9,0xA7,0xA1,0xA9,0xA9,
+            0x95,0xA1,0xA8,0x8D,0xA2,0x97,0xAB,0xA6,0xA0,0x8F,0xA6,0x8F,0xA9,0x92,0xA8,0xA8,
+            0x9E,0xAD,0xA8,0xA9,0xA7,0xA8,0xA7,0xAA,0xA5,0xA6,0xA9,0xA4,0xA6,0xA9,0x88,0xA7,
+            0xA3,0xA6,0xA9,0xA9,0xA6,0xA6,0xA7,0xA9,0xA2,0xA6,0xA7,0xA9,0xAA,0xA7,0xA8,0xA9,
+            0xA8,0xA9,0xA8,0xAB,0xA5,0xA9,0xA9,0xA8,0x9F,0xA1,0x9C,0xA6,0xA7,0xA4,0xA1,0x9C,
+            0xA3,0x9E,0xA8,0x93,0x98,0x89,0xA0,0x99,0xA7,0xA8,0xA5,0xA9,0xA9,0xA3,0xA7,0xA3,
+            0xA3,0xA5,0xA6,0xA5,0xA5,0xA6,0xA4,0xA7,0xA4,0xA4,0xA4,0xA5,0xA3,0xA6,0xA3,0xA5,
+            0xA1,0xA4,0xA4,0xA4,0xA3,0xA1,0xA4,0xA5,0x92,0x90,0xA4,0x97,0xA1,0xA0,0xA1,0x9F,
+            0x9C,0x9F,0x97,0x8C,0x9D,0x9D,0x98,0x95,0x97,0x94,0x93,0x93,0x8E,0x89,0x84,0x79,
+            0x61,0x65,0x6D,0x78,0x74,0x7E,0x82,0x89,0x7E,0x85,0x8B,0x7D,0x8A,0x92,0x8C,0x6C,
+            0x8D,0x92,0x89,0x96,0x92,0x9A,0x95,0x9A,0x98,0x98,0x96,0x9B,0x91,0x8B,0x97,0xA0,
+            0x90,0x94,0x9C,0x91,0x8E,0x8F,0xA0,0xA2,0x97,0x95,0x92,0x8E,0x92,0x9C,0x9A,0x92,
+            0x8A,0x6E,0x9A,0x99,0x97,0x9C,0x9F,0xA5,0x9B,0x87,0x9E,0x93,0x8E,0x8D,0x9D,0xA2,
+            0x7E,0x72,0x8B,0x97,0x73,0x7C,0x92,0x9A,0x56,0x6B,0x8F,0x95,0x66,0x77,0x99,0x9C,
+            0x90,0x99,0x99,0x99,0x96,0x9C,0x9C,0x9C,0x98,0x9B,0x9E,0x75,0x94,0x9C,0x9F,0x9A,
+            0xA0,0x9B,0x9D,0x9D,0x73,0xA2,0x74,0xA1,0x9F,0xA1,0x95,0xA2,0x91,0xA3,0x9F,0xA4,
+            0x9E,0xA5,0x97,0x96,0x84,0x86,0x9F,0x99,0x9B,0xA2,0x9F,0xA5,0x99,0x9D,0x8C,0x9F,
+            0x87,0x8D,0xA4,0x7C,0x89,0x80,0x9C,0x94,0x8E,0x75,0x9F,0x75,0x9F,0x8C,0x93,0xA0,
+            0x9D,0xA5,0xA5,0xA4,0xA2,0xA6,0xA7,0x9D,0xA3,0x8D,0xA5,0xA8,0xA2,0xA4,0xA6,0xA6,
+            0xA7,0xA5,0xA4,0xA5,0xA6,0x9F,0xA7,0x9A,0x9D,0xA3,0xA6,0xA5,0xA3,0xA8,0xA7,0xA4,
+            0x9F,0xA6,0xA5,0xA4,0xA3,0x9F,0xA4,0x9A,0x8C,0x8C,0x83,0x9F,0x9E,0x9C,0x83,0x94,
+            0x94,0x83,0x8A,0x86,0x8B,0x8A,0x87,0x85,0x90,0x9D,0x92,0x93,0x9E,0x9C,0x97,0x9D,
+            0x8D,0x90,0xA3,0x98,0x96,0x9E,0x92,0x9B,0x99,0x9B,0x9D,0x9B,0x8C,0x94,0x8F,0x9D,
+            0x99,0x9E,0xA0,0x9D,0xA0,0x9B,0x97,0xA2,0x6A,0x6F,0x9B,0x80,0x9C,0x9C,0x9C,0x98,
+            0x8F,0x97,0x87,0x80,0x9B,0x96,0x89,0x90,0x90,0x8F,0x8E,0x8C,0x83,0x82,0x7A,0x6C,
+            0x71,0x79,0x81,0x88,0x83,0x8A,0x8A,0x88,0x89,0x95,0x8D,0x95,0x8C,0x96,0x97,0x7F,
+            0x8E,0x97,0x9E,0x9A,0x8E,0x9B,0x91,0x96,0x8D,0x9C,0x99,0xA1,0x89,0x97,0x9D,0x9A,
+            0x98,0x9B,0x9F,0xA0,0x91,0x9D,0xA1,0x9F,0x90,0x9D,0x9A,0x9A,0x86,0x99,0x9C,0x9B,
+            0x88,0x8F,0x90,0x9A,0x8D,0x99,0xA5,0x99,0x93,0x96,0x9A,0x9B,0x8C,0x99,0x96,0xA2,
+            0x90,0x81,0x88,0x7F,0x77,0x7F,0x83,0x80,0x71,0x83,0x8F,0x93,0x7C,0x8B,0x93,0x8F,
+            0x88,0x8E,0x9E,0x92,0x83,0x91,0x92,0x8E,0x8C,0x98,0x96,0x9F,0x7E,0x87,0x96,0x90,
+            0x93,0x99,0x9A,0x94,0x84,0x8F,0x80,0x9A,0x8A,0x98,0x99,0x8D,0x7C,0x93,0x95,0x95,
+            0x87,0x94,0x91,0x8C,0x7D,0x89,0x95,0x88,0x8B,0x98,0x94,0x92,0x7E,0x8F,0x80,0x9C,
+            0x97,0x94,0x9A,0x83,0x82,0x82,0x94,0x88,0x93,0x8E,0x9A,0x8C,0x8F,0x8D,0x98,0x99,
+            0x95,0x9C,0xA1,0x95,0x91,0x92,0x9C,0x94,0x9D,0x99,0xA2,0xA5,0x8E,0x8C,0x9E,0x9F,
+            0x9B,0xA6,0xA5,0x9A,0x97,0x94,0xA4,0x9F,0x9C,0xA4,0xA0,0x91,0x8D,0x98,0x9F,0x9D,
+            0x99,0x9E,0x9F,0x94,0x8E,0x8F,0xA4,0x92,0x99,0x93,0x9A,0x98,0x90,0x90,0x9D,0xA1,
+            0x74,0x69,0x67,0x6D,0x73,0x6B,0x69,0x5E,0x66,0x81,0x6D,0x79,0x84,0x7A,0x73,0x76,
+            0x64,0x6C,0x7F,0x76,0x81,0x79,0x72,0x74,0x6F,0x79,0x7A,0x8A,0x75,0x6E,0x74,0x70,
+            0x75,0x83,0x82,0x76,0x9D,0x75,0x7B,0x75,0x6E,0x7B,0x79,0x6D,0x76,0x76,0x73,0x6D,
+            0x69,0x71,0x71,0x73,0x7B,0x73,0x82,0x6E,0x6D,0x77,0x73,0x73,0x7B,0x73,0x70,0x70,
+            0x70,0x7B,0x85,0x8A,0x8B,0x90,0x8E,0x94,0x8E,0x99,0x96,0x95,0x91,0xA0,0x9B,0x79,
+            0x98,0x9F,0x9D,0xA0,0x97,0xA0,0x97,0xA1,0x9E,0xA1,0x9E,0xA3,0x90,0xA4,0xA3,0xA3,
+            0x89,0x85,0x9E,0xA7,0x8B,0xA2,0xA5,0xA4,0x9F,0xA4,0xA0,0xA6,0x8F,0xA1,0xA0,0x9E,
+            0x98,0x96,0xA1,0xA5,0x9A,0xA2,0xA9,0xA6,0xA4,0x98,0x8E,0xA3,0x99,0xA0,0xA3,0xA4,
+            0x96,0x89,0x95,0xA1,0x8C,0x95,0x9B,0x9F,0x72,0x85,0x9E,0xA3,0x86,0x90,0x99,0xA1,
+            0x9A,0xA0,0x9E,0x9F,0xA0,0xA3,0xA2,0xA1,0x9A,0x9E,0xA7,0xA0,0x9B,0xA5,0xA7,0xA0,
+            0xA1,0xA7,0x98,0xA2,0x98,0xA8,0x86,0xA5,0xA5,0xAA,0xA5,0xA8,0x9B,0xA6,0xA4,0xA4,
+            0xA6,0xA4,0xA1,0xA2,0x93,0x91,0xA5,0x9C,0xA4,0xA9,0xA2,0xA6,0xA4,0xA3,0xA6,0xA6,
+            0x94,0x9A,0xA6,0x8D,0x99,0x9C,0xA5,0xA5,0xA1,0x90,0xA6,0x8E,0x98,0x9C,0xA7,0xA6,
+            0xA3,0xA5,0xA6,0xA5,0x94,0xA8,0xA6,0xA4,0xA6,0x9A,0xA8,0xA7,0xA2,0xA9,0xA6,0xA6,
+            0xA8,0xA4,0xA8,0xAB,0xA2,0xA8,0xA7,0xA3,0xA3,0xA8,0xA8,0xA8,0xA5,0xA4,0xA7,0xA8,
+            0xA5,0xA8,0xA7,0xA2,0x9F,0xA9,0xA7,0xA3,0xA1,0xA0,0x9A,0xA5,0x9D,0xA6,0x9F,0xA2,
+            0xA2,0xA2,0xA6,0xA3,0x9D,0x92,0x9F,0x8F,0xA6,0xA8,0xA4,0xA7,0xA1,0xA6,0xA8,0xA5,
+            0xA7,0xA6,0xA5,0xA4,0xA3,0xA3,0xA3,0xA6,0xA8,0xA2,0xA3,0xA4,0xA2,0xA4,0xA4,0x9F,
+            0xA4,0xA4,0xA1,0xA3,0xA2,0xA3,0xA5,0xA1,0x94,0x96,0xA4,0x99,0x9F,0x9F,0x9F,0x9E,
+            0x97,0x9E,0x9A,0x98,0x9B,0x9B,0x97,0x98,0x97,0x95,0x95,0x92,0x8F,0x8A,0x83,0x76,
+            0x6E,0x7B,0x80,0x8A,0x83,0x81,0x8B,0x91,0x8D,0x99,0x93,0x94,0x91,0x8E,0x9A,0x81,
+            0x8D,0x98,0x9F,0xA1,0x8E,0x92,0x9C,0x9E,0x95,0xA0,0x9C,0xA1,0x94,0x95,0x9F,0x9E,
+            0x97,0xA1,0xA0,0xA0,0x9D,0x9B,0xA3,0xA4,0x99,0x9F,0x9D,0x9D,0x96,0x93,0x9F,0x99,
+            0x92,0x8A,0x9A,0xA2,0x95,0x93,0xA5,0x9F,0x97,0x9E,0x9D,0x9F,0x92,0x91,0xA1,0xA5,
+            0x90,0x83,0x82,0x7E,0x6C,0x80,0x86,0x80,0x6B,0x80,0x91,0x8D,0x72,0x84,0x8C,0x8C,
+            0x86,0x92,0xA1,0x84,0x85,0x8D,0x8E,0x8B,0x8B,0x9A,0x99,0x9D,0x84,0x88,0x91,0x90,
+            0x94,0xA1,0x9E,0x93,0x8D,0x90,0x87,0x99,0x8B,0x9A,0x95,0x89,0x83,0x92,0x90,0x8F,
+            0x8B,0x97,0x94,0x88,0x81,0x87,0x95,0x88,0x90,0x9D,0x99,0x8E,0x84,0x90,0x93,0x9B,
+            0x95,0x90,0x90,0x7D,0x73,0x8A,0x92,0x8A,0x97,0x86,0xA0,0x86,0x83,0x8C,0x9C,0x99,
+            0x9B,0x93,0x9E,0x8D,0x85,0x97,0x98,0x93,0x9F,0x92,0xA6,0xA5,0x8D,0x92,0x9C,0x9B,
+            0xA1,0xA3,0xA6,0x97,0x9C,0x97,0xA2,0x9E,0x9C,0xA1,0xA3,0x8E,0x8C,0x9B,0x9E,0x9B,
+            0x9D,0xA0,0xA3,0x8E,0x8C,0x94,0xA0,0x91,0x98,0x89,0x8C,0x93,0x88,0x96,0x8B,0x9E,
+            0x9D,0x9B,0xA6,0x9E,0x9F,0x9E,0x9C,0x96,0x9E,0xA2,0xA3,0xA0,0xA4,0xA3,0xA6,0xA2,
+            0x96,0xA4,0xA3,0xA3,0xA3,0xA2,0xA2,0xA5,0x9F,0x9F,0xA2,0xA4,0xA2,0xA3,0x9F,0xA2,
+            0xA2,0x9F,0xA3,0xA0,0xA0,0x9F,0xA0,0x9F,0x7D,0x8E,0xA2,0x8F,0xA0,0xA0,0xA1,0xA1,
+            0x9C,0x9C,0x99,0x95,0x9B,0x9E,0x96,0x96,0x96,0x92,0x92,0x8F,0x8F,0x8A,0x82,0x76,
+            0x6E,0x6C,0x73,0x78,0x7C,0x83,0x81,0x82,0x7F,0x82,0x84,0x8C,0x8D,0x90,0x8A,0x7A,
+            0x81,0x84,0x88,0x8A,0x92,0x99,0x8E,0x91,0x8A,0x8F,0x95,0x8E,0x86,0x9D,0x92,0x8A,
+            0x82,0x99,0x93,0x94,0x5E,0x90,0x96,0x95,0x88,0x91,0x94,0x88,0x8E,0x92,0x8D,0x8C,
+            0x7F,0x88,0x8E,0x8E,0x92,0x9D,0x92,0x83,0x8A,0x8A,0x88,0x91,0x95,0x96,0x92,0x91,
+            0x7F,0x83,0x94,0x94,0x87,0x8C,0x98,0x8A,0x73,0x82,0x99,0x9F,0x83,0x90,0x99,0x8C,
+            0x92,0x9E,0x91,0x95,0x96,0x9D,0x9B,0x9D,0x9A,0x9F,0x9D,0x97,0x92,0xA0,0x9F,0x97,
+            0x92,0x9F,0xA2,0x99,0x99,0x9C,0x87,0x9F,0x9A,0x99,0x9F,0xA3,0x9D,0x9D,0x98,0x9F,
+            0x91,0x9F,0x99,0x97,0x94,0x93,0x87,0x7C,0x9B,0xA1,0x9A,0xA1,0xA1,0x9D,0x9E,0x94,
+            0x89,0x8A,0x8B,0x87,0x8E,0x72,0x93,0x86,0x94,0x7C,0x88,0x88,0x9D,0x8C,0x99,0x96,
+            0x8C,0x97,0x9B,0x99,0x9F,0x89,0x97,0x99,0x9F,0xA2,0xA5,0x99,0x97,0x99,0xA2,0xA1,
+            0x93,0xA5,0xA6,0xA1,0xA6,0x9D,0xA6,0xA0,0x98,0xA0,0xA6,0xA1,0xA3,0x98,0xA2,0xA2,
+            0x96,0x9A,0x97,0x9E,0x8E,0x95,0x9D,0x7F,0x8F,0x99,0x91,0x9F,0x9D,0x98,0x93,0x95,
+            0x8F,0x8A,0x8B,0x8D,0x94,0x85,0x8E,0x87,0x8C,0x9F,0x80,0x9B,0x9E,0x91,0x9A,0x98,
+            0x89,0x88,0x9C,0x90,0x9D,0x8E,0x95,0x95,0x8E,0x9B,0x9D,0xA0,0x9A,0x94,0x9E,0x98,
+            0x95,0x9F,0xA1,0x9E,0xA1,0x94,0x9E,0x9F,0x85,0x8C,0x9E,0x92,0x9A,0x90,0x9B,0x99,
+            0x8D,0x95,0x8E,0x8F,0x97,0x8F,0x93,0x8C,0x8D,0x8F,0x90,0x8F,0x8C,0x86,0x81,0x74,
+            0x67,0x77,0x7F,0x84,0x86,0x88,0x89,0x8B,0x89,0x89,0x8A,0x8B,0x8C,0x8D,0x8D,0x7F,
+            0x89,0x8B,0x8C,0x8E,0x8D,0x8C,0x8C,0x8E,0x8B,0x8B,0x8D,0x8F,0x8E,0x8D,0x8D,0x8E,
+            0x89,0x8C,0x8E,0x8F,0x8E,0x8C,0x8E,0x8E,0x8E,0x8B,0x8E,0x8D,0x8E,0x8E,0x8E,0x8E,
+            0x8C,0x8A,0x8E,0x8E,0x8F,0x8D,0x8E,0x8F,0x8C,0x8A,0x8E,0x8E,0x8E,0x8D,0x8E,0x8D,
+            0x74,0x86,0x8E,0x90,0x8C,0x8C,0x8C,0x8C,0x77,0x84,0x8F,0x8E,0x88,0x8B,0x8D,0x8D,
+            0x8C,0x8C,0x8E,0x8F,0x8F,0x8D,0x8E,0x8D,0x8E,0x8C,0x8E,0x8E,0x8E,0x8E,0x8F,0x8E,
+            0x8E,0x8B,0x8E,0x8E,0x8E,0x8D,0x89,0x8E,0x8E,0x8A,0x8E,0x8D,0x8F,0x8D,0x8E,0x8E,
+            0x89,0x8A,0x84,0x8E,0x8A,0x8A,0x8E,0x8D,0x8E,0x8C,0x8F,0x8F,0x8F,0x8E,0x8E,0x8D,
+            0x83,0x89,0x8E,0x88,0x8D,0x8C,0x8E,0x8D,0x8E,0x89,0x8D,0x8A,0x8E,0x8C,0x8E,0x8C,
+            0x8A,0x8B,0x8E,0x8E,0x8D,0x8C,0x8E,0x8D,0x8E,0x87,0x8E,0x8F,0x8E,0x8E,0x8E,0x8D,
+            0x89,0x8C,0x8E,0x8D,0x8F,0x8B,0x8E,0x8E,0x8F,0x8C,0x8E,0x8E,0x8F,0x8E,0x82,0x8E,
+            0x8A,0x8C,0x8F,0x8E,0x8E,0x8D,0x8E,0x8E,0x8D,0x8C,0x8E,0x8F,0x8E,0x8E,0x8E,0x8D,
+            0x87,0x8A,0x8E,0x84,0x8D,0x8D,0x8C,0x8D,0x8D,0x8A,0x8D,0x8F,0x8C,0x8D,0x8E,0x8E,
+            0x8B,0x8B,0x8E,0x8F,0x8E,0x8D,0x8E,0x8E,0x8D,0x8A,0x8D,0x8E,0x8E,0x8D,0x8D,0x8C,
+            0x87,0x89,0x8D,0x8F,0x8E,0x8C,0x8D,0x8D,0x8C,0x87,0x8D,0x8B,0x8D,0x8C,0x8C,0x89,
+            0x8A,0x8A,0x8C,0x8C,0x8B,0x7F,0x8B,0x8B,0x8A,0x85,0x88,0x89,0x87,0x83,0x77,0x6E,
+            0x6D,0x7A,0x83,0x8A,0x8E,0x90,0x92,0x96,0x92,0x98,0x98,0x98,0x9A,0x9E,0x9B,0x7D,
+            0x98,0x9D,0x99,0xA0,0x9F,0xA2,0xA1,0xA1,0xA1,0xA0,0x9C,0x9E,0xA1,0xA1,0xA4,0xA2,
+            0x9A,0xA2,0xA0,0xA5,0xA3,0xA4,0xA5,0xA6,0x9D,0xA4,0x9A,0xA5,0xA7,0xA2,0xA1,0x9C,
+            0x9D,0x93,0xA6,0xA5,0xA4,0xA5,0xA8,0xA7,0xA3,0x9A,0xA4,0xA5,0xA4,0xA5,0xA3,0xA6,
+            0x96,0x8A,0xA5,0xA2,0x91,0x95,0xA7,0xA7,0x70,0x81,0x9E,0xA2,0x83,0x8E,0xA6,0xA4,
+            0x98,0xA5,0xA8,0xA4,0xA6,0xA5,0xA6,0xA9,0xA7,0xA5,0xA5,0xA5,0xA7,0xA7,0xA9,0xA6,
+            0xA6,0xA7,0xA3,0xA7,0x9C,0xA7,0x87,0xA7,0xA6,0xA8,0xA7,0xA9,0xA7,0xA8,0xA7,0xA9,
+            0xA3,0xA5,0xA3,0xA8,0x8B,0x9B,0xA4,0x9D,0xA4,0xA8,0xA9,0xAC,0xA6,0xA6,0x96,0x91,
+            0x94,0xA2,0xA9,0x90,0xA2,0x9B,0xAA,0xA9,0xA0,0x8D,0xA6,0x8F,0xA4,0x9C,0xA9,0xA7,
+            0xA3,0xA7,0xAB,0xA8,0xAA,0xA8,0xA6,0xA9,0xA5,0x95,0xA8,0xA9,0xA8,0xA6,0xA7,0xA7,
+            0xA2,0xA7,0xA9,0xA8,0xAA,0xA6,0xA8,0xA3,0xA7,0xA8,0xAA,0xAC,0xA6,0xA8,0xA7,0xAA,
+            0xA8,0xA7,0xA4,0xAA,0xA6,0xAB,0xA8,0xA7,0xA0,0x84,0x98,0xA8,0xA6,0xA7,0x8F,0xA0,
+            0xA7,0x9D,0xA9,0x9D,0xA0,0x9C,0x9E,0x9C,0xA5,0xA8,0xA6,0xA7,0xA5,0xA7,0xA7,0xA8,
+            0xA5,0xA5,0xA6,0xA4,0xA5,0xA4,0xA6,0xA4,0xA5,0xA0,0xA5,0xA5,0xA4,0xA6,0xA4,0xA5,
+            0xA4,0xA2,0xA4,0xA6,0xA5,0xA5,0xA2,0xA4,0x85,0x92,0xA2,0x95,0xA2,0xA3,0xA0,0xA0,
+            0x95,0x9D,0x9B,0x97,0x9B,0x9C,0x97,0x99,0x96,0x93,0x92,0x92,0x8F,0x8A,0x83,0x78,
+            0x6C,0x79,0x84,0x8B,0x8D,0x90,0x90,0x95,0x94,0x87,0x99,0x98,0x90,0x9C,0xA0,0x7A,
+            0x9C,0x9F,0x9D,0xA2,0xA2,0xA4,0xA5,0xA1,0xA3,0xA3,0xA1,0xA3,0xA6,0xA6,0xA4,0xA4,
+            0xA0,0xA0,0xA0,0xA7,0xA5,0x9D,0xA4,0xA5,0x9E,0x95,0x95,0xA5,0xA4,0x9F,0xA1,0x9B,
+            0xA0,0x8F,0xA7,0xA0,0xA5,0xA6,0xA8,0xA9,0xA7,0x9C,0xA6,0xA4,0x99,0xA5,0xA6,0x9E,
+            0x8D,0x7F,0x91,0xA3,0x88,0x91,0xA3,0xA4,0x66,0x7A,0x9C,0x9F,0x7C,0x88,0xA4,0xA4,
+            0x99,0xA7,0xA5,0xA1,0xA8,0xA1,0xA6,0xA6,0xA7,0xA5,0xA4,0x9E,0xA8,0xA9,0xA9,0xA5,
+            0xA8,0xA8,0x97,0xA3,0x94,0xA5,0x84,0xA7,0xA5,0xA7,0xA3,0xA8,0xA8,0xA6,0xA9,0xA9,
+            0xA7,0xA7,0xA5,0xA4,0x8E,0x96,0x98,0x8C,0xA3,0xAA,0xA7,0xA6,0xA8,0xA4,0x9D,0x9B,
+            0x85,0x9A,0xA9,0x84,0x9E,0x99,0xA7,0xA8,0x9E,0x86,0xA9,0x8D,0xA4,0x91,0xA9,0xA4,
+            0xA3,0xA5,0xA5,0xA7,0xA9,0xA9,0xA7,0xA7,0xA7,0x95,0xA9,0xA9,0xA6,0xA9,0xAA,0xA8,
+            0xA6,0xA7,0xA7,0xA7,0xAB,0xA7,0xA9,0xA5,0xA0,0xA6,0xA9,0xAB,0xA7,0xA7,0xA8,0xA7,
+            0xA6,0xA8,0xAA,0xA4,0xA8,0xA9,0xA8,0xAA,0x9F,0x7D,0x8A,0xA5,0xAB,0xA6,0x8C,0xA2,
+            0x9E,0x8E,0xA6,0x9D,0x9F,0x91,0x9E,0x99,0xA5,0xA6,0xA5,0xA8,0xA5,0xAA,0xA8,0xA7,
+            0xA0,0xA0,0xA7,0xA5,0xA6,0xA5,0xA6,0xA5,0xA7,0xA5,0xA2,0xA5,0xA2,0xA5,0xA5,0xA4,
+            0xA0,0xA1,0xA4,0xA5,0xA5,0xA5,0xA4,0xA1,0x80,0x87,0xA3,0x8E,0xA3,0xA1,0xA0,0x9D,
+            0x99,0x9F,0x93,0x8C,0x9C,0x9F,0x97,0x97,0x97,0x94,0x93,0x93,0x8C,0x8A,0x82,0x75,
+            0x4E,0x60,0x62,0x74,0x6A,0x7F,0x7F,0x81,0x60,0x85,0x89,0x7A,0x76,0x8E,0x89,0x5C,
+            0x66,0x91,0x89,0x95,0x7F,0x94,0x96,0x90,0x6C,0x8F,0x99,0x95,0x86,0x91,0x98,0x90,
+            0x6B,0x8B,0x91,0x96,0x81,0x91,0x99,0x99,0x73,0x93,0x98,0x8B,0x85,0x90,0x93,0x94,
+            0x73,0x78,0x95,0xA2,0x88,0x9F,0x90,0x9C,0x70,0x8A,0x79,0x97,0x8B,0x98,0x9E,0x9D,
+            0x77,0x71,0x8C,0x95,0x75,0x7C,0x9C,0x9D,0x56,0x6C,0x8F,0x98,0x67,0x78,0x9A,0x9B,
+            0x74,0x96,0x92,0x9B,0x92,0x95,0x9C,0xA1,0x82,0x9E,0x9E,0x83,0x95,0x9F,0x95,0xA2,
+            0x7D,0x70,0x8A,0xA0,0x87,0x99,0x72,0x8B,0x7F,0x70,0x91,0x7A,0x91,0x97,0xA2,0xA3,
+            0x7F,0x8A,0x71,0x7C,0x79,0x77,0x8B,0x7C,0x86,0x9E,0xA1,0x97,0x99,0x92,0x9C,0x9A,
+            0x6C,0x90,0xA6,0x7E,0x6A,0x82,0x9D,0xA3,0x6D,0x76,0x89,0x78,0x9B,0x89,0xA3,0xA4,
+            0x97,0xA4,0xA0,0xAA,0x9B,0xA7,0xA4,0xA3,0x9B,0xA1,0xA3,0xA6,0x9C,0xA4,0xA4,0xA3,
+            0x98,0xA5,0xA2,0xA0,0x9D,0xA3,0xA7,0xA5,0x98,0xA4,0xA1,0xA8,0x9D,0xA5,0xA5,0xA3,
+            0x97,0xA4,0xA3,0xA4,0x9E,0x7F,0x93,0x96,0x8E,0x8A,0x82,0x9F,0x9E,0x9E,0x85,0x90,
+            0x7B,0x8D,0x9E,0x90,0x7D,0x79,0x88,0x83,0x96,0x9E,0x9C,0xA0,0x9C,0x9F,0xA1,0xA1,
+            0x85,0x9C,0x9F,0x97,0x9A,0x9E,0x9E,0x9F,0x90,0x92,0x9B,0x8B,0x96,0x98,0x96,0x9A,
+            0x87,0x9A,0x9C,0x8F,0x95,0x99,0x9C,0x9C,0x6B,0x77,0x7E,0x83,0x94,0x96,0x7D,0x89,
+            0x82,0x92,0x87,0x7A,0x8E,0x64,0x70,0x8E,0x7C,0x77,0x8A,0x86,0x7B,0x73,0x62,0x6A,
+            0x73,0x69,0x7F,0x7A,0x79,0x8C,0x88,0x8D,0x6C,0x70,0x90,0x86,0x7D,0x8E,0x99,0x46,
+            0x73,0x93,0x99,0x9D,0x8B,0x8E,0x9C,0x98,0x7B,0x90,0x9E,0x9A,0x8E,0x8A,0xA1,0x98,
+            0x79,0x77,0x96,0x87,0x8E,0x88,0xA1,0xA1,0x80,0x73,0x9B,0x84,0x8E,0x83,0xA5,0x9F,
+            0x7F,0x77,0x95,0x8C,0x95,0x83,0xA7,0xA3,0x7B,0x62,0x8B,0x75,0x92,0x7F,0xA6,0x9D,
+            0x88,0x8B,0x9C,0x9F,0x93,0x90,0xA6,0xA1,0x78,0x8A,0x9D,0xA1,0x8A,0x8E,0xA1,0xA5,
+            0x79,0x7F,0x7A,0x80,0x51,0x53,0x53,0x55,0x79,0x7C,0x7A,0x7F,0x4E,0x50,0x50,0x53,
+            0x88,0x9D,0x9C,0xA2,0x96,0x9B,0x8D,0xA5,0x8C,0x92,0xA5,0x9C,0x96,0x9B,0xA6,0xA7,
+            0x8C,0x97,0x76,0x8F,0x94,0x91,0xA7,0xA5,0x86,0x88,0x89,0x90,0x90,0x86,0x8D,0xA5,
+            0x5C,0x63,0xA9,0x51,0x97,0x93,0xA1,0x78,0x6A,0x4D,0x7E,0x51,0xA3,0x61,0xA8,0xA7,
+            0x96,0xA5,0xA7,0xA8,0xA4,0xA9,0xA7,0xA7,0x9E,0xA6,0xA7,0xA6,0xA4,0xA6,0xA9,0xA8,
+            0x97,0xA4,0xA6,0xA8,0xAB,0xA8,0xA8,0xA8,0xA0,0xA7,0xA5,0xA9,0xA8,0xA6,0xA6,0xA9,
+            0x91,0x98,0x9E,0xA0,0x8A,0x8C,0x89,0x89,0x5D,0x63,0x73,0x75,0x6C,0x6D,0x6E,0x6E,
+            0x7B,0x63,0xA9,0xA5,0x9F,0x9D,0x68,0x62,0x9E,0xA3,0xA5,0xA6,0xA2,0xA8,0xA6,0xA9,
+            0x89,0x7B,0xA3,0x73,0x9E,0xA4,0xA4,0xA3,0x9B,0xA5,0xA2,0x92,0x9E,0x9D,0xA3,0xA2,
+            0x8E,0xA3,0xA2,0xA4,0x9B,0xA3,0xA1,0xA4,0x8E,0x96,0x9F,0x9A,0x9B,0xA1,0xA0,0x9C,
+            0x85,0x9D,0x9C,0x99,0x95,0x9B,0x64,0x6F,0x84,0x92,0x94,0x91,0x82,0x87,0x7F,0x5E,
+            0x77,0x71,0x7D,0x82,0x75,0x8D,0x8E,0x8E,0x6D,0x92,0x97,0x94,0x7F,0x96,0x99,0x67,
+            0x74,0x9D,0x96,0x9F,0x89,0x98,0x9C,0x9B,0x7B,0x99,0xA0,0xA2,0x8F,0x9A,0xA0,0x9D,
+            0x79,0x95,0x9B,0x9C,0x8F,0x96,0x9C,0xA1,0x80,0xA0,0xA2,0x9F,0x90,0x94,0xA0,0x9E,
+            0x7E,0x91,0xA3,0x8F,0x90,0x85,0xA6,0xA6,0x85,0x97,0xA1,0x98,0x96,0x85,0xA4,0xA0,
+            0x86,0x8C,0x9C,0x9B,0x93,0x8B,0xA2,0xA2,0x78,0x8C,0x9C,0xA4,0x8B,0x94,0xA4,0xA0,
+            0x8C,0xA1,0xA2,0xA4,0x9D,0x9E,0xA7,0xA5,0x8F,0xA0,0xA4,0xA6,0x9C,0xA2,0xA6,0xA5,
+            0x8C,0xA2,0x9B,0xA7,0x9E,0x9E,0x8A,0xA8,0x93,0xA5,0xA5,0xA5,0x9F,0xA2,0xA7,0xA6,
+            0x89,0xA3,0xA5,0xA7,0x97,0x9A,0xA5,0xA5,0x96,0xA0,0xA6,0xA6,0xA3,0x8B,0xA6,0xA5,
+            0x82,0x9C,0xA5,0x83,0xA2,0xA0,0xA4,0x98,0x83,0x78,0x98,0x7A,0xA8,0x70,0xA8,0xA8,
+            0x9F,0xA7,0xA8,0xA8,0xAA,0xA2,0xA7,0xA9,0xA5,0xA8,0xA6,0xA8,0xA4,0xA5,0xA6,0xA4,
+            0x9E,0xA5,0xA8,0xA8,0xA4,0xA5,0xA8,0xA9,0xA4,0xA4,0xA5,0xA9,0xA6,0xA7,0xA4,0xA6,
+            0xA0,0xA8,0xA9,0xA8,0xA6,0xA7,0xA6,0xA9,0x9E,0xA2,0xA0,0xA8,0xA4,0xA7,0xA3,0xA0,
+            0x8F,0x86,0x81,0x96,0x91,0x90,0x7B,0x7F,0x8C,0x9E,0x8E,0x9A,0x9D,0x9C,0x95,0x94,
+            0x88,0x8B,0xA2,0x9B,0x9C,0x99,0x96,0x98,0x8E,0x95,0x8F,0x9E,0x9C,0x9E,0x9D,0x9D,
+            0x8B,0x97,0x9F,0xA2,0x9A,0x9B,0xA0,0xA0,0x87,0x8E,0x99,0x96,0x97,0x9A,0x9A,0x9A,
+            0x81,0x92,0x94,0x94,0x91,0x97,0x8F,0x91,0x7C,0x8D,0x8B,0x90,0x79,0x87,0x7E,0x73,
+            0x73,0x75,0x79,0x81,0x73,0x8C,0x8C,0x8C,0x60,0x90,0x92,0x95,0x79,0x95,0x97,0x73,
+            0x62,0x96,0x8F,0x9B,0x7C,0x94,0x9B,0x95,0x66,0x88,0x96,0x9E,0x80,0x92,0x9E,0x9E,
+            0x67,0x91,0x98,0x99,0x7E,0x9B,0x9D,0xA3,0x6D,0x98,0x92,0xA3,0x82,0x9B,0x9D,0xA1,
+            0x6C,0x92,0x99,0x9B,0x89,0x9D,0x9C,0xA4,0x6E,0x98,0x97,0x99,0x83,0x99,0xA4,0xA1,
+            0x71,0x8C,0x8F,0x9A,0x87,0x98,0xA0,0xA5,0x6F,0x8C,0x9A,0x9F,0x86,0x8F,0xA1,0x9C,
+            0x75,0x9F,0x9F,0x9F,0x8F,0x98,0xA3,0xA4,0x79,0xA0,0x9D,0xA3,0x92,0xA4,0xA4,0x9F,
+            0x77,0x96,0x9A,0xA6,0x93,0x96,0x8F,0xA8,0x7A,0xA1,0xA4,0xA8,0x92,0xA6,0xA9,0xA0,
+            0x7A,0xA3,0xA6,0xA4,0x92,0x9C,0xA6,0xA3,0x7A,0x91,0xA3,0x9A,0x93,0x84,0xA6,0xA8,
+            0x8A,0xA0,0xA6,0x8E,0xA2,0xA2,0xA4,0xA6,0x8E,0x7D,0x9F,0x81,0xA6,0x78,0xA6,0xA7,
+            0x9A,0xA5,0xA7,0xA9,0xA8,0xA7,0xA7,0xAB,0xA3,0xA8,0xA8,0xAA,0xAA,0xA4,0xA8,0xA4,
+            0x9E,0xA8,0xA6,0xAA,0xA6,0xA6,0xA8,0xA8,0xA0,0xA6,0xA7,0xA9,0xA6,0xAB,0xA8,0xA8,
+            0x9E,0xA7,0xAA,0xA6,0xA8,0xA8,0xA8,0xA6,0x9C,0xA4,0xA0,0xA5,0xA7,0xA5,0xA0,0xA0,
+            0x8F,0x8C,0x8E,0x96,0x9A,0x90,0x89,0x89,0x8A,0x99,0x97,0x9E,0xA0,0x9E,0x9D,0x9C,
+            0x89,0x8A,0x9F,0xA0,0xA0,0x9B,0x9A,0x9A,0x8E,0x98,0x9B,0xA3,0xA0,0x9E,0x9C,0x9F,
+            0x87,0x9F,0xA3,0xA3,0x9E,0x9C,0xA1,0xA1,0x87,0x95,0x9D,0x96,0x9A,0x9A,0x9D,0x9A,
+            0x84,0x7E,0x95,0x9A,0x96,0x94,0x93,0x94,0x7D,0x72,0x91,0x8E,0x7F,0x85,0x7D,0x75,
+            0x49,0x63,0x7B,0x78,0x84,0x80,0x82,0x83,0x7D,0x6A,0x87,0x87,0x8C,0x89,0x91,0x4D,
+            0x84,0x84,0x92,0x8E,0x8B,0x89,0x8B,0x8D,0x8C,0x93,0x96,0x9D,0x85,0x84,0x92,0x8E,
+            0x88,0x73,0x99,0x90,0x3A,0x8D,0x9B,0x9A,0x8C,0x6C,0x9D,0x87,0x90,0x89,0x93,0x91,
+            0x8A,0x75,0x93,0x86,0x8E,0x88,0x9C,0x8F,0x7D,0x61,0x8D,0x75,0x92,0x8B,0x91,0x9E,
+            0x8F,0x84,0x95,0x9D,0x84,0x88,0x9D,0x96,0x76,0x86,0x92,0xA4,0x84,0x90,0xA0,0x98,
+            0x91,0x96,0xA0,0xA0,0x93,0x99,0x9F,0x98,0x9B,0xA2,0xA6,0xA1,0x95,0xA0,0x96,0xA2,
+            0xA4,0xA6,0xA1,0xA9,0x9F,0xA1,0x84,0xA5,0xA4,0x94,0xA3,0x9D,0x9D,0x8D,0xA3,0xA4,
+            0xA0,0x9E,0xA3,0xA3,0x8B,0x96,0xA2,0x8F,0xA2,0xA2,0xA7,0xA6,0x91,0xA1,0xA3,0xA4,
+            0x92,0x90,0x95,0x85,0x8E,0x7A,0x86,0x76,0x68,0x49,0x83,0x51,0x8F,0x63,0x9A,0x9D,
+            0x90,0x9A,0xA2,0x96,0x87,0x8C,0x94,0x95,0x9C,0xA4,0xA2,0xA2,0x99,0x90,0xA3,0x9F,
+            0xA2,0xA2,0xA6,0xA3,0xA4,0x98,0xA5,0xA2,0x97,0xA2,0xA4,0x9C,0x99,0x90,0x9F,0xA3,
+            0x9C,0x9C,0x9A,0x9C,0x90,0x91,0xA3,0x9A,0x95,0x9A,0x99,0x93,0x93,0x90,0x9B,0xA0,
+            0x86,0x75,0x76,0x86,0x88,0x7D,0x7E,0x77,0x7A,0x95,0x89,0x91,0x93,0x8C,0x87,0x8A,
+            0x7D,0x82,0x97,0x88,0x8F,0x88,0x8C,0x86,0x7E,0x8F,0x92,0x9F,0x92,0x87,0x90,0x90,
+            0x8C,0x98,0x9A,0x99,0xA1,0x8E,0x99,0x98,0x7F,0x8B,0x90,0x8A,0x90,0x8B,0x90,0x90,
+            0x7E,0x89,0x88,0x89,0x90,0x88,0x92,0x8A,0x81,0x8A,0x88,0x89,0x87,0x83,0x7E,0x77,
+            0x57,0x6D,0x7D,0x81,0x71,0x8A,0x8C,0x8F,0x64,0x7C,0x94,0x91,0x7A,0x99,0x96,0x53,
+            0x66,0x99,0x92,0x9C,0x81,0x9F,0x9D,0x98,0x6E,0x78,0x99,0x9F,0x86,0x9F,0x9F,0xA0,
+            0x6D,0x81,0x9B,0x95,0x80,0x9E,0x9E,0xA3,0x74,0x7C,0xA1,0x8D,0x86,0x9E,0xA4,0xA4,
+            0x72,0x4F,0x9E,0x92,0x8D,0xA2,0x9F,0xA6,0x75,0x6C,0x97,0x81,0x89,0xA0,0xA5,0xA0,
+            0x6F,0x8D,0x8D,0x9C,0x8B,0x98,0x99,0xA6,0x72,0x8D,0x9A,0xA4,0x89,0x97,0x9C,0xA3,
+            0x7D,0x9E,0x9B,0x98,0x8F,0x98,0xA0,0xA0,0x81,0xA4,0xA2,0xA2,0x96,0xA6,0xA7,0x9D,
+            0x7E,0x95,0x96,0xA7,0x96,0x96,0x95,0xA6,0x80,0x95,0xA6,0x97,0x98,0xA4,0xA1,0xA4,
+            0x81,0xA5,0xA5,0xA7,0x93,0x9A,0xA5,0xA3,0x83,0xA3,0xA4,0xA7,0x98,0x9D,0xA4,0xA3,
+            0x79,0xA1,0xA7,0x96,0x66,0x59,0xA4,0xA4,0x78,0x5A,0x95,0x65,0x95,0x71,0xA7,0xA4,
+            0x77,0xA4,0xA6,0xA5,0x92,0xA5,0xA0,0xA4,0x7C,0xA7,0xA3,0xA6,0x8F,0xA5,0xA6,0xA3,
+            0x76,0xA9,0xA3,0xA5,0x92,0xA7,0xA7,0xA1,0x78,0xA6,0xA5,0xA6,0x90,0xA7,0xA3,0xA0,
+            0x74,0xA9,0xA6,0xA3,0x90,0xA5,0xA5,0xA6,0x77,0xA1,0x9A,0xA4,0x8F,0xA6,0xA1,0x9E,
+            0x73,0x7C,0x78,0x8C,0x89,0x8C,0x88,0x88,0x6E,0x95,0x87,0x96,0x8C,0x99,0x90,0x91,
+            0x7B,0x81,0x9B,0x99,0x96,0x9A,0x8E,0x91,0x7C,0x94,0x92,0x9F,0x95,0x9B,0x96,0x98,
+            0x80,0x99,0x96,0x9F,0x9A,0x9D,0x9E,0x9E,0x79,0x8F,0x91,0x95,0x92,0x9A,0x99,0x93,
+            0x7C,0x8D,0x8F,0x93,0x8F,0x8D,0x97,0x90,0x7A,0x8A,0x81,0x8B,0x80,0x86,0x7A,0x75,
+            0x75,0x72,0x7D,0x82,0x75,0x8D,0x8B,0x8E,0x66,0x91,0x94,0x93,0x7B,0x97,0x95,0x77,
+            0x69,0x99,0x93,0x9D,0x81,0xA0,0x9C,0x94,0x71,0x8B,0x9B,0xA1,0x88,0xA0,0xA2,0x9F,
+            0x6F,0x98,0x9E,0x9A,0x85,0xA0,0xA2,0xA0,0x77,0xA0,0xA1,0xA5,0x89,0x9E,0xA4,0xA2,
+            0x75,0x97,0xA1,0x93,0x8D,0xA4,0xA3,0xA5,0x7A,0x99,0x9E,0x9F,0x8D,0xA3,0xA4,0x9F,
+            0x7C,0x8E,0x98,0xA3,0x8B,0x99,0x9D,0xA6,0x77,0x8C,0x98,0xA3,0x8B,0x96,0xA0,0xA1,
+            0x7F,0xA1,0xA4,0xA4,0x8E,0x9C,0xA7,0xA3,0x84,0xA7,0xA4,0xA4,0x91,0xA9,0xA6,0xA3,
+            0x81,0x9D,0x94,0xA9,0x9B,0x9D,0x8C,0xA8,0x79,0xA2,0xA5,0xA9,0x9C,0xA8,0xA5,0xA4,
+            0x86,0xA5,0xA4,0xAA,0x99,0x9D,0xA3,0xA2,0x89,0xA4,0xA5,0xA4,0x9F,0x96,0xA3,0xA2,
+            0x8D,0xA1,0xA9,0x94,0x9F,0xA1,0xA9,0xA8,0x8F,0x87,0xA7,0x81,0xA2,0x80,0xA0,0xA5,
+            0x96,0xA7,0xA8,0xAA,0xA5,0xA8,0xAA,0xA7,0xA1,0xA7,0xA9,0xA8,0xA6,0xA9,0xA7,0xA5,
+            0xA0,0xA6,0xA6,0xAB,0xA6,0xA8,0xA7,0xA8,0x9F,0xA9,0xA7,0xAA,0xA2,0xA7,0xA6,0xA8,
+            0x99,0xA8,0xA9,0xA5,0xA6,0xA7,0xA9,0xA4,0x9D,0xA6,0xA1,0xA8,0xA5,0xA4,0xA3,0xA0,
+            0x92,0x94,0x92,0x97,0x9A,0x97,0x94,0x98,0x8D,0x9F,0x97,0xA0,0xA1,0xA2,0x9D,0xA0,
+            0x83,0x94,0x9F,0x90,0x94,0x8D,0x8E,0x95,0x92,0x9D,0x9B,0xA2,0x9A,0x9D,0x92,0xA0,
+            0x8C,0xA2,0x9F,0xA1,0x9D,0xA0,0xA0,0x9F,0x8A,0x9A,0x9F,0x9A,0x9A,0x9C,0x99,0x9B,
+            0x87,0x97,0x96,0x95,0x91,0x99,0x97,0x95,0x82,0x91,0x8F,0x90,0x83,0x87,0x7F,0x73,
+            0x77,0x75,0x7A,0x82,0x75,0x8D,0x8D,0x8C,0x61,0x91,0x91,0x96,0x78,0x98,0x95,0x7D,
+            0x66,0x98,0x91,0x9D,0x80,0x9E,0x9D,0x96,0x6D,0x8A,0x9C,0x9F,0x83,0xA0,0xA0,0x9D,
+            0x6C,0x9B,0x9D,0x9F,0x87,0xA2,0xA2,0xA0,0x73,0x9F,0xA0,0xA6,0x85,0xA3,0xA5,0x9F,
+            0x72,0x95,0x9C,0x9F,0x8E,0x99,0x9E,0xA3,0x76,0x9C,0x9D,0x9F,0x87,0x99,0xA6,0xA2,
+            0x79,0x8D,0x99,0xA0,0x8E,0x97,0xA1,0xA5,0x73,0x8C,0xA0,0xA1,0x8A,0x96,0x9F,0xA0,
+            0x7D,0xA2,0xA0,0xA2,0x94,0x98,0xA6,0xA4,0x7E,0xA5,0xA0,0xA1,0x98,0xA2,0xA7,0xA1,
+            0x7D,0x9C,0x9B,0xA2,0x98,0x9A,0x90,0xA1,0x7F,0xA4,0xA5,0xAA,0x95,0xA6,0xA6,0xA8,
+            0x7E,0xA4,0xA5,0xAA,0x97,0x9D,0xA2,0xA3,0x80,0xA4,0xA3,0xA6,0x99,0x94,0xA5,0xA8,
+            0x86,0xA2,0xA6,0x95,0x9C,0xA3,0xA7,0xA6,0x90,0x83,0xA8,0x89,0xA1,0x7F,0xA8,0xA7,
+            0x8B,0xA5,0xA7,0xA9,0xA5,0xA8,0xA9,0xA8,0x97,0xA6,0xA7,0xAA,0xA5,0xAA,0xAB,0xA4,
+            0x8C,0xA5,0xA7,0xA5,0xAA,0xAA,0xAA,0xA8,0x9D,0xA7,0xA9,0xA9,0xA6,0xA7,0xA6,0xAB,
+            0x93,0xA8,0xAA,0xA8,0xA8,0xAA,0xAB,0xA7,0x9D,0xA4,0xA2,0xA6,0xA8,0xA8,0xA2,0xA3,
+            0x8C,0x82,0x86,0x9B,0x98,0x95,0x8C,0x8F,0x88,0xA0,0x96,0x9E,0xA2,0x9E,0x97,0x9C,
+            0x8C,0x8E,0xA1,0x9B,0x9F,0x9B,0x98,0x9C,0x8E,0x99,0x89,0xA4,0x9C,0x9F,0xA1,0x9F,
+            0x88,0x99,0x9B,0xA3,0x9D,0x9E,0xA0,0xA3,0x89,0x91,0x95,0x99,0x9C,0x9E,0x99,0x9D,
+            0x82,0x94,0x92,0x94,0x93,0x9A,0x95,0x92,0x7E,0x8F,0x8F,0x90,0x80,0x88,0x80,0x75,
+            0x68,0x4F,0x70,0x65,0x70,0x6B,0x84,0x86,0x6C,0x60,0x86,0x83,0x7C,0x85,0x7B,0x4E,
+            0x6C,0x81,0x88,0x94,0x81,0x90,0x90,0x99,0x75,0x7D,0x8A,0x94,0x8D,0x7F,0x9B,0x99,
+            0x74,0x68,0x9D,0x79,0x8B,0x81,0xA0,0x9D,0x79,0x56,0xA2,0x59,0x91,0x8D,0xA1,0xA1,
+            0x7C,0x6B,0x9F,0x78,0x93,0x95,0x8A,0xA4,0x86,0x4A,0x99,0x5D,0x93,0x6E,0xA1,0x9F,
+            0x83,0x77,0x95,0x9A,0x79,0x81,0xA2,0xA3,0x5C,0x71,0x92,0x9C,0x6A,0x7C,0x9B,0xA0,
+            0x84,0xA3,0x9D,0x99,0x98,0x9B,0x98,0x9B,0x86,0x89,0x9A,0x77,0x9B,0xA3,0xA2,0xA3,
+            0x87,0x9F,0x98,0x55,0x76,0xA2,0x7B,0xA3,0x91,0x73,0x96,0x7B,0x9A,0xA1,0xA5,0x67,
+            0x8A,0xA1,0x93,0x93,0x89,0x88,0x9E,0x88,0x8B,0xA1,0xA8,0xA4,0x98,0xA2,0xA4,0x74,
+            0x8D,0x54,0xA6,0x3B,0x87,0x42,0xA8,0x8C,0x95,0x2F,0x9A,0x30,0xA6,0x36,0xA8,0xA7,
+            0x9B,0xA3,0xA5,0xA7,0xA6,0xA7,0xA6,0xA4,0x68,0x82,0xA4,0xA9,0xA1,0xA5,0xA6,0x9F,
+            0x9A,0xA5,0xA5,0xA6,0xA3,0x80,0x9B,0x9F,0x93,0x92,0xA7,0x72,0xA5,0xAA,0xA6,0xA8,
+            0x9E,0xA5,0xA7,0xA6,0xA5,0xA5,0xA7,0x9D,0x5F,0x69,0x6B,0x83,0x8E,0x83,0x76,0x7A,
+            0x91,0x49,0x88,0x87,0x92,0x92,0x86,0x4A,0x8F,0xA0,0x9B,0x9F,0xA2,0xA1,0x9C,0x9C,
+            0x8B,0x6B,0xA1,0x69,0x97,0x9F,0x9D,0x9C,0x92,0xA2,0x9E,0x9D,0x9E,0x9C,0x9C,0x9D,
+            0x8C,0x9D,0x9E,0x9D,0x9B,0x99,0x9D,0xA0,0x6C,0x7B,0x9B,0x87,0x9C,0x9E,0x9B,0x8A,
+            0x87,0x92,0x8B,0x82,0x91,0x8F,0x90,0x5A,0x83,0x8F,0x8B,0x8B,0x7E,0x82,0x7A,0x61,
+            0x76,0x61,0x83,0x73,0x84,0x90,0x94,0x96,0x7A,0x76,0x9C,0x8C,0x88,0x9B,0x98,0x5F,
+            0x7E,0x8C,0x9C,0x9F,0x93,0xA1,0x9D,0x9F,0x84,0x9F,0xA3,0xA2,0x97,0xA2,0xA4,0xA0,
+            0x84,0x7E,0xA0,0x86,0x98,0xA5,0xA6,0xA2,0x89,0x6B,0xA7,0x79,0x9F,0x9E,0xA6,0xA3,
+            0x8E,0x82,0xA5,0x89,0xA0,0xA3,0xA7,0xA6,0x95,0x58,0xA5,0x71,0x9F,0xA2,0xA5,0xA2,
+            0x90,0x8E,0x9E,0xA0,0x93,0x98,0xA6,0xA4,0x74,0x88,0x9B,0xA1,0x88,0x95,0x9C,0x9A,
+            0x90,0xA8,0xA1,0xA1,0x9E,0xA3,0xA5,0xA7,0x9A,0xA4,0xA7,0xA5,0xA5,0xAA,0xA9,0xA7,
+            0x94,0xA7,0x97,0x68,0xA4,0xA8,0x8A,0xA6,0x96,0x88,0xA8,0x88,0xA7,0xA3,0x9E,0xA0,
+            0x99,0xA8,0xA4,0xA7,0x9C,0xA1,0xA6,0xA5,0x99,0xAA,0xA8,0xA9,0xA5,0xA7,0xA8,0xA5,
+            0x8A,0x6C,0xA6,0x50,0x9F,0x90,0xA5,0xA2,0x98,0x42,0xA6,0x43,0x9F,0x52,0xA7,0xA6,
+            0x88,0xA4,0x86,0xA7,0xA9,0xA5,0xA6,0xA8,0x9D,0xA4,0xA5,0xA9,0xA8,0xA8,0xA5,0xA6,
+            0x96,0xA6,0xA9,0xA6,0xA3,0xA9,0xA7,0xA8,0xA1,0xA8,0xA8,0xA9,0xA8,0xA7,0xA8,0xA7,
+            0x9D,0xA8,0xA6,0xA6,0xA9,0xA7,0xA7,0xA2,0x7F,0x85,0x87,0x89,0x85,0x84,0x85,0x87,
+            0x91,0x5E,0x90,0x99,0x99,0x97,0x94,0x63,0x97,0xA5,0x9E,0xA2,0xA2,0xA3,0x9E,0xA1,
+            0x91,0x7A,0xA2,0x7E,0xA1,0xA1,0x9E,0x9E,0x97,0xA3,0xA1,0xA0,0xA2,0xA2,0xA0,0xA3,
+            0x93,0xA2,0xA1,0xA4,0x9F,0xA0,0x9F,0xA0,0x8F,0x97,0x9B,0x9B,0x9F,0xA1,0xA2,0x9C,
+            0x8D,0x9A,0x98,0x96,0x98,0x9B,0x96,0x6C,0x8C,0x93,0x92,0x91,0x8C,0x89,0x82,0x72,
+            0x77,0x70,0x7F,0x84,0x7E,0x90,0x91,0x91,0x77,0x96,0x98,0x98,0x88,0x9B,0x9C,0x85,
+            0x7A,0x9F,0x9D,0x9E,0x91,0x9F,0x9E,0x9F,0x82,0xA1,0xA0,0xA0,0x93,0xA1,0xA2,0x9F,
+            0x81,0x9C,0xA3,0xA0,0x97,0xA3,0xA2,0xA4,0x89,0xA7,0xA7,0xA5,0x8C,0xA2,0xA5,0xA2,
+            0x88,0x9A,0xA3,0xA0,0x9A,0xA4,0xA7,0xA6,0x8F,0x98,0xA4,0x9B,0x9E,0xA2,0xA2,0xA0,
+            0x8D,0x8B,0x9C,0xA5,0x93,0x99,0xA6,0xA6,0x7B,0x8D,0x9E,0xA5,0x8D,0x99,0xA5,0xA0,
+            0x92,0xA5,0xA6,0xA5,0xA1,0xA2,0xA6,0xA4,0x92,0xA1,0xA7,0xA3,0xA2,0xA7,0xAA,0xA8,
+            0x93,0xA7,0x83,0x89,0xA0,0xA5,0x85,0xA7,0x9D,0xA7,0xA6,0xAA,0xA3,0xA8,0xA5,0xA4,
+            0x96,0xA8,0xA6,0xA8,0xA1,0xA2,0xA4,0xA3,0x9B,0xA6,0xA8,0xA6,0xA4,0xA5,0xA5,0xA1,
+            0x9B,0x9F,0xA8,0x8C,0xA3,0xA3,0xA6,0xA7,0xA4,0x74,0xA5,0x6E,0xA6,0x64,0xA5,0xA7,
+            0xA0,0xA9,0xAA,0xA9,0x9A,0xAB,0xA4,0xA8,0xA5,0xA9,0xA4,0xAA,0xA5,0xA4,0xA6,0xA2,
+            0xA2,0xA4,0xA8,0xAA,0xA9,0xA7,0xAA,0xA6,0xA4,0xA6,0xA7,0xAA,0xAB,0xA8,0xA9,0xA8,
+            0xA4,0xAA,0xA8,0xA4,0xA4,0xA6,0xA5,0xA4,0x9E,0xA6,0x9F,0xA6,0xA9,0xA6,0xA3,0x9D,
+            0x9C,0xA5,0xA7,0xA4,0x97,0x92,0xA1,0x8C,0xA2,0xA9,0xA6,0xA7,0xA4,0xA4,0xA5,0xA4,
+            0x97,0xA7,0xA4,0xA4,0xA2,0xA5,0xA6,0xA5,0x9D,0xA4,0xA0,0xA4,0x9E,0xA5,0xA4,0xA4,
+            0x94,0xA4,0xA1,0xA2,0xA0,0xA1,0xA1,0xA3,0x8B,0x9A,0xA0,0x9B,0x9D,0xA0,0xA1,0xA0,
+            0x8C,0x9B,0x9C,0x8D,0x96,0x9D,0x97,0x92,0x89,0x94,0x93,0x91,0x88,0x89,0x82,0x74,
+            0x77,0x76,0x82,0x87,0x80,0x92,0x90,0x94,0x72,0x95,0x89,0x9A,0x82,0x9B,0x9B,0x89,
+            0x71,0x9E,0x99,0x9F,0x8B,0xA2,0x9F,0xA1,0x79,0x9A,0xA0,0xA2,0x90,0x9E,0xA2,0xA1,
+            0x7C,0xA3,0xA2,0xA2,0x93,0xA5,0xA4,0xA5,0x80,0xA4,0xA4,0xA6,0x92,0x9D,0xA7,0xA5,
+            0x7C,0x98,0xA4,0xA3,0x94,0xA7,0xA4,0xA6,0x83,0x9E,0xA3,0x9D,0x96,0xA4,0xA7,0xA3,
+            0x87,0x91,0x9A,0xA1,0x93,0x9A,0xA4,0xAA,0x7C,0x8D,0xA3,0xA2,0x8E,0x9A,0xA4,0xA7,
+            0x8A,0xA6,0xA7,0xA0,0x98,0x9B,0xA5,0xA7,0x8D,0x9C,0xA5,0xA6,0xA1,0xA8,0xA9,0xA4,
+            0x8D,0xA8,0xA7,0x99,0x9E,0xA5,0x96,0xA8,0x8E,0xA6,0xA7,0xA8,0xA1,0xA7,0xA9,0xA7,
+            0x8F,0xA8,0xA6,0xA5,0x9E,0xA2,0xA0,0xA0,0x8C,0xA5,0xAA,0xA9,0x9F,0xA2,0xA7,0xA5,
+            0x9E,0xA4,0xA7,0x90,0xA3,0xA2,0xA7,0xA7,0xA2,0x7E,0xAA,0x77,0xA6,0x69,0xA8,0xA9,
+            0x9F,0xA7,0xA8,0xA8,0xA9,0xA8,0xA8,0xA9,0xA6,0xA7,0xA0,0xA7,0xA6,0xA8,0xA5,0xA9,
+            0xA1,0xA4,0xA7,0xA6,0xA6,0xA7,0xA8,0xAB,0xA5,0xAA,0xAA,0xA9,0xA0,0xA8,0xA6,0xA9,
+            0xA6,0xA6,0xA9,0xAA,0xA5,0xAA,0xA7,0xA3,0xA0,0xA5,0xA3,0xA7,0xA7,0xA7,0xA1,0xA5,
+            0x9B,0xA2,0xA6,0xA5,0x99,0xA4,0xA1,0x94,0xA2,0xA6,0xA5,0xA7,0xA4,0xA5,0xA7,0xA6,
+            0x9C,0xA5,0xA6,0xA7,0xA3,0xA7,0xA5,0xA7,0xA0,0xA4,0xA1,0xA6,0xA3,0xA7,0xA3,0xA4,
+            0x96,0xA5,0xA3,0xA6,0x9F,0x9F,0xA2,0xA2,0x96,0x9C,0xA1,0x9D,0xA0,0xA2,0xA1,0xA1,
+            0x91,0x9C,0x9C,0x9A,0x98,0x9E,0x99,0x98,0x8C,0x95,0x92,0x90,0x8C,0x88,0x82,0x77,
+            0x75,0x59,0x7F,0x76,0x87,0x82,0x87,0x8A,0x88,0x6F,0x8C,0x8D,0x96,0x91,0x90,0x64,
+            0x85,0x89,0x97,0x8B,0x91,0x89,0x8F,0x8F,0x96,0x95,0x9E,0x9E,0x9D,0x93,0x9C,0x9A,
+            0x9C,0x71,0xA0,0x8F,0x47,0x9A,0x99,0xA2,0x98,0x64,0x9E,0x80,0x9D,0x94,0x9E,0x9B,
+            0x8F,0x7A,0x9A,0x8C,0x9B,0x94,0xA1,0x90,0x8B,0x56,0x9E,0x73,0x96,0x93,0x9E,0xA3,
+            0x93,0x84,0x9A,0x9D,0x88,0x8D,0x97,0xA2,0x78,0x86,0x99,0xA8,0x84,0x94,0xA9,0x9F,
+            0x9B,0x9E,0x9F,0x9C,0x94,0x9C,0xA3,0x9F,0x98,0xA5,0xA7,0xA4,0xA0,0xA8,0xA8,0xA4,
+            0xA5,0xA5,0xA9,0x6B,0xA0,0xA6,0x8F,0xA9,0xA7,0x8E,0xA1,0x8D,0xA3,0x9C,0xA2,0xA5,
+            0xA1,0xA4,0xA4,0xA3,0x95,0x9A,0xA6,0x97,0xA3,0xA8,0xA8,0xA9,0x90,0xA7,0xA4,0xA7,
+            0x95,0x9B,0x99,0x8B,0x96,0x80,0x8C,0x7F,0x98,0x37,0xA1,0x44,0x9A,0x48,0x9E,0xA0,
+            0x9A,0x9E,0xA1,0x9C,0x96,0x94,0xA0,0x9C,0xA3,0xA4,0xA5,0xA2,0x9D,0x9D,0xA4,0xA5,
+            0xA5,0xA6,0xA7,0xA7,0xA8,0xA0,0xA8,0xA8,0xA0,0xA9,0xA8,0x9F,0xA1,0x9F,0x8D,0xA5,
+            0xA1,0xA2,0x99,0x9F,0x96,0x9B,0xA3,0xA1,0x9C,0xA1,0x9C,0x9F,0x9A,0x9A,0x9C,0xA1,
+            0x97,0x89,0x89,0x92,0x95,0x8A,0x87,0x85,0x90,0x9E,0x93,0x97,0x9F,0x93,0x97,0x97,
+            0x8E,0x90,0x9E,0x8E,0x95,0x8B,0x93,0x92,0x97,0x9D,0x9B,0xA4,0x9D,0x97,0x9E,0x9C,
+            0x9E,0x9F,0xA1,0xA3,0xA5,0x9A,0xA0,0xA0,0x8B,0x8F,0x9D,0x8F,0x9C,0x99,0x8E,0x9A,
+            0x92,0x95,0x94,0x90,0x97,0x91,0x97,0x90,0x91,0x93,0x91,0x8F,0x8B,0x87,0x81,0x78,
+            0x6A,0x65,0x81,0x7E,0x82,0x91,0x93,0x94,0x75,0x81,0x98,0x94,0x88,0x9E,0x9D,0x73,
+            0x75,0x98,0x9A,0xA1,0x90,0xA3,0xA1,0xA1,0x7D,0x94,0xA0,0xA6,0x94,0xA4,0xA3,0xA5,
+            0x7F,0x85,0xA3,0x96,0x96,0xA6,0xA7,0xA5,0x85,0x74,0xA8,0x8C,0x92,0x95,0xA7,0xA5,
+            0x7F,0x83,0xA5,0xA3,0x98,0xA9,0xA3,0xA7,0x83,0x62,0xA3,0x81,0x96,0x9F,0xA6,0xA6,
+            0x75,0x91,0x9D,0xA3,0x93,0x97,0x9E,0xA7,0x78,0x8F,0xA7,0xA4,0x8F,0x98,0xA6,0xA3,
+            0x8C,0xA7,0xA5,0xA1,0x99,0x9B,0xA7,0xA6,0x90,0xA7,0xA3,0xA5,0x9F,0xA4,0xA9,0xA4,
+            0x8F,0x9F,0x9F,0x71,0xA4,0xA6,0x96,0xA9,0x93,0x8B,0xA6,0x97,0x9F,0xA3,0xA8,0xA5,
+            0x92,0xAB,0xA4,0xA8,0x9E,0xA4,0xA5,0xA8,0x93,0xA7,0xA9,0xAB,0xA4,0xA6,0xAA,0xA9,
+            0x88,0xA4,0xA7,0x97,0x9E,0x53,0xA9,0xA2,0x8A,0x52,0xA6,0x58,0xA0,0x60,0xA9,0xA3,
+            0x85,0xA8,0xA5,0xAA,0xA1,0xA5,0xA4,0xA9,0x89,0xAA,0xA7,0xAA,0x98,0xAB,0xA8,0xA7,
+            0x85,0xA4,0xA3,0xA4,0x9D,0xA8,0xA8,0xA6,0x84,0xA9,0xA7,0xA8,0x91,0xA7,0xA7,0xA7,
+            0x83,0xA7,0xA4,0xA6,0x9C,0xA9,0xA4,0xA8,0x81,0xA7,0xA2,0xA9,0x9B,0xA8,0xA3,0xA3,
+            0x83,0x9A,0x96,0x9C,0x99,0xA0,0x95,0x9B,0x82,0xA5,0x9D,0xA0,0x99,0xA2,0x9E,0xA0,
+            0x8D,0xA0,0xA3,0xA4,0x9C,0xA4,0xA2,0xA3,0x8E,0xA3,0x9E,0xA4,0x9E,0xA3,0xA1,0xA1,
+            0x8F,0xA4,0x9E,0xA2,0xA1,0xA1,0xA2,0xA3,0x8A,0x99,0x9F,0x9A,0x9C,0xA0,0x9F,0x9A,
+            0x8F,0x9C,0x9B,0x9A,0x97,0x8B,0x99,0x97,0x8D,0x95,0x91,0x92,0x8D,0x89,0x81,0x78,
+            0x79,0x76,0x81,0x84,0x7B,0x8F,0x8E,0x93,0x74,0x96,0x97,0x99,0x88,0x9C,0x9B,0x85,
+            0x71,0x9E,0x99,0xA0,0x8A,0xA2,0xA1,0x9B,0x7D,0x9F,0xA2,0x9B,0x92,0xA3,0xA5,0x9F,
+            0x7D,0xA1,0xA2,0xA2,0x96,0xA4,0xA4,0xA6,0x84,0xA4,0xA7,0xA7,0x95,0x99,0xA7,0xA5,
+            0x83,0x9B,0xA4,0xA1,0x9A,0xA7,0xA5,0xA6,0x8A,0x9D,0xA6,0xA3,0x99,0xA4,0xA8,0xA3,
+            0x89,0x8D,0xA2,0xA2,0x90,0x95,0xA2,0xA2,0x7C,0x8D,0xA0,0xA1,0x8F,0x98,0xA4,0x9F,
+            0x8F,0xA6,0xA8,0xA2,0x9B,0x9D,0xA8,0xA3,0x90,0xA9,0xA9,0xA2,0xA0,0xA7,0xA8,0xA4,
+            0x91,0xA2,0x99,0x9F,0xA4,0xA6,0x78,0xA3,0x91,0xA1,0xA5,0xA9,0x9E,0xA6,0xA8,0xA1,
+            0x94,0xA8,0xA7,0xA7,0x9B,0xA0,0xA7,0xA4,0x94,0xA9,0xA8,0xA8,0xA3,0xA6,0xA7,0xA5,
+            0x8E,0xA2,0xA7,0x97,0x9B,0xA0,0x9F,0xA6,0x99,0x7C,0xA9,0x7D,0xA4,0x6F,0xA6,0xA8,
+            0x92,0xA8,0xA6,0xA7,0xA8,0xA7,0xA7,0xA9,0xA0,0xA7,0xAA,0xA9,0xA8,0xA9,0xA8,0xA7,
+            0x91,0xA5,0xA6,0xA7,0xA7,0xA9,0xA9,0xAA,0xA4,0xA9,0xA9,0xAA,0xAB,0xA8,0xA8,0xA8,
+            0x9B,0xA9,0xA6,0xA7,0xA7,0xA9,0xA5,0xAA,0x9E,0xA4,0x9E,0xA8,0xA7,0xA6,0xA2,0xA3,
+            0x95,0x91,0x8C,0x9B,0x93,0x8E,0x95,0x9A,0x97,0x9F,0x9A,0xA0,0xA2,0xA3,0x9F,0x9F,
+            0x8E,0x97,0xA0,0xA0,0xA1,0xA1,0x9A,0x9E,0x9A,0x9F,0x9E,0xA5,0xA1,0xA2,0xA2,0xA1,
+            0x93,0xA2,0xA2,0xA2,0xA2,0xA1,0xA3,0xA1,0x90,0x99,0x9E,0x9C,0x94,0x9F,0x9F,0xA0,
+            0x8B,0x98,0x93,0x93,0x94,0x9B,0x96,0x97,0x8B,0x95,0x93,0x91,0x8A,0x88,0x82,0x76,
+            0x74,0x75,0x7F,0x83,0x81,0x8A,0x91,0x93,0x72,0x93,0x95,0x9A,0x88,0x9D,0x9C,0x88,
+            0x72,0x99,0x9A,0xA0,0x8E,0xA3,0xA3,0x9D,0x7B,0x9B,0xA1,0xA4,0x91,0xA3,0xA3,0xA0,
+            0x7E,0x9E,0xA1,0xA5,0x99,0xA6,0xA6,0xA6,0x82,0x9F,0xA5,0xA5,0x94,0x9F,0xA4,0xA5,
+            0x81,0x9A,0xA7,0xA6,0x9B,0xA5,0xA6,0xAB,0x89,0x9E,0xA5,0xA4,0x9A,0xA7,0xA9,0xA4,
+            0x8A,0x8F,0xA1,0xA0,0x95,0x9D,0xA7,0xA5,0x7C,0x8E,0x9A,0xA5,0x90,0x95,0x9F,0xA3,
+            0x86,0xA6,0x9D,0x9F,0x9A,0x9F,0xA9,0xA6,0x92,0xAA,0xA5,0xA2,0xA1,0xA7,0xA8,0xA4,
+            0x8D,0xA8,0x98,0x9A,0x9F,0xA8,0x93,0xA8,0x93,0xA1,0xA6,0xA8,0x9E,0xA7,0xA6,0xAE,
+            0x90,0xAC,0xA7,0xAA,0x9D,0x9F,0xA6,0xA1,0x92,0xAB,0xA6,0xAA,0xA3,0xA7,0xA4,0xA6,
+            0x9A,0xA1,0xA6,0x99,0xA1,0xA1,0xA3,0xA5,0x99,0x8C,0xA8,0x86,0xA5,0x72,0xA7,0xA9,
+            0x96,0xA8,0xA7,0xA9,0xA5,0xA5,0xA4,0xAA,0xA7,0xAB,0xA8,0xA8,0xA8,0xA7,0xA5,0xA6,
+            0xA1,0xA7,0xA5,0xA7,0xA7,0xA6,0xA8,0xA9,0xA6,0xA7,0xA9,0xAA,0xA8,0xA7,0xA9,0xA9,
+            0x98,0xA8,0xA8,0xA4,0xA6,0xA9,0xA9,0xA9,0x9F,0xA6,0xA3,0xA7,0xA8,0xA8,0xA3,0xA4,
+            0x95,0x8D,0x88,0x9B,0x96,0x95,0x91,0x95,0x93,0xA2,0x99,0x9E,0xA1,0x9F,0x9B,0x9B,
+            0x8A,0x90,0x9F,0xA0,0xA3,0xA0,0x97,0x9B,0x95,0xA1,0x9D,0xA5,0x9E,0xA2,0xA3,0xA2,
+            0x95,0xA1,0xA0,0xA3,0x9E,0xA3,0xA5,0xA4,0x90,0x9A,0x9A,0x8D,0x9D,0xA1,0x9F,0x9E,
+            0x8C,0x96,0x96,0x98,0x96,0x99,0x99,0x95,0x88,0x94,0x90,0x90,0x8C,0x8A,0x81,0x75,
+            0x68,0x60,0x6C,0x73,0x70,0x7A,0x81,0x87,0x64,0x84,0x8B,0x8C,0x7D,0x95,0x8C,0x67,
+            0x66,0x93,0x8F,0x94,0x84,0x95,0x93,0x96,0x6D,0x9E,0x98,0x97,0x8A,0x9D,0x9B,0x97,
+            0x6F,0x96,0x9B,0x9A,0x87,0x98,0xA2,0x9B,0x74,0x95,0x9F,0xA2,0x8F,0x95,0xA0,0x95,
+            0x76,0x75,0x97,0x9E,0x92,0xA2,0xA3,0xA0,0x7C,0x92,0x9D,0x99,0x92,0x9E,0xA2,0x9A,
+            0x7B,0x6E,0x97,0x9B,0x74,0x7D,0x9E,0x9F,0x57,0x6B,0x95,0x9B,0x66,0x7C,0x9C,0x9E,
+            0x7E,0x94,0x90,0x90,0x93,0x8E,0x96,0x96,0x86,0x9D,0xA1,0x86,0x9A,0xA2,0xA4,0x9E,
+            0x81,0x9E,0xA3,0xA3,0x89,0xA2,0x74,0xA6,0x84,0xA4,0x83,0xA6,0x9F,0xA6,0xA4,0x9F,
+            0x84,0xA6,0x9C,0x9B,0x87,0x86,0xA4,0x9E,0x84,0xA2,0xA5,0xA7,0x9F,0xA4,0xA4,0x9F,
+            0x87,0x94,0xA8,0x7D,0x92,0x86,0xA7,0xA4,0x93,0x79,0x9D,0x72,0xA6,0x91,0xA6,0xA6,
+            0x9C,0xA6,0xA2,0xA9,0xA5,0xA8,0xA5,0xA6,0xA4,0xA2,0xA7,0xA9,0xA2,0xA5,0xA4,0x9C,
+            0x9D,0xA6,0xA7,0x9E,0xA3,0xA5,0xA7,0xA5,0x9D,0xA0,0xA7,0xA5,0xA5,0xA2,0xA6,0xA5,
+            0x9D,0xA6,0xA5,0xA0,0xA0,0x96,0xA5,0xA5,0x93,0x88,0x82,0xA1,0xA5,0x9F,0x89,0x8C,
+            0x96,0x93,0xA5,0x98,0x82,0x86,0x8A,0x85,0x9E,0x9A,0xA2,0xA3,0xA3,0xA4,0xA3,0xA1,
+            0x8F,0xA3,0xA5,0xA0,0xA0,0xA2,0xA2,0xA2,0x99,0x95,0xA2,0x98,0x9C,0x9F,0x9C,0x9F,
+            0x92,0xA0,0x9F,0xA1,0x9C,0xA0,0x9F,0xA1,0x6C,0x7A,0x9D,0x87,0x9A,0x9C,0x9C,0x9A,
+            0x8A,0x94,0x88,0x7C,0x91,0x95,0x8E,0x8C,0x7C,0x8E,0x89,0x85,0x78,0x7F,0x75,0x65,
+            0x76,0x72,0x80,0x84,0x80,0x89,0x8F,0x92,0x76,0x96,0x95,0x9A,0x8B,0x99,0x9C,0x8B,
+            0x7B,0x9F,0x9E,0xA0,0x92,0x96,0x9B,0xA0,0x84,0xA0,0xA4,0xA2,0x98,0xA0,0xA4,0x9F,
+            0x82,0x9F,0x9C,0xA2,0x97,0xA3,0xA3,0xA5,0x89,0xA5,0xA4,0xA5,0x9B,0x9F,0xA4,0xA3,
+            0x8A,0x90,0xA5,0xA5,0x9B,0xA2,0xA8,0xA6,0x93,0xA4,0xA7,0xA7,0xA0,0xA1,0xA6,0xA2,
+            0x8F,0x86,0xA8,0xA4,0x8D,0x8F,0xA6,0xA6,0x76,0x87,0xA2,0xA3,0x85,0x8E,0xA7,0xA3,
+            0x90,0xA0,0x9F,0x99,0xA6,0x9F,0xA3,0xA3,0x9A,0xA5,0xA5,0xA2,0xA3,0xA6,0xA7,0xA7,
+            0x92,0xA5,0x9E,0xA5,0xA4,0xA9,0x92,0xAA,0x99,0xAA,0x9D,0xA8,0xA2,0xA7,0xA7,0xAA,
+            0x99,0xAC,0xA7,0xA8,0xA1,0xA2,0xAA,0xA1,0x99,0xAA,0xA5,0xA7,0x97,0xA4,0xA5,0xA7,
+            0x99,0xA2,0xA5,0x98,0x9D,0x9F,0xA9,0xA4,0x9B,0x90,0xA7,0x8C,0xA3,0x9A,0xA8,0xA7,
+            0x91,0xA8,0xA6,0xA8,0xA7,0xA1,0xA4,0xAA,0xA2,0xA3,0xA7,0xAB,0xA6,0xA0,0xA6,0xA3,
+            0x8D,0xA7,0xA6,0xAA,0xA4,0xA0,0xA7,0xA8,0x9D,0xA6,0xA5,0xA9,0xA6,0xA0,0xA6,0xA8,
+            0x9E,0xA8,0xA6,0xA6,0xA4,0x9F,0xA5,0xA6,0xA0,0x91,0x9B,0xA6,0xA7,0x9E,0xA0,0xA0,
+            0x8F,0xA0,0xA7,0xA9,0x9B,0x9F,0x9F,0xA1,0xA2,0x95,0xA6,0xA6,0xA5,0xA4,0xA3,0xA4,
+            0x95,0xA6,0x99,0xA6,0xA0,0xA5,0xA4,0xA4,0xA0,0xA2,0xA4,0x9A,0xA0,0xA3,0xA2,0xA5,
+            0x96,0xA2,0xA5,0xA3,0x9A,0xA1,0xA1,0xA4,0x8E,0x9A,0xA1,0x9B,0x9E,0x9B,0xA0,0x9D,
+            0x92,0x9D,0x9D,0x98,0x99,0x9B,0x96,0x96,0x8B,0x95,0x92,0x93,0x88,0x86,0x80,0x72,
+            0x78,0x77,0x84,0x88,0x84,0x85,0x92,0x95,0x79,0x99,0x96,0x8C,0x92,0x9C,0x9D,0x88,
+            0x7B,0xA0,0x9E,0xA0,0x97,0xA1,0xA2,0x9F,0x81,0xA1,0xA1,0xA4,0x9A,0xA3,0xA3,0x9F,
+            0x82,0xA6,0xA3,0xA4,0x9B,0xA6,0xA5,0xA4,0x8C,0xA2,0xA7,0xA6,0xA1,0x9F,0xA2,0xA2,
+            0x8D,0x8C,0xA8,0xA5,0x97,0xA2,0xA6,0xA8,0x95,0xA3,0xA5,0xA6,0x9F,0xA4,0xA5,0xA1,
+            0x8D,0x82,0xA5,0xA1,0x8A,0x92,0xA2,0xA3,0x72,0x84,0xA0,0xA0,0x7E,0x91,0xA3,0xA0,
+            0x83,0x9E,0xA1,0x8A,0xA1,0x9D,0x9E,0x9E,0x96,0x9E,0xA5,0xA4,0xA2,0xA7,0xA8,0x9E,
+            0x97,0xA4,0xA8,0xA8,0xA5,0xA1,0x8D,0xA6,0x96,0xA6,0x9A,0xA9,0xA7,0xA3,0xA9,0xA7,
+            0x97,0xA7,0xAC,0xA8,0x9B,0x98,0xA8,0xA2,0x9B,0xA9,0xA9,0xA8,0xA6,0xA3,0xA4,0xA6,
+            0x9C,0x9F,0xA7,0x96,0xA2,0xA2,0xA7,0xA7,0xA4,0x8E,0xA7,0x87,0xA7,0x9C,0xA6,0xA8,
+            0xA3,0xA6,0xA7,0xA9,0xA9,0xA6,0xA6,0xAA,0xA6,0xA8,0xA9,0xAA,0xA7,0xA8,0xA7,0xA7,
+            0xA3,0xA2,0xA5,0xAA,0xAA,0xA0,0xAA,0xA8,0xA6,0xA8,0xA7,0xA9,0xA8,0xA8,0xAB,0xA8,
+            0xA5,0xA9,0xA9,0xA6,0xA8,0xA8,0xA7,0xA6,0x9C,0x9C,0x93,0xA6,0xA7,0xA5,0x9B,0xA3,
+            0xA1,0xA0,0xA6,0x9A,0xA3,0xA3,0xA2,0xA1,0xA5,0xA7,0xA3,0xA3,0xA5,0xA5,0xA5,0xA1,
+            0x9F,0xA5,0xA7,0xA5,0xA4,0xA5,0xA3,0xA4,0xA1,0xA2,0xA3,0xA3,0xA0,0xA5,0xA4,0xA3,
+            0x9A,0xA4,0xA3,0xA4,0xA3,0xA0,0xA3,0xA3,0x89,0x97,0xA3,0x9B,0x9D,0x9E,0x9F,0x9F,
+            0x96,0x9D,0x9C,0x99,0x9A,0x9A,0x99,0x98,0x90,0x96,0x94,0x92,0x8C,0x89,0x83,0x75,
+            0x78,0x77,0x82,0x87,0x80,0x87,0x91,0x95,0x6E,0x96,0x95,0x98,0x7F,0x9C,0x9A,0x7F,
+            0x70,0x9D,0x99,0x9F,0x8A,0x9D,0x9F,0x9E,0x75,0x9A,0x9F,0xA3,0x8E,0xA3,0xA1,0xA0,
+            0x77,0xA2,0xA1,0xA2,0x8E,0xA5,0xA2,0xA8,0x7C,0xA1,0xA4,0xA3,0x90,0xA1,0xA5,0xA6,
+            0x78,0x82,0xA5,0xA6,0x93,0xA4,0xA8,0xA8,0x7B,0xA1,0xA2,0xA2,0x95,0xA3,0xA7,0xA6,
+            0x83,0x7E,0xA0,0x9F,0x7F,0x8D,0x9F,0xA5,0x4F,0x76,0x9B,0xA0,0x73,0x8F,0xA3,0xA3,
+            0x6C,0x99,0x9B,0x9D,0x94,0x90,0x9C,0x97,0x84,0x9F,0x9C,0xA4,0x9A,0xA5,0xA9,0xA3,
+            0x8B,0xA5,0xA9,0xA4,0x81,0xA4,0x86,0xA9,0x87,0xA4,0x97,0xA9,0x9E,0xA6,0xA8,0xAA,
+            0x8B,0xA5,0xAA,0xA9,0x95,0x91,0xA1,0xA1,0x88,0xA7,0xA9,0xA6,0x9D,0xA0,0xA6,0xA8,
+            0x8D,0x9D,0xA8,0x8B,0x9E,0x98,0xA8,0xA9,0xA5,0x71,0xA5,0x81,0xA5,0x91,0xA8,0xAA,
+            0x9F,0xA4,0xA8,0xAB,0xA8,0xA8,0xA8,0xAA,0xA9,0xA4,0xA8,0xA9,0xA8,0xA6,0xA4,0xAB,
+            0xA5,0xA6,0xA8,0xAA,0xA6,0xA7,0xA7,0x98,0xA3,0xA3,0xAA,0xA8,0xA9,0xA7,0xA7,0xA9,
+            0xA4,0xAC,0xAA,0xA7,0xA9,0xA7,0xA9,0xAB,0x9B,0x9A,0x94,0x95,0xA7,0xA5,0x90,0x95,
+            0x9F,0x9B,0xA7,0xA9,0xA5,0xA3,0x9E,0xA1,0xA4,0xA8,0xA6,0xA8,0xA6,0xA7,0xA1,0xA6,
+            0x9C,0xA0,0xA8,0xA4,0xA7,0xA4,0xA5,0xA6,0x9E,0xA5,0xA3,0xA4,0xA1,0xA4,0xA4,0xA4,
+            0x97,0xA5,0xA4,0x96,0xA2,0xA3,0xA3,0xA3,0x7D,0x9C,0xA1,0x99,0x9F,0xA2,0xA2,0xA0,
+            0x93,0x9D,0x99,0x96,0x9B,0x9B,0x97,0x98,0x8A,0x98,0x93,0x92,0x8B,0x89,0x82,0x70,
+            0x72,0x75,0x81,0x85,0x83,0x7F,0x8A,0x8B,0x83,0x92,0x85,0x8E,0x93,0x86,0x95,0x7E,
+            0x8C,0x8D,0x90,0x93,0x99,0x8D,0x93,0x90,0x94,0x9A,0x9B,0x98,0x9C,0x8D,0x99,0x98,
+            0x98,0xA1,0xA1,0xA1,0x48,0x93,0xA2,0x9F,0x97,0x9C,0x9E,0x9C,0x99,0x91,0x9E,0x9D,
+            0x94,0x88,0x98,0x9B,0x98,0x92,0xA2,0x8E,0x86,0x97,0x9B,0x9D,0x9B,0x94,0x9F,0xA1,
+            0x95,0x6F,0x9D,0x9F,0x84,0x7E,0x9E,0x9E,0x73,0x62,0x8D,0xA4,0x77,0x7F,0x9C,0x9E,
+            0x91,0x9D,0x97,0x61,0xA0,0x5D,0x9D,0xA0,0xA1,0xA3,0xA6,0xA3,0xA5,0xA3,0xAB,0xA1,
+            0xA4,0xA2,0xA7,0xA5,0x9D,0x9E,0x84,0xA3,0x9F,0xA5,0x9B,0xA9,0x9E,0x94,0xA6,0xA7,
+            0xA7,0xA6,0xA0,0xA1,0x93,0x95,0x98,0x99,0xA5,0xA6,0xA7,0xA8,0xA1,0xA5,0xA4,0xA6,
+            0x96,0x94,0x9F,0x88,0x95,0x88,0x97,0x8C,0x95,0x87,0x9A,0x87,0x9A,0x92,0xA1,0x9F,
+            0x9A,0x9D,0xA2,0x9C,0x9D,0x91,0x99,0x9B,0xA5,0xA5,0xA7,0xA6,0x9F,0x9E,0xA5,0xA8,
+            0xA5,0xA1,0xA1,0xA4,0xA1,0xA1,0xA9,0xA7,0x9F,0xA5,0xA4,0xA4,0xA2,0x9B,0x8A,0xA2,
+            0xA0,0xA2,0xA5,0xA1,0x9A,0x9B,0xA6,0xA1,0x9B,0x95,0x94,0xA2,0x9D,0x9C,0x90,0x9E,
+            0x9C,0x88,0x8B,0x8E,0x90,0x8A,0x8B,0x8D,0x87,0x9F,0x8E,0x90,0x98,0x95,0x98,0x8C,
+            0x82,0x8F,0x9D,0x8C,0x91,0x8E,0x95,0x8D,0x98,0x96,0x96,0xA1,0x95,0x97,0x9C,0x92,
+            0x9A,0x99,0x99,0x97,0xA2,0x99,0x9D,0x88,0x85,0x90,0x9A,0x95,0x9B,0x98,0x8E,0x8A,
+            0x96,0x95,0x95,0x90,0x95,0x94,0x96,0x88,0x92,0x93,0x91,0x8E,0x8D,0x88,0x82,0x70,
+            0x67,0x79,0x82,0x89,0x7E,0x89,0x90,0x95,0x71,0x95,0x98,0x96,0x85,0x9B,0x89,0x85,
+            0x72,0x9E,0x9C,0xA1,0x8D,0x9F,0xA0,0xA0,0x7A,0xA2,0xA0,0xA3,0x93,0xA3,0xA5,0xA5,
+            0x7B,0xA3,0xA1,0xA2,0x94,0xA6,0xA3,0xA7,0x82,0xA1,0xA6,0xA4,0x96,0x93,0xA8,0xA6,
+            0x7D,0x80,0xA3,0xA5,0x98,0xA7,0xA2,0xA8,0x80,0xA0,0xA5,0xA4,0x95,0xA2,0xA4,0xA2,
+            0x71,0x54,0x9E,0xA4,0x7F,0x7D,0x9C,0xA7,0x5A,0x67,0x9B,0xA2,0x73,0x7F,0x9A,0xA5,
+            0x83,0x9F,0x9C,0x5C,0x94,0x77,0xA0,0xA2,0x90,0xA5,0xA6,0xA6,0xA0,0xA6,0xA6,0xA5,
+            0x8C,0xA3,0x99,0xA5,0x9F,0xA9,0x7E,0xA9,0x8D,0xA5,0x94,0xA7,0xA2,0xA5,0xA1,0xA9,
+            0x8B,0xA9,0x9E,0xA9,0x9A,0x98,0xA8,0xA2,0x8E,0xA7,0xAA,0xA5,0xA2,0xA8,0xA9,0xA8,
+            0x87,0xA0,0xA8,0x90,0x9C,0xA5,0xA7,0xA9,0x88,0x6F,0xA7,0x8B,0x9C,0x94,0xA9,0xA7,
+            0x84,0xA8,0xA5,0xAA,0xA1,0xA9,0xA4,0xA6,0x87,0xA6,0xA9,0xAA,0x9B,0xA7,0xA6,0xA6,
+            0x83,0xA5,0xA7,0xA9,0x9D,0xAA,0xA8,0xA7,0x85,0xAA,0xA8,0xA9,0x9C,0xA6,0xA7,0xA7,
+            0x83,0xA7,0xA9,0xA5,0x9E,0xA9,0xA7,0xA5,0x81,0x8F,0x8A,0xA7,0x9B,0x94,0x88,0x89,
+            0x84,0x96,0xA1,0xA5,0x90,0x95,0x9E,0x99,0x81,0xA6,0x9D,0xA2,0x97,0xA5,0xA3,0xA2,
+            0x8E,0xA0,0xA5,0xA2,0x9C,0xA7,0xA6,0xA5,0x8E,0xA4,0xA0,0xA5,0x9A,0xA3,0xA1,0xA3,
+            0x91,0xA3,0x9B,0xA2,0x9F,0xA1,0xA4,0xA4,0x83,0x95,0xA1,0x99,0x9B,0x96,0xA0,0x9B,
+            0x90,0x9C,0x93,0x8E,0x99,0x8F,0x99,0x99,0x8A,0x95,0x92,0x92,0x8B,0x88,0x81,0x72,
+            0x78,0x75,0x81,0x89,0x7E,0x8C,0x8D,0x94,0x73,0x97,0x97,0x99,0x84,0x99,0x9D,0x8A,
+            0x77,0xA0,0x9E,0xA0,0x8D,0xA0,0x8C,0x9B,0x7F,0xA1,0xA0,0xA4,0x95,0xA2,0xA3,0xA1,
+            0x7A,0xA5,0xA4,0xA8,0x94,0xA4,0xA5,0xA5,0x84,0xA4,0xA1,0xA9,0x92,0x9E,0xA6,0xA6,
+            0x81,0x8D,0xA3,0xA5,0x98,0xA4,0xA0,0xA6,0x85,0xA1,0xA4,0xA5,0x9C,0xA4,0xA3,0xA3,
+            0x8B,0x57,0xA4,0xA3,0x8B,0x81,0xA2,0xA6,0x75,0x6D,0x9F,0xA2,0x7A,0x81,0xA0,0xA5,
+            0x84,0x9B,0xA0,0x6B,0x9C,0x90,0xA3,0x9B,0x93,0xA6,0xA9,0xA3,0xA3,0xA8,0xA8,0xA4,
+            0x8E,0xA5,0xA3,0xAA,0xA3,0xA7,0x86,0xA7,0x88,0xA8,0x96,0xAA,0xA5,0xA9,0xAA,0xA8,
+            0x8F,0xA7,0xA7,0xA9,0x9F,0xA3,0xA8,0xA2,0x93,0xAB,0xA8,0xA3,0xA4,0xA9,0xAA,0xA7,
+            0x90,0xA1,0xA8,0x96,0xA1,0xA4,0xA7,0xA8,0x99,0x91,0xA8,0x82,0xA3,0x9F,0xAA,0xA6,
+            0x96,0xA8,0xA9,0xA9,0xA6,0xAA,0xA8,0xA8,0x9B,0xA7,0xAA,0xA8,0xA4,0xA5,0xA8,0xA7,
+            0x93,0xA9,0xA6,0xAA,0xA9,0xA8,0xAA,0xA9,0x9D,0xA9,0xA7,0xA9,0xA3,0xA7,0xAA,0xA8,
+            0x9E,0xAB,0xA8,0xA6,0xA6,0xA8,0xA8,0xA6,0x9C,0x99,0x9A,0xA8,0xAA,0xAA,0x8C,0xA0,
+            0x95,0x94,0x9C,0x9F,0x9F,0x9F,0xA2,0xA4,0xA1,0xA5,0x84,0x99,0xA1,0x9F,0xA7,0xA5,
+            0x97,0x9C,0xA6,0x9F,0xA0,0xA2,0xA6,0xA6,0x9C,0xA1,0xA0,0xA7,0x9C,0xA4,0xA5,0xA4,
+            0x94,0xA1,0xA3,0xA3,0xA2,0xA0,0xA2,0xA3,0x8C,0x9A,0xA3,0x9C,0x9E,0xA0,0x9E,0x9D,
+            0x91,0x9D,0x97,0x96,0x99,0x9B,0x9A,0x97,0x8C,0x97,0x94,0x91,0x8A,0x88,0x81,0x73,
+            0x78,0x79,0x81,0x88,0x7F,0x87,0x93,0x94,0x72,0x94,0x97,0x9B,0x84,0x8C,0x9C,0x89,
+            0x75,0x9E,0x9F,0x9F,0x8E,0x97,0xA1,0x9E,0x7A,0xA3,0xA3,0xA4,0x8F,0x9D,0xA3,0xA2,
+            0x7B,0xA3,0xA5,0xA6,0x96,0x9D,0xA6,0xA7,0x82,0xA2,0xA6,0xA8,0x94,0x9A,0xA7,0xA7,
+            0x80,0x8B,0xA4,0xA3,0x98,0xA1,0xA6,0xA8,0x83,0xA6,0xA3,0xA8,0x99,0xA2,0xA7,0xA5,
+            0x89,0x58,0xA3,0xA3,0x8D,0x86,0xA1,0xA8,0x72,0x70,0xA4,0xA3,0x7D,0x86,0xA6,0xA2,
+            0x80,0xA0,0x9E,0x9A,0x9A,0x95,0x9E,0xA3,0x90,0xA6,0xA5,0xA5,0xA2,0xA9,0xA8,0xA2,
+            0x8B,0xA7,0xA5,0xA4,0xA0,0xA7,0x81,0xA9,0x8F,0xA8,0x97,0xAA,0xA5,0xA8,0xA7,0xA8,
+            0x8D,0xA8,0xA9,0xA4,0x9F,0xA4,0xA9,0xA5,0x90,0xA7,0xA8,0xA3,0xA1,0xA6,0xA9,0xA6,
+            0x9C,0xA4,0xA8,0x94,0x9D,0xA2,0xAA,0xA4,0xA2,0x89,0xAA,0x89,0xAA,0x98,0xA8,0xA6,
+            0x9C,0xA8,0xA8,0xA7,0xA6,0xA9,0xA8,0xAA,0xA4,0xA7,0xA7,0xAA,0xA5,0xA7,0xA8,0xA9,
+            0x9D,0xA6,0xA7,0xA9,0xA5,0xA9,0xAA,0xA9,0xA0,0xAB,0xA7,0xAA,0xA8,0xA7,0xA8,0xA7,
+            0x9F,0xA9,0xA9,0xA8,0xA8,0xAA,0xAA,0xA9,0x99,0x93,0x8F,0xA6,0xA8,0xA9,0x95,0x99,
+            0x68,0x91,0x9B,0x9B,0x9B,0x9B,0x9B,0x93,0x97,0x83,0x9D,0x9F,0x9E,0x9E,0xA2,0x96,
+            0x94,0xA1,0x8A,0x9F,0x9D,0x9E,0x9F,0x97,0x9C,0xA2,0xA0,0x8C,0x9D,0x9F,0xA2,0x9A,
+            0x93,0xA1,0xA0,0xA3,0x8F,0x9F,0xA3,0x9B,0x8B,0x97,0xA3,0x9A,0x9D,0x91,0x9F,0x9A,
+            0x90,0x99,0x9A,0x95,0x98,0x9A,0x8E,0x93,0x88,0x97,0x93,0x91,0x89,0x88,0x82,0x72,
+            0x69,0x67,0x71,0x7B,0x79,0x7C,0x7C,0x8A,0x71,0x8D,0x90,0x90,0x82,0x8C,0x97,0x74,
+            0x75,0x8E,0x96,0x98,0x8E,0x8E,0x88,0x98,0x81,0x9F,0x9F,0x9C,0x96,0x97,0x9E,0x9E,
+            0x7F,0x96,0x9F,0xA1,0x97,0x97,0xA3,0xA1,0x89,0x9A,0xA1,0xA2,0x99,0x9A,0xA3,0xA1,
+            0x80,0x7A,0x9A,0xA2,0x9E,0x97,0xA8,0xA6,0x8E,0x96,0x9F,0x9D,0x9A,0x9C,0x92,0xA4,
+            0x87,0x75,0x95,0x9A,0x7B,0x84,0x9A,0x9B,0x5F,0x75,0x95,0x9B,0x6F,0x80,0x9D,0x9D,
+            0x88,0x93,0x9A,0x9C,0x99,0x9E,0x9E,0x9D,0x90,0x90,0x73,0x7A,0x9B,0xA6,0xA1,0x9D,
+            0x93,0x9A,0xA1,0xA1,0x78,0xA6,0x7E,0xA2,0x95,0x9C,0x98,0xA8,0x9F,0xA6,0xA6,0xA4,
+            0x93,0x97,0x9E,0xA1,0x8C,0x8F,0xA2,0x9F,0x98,0x9C,0xA2,0xA5,0x9E,0xA4,0xA2,0xA0,
+            0x90,0x97,0xA3,0x82,0x8C,0x87,0xA0,0x9D,0x93,0x7D,0xA0,0x7C,0x9E,0x92,0xA5,0xA5,
+            0x9E,0xA6,0xA7,0xA8,0x9D,0xA3,0xA6,0xA8,0xA1,0xA6,0xA6,0xA8,0xA1,0xA2,0xA9,0xA4,
+            0x9F,0xA6,0xA6,0xA6,0xA0,0xA3,0xA9,0xA4,0x9E,0xA6,0xA8,0xA7,0xA2,0xA2,0xA9,0xA4,
+            0xA2,0xA6,0xA7,0xA6,0xA2,0x96,0xA8,0xA7,0x7E,0x93,0x8D,0xA2,0x9B,0xA0,0x8C,0x95,
+            0x76,0x73,0x7B,0x7C,0x7F,0x85,0x83,0x7C,0x7A,0x7D,0x7C,0x7B,0x82,0x86,0x91,0x85,
+            0x83,0x82,0x86,0x7F,0x85,0x7D,0x87,0x89,0x80,0x88,0x82,0x86,0x7E,0x88,0x8E,0x8A,
+            0x89,0x80,0x90,0x89,0x88,0x85,0x94,0x87,0x75,0x7A,0x8F,0x79,0x90,0x88,0x8E,0x90,
+            0x89,0x89,0x8B,0x82,0x90,0x7E,0x8A,0x89,0x86,0x8D,0x83,0x80,0x82,0x81,0x78,0x6C,
+            0x76,0x7C,0x86,0x8C,0x85,0x77,0x94,0x94,0x84,0x98,0x96,0x9A,0x93,0x90,0x9C,0x8B,
+            0x87,0xA1,0x9D,0x9E,0x95,0x97,0x9A,0x9B,0x91,0xA2,0xA0,0xA2,0x9B,0x98,0xA3,0xA0,
+            0x8E,0xA0,0x9F,0xA4,0x9C,0x9E,0xA4,0xA7,0x99,0xA4,0xA7,0xA8,0xA0,0x9F,0xA7,0xA4,
+            0x8F,0x99,0xA4,0xA4,0x9F,0x9F,0xA9,0xA5,0x98,0xA5,0xA5,0xA4,0x9F,0x9F,0x99,0xA4,
+            0x93,0x80,0x99,0xA2,0x85,0x94,0x87,0x9F,0x7B,0x8F,0x9C,0xA2,0x80,0x94,0xA4,0x9D,
+            0x94,0x9C,0x9C,0xA2,0x90,0xA0,0x90,0xA3,0x98,0xA1,0x9C,0x9C,0x7F,0xA5,0x7C,0x9C,
+            0x97,0xA2,0xA2,0xA5,0x93,0xA8,0x91,0xA6,0xA2,0xA3,0xA4,0xA6,0x86,0xA3,0xA4,0xA5,
+            0x9C,0xA1,0xA5,0xA7,0x92,0xA2,0x9B,0xA2,0x9C,0xA3,0xA4,0xA2,0xA2,0xA6,0xA3,0xA3,
+            0x98,0xA2,0xAA,0x8F,0x87,0x89,0x92,0xA4,0xA5,0x96,0xA8,0x95,0x9E,0xA1,0xA9,0xA7,
+            0x98,0xA7,0xA8,0xA8,0x93,0xAA,0x8F,0xA9,0xA0,0xA3,0xA6,0xA9,0x9F,0xA3,0xA5,0xA5,
+            0x9B,0xA6,0xA6,0xA8,0x94,0xA8,0x94,0xA9,0xA2,0xA8,0xA9,0xA7,0xA3,0xA6,0xA7,0xA8,
+            0x8C,0xA8,0xA9,0xA8,0x94,0xAB,0x94,0xA5,0x9A,0xA2,0xA1,0xA4,0x9A,0xA7,0xA1,0xA0,
+            0x83,0x77,0x7F,0x78,0x80,0x85,0x82,0x7D,0x72,0x85,0x7D,0x87,0x87,0x88,0x89,0x84,
+            0x7C,0x83,0x87,0x7B,0x85,0x8A,0x81,0x8D,0x79,0x85,0x7B,0x8C,0x84,0x87,0x84,0x83,
+            0x7F,0x84,0x88,0x8C,0x86,0x84,0x86,0x8A,0x7D,0x80,0x7F,0x8D,0x7E,0x8C,0x85,0x88,
+            0x86,0x83,0x8B,0x89,0x90,0x90,0x87,0x8F,0x80,0x89,0x84,0x87,0x81,0x81,0x79,0x74,
+            0x79,0x7D,0x87,0x8B,0x87,0x92,0x95,0x94,0x86,0x9A,0x9C,0x9B,0x94,0x9C,0x9E,0x89,
+            0x83,0xA1,0xA0,0xA1,0x99,0x9F,0x98,0xA1,0x92,0xA2,0xA4,0xA2,0x9B,0x9E,0xA2,0x9E,
+            0x89,0xA6,0xA5,0xA4,0xA0,0xA2,0xA6,0xA5,0x99,0xA3,0xA6,0xA8,0xA2,0x9F,0xA4,0xA4,
+            0x8B,0x94,0xA6,0xA7,0xA2,0x9E,0xA7,0xA7,0x98,0xA1,0xA6,0xA6,0xA1,0x9E,0xA5,0xA2,
+            0x93,0x7F,0xA3,0x9C,0x8B,0x8E,0xA4,0xA2,0x77,0x8B,0x9E,0xA0,0x88,0x8D,0xA5,0xA1,
+            0x90,0xA3,0xA2,0xA3,0x9F,0xA4,0xA6,0xA5,0x97,0x7C,0xA5,0x8F,0xA2,0xA0,0xA1,0xA2,
+            0x96,0xA8,0xA6,0xA6,0xA7,0xA7,0x8D,0x9B,0xA2,0xA9,0xA7,0xA6,0xA5,0xA4,0xA0,0xA1,
+            0x98,0xA8,0xA6,0xAA,0xA0,0x9C,0xA7,0xA3,0xA1,0xA8,0xA6,0xA4,0xA6,0xA6,0xA4,0xA4,
+            0x9B,0xA1,0xA5,0x95,0x9D,0x90,0xA7,0xA4,0xA3,0x95,0xA9,0x90,0xA8,0xA2,0xA6,0xA5,
+            0xA4,0xA4,0xA8,0xA5,0xA9,0xA7,0xA9,0xAA,0xA7,0xA4,0xA9,0x9D,0xA5,0xA3,0xA6,0xA4,
+            0xA4,0xA6,0xA9,0xA8,0xA8,0xA6,0xA9,0xA4,0xA5,0xA9,0xA8,0xA6,0xA5,0xA6,0xA7,0xA3,
+            0xA6,0xA8,0xA8,0xA7,0xA8,0xA6,0xA7,0xA2,0x9A,0xA2,0x9E,0xA6,0xAA,0xA3,0x9F,0x9E,
+            0x7D,0x99,0x9C,0x9A,0x9F,0xA7,0xA1,0x9E,0x9A,0x8D,0xA0,0xA1,0xA5,0xA0,0xA5,0xA6,
+            0x9C,0x98,0x90,0xA5,0x9F,0xA7,0xA1,0xA4,0x9D,0x9C,0xA3,0x97,0xA3,0xA4,0xA1,0xA1,
+            0x97,0xA3,0xA3,0xA4,0x9E,0xA1,0xA5,0xA3,0x8E,0x7F,0xA2,0x8E,0x9F,0x9D,0xA1,0xA0,
+            0x94,0x9E,0x9A,0x98,0x98,0x9D,0x97,0x9A,0x91,0x96,0x93,0x91,0x8D,0x8A,0x82,0x75,
+            0x77,0x7F,0x85,0x8C,0x8D,0x94,0x96,0x96,0x7C,0x98,0x9B,0x98,0x99,0x9C,0xA1,0x85,
+            0x7E,0xA0,0xA2,0xA1,0x9C,0x9E,0x9A,0x9F,0x87,0xA0,0xA4,0xA4,0x9B,0xA0,0xA6,0xA1,
+            0x87,0xA8,0xA5,0xA7,0xA4,0x9E,0xA4,0xA3,0x90,0xA5,0xA9,0xA7,0xA2,0xA1,0xA5,0xA5,
+            0x87,0x7C,0xA7,0xA7,0xA3,0xA0,0xA7,0xA7,0x94,0x9C,0xA5,0xA6,0x9F,0xA0,0xA8,0xA7,
+            0x96,0x59,0xA4,0xA5,0x82,0x95,0xA8,0xA7,0x6D,0x89,0xA1,0xA2,0x7A,0x97,0xA4,0xA5,
+            0x97,0xA7,0xA8,0xA1,0xA0,0xA0,0xA8,0xA9,0x94,0x9D,0xA1,0x93,0xA5,0x51,0xA9,0xA9,
+            0x95,0xA7,0xA7,0xA7,0xA6,0xA7,0x91,0xA8,0x9B,0xA8,0xA7,0xAB,0xA7,0xA6,0xA9,0xA7,
+            0x9B,0xA8,0xA7,0xA8,0xA0,0x9F,0xA7,0xA5,0x9D,0xA8,0xA8,0xA4,0xA9,0xA6,0xA9,0xA7,
+            0x9A,0xA2,0xA4,0x90,0x9E,0x98,0xA7,0xA8,0xA4,0x88,0xA8,0x94,0xA9,0x9D,0xA8,0xA8,
+            0xA4,0xA6,0xA8,0xA1,0xAA,0xA9,0xA7,0xA9,0xA2,0xAA,0xA8,0xA9,0xA8,0xA9,0xA4,0xA5,
+            0xA3,0xA5,0xA5,0xA8,0xA7,0xA6,0xAA,0xAA,0xA7,0xA9,0xA7,0xA9,0xA6,0xA6,0xA9,0xA8,
+            0xA6,0xA8,0xA8,0xA9,0xAA,0xA7,0xA6,0xA4,0x89,0x9E,0x94,0xA7,0xA6,0xA8,0x81,0x98,
+            0x89,0x9A,0xA4,0x64,0xA4,0x9C,0x9F,0x9D,0xA5,0x96,0xA5,0xA8,0xA7,0xA3,0xAA,0xA7,
+            0xA3,0xA7,0x9F,0xA4,0xA5,0xAA,0xA4,0xA5,0xA5,0x9C,0xA7,0xA2,0xA1,0xA5,0xA5,0xA4,
+            0x9E,0xA8,0xA3,0xA3,0xA1,0xA1,0xA4,0xA2,0x98,0x71,0xA1,0x9A,0x9F,0x9F,0xA2,0x9F,
+            0x91,0x9D,0x9C,0x97,0x9C,0x9C,0x98,0x98,0x90,0x95,0x93,0x92,0x8D,0x89,0x83,0x72,
+            0x72,0x78,0x80,0x86,0x8B,0x84,0x8F,0x8E,0x8E,0x95,0x8E,0x98,0x97,0x91,0x96,0x80,
+            0x91,0x92,0x9B,0x9A,0x9B,0x93,0x97,0x96,0x9B,0x9C,0xA1,0x9C,0xA5,0x9A,0xA3,0xA0,
+            0x96,0xA2,0xA2,0xA3,0x50,0x94,0xA5,0x9B,0x9F,0x9F,0xA3,0xA2,0xA0,0x99,0xA1,0x9E,
+            0x8F,0x88,0x9C,0x9D,0x9E,0x97,0xA7,0x8A,0x90,0x99,0x9B,0xA3,0x9F,0x97,0xA2,0xA3,
+            0x96,0x50,0xA2,0xA4,0x8B,0x91,0x98,0xA5,0x77,0x89,0x94,0xA5,0x87,0x98,0xA0,0xA3,
+            0x9A,0xA5,0xA2,0xA0,0x9C,0x9A,0xA3,0xA0,0x99,0xA4,0xA3,0xA3,0xA0,0x83,0xA1,0xA6,
+            0x99,0xA5,0xA6,0xA3,0xA0,0x9B,0x8C,0xA2,0xA8,0xA4,0xA4,0xA7,0xA7,0xA2,0xA6,0xA7,
+            0xA7,0xA6,0xA3,0xA2,0x96,0x93,0xA4,0x94,0xA4,0xAA,0xAA,0xA5,0xA5,0xA6,0xA6,0xA6,
+            0x99,0x9E,0x9F,0x8E,0x9A,0x91,0x86,0x7F,0x9F,0x8A,0xA5,0x8E,0x9C,0x92,0xA5,0x93,
+            0xA1,0xA3,0xA5,0xA6,0x9E,0x9C,0x9F,0xA7,0xA5,0xA6,0xAC,0xA9,0xA3,0xA2,0xA8,0xA7,
+            0xA0,0xA6,0xA4,0xA7,0xA5,0xA6,0xA9,0xA8,0xA2,0xA6,0xAA,0xA5,0xA2,0xA6,0x92,0xA6,
+            0xA6,0xA8,0xA5,0xA6,0x9D,0xA1,0xA8,0x9F,0x88,0xA0,0x9D,0xA4,0xA2,0xA1,0x97,0xA3,
+            0x91,0x83,0x84,0x67,0x8E,0x8E,0x80,0x8C,0x84,0x98,0x8B,0x8D,0x93,0x91,0x96,0x91,
+            0x8A,0x8E,0x95,0x89,0x94,0x92,0x96,0x94,0x8D,0x8F,0x8F,0x97,0x93,0x93,0x96,0x96,
+            0x91,0x95,0x95,0x95,0x9D,0x8A,0x9C,0x99,0x8B,0x73,0x91,0x90,0x96,0x96,0x92,0x90,
+            0x91,0x93,0x94,0x8F,0x97,0x90,0x97,0x8A,0x8F,0x91,0x91,0x8C,0x8D,0x86,0x81,0x75,
+            0x6C,0x73,0x85,0x8C,0x86,0x92,0x97,0x97,0x7A,0x97,0x9A,0x92,0x95,0x9E,0xA1,0x89,
+            0x7C,0x9F,0xA1,0xA3,0x99,0xA1,0xA1,0xA1,0x81,0xA3,0xA4,0xA6,0x9D,0xA5,0xA6,0xA5,
+            0x82,0xA4,0xA6,0xA6,0xA1,0xA5,0xA3,0xA6,0x88,0xA4,0xA7,0xA3,0xA2,0xA6,0xA7,0xA8,
+            0x86,0x84,0xA6,0xA7,0xA2,0xA4,0xA8,0xAB,0x89,0xA1,0xA4,0xA6,0xA3,0xA0,0xA5,0xA8,
+            0x6D,0x4A,0xA4,0xA7,0x8F,0x98,0x9B,0xA8,0x79,0x84,0xA4,0xA5,0x8A,0x9D,0xA9,0xA8,
+            0x91,0xA9,0xA7,0xA7,0xA3,0xA5,0xA8,0xA5,0x93,0xA7,0xA6,0x9B,0xA7,0x7E,0xA8,0xAC,
+            0x93,0xA4,0xA6,0xAA,0xA7,0xA6,0x93,0xA9,0x94,0xA5,0xA5,0xA6,0xA2,0xA3,0xA9,0xAA,
+            0x95,0xA6,0xA2,0xAA,0x9B,0x9C,0xA8,0xA3,0x96,0xA8,0xA8,0xA7,0xA4,0xAA,0xA9,0xA5,
+            0x8D,0xA7,0xA5,0x92,0x9E,0x9D,0xA8,0xA7,0x8E,0x95,0xA9,0x96,0xA1,0xA2,0xA7,0xA7,
+            0x8B,0xA6,0xA9,0xA9,0xA2,0xA8,0xA5,0xA9,0x90,0xA7,0xAB,0xAA,0xA2,0xAA,0xA6,0xA9,
+            0x8A,0xA6,0xA7,0xA5,0xA4,0xA7,0xAA,0xAA,0x8F,0xA9,0xA7,0xA8,0xA3,0xA8,0xAA,0xA2,
+            0x8A,0xA8,0xA5,0xAA,0x9F,0xA9,0xA6,0xA9,0x8B,0xA0,0x9A,0xA9,0xA1,0xA7,0x88,0x95,
+            0x8D,0x93,0x9D,0x58,0x8F,0xA4,0x9E,0xA0,0x8E,0xA7,0x9F,0xA1,0x9F,0x93,0xA0,0xA7,
+            0x94,0x9D,0xA4,0x9C,0x9C,0xA2,0x94,0xA5,0x96,0x97,0xA3,0xA4,0x9E,0xA4,0xA2,0x94,
+            0x97,0xA5,0x9C,0xA2,0xA2,0xA4,0xA4,0xA3,0x94,0x69,0xA1,0x9B,0xA1,0x9E,0xA0,0x9B,
+            0x94,0x9E,0x9C,0x9B,0x9B,0x8E,0x93,0x97,0x82,0x95,0x94,0x92,0x8E,0x87,0x81,0x71,
+            0x75,0x7A,0x87,0x8B,0x86,0x85,0x92,0x97,0x7B,0x99,0x9A,0x9B,0x8E,0x9A,0x9E,0x89,
+            0x7C,0x9E,0x9F,0xA3,0x99,0xA1,0x9A,0xA1,0x87,0xA4,0xA3,0xA5,0x98,0xA4,0xA5,0xA5,
+            0x87,0xA4,0xA6,0xA7,0x9F,0xA4,0xA5,0xA8,0x8D,0xA5,0xA5,0xA6,0xA3,0xA8,0xA6,0xA7,
+            0x82,0x91,0xA4,0xA4,0xA0,0xA4,0xAB,0xA8,0x8F,0xA1,0xA7,0xA9,0xA1,0xA4,0xA5,0xA7,
+            0x8C,0x53,0xA6,0xA7,0x90,0x9A,0xA5,0xA7,0x7C,0x8F,0xA6,0xA4,0x8B,0x96,0xA5,0xA9,
+            0x8C,0xA7,0xA5,0xA6,0x9F,0xA4,0xA9,0xA7,0x96,0xA7,0xA4,0xA0,0xA8,0x7A,0xA9,0x83,
+            0x7E,0xA7,0xA6,0xA7,0xA5,0xA8,0x8F,0xA8,0x96,0xAA,0xA7,0xAB,0xA8,0xA5,0xA8,0xA9,
+            0x94,0xAB,0xA8,0xA7,0xA1,0xA1,0xA5,0xA2,0x99,0xAA,0xAA,0xA9,0xA5,0xA6,0xA9,0xA8,
+            0x9A,0xA3,0xA6,0x96,0x98,0x95,0xA7,0xA7,0x9E,0x97,0xA7,0x96,0xA4,0xA0,0xA6,0xA7,
+            0x96,0xA7,0xA8,0xA7,0xA6,0xA3,0xA9,0xA9,0xA5,0xA7,0xA9,0xAA,0xA5,0xA9,0xA9,0xA8,
+            0xA1,0xAA,0xA6,0xA4,0xA4,0xAA,0xAA,0xAB,0xA0,0xA8,0xA8,0xAA,0xA6,0xA8,0xA8,0xAB,
+            0x97,0xA9,0xA8,0xA7,0xA8,0xA7,0xA8,0xA7,0x9E,0xA4,0xA1,0xA5,0xA9,0xA5,0xA0,0xA1,
+            0x90,0x80,0x8C,0x67,0x95,0x97,0x99,0x9B,0x86,0x99,0x8F,0x96,0x98,0x9A,0x9D,0x9E,
+            0x8E,0x94,0x9E,0x97,0x99,0x9C,0x9E,0x9F,0x96,0x96,0x9A,0x9E,0x9C,0x9D,0x9E,0xA0,
+            0x8F,0x9A,0x9C,0x9A,0x9F,0x9D,0x9F,0x9F,0x91,0x75,0x9A,0x95,0x9D,0xA0,0x9E,0x9E,
+            0x90,0x98,0x99,0x96,0x98,0x9B,0x99,0x98,0x8F,0x93,0x93,0x93,0x8B,0x8A,0x83,0x73,
+            0x76,0x7D,0x81,0x8B,0x89,0x95,0x91,0x96,0x79,0x99,0x99,0x9A,0x90,0x9E,0x9E,0x85,
+            0x77,0x9F,0x8D,0xA1,0x99,0xA3,0xA1,0xA0,0x82,0xA7,0xA5,0xA5,0x98,0xA3,0xA1,0xA4,
+            0x81,0xA5,0x91,0xA8,0xA0,0xA7,0xA5,0xA5,0x89,0xA7,0xA7,0xA7,0xA2,0xA8,0xA5,0xA5,
+            0x82,0x8E,0x93,0x9F,0xA0,0xA4,0xA4,0xA9,0x8E,0xA2,0xA3,0xA6,0x9D,0xA6,0xA7,0xA6,
+            0x8B,0x7B,0x98,0xA0,0x93,0x98,0xA1,0xA3,0x7D,0x8E,0xA6,0xA4,0x8E,0x98,0xA4,0xA1,
+            0x8D,0xA7,0x97,0xA0,0x9F,0xA1,0xA5,0xA8,0x91,0xA9,0xA1,0x97,0xA4,0x61,0xA6,0x9D,
+            0x90,0xA1,0x99,0xA1,0x9E,0xA3,0x92,0xA3,0x95,0xA3,0xA6,0xA8,0xA0,0xA4,0xA1,0xA2,
+            0x92,0xA6,0x99,0x9D,0x93,0x97,0xA3,0xA0,0x96,0xA7,0xA8,0xAA,0xA8,0xA6,0xAB,0xAA,
+            0x9C,0xA0,0xA9,0x96,0x9B,0x97,0xA9,0xA5,0xA7,0x98,0xAB,0x97,0xA5,0xA1,0xA9,0xA8,
+            0xA1,0xA6,0xAA,0xA9,0xA7,0xA8,0xA5,0xA8,0xA6,0xA6,0xA9,0xA7,0x9E,0xA9,0xA8,0xA7,
+            0xA3,0xA6,0xA7,0xA9,0xA8,0xA9,0xAA,0xA9,0xA7,0xA8,0xA8,0xA7,0xA6,0xA8,0xAA,0xA8,
+            0xA3,0xA8,0xAA,0xA5,0xA7,0xA9,0xA8,0xAA,0xA0,0xA4,0xA3,0xA8,0xA5,0xA8,0xA3,0xA5,
+            0x98,0x91,0x9B,0x5A,0x90,0xA2,0xA1,0x9D,0x9A,0xA6,0xA0,0xA2,0xA3,0x93,0xA0,0xA5,
+            0x99,0xA3,0xA4,0x9B,0x9E,0xA5,0x94,0xA3,0x9D,0x96,0xA3,0xA1,0x9C,0xA2,0xA4,0x94,
+            0x9A,0xA5,0xA2,0xA1,0xA2,0xA0,0xA5,0xA3,0x91,0x6A,0xA0,0x9A,0x9F,0xA0,0xA0,0x9F,
+            0x96,0x9D,0x98,0x9A,0x9B,0x9D,0x9A,0x9A,0x91,0x96,0x95,0x92,0x8C,0x89,0x82,0x70,
+            0x68,0x64,0x70,0x76,0x7B,0x80,0x84,0x8A,0x75,0x87,0x8F,0x87,0x87,0x94,0x8F,0x69,
+            0x7C,0x92,0x97,0x95,0x91,0x94,0x97,0x91,0x86,0x9E,0x9F,0x99,0x98,0x9F,0x9E,0xA0,
+            0x81,0x9F,0x9E,0x9D,0x97,0x9A,0xA4,0xA1,0x86,0x9B,0xA0,0xA2,0x9B,0x9E,0xA4,0x9F,
+            0x85,0x82,0x99,0xA3,0x9F,0xA4,0xA6,0xA5,0x92,0x94,0x9D,0x9D,0x99,0xA1,0xA5,0xA5,
+            0x88,0x75,0x97,0x9F,0x7B,0x82,0xA3,0xA2,0x5D,0x76,0x96,0x9A,0x6E,0x80,0x9F,0xA3,
+            0x8A,0xA0,0xA1,0x9C,0xA2,0x9F,0xA4,0xA2,0x8E,0xA1,0xA2,0x8B,0xA2,0xA5,0xA1,0xA3,
+            0x95,0xA3,0x9A,0xA3,0x8E,0xA6,0x77,0xA9,0x99,0xA5,0x9C,0xA5,0xA5,0xA5,0xA3,0xA5,
+            0x96,0xA3,0x9E,0xA0,0x89,0x88,0xA2,0x9D,0x97,0x99,0xA6,0xA4,0xA4,0xA5,0xA4,0x9F,
+            0x8D,0x9A,0xA1,0x7F,0x95,0x87,0xA5,0xA6,0x91,0x7C,0xA1,0x7D,0xA5,0x92,0xA9,0xA6,
+            0x9F,0xA1,0xA5,0xA5,0xA3,0xA9,0xA3,0xA3,0xA6,0xA4,0xA4,0xA9,0xA6,0xA7,0xA8,0xA7,
+            0xA1,0xA4,0xA5,0xA4,0xA5,0xA4,0xA7,0xA6,0x9C,0xA4,0xA6,0xA7,0x8A,0xA6,0xA4,0xA5,
+            0xA0,0xA6,0xA7,0xA4,0xA4,0xA6,0xAA,0xA5,0x97,0x90,0x89,0xA1,0xA6,0xA3,0x8C,0x99,
+            0x82,0x85,0x9B,0x90,0x7D,0x81,0x89,0x86,0x97,0x9C,0x97,0x99,0x8B,0x9A,0x9F,0x8B,
+            0x90,0x92,0xA0,0x95,0x89,0x9C,0x9B,0x9C,0x92,0x96,0x9C,0x9B,0x8A,0x96,0x9B,0x9C,
+            0x91,0x95,0x9E,0x98,0x9E,0x93,0x98,0x99,0x71,0x7E,0x9A,0x89,0x9A,0x9B,0x97,0x99,
+            0x8F,0x97,0x89,0x7E,0x91,0x90,0x90,0x8E,0x8C,0x8A,0x89,0x86,0x84,0x7E,0x75,0x6B,
+            0x77,0x7B,0x82,0x87,0x8B,0x90,0x96,0x98,0x8B,0x98,0x9B,0x9B,0x98,0x82,0x9E,0x87,
+            0x8E,0x9F,0xA1,0xA0,0x9B,0x86,0x9E,0xA0,0x73,0xA5,0xA5,0xA2,0xA0,0x8A,0xA3,0x9F,
+            0x8D,0x9B,0xA2,0xA5,0xA1,0x8A,0xA6,0xA5,0x9B,0xA6,0xA6,0xA7,0xA6,0x8A,0xA4,0xA4,
+            0x99,0x99,0xA4,0xA0,0xA3,0x9A,0xA4,0xA6,0xA1,0xA7,0xA4,0xA7,0x9E,0x8B,0xA3,0xA6,
+            0x94,0x94,0xA9,0xA7,0x9B,0x9D,0xA7,0xA8,0x80,0x91,0xA6,0xA4,0x93,0x9E,0xA5,0xA5,
+            0x9E,0xA6,0xA4,0xA7,0xA5,0xA3,0xA9,0xA8,0x9F,0xA3,0xA5,0xA6,0xA5,0xA9,0xA7,0xA5,
+            0x98,0xA2,0x98,0x99,0x97,0xA3,0x95,0x99,0xA1,0x9F,0xA6,0xA2,0x90,0x96,0x97,0xA8,
+            0x9B,0xA9,0x91,0x95,0x8E,0x94,0x9E,0xA4,0xA0,0xA0,0xA6,0xA3,0x9D,0x94,0x76,0xA7,
+            0x96,0xA4,0xA7,0x9A,0xA1,0xA5,0xA8,0xA9,0x9B,0x9C,0xA6,0x99,0xA3,0x9C,0xAA,0xA8,
+            0x9D,0xA5,0xA4,0xA8,0xA6,0xAA,0xA6,0xA9,0xA8,0xA6,0xA6,0xA8,0xA6,0xA7,0xA6,0xA9,
+            0xA2,0xA7,0xA8,0xA7,0xA6,0xA7,0xA6,0xA7,0xA5,0xA5,0xA7,0xA7,0xA7,0xA7,0xA8,0xA8,
+            0xA2,0xA8,0xA8,0xAA,0xA6,0xA8,0xA8,0xA5,0x88,0xA2,0xA0,0xA8,0xA6,0xA9,0xA2,0xA2,
+            0x8B,0x88,0x92,0x7E,0x98,0x9B,0x98,0x9C,0x93,0x9C,0x8F,0x94,0x90,0x99,0x9C,0x94,
+            0x96,0x94,0x9F,0x91,0x7F,0x99,0x98,0x9F,0x9B,0x97,0x97,0x9E,0x94,0x96,0x9E,0x9D,
+            0x97,0x97,0x97,0x97,0xA0,0x86,0x9C,0xA1,0x94,0x99,0x9B,0x97,0x89,0x9D,0x98,0x9A,
+            0x95,0x97,0x99,0x98,0x7F,0x7F,0x97,0x92,0x92,0x92,0x93,0x91,0x8D,0x86,0x81,0x78,
+            0x78,0x64,0x79,0x88,0x8C,0x90,0x94,0x98,0x8A,0x99,0x9A,0x9D,0x97,0x98,0xA0,0x8E,
+            0x8C,0x95,0x9D,0x9F,0x9B,0x9B,0xA4,0xA0,0x95,0xA0,0xA5,0xA6,0x9E,0x9C,0xA2,0xA5,
+            0x92,0x71,0x79,0x98,0x9F,0x9A,0xA9,0xA6,0x9A,0xA2,0xA6,0xA7,0xA4,0x98,0xA3,0xA4,
+            0x95,0x8F,0xA1,0x9C,0xA1,0x97,0xA5,0xA7,0x9D,0xA1,0xA4,0xA6,0xA3,0x95,0xA3,0xA0,
+            0x98,0x7F,0x9A,0x90,0x9D,0x95,0xA7,0xA9,0x82,0x91,0xA4,0xA4,0x94,0x95,0xA6,0xA4,
+            0xA0,0x86,0x93,0x9A,0xA3,0xA2,0xA7,0xA7,0x9E,0x9E,0xA5,0xA7,0xA5,0xA2,0xA7,0xA8,
+            0xA0,0x6B,0x89,0x8A,0xA5,0x87,0x92,0xA7,0xA4,0x98,0xA3,0xA8,0x99,0x93,0xA9,0xA2,
+            0xA2,0x86,0x7D,0x9B,0xA0,0x87,0xA6,0xA3,0xA2,0x80,0xA5,0xA5,0xA6,0x81,0xA9,0xA6,
+            0x9D,0x6C,0x7F,0x96,0xA0,0xA4,0xAA,0xA6,0xA0,0x9D,0xA8,0x98,0xA5,0xA0,0xA7,0xA4,
+            0xA3,0x77,0x89,0x9F,0x9E,0xA6,0xA7,0xA7,0xA6,0xA5,0xA7,0xA6,0x9E,0xA3,0xA5,0xA4,
+            0xA4,0x5E,0x76,0x82,0xA3,0xA7,0xA9,0xA7,0xA4,0xA7,0xA6,0xA7,0xA5,0xA5,0xA7,0xA5,
+            0xA5,0x72,0x8E,0x96,0xA4,0xA6,0xA8,0xAA,0xA1,0xA4,0xA3,0xA7,0xA6,0xA7,0xA2,0xA2,
+            0x99,0x7B,0x84,0x7C,0x86,0x83,0x87,0x85,0x98,0x9F,0x81,0x8A,0x8D,0x86,0x91,0x8C,
+            0x99,0x84,0x88,0x8F,0x99,0x91,0x9A,0x98,0x98,0x9C,0x99,0xA2,0x9B,0x9D,0x9A,0x9D,
+            0x99,0x63,0x7C,0x79,0xA2,0x8C,0x9D,0x9E,0x92,0x81,0x9D,0x9C,0x9D,0x91,0x9C,0x9E,
+            0x94,0x76,0x81,0x8B,0x9A,0x88,0x98,0x98,0x86,0x83,0x93,0x90,0x8D,0x82,0x81,0x77,
+            0x77,0x71,0x83,0x87,0x6C,0x8A,0x91,0x92,0x7D,0x96,0x98,0x98,0x7D,0x96,0x9B,0x87,
+            0x7D,0x9B,0x96,0x98,0x7C,0x91,0x9C,0x99,0x83,0x9F,0xA1,0xA2,0x97,0x94,0xA4,0xA3,
+            0x84,0xA1,0xA2,0xA5,0x9A,0x99,0xA6,0xA3,0x87,0xA2,0xA1,0xA4,0x97,0x94,0xA3,0xA2,
+            0x8B,0x9A,0x9F,0x9C,0x8B,0x97,0xA0,0xA2,0x8E,0xA0,0xA0,0xA0,0x91,0x92,0xA5,0xA2,
+            0x84,0x8E,0x91,0x84,0x7C,0x85,0x85,0x8C,0x7E,0x90,0x9C,0x97,0x86,0x90,0x94,0x99,
+            0x88,0x9B,0x99,0x8D,0x84,0x8D,0x95,0x93,0x92,0x9F,0xA4,0xA2,0x90,0x9F,0xA0,0x9E,
+            0x94,0x97,0xA0,0x9B,0x97,0x96,0x94,0xA3,0x90,0xA2,0xA1,0x98,0x91,0x9A,0xA0,0x94,
+            0x8F,0x9D,0x9D,0x98,0x89,0x94,0x96,0x99,0x93,0x92,0x9F,0x91,0x8F,0x8E,0x9A,0x9D,
+            0x71,0x9A,0x9D,0x8E,0x78,0x8E,0x9B,0x96,0x7C,0x97,0x9F,0x96,0x88,0x9C,0xA5,0xA1,
+            0x76,0x9A,0x9E,0x99,0x8C,0x98,0xA1,0x9D,0x96,0xA1,0xA4,0xA7,0x94,0xA1,0xA5,0xA9,
+            0xA3,0xA1,0xA7,0xA4,0x9E,0xA2,0xA6,0xA8,0xA2,0xA4,0xA5,0xA2,0x9A,0xA5,0x92,0xA6,
+            0x80,0xA0,0x9B,0x9E,0x90,0x9A,0x9D,0xA2,0x85,0xA2,0x99,0xA0,0x8C,0x9E,0xA2,0xA2,
+            0x82,0x85,0x82,0x84,0x8B,0x83,0x81,0x86,0x85,0x76,0x89,0x91,0x96,0x91,0x8F,0x91,
+            0x7C,0x8C,0x70,0x8A,0x90,0x88,0x87,0x8C,0x8E,0x91,0x95,0x84,0x9A,0x98,0x92,0x96,
+            0x91,0x9B,0x99,0x9A,0x8B,0x99,0x95,0x9C,0x8B,0x94,0x93,0x93,0x97,0x82,0x8E,0x96,
+            0x85,0x8E,0x8D,0x8E,0x92,0x8A,0x77,0x90,0x86,0x8E,0x8B,0x8A,0x8B,0x85,0x7F,0x71,
+            0x73,0x76,0x81,0x88,0x8B,0x88,0x91,0x8D,0x8F,0x96,0x8F,0x97,0x91,0x96,0x9A,0x7F,
+            0x93,0x97,0x9C,0x9C,0x9E,0x99,0xA1,0x9E,0x9C,0x9E,0xA0,0xA0,0xA4,0x9C,0xA3,0xA2,
+            0x96,0xA0,0xA4,0xA7,0x5A,0xA4,0xA2,0xA5,0x9F,0x99,0xA5,0xA0,0xA2,0x9C,0x9E,0xA2,
+            0x9F,0x93,0xA3,0x9E,0x97,0x9E,0xA6,0x93,0x9E,0x97,0xA2,0xA3,0x9A,0x9E,0xA5,0xA7,
+            0x92,0x88,0x9D,0xA4,0x8C,0x91,0xA4,0xA9,0x50,0x83,0x99,0xA2,0x72,0x95,0xA9,0xA6,
+            0x9F,0xA6,0xA2,0xA3,0xA6,0xA0,0xA9,0xA3,0x9A,0xA4,0xA3,0xA4,0xA6,0x9B,0xA8,0x9F,
+            0xA9,0x9D,0xA6,0xA0,0x9A,0x91,0x93,0xA3,0xA5,0x9B,0xA4,0xA6,0xA6,0xA5,0xA5,0xA2,
+            0x91,0xA5,0x9B,0x9B,0x9D,0x9B,0xA1,0x8A,0xA5,0xA2,0xA8,0xA9,0xA9,0xA7,0xA7,0xA4,
+            0x95,0x9F,0xA5,0x90,0x9F,0x91,0x9E,0x8D,0xA0,0x89,0xA5,0x8C,0x9E,0x9A,0xA6,0xA7,
+            0xA3,0xA6,0xA6,0x9E,0xA3,0xA2,0xA5,0xA9,0xA6,0xA5,0xA8,0xA8,0xA5,0xA5,0xA6,0xAA,
+            0xA4,0xA5,0xA8,0xA4,0xA3,0xA5,0xAA,0xA8,0xA5,0xA0,0xA6,0xA6,0xA6,0xA5,0x81,0xA9,
+            0x95,0xA8,0xA8,0xA3,0x9F,0xA0,0xA6,0x95,0x9D,0xA3,0x9C,0xA4,0xA3,0xA3,0x9A,0xA2,
+            0xA5,0x95,0x9F,0x9D,0xA1,0x93,0x91,0x8E,0x9E,0xA5,0xA3,0xA3,0xA4,0xA2,0xA3,0x95,
+            0x9E,0xA2,0xA5,0xA1,0xA6,0xA1,0xA5,0xA2,0xA4,0xA4,0xA5,0xA5,0xA4,0x9D,0xA4,0xA1,
+            0xA1,0xA5,0xA3,0xA4,0xA2,0xA0,0xA2,0xA4,0x8B,0x93,0xA3,0x9A,0xA1,0x9E,0x86,0x9E,
+            0x9C,0x9E,0x9A,0x94,0x9C,0x98,0x98,0x99,0x97,0x96,0x93,0x91,0x8D,0x88,0x82,0x74,
+            0x72,0x77,0x83,0x8B,0x83,0x95,0x95,0x99,0x7E,0x99,0x99,0x97,0x97,0x9D,0x9D,0x86,
+            0x82,0xA1,0xA3,0xA2,0x98,0xA5,0xA5,0xA3,0x87,0xA2,0xA2,0xA5,0x9F,0xA7,0xA5,0xA7,
+            0x84,0xA4,0xA5,0xA5,0xA3,0xA6,0xA7,0xA8,0x8B,0xA3,0xA9,0xA1,0xA2,0xA0,0x9C,0xA7,
+            0x90,0x9B,0xA3,0x9E,0xA3,0xAB,0xA1,0xA9,0x8C,0xA2,0xA1,0xA6,0x9C,0xA0,0xA1,0xA8,
+            0x6C,0x93,0xA5,0xA5,0x9B,0x9B,0xA0,0xA4,0x7A,0x90,0xA6,0xA4,0x93,0x9E,0xA9,0xA7,
+            0x96,0xA9,0xA6,0xA1,0xA3,0xA1,0xA7,0xA8,0x9A,0xA4,0xA6,0xA6,0xA8,0x9C,0xAB,0x9D,
+            0x99,0x98,0x9D,0x97,0x93,0xA0,0x93,0x9D,0x9A,0xA3,0xA5,0xA6,0x95,0x9A,0x91,0xA3,
+            0x99,0xA1,0x8D,0x92,0x94,0x9B,0x9F,0xA3,0x92,0xA6,0xA7,0xA5,0xA7,0xA6,0xA8,0xA9,
+            0x91,0xA6,0xA8,0x98,0xA3,0xA5,0xAC,0xA7,0x9A,0x9E,0xA8,0x97,0xA8,0x9E,0xA9,0xA8,
+            0x93,0xA7,0xA7,0xA6,0xA7,0xAC,0xA8,0xA6,0x9A,0xA3,0xAA,0xA8,0xA4,0xA7,0xA5,0xA7,
+            0x8C,0xA5,0xA9,0xAA,0xA6,0xA8,0xA9,0xAA,0x96,0xA8,0xA7,0xA7,0xA8,0xA7,0xAC,0xA7,
+            0x90,0xAB,0xA7,0xA7,0xA8,0xAA,0x9F,0x9F,0x83,0xA5,0xA2,0xA9,0xA3,0xA8,0xA3,0xA2,
+            0x92,0xA0,0xA6,0xA7,0x9F,0xA7,0x9D,0x9E,0x95,0xA5,0xA2,0xA4,0xA2,0xA3,0xA5,0xA3,
+            0x8A,0xA1,0xA4,0xA6,0xA2,0xA4,0xA6,0xA5,0x78,0xA5,0xA5,0xA2,0xA1,0xA5,0xA5,0xA2,
+            0x8D,0xA2,0x9B,0xA3,0xA3,0xA1,0xA2,0xA4,0x8F,0x9C,0xA2,0x9E,0xA1,0xA1,0x9D,0x9D,
+            0x8A,0x9E,0x9C,0x9A,0x9C,0x8F,0x99,0x9A,0x85,0x95,0x90,0x92,0x8F,0x89,0x80,0x77,
+            0x7A,0x7B,0x85,0x87,0x8C,0x8D,0x94,0x98,0x80,0x88,0x9B,0x93,0x94,0x94,0x9E,0x3C,
+            0x84,0xA0,0xA2,0xA3,0x98,0xA4,0xA3,0xA2,0x8C,0x9E,0xA4,0xA5,0x9C,0xA6,0xA4,0xA5,
+            0x8A,0xA0,0xA7,0xA0,0xA1,0x7E,0xA7,0xA6,0x92,0xA4,0xA9,0x9C,0xA2,0x94,0x4B,0xA5,
+            0x91,0x97,0xA3,0x9B,0xA0,0xA8,0xA7,0xA9,0x93,0x7B,0xA7,0x90,0xA3,0x7B,0xA3,0xA9,
+            0x8D,0x56,0x7B,0x89,0x58,0x5D,0x95,0x94,0x5B,0x70,0xA5,0xA5,0x82,0x91,0xA4,0xA7,
+            0x98,0xA5,0xA5,0xA4,0xA6,0xA2,0xA8,0xA7,0x9D,0xA8,0xA8,0xA4,0xA7,0xAB,0xAC,0xA7,
+            0x8F,0x9E,0xA9,0xA1,0xA2,0xA0,0x53,0xA5,0x9B,0x9A,0xA9,0xA7,0xA3,0xA3,0xA7,0x9E,
+            0x9A,0xA7,0xA1,0xA2,0x9E,0x9D,0xA1,0xA5,0x9F,0xA6,0xAC,0xA4,0xA9,0xA9,0xA6,0xA9,
+            0x8E,0x6B,0xAB,0x65,0xA5,0x70,0xAA,0xA7,0xA3,0x5F,0xAA,0x98,0xA7,0xA6,0xA7,0xA8,
+            0x56,0xA7,0xA5,0x99,0xAA,0xAB,0xA8,0xA7,0xA4,0xA3,0xAA,0xA6,0xA6,0xA7,0xA6,0xA8,
+            0xA0,0xA7,0xA7,0xA9,0xA5,0xA8,0xA9,0xAA,0xA4,0x93,0xA8,0xA9,0xA8,0xA8,0xAC,0xA8,
+            0xA0,0xA7,0xA8,0xA9,0xA7,0xAA,0xA6,0xA9,0x94,0x9C,0x99,0x9E,0xA6,0xA7,0xA2,0xA2,
+            0x97,0x6F,0x9F,0xA4,0x9F,0xA4,0xA1,0x68,0x9C,0xA6,0xA1,0xA3,0xA1,0xA4,0xA4,0xA2,
+            0x9D,0x92,0xA6,0xA5,0xA3,0xA6,0xA4,0xA6,0xA2,0xA2,0xA2,0xA4,0xA2,0xA4,0xA4,0xA3,
+            0x99,0xA4,0xA2,0x9F,0xA1,0xA2,0xA7,0xA1,0x97,0x9D,0xA0,0x9D,0xA2,0xA1,0xA0,0xA0,
+            0x95,0x9F,0x9A,0x9A,0x9D,0x9B,0x98,0x86,0x95,0x97,0x92,0x91,0x8E,0x89,0x82,0x78,
+            0x7A,0x7B,0x84,0x8B,0x83,0x94,0x87,0x98,0x7E,0x9A,0x8F,0x9C,0x89,0x9E,0x8A,0x89,
+            0x82,0xA0,0xA3,0xA3,0x8B,0xA3,0x8D,0xA4,0x88,0x9F,0xA3,0xA4,0x8D,0xA5,0x8E,0xA5,
+            0x87,0xA6,0xA4,0xA7,0x90,0xA6,0x91,0xA6,0x8C,0xA6,0xA6,0xAA,0x91,0xA4,0x91,0xA7,
+            0x8B,0x9C,0xA5,0xA4,0x92,0xA7,0x93,0xAA,0x92,0xA7,0xA5,0xA7,0x92,0xA7,0x93,0xA7,
+            0x8E,0x97,0xA0,0xA6,0x93,0x9D,0x97,0xA4,0x81,0x91,0xA8,0xA5,0x90,0x9D,0x98,0xAA,
+            0x93,0xA7,0xA6,0xA4,0x99,0xA4,0x8A,0xA6,0x98,0xAC,0xA7,0xA8,0x99,0xA9,0x99,0x9F,
+            0x96,0xA7,0x9F,0xA2,0x9B,0x98,0x8C,0xA5,0x96,0xA1,0xA7,0xAA,0x9A,0xA6,0x99,0x9F,
+            0x97,0xA9,0x9D,0xA5,0x97,0x9E,0x9A,0xA4,0x99,0xA8,0xA7,0xA3,0x9C,0xA8,0x9B,0xA9,
+            0x99,0xA4,0xAA,0x9B,0xA6,0xA5,0xAA,0xA7,0xA2,0x98,0xA8,0x9B,0xA7,0x9C,0xA6,0xA8,
+            0xA4,0xA8,0xA9,0x9E,0xAB,0xA8,0xA6,0xAA,0xA6,0xA7,0xAA,0xA8,0xA9,0xA8,0xA8,0xA7,
+            0xA0,0xAA,0xA9,0xA8,0xA8,0xA4,0xA9,0xA8,0xA5,0xAA,0xAB,0xA9,0xAA,0xA8,0xA8,0xAB,
+            0xA6,0xAB,0xA9,0xA4,0xA9,0xA9,0xA7,0xA8,0xA2,0xA6,0xA4,0xA6,0xA7,0xA6,0xA6,0xA2,
+            0x89,0x8E,0x92,0xA5,0xA1,0xA4,0xA3,0x9D,0x9D,0x9A,0x9D,0xA1,0xA3,0xA4,0xA1,0xA6,
+            0xA0,0x9D,0x9F,0x96,0xA3,0xA4,0xA5,0xA5,0xA4,0xA5,0xA1,0x9F,0xA2,0x97,0xA6,0xA2,
+            0x9B,0x9E,0x9E,0x9D,0x9C,0x93,0x9F,0xA2,0x95,0x9D,0x9F,0x9D,0x9F,0x9D,0x99,0x9F,
+            0x99,0x9C,0x9B,0x9B,0x9C,0x9C,0x98,0x97,0x94,0x93,0x91,0x91,0x8D,0x89,0x81,0x78,
+            0x6B,0x68,0x71,0x7A,0x77,0x83,0x84,0x85,0x6F,0x85,0x8A,0x8D,0x82,0x8F,0x8F,0x74,
+            0x77,0x8F,0x8D,0x91,0x89,0x8E,0x91,0x8F,0x7E,0x93,0x94,0x92,0x8E,0x94,0x93,0x94,
+            0x7B,0x93,0x94,0x94,0x8F,0x94,0x95,0x95,0x81,0x94,0x95,0x97,0x90,0x95,0x96,0x96,
+            0x81,0x7D,0x90,0x96,0x90,0x97,0x97,0x98,0x8A,0x90,0x97,0x94,0x93,0x95,0x98,0x97,
+            0x87,0x7A,0x95,0x95,0x7F,0x85,0x98,0x99,0x60,0x77,0x92,0x96,0x70,0x83,0x97,0x99,
+            0x7E,0x95,0x98,0x91,0x98,0x97,0x99,0x98,0x8B,0x98,0x9A,0x7D,0x9A,0x96,0x9A,0x99,
+            0x8F,0x97,0x99,0x98,0x7B,0x95,0x7D,0x9A,0x91,0x97,0x98,0x9C,0x9A,0x9B,0x9C,0x98,
+            0x90,0x99,0x95,0x97,0x8E,0x8E,0x99,0x9A,0x94,0x9D,0x91,0x9C,0x9B,0x9C,0x9D,0x9B,
+            0x8D,0x93,0x9A,0x80,0x93,0x8A,0x9D,0x9C,0x95,0x7F,0x99,0x7F,0x9D,0x93,0x9D,0x9C,
+            0x99,0x9C,0x9C,0x9D,0x9C,0x9C,0x9A,0x9D,0x9C,0x9C,0x9E,0x9D,0x9C,0x9E,0x9D,0x9D,
+            0x99,0x9E,0x9D,0x9B,0x9D,0x9E,0x9E,0x9E,0x99,0x9C,0x9E,0x9D,0x9E,0x9D,0x9D,0x9D,
+            0x9B,0x9F,0x9E,0x9D,0x9C,0x9C,0x9E,0x9E,0x94,0x92,0x8C,0x9D,0x9E,0x9E,0x8A,0x98,
+            0x84,0x92,0x9B,0x90,0x94,0x94,0x8D,0x8B,0x95,0x8A,0x99,0x96,0x9A,0x9B,0x9A,0x95,
+            0x96,0x98,0x8C,0x96,0x9B,0x9A,0x9C,0x9B,0x96,0x9A,0x99,0x8E,0x95,0x94,0x96,0x9A,
+            0x94,0x9C,0x9D,0x98,0x89,0x94,0x9B,0x9A,0x77,0x83,0x99,0x8D,0x94,0x8A,0x9A,0x97,
+            0x8F,0x95,0x8E,0x88,0x96,0x93,0x8C,0x91,0x8C,0x8E,0x8A,0x8A,0x83,0x81,0x7B,0x6A,
+            0x79,0x76,0x84,0x8B,0x88,0x95,0x94,0x99,0x85,0x9B,0x99,0x9C,0x98,0x9C,0x9B,0x89,
+            0x89,0x9E,0xA0,0xA1,0x98,0xA0,0x9B,0x9D,0x95,0xA3,0xA2,0xA6,0xA0,0xA4,0xA2,0xA2,
+            0x8C,0x97,0xA1,0xA5,0xA2,0xA6,0xA6,0xA5,0x9A,0xA5,0xA4,0xA3,0xA5,0x9C,0xA7,0xA7,
+            0x98,0x9D,0xA4,0xA0,0xA0,0xA7,0xA8,0xA7,0x9C,0xA7,0xA6,0xA7,0xA5,0xA5,0xA7,0xA1,
+            0x97,0x95,0xA4,0xA2,0x94,0x9D,0xA5,0xA4,0x82,0x91,0xA0,0xA4,0x8D,0x9C,0xA6,0xA2,
+            0x99,0xA1,0xA3,0xA0,0x9B,0xA2,0xA8,0xA2,0xA0,0xA1,0xA7,0xA6,0x9C,0xA5,0xA0,0xA0,
+            0x9B,0x9E,0xA0,0x99,0x9A,0x9D,0x93,0x9B,0xA3,0xA5,0xA5,0xA8,0x96,0x9A,0x8B,0x97,
+            0x9B,0xA8,0x99,0x99,0x92,0x9F,0x9F,0xA1,0x9E,0xA6,0xA0,0xA8,0xA2,0xA6,0xA7,0xA3,
+            0x9D,0x9F,0xA8,0x9B,0xA0,0x9B,0xA7,0xA6,0xA5,0x9D,0xA8,0x9B,0xA2,0xA0,0xA9,0xA5,
+            0x9C,0xA9,0xA6,0xA8,0xA3,0xA3,0xA5,0xA9,0xA4,0xA3,0xA6,0xA5,0xA2,0xA8,0xA7,0xA6,
+            0xA0,0xA6,0xA6,0xA9,0xA3,0xA6,0xA8,0xA7,0xA7,0xA7,0xA7,0xA9,0xA5,0xA6,0xA8,0xA8,
+            0xA5,0xA8,0xA9,0xA7,0xA3,0xA5,0x9C,0x9A,0x9C,0xA4,0xA2,0xA5,0x9E,0xA7,0xA4,0xA4,
+            0x78,0x91,0x93,0x96,0x99,0x91,0x94,0x95,0x87,0x83,0x90,0x82,0x9C,0x9A,0x99,0x93,
+            0x8C,0x8D,0x82,0x98,0x96,0x98,0x9A,0x9A,0x93,0x9B,0x94,0x8D,0x7F,0x9A,0x9E,0x9D,
+            0x96,0x9C,0x9B,0x89,0x88,0x7F,0x9B,0x9C,0x91,0x98,0x9B,0x9A,0x7F,0x88,0x96,0x98,
+            0x90,0x97,0x92,0x98,0x97,0x92,0x8A,0x95,0x90,0x91,0x90,0x91,0x8C,0x87,0x81,0x76,
+            0x64,0x66,0x7E,0x84,0x81,0x86,0x89,0x94,0x81,0x8D,0x94,0x96,0x88,0x9A,0x9C,0x8F,
+            0x84,0x9F,0xA0,0x95,0x99,0x9B,0xA1,0xA1,0x8D,0xA4,0xA1,0xA3,0x9E,0xA4,0x9F,0x9F,
+            0x8E,0xA5,0x94,0xA3,0xA0,0xA6,0xA5,0xA5,0x94,0xA4,0xA6,0xA5,0x9F,0xA6,0xA6,0xA3,
+            0x95,0x9D,0xA5,0xA7,0xA2,0xA5,0xA8,0xA8,0x9C,0xA5,0xA6,0xA4,0xA3,0xA2,0xA5,0xA1,
+            0x92,0x95,0xA5,0xA6,0x9A,0xA0,0xA5,0xA5,0x81,0x92,0xA4,0xA4,0x93,0x99,0xA5,0xA5,
+            0x9A,0xA6,0xA3,0xA6,0xA5,0xA4,0xA7,0xA8,0x9A,0xA0,0xA4,0xA6,0xA3,0xA6,0xA7,0xA9,
+            0xA1,0xA5,0xA5,0xA2,0xA4,0xA4,0x92,0xA6,0xA3,0xA5,0xA4,0xA8,0xA4,0xA4,0xA4,0xA3,
+            0xA1,0xA9,0xA7,0xA7,0xA3,0xA1,0xA3,0xA4,0xA0,0xA7,0xA8,0xA9,0xA7,0xA3,0xA6,0xA3,
+            0x9C,0xA4,0xA7,0x9B,0x9D,0xA1,0xA9,0xA4,0xA5,0x9E,0xA8,0x97,0x9B,0x9F,0xA7,0xA4,
+            0xA2,0xA8,0xA8,0xA9,0xA6,0xA8,0xA7,0xA5,0xA7,0xA5,0xA4,0xA8,0xA3,0xA9,0xA6,0xA6,
+            0xA3,0xA7,0xA5,0xA8,0xA7,0xA9,0xA6,0xA8,0xA6,0xA8,0xA8,0xA5,0xA6,0xA8,0xA8,0xA5,
+            0xA5,0xA8,0xA9,0xA7,0xA3,0xA8,0xA8,0xA3,0xA3,0xA7,0xA2,0xA6,0xA7,0xAA,0xA5,0xA0,
+            0x96,0x9C,0x9F,0xA4,0xA1,0xA3,0xA0,0xA1,0x97,0xA1,0x9C,0xA0,0xA3,0xA3,0xA3,0xA5,
+            0x98,0x9E,0x9B,0xA3,0xA3,0xA3,0xA3,0xA2,0xA2,0x9A,0x9F,0xA3,0xA2,0xA2,0xA2,0xA2,
+            0x9C,0xA0,0xA3,0xA1,0x91,0xA0,0x9D,0xA3,0x98,0x9C,0xA0,0x9B,0xA0,0x96,0x9F,0x9F,
+            0x97,0x9D,0x9D,0x99,0x9A,0x9B,0x97,0x9A,0x92,0x95,0x94,0x90,0x8D,0x89,0x83,0x75,
+            0x7C,0x7C,0x86,0x8B,0x88,0x94,0x95,0x98,0x76,0x97,0x99,0x9C,0x8E,0x9E,0xA0,0x90,
+            0x77,0xA0,0x9E,0xA4,0x94,0xA1,0xA5,0xA2,0x7E,0xA4,0xA0,0xA4,0x98,0xA4,0xA6,0xA4,
+            0x7B,0xA7,0xA7,0xA6,0x9D,0xA8,0xA6,0xA6,0x82,0xA5,0xA7,0xA4,0x9C,0xA4,0xA2,0xA7,
+            0x84,0x9B,0xA6,0xA3,0x9D,0xA7,0xA4,0xAB,0x8A,0xA7,0xA5,0xA7,0x9E,0xA7,0xA7,0xA7,
+            0x8B,0x94,0xA4,0xA4,0x98,0x9C,0xA4,0xA8,0x7F,0x90,0xA4,0xA5,0x92,0x9C,0xA6,0xA7,
+            0x8A,0xA7,0xA1,0xA1,0x9D,0x9F,0xA7,0xA3,0x8E,0xA1,0xA6,0xA5,0x9A,0xA6,0x99,0x9F,
+            0x8F,0xA6,0xA6,0xA4,0xA4,0x9E,0x98,0xA6,0x91,0xA5,0xA7,0xA4,0xA2,0xA1,0x9E,0xA2,
+            0x92,0xA9,0xA4,0xA3,0xA0,0xA1,0xA7,0xA3,0x93,0xA9,0xA8,0xA6,0xA3,0xA7,0xA7,0xA7,
+            0x9C,0xA6,0xA5,0x99,0xA3,0xA3,0xA4,0xA6,0xA7,0x9B,0xA7,0x9A,0xA4,0xA4,0xAA,0xA9,
+            0xA3,0xA9,0xA9,0xA8,0xA6,0xA8,0xA6,0xA8,0xA7,0xA6,0xA8,0xA6,0xA2,0xA8,0xA7,0xA8,
+            0xA5,0xA7,0xA6,0xA9,0xA9,0xA7,0xAC,0xAA,0xA5,0xA6,0xA7,0xA7,0xA6,0xA2,0xA9,0xA8,
+            0xA6,0xAC,0xA6,0xA7,0xA3,0xA8,0xA7,0xA3,0xA0,0xA8,0xA6,0xA6,0xA8,0xA6,0xA6,0xA4,
+            0x89,0x7D,0x8A,0x99,0x98,0x9A,0x9A,0x9A,0x95,0x8D,0x92,0x9C,0x9E,0x9F,0x9B,0x9E,
+            0x8F,0x9A,0x94,0x7E,0x9A,0xA1,0x9C,0x9A,0x96,0x99,0x9F,0x97,0x95,0x7D,0x9E,0x9B,
+            0x91,0x9C,0x9F,0x9E,0x92,0x92,0xA1,0x9F,0x90,0x95,0x9E,0x99,0x9C,0x92,0x9A,0x98,
+            0x8B,0x97,0x98,0x99,0x98,0x99,0x92,0x93,0x89,0x8F,0x92,0x91,0x8B,0x88,0x80,0x75,
+            0x79,0x7A,0x83,0x87,0x8C,0x89,0x92,0x8D,0x90,0x92,0x92,0x8F,0x95,0x98,0x96,0x85,
+            0x90,0x95,0x9B,0x99,0x9D,0x93,0x9B,0x93,0x9B,0x9C,0xA2,0xA4,0x9D,0x9B,0x9F,0x9E,
+            0x97,0xA2,0xA6,0xA0,0x52,0x9E,0xA5,0xA2,0x9A,0x9E,0xA0,0x9B,0xA1,0x94,0xA1,0x9D,
+            0x95,0x91,0xA1,0x9E,0x9D,0x9C,0xA5,0x92,0x92,0x9A,0x9E,0xA1,0x9F,0x99,0x9E,0xA9,
+            0x8E,0x8A,0xA2,0xA6,0x93,0x91,0xA0,0xA8,0x7C,0x8C,0xA0,0xA6,0x80,0x99,0x9D,0xA5,
+            0xA1,0xA2,0xA1,0xA3,0xA6,0xA1,0xA8,0xA6,0x99,0xA5,0xA9,0xA7,0xA8,0xA7,0xA5,0xA2,
+            0xA8,0x98,0xA5,0xA6,0x9A,0x8F,0x91,0xA8,0xA5,0x95,0xA3,0xA7,0x8B,0x96,0xA5,0x94,
+            0xA2,0xA7,0xA3,0x9C,0x9A,0x96,0x8E,0x9E,0xA4,0x9E,0xA8,0xAA,0xA6,0xA7,0xA7,0xA9,
+            0x9C,0x9D,0xA2,0x91,0x9F,0x90,0x8C,0x86,0xA4,0x8F,0xA9,0x8F,0x9E,0x9C,0xA7,0xA6,
+            0xA2,0xA3,0xA8,0xA5,0xA2,0xA0,0x9F,0xA6,0xA6,0xA5,0xAC,0xA7,0xA3,0xA3,0xA8,0xA8,
+            0xA5,0xA7,0xA7,0xA4,0xA7,0xA6,0xA8,0xA9,0xA3,0xA5,0xA7,0xA9,0xA8,0x9C,0x80,0xA9,
+            0xA4,0xA5,0xA2,0xA5,0x9D,0x87,0xA8,0xA0,0x9E,0xA2,0x9D,0xA6,0xA3,0xA5,0xA2,0xA2,
+            0x7B,0x6F,0x7B,0x7E,0x82,0x82,0x7D,0x84,0x8B,0x92,0x88,0x90,0x94,0x92,0x96,0x8E,
+            0x93,0x93,0x9A,0x95,0x9A,0x97,0x9D,0x9F,0x9C,0x9B,0x9D,0x9D,0x7C,0x96,0x9F,0x9E,
+            0x9A,0x9E,0x98,0x99,0x9C,0x94,0x9B,0x9E,0x8E,0x87,0x9A,0x94,0x7C,0x9A,0x83,0x9B,
+            0x96,0x99,0x9A,0x92,0x96,0x96,0x95,0x96,0x92,0x92,0x91,0x91,0x8E,0x87,0x81,0x75,
+            0x6A,0x7D,0x86,0x89,0x88,0x95,0x93,0x99,0x78,0x99,0x9C,0x97,0x92,0x9F,0x9E,0x8D,
+            0x7B,0xA1,0xA0,0xA3,0x98,0x9E,0xA3,0xA3,0x82,0xA6,0xA2,0xA3,0xA0,0xA4,0xA4,0xA4,
+            0x84,0xA7,0xA6,0xA7,0xA4,0xA8,0xA8,0xA7,0x89,0xA6,0xA6,0xA2,0xA3,0xA3,0xA3,0xA6,
+            0x8A,0x9A,0xA5,0x8F,0x9A,0xA8,0xA3,0xAB,0x89,0xA3,0xA4,0xA7,0xA2,0xA2,0xA8,0xA7,
+            0x6E,0x96,0xA7,0xA7,0x9B,0x9F,0x9E,0xA6,0x7F,0x92,0xA5,0xA7,0x94,0x9C,0xA8,0xA9,
+            0x92,0xA7,0xA7,0xA7,0xA0,0xA7,0xAA,0xA4,0x95,0xA4,0xA8,0xA9,0xA2,0xAA,0xA2,0xA7,
+            0x96,0x97,0xA0,0xA4,0x9F,0x93,0x95,0xA6,0x93,0x9C,0xA7,0xA4,0xA2,0x9E,0xA5,0x9C,
+            0x94,0xAA,0xA0,0xA1,0x9C,0x9F,0xA5,0xA4,0x9B,0xAC,0xA5,0xA7,0xA9,0xA7,0xA6,0xAA,
+            0x95,0xA5,0xA8,0x9B,0xA4,0x9D,0xA7,0xAA,0x99,0x9D,0xA9,0x9B,0xA5,0xA2,0xAA,0xA6,
+            0x91,0xA8,0xA7,0xAA,0xA6,0xA8,0xA5,0xA9,0x98,0xA7,0xA8,0xAA,0x9B,0xAA,0xA8,0xA7,
+            0x90,0xA5,0xA7,0xA8,0xA6,0xA8,0xA9,0xA8,0x99,0xA8,0xAB,0xA9,0xA8,0xA7,0xA9,0xA7,
+            0x90,0xA8,0xA5,0xA9,0xA7,0xAB,0x9A,0x9A,0x96,0xA6,0xA3,0xA7,0x98,0xA9,0xA3,0xA5,
+            0x8D,0x97,0xA0,0xA4,0xA0,0xA5,0x9C,0x9F,0x93,0xA2,0x9C,0x9A,0xA0,0xA0,0xA2,0xA7,
+            0x97,0xA2,0x9F,0x9B,0xA1,0xA0,0xA4,0xA5,0x9A,0xA3,0x9D,0x90,0x9E,0x97,0xA2,0xA1,
+            0x98,0x9A,0x9C,0xA4,0x9E,0xA2,0xA1,0xA2,0x98,0x9A,0xA0,0x9B,0xA1,0x9F,0x9E,0x9B,
+            0x93,0x9D,0x9B,0x9B,0x9C,0x8B,0x99,0x99,0x91,0x95,0x92,0x91,0x8E,0x88,0x81,0x74,
+            0x7A,0x7B,0x85,0x8A,0x85,0x8F,0x93,0x95,0x75,0x98,0x96,0x98,0x8D,0x99,0x9D,0x8A,
+            0x7D,0xA0,0x9D,0xA4,0x92,0x99,0xA2,0x9E,0x85,0xA4,0x9E,0xA4,0x93,0xA2,0xA6,0x9F,
+            0x82,0xA4,0xA1,0xA7,0x97,0xA7,0xA5,0xA1,0x8B,0xA6,0xA2,0xA5,0x99,0xA2,0xA5,0xA4,
+            0x8B,0x9C,0xA6,0x9F,0x99,0xA6,0xA6,0xA4,0x91,0xA3,0xA5,0xA7,0x9B,0xA4,0xA6,0xA3,
+            0x8C,0x92,0x9D,0x97,0x81,0x93,0x9E,0x9E,0x7E,0x8F,0x9E,0x9B,0x86,0x98,0x9C,0x98,
+            0x8B,0xA5,0xA3,0xA1,0x91,0x9F,0xA2,0xA2,0x93,0xA7,0xA2,0xA2,0x90,0xA3,0xA6,0x9D,
+            0x88,0x95,0xA3,0x99,0x8D,0x94,0x91,0x94,0x94,0x9D,0xA5,0x9E,0x90,0xA0,0xA2,0x93,
+            0x98,0xA6,0x9F,0x97,0x89,0x96,0x9A,0xA0,0x97,0xA8,0xA5,0x9F,0x90,0xA4,0xA4,0xA5,
+            0x96,0x9F,0xA2,0x92,0x8B,0x96,0xA4,0xA1,0x9E,0x98,0xA5,0x94,0x81,0x98,0xA5,0xA1,
+            0x93,0xA7,0xA6,0x9D,0x96,0x9F,0xA7,0xA5,0xA4,0xA5,0xA5,0xA1,0x94,0xA1,0xA8,0xA5,
+            0x9C,0xA5,0xA3,0xA1,0x96,0xA0,0xA7,0xA6,0xA2,0xA5,0xA6,0xA1,0x81,0xA1,0xA6,0xA4,
+            0x9D,0xAA,0xA3,0x9F,0x99,0xA2,0xA5,0xA6,0x9E,0xA5,0x9F,0x9F,0x93,0xA0,0xA4,0xA5,
+            0x6E,0x76,0x78,0x7E,0x86,0x79,0x76,0x7A,0x73,0x84,0x80,0x8D,0x90,0x89,0x87,0x85,
+            0x7B,0x88,0x84,0x94,0x94,0x90,0x8F,0x90,0x7F,0x8B,0x87,0x93,0x98,0x92,0x8C,0x90,
+            0x81,0x8F,0x8B,0x96,0x99,0x95,0x92,0x93,0x82,0x8D,0x8D,0x97,0x99,0x94,0x93,0x96,
+            0x83,0x8E,0x8B,0x96,0x97,0x94,0x90,0x91,0x82,0x8A,0x8A,0x8F,0x8C,0x87,0x80,0x74,
+            0x77,0x79,0x7D,0x7E,0x70,0x6D,0x80,0x81,0x75,0x91,0x83,0x8E,0x78,0x7C,0x8C,0x7E,
+            0x7A,0x94,0x8C,0x98,0x79,0x81,0x94,0x90,0x7C,0x9C,0x8A,0x9A,0x79,0x88,0x97,0x93,
+            0x81,0x99,0x90,0x9C,0x77,0x8A,0x96,0x94,0x82,0x96,0x8C,0x9E,0x7A,0x8A,0x99,0x98,
+            0x87,0x94,0x93,0x9A,0x85,0x8C,0x9C,0x99,0x86,0x9D,0x8F,0x9E,0x85,0x8A,0x9F,0x90,
+            0x83,0x8F,0x8E,0x8A,0x73,0x81,0x91,0x82,0x7A,0x89,0x88,0x88,0x75,0x85,0x8A,0x82,
+            0x83,0x90,0x87,0x8D,0x78,0x88,0x8C,0x8E,0x87,0x93,0x8A,0x8E,0x78,0x89,0x8D,0x8D,
+            0x8A,0x95,0x8E,0x8C,0x78,0x89,0x8A,0x8D,0x8A,0x93,0x8F,0x91,0x7B,0x88,0x87,0x8D,
+            0x83,0x94,0x89,0x90,0x7E,0x88,0x8F,0x8C,0x88,0x95,0x8E,0x93,0x80,0x8B,0x91,0x8E,
+            0x8F,0x9C,0x9A,0x8C,0x74,0x88,0x96,0x8D,0x96,0x97,0x9B,0x90,0x79,0x89,0x99,0x90,
+            0x95,0xA0,0x97,0x92,0x7A,0x88,0x9A,0x92,0x99,0x9F,0x97,0x93,0x79,0x89,0x9A,0x8F,
+            0x97,0x9C,0x98,0x94,0x79,0x87,0x99,0x8E,0x96,0xA0,0x98,0x94,0x79,0x88,0x9D,0x93,
+            0x94,0x98,0x96,0x94,0x78,0x88,0x99,0x90,0x93,0x9E,0x96,0x96,0x76,0x87,0x9A,0x91,
+            0x94,0x86,0x89,0x8D,0x8D,0x89,0x8C,0x8F,0x7A,0x95,0x85,0x8D,0x8F,0x90,0x8F,0x91,
+            0x7A,0x86,0x95,0x8B,0x90,0x8F,0x93,0x93,0x78,0x86,0x8A,0x9B,0x8F,0x92,0x93,0x95,
+            0x85,0x8B,0x8A,0x8B,0x9B,0x92,0x93,0x95,0x8A,0x8D,0x8C,0x8A,0x8D,0x9C,0x94,0x95,
+            0x88,0x8F,0x8C,0x8E,0x8E,0x8D,0x96,0x91,0x88,0x8C,0x8C,0x8B,0x88,0x85,0x81,0x74,
+            0x6C,0x5A,0x6F,0x77,0x76,0x81,0x82,0x85,0x6C,0x89,0x8F,0x8E,0x80,0x94,0x8D,0x6C,
+            0x73,0x98,0x91,0x95,0x8C,0x94,0x98,0x8C,0x7A,0x9F,0xA0,0x9A,0x90,0x9F,0x9D,0x98,
+            0x79,0x99,0x9F,0x9F,0x91,0x9C,0xA1,0x9F,0x7E,0x9B,0x9F,0xA0,0x94,0x98,0x99,0xA1,
+            0x80,0x86,0x98,0xA2,0x99,0xA5,0xA2,0xA1,0x88,0x93,0x9C,0x9F,0x86,0x8F,0xA2,0xA0,
+            0x85,0x79,0x9B,0x88,0x7C,0x86,0xA2,0xA1,0x5F,0x76,0x96,0x9D,0x6C,0x84,0x99,0xA3,
+            0x84,0xA3,0x9F,0x9F,0x9C,0x9B,0xA4,0xA2,0x91,0x94,0xA4,0x8C,0xA0,0xA3,0xA8,0xA0,
+            0x8D,0x98,0x8E,0x9C,0x92,0x93,0x79,0xA4,0x91,0xA1,0x96,0xA3,0x9A,0x9A,0xA8,0x9E,
+            0x8D,0xA3,0x92,0x97,0x89,0x89,0xA1,0xA0,0x94,0xA4,0xA3,0xA4,0xA4,0xA4,0xA2,0x9B,
+            0x89,0x96,0x9F,0x86,0x96,0x89,0xA3,0xA2,0x94,0x7D,0x9E,0x80,0xA4,0x90,0xA4,0xA4,
+            0x9B,0xA4,0xA5,0xA6,0xA7,0xA9,0xA7,0xAA,0xA5,0xA6,0xA7,0xA8,0xA5,0xA8,0xA9,0xA5,
+            0x9E,0xA7,0xA6,0xA7,0xA8,0xA7,0xA8,0xA8,0x9F,0x9F,0xA9,0xA8,0xA5,0xA5,0xA7,0xA6,
+            0x9F,0xA6,0xA5,0xA5,0xA4,0xA7,0xA5,0xA5,0x98,0x8F,0x8B,0xA0,0xA4,0xA2,0x8F,0x98,
+            0x75,0x80,0x8B,0x8A,0x89,0x87,0x85,0x83,0x7F,0x81,0x94,0x93,0x9A,0x94,0x9C,0x99,
+            0x89,0x8D,0x86,0x7B,0x74,0x7B,0x95,0x99,0x94,0x95,0x85,0x78,0x9A,0x93,0x9C,0x99,
+            0x8A,0x8E,0x8E,0x8D,0x73,0x93,0x90,0x93,0x74,0x7F,0x94,0x89,0x95,0x7A,0x9A,0x94,
+            0x87,0x94,0x89,0x81,0x93,0x91,0x88,0x8A,0x85,0x8B,0x82,0x82,0x7F,0x7D,0x76,0x67,
+            0x7C,0x78,0x84,0x85,0x85,0x91,0x93,0x96,0x7C,0x97,0x99,0x98,0x92,0x9E,0x9F,0x8E,
+            0x81,0x9E,0xA2,0xA3,0x95,0xA0,0x99,0x94,0x87,0xA4,0xA5,0xA2,0x95,0xA3,0xA3,0xA0,
+            0x86,0x90,0xA0,0xA5,0x9C,0xA6,0xA5,0xA4,0x90,0xA5,0xA5,0xA4,0x92,0xA3,0xA5,0xA6,
+            0x8D,0x9C,0xA6,0xA3,0xA2,0xA8,0xA7,0xA6,0x94,0xA1,0xA8,0xA4,0xA2,0xA4,0xA7,0xA6,
+            0x93,0x96,0xA6,0xA5,0x99,0x9E,0xA5,0xA9,0x82,0x92,0xA6,0xA8,0x93,0x9C,0xA5,0xA9,
+            0x95,0xA5,0xA6,0xA6,0xA2,0xA5,0xA7,0xA5,0x9C,0x98,0xA6,0xA4,0xA6,0xA7,0xA9,0xA9,
+            0x96,0xA6,0x9C,0xA7,0xA5,0xA6,0x95,0xA7,0x9F,0xA8,0xA6,0xA7,0xA4,0xA5,0xA8,0xA9,
+            0x98,0xA8,0x9F,0xA1,0xA2,0x9E,0xA8,0xA7,0x9E,0xA8,0xA8,0xA4,0x98,0xA0,0xA4,0xA6,
+            0x9D,0xA2,0xA5,0x9D,0xA1,0xA3,0xA8,0xA4,0xA4,0x9E,0xA8,0x9A,0xA8,0x9E,0xA9,0xA9,
+            0x9E,0xA4,0xA3,0xA7,0xA7,0xA8,0xA3,0xA9,0xA6,0xA2,0xAA,0xA8,0xA7,0xA7,0xA7,0xA7,
+            0xA0,0xA6,0xA9,0xA7,0xA7,0xA7,0xA0,0xA6,0xA4,0xA5,0xA7,0xA8,0xA9,0xA6,0xA6,0xA7,
+            0xA7,0xA8,0xA2,0xA7,0xA8,0xA7,0xA7,0xA1,0x8B,0xA3,0xA2,0xA7,0x96,0xA3,0xA3,0xA2,
+            0xA2,0xA5,0xA8,0xA6,0xA2,0xA3,0xA3,0xA3,0xA5,0xA7,0xA2,0xA6,0xA6,0xA3,0xA6,0xA5,
+            0x8E,0x94,0x98,0x96,0x98,0x9A,0x9C,0x99,0xA3,0xA5,0xA5,0xA6,0xA4,0xA3,0xA4,0xA1,
+            0x83,0x95,0x95,0x98,0x97,0x98,0x9C,0x9C,0x96,0x9B,0xA2,0xA0,0xA0,0xA0,0xA0,0x9F,
+            0x88,0x90,0x89,0x89,0x8C,0x93,0x97,0x97,0x91,0x94,0x92,0x91,0x8B,0x87,0x81,0x73,
+            0x7A,0x76,0x84,0x81,0x7F,0x85,0x88,0x8E,0x7A,0x8D,0x8B,0x90,0x88,0x8E,0x8B,0x7E,
+            0x7F,0x8F,0x81,0x90,0x8C,0x91,0x8F,0x90,0x84,0x92,0x8E,0x8F,0x90,0x8E,0x92,0x94,
+            0x84,0x91,0x95,0x93,0x91,0x95,0x91,0x95,0x88,0x91,0x97,0x95,0x93,0x98,0x95,0x93,
+            0x8C,0x93,0x97,0x95,0x97,0x98,0x98,0x9A,0x91,0x99,0x95,0x99,0x98,0x9A,0x99,0x99,
+            0x91,0x92,0x98,0x9D,0x95,0x8A,0x9A,0x9C,0x80,0x8E,0x99,0x9A,0x90,0x8E,0x9A,0x9D,
+            0x90,0x9C,0x9C,0x9D,0x9A,0x9B,0x9C,0x9D,0x94,0x90,0x9D,0x9B,0x9A,0x9D,0x9C,0x9C,
+            0x96,0x93,0x9D,0x99,0x99,0x85,0x8E,0x99,0x98,0x92,0x9A,0x9D,0x9C,0x97,0x98,0x92,
+            0x94,0x9E,0x97,0x98,0x94,0x95,0x9C,0x9C,0x9B,0x99,0x9F,0x9F,0x9E,0x98,0x9E,0xA0,
+            0x95,0x9D,0xA2,0x98,0x9E,0x9C,0xA1,0xA0,0x9C,0x92,0xA0,0x97,0x9E,0x9C,0xA1,0x9F,
+            0x9D,0x9E,0x9F,0xA1,0xA0,0xA0,0x9F,0xA1,0xA1,0x9D,0xA2,0x9F,0x9F,0xA0,0x9F,0x9E,
+            0x9C,0x9E,0x9E,0xA0,0x9B,0x9C,0x9F,0x9C,0x9D,0x9C,0x9D,0x9B,0x9A,0x9D,0x9B,0x9D,
+            0x9D,0x9F,0x99,0x9C,0x9D,0x9D,0x9F,0x9D,0x99,0x9F,0x97,0x96,0x9C,0x98,0x9B,0x97,
+            0x97,0x9A,0x9B,0x99,0x96,0x92,0x95,0x97,0x98,0x9B,0x97,0x97,0x9A,0x9A,0x99,0x98,
+            0x81,0x87,0x83,0x8E,0x8C,0x86,0x8A,0x8E,0x92,0x98,0x95,0x97,0x91,0x92,0x96,0x93,
+            0x77,0x7B,0x7B,0x74,0x85,0x77,0x88,0x82,0x8F,0x92,0x8E,0x93,0x94,0x92,0x8C,0x8D,
+            0x83,0x88,0x8B,0x8C,0x8E,0x85,0x90,0x8E,0x84,0x94,0x91,0x92,0x8A,0x86,0x82,0x74,
+            0x7B,0x78,0x84,0x82,0x7E,0x86,0x88,0x88,0x6E,0x8A,0x8C,0x8D,0x85,0x89,0x8F,0x84,
+            0x6F,0x8F,0x8E,0x8D,0x87,0x8E,0x8F,0x8B,0x74,0x90,0x8F,0x8F,0x8C,0x92,0x92,0x8E,
+            0x75,0x90,0x93,0x90,0x8C,0x92,0x94,0x91,0x7B,0x93,0x91,0x91,0x8E,0x94,0x93,0x92,
+            0x7B,0x91,0x92,0x94,0x8F,0x96,0x92,0x94,0x80,0x94,0x93,0x96,0x92,0x96,0x97,0x94,
+            0x80,0x8F,0x99,0x96,0x8C,0x94,0x97,0x98,0x7A,0x8C,0x95,0x96,0x8E,0x93,0x96,0x97,
+            0x85,0x99,0x97,0x98,0x95,0x96,0x99,0x97,0x88,0x93,0x98,0x9A,0x98,0x9B,0x99,0x98,
+            0x85,0x94,0x96,0x95,0x98,0x90,0x93,0x9B,0x88,0x96,0x99,0x98,0x96,0x97,0x9A,0x9A,
+            0x8B,0x9C,0x9A,0x93,0x8B,0x93,0x99,0x9A,0x8C,0x9B,0x9E,0x9D,0x9A,0x9B,0x9D,0x9E,
+            0x9C,0xA1,0xA6,0x9B,0xA4,0xA1,0xA5,0xA2,0xA0,0x9A,0xA3,0x95,0xA4,0x9E,0xA5,0xA3,
+            0x9E,0xA1,0xA4,0xA6,0xA6,0xA3,0xA3,0xA3,0xA3,0xA5,0xA6,0xA6,0xA1,0xA4,0xA2,0xA2,
+            0x9C,0xA3,0xA3,0xA4,0xA4,0xA2,0xA1,0xA3,0xA0,0xA3,0xA2,0xA4,0xA2,0xA0,0xA2,0xA0,
+            0xA0,0xA1,0xA0,0xA1,0xA0,0xA0,0xA3,0xA1,0x9C,0x9F,0x9E,0xA2,0xA3,0xA0,0x9F,0xA2,
+            0x98,0x9E,0x9E,0xA0,0xA1,0xA0,0x9A,0x9A,0x99,0xA1,0x9C,0x9E,0xA0,0x9F,0x9D,0xA0,
+            0x90,0x93,0x95,0x96,0x96,0x99,0x97,0x95,0x87,0x82,0x89,0x8A,0x8A,0x8F,0x92,0x94,
+            0x94,0x9A,0x9E,0x9B,0x99,0x92,0x9B,0x91,0x93,0x9A,0x9C,0x99,0x9D,0x9B,0x9B,0x9B,
+            0x8D,0x96,0x96,0x96,0x97,0x98,0x96,0x95,0x8C,0x90,0x8D,0x90,0x8B,0x85,0x81,0x74,
+            0x77,0x75,0x79,0x74,0x6E,0x5F,0x6B,0x6D,0x67,0x6A,0x69,0x6C,0x6B,0x66,0x67,0x69,
+            0x68,0x67,0x6A,0x6C,0x6D,0x6C,0x6E,0x6D,0x6F,0x6D,0x6F,0x70,0x70,0x71,0x72,0x72,
+            0x72,0x74,0x71,0x74,0x49,0x74,0x74,0x73,0x74,0x74,0x75,0x73,0x75,0x75,0x77,0x77,
+            0x75,0x77,0x77,0x77,0x78,0x78,0x78,0x76,0x76,0x79,0x79,0x78,0x7A,0x7A,0x7A,0x7A,
+            0x7A,0x7A,0x7C,0x7B,0x79,0x78,0x7B,0x7C,0x74,0x7A,0x7C,0x7C,0x75,0x7D,0x7C,0x7C,
+            0x7D,0x7E,0x7D,0x7D,0x7D,0x7D,0x7E,0x7D,0x7E,0x7E,0x7E,0x7D,0x7E,0x7F,0x80,0x7F,
+            0x80,0x7E,0x81,0x7F,0x7E,0x7E,0x7F,0x80,0x7F,0x7F,0x80,0x7F,0x80,0x81,0x81,0x80,
+            0x81,0x82,0x7F,0x81,0x80,0x81,0x82,0x81,0x81,0x81,0x83,0x82,0x83,0x84,0x82,0x84,
+            0x8E,0x8F,0x90,0x8A,0x8E,0x86,0x8F,0x86,0x8E,0x8A,0x90,0x8A,0x8E,0x8C,0x91,0x8F,
+            0x8E,0x90,0x8D,0x8F,0x90,0x8E,0x8F,0x8D,0x90,0x91,0x91,0x90,0x90,0x8D,0x90,0x90,
+            0x8C,0x90,0x8E,0x8C,0x8E,0x8F,0x8F,0x8E,0x8E,0x81,0x8F,0x8D,0x8F,0x8D,0x83,0x8E,
+            0x8C,0x8E,0x8C,0x8C,0x8C,0x8C,0x8D,0x8C,0x8B,0x8D,0x8D,0x8C,0x8B,0x8A,0x8C,0x8C,
+            0x89,0x84,0x89,0x88,0x89,0x82,0x85,0x87,0x85,0x8B,0x88,0x89,0x89,0x89,0x89,0x89,
+            0x85,0x7E,0x89,0x89,0x87,0x86,0x89,0x84,0x87,0x88,0x80,0x86,0x87,0x84,0x86,0x86,
+            0x88,0x87,0x88,0x87,0x87,0x85,0x85,0x82,0x80,0x7F,0x84,0x85,0x87,0x7D,0x80,0x87,
+            0x8C,0x8B,0x8F,0x88,0x8D,0x91,0x8E,0x92,0x96,0x96,0x93,0x8E,0x8D,0x87,0x82,0x74,
+            0x6A,0x7A,0x7F,0x7D,0x6E,0x73,0x76,0x76,0x6B,0x72,0x74,0x76,0x74,0x73,0x77,0x73,
+            0x6E,0x77,0x74,0x76,0x77,0x78,0x79,0x7A,0x72,0x7C,0x7C,0x7C,0x79,0x7C,0x7D,0x7D,
+            0x74,0x7D,0x7E,0x7E,0x7E,0x80,0x7F,0x81,0x78,0x7F,0x80,0x7F,0x7E,0x81,0x82,0x82,
+            0x79,0x80,0x83,0x82,0x81,0x85,0x83,0x84,0x7B,0x84,0x84,0x84,0x83,0x81,0x85,0x80,
+            0x6A,0x84,0x84,0x84,0x81,0x86,0x85,0x86,0x79,0x82,0x86,0x86,0x83,0x86,0x87,0x88,
+            0x80,0x88,0x87,0x87,0x87,0x87,0x89,0x88,0x84,0x87,0x89,0x88,0x88,0x89,0x89,0x89,
+            0x84,0x89,0x89,0x8A,0x88,0x88,0x89,0x89,0x83,0x89,0x89,0x8A,0x87,0x88,0x88,0x8B,
+            0x85,0x8B,0x89,0x89,0x89,0x8A,0x87,0x8B,0x87,0x8B,0x8B,0x8B,0x8D,0x8B,0x8C,0x8C,
+            0x82,0x90,0x8F,0x8D,0x8E,0x8D,0x8F,0x8D,0x84,0x8D,0x8E,0x8B,0x8C,0x8D,0x8D,0x8A,
+            0x81,0x8C,0x8B,0x8C,0x8D,0x8C,0x8C,0x8A,0x83,0x8C,0x8B,0x8B,0x89,0x8C,0x8B,0x8A,
+            0x80,0x8A,0x8B,0x8B,0x89,0x8A,0x88,0x89,0x81,0x89,0x8A,0x8A,0x86,0x89,0x88,0x87,
+            0x7D,0x88,0x88,0x87,0x86,0x87,0x89,0x86,0x7C,0x86,0x86,0x87,0x82,0x86,0x84,0x85,
+            0x7D,0x86,0x83,0x85,0x83,0x84,0x85,0x84,0x7D,0x85,0x84,0x84,0x81,0x82,0x82,0x81,
+            0x7E,0x81,0x80,0x80,0x7F,0x7D,0x81,0x7E,0x7B,0x7E,0x7D,0x7F,0x7E,0x7F,0x7D,0x7E,
+            0x7B,0x7C,0x7C,0x7D,0x76,0x75,0x78,0x7A,0x77,0x79,0x7A,0x76,0x78,0x77,0x78,0x75,
+            0x7A,0x7D,0x83,0x84,0x7D,0x85,0x84,0x8B,0x89,0x91,0x8F,0x91,0x8D,0x88,0x81,0x74,
+            0x78,0x77,0x83,0x85,0x81,0x8A,0x8B,0x8E,0x6F,0x8B,0x8D,0x87,0x86,0x85,0x88,0x87,
+            0x77,0x8F,0x8F,0x8F,0x89,0x94,0x90,0x91,0x7E,0x91,0x92,0x91,0x90,0x93,0x93,0x92,
+            0x7E,0x93,0x8F,0x91,0x8E,0x94,0x93,0x94,0x82,0x92,0x93,0x94,0x91,0x95,0x95,0x96,
+            0x85,0x93,0x96,0x94,0x96,0x97,0x95,0x97,0x87,0x84,0x93,0x99,0x96,0x93,0x97,0x9A,
+            0x86,0x90,0x98,0x94,0x90,0x96,0x99,0x9B,0x77,0x8A,0x98,0x96,0x85,0x95,0x9C,0x9A,
+            0x8E,0x9C,0x9A,0x9A,0x97,0x99,0x9A,0x9C,0x8E,0x9D,0x9C,0x9C,0x9C,0xA0,0x9D,0x9B,
+            0x86,0x96,0x99,0x9A,0x9B,0x94,0x8D,0x9C,0x8E,0x9B,0x9C,0x9D,0x9C,0x8C,0x9C,0x9A,
+            0x91,0x9D,0x9E,0x9C,0x99,0x9C,0x9C,0x9F,0x93,0x9F,0x9E,0x9F,0x9F,0xA0,0x9F,0x9D,
+            0x9B,0xA4,0xA2,0x9C,0xA0,0x9D,0xA6,0xA6,0xA3,0x9B,0xA6,0x96,0xA4,0x9E,0xA4,0xA6,
+            0x9E,0xA4,0xA2,0xA4,0xA3,0xA5,0xA5,0xA5,0xA0,0xA2,0xA5,0xA4,0xA2,0xA1,0x9F,0xA3,
+            0x97,0xA4,0xA3,0xA3,0x9F,0xA2,0xA6,0xA5,0x9F,0x9F,0xA3,0xA1,0xA4,0xA2,0xA2,0xA3,
+            0x9E,0xA5,0xA1,0xA4,0xA2,0xA4,0xA2,0xA3,0x9F,0xA0,0x9F,0xA1,0xA3,0xA2,0xA3,0xA1,
+            0x8A,0x9A,0x9E,0x9E,0x9E,0x9A,0x9F,0x9F,0x9E,0x85,0x9F,0xA0,0x9E,0x9F,0x9F,0xA2,
+            0x9A,0xA0,0x98,0xA2,0x9D,0xA2,0x9F,0xA2,0x9B,0x9F,0x9D,0x99,0x9D,0x9D,0x9D,0x9D,
+            0x91,0x98,0x9D,0x99,0x99,0x9C,0x9D,0x9B,0x94,0x95,0x9B,0x99,0x9B,0x97,0x97,0x9C,
+            0x94,0x98,0x9A,0x96,0x9B,0x9C,0x93,0x98,0x8E,0x95,0x92,0x91,0x8D,0x88,0x82,0x72,
+            0x77,0x76,0x82,0x87,0x80,0x8C,0x8A,0x8E,0x6F,0x87,0x85,0x88,0x83,0x87,0x8A,0x83,
+            0x70,0x8B,0x8B,0x88,0x88,0x8D,0x86,0x8E,0x7A,0x8A,0x8E,0x8B,0x8C,0x91,0x91,0x91,
+            0x7A,0x92,0x92,0x90,0x8F,0x93,0x8E,0x93,0x7F,0x90,0x8F,0x8B,0x8E,0x95,0x90,0x94,
+            0x80,0x91,0x92,0x92,0x92,0x96,0x96,0x92,0x85,0x96,0x94,0x95,0x8E,0x96,0x98,0x95,
+            0x84,0x8C,0x8F,0x96,0x90,0x96,0x98,0x98,0x79,0x8E,0x97,0x93,0x89,0x95,0x9A,0x98,
+            0x85,0x9A,0x9A,0x98,0x94,0x97,0x9B,0x99,0x8E,0x98,0x9C,0x97,0x99,0x9C,0x9C,0x9D,
+            0x8B,0x99,0x7E,0x99,0x99,0x99,0x88,0x9A,0x8D,0x9A,0x9C,0x9B,0x9A,0x9D,0x99,0x9A,
+            0x8C,0x9A,0x9B,0x9A,0x99,0x9A,0x95,0x9C,0x90,0x9B,0x9C,0x9C,0x9B,0x9D,0x99,0x9E,
+            0x9B,0xA3,0xA4,0x98,0xA5,0x9D,0xA4,0xA4,0x9F,0x9B,0xA3,0x9A,0xA3,0x9F,0xA1,0xA2,
+            0xA0,0xA1,0xA2,0xA3,0x9B,0xA2,0xA5,0xA4,0xA2,0xA1,0xA4,0xA2,0xA2,0xA2,0xA3,0xA4,
+            0xA1,0xA2,0xA2,0xA3,0xA2,0xA2,0xA4,0xA3,0x9F,0xA1,0xA3,0xA1,0xA1,0xA1,0xA2,0x9F,
+            0x9F,0xA3,0x9E,0x9E,0xA1,0x9F,0xA3,0xA2,0x9F,0x9F,0x9E,0x9D,0x9C,0x9F,0x9E,0x9E,
+            0x9A,0x9F,0xA1,0x85,0x90,0x88,0x9D,0x9B,0x9C,0x9C,0x8A,0x9E,0x9B,0x9D,0x9E,0x99,
+            0x9B,0x9F,0x9F,0xA0,0x9D,0xA0,0x9C,0x9F,0x9A,0x99,0x9C,0x96,0x94,0x9B,0x9B,0x96,
+            0x8E,0x9B,0x9C,0x95,0x95,0x9B,0x9C,0x9A,0x8E,0x90,0x96,0x96,0x99,0x9B,0x9C,0x9B,
+            0x92,0x9C,0x9A,0x83,0x9A,0x9C,0x93,0x98,0x8E,0x94,0x94,0x92,0x8C,0x87,0x83,0x70,
+            0x6F,0x68,0x72,0x7B,0x71,0x81,0x85,0x88,0x66,0x80,0x8D,0x6C,0x7F,0x8B,0x8F,0x75,
+            0x6E,0x81,0x87,0x86,0x87,0x94,0x94,0x90,0x72,0x95,0x94,0x96,0x8D,0x97,0x96,0x95,
+            0x74,0x93,0x94,0x98,0x8A,0x94,0x98,0x98,0x7A,0x92,0x95,0x96,0x92,0x93,0x9B,0x98,
+            0x7C,0x7F,0x94,0x98,0x8D,0x99,0x9B,0x9B,0x81,0x94,0x9A,0x98,0x91,0x9A,0x9C,0x9B,
+            0x80,0x7C,0x98,0x95,0x7C,0x89,0x9A,0x9A,0x62,0x7A,0x91,0x9B,0x72,0x85,0x97,0x9E,
+            0x80,0x9A,0x98,0x99,0x93,0x89,0x97,0x99,0x89,0x8D,0x9A,0x7F,0x96,0x9D,0x9E,0x9D,
+            0x7F,0x97,0x9C,0x9D,0x7E,0x98,0x7F,0x9F,0x8C,0x8C,0x9A,0x9F,0x9B,0x9C,0xA0,0x9F,
+            0x8B,0x9F,0x9D,0x98,0x8B,0x92,0x9A,0x9B,0x8D,0x9F,0xA0,0x9E,0x9B,0x92,0x9F,0x9D,
+            0x92,0x97,0xA2,0x88,0x8B,0x8D,0xA6,0xA7,0x90,0x7F,0xA0,0x81,0xA6,0x97,0xA5,0xA6,
+            0x9E,0xA4,0xA0,0xA3,0xA4,0xA6,0xA6,0xA6,0xA4,0xA2,0xA2,0xA7,0xA3,0xA3,0xA4,0xA3,
+            0x9E,0xA4,0xA4,0xA0,0xA4,0xA6,0x9F,0xA5,0x9E,0x8F,0xA6,0xA5,0xA3,0xA4,0xA5,0xA1,
+            0x9F,0x87,0x9F,0xA1,0x9D,0x81,0x9F,0xA0,0x96,0x97,0x92,0x9F,0xA2,0xA1,0x90,0x9C,
+            0x8F,0x95,0x9F,0x93,0x9D,0x99,0x8A,0x8E,0x9D,0x92,0xA2,0xA1,0x9E,0xA3,0xA2,0xA1,
+            0x9B,0xA2,0x97,0x9F,0xA1,0xA2,0xA0,0x9D,0x9D,0xA0,0xA2,0x97,0xA2,0x9E,0x9E,0x9F,
+            0x93,0xA1,0x9E,0x9E,0x95,0x98,0x96,0x9D,0x77,0x83,0x9B,0x91,0x9C,0x96,0x9A,0x9C,
+            0x91,0x93,0x90,0x88,0x98,0x95,0x92,0x95,0x82,0x90,0x8C,0x87,0x84,0x81,0x7B,0x69,
+            0x7B,0x76,0x83,0x87,0x81,0x86,0x91,0x92,0x7C,0x94,0x95,0x92,0x8D,0x98,0x9A,0x8D,
+            0x7D,0x8A,0x99,0x77,0x90,0x96,0x8A,0x90,0x70,0x8B,0x9E,0x9C,0x97,0x82,0x9D,0x9B,
+            0x83,0x87,0x9A,0xA1,0x99,0x9E,0xA0,0xA0,0x8D,0x98,0xA3,0x9F,0x9F,0xA0,0x9E,0xA1,
+            0x8A,0x99,0xA3,0x9E,0x9B,0x9B,0xA3,0x86,0x93,0xA0,0xA0,0xA0,0x98,0x97,0xA3,0xA2,
+            0x90,0x94,0xA1,0xA5,0x97,0x9D,0xA4,0xA4,0x82,0x93,0x9E,0xA4,0x93,0x9E,0xA2,0xA5,
+            0x98,0xA3,0xA2,0xA5,0xA0,0xA1,0xA1,0xA3,0x96,0x94,0x9F,0xA0,0xA1,0xA5,0xA7,0xA2,
+            0x93,0xA3,0xA2,0xA1,0xA2,0xA0,0x97,0xA4,0x9C,0xA1,0xA4,0xA3,0xA0,0xA1,0x89,0x89,
+            0x92,0xA3,0xA2,0x9F,0x9B,0xA1,0xA3,0xA3,0x99,0x9D,0xA2,0xA2,0xA4,0xA4,0x95,0x8B,
+            0x9B,0xA3,0x93,0x9B,0xA3,0xA2,0xA5,0xA7,0xA7,0x99,0xA6,0x9B,0xA6,0xA0,0xA4,0xA6,
+            0xA0,0xA4,0xA0,0xA3,0x9F,0xA7,0xA3,0xA7,0xA4,0xA4,0xA5,0xA6,0xA2,0xA3,0xA5,0xA4,
+            0xA3,0xA5,0xA3,0xA3,0xA3,0xA4,0x9D,0x9D,0x99,0xA3,0xA3,0xA3,0xA3,0xA5,0xA5,0xA3,
+            0x9F,0xA2,0xA3,0xA4,0xA6,0xA4,0xA1,0xA3,0x83,0xA0,0xA1,0xA1,0x8F,0xA4,0x9F,0xA1,
+            0x91,0x9F,0xA5,0xA3,0xA4,0x99,0xA0,0xA0,0xA3,0x93,0xA2,0xA3,0x9F,0xA2,0xA1,0xA2,
+            0x9E,0xA4,0x97,0xA4,0xA0,0x9F,0x93,0xA2,0x9E,0xA2,0xA2,0x97,0xA0,0xA1,0x9F,0xA0,
+            0x96,0xA0,0xA1,0xA0,0x94,0xA0,0xA1,0x9F,0x94,0x9C,0xA0,0x9C,0x9E,0x96,0x9F,0x9C,
+            0x8C,0x9D,0x9B,0x9A,0x99,0x9B,0x95,0x97,0x8C,0x95,0x94,0x90,0x8C,0x88,0x82,0x74,
+            0x7C,0x79,0x7F,0x89,0x82,0x90,0x85,0x91,0x7C,0x96,0x95,0x90,0x88,0x9A,0x99,0x8C,
+            0x70,0x7F,0x99,0x9D,0x97,0xA0,0x98,0x9F,0x82,0x9F,0xA0,0xA2,0x95,0xA2,0xA1,0x9E,
+            0x83,0x9F,0xA2,0xA1,0x9A,0xA4,0xA4,0xA3,0x8D,0xA5,0xA3,0xA3,0x9B,0xA1,0xA3,0xA4,
+            0x8B,0x9E,0xA2,0xA6,0xA0,0xA6,0xA5,0xA5,0x8E,0xA4,0xA3,0xA7,0xA2,0x93,0xA3,0xA4,
+            0x8E,0x93,0xA6,0xA4,0x96,0x9D,0xA4,0xA7,0x83,0x93,0x9D,0xA2,0x91,0x9A,0x9D,0xA5,
+            0x94,0xA5,0xA5,0xA2,0xA4,0x99,0xA5,0xA7,0x92,0x91,0xA8,0xA4,0x9E,0xA9,0xA1,0xA5,
+            0x8B,0xA2,0xA7,0xA0,0xA5,0x9E,0x90,0xA7,0x99,0x9E,0xA7,0xA6,0xA6,0xA6,0xA6,0x80,
+            0x99,0xA8,0xA7,0xA9,0xA3,0xA3,0xA4,0xA3,0x9A,0xA7,0xA5,0xA4,0xA8,0x9C,0x8C,0x87,
+            0x9F,0xA3,0xA8,0x9D,0xA4,0x9F,0xAA,0xA8,0xA4,0x9B,0xA8,0x9B,0xAA,0xA2,0xA6,0xA5,
+            0xA3,0xA7,0xA5,0xA6,0xA7,0xA8,0xA8,0xA6,0xA5,0xA7,0xA8,0xA7,0xA5,0xA8,0xA6,0xA6,
+            0xA4,0xA9,0xA8,0xA9,0xA8,0xA9,0xA9,0xA8,0xA5,0xA4,0xAA,0xA6,0xA9,0xA7,0xA6,0xA6,
+            0xA6,0xA5,0xA8,0xA8,0xA6,0xA8,0xA6,0xA6,0xA4,0xA6,0xA5,0xA7,0xAA,0xA8,0xA3,0xA2,
+            0xA2,0xA4,0xA7,0xAA,0xA5,0xA3,0xA3,0xA5,0xA5,0xA6,0xA7,0xA7,0xA6,0xA5,0xA6,0xA6,
+            0x9E,0xA5,0xA4,0xA5,0xA6,0xA7,0xA7,0xA5,0xA0,0xA4,0xA6,0xA8,0xA3,0xA5,0xA1,0xA5,
+            0x98,0xA6,0xA4,0xA4,0xA0,0xA2,0xA2,0xA3,0x94,0x9F,0xA2,0x9F,0x9F,0xA2,0x9F,0x9F,
+            0x94,0x9D,0x9E,0x9B,0x9C,0x9B,0x9B,0x99,0x84,0x95,0x94,0x91,0x8C,0x89,0x81,0x74,
+            0x7A,0x7B,0x82,0x87,0x7E,0x91,0x93,0x95,0x69,0x92,0x99,0x98,0x89,0x9C,0x9A,0x8D,
+            0x67,0x80,0x8C,0x9F,0x90,0xA1,0x9F,0x9E,0x6D,0x97,0x9D,0xA2,0x90,0xA3,0xA3,0xA0,
+            0x6F,0x9F,0xA2,0xA3,0x94,0xA4,0xA1,0xA3,0x77,0xA1,0xA4,0xA2,0x96,0xA4,0xA4,0xA5,
+            0x77,0x99,0xA0,0xA7,0x97,0xA7,0xA4,0xA7,0x79,0xA3,0xA4,0xA5,0x99,0xA4,0xA5,0xA1,
+            0x7A,0x94,0xA4,0xA4,0x97,0x9D,0xA3,0xA6,0x78,0x8F,0x9A,0xA5,0x8F,0x9A,0x9C,0xA5,
+            0x80,0xA3,0xA4,0xA6,0x9B,0x9A,0xA7,0xA6,0x82,0x99,0xA2,0xA4,0x9B,0xA7,0xA3,0xA5,
+            0x80,0xA5,0xA2,0xA6,0xA2,0xA4,0x97,0xA7,0x83,0x9A,0xA4,0xA4,0xA0,0xA5,0xA7,0xA6,
+            0x86,0xA9,0xA5,0xA3,0x9D,0xA3,0xA7,0xA2,0x85,0xAA,0xA5,0xA4,0xA1,0x92,0xA8,0x9C,
+            0x9F,0xA4,0xA8,0x9D,0xA7,0xA6,0xAB,0xA8,0xA6,0x9F,0xA9,0x98,0xA7,0xA3,0xA8,0xA8,
+            0xA2,0xA7,0xA6,0xA7,0xA6,0xAB,0xA9,0xA8,0xA2,0xA5,0xA6,0xA8,0xA9,0xA6,0xA6,0xA9,
+            0xA1,0xA7,0xA8,0xA5,0xAA,0xA8,0xA9,0xAA,0xA3,0xA8,0xA3,0xA7,0xA8,0xA7,0xA9,0xAA,
+            0xA1,0xA7,0xA5,0xA7,0xA9,0xAA,0xA6,0xA7,0xA0,0xA8,0xA3,0xA7,0xA9,0xA6,0xA2,0xA5,
+            0x9C,0xA6,0xA8,0xA8,0xA7,0xA7,0xA3,0xA2,0x9A,0xA5,0xA5,0xA5,0xA2,0xA2,0xA7,0xA5,
+            0x91,0xA7,0xA4,0xA8,0xA5,0xA7,0xA4,0xA4,0x9C,0xA7,0xA2,0xA6,0xA4,0xA5,0xA1,0xA5,
+            0x92,0xA3,0xA5,0xA1,0x9F,0xA4,0xA4,0xA4,0x8E,0x9F,0xA1,0xA2,0x9F,0x9F,0xA1,0x9F,
+            0x80,0x9C,0x9D,0x9B,0x99,0x9C,0x98,0x98,0x7E,0x94,0x92,0x90,0x8C,0x88,0x81,0x74,
+            0x77,0x78,0x81,0x85,0x83,0x83,0x8C,0x89,0x8A,0x90,0x8E,0x88,0x8D,0x8F,0x92,0x85,
+            0x84,0x84,0x99,0x96,0x96,0x8F,0x8F,0x93,0x95,0x98,0x9C,0x9E,0x8B,0x87,0x8F,0x92,
+            0x96,0x9E,0xA1,0x9B,0x45,0x95,0x9E,0x9B,0x91,0x99,0x9F,0x8E,0x9A,0x8E,0x99,0x99,
+            0x90,0x8D,0x99,0x98,0x9A,0x8F,0x9F,0x94,0x86,0x94,0x9A,0x9C,0x9D,0x8B,0x9B,0x9C,
+            0x96,0x8D,0x9E,0xA4,0x91,0x95,0xA4,0xA2,0x79,0x8D,0x9D,0xA3,0x8C,0x99,0xA2,0xA2,
+            0x9D,0x81,0xA0,0xA0,0x97,0x9B,0xA3,0xA0,0xA2,0x91,0xA6,0x9F,0xA3,0xA1,0x99,0xA5,
+            0x9D,0xA5,0xA4,0xA3,0x9F,0xA5,0x96,0x9C,0xA6,0xA5,0xA4,0xA5,0xA7,0x9C,0xA2,0xA3,
+            0xA3,0xA1,0xA4,0x9E,0x96,0x95,0xA4,0x9D,0xA5,0xA6,0xA7,0xA5,0xA6,0xA3,0xA3,0x9B,
+            0x9D,0x9A,0x9D,0x93,0x9B,0x8D,0x99,0x93,0x9F,0x90,0xA1,0x90,0x9B,0x98,0xA4,0xA5,
+            0x9D,0xA1,0xA4,0xA2,0xA0,0x99,0x9C,0xA4,0xA1,0xA4,0xA6,0xA6,0xA4,0x9C,0xA6,0xA6,
+            0xA6,0xA3,0xA3,0xA0,0x9F,0xA0,0xA4,0xA6,0xA0,0xA3,0x9F,0xA3,0xA5,0x9F,0x87,0xA5,
+            0xA1,0xA3,0x9C,0xA2,0x9A,0x9C,0xA3,0x99,0x9F,0x9F,0x9A,0xA1,0x9D,0x9B,0x9E,0xA0,
+            0x99,0x8C,0x97,0x92,0x97,0x8D,0x89,0x8F,0x96,0x9A,0x99,0x9F,0x9E,0x98,0x9F,0x9C,
+            0x94,0x99,0x9E,0x97,0x9F,0x95,0x9C,0x9B,0x99,0xA0,0x9F,0x9F,0x99,0x92,0x97,0x98,
+            0x9B,0xA1,0x9F,0x99,0x99,0x96,0x9F,0x9D,0x91,0x90,0x9A,0x94,0x9C,0x98,0x8A,0x9B,
+            0x96,0x98,0x9A,0x93,0x99,0x94,0x96,0x95,0x92,0x93,0x91,0x90,0x8E,0x87,0x80,0x76,
+            0x62,0x75,0x81,0x87,0x7E,0x87,0x91,0x92,0x6C,0x8F,0x94,0x91,0x87,0x99,0x97,0x8A,
+            0x6F,0x84,0x97,0x95,0x92,0x93,0x95,0x9A,0x6F,0x7B,0x92,0x9B,0x91,0x8A,0x95,0x9C,
+            0x73,0x9B,0x9D,0x93,0x93,0x96,0xA0,0xA0,0x79,0x99,0xA0,0x9D,0x8F,0x9D,0xA0,0x9F,
+            0x7B,0x98,0x9E,0x95,0x96,0x9F,0x9F,0xA5,0x7C,0x7E,0x9F,0xA0,0x99,0x9F,0xA2,0x9F,
+            0x69,0x93,0xA1,0xA0,0x95,0x9B,0x99,0xA4,0x6A,0x91,0x96,0xA1,0x8F,0x9B,0x9D,0xA1,
+            0x87,0xA1,0xA3,0xA4,0x9B,0x9B,0xA4,0xA4,0x7B,0x90,0x88,0xA2,0x9F,0xA6,0xA5,0xA5,
+            0x86,0xA0,0xA3,0xA4,0xA4,0xA2,0x9A,0xA4,0x88,0x97,0xA2,0xA0,0x9D,0xA1,0xA3,0x7E,
+            0x8B,0xA5,0xA5,0xA2,0x9C,0x9E,0xA6,0xA0,0x8B,0x8E,0xA8,0xA2,0xA5,0x9D,0xA4,0x7E,
+            0x81,0xA3,0xA7,0x9C,0x9E,0xA1,0xA9,0xA9,0x88,0x9E,0xA8,0x9A,0x9D,0xA3,0xA5,0xA7,
+            0x7F,0xA4,0xA4,0xA9,0xA2,0xA4,0xA7,0xA7,0x8A,0xA7,0xA7,0xA6,0x9E,0xA5,0xA6,0xA7,
+            0x7E,0xA4,0xA5,0xA5,0xA0,0xA6,0xA2,0x9E,0x86,0xA6,0xA5,0xA8,0x95,0xA8,0xA6,0xA3,
+            0x7E,0xA7,0xA2,0xA8,0x9E,0xA6,0xA4,0xA6,0x81,0xA3,0xA0,0xA5,0x95,0xA5,0xA5,0xA1,
+            0x83,0xA2,0xA0,0xA4,0x9E,0xA2,0x9F,0xA2,0x84,0xA3,0xA3,0xA0,0x9B,0xA3,0x9F,0xA2,
+            0x8D,0xA4,0xA2,0xA2,0x9E,0xA3,0xA3,0x9E,0x8C,0xA3,0xA1,0xA2,0x9B,0xA1,0x9D,0x98,
+            0x8E,0xA2,0x9A,0x9E,0x9B,0xA0,0xA2,0x9F,0x89,0x9B,0x9F,0x9B,0x9B,0x9B,0xA0,0x9D,
+            0x8A,0x9D,0x9F,0x9B,0x99,0x8D,0x98,0x99,0x86,0x94,0x8F,0x92,0x8C,0x88,0x7F,0x77,
+            0x77,0x78,0x7F,0x84,0x78,0x7D,0x8B,0x85,0x6E,0x8B,0x8B,0x8D,0x7F,0x80,0x8B,0x89,
+            0x73,0x8E,0x8D,0x93,0x86,0x87,0x92,0x8D,0x74,0x92,0x90,0x94,0x87,0x89,0x92,0x86,
+            0x77,0x92,0x92,0x96,0x87,0x8C,0x93,0x85,0x72,0x92,0x93,0x95,0x83,0x8E,0x95,0x8E,
+            0x7E,0x93,0x95,0x96,0x8B,0x87,0x90,0x92,0x81,0x93,0x96,0x97,0x91,0x89,0x96,0x93,
+            0x81,0x8C,0x90,0x8D,0x7F,0x89,0x8F,0x86,0x64,0x8C,0x8E,0x95,0x82,0x91,0x92,0x88,
+            0x86,0x95,0x96,0x96,0x8E,0x95,0x96,0x90,0x87,0x99,0x98,0x97,0x8F,0x9A,0x99,0x7F,
+            0x85,0x96,0x9A,0x9A,0x8F,0x9A,0x8E,0x75,0x8A,0x9A,0x99,0x9B,0x91,0x9A,0x9A,0x73,
+            0x89,0x9B,0x9A,0x9A,0x92,0x98,0x9B,0x99,0x8A,0x9A,0x9C,0x9D,0x95,0x93,0x9C,0x88,
+            0x92,0x9F,0x9F,0x8F,0x8D,0x89,0x9B,0x9A,0xA0,0x9D,0xA3,0x95,0x97,0x99,0x9E,0xA3,
+            0xA0,0xA3,0xA1,0xA3,0x9A,0xA0,0xA5,0xA3,0xA3,0xA5,0xA5,0xA2,0x9B,0xA2,0xA2,0xA4,
+            0x9E,0x9F,0xA3,0xA3,0x9D,0xA2,0xA3,0xA2,0x9E,0xA3,0x9D,0xA4,0xA0,0xA1,0xA0,0xA2,
+            0x97,0xA3,0xA2,0xA2,0x9C,0xA0,0xA4,0xA0,0x9B,0xA4,0x9E,0xA2,0x9E,0x9B,0xA0,0xA1,
+            0x76,0x88,0x89,0x90,0x97,0x91,0x88,0x8B,0x8D,0x96,0x94,0x9A,0x95,0x94,0x96,0x98,
+            0x92,0x98,0x95,0x9C,0x99,0x98,0x98,0x9C,0x97,0x9C,0x9A,0x95,0x9B,0x98,0x98,0x97,
+            0x91,0x9D,0x9B,0x9B,0x9A,0x98,0x9B,0x9B,0x85,0x95,0x9A,0x9A,0x9D,0x9B,0x9B,0x99,
+            0x8B,0x9B,0x99,0x98,0x97,0x98,0x96,0x95,0x8B,0x96,0x92,0x90,0x8D,0x88,0x82,0x79,
+            0x6F,0x73,0x7B,0x83,0x76,0x8E,0x8C,0x84,0x69,0x87,0x8C,0x90,0x7E,0x94,0x93,0x79,
+            0x6F,0x94,0x8F,0x97,0x7D,0x99,0x97,0x93,0x73,0x96,0x88,0x98,0x86,0x97,0x97,0x95,
+            0x75,0x96,0x92,0x95,0x8A,0x9B,0x98,0x94,0x7B,0x96,0x96,0x9A,0x8D,0x96,0x9A,0x98,
+            0x7E,0x90,0x96,0x9C,0x8D,0x9D,0x99,0x9B,0x82,0x8D,0x8F,0x98,0x8D,0x9A,0x9B,0x99,
+            0x7E,0x84,0x87,0x96,0x73,0x8C,0x93,0x8C,0x6D,0x81,0x91,0x98,0x7A,0x8C,0x93,0x8F,
+            0x84,0x99,0x92,0x9C,0x82,0x94,0x98,0x95,0x87,0x99,0x80,0x9C,0x86,0x9F,0x9A,0x97,
+            0x86,0x96,0x95,0xA0,0x8C,0x9E,0x8B,0x9A,0x8A,0x99,0x9D,0x9F,0x8E,0x9F,0x9A,0x99,
+            0x8A,0x9E,0x9D,0xA0,0x89,0x8F,0x91,0x88,0x8C,0x9F,0x90,0x9F,0x92,0x94,0x98,0x88,
+            0x92,0x97,0x99,0x86,0x75,0x96,0x9A,0x9A,0x99,0x89,0x9D,0x91,0x84,0x9A,0x9F,0x97,
+            0x9B,0xA0,0x9C,0x9E,0x8A,0x9A,0x95,0x9B,0x9E,0x9F,0x9D,0x9B,0x8A,0x9B,0xA0,0x92,
+            0x9C,0x9F,0x9D,0x9C,0x8F,0x9A,0x9F,0x96,0x9A,0x9F,0x9E,0xA0,0x8D,0x9D,0xA0,0x9D,
+            0x9E,0x9E,0x9A,0x9F,0x8E,0x9B,0x9C,0x9C,0x93,0x97,0x90,0x9C,0x8D,0x99,0x96,0x9A,
+            0x94,0x94,0x9C,0x98,0x9A,0x9B,0x99,0x95,0x96,0x9E,0x9B,0x99,0x9A,0x9C,0x9C,0x9B,
+            0x98,0x99,0x9A,0x94,0x99,0x99,0x9B,0x99,0x96,0x99,0x9A,0x9B,0x97,0x97,0x99,0x9B,
+            0x91,0x9A,0x9A,0x99,0x96,0x99,0x97,0x99,0x8B,0x8A,0x96,0x8E,0x9A,0x98,0x98,0x9C,
+            0x91,0x9A,0x99,0x96,0x98,0x9B,0x98,0x96,0x8D,0x95,0x93,0x91,0x8C,0x89,0x82,0x77,
+            0x4A,0x67,0x72,0x7A,0x76,0x81,0x86,0x87,0x82,0x88,0x90,0x8F,0x89,0x8F,0x90,0x70,
+            0x82,0x97,0x93,0x93,0x8C,0x98,0x99,0x9D,0x86,0x9D,0x9C,0x9E,0x93,0x9F,0x9F,0x9A,
+            0x80,0x9C,0x9C,0x9F,0x8E,0x9B,0x9E,0x9F,0x84,0x8E,0x94,0x98,0x95,0xA0,0xA1,0xA2,
+            0x89,0x8E,0x97,0xA0,0x91,0xA3,0xA4,0xA5,0x6F,0x80,0x7F,0x81,0x74,0x75,0x80,0x75,
+            0x81,0x7E,0x9A,0x99,0x81,0x8B,0x9E,0x9B,0x67,0x7B,0x93,0x89,0x76,0x82,0x8D,0x92,
+            0x8B,0x9C,0xA0,0x9F,0x95,0xA2,0xA3,0xA1,0x8C,0x99,0xA3,0x96,0x96,0xA1,0x9E,0xA6,
+            0x86,0x9D,0x96,0x8A,0x88,0x91,0x7A,0x94,0x8C,0xA3,0x9D,0xA2,0x91,0xA2,0xA3,0xA0,
+            0x86,0xA7,0xA2,0x9A,0x82,0x87,0x9B,0x97,0x68,0x7D,0x79,0x70,0x65,0x6E,0x73,0x70,
+            0x77,0x94,0x9D,0x87,0x90,0x95,0xA1,0xA3,0x7A,0x85,0x9C,0x86,0x88,0x89,0x96,0x93,
+            0x85,0xA1,0x9B,0xA2,0x95,0x9E,0x9D,0x9F,0x77,0xA2,0xA5,0xA5,0x95,0xA1,0x9F,0xA4,
+            0x81,0xA1,0xA0,0x90,0x88,0x91,0x97,0x90,0x88,0x8C,0xA3,0x91,0x8F,0xA5,0xA3,0xA5,
+            0x82,0x88,0xA2,0x9F,0x90,0xA0,0xA2,0xA2,0x6C,0x80,0x7C,0x6B,0x6F,0x70,0x78,0x70,
+            0x84,0x87,0x94,0x97,0x86,0x8B,0x95,0x93,0x85,0x91,0x91,0x95,0x7F,0x89,0x87,0x97,
+            0x84,0xA0,0x9E,0x9F,0x93,0xA3,0xA0,0xA4,0x8A,0x9B,0x99,0x9F,0x94,0x98,0x9D,0x9C,
+            0x85,0x85,0x87,0x8C,0x82,0x89,0x85,0x90,0x7E,0x85,0x9A,0x8D,0x92,0x9B,0x9A,0x9A,
+            0x84,0x93,0x8A,0x86,0x8A,0x90,0x90,0x8F,0x7A,0x68,0x66,0x78,0x7B,0x75,0x6D,0x6E,
+            0x72,0x7F,0x85,0x8C,0x8C,0x94,0x96,0x96,0x8C,0x98,0x9A,0x9A,0x97,0x9C,0x9E,0x8B,
+            0x94,0x9F,0xA1,0xA0,0x94,0xA0,0xA3,0xA1,0x98,0x9E,0xA1,0xA3,0x99,0xA3,0xA4,0xA0,
+            0x95,0xA4,0xA2,0xA2,0x9C,0xA0,0xA8,0xA5,0x94,0xA4,0xA5,0xA4,0x9D,0xA5,0xA5,0xA6,
+            0x94,0x9D,0xA3,0xA7,0x9F,0xA7,0xA5,0xA7,0x81,0x93,0x90,0x8C,0x8C,0x9E,0x8B,0x8B,
+            0x8F,0x90,0xA5,0xA3,0x8F,0x88,0xA4,0x9E,0x74,0x92,0x9D,0x92,0x8D,0x85,0x9B,0x9A,
+            0x94,0xA6,0xA7,0xA7,0xA2,0x8C,0xA7,0xA7,0x98,0xA6,0xA7,0xA1,0xA4,0x80,0xA8,0xA8,
+            0x94,0xA4,0x9D,0x9C,0x98,0x81,0x8F,0x91,0x93,0xA6,0xA4,0xA4,0x9E,0x81,0xA8,0xA5,
+            0x98,0xA7,0xA6,0xA4,0x9B,0x87,0xA1,0xA3,0x84,0x91,0x8C,0x8A,0x81,0x79,0x89,0x8A,
+            0x8A,0xA0,0xA3,0x95,0x9B,0x9A,0xA9,0xA8,0x90,0x91,0x9D,0x82,0x97,0x8A,0x99,0x8D,
+            0x91,0xA6,0xA4,0xA7,0xA3,0xA7,0xA5,0xA5,0x94,0x9D,0xA5,0xA9,0xA3,0xA6,0xA6,0xAA,
+            0x92,0x9F,0xA8,0x9F,0x9A,0xA5,0xA7,0xA3,0x93,0xA4,0xAA,0xA5,0xA2,0xA5,0xA9,0xA8,
+            0x92,0xA9,0xA8,0xA8,0xA6,0xA4,0xA6,0xA7,0x8D,0xA0,0x9E,0x80,0x83,0x92,0x9B,0x96,
+            0x8C,0x7C,0x7D,0x7A,0x61,0x7C,0x79,0x76,0x89,0x7C,0x7A,0x8B,0x91,0x8A,0x80,0x88,
+            0x98,0xA6,0xA6,0xA3,0xA1,0xA7,0xA4,0xA5,0x98,0xA7,0x9F,0xA5,0xA2,0x99,0xA0,0x9F,
+            0x81,0x6F,0x6C,0x80,0x83,0x7E,0x74,0x7B,0x90,0x85,0x8C,0x8F,0x62,0x90,0x8C,0x8B,
+            0x95,0x89,0x88,0x86,0x98,0x8A,0x88,0x89,0x7E,0x6B,0x67,0x6F,0x7B,0x71,0x6B,0x6A,
+            0x71,0x7E,0x86,0x8A,0x88,0x90,0x92,0x93,0x8C,0x95,0x96,0x97,0x95,0x97,0x98,0x88,
+            0x90,0x99,0x99,0x9A,0x94,0x9A,0x99,0x9A,0x8F,0x99,0x9C,0x9A,0x99,0x99,0x9B,0x99,
+            0x8C,0x99,0x9A,0x9C,0x97,0x9A,0x99,0x9C,0x8E,0x9B,0x9B,0x9B,0x9A,0x9A,0x99,0x98,
+            0x92,0x95,0x9A,0x9B,0x98,0x99,0x9A,0x9A,0x8F,0x9A,0x94,0x9A,0x96,0x9A,0x9A,0x98,
+            0x89,0x8F,0x96,0x9A,0x8F,0x88,0x9B,0x9A,0x71,0x8D,0x94,0x9B,0x8D,0x8E,0x9A,0x9B,
+            0x92,0x9A,0x9D,0x9D,0x98,0x93,0x9A,0x9A,0x8E,0x9A,0x91,0x96,0x9B,0x93,0x9B,0x99,
+            0x92,0x9B,0x9A,0x9C,0x97,0x94,0x8D,0x9C,0x96,0x9C,0x9B,0x9A,0x98,0x95,0x9A,0x99,
+            0x93,0x97,0x99,0x9A,0x98,0x93,0x9C,0x9A,0x93,0x97,0x99,0x9A,0x96,0x87,0x9B,0x98,
+            0x8A,0x98,0x99,0x90,0x96,0x95,0x99,0x99,0x8B,0x8F,0x98,0x8B,0x98,0x95,0x99,0x97,
+            0x88,0x99,0x98,0x9A,0x94,0x98,0x9B,0x99,0x8F,0x9A,0x9A,0x99,0x97,0x99,0x99,0x9B,
+            0x8B,0x9A,0x9A,0x98,0x96,0x98,0x99,0x9A,0x91,0x99,0x98,0x99,0x98,0x9B,0x99,0x9B,
+            0x90,0x96,0x9A,0x99,0x98,0x99,0x9C,0x9A,0x8C,0x9A,0x96,0x9B,0x98,0x9A,0x98,0x98,
+            0x8E,0x99,0x9B,0x98,0x96,0x96,0x99,0x9A,0x92,0x9B,0x99,0x9B,0x97,0x99,0x9B,0x9A,
+            0x8F,0x9C,0x9B,0x9A,0x96,0x9B,0x99,0x9B,0x8F,0x98,0x98,0x98,0x98,0x99,0x94,0x98,
+            0x92,0x99,0x99,0x98,0x97,0x99,0x99,0x98,0x8E,0x8F,0x97,0x92,0x94,0x97,0x98,0x97,
+            0x8E,0x97,0x97,0x91,0x93,0x96,0x91,0x92,0x8D,0x91,0x90,0x90,0x8A,0x87,0x7F,0x77,
+            0x6C,0x7D,0x80,0x7A,0x7D,0x84,0x84,0x81,0x79,0x93,0x93,0x95,0x8A,0x93,0x94,0x87,
+            0x7D,0x97,0x96,0x99,0x8E,0x96,0x98,0x96,0x7E,0x95,0x97,0x98,0x8E,0x98,0x98,0x97,
+            0x7D,0x97,0x98,0x95,0x8D,0x98,0x96,0x96,0x77,0x94,0x92,0x7A,0x83,0x8D,0x74,0x73,
+            0x7E,0x91,0x97,0x98,0x87,0x98,0x99,0x9A,0x6A,0x82,0x7C,0x76,0x6A,0x74,0x78,0x77,
+            0x6E,0x8B,0x89,0x73,0x72,0x75,0x81,0x7C,0x77,0x91,0x96,0x8E,0x87,0x90,0x95,0x94,
+            0x7F,0x99,0x97,0x98,0x8F,0x97,0x99,0x98,0x79,0x99,0x98,0x96,0x85,0x99,0x98,0x98,
+            0x80,0x98,0x95,0x96,0x87,0x95,0x8D,0x97,0x7C,0x96,0x94,0x87,0x7D,0x7A,0x7C,0x8D,
+            0x7E,0x99,0x99,0x99,0x89,0x98,0x97,0x9A,0x69,0x7D,0x78,0x6D,0x61,0x6C,0x73,0x70,
+            0x70,0x92,0x8D,0x7B,0x7A,0x81,0x8E,0x87,0x74,0x8C,0x94,0x7D,0x88,0x8B,0x93,0x8D,
+            0x71,0x90,0x95,0x95,0x88,0x96,0x96,0x96,0x73,0x94,0x95,0x96,0x88,0x96,0x95,0x96,
+            0x78,0x93,0x92,0x8F,0x8A,0x95,0x95,0x94,0x76,0x94,0x95,0x8D,0x85,0x8F,0x93,0x91,
+            0x78,0x97,0x96,0x97,0x89,0x95,0x96,0x97,0x70,0x87,0x85,0x70,0x6B,0x73,0x7E,0x76,
+            0x51,0x5D,0x5A,0x58,0x4B,0x5A,0x5B,0x5D,0x6C,0x7D,0x79,0x85,0x85,0x85,0x7D,0x87,
+            0x75,0x8E,0x8B,0x91,0x8B,0x92,0x91,0x91,0x78,0x8E,0x8A,0x91,0x87,0x91,0x8E,0x92,
+            0x58,0x62,0x60,0x71,0x72,0x71,0x66,0x6A,0x60,0x70,0x6D,0x75,0x4F,0x77,0x74,0x72,
+            0x73,0x7E,0x80,0x8A,0x88,0x8B,0x87,0x89,0x50,0x5D,0x5B,0x66,0x6A,0x63,0x61,0x62,
+            0x45,0x75,0x78,0x79,0x79,0x7B,0x7B,0x7C,0x7D,0x7E,0x7E,0x7D,0x7C,0x7E,0x7E,0x79,
+            0x7D,0x7D,0x7E,0x7E,0x7D,0x7E,0x7E,0x7E,0x7E,0x7F,0x7E,0x7F,0x7E,0x7E,0x7F,0x7F,
+            0x7F,0x7F,0x7F,0x7E,0x41,0x7E,0x7F,0x7F,0x7F,0x7F,0x7F,0x7E,0x7F,0x7E,0x7E,0x7F,
+            0x7D,0x7E,0x80,0x7E,0x7E,0x7F,0x7F,0x7D,0x7F,0x7E,0x7F,0x7F,0x7D,0x7F,0x7F,0x7F,
+            0x7E,0x7B,0x80,0x7E,0x7E,0x80,0x80,0x7F,0x7B,0x7F,0x80,0x80,0x7D,0x7F,0x80,0x7F,
+            0x7E,0x80,0x80,0x7F,0x80,0x7F,0x80,0x7F,0x7F,0x7F,0x80,0x7F,0x7F,0x7F,0x7F,0x7F,
+            0x7F,0x81,0x80,0x7F,0x7E,0x7E,0x7E,0x7F,0x7F,0x7F,0x80,0x7F,0x80,0x80,0x7F,0x7F,
+            0x7F,0x80,0x80,0x7F,0x7F,0x80,0x7E,0x7F,0x7F,0x7E,0x80,0x80,0x7E,0x7E,0x7E,0x7D,
+            0x7B,0x7C,0x7C,0x7A,0x7A,0x7A,0x7B,0x78,0x7B,0x7A,0x7C,0x7B,0x7B,0x7A,0x7B,0x7B,
+            0x7A,0x7C,0x7B,0x7B,0x7A,0x7B,0x7B,0x7B,0x7B,0x7C,0x7C,0x7C,0x7C,0x7B,0x7B,0x7B,
+            0x7B,0x7D,0x7C,0x7C,0x7C,0x7C,0x7C,0x7B,0x7C,0x7D,0x7D,0x7C,0x7C,0x7C,0x7D,0x7C,
+            0x7C,0x7C,0x7D,0x7C,0x7C,0x7D,0x7D,0x7C,0x7D,0x7D,0x7D,0x7D,0x7D,0x7C,0x7D,0x7D,
+            0x54,0x7D,0x7C,0x7C,0x7B,0x7C,0x7B,0x7C,0x7D,0x6B,0x7D,0x7D,0x7D,0x7D,0x7D,0x7D,
+            0x7C,0x7D,0x69,0x7D,0x7D,0x7D,0x7E,0x7D,0x7B,0x7E,0x7E,0x71,0x7E,0x7D,0x7D,0x7D,
+            0x7D,0x7E,0x7E,0x7B,0x74,0x7D,0x7E,0x7D,0x7D,0x7D,0x7E,0x7A,0x7E,0x6F,0x7E,0x7D,
+            0x7C,0x7E,0x7D,0x7C,0x7E,0x7E,0x6C,0x7D,0x7D,0x7D,0x7D,0x7B,0x7B,0x7A,0x78,0x6C,
+            0x66,0x7A,0x7E,0x7F,0x77,0x82,0x82,0x82,0x74,0x84,0x82,0x82,0x81,0x83,0x83,0x7F,
+            0x73,0x83,0x83,0x84,0x7E,0x83,0x84,0x82,0x75,0x83,0x84,0x83,0x81,0x84,0x83,0x82,
+            0x71,0x83,0x83,0x83,0x7F,0x84,0x84,0x83,0x74,0x84,0x84,0x84,0x7F,0x84,0x83,0x83,
+            0x71,0x83,0x83,0x83,0x7F,0x83,0x83,0x83,0x73,0x83,0x83,0x83,0x80,0x83,0x83,0x83,
+            0x6F,0x82,0x83,0x83,0x7D,0x83,0x83,0x83,0x70,0x82,0x83,0x83,0x7F,0x83,0x84,0x82,
+            0x71,0x84,0x83,0x83,0x80,0x83,0x83,0x83,0x73,0x83,0x83,0x82,0x81,0x83,0x83,0x83,
+            0x70,0x84,0x84,0x83,0x7D,0x83,0x80,0x82,0x73,0x83,0x83,0x83,0x80,0x82,0x83,0x83,
+            0x6F,0x83,0x83,0x82,0x7D,0x83,0x82,0x82,0x72,0x83,0x82,0x82,0x80,0x84,0x85,0x83,
+            0x72,0x82,0x83,0x82,0x7F,0x82,0x82,0x81,0x73,0x81,0x82,0x82,0x80,0x82,0x82,0x82,
+            0x70,0x82,0x82,0x82,0x7E,0x82,0x81,0x82,0x75,0x83,0x83,0x82,0x80,0x82,0x83,0x81,
+            0x73,0x82,0x82,0x82,0x7E,0x83,0x82,0x82,0x75,0x82,0x82,0x82,0x81,0x83,0x83,0x80,
+            0x72,0x80,0x82,0x82,0x7E,0x82,0x82,0x83,0x74,0x83,0x83,0x83,0x80,0x82,0x83,0x82,
+            0x43,0x80,0x80,0x82,0x7F,0x83,0x82,0x81,0x74,0x58,0x81,0x83,0x80,0x82,0x81,0x83,
+            0x71,0x82,0x55,0x84,0x80,0x84,0x82,0x83,0x76,0x83,0x82,0x58,0x80,0x83,0x82,0x82,
+            0x73,0x82,0x83,0x83,0x60,0x83,0x82,0x83,0x75,0x82,0x82,0x80,0x80,0x58,0x82,0x82,
+            0x72,0x82,0x82,0x82,0x7F,0x82,0x53,0x81,0x75,0x82,0x81,0x81,0x7D,0x7E,0x7B,0x52,
+            0x72,0x7D,0x85,0x8A,0x8A,0x8F,0x8F,0x92,0x88,0x93,0x95,0x96,0x92,0x97,0x97,0x88,
+            0x89,0x97,0x99,0x98,0x91,0x98,0x97,0x98,0x8A,0x99,0x98,0x97,0x93,0x99,0x9A,0x98,
+            0x86,0x9A,0x98,0x99,0x95,0x98,0x99,0x96,0x89,0x9A,0x9A,0x98,0x93,0x9A,0x99,0x98,
+            0x88,0x95,0x9A,0x9B,0x95,0x99,0x9A,0x9A,0x8A,0x9A,0x9A,0x9A,0x94,0x9A,0x9B,0x9A,
+            0x85,0x8D,0x9A,0x98,0x8F,0x92,0x9A,0x98,0x75,0x84,0x95,0x98,0x89,0x91,0x99,0x9B,
+            0x8B,0x9A,0x9A,0x99,0x97,0x9A,0x99,0x99,0x8A,0x9B,0x9A,0x98,0x96,0x9A,0x9B,0x9A,
+            0x8A,0x73,0x95,0x9B,0x85,0x99,0x8A,0x9A,0x8E,0x9A,0x9B,0x99,0x98,0x9A,0x9A,0x98,
+            0x89,0x99,0x9A,0x99,0x93,0x99,0x99,0x99,0x8C,0x99,0x99,0x9B,0x93,0x9A,0x99,0x97,
+            0x80,0x98,0x96,0x92,0x92,0x95,0x96,0x97,0x83,0x91,0x97,0x90,0x92,0x95,0x96,0x97,
+            0x81,0x97,0x96,0x99,0x94,0x99,0x97,0x96,0x83,0x98,0x98,0x96,0x93,0x99,0x98,0x98,
+            0x85,0x98,0x98,0x97,0x92,0x98,0x98,0x9A,0x86,0x98,0x98,0x99,0x92,0x98,0x99,0x94,
+            0x81,0x98,0x98,0x9A,0x94,0x94,0x96,0x97,0x82,0x97,0x99,0x97,0x91,0x98,0x95,0x96,
+            0x87,0x98,0x97,0x97,0x93,0x97,0x95,0x95,0x85,0x96,0x96,0x9A,0x92,0x97,0x9B,0x99,
+            0x87,0x97,0x99,0x97,0x94,0x9A,0x99,0x99,0x85,0x97,0x94,0x99,0x90,0x99,0x97,0x97,
+            0x88,0x97,0x98,0x98,0x94,0x98,0x98,0x97,0x84,0x90,0x92,0x93,0x8C,0x99,0x95,0x98,
+            0x86,0x96,0x94,0x90,0x91,0x93,0x93,0x93,0x86,0x91,0x8F,0x8E,0x87,0x87,0x81,0x77,
+            0x6E,0x78,0x85,0x7D,0x7E,0x8A,0x83,0x83,0x80,0x91,0x93,0x93,0x8E,0x95,0x93,0x86,
+            0x7E,0x93,0x95,0x95,0x8D,0x95,0x95,0x96,0x83,0x95,0x94,0x96,0x90,0x97,0x96,0x95,
+            0x7E,0x95,0x97,0x98,0x88,0x94,0x96,0x98,0x82,0x96,0x98,0x97,0x8C,0x95,0x96,0x97,
+            0x7D,0x91,0x97,0x98,0x8D,0x97,0x9A,0x97,0x81,0x95,0x91,0x97,0x8F,0x94,0x94,0x95,
+            0x7D,0x8E,0x96,0x97,0x87,0x7C,0x96,0x95,0x72,0x8F,0x94,0x97,0x8C,0x96,0x97,0x96,
+            0x7F,0x94,0x98,0x96,0x90,0x97,0x98,0x96,0x84,0x99,0x96,0x97,0x93,0x98,0x9B,0x97,
+            0x7E,0x97,0x98,0x99,0x8B,0x98,0x8B,0x99,0x86,0x98,0x97,0x97,0x92,0x99,0x97,0x98,
+            0x7F,0x98,0x98,0x97,0x8F,0x97,0x98,0x96,0x84,0x93,0x93,0x98,0x8F,0x96,0x97,0x93,
+            0x7A,0x95,0x95,0x92,0x8C,0x93,0x95,0x93,0x7D,0x8C,0x94,0x91,0x8E,0x92,0x94,0x94,
+            0x78,0x93,0x93,0x95,0x8E,0x95,0x95,0x95,0x7E,0x96,0x95,0x96,0x8E,0x97,0x97,0x96,
+            0x7A,0x94,0x95,0x95,0x8D,0x97,0x96,0x95,0x7F,0x94,0x94,0x96,0x8F,0x96,0x95,0x97,
+            0x7D,0x94,0x95,0x97,0x8D,0x97,0x95,0x96,0x83,0x96,0x95,0x97,0x90,0x97,0x97,0x95,
+            0x79,0x93,0x96,0x94,0x8C,0x92,0x96,0x95,0x81,0x94,0x8A,0x96,0x8D,0x95,0x95,0x95,
+            0x7A,0x96,0x95,0x95,0x8F,0x96,0x95,0x96,0x81,0x93,0x91,0x8F,0x91,0x94,0x97,0x95,
+            0x7D,0x96,0x96,0x95,0x8D,0x94,0x95,0x96,0x80,0x8D,0x93,0x8F,0x87,0x95,0x95,0x96,
+            0x7B,0x94,0x92,0x90,0x8E,0x92,0x91,0x91,0x7F,0x8F,0x8F,0x8C,0x86,0x86,0x81,0x76,
+            0x57,0x6B,0x75,0x7C,0x71,0x84,0x81,0x7C,0x7E,0x8B,0x8C,0x89,0x7F,0x93,0x90,0x7F,
+            0x81,0x90,0x93,0x8D,0x7F,0x97,0x89,0x87,0x8C,0x96,0x98,0x9A,0x87,0x9A,0x98,0x98,
+            0x89,0x9A,0x99,0x99,0x8B,0x9D,0x9B,0x9B,0x8B,0x9A,0x8E,0x99,0x86,0x9C,0x98,0x9A,
+            0x8B,0x92,0x92,0x99,0x87,0x97,0x9D,0x95,0x8E,0x97,0x99,0x9B,0x86,0x99,0x87,0x9B,
+            0x87,0x7E,0x83,0x79,0x68,0x77,0x80,0x7E,0x71,0x89,0x86,0x8D,0x74,0x89,0x8D,0x8F,
+            0x7F,0x8C,0x97,0x82,0x75,0x89,0x87,0x88,0x89,0x98,0x99,0x9A,0x7E,0x92,0x96,0x9A,
+            0x8B,0x9B,0x92,0x95,0x88,0x97,0x83,0x98,0x8A,0x9A,0x98,0x91,0x80,0x9A,0x98,0x97,
+            0x86,0x95,0x8F,0x91,0x7D,0x8E,0x9A,0x90,0x8C,0x98,0x95,0x96,0x7F,0x93,0x97,0x97,
+            0x87,0x92,0x91,0x7C,0x71,0x7D,0x8C,0x88,0x80,0x90,0x98,0x87,0x83,0x8B,0x97,0x95,
+            0x86,0x94,0x99,0x8C,0x81,0x88,0x97,0x92,0x7F,0x9B,0x99,0x9A,0x86,0x90,0x9B,0x99,
+            0x8C,0x9A,0x9A,0x93,0x8D,0x92,0x9C,0x98,0x8E,0x99,0x9B,0x8C,0x8B,0x9C,0x9B,0x96,
+            0x8D,0x99,0x9A,0x91,0x89,0x83,0x9C,0x90,0x88,0x97,0x95,0x96,0x8B,0x90,0x95,0x96,
+            0x8E,0x96,0x97,0x9B,0x8E,0x8F,0x91,0x97,0x8C,0x99,0x99,0x9A,0x92,0x9B,0x97,0x9A,
+            0x8A,0x88,0x9A,0x99,0x90,0x99,0x9A,0x9A,0x92,0x9D,0x99,0x9D,0x93,0x99,0x96,0x99,
+            0x8F,0x9A,0x9B,0x9B,0x92,0x9A,0x97,0x99,0x86,0x8E,0x99,0x94,0x94,0x99,0x99,0x98,
+            0x8B,0x97,0x8F,0x8D,0x92,0x93,0x94,0x8F,0x85,0x8E,0x8A,0x87,0x82,0x7F,0x7A,0x79,
+            0x71,0x71,0x74,0x68,0x5D,0x6D,0x6F,0x6A,0x70,0x92,0x80,0x7F,0x67,0x8B,0x80,0x7C,
+            0x6C,0x7E,0x93,0x7F,0x66,0x81,0x81,0x80,0x79,0x8D,0x8B,0x98,0x6D,0x87,0x85,0x8B,
+            0x7E,0x91,0x93,0x89,0x7E,0x93,0x8D,0x8F,0x79,0x8D,0x8C,0x7F,0x72,0x8B,0x88,0x89,
+            0x78,0x85,0x84,0x84,0x6C,0x8D,0x8F,0x7D,0x7D,0x87,0x88,0x82,0x6B,0x89,0x85,0x92,
+            0x7A,0x70,0x6D,0x5D,0x46,0x5B,0x6A,0x66,0x69,0x8B,0x79,0x73,0x55,0x6D,0x7B,0x75,
+            0x68,0x7A,0x91,0x6F,0x55,0x6B,0x79,0x72,0x6F,0x8A,0x8C,0x8A,0x5C,0x71,0x80,0x80,
+            0x74,0x91,0x91,0x7A,0x67,0x78,0x83,0x87,0x6C,0x89,0x8A,0x73,0x5E,0x78,0x82,0x7D,
+            0x6F,0x82,0x7E,0x75,0x5A,0x71,0x88,0x76,0x74,0x88,0x87,0x78,0x5C,0x73,0x7E,0x88,
+            0x85,0x81,0x7F,0x62,0x4F,0x5D,0x75,0x70,0x7C,0x95,0x8A,0x74,0x63,0x6D,0x8B,0x82,
+            0x79,0x87,0x94,0x71,0x61,0x6A,0x86,0x7C,0x8A,0x9C,0x97,0x91,0x68,0x72,0x92,0x90,
+            0x8B,0x9D,0xA1,0x83,0x71,0x7F,0x98,0x94,0x88,0x9A,0x9A,0x7A,0x67,0x80,0x8E,0x90,
+            0x82,0x90,0x8E,0x79,0x66,0x71,0x97,0x80,0x7E,0x96,0x94,0x7D,0x6A,0x72,0x8C,0x93,
+            0x61,0x58,0x55,0x52,0x5D,0x54,0x50,0x4E,0x5E,0x6E,0x63,0x6A,0x6E,0x66,0x62,0x62,
+            0x5D,0x60,0x6D,0x65,0x68,0x62,0x5F,0x61,0x5B,0x5F,0x5C,0x7C,0x75,0x6C,0x55,0x46,
+            0x62,0x61,0x5D,0x72,0x7E,0x63,0x58,0x4F,0x5B,0x5B,0x58,0x6B,0x71,0x72,0x51,0x49,
+            0x5B,0x5E,0x5B,0x5F,0x66,0x5E,0x58,0x50,0x5C,0x61,0x5E,0x58,0x65,0x5D,0x56,0x52,
+            0x71,0x7F,0x87,0x8B,0x87,0x8F,0x90,0x94,0x90,0x97,0x9D,0x99,0x8E,0x96,0x96,0x8B,
+            0x96,0x9C,0xA0,0xA0,0x8D,0xA3,0xA0,0x9C,0x9B,0xA1,0xA1,0xA2,0x8E,0xA1,0xA0,0x9F,
+            0x97,0xA6,0xA5,0xA4,0x9D,0xA8,0xA1,0xA7,0x9B,0xA0,0xA4,0xA6,0x9C,0xA7,0xA2,0x9F,
+            0x91,0x8E,0xA3,0xA4,0x99,0xA5,0xA6,0xA6,0xA0,0xA3,0xA8,0xA6,0x9C,0xA5,0xA4,0xA0,
+            0x8D,0x8E,0x94,0x88,0x80,0x8F,0x8B,0x8E,0x7D,0x96,0x96,0x8F,0x86,0x90,0x8E,0x91,
+            0x8F,0x8F,0xA5,0x9E,0x90,0x94,0x9A,0x9D,0x9C,0xA5,0xA2,0x9F,0x91,0x9F,0x9E,0xA1,
+            0x9A,0xA6,0x8B,0xA2,0x90,0xA5,0x8C,0xA6,0xA0,0xA6,0xA4,0x9C,0x93,0xA4,0x9A,0xA2,
+            0x9B,0xA6,0x9B,0xA3,0x97,0xA2,0x9F,0xA5,0xA0,0xA7,0xA5,0xA3,0x9C,0xA4,0x9E,0x9D,
+            0x90,0xA3,0xA3,0x97,0x84,0x9A,0x9C,0x9F,0x97,0x90,0xA3,0x88,0x93,0x9B,0xA2,0xA2,
+            0x95,0xA0,0xA4,0xA5,0x9E,0xA0,0xA3,0xA6,0x96,0xA4,0xA7,0xA5,0x96,0xA3,0xA2,0xA4,
+            0x98,0xA6,0xA6,0xA3,0x9B,0xA4,0xA7,0xA7,0x9E,0xA4,0xA4,0xA5,0x99,0xA3,0x9F,0xA3,
+            0x97,0xA6,0xA2,0xA4,0x9C,0xA4,0xA5,0xA7,0x96,0xA3,0xA2,0xA5,0x9F,0xA6,0xA1,0xA4,
+            0x98,0xA7,0xA5,0xA0,0x9B,0x99,0xA3,0xA1,0x9C,0xA3,0xA4,0xA4,0xA1,0xA5,0xA3,0xA5,
+            0x9A,0x9B,0xA5,0xA4,0xA1,0xA4,0xA3,0xA6,0x9C,0xA6,0xA6,0xA4,0xA1,0xA4,0xA2,0x9C,
+            0x99,0xA2,0xA2,0xA6,0x9F,0xA0,0xA3,0xA2,0x95,0x99,0xA0,0x99,0x9C,0xA1,0x9F,0x9E,
+            0x96,0x9E,0x9C,0x93,0x9A,0x9A,0x98,0x97,0x93,0x95,0x95,0x91,0x8E,0x89,0x83,0x7B,
+            0x5C,0x70,0x6F,0x60,0x51,0x55,0x64,0x5C,0x6A,0x75,0x79,0x75,0x62,0x6C,0x73,0x72,
+            0x6B,0x78,0x73,0x73,0x61,0x66,0x74,0x73,0x6B,0x88,0x87,0x78,0x6B,0x74,0x7B,0x76,
+            0x78,0x93,0x8F,0x85,0x78,0x79,0x82,0x7F,0x70,0x8B,0x86,0x7A,0x6D,0x71,0x7B,0x78,
+            0x6A,0x7D,0x7A,0x71,0x64,0x6A,0x72,0x73,0x67,0x7E,0x7D,0x68,0x60,0x64,0x6E,0x68,
+            0x58,0x6B,0x68,0x56,0x47,0x53,0x5C,0x59,0x63,0x6F,0x70,0x66,0x50,0x62,0x69,0x68,
+            0x61,0x73,0x6C,0x60,0x50,0x5F,0x68,0x66,0x71,0x81,0x82,0x6F,0x59,0x6A,0x70,0x6E,
+            0x76,0x8B,0x89,0x75,0x66,0x71,0x78,0x76,0x6F,0x84,0x7E,0x6E,0x5C,0x6B,0x71,0x70,
+            0x63,0x74,0x73,0x61,0x51,0x5F,0x66,0x66,0x64,0x77,0x75,0x5A,0x4D,0x5B,0x67,0x60,
+            0x66,0x7A,0x77,0x5D,0x51,0x59,0x6B,0x61,0x71,0x7C,0x7E,0x6B,0x5E,0x66,0x78,0x73,
+            0x6F,0x82,0x7A,0x66,0x5D,0x65,0x76,0x6E,0x7A,0x91,0x89,0x85,0x67,0x6C,0x84,0x7C,
+            0x7F,0x98,0x95,0x7F,0x73,0x7A,0x89,0x80,0x7C,0x94,0x8A,0x78,0x68,0x7B,0x84,0x7A,
+            0x6F,0x87,0x7D,0x6B,0x5E,0x65,0x78,0x72,0x6A,0x87,0x80,0x66,0x59,0x5F,0x75,0x6E,
+            0x8A,0x94,0x9C,0x96,0x97,0xA0,0x9C,0x99,0x8A,0x9E,0x9E,0x9D,0x9C,0x9F,0xA1,0xA0,
+            0x89,0x9C,0xA6,0x9F,0x9A,0x9E,0xA1,0xA2,0x8A,0x98,0x9D,0x9C,0x9B,0x9C,0x9A,0x9C,
+            0x8E,0x9F,0x9F,0x9D,0x9B,0x90,0xA2,0x9E,0x8E,0x98,0xA0,0x97,0x9B,0xA2,0x9F,0xA1,
+            0x8B,0x98,0x9A,0x93,0x94,0x9C,0x97,0x95,0x82,0x91,0x91,0x8F,0x8C,0x88,0x83,0x78,
+            0x6C,0x7B,0x84,0x87,0x87,0x8E,0x90,0x91,0x95,0x96,0x97,0x94,0x8F,0x99,0x96,0x88,
+            0x94,0x96,0x9C,0x8D,0x97,0x98,0x9E,0x9B,0x9E,0x9E,0x9E,0xA0,0x9E,0xA0,0x9F,0x9F,
+            0x9D,0x9F,0xA0,0x9F,0x52,0xA1,0xA2,0xA0,0xA0,0x9E,0xA2,0xA0,0xA2,0xA5,0xA4,0xA1,
+            0x86,0x99,0x9E,0xA1,0x9E,0xA2,0x9D,0x9F,0xA2,0x99,0xA4,0xA1,0x9D,0xA0,0xA3,0xA1,
+            0x9D,0x8C,0xA3,0xA0,0x96,0x9E,0xA2,0xA5,0x87,0x99,0x9F,0xA1,0x95,0xA1,0xA3,0xA3,
+            0xA0,0xA2,0xA5,0xA2,0xA2,0x9C,0xA4,0xA2,0xA2,0xA4,0xA3,0xA0,0xA4,0xA4,0xA5,0xA2,
+            0x9F,0xA4,0xA5,0x9F,0xA1,0xA4,0x90,0xA4,0xA5,0xA3,0xA3,0xA3,0xA3,0xA0,0xA1,0xA4,
+            0xA0,0xA4,0xA3,0xA7,0x9E,0xA1,0xA0,0xA0,0xA1,0xA6,0xA2,0xA5,0xA4,0xA3,0xA3,0x9B,
+            0x9C,0xA2,0x9D,0x95,0x97,0x9E,0x99,0x86,0x9B,0x9A,0xA0,0x96,0x9B,0x98,0xA0,0x9C,
+            0x98,0x9E,0xA0,0x9D,0xA0,0x9C,0xA1,0xA0,0xA1,0xA4,0xA2,0xA5,0xA1,0xA3,0xA2,0xA1,
+            0xA3,0xA4,0xA3,0xA4,0xA4,0xA2,0xA4,0xA3,0xA0,0xA3,0xA3,0xA1,0xA1,0xA4,0x90,0xA0,
+            0x9F,0xA2,0xA0,0xA1,0xA3,0xA2,0xA1,0xA3,0x9F,0xA3,0xA1,0xA0,0xA0,0xA0,0xA0,0xA2,
+            0xA0,0x9E,0x9E,0x9C,0x93,0x9E,0x86,0x8B,0xA0,0xA2,0x9F,0xA1,0x9F,0x9D,0x9D,0x9F,
+            0x9C,0x9C,0xA5,0x9E,0x9D,0xA0,0xA2,0x9F,0xA1,0xA2,0xA0,0xA3,0xA0,0xA0,0xA0,0xA0,
+            0x9E,0xA2,0x9F,0xA0,0x9F,0x9F,0xA0,0xA0,0x95,0x95,0xA1,0x99,0x98,0xA0,0x8E,0x9C,
+            0x9C,0x9A,0x9A,0x94,0x9B,0x98,0x99,0x96,0x97,0x95,0x92,0x90,0x8E,0x87,0x82,0x76,
+            0x6B,0x80,0x88,0x8B,0x54,0x4D,0x97,0x97,0x86,0x9A,0x9B,0x9B,0x5C,0x57,0x9E,0x8D,
+            0x87,0x9D,0x9F,0xA0,0x5A,0x53,0xA0,0x9F,0x86,0xA0,0xA0,0x9F,0x67,0x6A,0xA2,0xA0,
+            0x83,0xA1,0xA3,0xA0,0x6F,0x70,0xA1,0xA3,0x85,0xA3,0xA3,0xA3,0x66,0x6A,0xA4,0xA2,
+            0x7E,0x9E,0xA4,0xA3,0x5D,0x50,0xA4,0xA1,0x84,0xA3,0xA2,0xA3,0x5E,0x54,0xA4,0xA0,
+            0x72,0x6E,0x6D,0x69,0x5A,0x69,0x6B,0x6B,0x64,0x80,0x6E,0x77,0x62,0x74,0x77,0x77,
+            0x60,0x70,0x84,0x75,0x5F,0x71,0x74,0x76,0x75,0x84,0x83,0x8F,0x6C,0x7C,0x80,0x7C,
+            0x77,0x8D,0x84,0x7F,0x6E,0x70,0x84,0x7C,0x74,0x87,0x86,0x77,0x66,0x7F,0x7D,0x78,
+            0x5D,0x77,0x76,0x71,0x5C,0x6D,0x7A,0x74,0x6A,0x78,0x78,0x6A,0x57,0x69,0x72,0x74,
+            0x81,0x86,0x88,0x74,0x5D,0x6B,0x7E,0x78,0x74,0x94,0x89,0x81,0x69,0x7B,0x88,0x85,
+            0x79,0x88,0x98,0x80,0x67,0x79,0x88,0x84,0x80,0x9A,0x9A,0x9B,0x6F,0x83,0x91,0x8A,
+            0x82,0x9C,0xA0,0x85,0x73,0x84,0x92,0x87,0x7E,0x97,0x9A,0x80,0x6B,0x82,0x8C,0x83,
+            0x7B,0x8C,0x8F,0x78,0x61,0x73,0x87,0x7E,0x71,0x8E,0x8E,0x6F,0x5A,0x6D,0x7F,0x7B,
+            0x86,0xA3,0xA2,0xA2,0x99,0x9F,0xA0,0xA0,0x8B,0xA0,0xA1,0xA3,0x9A,0xA0,0xA1,0xA2,
+            0x88,0x96,0xA0,0xA0,0x98,0x98,0xA1,0xA2,0x8A,0xA2,0xA2,0x9F,0x9A,0xA1,0xA2,0xA0,
+            0x89,0xA0,0x9F,0xA1,0x96,0xA0,0xA2,0xA1,0x87,0x98,0x9D,0x98,0x96,0x9B,0x9E,0x9E,
+            0x86,0x9D,0x9C,0x9B,0x96,0x99,0x97,0x96,0x88,0x96,0x93,0x91,0x8A,0x88,0x82,0x77,
+            0x71,0x80,0x86,0x89,0x8C,0x8F,0x92,0x93,0x8E,0x94,0x94,0x97,0x95,0x95,0x97,0x8B,
+            0x8E,0x96,0x96,0x96,0x95,0x97,0x97,0x99,0x91,0x98,0x97,0x97,0x96,0x9A,0x99,0x98,
+            0x8E,0x99,0x98,0x98,0x97,0x98,0x99,0x99,0x90,0x98,0x98,0x98,0x95,0x99,0x98,0x98,
+            0x8B,0x97,0x98,0x99,0x92,0x98,0x99,0x9A,0x93,0x99,0x9A,0x98,0x99,0x9A,0x9A,0x98,
+            0x91,0x92,0x98,0x97,0x95,0x96,0x99,0x9A,0x84,0x92,0x94,0x97,0x90,0x96,0x99,0x99,
+            0x96,0x98,0x98,0x99,0x96,0x9A,0x9A,0x9B,0x96,0x9A,0x9B,0x97,0x99,0x99,0x99,0x9D,
+            0x93,0x9A,0x98,0x96,0x95,0x99,0x8C,0x9B,0x94,0x9B,0x9A,0x9B,0x99,0x9A,0x9B,0x9A,
+            0x95,0x9B,0x96,0x9A,0x98,0x99,0x9A,0x98,0x97,0x99,0x99,0x99,0x96,0x96,0x98,0x95,
+            0x87,0x96,0x96,0x90,0x93,0x95,0x98,0x95,0x8E,0x94,0x97,0x8F,0x93,0x93,0x98,0x96,
+            0x8A,0x95,0x95,0x96,0x94,0x96,0x96,0x98,0x8E,0x97,0x96,0x96,0x95,0x97,0x97,0x97,
+            0x8F,0x97,0x96,0x96,0x94,0x96,0x97,0x97,0x91,0x97,0x98,0x96,0x95,0x97,0x97,0x97,
+            0x90,0x98,0x97,0x97,0x97,0x98,0x95,0x98,0x8C,0x98,0x94,0x97,0x97,0x97,0x96,0x98,
+            0x8E,0x97,0x98,0x95,0x96,0x96,0x98,0x93,0x92,0x99,0x97,0x97,0x98,0x99,0x97,0x99,
+            0x92,0x96,0x97,0x95,0x98,0x96,0x95,0x97,0x92,0x99,0x98,0x97,0x97,0x98,0x98,0x98,
+            0x91,0x99,0x96,0x8D,0x96,0x97,0x9A,0x97,0x8F,0x92,0x96,0x94,0x94,0x98,0x96,0x98,
+            0x91,0x95,0x95,0x93,0x92,0x94,0x92,0x92,0x8F,0x91,0x8F,0x8E,0x8B,0x86,0x82,0x78,
+            0x71,0x7E,0x87,0x89,0x8F,0x93,0x94,0x94,0x8E,0x95,0x97,0x98,0x97,0x9A,0x9A,0x8B,
+            0x8F,0x9C,0x9A,0x9B,0x96,0x9B,0x99,0x9A,0x92,0x9B,0x99,0x9D,0x9A,0x9C,0x9B,0x99,
+            0x8C,0x9F,0x9C,0x9D,0x99,0x9E,0x9D,0x9B,0x92,0x9D,0x9D,0x9D,0x9A,0x9E,0x9C,0x9C,
+            0x8B,0x9A,0x9E,0x9F,0x95,0x9C,0x9E,0x9C,0x91,0x9C,0x9D,0x9F,0x9B,0x9E,0x9D,0x9C,
+            0x8F,0x93,0x9C,0x9E,0x92,0x96,0x9C,0x9D,0x84,0x93,0x94,0x9C,0x92,0x9A,0x9C,0x9D,
+            0x91,0x9E,0x9D,0x9B,0x9B,0x9D,0x9E,0x9C,0x91,0x9D,0x9D,0x9A,0x9B,0x9D,0xA0,0x9E,
+            0x90,0x9C,0x9B,0x9E,0x98,0x9D,0x8F,0x9D,0x91,0x9D,0x9A,0x9F,0x9A,0x9D,0x9C,0x9D,
+            0x92,0x9D,0x9F,0x9E,0x99,0x9C,0x9B,0x9B,0x93,0x9E,0x9D,0x9C,0x9A,0x9E,0x9D,0x99,
+            0x8C,0x9C,0x9B,0x94,0x98,0x98,0x9E,0x9D,0x8E,0x96,0x98,0x95,0x99,0x95,0x9B,0x9C,
+            0x8D,0x9A,0x97,0x9B,0x9A,0x99,0x9C,0x9F,0x8B,0x9F,0x9D,0x9D,0x99,0x9D,0x9D,0x9A,
+            0x8F,0x9B,0x9C,0x9E,0x94,0x9E,0x9D,0x9D,0x92,0x95,0x9D,0x9D,0x9B,0x9D,0x9E,0x9B,
+            0x8F,0x9C,0x9D,0x9F,0x99,0x9D,0x9C,0x9A,0x8F,0x9D,0x9C,0x9D,0x9A,0x9B,0x9D,0x9D,
+            0x8F,0x9B,0x93,0x9F,0x99,0x9C,0x9B,0x94,0x90,0x9F,0x9A,0x9D,0x99,0x9C,0x9C,0x9C,
+            0x8C,0x9B,0x9E,0x9D,0x9A,0x9A,0x9C,0x9D,0x92,0x9D,0x9D,0x9E,0x97,0x9B,0x9B,0x9B,
+            0x91,0x9B,0x9C,0x98,0x93,0x9C,0x9B,0x9C,0x8C,0x93,0x9A,0x93,0x95,0x9B,0x9A,0x9A,
+            0x8C,0x98,0x98,0x95,0x94,0x98,0x97,0x93,0x8C,0x94,0x90,0x8F,0x8C,0x87,0x81,0x77,
+            0x54,0x68,0x75,0x7C,0x72,0x85,0x89,0x88,0x84,0x8D,0x92,0x91,0x8C,0x95,0x93,0x6D,
+            0x86,0x9A,0x99,0x99,0x93,0x98,0x9C,0x9E,0x8C,0x88,0x9D,0x9F,0x93,0xA2,0xA1,0x9E,
+            0x86,0x9E,0xA2,0xA2,0x93,0x9E,0xA4,0xA4,0x85,0x89,0x9B,0xA2,0x99,0xA0,0xA0,0xA0,
+            0x89,0x77,0xA3,0xA3,0x96,0x89,0xA3,0xA4,0x87,0x93,0x99,0x92,0x8F,0x96,0xA2,0xA5,
+            0x84,0x61,0x96,0x9B,0x78,0x7C,0xA0,0xA0,0x59,0x70,0x96,0x92,0x6E,0x7D,0x9E,0x9C,
+            0x84,0xA3,0xA0,0x78,0x9A,0x6D,0xA2,0xA7,0x8B,0xA1,0xA7,0x90,0x9A,0x9F,0xA7,0xA6,
+            0x88,0xA3,0x7E,0xA5,0x93,0xA5,0x6D,0xA6,0x8B,0xA2,0x9B,0xA5,0x9C,0xA4,0xA6,0xA4,
+            0x89,0xA1,0xA2,0xA2,0x96,0x9C,0xA3,0xA3,0x8C,0xA6,0xA8,0xA6,0x9D,0x9F,0x9F,0xA0,
+            0x78,0x87,0xA5,0x78,0x90,0x83,0xA6,0xA5,0x83,0x7A,0xA1,0x71,0x99,0x86,0xA6,0xA6,
+            0x7E,0x9A,0xA3,0xA5,0x9B,0xA6,0xA6,0xA5,0x82,0x73,0xA5,0xA5,0x9B,0xA6,0xA5,0xA6,
+            0x83,0xA3,0x9C,0xA5,0x99,0xA7,0xA8,0xA6,0x7D,0xA2,0xA6,0xA5,0x9B,0xA8,0xA6,0xA5,
+            0x81,0xA2,0xA6,0xA4,0x9B,0xA5,0xA3,0xA4,0x79,0x88,0x83,0x99,0x9C,0x9B,0x83,0x85,
+            0x7E,0x95,0xA0,0x84,0x89,0x89,0x8E,0x85,0x86,0xA1,0x9F,0xA2,0x92,0xA3,0xA2,0xA5,
+            0x87,0x9D,0xA3,0x9E,0x9A,0xA2,0xA3,0xA2,0x87,0x9D,0xA1,0xA0,0x95,0x94,0xA0,0xA1,
+            0x87,0x9E,0x9F,0x7F,0x97,0x9F,0x9D,0x9E,0x6F,0x7D,0x9D,0x92,0x94,0x9B,0x9C,0x9B,
+            0x83,0x99,0x85,0x78,0x93,0x92,0x89,0x8D,0x84,0x8B,0x88,0x82,0x82,0x7B,0x76,0x74,
+            0x71,0x7E,0x89,0x8B,0x8D,0x95,0x97,0x98,0x91,0x9B,0x9B,0x9E,0x9C,0x9E,0x9F,0x8C,
+            0x94,0xA1,0xA0,0xA1,0x9E,0x88,0xA3,0xA2,0x9E,0xA5,0xA3,0xA2,0x9E,0x92,0xA2,0xA2,
+            0x94,0xA5,0xA3,0xA7,0x9E,0x8C,0xA6,0xA7,0x99,0xA7,0xA5,0xA7,0xA2,0x87,0xA3,0xA3,
+            0x99,0x9F,0xA5,0xA8,0xA0,0x90,0xA8,0xA7,0x9E,0xA5,0xA4,0xA7,0xA2,0x90,0xA8,0xA7,
+            0x9C,0x92,0xA5,0xA6,0x98,0x98,0xA7,0xA8,0x80,0x99,0x9F,0xA3,0x91,0xA1,0xA4,0xA4,
+            0x9C,0xA6,0xA8,0xA6,0xA3,0xA5,0xA5,0xA6,0x9E,0xA8,0xA6,0x9D,0xA6,0xA7,0xA4,0xA6,
+            0x9C,0xA7,0xA3,0xA6,0xA4,0xA4,0x90,0xA8,0x9D,0xA2,0xA3,0xA9,0xA6,0xA4,0xA6,0xA5,
+            0x9E,0xAA,0xA7,0xA8,0xA3,0x9D,0xA8,0xA3,0xA0,0xA9,0xA6,0xA8,0xA4,0x95,0xA7,0xA8,
+            0x97,0x9C,0xA9,0x9B,0xA3,0xA3,0xA6,0xA7,0x97,0x99,0xA8,0x90,0xA2,0xA0,0xA9,0xA5,
+            0x94,0xA5,0xA8,0xA8,0xA4,0xA7,0xA7,0xA9,0x98,0xA7,0xA8,0xA4,0xA2,0xA4,0xA6,0xAA,
+            0x97,0xA4,0xAA,0xA8,0xA4,0xA7,0xA9,0xA6,0x9A,0xA6,0xA8,0xA8,0xA2,0xA7,0xA7,0xA8,
+            0x99,0xA6,0xA8,0xA6,0xA4,0xA7,0xA6,0xA4,0x97,0xA4,0xA3,0xA6,0xA6,0xA2,0xA3,0xA6,
+            0x94,0x9C,0xA0,0x92,0xA0,0x9E,0xA6,0xA5,0x97,0xA7,0xA6,0xA4,0xA1,0xA4,0xA4,0xA5,
+            0x98,0xA3,0xA5,0xA4,0xA4,0xA5,0xA6,0xA5,0x9E,0xA7,0xA4,0xA7,0xA2,0xA3,0xA4,0xA1,
+            0x92,0xA4,0xA4,0xA2,0xA1,0xA2,0xA3,0xA2,0x8E,0x99,0xA0,0x99,0xA0,0xA0,0x9F,0xA0,
+            0x98,0x9E,0x9F,0x9C,0x9A,0x9D,0x98,0x96,0x8D,0x96,0x93,0x91,0x8A,0x87,0x83,0x78,
+            0x73,0x7A,0x88,0x8C,0x8F,0x94,0x95,0x98,0x94,0x9B,0x9C,0x9D,0x9D,0xA0,0xA1,0x8C,
+            0x98,0xA3,0xA1,0xA2,0x9D,0xA2,0xA3,0xA2,0x9F,0xA4,0xA5,0xA3,0xA1,0xA5,0xA4,0xA0,
+            0x92,0xA6,0xA7,0xA6,0x87,0xA4,0xA7,0xA8,0x95,0xA5,0xA8,0xA7,0xA1,0xA6,0xA4,0xA3,
+            0x9E,0x9D,0xA7,0xA7,0x9B,0xA5,0xA8,0xA8,0x9D,0xA6,0xA7,0x9A,0xA4,0xA6,0xA5,0xA0,
+            0x99,0x96,0xA6,0xA7,0x94,0xA0,0xA7,0xA6,0x77,0x93,0xA1,0xA3,0x8A,0x9C,0xA4,0xA3,
+            0x9A,0xA6,0xA7,0xA4,0xA5,0xA7,0xA6,0xA6,0xA1,0xA9,0xA9,0xA1,0xA6,0xA7,0xA7,0xA5,
+            0x9D,0xAB,0xA6,0xA7,0x9C,0xA6,0x8F,0xAA,0x9A,0xAA,0xA7,0xA8,0xA5,0xA3,0xA8,0xA6,
+            0xA0,0xA8,0xA8,0xA9,0x98,0x9F,0xA7,0xA6,0xA0,0xAB,0xAA,0xA6,0xA6,0x96,0xA7,0xA6,
+            0x93,0xA7,0xA8,0x9F,0xA2,0xA5,0xA7,0xA7,0x8F,0x9C,0xA9,0x9E,0xA6,0x9E,0xA6,0xA4,
+            0x96,0xA3,0xA9,0xA6,0xA3,0xA7,0xA7,0xA6,0x99,0xA5,0xA8,0xA8,0xA4,0xA7,0xA8,0xA4,
+            0x93,0xA4,0xA7,0xA8,0xA3,0xA9,0xA8,0xAA,0x9B,0xA9,0xA7,0xA7,0xA6,0xA7,0xAA,0xAA,
+            0x99,0xA8,0xAA,0xA8,0xA2,0xA9,0xA6,0xA8,0x98,0xA6,0xA5,0xA6,0xA5,0xA6,0xA5,0xA5,
+            0x7F,0x86,0x88,0x93,0x9C,0x96,0x8E,0x90,0x9A,0xA3,0xA5,0xA3,0xA2,0xA4,0xA2,0xA5,
+            0x9C,0xA3,0xA8,0xA5,0xA3,0xA6,0xA5,0xA6,0x9D,0xA6,0xA5,0xA5,0xA2,0xA4,0xA7,0xA2,
+            0x9C,0xA5,0xA2,0x9E,0xA2,0xA1,0xA4,0xA2,0x89,0x98,0xA1,0x96,0xA2,0xA2,0x9F,0xA0,
+            0x98,0x9D,0x9D,0x9C,0x9D,0x9A,0x99,0x97,0x92,0x96,0x93,0x92,0x8E,0x83,0x83,0x75,
+            0x71,0x80,0x89,0x8C,0x8E,0x93,0x96,0x97,0x88,0x9D,0x9D,0x9D,0x97,0x9F,0xA0,0x87,
+            0x82,0xA1,0xA0,0xA0,0x98,0xA3,0xA2,0x9F,0x83,0xA2,0xA4,0xA1,0x98,0xA4,0xA4,0xA4,
+            0x8D,0xA7,0xA5,0xA6,0x8D,0xA6,0xA4,0xA7,0x8C,0xA7,0xA7,0xA7,0x96,0xA4,0xA4,0xA5,
+            0x8F,0xA0,0xA5,0xA9,0x96,0xA3,0xA8,0xAA,0x8D,0xA3,0xA6,0xA1,0x9C,0xA8,0xA7,0xA8,
+            0x7F,0x8A,0xA7,0xA4,0x93,0xA0,0xA5,0xA7,0x7D,0x9A,0xA1,0xA3,0x95,0x9F,0xA8,0xA8,
+            0x8B,0xA8,0xA6,0xA4,0x9E,0xA8,0xA9,0xA8,0x8F,0xA5,0xA8,0xA1,0x9D,0xA8,0xA9,0xA7,
+            0x8E,0xA8,0xA4,0xA8,0x97,0xA5,0x8D,0xA7,0x91,0xA8,0xA2,0xAC,0xA0,0xA6,0xA7,0xA6,
+            0x8B,0xA7,0xA7,0xA8,0x9D,0xA2,0xA7,0xA4,0x8C,0xA8,0xA8,0xA6,0x9A,0xA7,0xA7,0xA9,
+            0x84,0xA5,0xA6,0x9D,0x97,0xA3,0xA7,0xA9,0x86,0xA1,0xA6,0x9C,0x9C,0x9D,0xA6,0xA5,
+            0x83,0xA2,0xA7,0xA4,0x97,0xA8,0xA8,0xA6,0x7D,0xA2,0xA7,0xA7,0x96,0xA8,0xA8,0xA7,
+            0x86,0xA5,0xA6,0xA7,0x99,0xA4,0xA9,0x9F,0x89,0xA3,0xA7,0xAA,0x9F,0xAA,0xA8,0xA9,
+            0x8A,0xA5,0xA4,0xA4,0x9B,0xA7,0xA6,0xA9,0x88,0xA6,0xA2,0xA8,0x9D,0xA6,0xA5,0x9F,
+            0x7D,0x8C,0x93,0x9E,0x98,0x9B,0x99,0x9A,0x8D,0xA3,0xA5,0xA8,0x9D,0xA6,0xA3,0xA6,
+            0x87,0xA5,0xA7,0xA5,0x97,0xA4,0xA5,0xA6,0x8A,0xA5,0xA5,0xA5,0x8D,0xA1,0xA4,0xA2,
+            0x8A,0xA2,0xA4,0xA0,0x9C,0xA1,0xA4,0xA4,0x8A,0x96,0x9E,0x99,0x9A,0xA1,0xA1,0x9F,
+            0x8A,0x9E,0x9E,0x98,0x96,0x9C,0x99,0x98,0x82,0x94,0x94,0x91,0x88,0x89,0x81,0x79,
+            0x6D,0x7A,0x86,0x80,0x84,0x8B,0x90,0x8C,0x94,0x98,0x94,0x9A,0x97,0x98,0x9D,0x8A,
+            0x95,0x99,0x98,0x99,0x94,0x9E,0x9C,0x99,0xA3,0xA1,0xA0,0xA3,0x9E,0xA1,0xA3,0xA2,
+            0x9B,0xA4,0xA4,0xA2,0x52,0xA2,0xA6,0xA8,0xA5,0xA5,0xA1,0xA1,0xA2,0xA6,0xA1,0xA3,
+            0x83,0x9F,0x90,0xA4,0xA2,0x9D,0xA7,0xA3,0xA6,0xA1,0x9F,0xA5,0xA2,0xA6,0xA5,0xA7,
+            0x9F,0x8F,0xA5,0x99,0x86,0x98,0xA3,0xA4,0x8A,0x9A,0xA2,0xA1,0x97,0xA1,0xA8,0xA7,
+            0x9F,0xA4,0xA5,0xA2,0xA7,0xA8,0xA5,0xA9,0xA6,0xA7,0xA9,0xA4,0xA5,0xA5,0xA8,0xAA,
+            0x9F,0xA7,0xA8,0xA4,0xA4,0xA6,0x93,0xAA,0xAA,0xAA,0xA7,0xA9,0xA8,0xA6,0xA8,0xA9,
+            0xA2,0xA9,0xA9,0xA6,0xA6,0xA4,0xA4,0xA4,0xA7,0xAB,0xA4,0xA8,0xA9,0xA9,0xA7,0xA8,
+            0x9C,0xA2,0xA7,0x95,0x97,0x97,0xA0,0x96,0xA0,0x9D,0xA6,0x98,0xA2,0x99,0xA5,0xA2,
+            0x9A,0xA2,0xA4,0xA4,0xA6,0x9C,0xA7,0xA2,0xA5,0xA7,0xA9,0xA7,0xA4,0xA6,0xA8,0xA2,
+            0xA3,0xA6,0xA8,0xA2,0xA6,0xA8,0xA8,0xA9,0xA5,0xA7,0xA9,0xA6,0xA8,0xA6,0xA5,0xA7,
+            0xA1,0xA7,0xA5,0xA5,0xA0,0xA4,0xA8,0xA3,0xA2,0xA7,0xA5,0xA7,0xA2,0xA1,0xA5,0xA4,
+            0x69,0x73,0x73,0x83,0x88,0x83,0x7D,0x7E,0xA3,0xA6,0xA1,0x97,0x9B,0xA1,0x9F,0xA1,
+            0xA1,0x9A,0xA5,0x9F,0xA2,0xA2,0xA1,0x9E,0xA0,0xA6,0xA3,0xA4,0xA2,0x9E,0xA3,0xA3,
+            0x9D,0xA4,0xA6,0x95,0xA2,0x9C,0xA4,0xA0,0x97,0x9A,0xA1,0x98,0x9E,0xA0,0xA1,0xA0,
+            0x9E,0x9F,0x9B,0x96,0x9A,0x98,0x9A,0x96,0x96,0x95,0x8F,0x8C,0x8C,0x87,0x81,0x7B,
+            0x6D,0x80,0x8A,0x8C,0x87,0x94,0x97,0x98,0x84,0x9A,0x81,0x9D,0x96,0x9E,0xA0,0x8E,
+            0x83,0xA2,0xA1,0xA1,0x99,0xA5,0xA4,0xA3,0x86,0xA3,0xA4,0xA0,0x9A,0xA5,0xA6,0xA0,
+            0x84,0xA7,0xA6,0xA6,0x9A,0xA8,0xA8,0xA5,0x82,0xA8,0xA2,0xA8,0x95,0xA7,0xA2,0xA5,
+            0x82,0xA0,0xA6,0xA7,0x99,0xA7,0xA2,0xAA,0x86,0xA7,0xA5,0xA7,0x99,0xA8,0xA7,0xA8,
+            0x7E,0x9D,0xA4,0x9A,0x84,0x97,0x9E,0xA1,0x81,0x9D,0xA8,0xA8,0x95,0xA4,0xA6,0xA5,
+            0x83,0xA8,0xA7,0xA4,0x9C,0xAA,0xA9,0xA8,0x84,0xA5,0xA7,0xA4,0x9B,0xA8,0xA9,0xA7,
+            0x81,0xA7,0xA7,0xA3,0x97,0xA3,0x96,0xA3,0x85,0xAB,0xA6,0xAC,0x9F,0xA5,0xAB,0xA6,
+            0x7F,0xA6,0xA9,0xA4,0x97,0xA7,0xA4,0xA7,0x83,0xA8,0xA3,0xA9,0x98,0xA9,0xA9,0xA4,
+            0x82,0xA5,0xA5,0x97,0x8E,0x96,0xA0,0x9C,0x86,0xA1,0xA6,0x9F,0x9E,0xA2,0xA6,0xA6,
+            0x83,0xA5,0xA4,0xA8,0x9D,0xA8,0xA6,0x9C,0x83,0xA4,0xA9,0xA7,0x97,0xAA,0xA2,0xA5,
+            0x84,0xA7,0xA6,0xAA,0x9A,0xA9,0xA9,0xAA,0x88,0xA6,0xA8,0xAB,0x9C,0xAB,0xA8,0xA9,
+            0x85,0xA8,0xA3,0xA7,0x9B,0xA6,0xA6,0xAA,0x83,0xA9,0xA4,0xA7,0x9C,0xA5,0xA5,0xA4,
+            0x6B,0x79,0x77,0x87,0x8D,0x88,0x82,0x7F,0x86,0xA7,0xA5,0xA8,0x9A,0xA7,0xA5,0xA7,
+            0x86,0xA7,0xA4,0xA6,0x95,0xA4,0xAA,0xA7,0x89,0xA4,0xA8,0xA3,0x98,0xA4,0xA4,0xA5,
+            0x85,0xA3,0xA5,0xA2,0x9C,0xA2,0xA5,0xA1,0x87,0x97,0x9F,0x9B,0x9A,0xA2,0xA1,0xA0,
+            0x86,0x9E,0x9D,0x9D,0x98,0x99,0x99,0x9A,0x86,0x95,0x92,0x92,0x8B,0x88,0x81,0x76,
+            0x73,0x7B,0x8A,0x8B,0x8F,0x94,0x97,0x98,0x90,0x9B,0x9F,0x9D,0x9B,0xA0,0xA2,0x8B,
+            0x94,0xA0,0xA0,0xA3,0x9C,0xA4,0xA2,0xA2,0x9A,0xA2,0xA6,0xA3,0xA0,0xA5,0xA4,0xA5,
+            0x96,0xA8,0xA5,0xA6,0xA5,0xA8,0xA7,0xA5,0x95,0xA6,0xA1,0xAA,0x9D,0xA7,0xA7,0xA4,
+            0x92,0x9E,0x9E,0xAA,0x9A,0xAA,0xAB,0xA9,0x9D,0xA4,0xA7,0xA5,0xA2,0xAA,0xA7,0xA7,
+            0x8C,0x94,0xA5,0xA7,0x96,0x9D,0xA6,0xA8,0x82,0x99,0xA1,0xA6,0x94,0x9E,0xA5,0xA7,
+            0x99,0xA9,0xA8,0xA4,0xA3,0xA7,0xA6,0xA7,0x98,0xA8,0xA5,0xA1,0xA4,0xA8,0xAA,0xA7,
+            0x98,0xA7,0xA3,0xA8,0x92,0xA6,0x8B,0xA9,0x9E,0xA9,0xA4,0xAD,0xA5,0xA7,0xA8,0xA5,
+            0x9B,0xA9,0xA5,0xAA,0x9B,0xA3,0xA4,0xAA,0x98,0xA8,0xA7,0xAA,0xA4,0xAA,0xA8,0xA7,
+            0x8D,0xA3,0xA6,0x9A,0x9E,0x9D,0xA8,0xA8,0x96,0x9D,0xA7,0x97,0x9F,0x9C,0xA9,0xA7,
+            0x8F,0xA4,0xA4,0xA6,0xA4,0xA3,0xA8,0xA2,0x8B,0xA5,0xA5,0xA7,0x9E,0xA7,0xA8,0xAB,
+            0x90,0xA8,0xA7,0xA9,0xA1,0xA6,0xA8,0xA8,0x95,0xA6,0xA6,0xA9,0xA3,0xA7,0xA6,0xA7,
+            0x8F,0xA4,0xA4,0xA5,0xA4,0xA4,0xA2,0xA9,0x8D,0xA6,0xA4,0xAA,0xA4,0xA4,0xA5,0xA4,
+            0x85,0x90,0x8D,0x9E,0x9D,0x9C,0x9A,0x9B,0x95,0xA4,0xA6,0xA7,0xA4,0xA4,0xA6,0xA6,
+            0x96,0xA9,0xA7,0xA6,0x9B,0xA3,0xA4,0xA6,0x91,0xA3,0xA4,0xA6,0xA0,0xA6,0xA5,0xA3,
+            0x98,0xA4,0xA5,0xA2,0x9D,0xA1,0xA3,0xA3,0x8E,0x96,0xA1,0x99,0x9D,0xA0,0xA0,0xA1,
+            0x93,0x9E,0x9C,0x98,0x9B,0x9C,0x98,0x9A,0x94,0x97,0x93,0x92,0x8D,0x88,0x83,0x78,
+            0x74,0x7E,0x89,0x8D,0x8D,0x94,0x97,0x9A,0x8E,0x9B,0x9E,0x9D,0x99,0xA1,0xA0,0x8D,
+            0x8A,0xA0,0xA0,0xA1,0x99,0xA2,0xA1,0xA3,0x8F,0xA3,0xA5,0xA2,0x9D,0xA5,0xA4,0xA3,
+            0x90,0xA7,0xA7,0xA8,0x9C,0xA7,0xA5,0xA8,0x8F,0xA6,0x97,0xA5,0x9E,0xA7,0xA6,0xA5,
+            0x91,0x9F,0xA6,0xA9,0x9C,0xA5,0xA8,0xA9,0x93,0xA4,0xA7,0x8E,0xA3,0xA8,0xA7,0xA6,
+            0x8A,0x96,0xA5,0xAB,0x96,0x9E,0xA6,0xA6,0x80,0x98,0xA2,0xA4,0x91,0xA0,0xA7,0xA6,
+            0x8F,0xA9,0xA4,0xA4,0xA3,0xA6,0xA5,0xA8,0x93,0xA6,0xA9,0xA5,0xA3,0xA7,0xA9,0xA7,
+            0x8E,0xA7,0xA5,0xA9,0x98,0xA0,0x91,0xA5,0x95,0xA8,0xA7,0xA9,0xA4,0xA7,0xA7,0xA5,
+            0x94,0xA7,0xA6,0xA7,0x9F,0xA2,0xA5,0xA6,0x95,0xA7,0xA0,0xA8,0x9D,0xAB,0xA8,0xAA,
+            0x8B,0xA7,0xA7,0x9A,0x98,0xA1,0xAA,0xA6,0x8D,0x9E,0xA9,0x9C,0xA1,0xA0,0xAC,0xA2,
+            0x8C,0xA3,0xA3,0xA7,0x9F,0xA8,0xA9,0x97,0x89,0xA6,0xA9,0xA8,0x9E,0xA7,0xA6,0xA7,
+            0x8D,0xA5,0xA6,0xA8,0x9F,0xA6,0xA9,0xA7,0x8D,0xA6,0xA6,0xAB,0x9F,0xA6,0xA9,0xA9,
+            0x8F,0xA5,0xA5,0xA7,0x9E,0xA6,0xA7,0xA4,0x90,0xA8,0xA4,0xA6,0xA0,0xA8,0xA0,0xA5,
+            0x81,0x8C,0x8A,0x9D,0x9D,0x9E,0x99,0x99,0x90,0xA4,0xA5,0xA9,0xA1,0xA4,0xA5,0xA4,
+            0x8F,0xA6,0xA4,0xA6,0x9B,0xA6,0xA5,0xA4,0x90,0xA4,0xA6,0xA6,0x99,0xA5,0xA3,0xA5,
+            0x8F,0xA6,0xA3,0xA2,0x9A,0xA2,0xA2,0xA4,0x88,0x95,0xA3,0x97,0x8E,0xA1,0x9F,0xA0,
+            0x8E,0x9D,0x9D,0x9A,0x99,0x9B,0x9A,0x97,0x8B,0x96,0x93,0x91,0x8D,0x88,0x82,0x7B,
+            0x58,0x6B,0x69,0x80,0x70,0x83,0x8B,0x8E,0x8B,0x8C,0x93,0x94,0x93,0x97,0x99,0x7F,
+            0x94,0x9B,0x9A,0x9C,0x9C,0xA2,0xA0,0xA0,0x9B,0x9B,0xA0,0x9F,0x9F,0xA0,0x93,0xA2,
+            0x93,0x9F,0xA5,0x9F,0x9F,0xA4,0xA3,0xA7,0x9C,0x97,0x94,0x9D,0xA1,0xA1,0xA6,0xA0,
+            0x9C,0x96,0x9A,0xA4,0x9F,0xA1,0xA6,0xA6,0x9E,0x98,0xA5,0x9D,0x99,0xA4,0xA5,0xA5,
+            0x96,0x80,0xA3,0xA4,0x86,0x90,0xA1,0xA1,0x6D,0x81,0x9C,0x9F,0x7F,0x90,0xA0,0xA1,
+            0x9C,0xA5,0xA2,0xA1,0xA5,0xA6,0xA4,0xA7,0x9D,0xA4,0xA7,0xA1,0xA2,0xA7,0xA7,0xA7,
+            0x99,0xA6,0xA1,0xA5,0xA3,0xA8,0x7F,0xA5,0x9E,0xA8,0x9E,0xA8,0xA6,0xA4,0xA4,0xA6,
+            0xA0,0xA4,0xA6,0xA3,0x9F,0x97,0xA1,0x9E,0xA0,0xA9,0xA7,0xA8,0xA7,0xA7,0xAA,0xA7,
+            0x90,0xA4,0xA6,0x92,0x9F,0x90,0xA5,0xA2,0x97,0x8A,0xA2,0x88,0xA5,0x9B,0xA7,0xA3,
+            0x93,0xA5,0xA6,0xA6,0xA0,0xA5,0xA9,0xA7,0x8D,0xA2,0xA9,0xAA,0xA3,0xA7,0xA8,0xAA,
+            0x98,0xA6,0xA4,0xA7,0xA4,0xA7,0xA6,0xA3,0x9A,0xA3,0xA8,0xAB,0xA4,0xA7,0xA7,0xA7,
+            0x99,0xA7,0xA8,0xA6,0xA4,0xA8,0xA8,0xA3,0x98,0xA0,0x9D,0xA5,0xA3,0xA5,0x98,0x9E,
+            0x98,0x9E,0xA5,0xA0,0x97,0x9A,0x96,0x8E,0x9B,0xA4,0xA4,0xA7,0xA2,0xA4,0xA5,0xA6,
+            0x9B,0xA2,0xA2,0xA3,0xA3,0xA2,0xA7,0xA1,0x9B,0xA3,0xA2,0xA4,0xA1,0x9C,0xA2,0xA1,
+            0x99,0xA3,0xA5,0x82,0x9F,0xA0,0xA1,0x9F,0x87,0x8E,0xA1,0x94,0x9D,0x9D,0x9E,0xA0,
+            0x96,0x9D,0x90,0x86,0x98,0x98,0x95,0x92,0x91,0x8F,0x8B,0x89,0x86,0x80,0x7A,0x78,
+            0x70,0x6F,0x8A,0x8E,0x8E,0x93,0x97,0x9A,0x97,0x9A,0x9C,0x9E,0x9E,0x9F,0xA1,0x91,
+            0x9E,0xA0,0xA2,0xA2,0xA2,0xA2,0xA4,0xA3,0xA1,0x9B,0xA4,0xA2,0xA5,0xA3,0xA3,0xA3,
+            0x9F,0xA6,0xA6,0xA8,0xA6,0xA6,0xA6,0xA7,0xA2,0xA7,0xA6,0xA8,0xA7,0xA5,0xA8,0xA4,
+            0xA2,0xA2,0xA7,0xA8,0xA4,0xA6,0xA7,0xA8,0xA2,0xA6,0xA6,0xA4,0x9C,0xA7,0xA7,0xA2,
+            0xA0,0x8C,0xA8,0xA7,0x9C,0xA0,0xA5,0xA9,0x82,0x89,0xA5,0xA7,0x98,0x9F,0xA0,0xA6,
+            0xA2,0xA5,0xA3,0xA4,0xA4,0xA4,0xA5,0xA9,0xA1,0xA4,0xA4,0xA3,0xA6,0xA8,0xA5,0xA7,
+            0xA3,0xA6,0xA1,0xA6,0xA8,0xAB,0x91,0xA8,0xA4,0xA7,0xA7,0xA9,0xA9,0xA6,0xAB,0xA6,
+            0xA3,0xA3,0xA4,0xA7,0xA7,0xA8,0xA8,0xA6,0xA6,0x94,0xA7,0xA6,0xA7,0xA6,0xA9,0xA7,
+            0x9F,0xA5,0xA8,0x9A,0xA7,0xA4,0xA7,0xA9,0xA4,0x9E,0xA8,0x9D,0xA2,0xA0,0xA9,0xA5,
+            0x99,0xA4,0xA6,0xA6,0xA7,0xA2,0xA8,0xA6,0xA1,0x8C,0xA8,0xA9,0xA4,0xA4,0xA8,0xAA,
+            0xA2,0xA8,0xA9,0xA6,0xA7,0xA9,0xA7,0xA8,0xA3,0xA4,0xA8,0xAA,0xA4,0xA5,0xA8,0xA9,
+            0x9E,0xA9,0xAA,0xA6,0xAA,0xA9,0xA5,0xA7,0xA0,0xA5,0xA5,0xA8,0xA6,0xA5,0xA1,0xA3,
+            0x9E,0x9B,0xA5,0xA4,0xA2,0xA3,0xA4,0xA0,0xA0,0xA1,0xA4,0xA7,0xA6,0xA3,0xA5,0xA3,
+            0xA3,0xA4,0xA5,0xA4,0xA3,0xA6,0xA2,0xA6,0xA2,0xA4,0xA5,0xA1,0xA1,0xA3,0xA6,0xA2,
+            0x9F,0xA4,0xA2,0xA1,0xA0,0xA1,0xA1,0xA2,0x98,0x98,0xA1,0x99,0x9E,0x9F,0xA0,0xA0,
+            0x9C,0x9F,0x9D,0x9B,0x9C,0x9A,0x9A,0x87,0x97,0x96,0x92,0x92,0x8F,0x87,0x81,0x73,
+            0x76,0x7E,0x89,0x8F,0x91,0x94,0x96,0x99,0x93,0x9A,0x9E,0x9E,0x9E,0x9E,0xA0,0x8F,
+            0x9F,0xA1,0xA3,0xA0,0xA3,0xA6,0xA4,0xA4,0xA2,0xA1,0xA1,0xA3,0xA5,0xA6,0xA1,0xA1,
+            0xA0,0xA4,0xA6,0xA8,0xA6,0xA7,0xA8,0xA9,0xA2,0xA8,0xA9,0xA7,0x9A,0xA7,0xA6,0xA4,
+            0xA4,0x9F,0xA6,0xA6,0xA2,0xA6,0xA9,0xA6,0xA6,0xA7,0xA8,0x84,0xA5,0xA8,0xA6,0xA6,
+            0xA2,0x9C,0xA8,0xA8,0x9F,0xA4,0xA9,0xA7,0x8B,0x9A,0xA7,0xA9,0x97,0xA3,0xA2,0xA7,
+            0xA6,0xA7,0xA5,0xA6,0xA2,0xA7,0xA6,0xA7,0xA3,0xA6,0xA7,0xA4,0xA6,0xA7,0xA4,0xA8,
+            0xA1,0xA7,0xA7,0xA8,0xA8,0xA9,0x8F,0xAB,0xA4,0xAA,0xA9,0xA8,0xA6,0xA9,0xA8,0xA7,
+            0xA3,0xA9,0xA9,0xA9,0xA6,0xAA,0xA8,0xA6,0xA3,0xA9,0xA8,0xA2,0xA7,0xA8,0xA4,0xA7,
+            0x9C,0xAA,0xA7,0xA1,0xA6,0xA2,0xA9,0xA8,0xA3,0x9F,0xA9,0x9E,0xA6,0xA4,0xA7,0xA6,
+            0x9D,0xA7,0xA1,0xA6,0xA4,0xA7,0xA9,0xA8,0x99,0xA3,0xA7,0xA6,0xA2,0xA4,0xA6,0xA7,
+            0xA0,0xA7,0xA8,0xA8,0xA4,0xA9,0xA8,0xA7,0xA6,0xA4,0xA8,0xA9,0xA3,0xA9,0xA7,0xA8,
+            0x9E,0xA7,0xA6,0xA6,0xA9,0xA7,0xA5,0xA9,0xA0,0xA8,0xA6,0xA8,0xA6,0xA7,0xA4,0xA4,
+            0x8A,0x91,0x93,0xA4,0xA5,0xA4,0x9E,0x8E,0xA4,0xA5,0xA9,0xA6,0xA4,0xA6,0xA5,0xA7,
+            0xA4,0xA7,0xA6,0xA6,0xA6,0xA6,0xA6,0xA7,0x9F,0xA7,0xA5,0xA5,0xA5,0xA5,0xA3,0xA5,
+            0x9C,0xA6,0xA3,0xA3,0xA3,0xA4,0xA4,0xA3,0x98,0x9A,0xA2,0x9A,0xA2,0xA0,0xA1,0xA1,
+            0x9B,0x9E,0x9D,0x9C,0x9B,0x9D,0x9B,0x99,0x98,0x97,0x94,0x92,0x8F,0x88,0x82,0x79,
+            0x77,0x7E,0x87,0x8C,0x92,0x95,0x97,0x99,0x96,0x9B,0x9E,0x9D,0x9C,0x9F,0x9F,0x8B,
+            0x9E,0xA1,0xA3,0xA4,0xA2,0xA4,0xA4,0xA3,0x9C,0xA5,0xA6,0xA3,0xA4,0xA6,0xA5,0xA5,
+            0x9D,0xA5,0xA5,0xA8,0xA3,0xA7,0xA5,0xA7,0x9F,0xA9,0xA7,0xA8,0xA2,0xA3,0xA7,0xA6,
+            0xA1,0xA0,0xA8,0xA7,0xA3,0xA8,0xA7,0xA8,0xA0,0xA7,0xA8,0x9D,0xA8,0xA8,0xA8,0xAA,
+            0x9D,0x9A,0xA7,0xA9,0x9B,0xA2,0xA5,0xA6,0x89,0x97,0xA7,0xA3,0x96,0xA0,0xA5,0xA5,
+            0xA1,0xA6,0xA6,0xA6,0xA8,0xA8,0xA9,0xA6,0x9E,0xA9,0xAB,0xA3,0xA5,0xA6,0xA4,0xA8,
+            0xA2,0xA7,0xA4,0xA8,0xA6,0xA4,0x93,0xA9,0x9E,0xA9,0xA7,0xAA,0xA6,0xA6,0xA9,0xA7,
+            0x9F,0xA9,0xA7,0xA7,0xA9,0xAB,0xA9,0x9E,0xA0,0xAA,0xAB,0xA8,0xA8,0xA9,0xA9,0xA7,
+            0x99,0xA8,0xA6,0x9F,0xA4,0xA2,0xA7,0xA9,0x9A,0x9F,0xA7,0x9E,0xA7,0xA2,0xA9,0xA4,
+            0x98,0xA6,0x98,0xA6,0xA4,0xA5,0xA8,0xA8,0x97,0xA3,0xA9,0xA7,0xA7,0xA8,0xA8,0xA7,
+            0x95,0xA7,0xA8,0xAA,0xA6,0xA9,0xA6,0xA7,0x9F,0xA9,0xA3,0xA9,0xA4,0xAA,0xAA,0xAB,
+            0x99,0xA9,0xA4,0xAB,0xA8,0xA7,0xA5,0xA7,0x9F,0xA8,0xA6,0xA3,0xA4,0xA7,0xA2,0xA1,
+            0x8C,0x90,0x91,0xA0,0x96,0xA2,0x9E,0x8D,0x9D,0xA7,0xA8,0xA8,0xA6,0xA5,0xA9,0xA8,
+            0x9F,0xA4,0xA6,0xA6,0xA5,0xA6,0xA5,0xA2,0x9F,0xA4,0xA3,0xA3,0xA6,0xA5,0xA4,0xA1,
+            0x9B,0xA4,0xA4,0xA6,0xA2,0xA1,0xA3,0xA1,0x96,0x9A,0xA1,0x9A,0xA1,0x9E,0xA0,0xA0,
+            0x99,0xA0,0x9D,0x9B,0x9B,0x9A,0x98,0x96,0x96,0x94,0x92,0x90,0x8E,0x88,0x80,0x7B,
+            0x6E,0x79,0x86,0x8B,0x8C,0x8E,0x94,0x94,0x96,0x9A,0x9C,0x98,0x9A,0x9A,0x9D,0x8A,
+            0x9B,0x9E,0x9F,0x9F,0xA0,0xA4,0xA1,0xA2,0xA2,0xA0,0xA0,0xA0,0xA3,0xA4,0xA0,0xA1,
+            0xA2,0xA6,0xA6,0xA5,0x59,0xA9,0xA7,0xA3,0xA3,0xA8,0xA7,0xA2,0xA7,0xA5,0xA7,0xA4,
+            0x93,0x9F,0xA3,0xA8,0xA3,0xA5,0xAB,0x9B,0xA5,0xA3,0xA9,0x98,0xA6,0xA6,0xA8,0xA8,
+            0xA5,0x93,0xA8,0xA4,0x92,0xA0,0xA8,0xAA,0x8A,0x97,0xA8,0xA3,0x95,0xA1,0xA8,0xA0,
+            0xA5,0xA7,0xA7,0xA5,0xA9,0xA6,0xA6,0xA9,0xA6,0xA8,0xA8,0xA3,0xA6,0x89,0xA7,0xAA,
+            0xA8,0xA7,0xA3,0xA6,0xA6,0xA7,0x90,0xA6,0xAC,0xA8,0xA0,0xAA,0xAA,0xA7,0xAB,0xA8,
+            0xA8,0xA7,0xA3,0x9A,0xA2,0xA7,0xA6,0xA1,0xA9,0xA9,0xA9,0xAA,0xA7,0xAA,0xAC,0xA6,
+            0xA2,0xA7,0xA4,0x9D,0xA0,0xA1,0x9F,0xA4,0xA9,0x9E,0xAA,0x99,0xA6,0xA6,0xA7,0xA4,
+            0x9E,0xA7,0xA8,0xA7,0xA6,0x92,0xA7,0xA7,0xA7,0xA2,0xA8,0xA8,0xA5,0xA5,0xA8,0xA6,
+            0xA8,0xA9,0xA7,0xA7,0xA6,0xA9,0xAA,0xA9,0xA8,0xA7,0xA7,0xA9,0xA6,0xAC,0xA7,0xA7,
+            0xA3,0xA7,0xA5,0xA8,0xA6,0xA5,0xA5,0xA6,0xA3,0xA6,0xA2,0xA8,0xA7,0xA8,0xA2,0xA4,
+            0x8F,0x97,0x96,0xA0,0x99,0x9E,0x81,0x99,0xA5,0xA4,0xA7,0xA7,0xA2,0xA4,0xA4,0xA6,
+            0xA6,0xA9,0xA6,0xA6,0xA5,0xA0,0xA6,0xA3,0xA2,0xA6,0xA7,0xA5,0xA4,0xA7,0xA6,0xA3,
+            0xA3,0xA4,0xA3,0xA3,0xA4,0xA0,0xA4,0xA0,0x95,0x98,0xA3,0x9B,0xA2,0x9F,0xA1,0xA0,
+            0x9E,0x9F,0x9C,0x96,0x9D,0x98,0x9A,0x97,0x97,0x96,0x92,0x92,0x8E,0x87,0x82,0x76,
+            0x71,0x7A,0x89,0x8F,0x8F,0x94,0x97,0x98,0x89,0x9B,0x9F,0x9E,0x9A,0x9F,0xA1,0x8F,
+            0x8B,0xA3,0xA0,0xA1,0x9F,0xA3,0xA2,0xA1,0x89,0xA5,0xA5,0xA1,0x9D,0xA6,0xA6,0xA4,
+            0x89,0xA7,0xA9,0xA7,0xA0,0xAA,0xA8,0xA6,0x8B,0xA6,0xA8,0xA7,0x9A,0xA7,0xA8,0xAA,
+            0x87,0xA2,0xA7,0xA8,0xA4,0xA6,0xA8,0xA8,0x8A,0xA7,0xA9,0x9B,0xA1,0xAA,0xAA,0xA9,
+            0x89,0x99,0xAB,0xA7,0x9C,0xA4,0xA9,0xAB,0x84,0x9A,0xA6,0xA7,0x99,0xA3,0xA7,0xA8,
+            0x8A,0xA6,0xA7,0xA5,0xA0,0xAA,0xA8,0xA7,0x89,0xA9,0xAA,0xA6,0xA2,0xA2,0xA8,0xA7,
+            0x8A,0xA7,0xA4,0xA7,0xA1,0xA8,0x93,0xAB,0x8C,0xA8,0xA4,0xAD,0xA5,0xA4,0xA7,0xA8,
+            0x88,0xA9,0xA7,0xA9,0xA5,0xA7,0xA6,0xA8,0x8A,0xAA,0xAA,0xA9,0xA4,0xAA,0xAB,0xA8,
+            0x8C,0xA8,0xAA,0x9D,0xA2,0xA1,0xAA,0xA6,0x8C,0xA3,0xA4,0x9B,0xA4,0xA2,0xA9,0xA4,
+            0x89,0xAA,0xA8,0xA1,0xA4,0xA4,0xA8,0xA8,0x8A,0xA4,0xA8,0xA8,0xA3,0xA8,0xA9,0xA8,
+            0x8E,0xA9,0xA9,0xAA,0x9D,0xA8,0xA6,0xA9,0x8D,0xA7,0xAA,0xAA,0xA3,0xA8,0xA9,0xAA,
+            0x8C,0xAA,0xA4,0xA5,0xA3,0xA9,0xA8,0xA8,0x8D,0xA8,0xA5,0xA8,0x9E,0xA7,0xA5,0xA6,
+            0x88,0x97,0x9C,0xA1,0xA1,0xA1,0x9F,0x9E,0x88,0xA8,0xA7,0xA7,0xA3,0xA7,0xA6,0xA6,
+            0x87,0xA9,0xA8,0xA7,0xA0,0xA7,0xA5,0xA5,0x8E,0xA4,0xA3,0xA4,0xA1,0xA4,0xA5,0xA4,
+            0x8C,0xA4,0xA4,0xA4,0xA1,0xA3,0xA5,0xA4,0x8D,0x9A,0xA3,0x99,0x9E,0xA1,0xA0,0x9F,
+            0x8C,0x9D,0x9E,0x9C,0x99,0x9A,0x9B,0x9B,0x8C,0x94,0x94,0x92,0x8C,0x87,0x81,0x77,
+            0x77,0x7F,0x8A,0x8F,0x91,0x96,0x97,0x9A,0x97,0x9A,0x9E,0x9F,0x9E,0x9F,0xA0,0x8D,
+            0x94,0xA2,0xA0,0xA2,0xA0,0xA5,0xA3,0xA4,0x9F,0xA5,0xA3,0xA3,0xA2,0xA6,0xA5,0xA6,
+            0xA0,0xA4,0xA5,0xA5,0xA5,0xA6,0xA1,0xA8,0xA0,0xA5,0xA6,0xA9,0x9F,0xAA,0xA6,0xAA,
+            0x9F,0x9E,0xA8,0xA8,0xA4,0xA8,0xAA,0xA8,0xA0,0xA7,0xA8,0x9F,0xA5,0xA8,0xA9,0xA8,
+            0x92,0x96,0xA8,0xA6,0x9B,0xA2,0xA8,0xAB,0x85,0x9A,0xA7,0xA6,0x97,0xA1,0xA8,0xA7,
+            0x92,0xA7,0xA7,0xA5,0xA9,0xA8,0xA7,0xAC,0x9C,0xA9,0xA7,0xA2,0xA3,0x9C,0xA9,0xA6,
+            0x97,0xA7,0xA7,0xA6,0xAA,0xA9,0x90,0xA9,0x9C,0xA1,0xA9,0xAA,0xAA,0xA6,0xA8,0xA8,
+            0x9A,0xA9,0xA9,0xA6,0xAA,0xA5,0xAA,0xAA,0x9B,0xA9,0xA8,0xAC,0xA8,0xA9,0xAB,0xA9,
+            0x98,0xA7,0xA8,0xA0,0xA5,0xA4,0xA7,0xA9,0x9C,0x9B,0xA9,0x9C,0xA6,0xA5,0xAA,0xA7,
+            0x91,0xA5,0xA8,0xA3,0xAA,0xA5,0xAA,0xA9,0x92,0xA3,0xA9,0xA7,0xA5,0xA6,0xA8,0xA7,
+            0x98,0xA9,0xA7,0xA8,0xA4,0xA8,0xAA,0xA9,0x9E,0xA7,0xAA,0xA8,0xA3,0xA8,0xA7,0xA9,
+            0x9A,0x9F,0xA8,0xA7,0xA8,0xA8,0xA3,0xA9,0x9B,0xA5,0xA3,0xA7,0xA4,0xA6,0xA5,0xA6,
+            0x8C,0x98,0x98,0x9E,0xA3,0xA1,0x9B,0x9A,0x9B,0xA8,0xA8,0xA8,0xA4,0xA6,0xA7,0xA8,
+            0x93,0xA6,0xA6,0xA5,0xA6,0xA3,0xA8,0xA4,0x9D,0xA5,0xA4,0xA7,0xA3,0xA5,0xA4,0xA2,
+            0x9C,0xA4,0xA4,0xA3,0xA2,0xA2,0xA5,0xA3,0x95,0x98,0xA1,0x9B,0xA0,0x9F,0x9F,0xA2,
+            0x97,0xA0,0x9D,0x9B,0x9D,0x9D,0x99,0x9A,0x95,0x96,0x95,0x91,0x8F,0x87,0x81,0x76,
+            0x75,0x81,0x8A,0x8D,0x90,0x95,0x96,0x98,0x92,0x8F,0x9D,0x9F,0x9E,0xA0,0x9F,0x8D,
+            0x97,0xA0,0xA3,0xA1,0xA3,0xA4,0xA4,0xA4,0x9C,0xA5,0xA2,0xA1,0xA4,0xA6,0xA4,0xA6,
+            0x98,0xA4,0xA7,0xA7,0xA3,0xA2,0xA8,0xA7,0x9C,0x9E,0xA7,0xA6,0x9C,0xA4,0xA8,0xA8,
+            0x98,0x9E,0xA7,0xA9,0xA6,0xA9,0xA9,0xA8,0x98,0xA7,0xAB,0x9D,0xA0,0xA7,0xA7,0xA8,
+            0x97,0x9B,0xA6,0xA8,0x9A,0xA0,0xA4,0xA9,0x88,0x9A,0xA5,0xA7,0x95,0xA2,0xA6,0xA8,
+            0x9A,0xA8,0xAA,0xA6,0xA9,0xA8,0xAA,0xA8,0x95,0xA2,0xAA,0xA5,0xA4,0x9F,0xA8,0xAB,
+            0x9D,0xAA,0xA9,0xA7,0xA5,0xA9,0x92,0xA8,0xA0,0xAB,0xA8,0xAA,0xA7,0xA7,0xA8,0xAB,
+            0x9D,0xA9,0xA8,0xA8,0xA6,0xA9,0xA7,0x9F,0x9D,0xAA,0xA8,0xA9,0xA7,0xA7,0xA9,0xA8,
+            0x8F,0xA9,0xAB,0x96,0xA2,0xA3,0x92,0xA7,0x94,0x9E,0xA9,0x9F,0xA5,0x8F,0xA7,0xA9,
+            0x92,0xA6,0xA8,0xA6,0xA7,0xA6,0xA9,0xA9,0x98,0xA4,0xAA,0xAA,0xA5,0xA9,0xA7,0xA9,
+            0x97,0xA8,0xA9,0xAB,0xA2,0xA8,0xAA,0xA9,0x97,0xA7,0xA9,0xA7,0xA5,0xA9,0xAA,0xAA,
+            0x98,0xA9,0xA7,0xA8,0xA7,0xA8,0xA2,0xA5,0x9C,0xA8,0xA3,0xA9,0xA6,0xAA,0xA5,0xA3,
+            0x84,0x8E,0x8D,0x9E,0x9E,0x9E,0x99,0x9C,0x9B,0xA6,0xA8,0xA8,0xA3,0xA9,0xA6,0xA4,
+            0x9A,0xA6,0xA6,0xA6,0xA7,0xA6,0xA4,0xA7,0x9A,0xA8,0xA7,0xA8,0xA3,0xA6,0xA5,0xA2,
+            0x98,0xA5,0xA6,0xA2,0xA1,0xA3,0xA1,0xA2,0x95,0x99,0xA0,0x98,0xA0,0xA2,0xA1,0x9F,
+            0x95,0x9F,0x9D,0x9C,0x9C,0x9C,0x9A,0x9A,0x93,0x94,0x93,0x90,0x8E,0x87,0x81,0x77,
+            0x57,0x6A,0x73,0x7C,0x7F,0x82,0x87,0x8D,0x8A,0x8F,0x93,0x92,0x89,0x96,0x95,0x78,
+            0x92,0x9C,0x95,0x9B,0x9B,0x9F,0x8C,0x9C,0x94,0x96,0x9E,0x9E,0x9E,0xA2,0xA1,0xA0,
+            0x94,0xA3,0xA3,0x9C,0x9F,0xA0,0xA2,0xA0,0x9D,0x9D,0x93,0xA4,0xA3,0xA0,0xA4,0x99,
+            0x9B,0x93,0xA2,0xA7,0x9B,0xA5,0xA6,0xA7,0x9D,0xA3,0xA3,0x9A,0xA0,0xA3,0xA4,0xA5,
+            0x97,0x87,0xA2,0xA0,0x88,0x93,0x9F,0xA4,0x73,0x86,0xA4,0xA2,0x7F,0x93,0xA1,0xA4,
+            0x9B,0xA4,0xA4,0xA0,0xA5,0xA3,0x9C,0xA8,0x9C,0xA3,0xA6,0x9D,0xA4,0x9F,0xA4,0xA6,
+            0x9A,0xA4,0xA2,0xA6,0xA0,0xA8,0x7E,0xA5,0x9C,0xA6,0xA2,0xA7,0xA5,0xA4,0xA4,0xA0,
+            0x9F,0xA6,0xA2,0x97,0x94,0x9E,0xA2,0xA2,0x9F,0xA8,0xA6,0xA9,0xA7,0xA7,0xA7,0xA5,
+            0x91,0xA3,0xA4,0x96,0x9F,0xA0,0x9C,0xA5,0x96,0x92,0xA0,0x94,0xA4,0xA2,0xA4,0xA7,
+            0x91,0xA5,0xA4,0xA4,0xA5,0xA0,0xA7,0xA9,0x8C,0xA4,0xA6,0xA9,0xA0,0xA6,0xA7,0xA6,
+            0x89,0xA4,0xA4,0xA5,0xA2,0xA6,0xA6,0xA4,0x99,0xA3,0xA4,0xA6,0xA5,0xA7,0xA6,0xA6,
+            0x9A,0xA8,0xA4,0xA5,0xA4,0xA6,0xA2,0xA3,0x9A,0x9E,0x9A,0xA6,0xA2,0xA5,0x98,0x9F,
+            0x98,0xA1,0xA5,0xA4,0x8B,0x90,0x9F,0x98,0x9C,0xA4,0xA6,0xA5,0x99,0xA4,0xA3,0xA6,
+            0x9C,0xA6,0xA5,0xA3,0xA2,0xA1,0xA5,0xA5,0x9C,0xA2,0xA1,0xA2,0xA1,0xA0,0xA0,0xA0,
+            0x9B,0xA0,0xA2,0x8C,0x9E,0xA0,0x9D,0x9E,0x83,0x8E,0xA0,0x95,0x9D,0x9D,0x9D,0x9D,
+            0x94,0x9A,0x91,0x8A,0x97,0x95,0x94,0x8E,0x8C,0x8C,0x86,0x83,0x84,0x7D,0x77,0x72,
+            0x78,0x81,0x8A,0x8E,0x90,0x94,0x98,0x98,0x99,0x9C,0x9B,0x9C,0x9C,0x9F,0xA0,0x90,
+            0x9D,0xA0,0xA2,0xA1,0x9F,0xA3,0xA1,0x9E,0xA2,0xA0,0xA5,0xA3,0xA3,0xA4,0xA5,0xA3,
+            0xA2,0xA5,0xA5,0xA3,0xA3,0xA5,0xA5,0xA7,0xA4,0xA9,0xA7,0xA6,0xA6,0xA4,0xA5,0xA6,
+            0xA2,0xA0,0xA6,0xA5,0xA7,0xA5,0xA6,0xA8,0xA8,0xA6,0xA8,0xA0,0xA4,0xA6,0xA8,0xA8,
+            0xA1,0x9B,0xA9,0xA8,0x9F,0x82,0xA8,0xA7,0x8D,0x96,0xA3,0xA8,0x99,0x8A,0xA5,0xA7,
+            0xA3,0xA7,0xA7,0xA6,0xA5,0x7A,0xA7,0xA6,0xA0,0xA5,0xA5,0xA3,0xA5,0x79,0xA8,0xA9,
+            0xA2,0xA1,0xA2,0xA6,0xA5,0x74,0x93,0xA6,0x9E,0xA6,0xA5,0xA8,0xA7,0x76,0xA6,0xA6,
+            0xA1,0xA7,0xA4,0xA1,0xA4,0x72,0xA5,0xA5,0x9B,0x97,0x87,0x98,0x99,0x6F,0x77,0xA4,
+            0x9D,0xA6,0xA8,0xA1,0xA7,0xA6,0xA5,0xA8,0xA5,0xA1,0xA8,0x9E,0xA6,0xA4,0xA7,0xA7,
+            0x99,0xA7,0xA5,0xA4,0xA9,0xA8,0xA7,0xA8,0xA3,0xA3,0xA9,0xA6,0xA5,0xA5,0xA6,0xA8,
+            0xA3,0xA5,0xA7,0xA5,0xA5,0xA6,0xA7,0xA8,0xA4,0xA6,0xA5,0xAA,0xA8,0xA7,0xA8,0xA7,
+            0xA3,0xA7,0xA8,0xA8,0xA7,0xA8,0xA1,0xA6,0x9F,0xA7,0xA2,0xA5,0xA6,0xA4,0xA4,0xA5,
+            0x9F,0xA7,0xA5,0xA3,0xA4,0x9D,0xA5,0xA2,0xA5,0xA5,0xA5,0xA8,0xA6,0xA1,0xA5,0xA3,
+            0xA2,0xA5,0xA7,0xA7,0xA5,0x9E,0xA6,0xA6,0xA2,0xA5,0xA4,0xA5,0xA3,0x9E,0xA7,0xA1,
+            0x9F,0xA5,0xA4,0xA2,0xA0,0x9D,0xA5,0xA2,0x98,0x9A,0xA1,0x90,0xA2,0x95,0xA0,0x9F,
+            0x9A,0x9E,0x9D,0x9B,0x9C,0x98,0x99,0x98,0x98,0x95,0x93,0x91,0x8E,0x84,0x82,0x73,
+            0x74,0x82,0x89,0x8D,0x90,0x94,0x97,0x99,0x97,0x9D,0x9E,0x9F,0x9D,0x9F,0xA0,0x86,
+            0x9D,0xA1,0xA1,0xA1,0xA1,0xA2,0xA4,0xA2,0xA3,0xA5,0xA5,0xA6,0xA4,0xA1,0xA3,0xA1,
+            0x9E,0xA7,0xA7,0xA8,0xA4,0xA4,0xA8,0xA5,0xA3,0xA7,0xA7,0xA7,0xA5,0xA5,0xA5,0xA4,
+            0xA3,0xA2,0xA7,0xA7,0xA5,0xA6,0xA8,0xA7,0xA5,0xA6,0xA6,0xA6,0xA7,0xA4,0xA8,0xA6,
+            0xA5,0x98,0xAB,0xA4,0xA1,0x8C,0xA9,0xA7,0x8B,0x9A,0x9F,0xA6,0x98,0x95,0xA6,0xA7,
+            0xA4,0xA7,0xA7,0xA7,0xA4,0x95,0xAB,0xA9,0xA4,0xA5,0xAA,0xA3,0xA4,0x98,0xA9,0xA7,
+            0xA6,0xA8,0xA6,0xA7,0xA6,0x9F,0x8E,0xAA,0xA4,0xAA,0xA9,0xA7,0xA6,0x96,0xA4,0xA7,
+            0xA6,0xA4,0xAC,0xA8,0xA2,0x9C,0xA6,0xA7,0xA7,0xA0,0xAA,0xA8,0xA8,0x7B,0xA8,0xA5,
+            0x9D,0xA6,0xA8,0xA1,0xA4,0xA2,0xA5,0xA9,0xA6,0x9F,0xAA,0x97,0xA7,0xA2,0xA9,0xA5,
+            0x9E,0xA6,0xA7,0xA5,0xA8,0xA6,0xA8,0xA9,0xA3,0xA6,0xA8,0xA8,0xA7,0xA6,0xA7,0xA7,
+            0xA2,0xA8,0xA6,0xA5,0xA8,0xA8,0xA7,0xA8,0xA3,0xA5,0xA8,0xA9,0xA8,0x9F,0xA7,0xA8,
+            0xA5,0xA8,0xA7,0xA9,0xA6,0xA5,0xA5,0xAA,0xA0,0xA6,0xA6,0xA7,0xA9,0xA4,0xA3,0xA5,
+            0xA4,0xA6,0xA7,0xA6,0xA2,0xA3,0xA3,0xA5,0xA8,0xA7,0xA8,0xA5,0xA7,0x9C,0xA5,0xA6,
+            0xA6,0xA7,0xA6,0xA7,0xA3,0xA4,0xA7,0xA4,0xA5,0xA7,0xA5,0xA5,0xA5,0x98,0xA3,0xA5,
+            0x9D,0xA5,0xA4,0xA4,0xA5,0xA3,0xA2,0xA3,0x98,0x9A,0xA1,0x9A,0xA2,0x9E,0xA0,0x9F,
+            0x9A,0x9E,0x9E,0x9C,0x9D,0x9C,0x9A,0x99,0x97,0x96,0x93,0x92,0x8F,0x87,0x82,0x77,
+            0x73,0x80,0x88,0x8D,0x8F,0x93,0x97,0x9A,0x8F,0x9B,0x9C,0x9E,0x9B,0xA0,0x9F,0x82,
+            0x96,0xA0,0xA2,0xA2,0x9D,0xA2,0xA6,0xA0,0x97,0xA1,0xA1,0xA4,0x9E,0xA5,0xA5,0xA4,
+            0x95,0xA6,0xA6,0xA8,0x9E,0xA5,0xA7,0xA2,0x96,0xA7,0xA8,0xA6,0xA3,0xAA,0xA5,0xA7,
+            0x98,0xA1,0xA5,0xA9,0xA0,0xA6,0xA8,0xA8,0x98,0xA7,0xA8,0xA4,0xA1,0xA7,0xA8,0xA9,
+            0x97,0x99,0xA9,0xA9,0xA0,0xA0,0xA7,0xA9,0x87,0x98,0xA6,0xA7,0x99,0x9C,0xA8,0xA8,
+            0x98,0xA6,0xA7,0xA6,0xA5,0x98,0xAB,0xA9,0x9A,0xA9,0xA9,0xA5,0xA2,0x9F,0xAA,0xA7,
+            0x97,0xA4,0xA8,0xA6,0xA4,0x98,0x94,0xA8,0x98,0xA9,0xA8,0xAA,0xA3,0xA1,0xA7,0xA6,
+            0x97,0xA2,0xAA,0xA4,0xA3,0x9B,0xA4,0xA9,0x8E,0xA0,0xA8,0xAA,0xA4,0x8A,0xA8,0xA6,
+            0x90,0xA7,0xAA,0xA3,0xA2,0xA7,0xA7,0xA9,0x93,0xA0,0xA8,0x96,0xA3,0xA3,0xAA,0xA6,
+            0x8F,0xA7,0xA7,0xA7,0xA1,0xA7,0xAA,0xA9,0x8F,0xA5,0xAB,0xAA,0xA1,0xA8,0xA6,0xA8,
+            0x94,0xA7,0x96,0x95,0x9E,0xA8,0xA8,0xA6,0x92,0xA7,0xA9,0xAB,0xA5,0xA8,0xA9,0xAA,
+            0x91,0xA7,0xA8,0xA7,0xA2,0xA9,0xA4,0xA9,0x94,0xA8,0xA4,0xA7,0xA3,0xA5,0xA3,0xA6,
+            0x92,0x83,0x83,0x9E,0x9E,0x9B,0x92,0x94,0x8A,0xA2,0x8B,0xA1,0xA3,0xA0,0x94,0x9B,
+            0x8C,0x8E,0x9D,0xA1,0xA1,0x9E,0x92,0x9C,0x8B,0xA0,0x9F,0xA6,0xA0,0x9A,0x9F,0xA1,
+            0x92,0xA0,0xA0,0xA0,0xA1,0x9C,0x9C,0xA0,0x8B,0x96,0x98,0x99,0x9A,0x9D,0x9B,0x9D,
+            0x8B,0x97,0x96,0x9B,0x9A,0x97,0x99,0x90,0x88,0x92,0x91,0x90,0x8D,0x86,0x81,0x77,
+            0x71,0x7E,0x86,0x89,0x8C,0x8C,0x95,0x96,0x95,0x9B,0x9D,0x9B,0x97,0x9A,0x9E,0x8A,
+            0x9E,0x9F,0xA1,0x9F,0xA2,0xA3,0xA0,0x9C,0xA2,0xA0,0xA2,0xA4,0xA3,0xA5,0xA4,0xA2,
+            0xA5,0xA4,0xA7,0xA6,0x60,0xA5,0xA7,0x9E,0xA6,0xA6,0xA7,0xA4,0xA3,0xA7,0xA4,0xA5,
+            0xA2,0x9E,0xA3,0xA7,0x98,0xAA,0xA9,0x9B,0xA8,0xA6,0xA5,0xA4,0xA4,0xA3,0xA7,0xA9,
+            0xA6,0x95,0xA9,0xA8,0x9A,0x9C,0xA4,0xA8,0x87,0x99,0xA9,0xA4,0x97,0xA0,0xA9,0xA3,
+            0xA1,0xA8,0xA6,0xA7,0xA7,0xA2,0x9B,0xA9,0xA7,0xAA,0xA8,0xA5,0xA7,0xA5,0xA7,0xAA,
+            0xA5,0xAA,0xA7,0x87,0xA8,0xA9,0x91,0xAA,0xA6,0xAA,0xA3,0xA7,0xA8,0xA7,0xA5,0xA8,
+            0xA4,0xA7,0xA7,0xA3,0xA5,0xA7,0x9F,0xA4,0xAB,0xAA,0xA9,0xA9,0xAA,0xAA,0xA8,0xA7,
+            0xA3,0xA4,0xA5,0x9F,0xA3,0xA1,0xA1,0x95,0xA8,0x9B,0xA9,0x9A,0xAB,0xA5,0xA8,0xA6,
+            0xA1,0xA8,0xA7,0xA6,0xA8,0xA6,0xA5,0xA7,0xA9,0xA4,0xAE,0xA7,0xA5,0xA8,0xAA,0xAA,
+            0xA6,0xA7,0xAB,0xA4,0xA4,0xA8,0xA9,0xA7,0xA8,0xA7,0xA6,0xA6,0xA6,0xA8,0xA8,0xA7,
+            0xA9,0xA6,0xA8,0xA8,0xA9,0xA9,0xA5,0xA8,0xA3,0xA7,0xA5,0xA3,0xAA,0xA3,0xA2,0xA5,
+            0x9B,0xA2,0xA1,0x9F,0xA0,0x9F,0x92,0xA3,0xA2,0xA4,0xA6,0xA5,0xA4,0xA5,0xA4,0xA7,
+            0xA3,0xA7,0xA3,0xA6,0xA5,0xA3,0xAA,0xA3,0xA3,0xA4,0xA5,0xA1,0xA4,0x9F,0xA5,0xA4,
+            0xA3,0xA6,0xA3,0xA3,0xA2,0xA3,0xA4,0xA2,0x98,0x97,0xA3,0x98,0xA1,0x9E,0xA1,0x9E,
+            0x9D,0x9F,0x9D,0x97,0x9C,0x9B,0x99,0x96,0x95,0x94,0x91,0x8D,0x8E,0x86,0x80,0x72,
+            0x74,0x82,0x88,0x8D,0x90,0x93,0x98,0x9A,0x8F,0x9A,0x9F,0x9F,0x9F,0x9F,0x9F,0x8D,
+            0x90,0xA0,0xA0,0xA2,0x9E,0xA4,0xA4,0x9E,0x96,0xA5,0xA4,0xA5,0xA2,0xA7,0xA5,0xA4,
+            0x8F,0xA5,0xA6,0xA7,0xA2,0xA5,0xA6,0xA3,0x96,0xA9,0xA5,0xA7,0xA5,0xA9,0xA6,0xA6,
+            0x93,0x9C,0xA7,0xA9,0xA1,0xA7,0xAA,0xA9,0x95,0xA9,0xA9,0xA7,0xA2,0xA9,0xA9,0xA8,
+            0x8E,0x96,0xA6,0xAA,0x9D,0xA1,0xA8,0x9C,0x81,0x96,0xA6,0xA6,0x93,0xA1,0xA8,0xA8,
+            0x91,0xA6,0xA9,0xA5,0xA4,0xA6,0xA7,0xAB,0x96,0xA9,0xA9,0xA1,0xA4,0xAA,0xAC,0xA8,
+            0x8F,0xA5,0xA6,0xA7,0xA3,0xA9,0x93,0xAA,0x95,0xAA,0xA7,0xA8,0xA4,0xA7,0xA7,0xAB,
+            0x8C,0xA8,0xA8,0xA3,0xA4,0xAA,0xAA,0xA5,0x96,0xA7,0xA9,0xA9,0xA4,0xAA,0xA9,0xA7,
+            0x8D,0xA6,0xA6,0x9E,0xA6,0xA8,0xA7,0xA9,0x98,0x9F,0xA4,0x99,0xA6,0xA6,0xA9,0xA7,
+            0x8E,0xA7,0xA7,0xA7,0xA6,0xA4,0xA9,0xA8,0x96,0xA4,0xAA,0x97,0x9E,0xA4,0xA9,0xAA,
+            0x93,0xA5,0xA7,0xA6,0xA2,0xA6,0xAC,0xAB,0x93,0xA9,0xA8,0xAB,0xA6,0xAA,0xA8,0xA8,
+            0x90,0xA7,0xA9,0xA8,0xA6,0xA6,0xA6,0xA8,0x96,0xA4,0xA6,0xA4,0xA3,0xA7,0xA4,0xA5,
+            0x93,0xA7,0xA6,0xA2,0xA4,0xA5,0xA4,0xA0,0x99,0xA6,0xA7,0xA5,0xA6,0xA7,0xA4,0xA5,
+            0x93,0xAA,0xA8,0xA7,0xA4,0xA3,0xA7,0xA5,0x97,0xA6,0xA5,0xA2,0xA2,0xA3,0xA4,0xA3,
+            0x92,0xA6,0xA2,0xA4,0x9F,0xA3,0xA6,0xA1,0x91,0x8F,0xA4,0x97,0x95,0x9F,0xA1,0xA0,
+            0x92,0x9D,0x9E,0x9B,0x9B,0x99,0x99,0x99,0x91,0x95,0x92,0x91,0x8D,0x87,0x81,0x76,
+            0x76,0x7A,0x89,0x8F,0x91,0x91,0x97,0x98,0x99,0x9C,0x9E,0x9E,0x9D,0xA1,0xA0,0x8B,
+            0x9C,0xA1,0xA3,0xA6,0xA0,0xA4,0xA1,0xA5,0x9F,0xA0,0xA2,0xA6,0x9F,0xA4,0xA4,0xA5,
+            0x9D,0xA3,0xA6,0xA7,0xA2,0xA5,0xA4,0xA8,0xA4,0xA6,0xA8,0xA7,0xA6,0xA9,0xA5,0xA6,
+            0x9E,0x9F,0xA8,0xA9,0xA5,0xA9,0xA7,0xA7,0xA4,0xA8,0xA9,0xA9,0xA7,0xA8,0xA7,0xA8,
+            0xA1,0x9B,0xA6,0xA7,0xA3,0xA1,0xA7,0xA9,0x8A,0x97,0xA9,0xA6,0x99,0xA1,0xA7,0xA6,
+            0xA6,0xA9,0xA8,0xA5,0xA7,0xA9,0xAB,0xA7,0xA5,0xA9,0xA9,0xA3,0xA5,0xA9,0xA8,0xAB,
+            0xA5,0xA5,0xA6,0xA8,0xA5,0xA9,0x8E,0xA9,0xA6,0xAA,0xAB,0xAD,0xA8,0xA8,0xA8,0xAA,
+            0x9F,0xA9,0xA9,0xA5,0xAB,0xA6,0xA7,0xA9,0xA3,0xAC,0xAA,0xAA,0xA6,0xAB,0xA7,0xA8,
+            0x9A,0xA6,0xA8,0xA1,0xA7,0xA5,0xA9,0xA7,0x9D,0xA1,0xA8,0x9E,0xA4,0xA7,0xA9,0xA7,
+            0x96,0xA6,0xA9,0xAA,0xA7,0xA1,0xA6,0xA9,0x9B,0xA7,0xA7,0xA7,0xA7,0xA9,0xA7,0xA8,
+            0x9E,0xA8,0xA8,0xA6,0xA5,0xA8,0xA6,0xA8,0x9E,0xA6,0xA9,0xA6,0xAB,0xA7,0xAA,0xAB,
+            0x9A,0xA8,0xAA,0xAA,0xA8,0xAA,0xA8,0xA9,0x9A,0xA9,0xA5,0xA7,0xA8,0xA9,0xA7,0xA8,
+            0x9F,0xA7,0xA8,0xA2,0xA2,0xA4,0xA6,0xA5,0x9C,0xA8,0xA5,0xA3,0xA6,0xA7,0xA2,0xA8,
+            0xA1,0xA6,0xA6,0xA6,0xA4,0xA6,0xA7,0xA5,0xA0,0xA8,0xA0,0xA8,0xA4,0xA6,0xA5,0xA2,
+            0x9E,0xA6,0xA5,0xA0,0xA0,0xA4,0xA4,0xA2,0x92,0x96,0xA2,0x99,0x9A,0xA0,0xA2,0xA0,
+            0x98,0x9B,0x9E,0x9B,0x9C,0x9B,0x9B,0x99,0x93,0x94,0x92,0x91,0x8E,0x87,0x82,0x7A,
+            0x71,0x82,0x89,0x8B,0x91,0x95,0x96,0x99,0x96,0x9C,0x9F,0x9D,0x9D,0xA0,0x9A,0x8B,
+            0x95,0xA1,0xA1,0xA0,0x9F,0xA4,0xA4,0xA2,0x9C,0xA4,0xA4,0xA4,0xA2,0xA5,0xA6,0xA4,
+            0x97,0xA4,0xA8,0xA5,0xA5,0xA7,0xA2,0xA9,0x9F,0xA9,0xA6,0xA5,0xA4,0xA6,0xA5,0xA6,
+            0x9D,0xA0,0xA9,0xA9,0xA3,0x9F,0xA8,0xA7,0x97,0xA7,0xA9,0xAB,0xA6,0xAA,0xA8,0xA9,
+            0x9C,0x97,0xA5,0xA5,0x9F,0xA0,0xA8,0xA8,0x88,0x99,0xA6,0xA5,0x94,0xA2,0xA9,0xAA,
+            0x99,0xA9,0xA7,0xA6,0xA5,0xA6,0xA8,0xA9,0x9C,0xA6,0xA7,0xA2,0xA5,0xA7,0xA9,0xA8,
+            0x97,0xA6,0xA6,0xA6,0xA5,0xA8,0x94,0xA7,0x9B,0xAB,0xA8,0xAC,0xA7,0xA7,0xA8,0xA8,
+            0xA0,0xA9,0xA9,0xA7,0xA4,0xA8,0xA7,0xA7,0x9C,0xAA,0xAA,0xA7,0xA2,0xA9,0xA9,0xA8,
+            0x92,0xA2,0xAB,0xA1,0xA3,0xA3,0xAA,0xA8,0x97,0xA1,0xAA,0x9F,0xA6,0xA5,0xA6,0xA7,
+            0x93,0xA4,0xAB,0xA8,0xA6,0xA5,0xA8,0xA7,0x96,0xA6,0xA7,0xA7,0xA5,0xA7,0xA8,0xAA,
+            0x94,0xA8,0xA9,0xA5,0x9C,0xA8,0xA7,0xA9,0x99,0xA8,0xAA,0xA9,0xA5,0xA7,0xA6,0xAA,
+            0x98,0xA9,0xAA,0xA6,0xA6,0xA8,0xA6,0xA8,0x99,0xA6,0xA6,0xA5,0xA5,0xA7,0xA6,0xA8,
+            0x98,0xA7,0xA4,0xA2,0xA4,0xA2,0xA3,0xA5,0x9B,0xA6,0xA7,0xA7,0xA3,0xA6,0xA6,0xA8,
+            0x9B,0xA6,0xA7,0xA7,0xA6,0xA6,0xA7,0xA6,0x9C,0xA6,0xA5,0xA5,0xA2,0xA5,0xA4,0xA6,
+            0x95,0xA3,0xA1,0xA2,0xA4,0xA4,0xA4,0xA1,0x94,0x96,0xA1,0x95,0x94,0x9C,0x9F,0xA1,
+            0x96,0x9D,0x9D,0x9C,0x9C,0x9B,0x9A,0x99,0x92,0x95,0x94,0x91,0x8E,0x87,0x82,0x7A,
+            0x5B,0x67,0x6F,0x7A,0x78,0x86,0x8A,0x7A,0x81,0x8C,0x93,0x94,0x8E,0x96,0x95,0x80,
+            0x84,0x96,0x97,0x9C,0x98,0x9F,0x9A,0x9D,0x95,0x90,0xA1,0x9C,0x9D,0x9F,0xA0,0x9E,
+            0x85,0x9F,0xA2,0xA4,0x88,0xA2,0xA4,0xA4,0x99,0xA0,0x91,0xA0,0xA0,0x9F,0xA4,0xA6,
+            0x96,0x90,0xA1,0xA2,0x9E,0xA5,0xA6,0xA6,0x9C,0xA2,0xA1,0xA5,0x9B,0xA4,0xA8,0xA4,
+            0x85,0x8A,0xA0,0x9D,0x8E,0x97,0xA4,0xA7,0x76,0x89,0x9E,0x9D,0x81,0x93,0xA2,0xA1,
+            0x9B,0xA7,0xA5,0xA5,0xA1,0xA6,0xA4,0xA3,0x9C,0xA4,0xA6,0xA3,0x9F,0xA5,0xA9,0xA3,
+            0x90,0xA5,0xA0,0x81,0x9D,0xA4,0x87,0xA8,0x9D,0xA7,0xA6,0xA6,0xA4,0xA6,0xA9,0xA6,
+            0x9C,0xA4,0xA7,0xA3,0x9C,0x9A,0x93,0xA6,0x9E,0xA8,0xA7,0xA4,0xA2,0xA9,0xA4,0xA1,
+            0x8A,0xA4,0xA4,0x99,0xA0,0x9B,0xA5,0xA8,0x96,0x94,0xA4,0x95,0xA1,0xA0,0xA8,0xA6,
+            0x8E,0xA5,0xA7,0xA8,0xA6,0xA4,0xA5,0xA5,0x86,0xA5,0xA4,0xA6,0xA4,0xA8,0xA8,0xA8,
+            0x95,0xA6,0xA6,0xA0,0xA1,0xA7,0xA8,0xA5,0x98,0xA7,0xA7,0xA8,0xA4,0xA9,0xA7,0xA7,
+            0x98,0xA8,0xA9,0xA9,0xA3,0xA7,0xA4,0xA3,0x98,0xA3,0x9D,0xA5,0x9F,0xA6,0x9D,0x9F,
+            0x96,0xA0,0xA6,0xA3,0x99,0x95,0x9B,0x98,0x9A,0xA4,0xA5,0x9F,0x99,0xA5,0xA4,0xA6,
+            0x93,0xA7,0xA7,0x9F,0xA6,0xA4,0xA5,0xA6,0x9C,0xA4,0xA2,0xA6,0xA3,0xA1,0xA4,0x9D,
+            0x94,0xA1,0x9F,0x89,0xA2,0xA2,0x9F,0xA2,0x85,0x8C,0x9F,0x97,0x9E,0xA2,0xA0,0x9E,
+            0x97,0x9D,0x95,0x8F,0x99,0x95,0x97,0x8E,0x8F,0x8E,0x8C,0x87,0x86,0x7E,0x78,0x78,
+            0x6F,0x82,0x89,0x7A,0x8F,0x95,0x96,0x99,0x98,0x9A,0x9C,0x9E,0x9B,0x9F,0x9F,0x8D,
+            0x9A,0x9F,0xA0,0xA2,0xA0,0xA1,0xA2,0xA2,0x9F,0xA4,0xA0,0xA2,0xA5,0xA2,0xA3,0xA3,
+            0x9E,0xA6,0xA4,0xA6,0x94,0xA6,0xA6,0xA5,0xA5,0xA8,0xA4,0xA5,0xA5,0xA2,0xA7,0xA6,
+            0x9F,0x9E,0xA8,0xA8,0xA5,0xA0,0xA7,0xA6,0xA4,0xA5,0xA8,0xA6,0x9D,0xA7,0xA7,0xA7,
+            0x9D,0x98,0xA6,0x93,0x9C,0xA0,0xA8,0xAA,0x8A,0x98,0xA6,0xA5,0x96,0xA1,0xA5,0xA6,
+            0xA1,0xA6,0xA6,0xA4,0xA3,0xA3,0xA5,0xA8,0xA1,0xA8,0xA5,0xA0,0xA6,0xA6,0xA5,0xA7,
+            0xA1,0xA7,0xA5,0xA6,0xA5,0xA6,0x91,0xA5,0xA4,0xA9,0xA6,0xA9,0x9F,0xA2,0xA8,0xA8,
+            0xA4,0xA8,0xA7,0xA6,0xA6,0xA6,0xA6,0xA5,0xA4,0xA7,0xA7,0xA7,0xA9,0xA8,0xA8,0xA6,
+            0x95,0xA2,0xA8,0x9D,0xA5,0xA3,0xA7,0xA7,0xA2,0x9F,0xA8,0x9D,0xA2,0xA5,0xA9,0xA6,
+            0x99,0xA4,0xA7,0xA6,0xAA,0xA6,0xA8,0xA7,0xA1,0xA4,0xA7,0xA7,0xA7,0xA8,0xA6,0xA4,
+            0x9B,0xA7,0xA8,0xA4,0xA4,0xA9,0xA8,0xA7,0xA3,0xA6,0xA6,0xAA,0xA9,0xA7,0xA8,0xA6,
+            0xA2,0xA4,0xA8,0xA9,0xA6,0xA5,0xA5,0xA8,0xA0,0xA4,0xA3,0xA2,0x9F,0xA5,0xA3,0xA4,
+            0x99,0xA4,0xA4,0xA2,0xA5,0xA0,0xA3,0xA3,0xA2,0xA4,0xA6,0xA5,0xA6,0xA5,0xA2,0xA3,
+            0xA0,0xA5,0xA5,0xA5,0xA4,0xA5,0xA6,0xA3,0xA2,0xA4,0xA4,0xA4,0xA4,0xA0,0xA6,0xA0,
+            0x9E,0xA2,0xA0,0xA2,0xA3,0xA5,0xA3,0xA1,0x97,0x97,0x9F,0x9A,0xA1,0xA0,0xA0,0x9E,
+            0x9A,0x9E,0x9D,0x9B,0x9C,0x9B,0x98,0x98,0x96,0x91,0x92,0x90,0x8E,0x86,0x81,0x75,
+            0x76,0x82,0x86,0x8D,0x91,0x95,0x97,0x99,0x99,0x9B,0x96,0x9F,0x9C,0xA0,0xA0,0x8B,
+            0xA1,0xA2,0xA4,0xA4,0xA4,0xA3,0xA4,0xA2,0xA1,0xA6,0xA4,0xA5,0xA5,0xA1,0xA3,0xA4,
+            0x9F,0xA5,0xA5,0xA5,0xA5,0xA6,0xA5,0xA7,0xA4,0xA6,0x98,0xA4,0xA6,0xA3,0xA5,0xA4,
+            0xA4,0x9F,0xA8,0xA7,0xA4,0xAA,0xAA,0xA7,0xA5,0xA3,0xA8,0xA9,0xA4,0xA4,0xA6,0xA0,
+            0xA0,0x8F,0xA8,0x9B,0x9A,0x99,0xA8,0xA9,0x79,0x8F,0xA6,0xA6,0x8B,0x99,0xA5,0xA7,
+            0xA0,0xA7,0xA3,0x9F,0xA5,0xA1,0xA9,0xA9,0xA3,0xA5,0xA8,0xA2,0xA5,0xA4,0xA6,0xA7,
+            0xA2,0xA6,0xA6,0xA7,0xA6,0xA7,0x88,0xA7,0xA4,0xAA,0xAB,0xA9,0xA7,0xA7,0xA8,0xA7,
+            0xA6,0xAF,0xAC,0xA4,0xA6,0xA7,0xA9,0xA7,0xA4,0xA9,0xA8,0xAA,0xA5,0xA9,0xA6,0xA7,
+            0x9E,0xA3,0xA9,0x9B,0xA4,0x9D,0xA6,0xA7,0xA4,0x9C,0xA8,0x9C,0xA7,0xA2,0xA7,0xA6,
+            0x96,0xA0,0xA6,0xA9,0xA7,0xA5,0xA5,0xA8,0x9D,0xA5,0xA6,0xA6,0xA5,0xA8,0xA4,0xA7,
+            0x9E,0xA5,0xA8,0xA5,0xA6,0xA8,0xAA,0xAB,0xA4,0xA6,0x62,0xA9,0xA7,0xA7,0xA9,0xA5,
+            0x96,0xA7,0xA6,0xA4,0xA6,0xA5,0xA4,0xA8,0xA0,0xA4,0xA3,0xA6,0xA0,0xA6,0xA3,0xA4,
+            0xA1,0xA6,0xA8,0xA5,0x9B,0x9A,0xA1,0xA2,0xA6,0xA5,0xA9,0xA8,0xA4,0xA5,0xA5,0xA9,
+            0xA0,0xA6,0xA7,0xA5,0xA5,0xA6,0xA6,0xA6,0x9F,0xA4,0xA4,0xA7,0xA3,0xA1,0xA5,0xA3,
+            0xA0,0xA4,0xA2,0xA1,0xA2,0xA3,0xA5,0xA1,0x96,0x97,0xA3,0x99,0xA1,0xA0,0xA2,0xA1,
+            0x9D,0x9E,0x9D,0x99,0x9C,0x9C,0x9A,0x99,0x96,0x95,0x92,0x91,0x8F,0x87,0x81,0x77,
+            0x74,0x83,0x8A,0x83,0x8F,0x94,0x97,0x99,0x8B,0x9C,0x9F,0x9F,0x9A,0xA0,0xA0,0x88,
+            0x93,0xA3,0xA3,0xA4,0x9F,0xA3,0xA4,0xA3,0x96,0xA5,0xA3,0xA4,0xA1,0xA5,0xA6,0xA4,
+            0x93,0xA7,0xA7,0xA6,0x9D,0xA7,0xA7,0xA8,0x96,0xA7,0xA5,0xA6,0xA2,0xA3,0xA8,0xA6,
+            0x94,0x97,0xA7,0xA8,0x9D,0xAA,0xA9,0xA7,0x97,0xA6,0xA7,0xA8,0xA2,0xA6,0xA7,0xA9,
+            0x94,0x8D,0xA4,0xA5,0x92,0x9D,0xA8,0xA6,0x7B,0x8F,0xA6,0xA4,0x8C,0x9B,0xA8,0xA9,
+            0x98,0xA6,0xA6,0xA5,0xA3,0xA6,0xA9,0xA7,0x98,0xA3,0xA6,0xA1,0xA1,0xA9,0xA9,0xAA,
+            0x96,0xA1,0xA6,0xA8,0xA6,0xA7,0x8E,0xA9,0x97,0xAC,0xA5,0xA9,0x9E,0xA5,0xA6,0xA8,
+            0x94,0xAA,0xA9,0xA5,0xA1,0xA7,0xA8,0xA3,0x8B,0xAA,0xA7,0xA7,0x9F,0xAB,0xAA,0xA9,
+            0x8D,0xA6,0xA4,0x9D,0x9D,0x9D,0xA6,0xA8,0x8F,0x99,0xA9,0x8E,0xA0,0xA1,0xA8,0xA4,
+            0x8A,0xA6,0xA4,0xAA,0x9A,0xA7,0xA7,0xAA,0x8C,0xA4,0xA7,0xA7,0x9E,0xA6,0xA8,0xA8,
+            0x93,0xA6,0x94,0x95,0x9E,0xA7,0xA8,0xA9,0x91,0xA6,0x76,0xA7,0xA4,0xA7,0xA9,0xA8,
+            0x91,0xA9,0xA1,0xA8,0xA4,0xA7,0xA6,0xAC,0x91,0x95,0xA5,0xA6,0x9F,0xA4,0xA0,0xA1,
+            0x93,0xA0,0xA1,0x9F,0xA0,0x9F,0x98,0x8E,0x8E,0xA7,0x9C,0xA6,0xA2,0xA7,0x9F,0xA7,
+            0x91,0x9E,0xA3,0xA5,0x9E,0xA6,0xA5,0x9F,0x94,0xA1,0xA1,0xA3,0xA0,0xA5,0xA4,0xA3,
+            0x94,0xA2,0xA2,0x9F,0xA1,0xA2,0xA4,0xA0,0x90,0x92,0x9E,0x98,0x9E,0xA2,0xA2,0x9F,
+            0x92,0x9B,0x97,0x98,0x9A,0x9B,0x97,0x98,0x8E,0x93,0x91,0x91,0x8C,0x86,0x82,0x78,
+            0x70,0x7E,0x86,0x88,0x8B,0x90,0x95,0x95,0x97,0x99,0x9B,0x9A,0x9A,0x9A,0x9D,0x8A,
+            0x9C,0xA0,0x9A,0xA2,0xA1,0x9F,0xA0,0xA0,0xA1,0xA2,0xA2,0xA4,0xA1,0xA3,0xA4,0xA1,
+            0xA2,0xA6,0xA7,0xA5,0x59,0xA7,0xA7,0xA8,0xA3,0xA4,0xA2,0xA1,0xA1,0x9E,0xA2,0xA3,
+            0x9A,0x98,0xA5,0xA4,0x8A,0xA4,0xA7,0xA7,0xA5,0xA7,0xA7,0xA5,0xA4,0xA6,0xA9,0xA7,
+            0xA3,0x92,0xA3,0xA6,0x97,0x99,0xA8,0xA8,0x87,0x97,0xA5,0xA9,0x95,0x9C,0xA7,0xA1,
+            0xA5,0xA5,0xA4,0xA6,0xAA,0xA9,0xA6,0xA6,0xA9,0xAB,0xA7,0xA4,0xA5,0xA6,0xA9,0xAA,
+            0xA5,0xA6,0xA2,0xA8,0x9E,0xA9,0x90,0xA6,0xA9,0xAA,0xA4,0xA8,0xA7,0xA6,0xA9,0xA4,
+            0xA7,0xAA,0xA5,0xA3,0xA5,0xA7,0x94,0xA5,0xA4,0xAC,0xAA,0xA9,0xAB,0xAA,0xA7,0xA7,
+            0x9F,0xA8,0xA3,0x9E,0xA3,0xA3,0x9F,0xA2,0xA7,0x98,0xA6,0x9E,0xA2,0x9F,0xA6,0xA3,
+            0x9D,0xA8,0xA7,0xA9,0xA1,0xA4,0xA8,0xA7,0xA6,0xA7,0xA8,0xA8,0xA8,0xA8,0xAB,0xA3,
+            0xA9,0xA6,0xAA,0xA4,0xA4,0xA7,0xA8,0xA8,0xA7,0xA7,0xA8,0xA6,0xA7,0xA6,0xA6,0xA7,
+            0xA0,0xA9,0xA4,0xA6,0xA6,0xA9,0xA7,0xA3,0xA1,0xA8,0xA5,0xA7,0xA6,0xA6,0x9F,0xA5,
+            0xA4,0xA4,0xA6,0x9B,0x9D,0xA1,0x83,0x9D,0xA5,0xA6,0xA6,0xA6,0xA3,0xA6,0xA5,0xA8,
+            0xA1,0xA7,0xA4,0xA5,0xA7,0xA4,0xA7,0xA3,0xA3,0xA6,0xA3,0xA2,0xA4,0xA3,0xA4,0x9F,
+            0xA3,0xA3,0xA6,0x9D,0xA5,0xA3,0xA2,0xA2,0x93,0x98,0xA3,0x97,0xA1,0x97,0xA0,0xA0,
+            0x9D,0x9D,0x94,0x97,0x9C,0x9C,0x93,0x97,0x97,0x95,0x92,0x8F,0x8E,0x86,0x81,0x79,
+            0x70,0x83,0x8B,0x8F,0x8F,0x94,0x97,0x97,0x8F,0x9C,0x9D,0x9E,0x9E,0xA0,0x9F,0x8E,
+            0x91,0xA0,0xA3,0xA4,0xA2,0xA3,0xA4,0xA2,0x97,0xA4,0xA4,0xA4,0xA3,0xA6,0xA5,0xA3,
+            0x92,0xA6,0xA7,0xA9,0xA1,0xA7,0xA6,0xA6,0x97,0xA6,0xA6,0xA6,0xA3,0xA4,0xA7,0xA6,
+            0x92,0xA0,0xA8,0xAA,0xA3,0xA9,0xA9,0xAA,0x97,0xA8,0xA7,0xA8,0xA6,0xA9,0xA8,0xAA,
+            0x8E,0x9D,0xAA,0xA8,0x9F,0xA4,0xA6,0xA8,0x87,0x9B,0xA8,0xA8,0x94,0xA2,0xA8,0xA6,
+            0x93,0xA9,0xA6,0xA5,0xA6,0xA6,0xAB,0xA7,0x98,0xA9,0xAB,0xA3,0xA3,0xAA,0xA5,0xA9,
+            0x91,0xAA,0xA7,0xA5,0xA5,0xA9,0x92,0xA7,0x97,0xA8,0xA6,0xAB,0xA6,0xA5,0xA9,0xA9,
+            0x91,0xA8,0xA6,0xA1,0xA5,0xA7,0xA7,0xA5,0x96,0xA9,0xA7,0xAA,0xA8,0xAB,0xA8,0xA8,
+            0x8E,0xA6,0xA7,0x9F,0xA6,0xA5,0xA8,0xA8,0x93,0xA3,0xA7,0xA0,0xA2,0x9E,0xA9,0xA8,
+            0x8F,0xA7,0xA8,0xA9,0xA7,0xA6,0xAA,0xAA,0x95,0xA5,0xA7,0xAA,0xA7,0xAA,0xA8,0xA6,
+            0x91,0xA6,0xA7,0xA5,0xA2,0xA5,0xA9,0xA9,0x95,0xA7,0xA8,0xAA,0xA7,0xA9,0xA9,0xA9,
+            0x90,0xA9,0xA7,0xA9,0xA5,0xA7,0xA6,0xAA,0x96,0xA9,0xA4,0xA8,0xA2,0xA8,0xA2,0xA6,
+            0x92,0xA8,0xA6,0xA5,0xA4,0xA3,0xA5,0xA6,0x96,0xA7,0xA7,0xA5,0xA1,0xA6,0xA6,0xA8,
+            0x94,0xA8,0xA7,0xA6,0xA3,0xA7,0xA9,0xA5,0x97,0xA4,0xA5,0xA2,0xA5,0xA2,0x96,0xA3,
+            0x94,0xA5,0xA4,0xA1,0xA1,0xA4,0xA7,0xA4,0x92,0x98,0xA2,0x99,0x9E,0xA1,0x9B,0xA1,
+            0x93,0x9F,0x9D,0x9E,0x9A,0x9A,0x99,0x99,0x91,0x96,0x92,0x91,0x8D,0x87,0x81,0x79,
+            0x75,0x82,0x8A,0x8F,0x8A,0x95,0x96,0x99,0x8D,0x9A,0x9F,0x9F,0x91,0xA0,0xA0,0x8A,
+            0x95,0xA0,0x9F,0xA4,0x98,0xA4,0xA2,0xA2,0x95,0xA3,0xA4,0xA2,0x9A,0xA7,0xA6,0xA7,
+            0x93,0xA7,0xA7,0xA6,0xA4,0xA8,0xA5,0xA4,0x9F,0xA4,0xA8,0xA7,0xA7,0xA4,0xA7,0xA5,
+            0x9F,0x9E,0xA7,0xA6,0xA3,0xA8,0xAA,0xA9,0xA2,0xA5,0xA9,0xA6,0xA6,0xA9,0xA8,0xA8,
+            0x9C,0x98,0xA6,0xA6,0x9C,0xA1,0xAA,0xA8,0x84,0x9A,0xA6,0xA7,0x99,0x9F,0xA8,0xA8,
+            0xA2,0xA6,0xA5,0xA6,0xA3,0xA9,0xA9,0xA8,0xA0,0xA9,0xA8,0xA2,0xA0,0xA8,0xA6,0xA8,
+            0x97,0xAA,0xA3,0xA6,0xA4,0xA8,0x8F,0xA6,0xA0,0xAB,0xA8,0xA8,0xA8,0xA5,0xA8,0xA8,
+            0xA3,0xAB,0xA6,0xA6,0xAB,0xA8,0xAA,0xA7,0x9F,0xAA,0xAA,0xAA,0xA7,0xAA,0xAB,0xA9,
+            0x8B,0xA6,0xA7,0x9F,0xA5,0xA7,0xA9,0xAA,0x97,0xA2,0xAB,0x9A,0xA4,0xA4,0xA7,0xA8,
+            0x8D,0xA6,0xA7,0xA8,0xA8,0xA6,0xA8,0xA8,0x96,0xA5,0xA8,0xAA,0xA6,0xA9,0xA9,0xAB,
+            0x8B,0xA9,0xAA,0xA6,0xA4,0xA9,0xAA,0xA7,0x97,0xA7,0xAC,0xA9,0xA9,0xA9,0xA8,0xA9,
+            0x93,0xAA,0x84,0xA7,0xA7,0xA6,0xA8,0xAA,0x96,0xA4,0xA4,0xA4,0xA7,0xA8,0xA1,0xA8,
+            0x99,0xA7,0xA4,0xA5,0x96,0x96,0xA7,0xA3,0x99,0xA6,0xAB,0xA6,0xA5,0xA7,0xA6,0xA9,
+            0x9D,0xA6,0xA3,0xA6,0xA7,0xA7,0xA7,0xA4,0x9D,0xA6,0xA5,0xA7,0xA1,0xA6,0xA5,0xA1,
+            0x88,0xA3,0xA2,0xA1,0x8B,0xA4,0xA2,0xA4,0x88,0x98,0xA2,0x9A,0x8B,0xA1,0xA1,0xA1,
+            0x84,0x9D,0x9D,0x9B,0x85,0x9C,0x98,0x99,0x89,0x96,0x92,0x90,0x87,0x88,0x81,0x79,
+            0x73,0x80,0x88,0x8D,0x8D,0x94,0x93,0x97,0x94,0x9A,0x9B,0x9F,0x99,0xA0,0xA2,0x8B,
+            0x8E,0x9F,0xA2,0x9E,0x97,0xA1,0xA0,0x9B,0x9B,0xA4,0xA3,0xA1,0xA0,0xA6,0xA5,0xA7,
+            0x97,0xA5,0xA9,0xA6,0xA3,0xA7,0xA5,0xA3,0x9A,0xA7,0xA7,0xA5,0xA3,0xA2,0xA4,0xA1,
+            0x96,0x9E,0xA3,0xA6,0x9F,0xA8,0xA9,0xAA,0x95,0xA7,0xA8,0xA8,0xA3,0xA6,0xA9,0xA7,
+            0x98,0x93,0x9C,0x91,0x8D,0x94,0x9C,0x9B,0x88,0x96,0xA4,0x9B,0x92,0x9B,0xA2,0xA2,
+            0x92,0x9B,0xA3,0x91,0x9A,0xA2,0x9E,0x97,0x97,0xA4,0xA6,0xA3,0x9F,0xA5,0xA5,0xA5,
+            0x9C,0xAA,0xA4,0xAA,0xA2,0xA6,0x91,0xA5,0x9C,0xA7,0xA9,0xA7,0xA2,0xA3,0xA6,0xA3,
+            0x9C,0xA5,0xA3,0x9F,0x9B,0xA2,0x9D,0x9E,0x97,0xA6,0xA5,0xA1,0x9E,0xA6,0xA5,0xA3,
+            0x92,0xA3,0xA3,0x98,0x97,0xA0,0xA1,0xA0,0x91,0x9F,0xA9,0x9B,0x9E,0xA3,0xA4,0x9D,
+            0x91,0xA4,0xA5,0xA5,0x9C,0xA5,0xA4,0xA4,0x94,0xA5,0xAA,0xA9,0xA2,0xA5,0xA6,0xA9,
+            0x95,0xA5,0xA9,0xA4,0xA2,0xA8,0xA8,0xA7,0x96,0xA4,0xA8,0xA6,0xA2,0xA6,0xA8,0xA6,
+            0x98,0xA9,0xA7,0xA2,0xA4,0xA5,0xA5,0xA3,0x98,0xA8,0xA6,0xA6,0x9F,0xA5,0xA1,0xA8,
+            0x82,0x79,0x79,0x80,0x87,0x80,0x7D,0x7D,0x7E,0x89,0x81,0x8B,0x92,0x89,0x84,0x84,
+            0x7B,0x80,0x8A,0x86,0x8F,0x87,0x80,0x85,0x88,0x90,0x91,0x97,0x96,0x93,0x92,0x94,
+            0x8B,0x99,0x9A,0x99,0xA2,0x96,0x99,0x96,0x84,0x8D,0x93,0x91,0x97,0x98,0x92,0x92,
+            0x80,0x86,0x86,0x8C,0x91,0x8A,0x8B,0x87,0x83,0x86,0x88,0x89,0x8A,0x82,0x7F,0x79,
+            0x58,0x67,0x74,0x7B,0x7D,0x85,0x87,0x88,0x87,0x8A,0x8F,0x91,0x90,0x93,0x95,0x7D,
+            0x8C,0x95,0x95,0x9A,0x94,0x95,0x99,0x90,0x92,0x97,0x9D,0x9A,0x97,0x94,0x9B,0x9C,
+            0x88,0x9C,0x9E,0x9E,0x8F,0x9E,0xA2,0x9E,0x93,0x9F,0xA3,0xA1,0xA1,0xA0,0xA2,0xA4,
+            0x93,0x91,0xA5,0xA4,0x90,0xA5,0xA5,0xA6,0x95,0xA0,0x9D,0xA3,0x9A,0xA6,0xA4,0xA5,
+            0x90,0x85,0x9F,0xA2,0x84,0x94,0x9D,0xA1,0x71,0x85,0x9B,0x9E,0x7C,0x91,0xA3,0xA4,
+            0x95,0xA2,0x9A,0x9F,0x9C,0xA2,0xA7,0xA6,0x96,0xA5,0xA7,0xA3,0x9E,0xA3,0xA7,0xA8,
+            0x93,0xA8,0x8B,0xA4,0x9B,0xA6,0x7F,0xA7,0x90,0xA8,0xA5,0xA6,0x9F,0xA5,0xA7,0xA5,
+            0x92,0xA8,0xA0,0xA1,0x94,0x96,0x9A,0x9B,0x91,0xA5,0xA8,0xA7,0x9D,0xA8,0xA8,0xA4,
+            0x8D,0xA5,0xA5,0x94,0x9B,0x9C,0xA4,0xA1,0x8F,0x90,0xA1,0x91,0x9E,0xA1,0xA6,0xA3,
+            0x8C,0xA5,0xA6,0xA7,0x9E,0xA3,0xA6,0xA5,0x88,0xA3,0xA2,0xA6,0x9F,0xA4,0xA5,0xA7,
+            0x93,0xA5,0xA7,0xA1,0x9D,0xA5,0xA9,0xA4,0x94,0xA6,0xA7,0xA8,0x9F,0xA3,0xA7,0xA6,
+            0x85,0xA3,0xA5,0xA6,0x9D,0xA6,0xA2,0xA4,0x90,0x9F,0x9A,0xA5,0x9F,0xA7,0x9A,0x9D,
+            0x90,0xA1,0xA2,0x9C,0x8E,0x96,0x9A,0x9A,0x87,0xA5,0xA6,0xA5,0x9B,0xA2,0xA3,0xA5,
+            0x92,0xA6,0xA1,0xA3,0x9E,0xA4,0xA4,0xA4,0x95,0xA3,0xA4,0xA2,0x9D,0x9F,0x9F,0x9E,
+            0x92,0xA0,0xA2,0x9D,0x9A,0x9F,0x9A,0x9F,0x7F,0x8B,0x9E,0x93,0x9C,0x9E,0x9E,0x9D,
+            0x92,0x9A,0x91,0x8A,0x94,0x95,0x91,0x88,0x89,0x8B,0x89,0x84,0x81,0x7C,0x74,0x77,
+            0x75,0x7D,0x87,0x7D,0x8E,0x91,0x95,0x94,0x92,0x99,0x98,0x99,0x9B,0x98,0x97,0x85,
+            0x98,0x85,0x9F,0x8C,0x8B,0x9A,0x8F,0x8D,0x9F,0xA3,0xA1,0xA1,0xA1,0x99,0xA2,0xA4,
+            0x9B,0x98,0xA4,0xA5,0x9C,0x94,0xA4,0xA5,0xA0,0xA1,0xA6,0xA5,0xA6,0xA2,0xA3,0xA2,
+            0x9E,0x97,0xA3,0xA5,0xA4,0xA3,0xA5,0xA2,0xA2,0x9C,0xA6,0xA3,0xA1,0xA0,0x9E,0xA1,
+            0x96,0x86,0xA6,0xA8,0x8D,0x87,0xA8,0xA8,0x84,0x98,0xA4,0xA2,0x95,0x96,0xA8,0xA3,
+            0x9D,0xA4,0xA2,0xA5,0xA3,0x85,0xA8,0xA8,0x9D,0xA7,0xA7,0xA4,0xA1,0xA0,0xA9,0xA9,
+            0x9F,0xA8,0x94,0xA6,0xA3,0x84,0x6B,0x97,0xA1,0xA7,0xA8,0xA7,0xA4,0x84,0xA8,0xA5,
+            0x9C,0xA5,0xA6,0xA5,0xA4,0x83,0xA6,0xA1,0xA1,0x8B,0xA7,0xA7,0xA2,0x84,0xA6,0xA6,
+            0x96,0xA5,0xA6,0x9C,0xA6,0xA3,0xA5,0xA8,0x9E,0x98,0xAB,0x97,0xA2,0x9C,0xA5,0xA6,
+            0x96,0xA4,0xA4,0xA7,0xA9,0xA1,0xA7,0xA8,0xA1,0xA4,0xA7,0xA9,0xA5,0xA6,0xA5,0xA9,
+            0x9C,0xA4,0xA9,0xA4,0xA2,0xA6,0xA7,0xA5,0x9A,0xA5,0xA8,0xA7,0xA5,0xA6,0xA8,0xA8,
+            0x97,0xA5,0xA9,0xA8,0xA4,0xA6,0xA6,0xA8,0x9A,0xA3,0xA3,0xA6,0xA3,0xA8,0xA2,0xA5,
+            0x9D,0xA5,0xA7,0x9F,0x85,0x98,0xA3,0xA4,0x9E,0xA6,0xA8,0xA5,0xA4,0xA1,0xA4,0xA5,
+            0x9F,0xA7,0xA7,0xA6,0xA6,0xA4,0xA6,0xA6,0x9F,0xA5,0xA5,0xA3,0xA5,0x9D,0xA3,0xA6,
+            0x9D,0xA4,0xA3,0xA1,0xA3,0xA1,0xA4,0xA2,0x96,0x96,0xA4,0x99,0xA1,0x9E,0x9F,0xA1,
+            0x9A,0x9E,0x89,0x82,0x9A,0x9A,0x98,0x97,0x96,0x94,0x94,0x93,0x8E,0x87,0x82,0x79,
+            0x74,0x7F,0x89,0x8B,0x90,0x93,0x96,0x97,0x97,0x9A,0x9C,0x9D,0x97,0x9F,0xA0,0x8E,
+            0x99,0xA0,0xA2,0xA3,0x9C,0xA3,0xA2,0xA2,0x9E,0xA4,0xA2,0xA4,0xA5,0xA2,0xA3,0xA3,
+            0x94,0xA6,0xA6,0xA7,0xA2,0xA4,0xA8,0xA7,0x90,0xA5,0xA4,0xA3,0xA2,0xA0,0xA3,0xA3,
+            0x9C,0x9D,0xA5,0xA6,0xA7,0xA8,0xA6,0xA8,0xA1,0xA1,0xAA,0xA8,0xA7,0xA6,0xA6,0x9F,
+            0x9E,0x95,0x9E,0xA7,0x99,0xA0,0xA8,0xA5,0x83,0x97,0xA3,0x99,0x98,0x9E,0xA6,0xA4,
+            0xA0,0xA2,0xA4,0xA8,0xA6,0xA4,0xA8,0xA9,0xA1,0xA2,0xA9,0xA1,0xA5,0xA8,0xA7,0xA6,
+            0xA1,0xA9,0xA1,0xA5,0xA5,0xA7,0x8E,0xA1,0x9E,0xA7,0xA7,0xA9,0xA6,0xA4,0xA4,0xA4,
+            0xA1,0xA9,0xA8,0xA5,0xA4,0xA2,0xA7,0xA4,0xA0,0xA7,0xA8,0xA9,0xA6,0x96,0xA5,0xA5,
+            0x95,0xA6,0xA8,0x9B,0xA6,0xA4,0xA5,0xA8,0x9E,0x9E,0xA6,0x97,0xA5,0x98,0xA6,0xA4,
+            0x94,0xA5,0xA6,0xA7,0xA6,0xA2,0xA3,0xA9,0x99,0xA6,0xAB,0xA6,0xA4,0xA7,0xA7,0xA7,
+            0x96,0xA5,0xA9,0xA5,0xA3,0xA4,0xA7,0xA7,0x9D,0xA6,0xA7,0xA9,0xA4,0xA7,0xA8,0xA5,
+            0x94,0xA8,0xA7,0xA6,0xA6,0xA9,0xA5,0xAA,0x9C,0xA7,0xA7,0xA8,0xA5,0xA7,0xA2,0xA7,
+            0x9B,0xA6,0x83,0xA0,0x98,0xA3,0xA6,0xA5,0x90,0xA5,0xA7,0xA5,0xA4,0xA2,0xA4,0xA6,
+            0x96,0xA7,0xA6,0xA8,0x9D,0xA9,0xA7,0xA4,0x9F,0xA3,0xA3,0xA5,0xA3,0xA6,0xA4,0xA4,
+            0x9E,0xA3,0xA5,0xA1,0xA2,0xA3,0xA4,0xA3,0x98,0x97,0xA3,0x99,0xA2,0x9F,0x9F,0xA0,
+            0x9B,0x9D,0x9A,0x9B,0x9E,0x9A,0x99,0x99,0x92,0x95,0x93,0x8F,0x8E,0x85,0x82,0x76,
+            0x76,0x7B,0x88,0x8D,0x8E,0x94,0x96,0x97,0x8B,0x9B,0x9B,0x9D,0x9B,0x9F,0xA0,0x8D,
+            0x8C,0xA0,0xA3,0xA3,0x9E,0xA3,0xA5,0x9F,0x8E,0xA5,0xA3,0xA3,0x9C,0xA3,0xA4,0xA6,
+            0x8F,0xA7,0xA6,0xA9,0x99,0xA7,0xA7,0xA5,0x8F,0xA6,0xA7,0xA4,0xA2,0xA0,0xA4,0xA5,
+            0x90,0x9D,0xA8,0xA7,0x96,0xA8,0xAA,0xA9,0x90,0xA8,0xA2,0xA9,0x9F,0xA8,0xA8,0xA4,
+            0x8E,0x96,0xAA,0xA7,0x9C,0xA0,0xA8,0xAA,0x82,0x96,0xA4,0xA7,0x96,0x9F,0xA9,0xA8,
+            0x91,0xA8,0xA7,0xA6,0xA1,0xA7,0xA7,0xA9,0x90,0xA0,0xA8,0xA2,0xA1,0xA6,0xA8,0xA7,
+            0x90,0xA7,0xA1,0xA5,0xA1,0xA5,0x92,0xAB,0x91,0xAB,0xA5,0xA9,0xA1,0xA1,0xA7,0xA8,
+            0x8F,0xA7,0xA8,0xA7,0x9E,0xA7,0xA8,0xA3,0x8F,0xA9,0xA9,0xA9,0x9A,0xA2,0xAB,0xA9,
+            0x85,0xA6,0xA6,0x99,0x9C,0xA3,0xA7,0xA9,0x85,0x9F,0xA8,0x9B,0x99,0xA3,0xA5,0xA9,
+            0x88,0xA8,0xA7,0xAA,0x9D,0xA6,0xA3,0xA8,0x80,0xA5,0xA9,0xA9,0x9F,0xA9,0xA8,0xA9,
+            0x88,0xA9,0x9E,0x9D,0x9C,0xA7,0xA9,0xA7,0x87,0xA7,0xA8,0xAA,0x9F,0xA8,0xA8,0xA7,
+            0x8B,0xA6,0xA8,0xA5,0x9F,0xA9,0xA6,0xA9,0x8B,0xA9,0xA5,0xA9,0x9C,0xA6,0xA3,0xA7,
+            0x8D,0xA5,0xA6,0x9F,0x9D,0xA3,0xA3,0xA5,0x87,0xA7,0xA4,0xA3,0xA0,0xA4,0xA5,0xA4,
+            0x8B,0xA7,0xA4,0xA6,0xA1,0xA6,0xA5,0xA5,0x8F,0xA5,0xA4,0xA4,0x9F,0x9E,0xA4,0xA4,
+            0x8C,0xA3,0xA1,0xA2,0x9C,0xA2,0xA4,0xA4,0x8B,0x97,0xA4,0x9A,0x9A,0xA1,0x9F,0xA1,
+            0x8D,0x9D,0x9D,0x99,0x98,0x9C,0x98,0x97,0x89,0x95,0x92,0x90,0x8A,0x85,0x81,0x76,
+            0x71,0x7B,0x87,0x89,0x87,0x90,0x93,0x93,0x95,0x99,0x9A,0x98,0x96,0x99,0x9B,0x89,
+            0x98,0x99,0x9F,0x9D,0x9A,0x9E,0x9D,0xA0,0xA0,0xA4,0xA3,0xA5,0xA2,0x9C,0x9F,0xA3,
+            0x9D,0xA7,0xA6,0xA6,0x52,0xA1,0xA5,0xA4,0xA3,0xA6,0xA4,0xA1,0xA2,0xA1,0xA2,0xA2,
+            0x87,0x97,0x9E,0xA1,0xA0,0xA4,0x9F,0x9E,0xA5,0xA5,0xA9,0xA4,0xA4,0xA8,0xA4,0xA5,
+            0xA2,0x8A,0x95,0xA6,0x88,0x9B,0xA6,0xA9,0x86,0x93,0xA8,0xA7,0x94,0x9A,0xA8,0x9F,
+            0xA2,0xA4,0x93,0xA5,0xA6,0xA4,0xA5,0xA7,0xA9,0xA7,0xA9,0xA2,0xA6,0xA6,0xAB,0xAB,
+            0xA5,0xA8,0xA2,0xA4,0xA1,0xA5,0x91,0xA8,0xA9,0xAB,0xA4,0xAA,0xA7,0xA6,0xA5,0xA7,
+            0xA6,0xA6,0xA7,0xA3,0xA6,0xA7,0xA1,0xA5,0xAA,0xA8,0xA8,0xA6,0xA8,0xAC,0xAB,0xA6,
+            0xA0,0xA5,0xA2,0x98,0xA2,0x9E,0xA5,0x97,0xA3,0x9E,0xA8,0x96,0xA3,0x93,0xA4,0xA2,
+            0x9B,0xA7,0xA7,0xA4,0xA5,0xA4,0xA6,0xA6,0xA7,0xA6,0xA9,0xA8,0xA4,0xA6,0xA7,0xA7,
+            0xA8,0xA8,0xAA,0x9F,0xA2,0xA4,0xA8,0xA6,0xAA,0xA9,0xAA,0xA4,0xA8,0xA6,0xA9,0xA7,
+            0xA3,0xA7,0xA7,0xA2,0xA6,0xA7,0xA5,0xA3,0xA2,0xA6,0xA4,0xA6,0xA6,0xA4,0xA1,0xA5,
+            0x9F,0xA2,0xA4,0x9D,0x9A,0x99,0x94,0x9C,0xA0,0xA7,0xA5,0xA4,0xA1,0xA0,0xA4,0xA4,
+            0x9C,0xA8,0xA5,0xA3,0xA2,0xA1,0xA7,0xA3,0xA1,0xA5,0xA3,0xA6,0xA2,0x9B,0xA1,0xA2,
+            0xA1,0xA2,0xA4,0x9B,0x9F,0x9F,0xA2,0x9F,0x94,0x97,0xA3,0x97,0x9D,0x9F,0x9F,0x9D,
+            0x9B,0x9E,0x9D,0x95,0x9C,0x9A,0x97,0x95,0x95,0x95,0x92,0x8C,0x8C,0x85,0x7F,0x76,
+            0x70,0x79,0x88,0x77,0x8D,0x93,0x95,0x97,0x86,0x9A,0x9C,0x9F,0x99,0x9F,0xA0,0x8D,
+            0x85,0xA1,0xA1,0xA1,0x9D,0xA2,0xA3,0xA1,0x89,0xA3,0xA3,0xA5,0x9C,0xA6,0xA6,0xA5,
+            0x83,0xA6,0xA5,0xA7,0x9C,0xA4,0xA7,0xA4,0x88,0xA7,0xA8,0xA4,0x9B,0xA2,0xA6,0xA4,
+            0x82,0x9E,0xA7,0xA7,0x9E,0xA8,0xA7,0xA9,0x84,0xA9,0xA7,0xA8,0x9E,0xA9,0xA6,0xA3,
+            0x82,0x9B,0xA7,0xA9,0x98,0xA3,0xA8,0x9D,0x80,0x9A,0xA7,0xA5,0x98,0x9F,0xA6,0xA7,
+            0x82,0xA7,0xA8,0xA5,0xA0,0xA8,0xA9,0xA9,0x87,0xA6,0xA9,0xA6,0x9E,0xA8,0xAB,0xA7,
+            0x83,0xA6,0xA5,0xA6,0x9A,0xA5,0x95,0x9B,0x83,0xA8,0xA6,0xA7,0x99,0xA3,0xA7,0xA4,
+            0x81,0xA8,0xA4,0xA1,0xA1,0xA8,0xA7,0xA2,0x85,0xAB,0xA8,0xA9,0x9E,0xA9,0xA5,0xAA,
+            0x82,0xA7,0xA5,0x9B,0xA1,0xA8,0xAA,0xAA,0x88,0x9E,0xA8,0xA0,0x9D,0xA7,0xA9,0xA8,
+            0x85,0xA9,0xA8,0xAB,0x9E,0xA4,0xA7,0xA9,0x86,0xA3,0xA8,0xAB,0x9C,0xA9,0xA8,0xA9,
+            0x83,0xA4,0xA4,0xA2,0x9B,0xA8,0xA7,0xA7,0x88,0xA3,0xA7,0xA8,0x9C,0xA6,0xA6,0xAA,
+            0x82,0xA6,0xA7,0xA8,0xA0,0xA7,0xA5,0xA8,0x89,0xA7,0xA6,0xA9,0x9D,0xA6,0x9E,0xA4,
+            0x83,0xA6,0xA8,0xA6,0x9D,0xA3,0xA5,0xA7,0x88,0xA7,0xA6,0xAA,0x9F,0xA3,0xA5,0xA6,
+            0x83,0xA6,0xA6,0xA7,0x9E,0xA4,0xA5,0xA5,0x8B,0xA2,0xA4,0xA2,0x9D,0xA5,0xA6,0xA4,
+            0x86,0xA4,0xA5,0x9F,0x9D,0xA4,0xA5,0xA2,0x86,0x96,0xA3,0x9A,0x9C,0x9F,0x9F,0x9F,
+            0x84,0x9E,0x9E,0x9C,0x99,0x99,0x98,0x99,0x86,0x96,0x92,0x92,0x8A,0x87,0x80,0x76,
+            0x6F,0x79,0x7E,0x7D,0x71,0x82,0x7D,0x7E,0x84,0x91,0x88,0x8E,0x7A,0x94,0x8B,0x86,
+            0x80,0x88,0x8F,0x8B,0x79,0x94,0x8A,0x8D,0x93,0x99,0x9A,0xA0,0x87,0xA1,0x9B,0x9C,
+            0x94,0xA3,0xA2,0xA0,0x92,0xA1,0xA1,0xA1,0x90,0x9F,0x9D,0x98,0x89,0x9D,0x9C,0x9B,
+            0x8B,0x92,0x91,0x93,0x81,0x97,0x93,0x96,0x91,0x99,0x95,0x96,0x85,0xA3,0x96,0x9A,
+            0x73,0x7C,0x78,0x71,0x68,0x70,0x75,0x76,0x74,0x84,0x80,0x7F,0x71,0x7C,0x80,0x81,
+            0x74,0x84,0x84,0x7A,0x70,0x79,0x7E,0x80,0x8C,0x96,0x96,0x93,0x7E,0x8F,0x94,0x96,
+            0x91,0xA0,0x9D,0x97,0x8C,0x92,0x8C,0x9C,0x8A,0x98,0x96,0x91,0x84,0x8C,0x95,0x94,
+            0x7F,0x89,0x88,0x81,0x7A,0x82,0x8A,0x88,0x83,0x8D,0x88,0x86,0x7D,0x87,0x8B,0x8E,
+            0x7E,0x8D,0x8C,0x79,0x70,0x7A,0x87,0x7C,0x81,0x93,0x8E,0x84,0x7F,0x83,0x8D,0x86,
+            0x84,0x95,0x90,0x82,0x7B,0x82,0x8D,0x85,0x91,0x9F,0xA0,0x99,0x8D,0x97,0xA0,0x9C,
+            0x94,0xA4,0xA4,0x93,0x98,0x9B,0xA2,0x9C,0x92,0x9F,0xA1,0x92,0x90,0x9F,0xA2,0x99,
+            0x89,0x99,0x97,0x87,0x7F,0x89,0x94,0x8A,0x91,0x99,0x98,0x90,0x8B,0x91,0x95,0x95,
+            0x6A,0x85,0x84,0x8A,0x89,0x89,0x85,0x87,0x80,0x77,0x8A,0x8D,0x8E,0x89,0x8C,0x8F,
+            0x7F,0x7E,0x74,0x8F,0x8C,0x8C,0x8C,0x8D,0x8E,0x98,0x97,0x87,0x9D,0x9A,0x98,0x95,
+            0x8F,0x9B,0x9E,0x9D,0x89,0xA0,0x9D,0xA0,0x88,0x8F,0x95,0x93,0x97,0x82,0x96,0x97,
+            0x7E,0x8C,0x8B,0x8D,0x8E,0x8B,0x7B,0x8C,0x85,0x8B,0x8A,0x8B,0x8A,0x83,0x7D,0x72,
+            0x72,0x7B,0x83,0x80,0x79,0x80,0x7A,0x79,0x88,0x90,0x92,0x93,0x83,0x92,0x8F,0x88,
+            0x86,0x96,0x91,0x92,0x82,0x90,0x91,0x92,0x91,0xA2,0x9F,0xA0,0x8B,0xA2,0xA0,0x9F,
+            0x91,0xA6,0xA6,0xA4,0x92,0xA3,0xA5,0xA5,0x8C,0xA3,0xA3,0x95,0x8C,0x9E,0x9F,0xA2,
+            0x8C,0x98,0x99,0x98,0x86,0x9E,0x99,0x9D,0x8E,0x9C,0x9A,0x9A,0x8A,0x9F,0x9C,0x9D,
+            0x79,0x87,0x86,0x79,0x72,0x79,0x7C,0x80,0x78,0x89,0x8A,0x84,0x7B,0x88,0x84,0x8C,
+            0x82,0x8C,0x87,0x86,0x7D,0x86,0x85,0x89,0x8C,0x9E,0x9F,0x99,0x8D,0x96,0x92,0x99,
+            0x91,0xA3,0x83,0x9E,0x94,0x9D,0x8C,0xA2,0x81,0xA4,0x9F,0x97,0x8D,0x91,0x94,0x98,
+            0x83,0x94,0x92,0x8D,0x83,0x8D,0x8B,0x92,0x87,0x97,0x8C,0x8C,0x85,0x8C,0x89,0x93,
+            0x85,0x9A,0x8F,0x86,0x80,0x8A,0x91,0x8E,0x89,0x9B,0x98,0x8F,0x8A,0x95,0x9A,0x91,
+            0x8A,0x9A,0x9C,0x93,0x8B,0x94,0x91,0x92,0x8A,0x9B,0xA4,0xA1,0x97,0x9C,0xA6,0x9D,
+            0x8E,0xA3,0xA8,0xA2,0x97,0x9F,0xA6,0xA1,0x8F,0xA0,0xA9,0x9E,0x99,0xA1,0xA2,0xA2,
+            0x8A,0x9F,0x98,0x96,0x8E,0x9A,0xA0,0x9A,0x90,0xA1,0x9B,0xA1,0x92,0x9B,0x9D,0x96,
+            0x75,0x7E,0x91,0x91,0x92,0x8D,0x90,0x95,0x86,0x80,0x92,0x9A,0x9D,0x99,0x96,0x9A,
+            0x84,0x90,0x7F,0x9C,0x99,0x99,0x96,0x99,0x8F,0x97,0x9C,0x8C,0x9D,0x9E,0x9E,0x9A,
+            0x8B,0x9E,0x9E,0x9D,0x90,0xA2,0x9F,0xA0,0x8A,0x91,0x9C,0x94,0x9B,0x89,0x98,0x96,
+            0x87,0x8E,0x94,0x92,0x97,0x93,0x81,0x93,0x84,0x8E,0x8D,0x85,0x88,0x7B,0x7E,0x73,
+            0x58,0x59,0x64,0x6E,0x6F,0x77,0x7B,0x7E,0x74,0x82,0x83,0x87,0x80,0x79,0x89,0x79,
+            0x7B,0x86,0x8D,0x91,0x8C,0x90,0x8D,0x90,0x85,0x7A,0x94,0x93,0x91,0x96,0x91,0x91,
+            0x7B,0x91,0x95,0x97,0x90,0x95,0x96,0x95,0x85,0x94,0x90,0x93,0x91,0x90,0x95,0x94,
+            0x85,0x88,0x94,0x96,0x92,0x97,0x96,0x97,0x8E,0x95,0x98,0x97,0x93,0x98,0x91,0x93,
+            0x7C,0x88,0x97,0x94,0x88,0x8D,0x95,0x97,0x72,0x83,0x96,0x94,0x7E,0x8C,0x99,0x97,
+            0x8A,0x99,0x98,0x94,0x94,0x92,0x9B,0x9C,0x8A,0x9B,0x96,0x9A,0x96,0x9B,0x9A,0x95,
+            0x8D,0x91,0x94,0x91,0x90,0x95,0x86,0x93,0x8D,0x96,0x99,0x99,0x94,0x97,0x98,0x94,
+            0x8A,0x9B,0x96,0x93,0x93,0x8C,0x96,0x8C,0x91,0x97,0x98,0x97,0x96,0x9D,0x9C,0x93,
+            0x7D,0x94,0x9A,0x91,0x90,0x94,0x9C,0x9A,0x88,0x8D,0x9F,0x8F,0x99,0x9B,0x9B,0x9D,
+            0x72,0x9C,0x9A,0x9B,0x96,0x89,0x9C,0x9A,0x75,0x99,0x9C,0x9A,0x97,0x9C,0xA0,0x9D,
+            0x8A,0x96,0x99,0x9A,0x95,0x9B,0x9F,0x9D,0x84,0x9A,0x8D,0x84,0x93,0x9E,0x9F,0x9F,
+            0x8B,0x9B,0x9C,0x9B,0x9A,0x9F,0x9C,0x9A,0x8D,0x9A,0x98,0x9E,0x97,0x96,0x97,0x99,
+            0x86,0x8E,0x9A,0x94,0x80,0x91,0x97,0x98,0x8B,0x96,0x8F,0x9A,0x8F,0x81,0x96,0x97,
+            0x88,0x90,0x96,0x97,0x8B,0x99,0x8C,0x9C,0x8B,0x99,0x91,0x98,0x95,0x90,0x98,0x8B,
+            0x84,0x8A,0x96,0x97,0x84,0x9A,0x99,0x99,0x7D,0x88,0x84,0x90,0x96,0x87,0x99,0x97,
+            0x83,0x8B,0x90,0x8B,0x88,0x93,0x89,0x8B,0x7D,0x8A,0x84,0x86,0x81,0x7A,0x74,0x64,
+            0x69,0x5F,0x6F,0x78,0x71,0x79,0x75,0x7E,0x6E,0x88,0x85,0x86,0x82,0x8C,0x87,0x81,
+            0x74,0x8E,0x8C,0x91,0x89,0x93,0x92,0x87,0x7B,0x97,0x94,0x92,0x92,0x97,0x96,0x94,
+            0x74,0x90,0x8D,0x94,0x91,0x91,0x97,0x95,0x86,0x97,0x97,0x98,0x92,0x96,0x96,0x98,
+            0x85,0x91,0x9A,0x94,0x97,0x99,0x9C,0x9C,0x8A,0x99,0x97,0x9B,0x96,0x9C,0x9B,0x97,
+            0x7A,0x8E,0x94,0x9B,0x96,0x97,0x9B,0x9C,0x82,0x90,0x9C,0x9D,0x92,0x97,0x9D,0x8F,
+            0x8C,0x9F,0x9E,0x9B,0x99,0x95,0x9E,0x9B,0x8D,0x9B,0x9E,0x9E,0x9B,0x9E,0x9F,0x98,
+            0x8D,0x94,0x97,0x8D,0x88,0x95,0x89,0x97,0x8C,0x97,0x9E,0x9B,0x8B,0x96,0x93,0x93,
+            0x8E,0x99,0x91,0x95,0x93,0x9B,0x9A,0x9D,0x94,0x96,0xA0,0x9D,0x9D,0x9E,0xA0,0x94,
+            0x81,0x99,0x9D,0x99,0x9C,0x97,0xA0,0x9C,0x95,0x96,0xA0,0x94,0x9E,0x98,0x9E,0x9E,
+            0x8C,0x9F,0x9C,0x9C,0x9E,0x91,0xA0,0xA1,0x8F,0x9D,0x9E,0x9B,0x9A,0xA1,0xA1,0xA0,
+            0x94,0xA1,0xA0,0x99,0x9C,0xA0,0x9F,0x9E,0x92,0x9A,0x99,0x87,0x9B,0xA1,0xA0,0xA1,
+            0x95,0xA1,0x9D,0xA0,0xA0,0xA2,0x9E,0x9C,0x93,0x9C,0x9B,0xA0,0xA0,0xA2,0xA0,0x9E,
+            0x91,0x9E,0xA1,0x9C,0x9D,0x9A,0x95,0xA0,0x98,0x98,0xA0,0xA0,0x9B,0x90,0x9D,0xA0,
+            0x93,0xA0,0xA0,0xA0,0x9F,0x9D,0x9B,0x9F,0x98,0x9C,0xA0,0x9D,0x9F,0x9D,0x9D,0x9E,
+            0x91,0x9E,0x9E,0x9C,0x9A,0x9E,0xA0,0x9D,0x8F,0x94,0x9C,0x96,0x9C,0x9C,0x9B,0x9B,
+            0x8D,0x97,0x98,0x95,0x95,0x97,0x95,0x95,0x8D,0x92,0x91,0x8F,0x89,0x81,0x7E,0x6B,
+            0x66,0x58,0x64,0x6B,0x6B,0x6C,0x77,0x7B,0x63,0x80,0x78,0x81,0x7E,0x83,0x85,0x7D,
+            0x6F,0x88,0x85,0x8A,0x82,0x8C,0x8A,0x8D,0x7D,0x8C,0x91,0x90,0x8D,0x93,0x90,0x82,
+            0x70,0x92,0x92,0x93,0x8E,0x94,0x97,0x94,0x81,0x93,0x8F,0x93,0x8F,0x88,0x92,0x95,
+            0x7F,0x93,0x94,0x93,0x94,0x96,0x98,0x94,0x83,0x97,0x98,0x97,0x95,0x99,0x98,0x90,
+            0x7A,0x8F,0x96,0x98,0x94,0x94,0x98,0x99,0x7C,0x92,0x9B,0x9A,0x90,0x95,0x9A,0x90,
+            0x82,0x9A,0x9B,0x9A,0x88,0x95,0x9A,0x9D,0x84,0x9A,0x9B,0x95,0x8B,0x9A,0x9D,0x97,
+            0x83,0x96,0x96,0x97,0x89,0x99,0x8B,0x97,0x86,0x9A,0x9D,0x98,0x8D,0x99,0x97,0x98,
+            0x85,0x9F,0x99,0x98,0x8C,0x9C,0x99,0x9B,0x87,0x9C,0x9D,0x9A,0x91,0x99,0x9A,0x90,
+            0x80,0x93,0x9A,0x97,0x93,0x98,0x9E,0x9B,0x85,0x93,0x9C,0x96,0x95,0x95,0x9B,0x9A,
+            0x7E,0x9F,0x9C,0x92,0x98,0x97,0x9F,0x9D,0x86,0x9A,0xA0,0x9C,0x97,0x9D,0x9E,0x9B,
+            0x87,0x9B,0x9F,0x98,0x98,0x9A,0x9D,0x9A,0x86,0x9C,0x8E,0x84,0x9A,0x9D,0x9F,0x9B,
+            0x86,0x9F,0x9C,0x9D,0x9B,0x9F,0x9B,0x9C,0x88,0x9C,0x9D,0x9E,0x9E,0x9E,0x9C,0x9B,
+            0x85,0x9B,0x9D,0x9B,0x9D,0x99,0x9C,0x9C,0x88,0x9E,0x9D,0x9E,0x8D,0x93,0x9B,0x9B,
+            0x87,0x9F,0x9D,0xA0,0x99,0x9C,0x9A,0x9D,0x8A,0x9B,0x9D,0x9E,0x97,0x9D,0x9E,0x9B,
+            0x83,0x95,0x92,0x99,0x93,0x9C,0x98,0x99,0x83,0x8D,0x90,0x95,0x81,0x9B,0x98,0x99,
+            0x82,0x95,0x93,0x92,0x8B,0x94,0x91,0x92,0x82,0x8D,0x8C,0x8B,0x84,0x83,0x7B,0x6A,
+            0x72,0x71,0x81,0x89,0x85,0x8D,0x90,0x91,0x82,0x94,0x96,0x9A,0x91,0x99,0x9C,0x8A,
+            0x81,0x9C,0x91,0xA0,0x9A,0x9F,0x9D,0x9F,0x87,0x9D,0x9D,0x9D,0x9B,0xA0,0xA1,0xA1,
+            0x84,0xA1,0xA4,0xA3,0x9C,0xA3,0xA2,0xA3,0x86,0x9E,0xA1,0xA0,0x99,0x9E,0xA3,0xA2,
+            0x81,0x99,0xA2,0xA4,0x9E,0xA3,0xA5,0xA4,0x87,0x98,0xA4,0xA5,0x9C,0x9D,0x9C,0xA1,
+            0x84,0x95,0xA4,0xA4,0x99,0xA0,0xA4,0xA5,0x7F,0x96,0xA4,0xA2,0x92,0x9C,0xA3,0xA3,
+            0x83,0xA2,0x91,0xA3,0x9D,0xA3,0xA5,0xA4,0x81,0xA0,0xA1,0xA1,0x9D,0xA2,0xA0,0xA5,
+            0x8A,0xA3,0x9F,0xA3,0xA0,0xA2,0x8E,0xA6,0x85,0xA7,0xA4,0xA4,0x88,0xA5,0xA3,0xA2,
+            0x8A,0xA5,0xA7,0xA5,0x86,0xA3,0xA5,0xA6,0x88,0xA3,0xA8,0xA8,0x97,0xA5,0xA5,0xA3,
+            0x81,0x9D,0xA5,0x9B,0x9B,0x9E,0xA5,0xA4,0x81,0x9D,0xA3,0x9A,0x9C,0xA0,0xA1,0xA6,
+            0x7B,0xA3,0xA5,0xA7,0x98,0x9D,0xA5,0xA4,0x7F,0x9F,0xA8,0xA5,0x9B,0xA6,0xA2,0xA6,
+            0x7E,0x9B,0xA1,0x92,0x99,0xA5,0xA0,0xA4,0x7D,0x9C,0x95,0x96,0x9A,0xA4,0xA0,0xA6,
+            0x7F,0x9C,0xA3,0xA6,0x98,0xA5,0x9F,0xA5,0x85,0xA1,0x9E,0xA1,0x9C,0xA5,0xA4,0xA0,
+            0x85,0x97,0x9F,0x9D,0x9D,0x97,0xA1,0x8B,0x85,0x94,0xA2,0xA0,0x93,0x9B,0x9E,0xA2,
+            0x86,0xA3,0xA1,0xA4,0xA0,0xA3,0xA2,0xA3,0x86,0x9B,0x97,0xA3,0x9A,0xA1,0x9E,0x9F,
+            0x88,0xA1,0xA2,0x9E,0x9A,0xA1,0xA2,0x9F,0x87,0x97,0x94,0x98,0x90,0x9F,0x9B,0x9E,
+            0x84,0x99,0x9C,0x95,0x93,0x99,0x96,0x98,0x82,0x93,0x91,0x8F,0x86,0x86,0x7F,0x72,
+            0x6F,0x73,0x7F,0x84,0x86,0x8D,0x90,0x8F,0x8D,0x96,0x94,0x95,0x93,0x97,0x99,0x8A,
+            0x8F,0x9A,0x9F,0x9E,0x9A,0x9C,0x8D,0x95,0x9F,0xA0,0xA1,0x90,0x9E,0x9D,0x9F,0x9D,
+            0x96,0xA2,0xA3,0x9A,0x4E,0x9D,0xA3,0xA4,0xA1,0xA0,0xA4,0x94,0x9F,0x9F,0xA2,0xA1,
+            0x8B,0x9A,0xA1,0x94,0xA2,0xA1,0xA0,0x9A,0x9E,0x9F,0xA2,0xA0,0x9F,0xA3,0xA0,0xA1,
+            0x9A,0x90,0xA5,0xA6,0x93,0x9D,0xA6,0xA5,0x85,0x96,0xA2,0x9F,0x91,0x98,0xA6,0xA7,
+            0xA0,0xA4,0xA7,0xA5,0xA2,0xA5,0xA7,0xA9,0xA3,0xA8,0xA7,0xA1,0xA3,0x89,0xA7,0xA8,
+            0xA0,0xA5,0xA0,0xA3,0xA3,0xA3,0x90,0xAB,0xA7,0xAA,0xA7,0xA4,0xA8,0xA1,0xA7,0xA7,
+            0xA4,0xA6,0xA5,0xA2,0xA6,0xA2,0xA1,0xA0,0xA6,0xA5,0xA7,0xA9,0xA7,0xA5,0xA7,0xA4,
+            0x9D,0xA2,0xA3,0x88,0x9F,0x9B,0xA0,0x9E,0xA5,0x9A,0xA6,0x97,0xA1,0x94,0xA7,0xA5,
+            0x9E,0xA6,0xA8,0xA4,0xA4,0x9D,0xA7,0xA4,0xA7,0xA6,0xAD,0xA8,0xA1,0xA8,0xA6,0xA7,
+            0xA1,0xA7,0xA7,0x95,0xA3,0xA6,0xA6,0xA5,0xA4,0xA9,0xA5,0x90,0xA4,0xA7,0xA7,0xAA,
+            0xA3,0xA9,0xA8,0x9F,0xA2,0xA4,0xA5,0xA5,0xA0,0xA7,0xA2,0xA3,0xA5,0xA5,0x95,0xA1,
+            0x85,0x93,0x97,0x94,0x8C,0x92,0x89,0x94,0x8E,0x8C,0x96,0x8D,0x96,0x85,0x92,0x91,
+            0x96,0xA2,0x8F,0x9A,0xA0,0x9E,0x93,0x9F,0x9D,0xA3,0xA3,0xA0,0xA1,0x94,0x9F,0x92,
+            0x99,0xA4,0xA2,0x9B,0x95,0x9D,0xA2,0xA0,0x91,0x92,0x9C,0x91,0x9D,0x90,0x9C,0x97,
+            0x94,0x9A,0x97,0x93,0x97,0x94,0x8A,0x94,0x92,0x94,0x90,0x8D,0x8C,0x85,0x80,0x73,
+            0x6C,0x6E,0x7D,0x85,0x84,0x8C,0x91,0x90,0x7D,0x96,0x96,0x97,0x91,0x9A,0x9A,0x8B,
+            0x7C,0x9A,0x9C,0x9E,0x9A,0x9E,0x9C,0x99,0x82,0x9C,0x9C,0x96,0x9C,0xA3,0xA1,0x9E,
+            0x7E,0xA1,0xA3,0xA3,0x9C,0xA3,0xA4,0xA4,0x80,0x9F,0xA0,0x9D,0x97,0x9F,0x9F,0xA1,
+            0x7D,0x9B,0xA1,0xA3,0x9C,0xA4,0xA6,0xA2,0x80,0x9F,0xA2,0xA4,0x9A,0xA2,0xA2,0x9F,
+            0x7C,0x97,0xA0,0xA5,0x97,0x9E,0xA4,0xA4,0x7A,0x97,0xA3,0xA5,0x94,0x9D,0xA6,0x9F,
+            0x7C,0xA4,0xA1,0xA3,0x9E,0x9A,0xA6,0xA4,0x7F,0xA1,0xA0,0x9D,0x9C,0xA7,0xA0,0xA1,
+            0x7D,0xA2,0x9A,0x9D,0x99,0xA2,0x91,0xA0,0x81,0xA2,0xA5,0xA3,0x92,0x9F,0xA3,0xA3,
+            0x7B,0xA3,0x9C,0xA3,0x8E,0xA4,0xA7,0xA2,0x7F,0xA5,0xA3,0xA5,0x97,0xA6,0xA4,0xA0,
+            0x7F,0xA2,0xA6,0x9E,0x9A,0xA5,0xA6,0xA4,0x80,0x9C,0xA8,0x9C,0xA0,0xA3,0xA2,0xA3,
+            0x7C,0xA0,0xA4,0xA3,0x9C,0x9E,0xA5,0xA5,0x83,0xA3,0xA9,0xA5,0x9B,0xA5,0xA3,0xA5,
+            0x80,0x9F,0xA8,0xA2,0x9C,0xA7,0xA4,0x9A,0x7D,0xA0,0xA0,0x97,0x9A,0xA2,0xA6,0xA4,
+            0x7E,0xA1,0xA0,0xA5,0x9F,0xA4,0xA3,0xA6,0x82,0xA0,0xA1,0xA4,0x99,0xA4,0xA4,0xA2,
+            0x7B,0x9D,0x9D,0x9E,0x98,0x9D,0x9F,0x97,0x82,0x89,0x95,0xA4,0x9D,0x9C,0x9A,0xA1,
+            0x7F,0x9C,0x8B,0xA0,0x9F,0xA1,0x9E,0xA4,0x82,0xA0,0x9F,0x9D,0x99,0xA1,0xA3,0x9F,
+            0x81,0xA3,0xA2,0xA1,0x98,0xA2,0xA3,0xA0,0x81,0x95,0x96,0x99,0x96,0x9C,0x9D,0x9E,
+            0x7F,0x9B,0x9C,0x98,0x95,0x97,0x95,0x96,0x81,0x93,0x91,0x90,0x8A,0x86,0x80,0x71,
+            0x68,0x58,0x64,0x6F,0x6F,0x75,0x76,0x79,0x6A,0x7A,0x75,0x7D,0x7F,0x84,0x86,0x7E,
+            0x72,0x80,0x87,0x89,0x84,0x8E,0x87,0x89,0x76,0x87,0x88,0x8C,0x8A,0x88,0x85,0x87,
+            0x72,0x87,0x88,0x88,0x8A,0x8E,0x8A,0x89,0x77,0x8C,0x8D,0x79,0x84,0x87,0x86,0x81,
+            0x73,0x87,0x85,0x87,0x86,0x88,0x8B,0x88,0x7A,0x84,0x89,0x90,0x8D,0x8F,0x8E,0x8D,
+            0x75,0x8B,0x8D,0x8A,0x8A,0x8A,0x88,0x87,0x79,0x8A,0x93,0x87,0x8A,0x8E,0x8F,0x8E,
+            0x7F,0x95,0x93,0x8E,0x8B,0x8B,0x8F,0x91,0x7E,0x91,0x92,0x92,0x8C,0x8D,0x8F,0x8E,
+            0x7A,0x91,0x92,0x90,0x8D,0x92,0x86,0x8F,0x7E,0x93,0x92,0x91,0x90,0x91,0x8E,0x8E,
+            0x7B,0x91,0x93,0x8E,0x8A,0x8B,0x91,0x92,0x85,0x87,0x88,0x8A,0x8A,0x8B,0x8E,0x88,
+            0x7B,0x8C,0x8D,0x92,0x93,0x8E,0x96,0x8F,0x82,0x87,0x90,0x87,0x8A,0x8A,0x8A,0x8A,
+            0x7D,0x96,0x8A,0x8A,0x8D,0x89,0x93,0x91,0x85,0x93,0x8F,0x99,0x8C,0x96,0x97,0x98,
+            0x86,0x92,0x8C,0x91,0x96,0x8C,0x98,0x96,0x85,0x93,0x95,0x8D,0x93,0x95,0x99,0x95,
+            0x7E,0x94,0x96,0x94,0x93,0x92,0x96,0x95,0x89,0x97,0x95,0x96,0x91,0x98,0x97,0x98,
+            0x7E,0x8F,0x93,0x93,0x92,0x92,0x91,0x92,0x84,0x8A,0x94,0x94,0x91,0x91,0x96,0x97,
+            0x81,0x96,0x8D,0x90,0x91,0x94,0x97,0x93,0x80,0x99,0x8A,0x96,0x92,0x96,0x9A,0x95,
+            0x86,0x96,0x98,0x95,0x95,0x99,0x96,0x98,0x84,0x8F,0x93,0x92,0x94,0x91,0x98,0x94,
+            0x80,0x94,0x93,0x92,0x8C,0x8F,0x8E,0x8B,0x85,0x8F,0x8C,0x8C,0x88,0x84,0x7E,0x6C,
+            0x6E,0x65,0x72,0x76,0x78,0x83,0x84,0x83,0x7A,0x8C,0x82,0x8D,0x89,0x8C,0x8D,0x81,
+            0x78,0x8A,0x90,0x95,0x83,0x95,0x94,0x95,0x78,0x80,0x99,0x97,0x95,0x9B,0x97,0x99,
+            0x78,0x96,0x98,0x9B,0x94,0x9C,0x9C,0x9B,0x76,0x95,0x9E,0x89,0x93,0x8B,0x95,0x93,
+            0x7F,0x96,0x9A,0x9B,0x92,0x93,0x97,0x85,0x82,0x8F,0x97,0x9E,0x92,0x9D,0x9C,0x9B,
+            0x78,0x8E,0x9C,0x8D,0x8C,0x8A,0x8E,0x90,0x7B,0x8F,0x9C,0x92,0x8D,0x93,0x90,0x94,
+            0x81,0x99,0x99,0x95,0x92,0x91,0x95,0x93,0x83,0x9B,0x9F,0x9D,0x98,0xA0,0x9F,0x99,
+            0x82,0x98,0x9E,0x9A,0x97,0x9D,0x8E,0x9C,0x84,0x94,0x96,0x9A,0x97,0x9C,0x93,0x98,
+            0x88,0x9A,0x8A,0x9D,0x93,0x99,0x9B,0x9E,0x87,0x9F,0x96,0x97,0x94,0x98,0x99,0x93,
+            0x7E,0x9A,0x8F,0x90,0x92,0x9B,0xA2,0x98,0x85,0x97,0x9D,0x99,0x98,0x9B,0xA1,0xA0,
+            0x84,0x9F,0x98,0xA1,0x96,0x99,0xA2,0xA0,0x87,0x9F,0xA3,0xA3,0x9B,0xA2,0xA4,0xA5,
+            0x84,0xA1,0xA3,0xA0,0x9E,0xA0,0xA0,0x99,0x86,0x9D,0xA1,0x8C,0x9F,0x9B,0xA3,0xA4,
+            0x85,0xA5,0x9F,0xA2,0x9D,0xA0,0xA2,0x98,0x88,0xA2,0x9E,0xA0,0x98,0xA3,0xA0,0x9E,
+            0x82,0x98,0x9C,0x9B,0x9C,0x98,0x9C,0x9A,0x86,0x87,0x98,0xA2,0x96,0x95,0x9E,0xA0,
+            0x85,0x9E,0x8B,0x9C,0x9C,0x9F,0x9F,0x9F,0x85,0x9E,0x9E,0x96,0x9C,0x9F,0x9E,0x9E,
+            0x85,0x9D,0x9F,0x9F,0x8C,0xA0,0xA2,0xA0,0x85,0x90,0x98,0x96,0x96,0x92,0x9C,0x9D,
+            0x86,0x94,0x98,0x94,0x94,0x97,0x8E,0x8D,0x85,0x93,0x91,0x90,0x8C,0x85,0x80,0x6F,
+            0x59,0x5A,0x6C,0x73,0x6D,0x7A,0x80,0x81,0x69,0x80,0x8A,0x8B,0x85,0x89,0x91,0x48,
+            0x65,0x90,0x93,0x86,0x8E,0x97,0x9B,0x91,0x7A,0x94,0x8E,0x96,0x90,0x97,0x98,0x8C,
+            0x77,0x7F,0x97,0x9B,0x8C,0x8C,0xA0,0xA0,0x84,0x8E,0xA2,0x86,0x9F,0x97,0xA0,0x9A,
+            0x85,0x6B,0x9D,0x9B,0x9C,0xA1,0xA5,0xA6,0x89,0x81,0x98,0x96,0x93,0x8A,0xA2,0x93,
+            0x73,0x62,0x8E,0x95,0x6C,0x6C,0x99,0x9E,0x51,0x67,0x8C,0x96,0x63,0x75,0x8B,0x97,
+            0x88,0x97,0x94,0x8A,0x9D,0x88,0x97,0x9A,0x95,0x8E,0x98,0x6C,0xA1,0x7B,0x9E,0xA1,
+            0x92,0xA4,0x7E,0x9E,0x83,0xA3,0x62,0x9D,0x8B,0x9F,0x83,0xA2,0xA6,0xA6,0xA7,0xA3,
+            0x97,0xA4,0x91,0x91,0x4F,0x59,0x9E,0x95,0x69,0x79,0x9F,0xA0,0x9B,0x98,0x76,0x7D,
+            0x75,0x81,0xA5,0x6C,0x80,0x76,0x9A,0x97,0x86,0x6C,0x9D,0x75,0x9A,0x75,0xA3,0xA4,
+            0x72,0xA4,0x95,0x9C,0xA7,0xA7,0xA6,0xA8,0xA0,0x9F,0xA8,0xA7,0x91,0xA7,0xA5,0xA4,
+            0x9F,0xA2,0xA3,0xA2,0xA2,0xA7,0xA7,0xA6,0x9C,0x98,0xA4,0x9A,0xA5,0x9F,0xA7,0xA5,
+            0x9D,0x8E,0xA1,0xA5,0xA1,0xA2,0xA4,0xA0,0x80,0x75,0x74,0x95,0xA3,0x93,0x75,0x79,
+            0x8E,0x79,0xA4,0x67,0x73,0x74,0x86,0x7C,0x9C,0x97,0xA1,0xA5,0xA2,0xA0,0xA1,0xA1,
+            0x98,0x98,0x95,0x91,0x9E,0xA3,0xA3,0x9B,0x8B,0x8F,0xA0,0x8F,0xA1,0xA0,0x9C,0x9E,
+            0x8B,0x90,0x9A,0x9B,0x90,0x92,0x9D,0x9E,0x59,0x65,0x78,0x6D,0x91,0x91,0x80,0x86,
+            0x76,0x98,0x72,0x67,0x95,0x94,0x84,0x80,0x86,0x8A,0x89,0x84,0x82,0x7B,0x72,0x6A,
+            0x72,0x66,0x76,0x85,0x77,0x82,0x8B,0x86,0x73,0x8B,0x94,0x92,0x89,0x8F,0x98,0x62,
+            0x73,0x92,0x9C,0x9F,0x95,0x8E,0x99,0x9C,0x7A,0x98,0xA0,0x9E,0x9A,0x92,0x9C,0x90,
+            0x74,0x8A,0x9F,0xA0,0x9D,0x92,0xA5,0xA3,0x8D,0x88,0xA4,0x9E,0xA0,0x91,0xA3,0xA4,
+            0x8B,0x79,0xA4,0xA2,0xA2,0x92,0xA7,0xA6,0x90,0x8A,0xA4,0xA0,0x96,0x85,0xA4,0x9E,
+            0x7F,0x6D,0x92,0x8B,0x74,0x75,0x98,0x90,0x5A,0x71,0x8F,0x96,0x71,0x7B,0x92,0xA1,
+            0x8C,0x91,0x99,0x93,0x9D,0x84,0xA1,0x9E,0x93,0x95,0x97,0x90,0x99,0x83,0xA7,0xA4,
+            0x91,0x94,0x77,0x9B,0x93,0x87,0x65,0xA8,0x97,0x8E,0x94,0x97,0x9E,0x85,0xA6,0xA1,
+            0x97,0x92,0x86,0x83,0x7B,0x75,0x81,0x94,0x83,0x7F,0x71,0x7A,0x7D,0x79,0x86,0x93,
+            0x84,0x86,0xAA,0x73,0x8A,0x84,0xA4,0xA6,0x8A,0x74,0xA3,0x7D,0xA3,0x84,0xA7,0xA5,
+            0x93,0xA6,0x92,0x97,0xA5,0xA8,0xA7,0xA7,0xA0,0xA2,0xA7,0xA8,0xA2,0xA7,0x9C,0xA5,
+            0x9D,0xA3,0x9E,0xA5,0xA3,0xA8,0xA7,0xA6,0x99,0xA3,0xA5,0xA5,0xA7,0xA8,0xA9,0xA5,
+            0x8D,0x98,0xA2,0xA7,0xA6,0xA4,0xA6,0xA5,0x84,0x8E,0x87,0xA1,0xA1,0xA1,0x88,0x98,
+            0x79,0x74,0x7D,0x83,0x7C,0x77,0x82,0x7D,0x86,0x8C,0x89,0x8E,0x9B,0x8B,0x89,0x8E,
+            0x98,0x94,0xA4,0x8A,0xA2,0xA6,0xA4,0xA2,0x87,0x94,0xA2,0x91,0xA2,0xA0,0x97,0xA2,
+            0x56,0x60,0x5E,0x6A,0x73,0x6A,0x62,0x67,0x5C,0x62,0x63,0x6F,0x7E,0x74,0x6A,0x6F,
+            0x90,0x9D,0x75,0x72,0x9A,0x9A,0x8B,0x89,0x64,0x6F,0x6C,0x7C,0x7F,0x79,0x73,0x6B,
+            0x72,0x63,0x76,0x84,0x75,0x86,0x8B,0x8E,0x6F,0x83,0x95,0x93,0x89,0x92,0x9A,0x64,
+            0x71,0x9A,0xA1,0xA2,0x93,0x99,0x9B,0x9A,0x82,0x9E,0xA3,0x92,0x9B,0x9C,0x9B,0x8B,
+            0x79,0x8B,0x9F,0xA0,0x9C,0x98,0xA7,0xA6,0x8F,0x8C,0xA8,0xA0,0x9D,0x97,0xA3,0xA3,
+            0x89,0x74,0xA6,0xA3,0xA2,0xA1,0xA5,0xA7,0x8F,0x88,0xA6,0xA1,0x98,0x95,0xA5,0x98,
+            0x7D,0x6E,0x93,0x98,0x76,0x78,0x97,0xA2,0x59,0x71,0x94,0x99,0x6E,0x80,0x97,0xA1,
+            0x93,0x9D,0x9A,0x9C,0xA2,0x91,0x9A,0xA6,0x94,0x9C,0xA3,0x8B,0xA4,0x8F,0xA6,0xA4,
+            0x94,0xA1,0x7F,0xA5,0x9B,0x96,0x6A,0xA5,0xA1,0x97,0x9B,0xA5,0xA5,0x95,0xA7,0xA7,
+            0x9B,0x9D,0x86,0x84,0x79,0x77,0x92,0x8D,0x9D,0x95,0x96,0xA8,0x98,0x83,0x95,0x91,
+            0x85,0x84,0xA9,0x70,0x88,0x82,0xA9,0xAA,0x88,0x71,0xA4,0x79,0xA5,0x83,0xA6,0xA4,
+            0x96,0xA5,0xA6,0xA0,0xA7,0xA7,0xAA,0xA8,0xA2,0x9F,0xA5,0xA8,0xA3,0xA6,0xA4,0xA3,
+            0x9B,0xA3,0x9F,0xA7,0xA3,0xA7,0xA9,0xAA,0x9C,0xA1,0xA7,0xA8,0xA5,0xA8,0xA6,0xAA,
+            0xA1,0x9C,0xA6,0xA2,0xA7,0x9F,0xA4,0xA8,0x82,0x82,0x8C,0xA2,0xA6,0xA1,0x81,0x97,
+            0x8D,0x78,0x9F,0x7D,0x84,0x80,0x95,0x94,0x95,0xA2,0x9E,0xA3,0xA2,0xA0,0xA3,0xA7,
+            0x96,0x94,0xA6,0x93,0xA6,0xA4,0xA4,0xA2,0x91,0x96,0x9E,0x9F,0xA2,0xA3,0x9C,0xA1,
+            0x91,0xA0,0xA0,0x9E,0x9B,0x9F,0xA6,0xA3,0x6A,0x75,0xA0,0x7E,0x9E,0xA1,0xA0,0x9C,
+            0x8E,0x9B,0x78,0x77,0x9B,0x94,0x90,0x8D,0x86,0x92,0x8D,0x8F,0x89,0x85,0x7F,0x6D,
+            0x74,0x67,0x7A,0x84,0x77,0x8E,0x8C,0x8E,0x6C,0x93,0x95,0x9C,0x89,0x9C,0x9D,0x51,
+            0x72,0x9E,0xA2,0xA1,0x9A,0x9C,0xA1,0x9E,0x79,0x9D,0xA1,0xA0,0xA1,0xA1,0x9F,0x9A,
+            0x72,0x9E,0xA3,0xA7,0xA2,0x9F,0xA6,0xA7,0x80,0x9A,0xA5,0xA4,0xA5,0xA1,0xA5,0xA7,
+            0x71,0x76,0xA9,0xA6,0xA6,0xA7,0xAA,0xAA,0x89,0x93,0xA7,0xA2,0x9A,0x9A,0xA2,0xA0,
+            0x80,0x6F,0x9D,0x9C,0x7A,0x7C,0xA1,0xA1,0x56,0x6C,0x95,0x9B,0x6D,0x7C,0x9B,0xA1,
+            0x85,0xA1,0xA4,0x8C,0xA7,0x82,0xA4,0xA8,0x89,0x9E,0xA6,0x96,0xA4,0x90,0xA7,0xA6,
+            0x8C,0xA2,0x78,0xA5,0x96,0x9B,0x52,0xAB,0x8F,0x9E,0xA2,0xA8,0xA5,0x9E,0xA8,0xAB,
+            0x90,0x9D,0x8C,0x8F,0x7F,0x7F,0x98,0x9C,0x99,0x8F,0xA1,0xA2,0x92,0x8A,0x99,0x9B,
+            0x85,0x8B,0xA7,0x7A,0x8D,0x78,0xA9,0xA9,0x91,0x77,0x9C,0x7A,0xA5,0x89,0xA8,0xA5,
+            0x67,0xA8,0xA6,0xA8,0xA8,0xA8,0xA9,0xA9,0x8F,0xA2,0xA5,0xA9,0xA6,0xAA,0xA1,0xA4,
+            0x95,0xA4,0xA6,0xA8,0xA5,0xA7,0xAA,0xA7,0x8F,0xA4,0xA9,0xA6,0xA4,0xA8,0xA9,0xA8,
+            0x87,0x9B,0xA1,0xA4,0xA7,0xA6,0xA8,0xA8,0x74,0x90,0x87,0x9A,0xA9,0x9C,0x86,0x82,
+            0x94,0x8B,0xA9,0x80,0x85,0x80,0x88,0x8A,0x92,0xA7,0xA9,0xA9,0x9F,0xA3,0xA6,0xA7,
+            0x8D,0x9B,0xA9,0x9F,0xA7,0xA8,0xA7,0xA1,0x90,0x9A,0xA4,0xA1,0xA5,0xA0,0x9B,0xA3,
+            0x8A,0xA4,0xA4,0x9D,0xA0,0xA1,0xA5,0xA2,0x61,0x62,0xA4,0x71,0xA0,0xA1,0xA0,0xA1,
+            0x8D,0x9D,0x80,0x79,0x9A,0x94,0x8D,0x91,0x86,0x93,0x94,0x92,0x8B,0x87,0x80,0x6F,
+            0x71,0x6C,0x7C,0x87,0x7D,0x90,0x8E,0x93,0x58,0x92,0x98,0x97,0x8A,0x99,0x9B,0x70,
+            0x69,0x99,0x9F,0x9F,0x9C,0xA0,0xA3,0xA2,0x62,0xA0,0xA2,0x9F,0x9F,0xA5,0xA1,0x9E,
+            0x66,0x90,0x9E,0x9E,0xA0,0xA5,0xA6,0xA8,0x68,0xA0,0xA5,0xA4,0xA5,0xA4,0xA5,0xA6,
+            0x70,0x8B,0xA7,0xA8,0xA2,0xA8,0xA9,0xA8,0x6D,0x99,0xA4,0xA5,0xA3,0x9F,0xA5,0xA4,
+            0x75,0x63,0x76,0x6C,0x81,0x83,0xA5,0x9F,0x62,0x77,0x9C,0x9B,0x79,0x84,0x93,0xA3,
+            0x77,0xA4,0xA9,0x9B,0xA3,0x84,0xA8,0xA8,0x73,0xA3,0xA7,0x9F,0xA0,0x8F,0xA9,0xA7,
+            0x81,0x9B,0x68,0x80,0x9F,0xAA,0x71,0xA8,0x77,0xAA,0xA1,0xA9,0xA0,0xA8,0xAA,0xA6,
+            0x85,0xA7,0x94,0x94,0x85,0x87,0x9D,0xA2,0x79,0xAA,0xA4,0xAB,0x93,0x9F,0x9C,0x9E,
+            0x84,0x85,0x89,0x87,0x93,0x84,0xA9,0xA7,0x7A,0x84,0xA2,0x88,0xA4,0x9B,0xA8,0xA4,
+            0x8A,0xA9,0xA4,0xA9,0xA6,0xA6,0xAB,0xAA,0x7D,0xA2,0xAA,0xA9,0xA4,0xA9,0xA7,0xA6,
+            0x8C,0x7B,0x8D,0x91,0xA6,0xA9,0xAA,0xA5,0x7D,0xA8,0xA7,0xA7,0xA9,0xA6,0xA9,0xA9,
+            0x90,0xA0,0xA6,0xA6,0xA6,0xA6,0xA6,0xA8,0x7D,0x99,0x9C,0xA4,0xA9,0xA4,0x95,0x99,
+            0x8F,0x5F,0x74,0x7E,0x7C,0x81,0x98,0x95,0x81,0xA5,0xA4,0xA7,0xA3,0xA2,0xA5,0xA5,
+            0x8C,0xA6,0xA5,0xA0,0xA6,0xA5,0xA6,0x9F,0x7E,0xA1,0xA2,0xA4,0xA5,0xA4,0xA5,0xA6,
+            0x8F,0x8C,0x61,0x67,0xA3,0xA4,0xA3,0xA3,0x6D,0x78,0xA2,0x82,0x9E,0xA0,0xA0,0xA1,
+            0x8B,0x9E,0x83,0x7F,0x9A,0x9C,0x94,0x98,0x80,0x95,0x93,0x8F,0x8C,0x86,0x7F,0x72,
+            0x69,0x66,0x77,0x84,0x76,0x87,0x8B,0x8C,0x6D,0x92,0x94,0x9B,0x8B,0x91,0x9C,0x6B,
+            0x74,0x93,0xA0,0xA0,0x98,0x8F,0xA4,0x9A,0x7E,0x94,0xA1,0x99,0x9B,0x8E,0x9E,0x9D,
+            0x74,0x91,0xA3,0xA3,0x9E,0x83,0xA6,0xA6,0x82,0x8C,0x9F,0x9D,0xA1,0x82,0xA5,0xA5,
+            0x86,0x84,0x9D,0x9E,0x92,0x86,0xAB,0xA8,0x8A,0x8E,0x9A,0x95,0x9B,0x7D,0xA7,0x9D,
+            0x80,0x70,0x9D,0x9F,0x7D,0x7E,0xA1,0xA0,0x5F,0x71,0x95,0x9C,0x73,0x7E,0x96,0xA3,
+            0x8A,0xA1,0xA2,0x83,0xA3,0x98,0xA5,0xA6,0x8C,0x9E,0xA0,0x9A,0xA3,0x95,0xAA,0xA8,
+            0x8F,0x9C,0x83,0xA4,0x9C,0x97,0x73,0x99,0x91,0x9A,0x9A,0xA1,0xA3,0x92,0xA9,0xA7,
+            0x92,0x9D,0x81,0x8A,0x7D,0x7F,0x99,0x99,0x86,0x80,0x7F,0x83,0x84,0x77,0x81,0x97,
+            0x88,0x91,0xA4,0x80,0x8A,0x78,0xA7,0xAE,0x90,0x7D,0xA2,0x82,0xA2,0x8E,0xA6,0xA7,
+            0x93,0x9C,0xA8,0xA9,0xA5,0x97,0xA8,0xAA,0x94,0x9C,0xA6,0xA7,0xA4,0x93,0xA6,0xA9,
+            0x95,0x9D,0xA1,0xA5,0xA5,0x93,0xA7,0xA9,0x90,0x99,0xA0,0x9D,0xA4,0x91,0xAB,0xAB,
+            0x92,0x94,0xA1,0x9D,0xA6,0x90,0xA9,0xAA,0x86,0x92,0x95,0x9C,0xA7,0x8D,0x92,0x8C,
+            0x8D,0x81,0x97,0x97,0x7D,0x73,0x8F,0x91,0x8C,0x81,0x93,0x95,0x98,0x7E,0xA3,0xA3,
+            0x88,0x7D,0x95,0x94,0x9A,0x7C,0xA5,0xA2,0x89,0x81,0x92,0x90,0x99,0x79,0x9E,0xA3,
+            0x88,0x81,0x90,0x90,0x9B,0x78,0xA4,0xA3,0x67,0x6A,0x86,0x77,0x9A,0x77,0x8E,0x91,
+            0x81,0x7C,0x81,0x7D,0x8F,0x74,0x8B,0x94,0x68,0x6A,0x64,0x68,0x76,0x66,0x6F,0x6E,
+            0x6B,0x66,0x77,0x7F,0x67,0x7B,0x81,0x7D,0x70,0x90,0x95,0x9A,0x8D,0x99,0x9B,0x69,
+            0x72,0x80,0xA0,0x9E,0x9A,0x9B,0x9C,0x96,0x7F,0xA0,0xA2,0x9C,0x9B,0x9E,0x99,0x95,
+            0x75,0x92,0xA2,0xA4,0x9D,0xA0,0xA5,0xA4,0x8B,0x90,0xA9,0xA0,0xA2,0xA5,0xA5,0xA6,
+            0x84,0x77,0xA6,0xA3,0xA5,0xA8,0xAA,0xA8,0x92,0x90,0xA8,0xA2,0x9D,0x99,0xA5,0xA2,
+            0x69,0x6C,0x86,0x72,0x62,0x70,0x80,0x78,0x59,0x6F,0x95,0x97,0x6B,0x80,0x99,0xA1,
+            0x87,0xA6,0xA4,0x9C,0xA3,0x95,0xA4,0xA4,0x91,0xA5,0xA5,0x80,0xA5,0x94,0xA8,0xA7,
+            0x87,0xA8,0x7F,0xA5,0x9E,0xA9,0x6E,0xA7,0x96,0xA2,0x9B,0xA6,0xA5,0xA7,0xA7,0xA8,
+            0x8A,0xA6,0x8E,0x8B,0x7D,0x7A,0x99,0xA0,0x9D,0xA6,0xA3,0xAB,0x9B,0x99,0x95,0x94,
+            0x7A,0x89,0x91,0x6A,0x68,0x71,0x84,0x7B,0x94,0x77,0xA3,0x80,0xA4,0x89,0xA7,0xA5,
+            0x86,0xA6,0xA7,0xA9,0xA5,0xA7,0xA6,0xA8,0x9D,0xA3,0xAA,0xA6,0xA4,0xA6,0xA6,0xA4,
+            0x8A,0xA4,0xA5,0xA7,0xA3,0xA8,0xA7,0xA7,0x9C,0xA4,0x9E,0xA4,0xA4,0xA8,0xA8,0xAA,
+            0x8A,0x9F,0xA6,0xA0,0xA7,0xA6,0xA7,0xA8,0x8B,0x8F,0x81,0xA2,0xA7,0xA3,0x91,0x8B,
+            0x7A,0x7E,0x91,0x92,0x85,0x87,0x91,0x8D,0x8E,0x81,0x91,0x93,0x9D,0xA0,0xA0,0xA4,
+            0x87,0x98,0x8B,0x90,0x9D,0xA1,0xA1,0x9F,0x91,0x95,0x98,0x89,0x99,0x9F,0x9F,0xA0,
+            0x87,0x9F,0x91,0x9C,0x8F,0x94,0xA0,0xA2,0x62,0x71,0x9D,0x79,0x98,0x8B,0x97,0x9B,
+            0x85,0x9C,0x85,0x81,0x97,0x96,0x8D,0x8F,0x83,0x93,0x91,0x90,0x8A,0x86,0x7E,0x65,
+            0x64,0x66,0x70,0x71,0x5F,0x70,0x72,0x74,0x6F,0x83,0x95,0x99,0x8D,0x91,0x9D,0x67,
+            0x72,0x94,0xA1,0xA0,0x94,0x9F,0xA4,0xA1,0x7A,0x9F,0xA3,0x9E,0x9D,0xA5,0x9D,0x96,
+            0x78,0x86,0xA6,0xA4,0xA2,0xA2,0xA7,0xA8,0x88,0x97,0xA7,0xA4,0xA6,0xA7,0xA5,0xA8,
+            0x89,0x73,0xA7,0x95,0xA4,0xA8,0xAA,0xA7,0x8F,0x90,0xA8,0xA4,0xA2,0x92,0xA4,0xA4,
+            0x61,0x6B,0x78,0x64,0x51,0x63,0x71,0x69,0x5A,0x6C,0x94,0x99,0x6D,0x7F,0x9B,0xA3,
+            0x8E,0x9F,0xA2,0xA1,0xA3,0x9F,0xA6,0xA3,0x8D,0xA6,0xA9,0x8E,0xA6,0x92,0xA9,0xA6,
+            0x90,0xA7,0x81,0xA6,0xA2,0xA6,0x6F,0xA7,0x95,0xA5,0x9B,0xA6,0xA6,0xA9,0xA8,0xA8,
+            0x93,0x9D,0x91,0x8F,0x63,0x7D,0x9C,0xA0,0x98,0xA9,0xA3,0xAA,0x9B,0x97,0x99,0x97,
+            0x6D,0x88,0x88,0x64,0x57,0x62,0x7A,0x72,0x91,0x79,0xA1,0x82,0xA5,0x8E,0xA6,0xA9,
+            0x8A,0xA5,0xA7,0xA9,0xA7,0xA6,0x9D,0xA7,0x92,0xA4,0xA9,0xA6,0xA4,0xA7,0xA7,0xA7,
+            0x94,0xA6,0xA9,0xA9,0xA5,0xA8,0xAA,0xA5,0x98,0xA7,0xA4,0x89,0xA8,0xA8,0xAA,0xA9,
+            0x91,0x9E,0xA6,0xA4,0xA7,0xA8,0xA5,0xA7,0x8C,0x93,0x7B,0xA2,0xA7,0xA4,0x81,0x97,
+            0x76,0x7B,0x7C,0x89,0x84,0x80,0x7F,0x83,0x9A,0xA7,0xA8,0xA8,0xA5,0xA4,0xA6,0xA8,
+            0x8C,0xA0,0xA7,0x9C,0xA4,0xA7,0xA5,0x9F,0x9A,0xA5,0xA3,0xA6,0xA3,0xA5,0x9E,0xA5,
+            0x8A,0xA3,0xA0,0xA2,0xA1,0xA0,0xA3,0xA3,0x5D,0x71,0xA1,0x7A,0xA0,0xA0,0xA1,0xA1,
+            0x8B,0x9D,0x88,0x81,0x9C,0x9C,0x93,0x91,0x84,0x94,0x94,0x93,0x8A,0x85,0x7F,0x66,
+            0x5D,0x6C,0x71,0x7E,0x7E,0x87,0x89,0x89,0x80,0x87,0x90,0x8E,0x8F,0x92,0x95,0x64,
+            0x81,0x95,0x99,0x9A,0x92,0x97,0x9B,0x9B,0x91,0x9F,0x9C,0x9D,0x9D,0xA0,0x9B,0x9F,
+            0x8C,0x8F,0xA3,0xA0,0x8D,0x90,0xA2,0xA3,0x9D,0x8E,0x98,0xA2,0xA2,0xA5,0xA2,0xA6,
+            0x98,0x76,0x9D,0xA3,0xA2,0xA3,0xA5,0xA4,0x92,0x8E,0xA2,0x9F,0x99,0x9A,0xA0,0xA4,
+            0x8A,0x70,0x96,0x9A,0x74,0x7E,0x9F,0xA3,0x5C,0x71,0x93,0x99,0x71,0x81,0x91,0xA2,
+            0x99,0x9C,0xA5,0x9A,0xA5,0x90,0xA6,0x9C,0x93,0x9E,0xA2,0x86,0xA5,0x8B,0xA6,0xA5,
+            0x9E,0x9B,0x86,0xA3,0x7E,0xA6,0x68,0xA7,0xA3,0x9C,0xA1,0xA2,0xA8,0xA8,0xA6,0xA6,
+            0xA1,0xA6,0x82,0x85,0x7B,0x76,0x8C,0x87,0x94,0xA5,0x90,0xA7,0x9B,0x97,0x90,0x87,
+            0x8B,0x8E,0xAB,0x76,0x97,0x83,0xA6,0xA6,0x8A,0x74,0xA2,0x7B,0xA7,0x89,0xA8,0xA6,
+            0x97,0xA8,0xA9,0xA9,0xA8,0xA5,0xA6,0xA8,0xA3,0x9B,0xAB,0xA3,0xA4,0xA7,0xA9,0xA9,
+            0xA2,0xA5,0x9C,0xA0,0xA3,0xA6,0xA9,0xA7,0x9C,0xA3,0xA6,0xA5,0xAA,0xA6,0xAA,0xA6,
+            0xA3,0x89,0x9E,0xA6,0xA5,0xA8,0xA3,0xA5,0x8F,0x8D,0x88,0xA0,0xA9,0xA2,0x92,0x9D,
+            0x96,0x7D,0xA9,0x82,0x81,0x7F,0x8F,0x92,0xA0,0xA5,0xA5,0xA4,0xA4,0xA3,0xA4,0xA5,
+            0xA0,0x92,0xA7,0x92,0xA6,0xA5,0xA6,0xA0,0xA2,0xA0,0xA4,0xA2,0xA1,0x99,0x9D,0xA5,
+            0xA0,0xA0,0xA3,0xA1,0xA1,0x9B,0xA3,0xA1,0x7B,0x79,0xA2,0x80,0xA0,0xA2,0x93,0x9F,
+            0x91,0x9D,0x7A,0x74,0x9B,0x99,0x8F,0x8B,0x8D,0x8F,0x8E,0x89,0x87,0x81,0x75,0x6C,
+            0x6F,0x7B,0x80,0x8C,0x8D,0x92,0x96,0x96,0x8D,0x8E,0x9B,0x99,0x9B,0x9B,0x9D,0x5E,
+            0x90,0xA0,0x9D,0xA2,0x9C,0x9F,0x9E,0xA3,0x9B,0xA4,0xA3,0x99,0xA2,0xA4,0xA3,0x9A,
+            0x96,0x8C,0xA2,0xA6,0xA4,0x9F,0xA6,0xA8,0xA4,0x96,0xA6,0xA3,0xA6,0xA5,0xA3,0xA0,
+            0x97,0x69,0xA2,0xA3,0xA3,0xA9,0xAA,0xA3,0x94,0x8D,0xA3,0xA1,0x94,0x9C,0xA6,0xA2,
+            0x8A,0x6E,0x99,0x9E,0x77,0x6E,0x9B,0xA0,0x60,0x72,0x94,0x9B,0x6E,0x7D,0x95,0x9F,
+            0x7E,0xA1,0x99,0x90,0xA6,0x8D,0x9F,0x9B,0x9C,0xA0,0xA7,0x8F,0xA3,0x9B,0xA6,0xA6,
+            0xA1,0x9A,0x80,0xA5,0x96,0xA6,0x6B,0xA5,0x9F,0x9B,0x85,0xA3,0xA3,0xA2,0xA7,0xA4,
+            0xA0,0xA7,0x9B,0x9A,0x64,0x71,0xA5,0xA2,0x79,0x90,0xA4,0xA7,0xA1,0xA3,0x82,0x8A,
+            0x88,0x8D,0xA9,0x79,0x92,0x88,0xA7,0xA9,0x94,0x7A,0xA3,0x86,0xA1,0x8A,0xA8,0xA5,
+            0x94,0xA7,0xA6,0xA3,0xA8,0xA5,0xA8,0xA8,0xA1,0xA4,0x96,0xA7,0xA7,0xA8,0xA7,0xA4,
+            0xA2,0xA7,0xA8,0xA9,0xA4,0xA8,0xA5,0xA7,0x9A,0xA2,0xA5,0xA1,0xA8,0xA9,0xA8,0xA8,
+            0xA1,0x85,0xA4,0xA6,0xA8,0xA7,0xA4,0xA6,0x8D,0x8C,0x66,0x9E,0xA8,0x9E,0x7F,0x90,
+            0x9D,0x87,0xA4,0x7C,0x82,0x7E,0x95,0x8E,0xA2,0xA7,0xA7,0xA7,0xA4,0xA2,0xA5,0xA6,
+            0xA1,0x9E,0xA6,0x93,0xA2,0xA6,0xA6,0xA2,0x91,0x8E,0xA5,0x84,0xA0,0x9F,0x93,0x9A,
+            0x94,0x9C,0xA1,0xA1,0xA1,0x96,0xA5,0xA4,0x6D,0x76,0xA2,0x7B,0xA0,0x9F,0x9C,0x94,
+            0x9B,0x9C,0x7D,0x78,0x9C,0x98,0x8B,0x8F,0x93,0x94,0x91,0x91,0x8E,0x86,0x7F,0x71,
+            0x71,0x7A,0x81,0x8D,0x89,0x91,0x94,0x94,0x8B,0x8B,0x99,0x9A,0x9B,0x9C,0x9D,0x6B,
+            0x90,0xA0,0xA0,0xA1,0xA1,0xA1,0xA4,0xA2,0x99,0xA2,0x9D,0xA2,0x9F,0xA3,0xA2,0xA0,
+            0x92,0x8A,0xA7,0xA5,0x9B,0xA1,0xA6,0xA7,0x9A,0x90,0xA8,0xA4,0xA7,0xA5,0xA3,0x9C,
+            0x9E,0x86,0xA7,0xA4,0xA7,0xAA,0xAC,0xA4,0x9C,0x92,0xA9,0xA1,0xA1,0xA6,0xA1,0x9A,
+            0x8F,0x76,0x9B,0x9E,0x7A,0x87,0xA3,0xA6,0x62,0x7A,0x97,0x9B,0x77,0x88,0x9C,0xA1,
+            0x9F,0xA7,0xA5,0x95,0xA9,0x96,0xA6,0xA6,0x9C,0x9A,0xA8,0x9A,0xA4,0xA5,0xA7,0xA6,
+            0xA1,0xA8,0x83,0xA5,0x97,0xA7,0x6D,0xA8,0xA6,0xA3,0xA3,0xA3,0xA8,0xA9,0xA6,0xA5,
+            0xA6,0xA8,0x89,0x8A,0x84,0x7C,0x99,0x9D,0xA6,0xA4,0x9A,0xA8,0x9B,0x9C,0x9C,0x96,
+            0x88,0x8E,0xA9,0x7B,0x9B,0x89,0xA7,0xA8,0x89,0x7B,0xA4,0x84,0xA6,0x8E,0xA7,0xA3,
+            0x9E,0xA6,0xA5,0x99,0xAA,0xA6,0xA8,0xA8,0xA4,0xA4,0x86,0xA6,0xA5,0xA8,0xA6,0xA4,
+            0xA7,0xA9,0xA7,0xA9,0xA4,0xA9,0xA8,0xA7,0x9D,0xA5,0xA4,0xA3,0xA7,0xA6,0xA9,0xA5,
+            0xA7,0xA4,0xA8,0xAA,0xA6,0xAA,0xA2,0xA5,0x97,0x91,0x9B,0xA8,0xA8,0xA6,0x92,0x9D,
+            0x97,0x83,0xA7,0x99,0x7D,0x84,0x9F,0x9A,0xA4,0xA7,0xA4,0xA8,0xA3,0xA2,0xA5,0xA5,
+            0xA4,0x96,0xA6,0x97,0xA7,0xA9,0xA7,0xA6,0x99,0x90,0xA6,0x8A,0x9A,0xA5,0x96,0xA0,
+            0xA0,0xA5,0xA4,0xA1,0xA4,0xA4,0xA3,0xA2,0x7F,0x84,0xA3,0x7F,0xA2,0xA2,0x9E,0xA1,
+            0x99,0x9E,0x83,0x79,0x9A,0x9A,0x94,0x92,0x93,0x96,0x93,0x92,0x8E,0x86,0x81,0x6F,
+            0x76,0x7F,0x82,0x8E,0x8F,0x95,0x95,0x97,0x92,0x97,0x9D,0x9C,0x9C,0x9D,0x9C,0x73,
+            0x94,0x9F,0xA0,0xA2,0xA3,0xA3,0xA3,0xA2,0x9E,0xA4,0xA4,0xA4,0xA3,0xA5,0xA4,0xA6,
+            0x99,0xA1,0xA6,0xA6,0xA7,0xA5,0xA7,0xA4,0xA2,0xA1,0xA7,0xA4,0xA6,0xA8,0xA2,0xA7,
+            0xA3,0x8C,0xA7,0xA6,0xA7,0xA6,0xA8,0xA7,0xA4,0x9B,0xA6,0x9F,0xA3,0xA7,0x9B,0xA5,
+            0x94,0x7F,0xA1,0xA5,0x82,0x88,0xA3,0xA4,0x6E,0x7D,0x9D,0x9C,0x7F,0x8A,0x9F,0x9F,
+            0xA3,0xA7,0xA8,0xA2,0xA8,0x96,0xA9,0xA3,0x9E,0x9D,0xA8,0xA1,0xA3,0xA8,0xA7,0xA8,
+            0xA4,0xA8,0x7A,0xA6,0xA3,0xA8,0x74,0xA6,0xA7,0xA6,0xA9,0xA7,0xA9,0xA8,0xA7,0xA7,
+            0xA3,0xAA,0x99,0x8E,0x8F,0x8C,0x9E,0xA0,0xA8,0xA6,0xA4,0xA8,0xA3,0xA1,0xA1,0xA1,
+            0x91,0x9C,0xAB,0x8D,0xA1,0x99,0xAB,0xAA,0xA2,0x89,0xA7,0x92,0xA5,0x96,0xA7,0xA7,
+            0x9D,0xA8,0xA7,0xA1,0xA9,0xA9,0xA9,0xA7,0xA8,0xA4,0xA8,0xA9,0xA4,0xA7,0xA8,0xA8,
+            0xA6,0xA7,0xA5,0xA7,0xA5,0xA8,0xA7,0xA5,0xA6,0xA6,0xA6,0xA9,0xA9,0xA8,0xA8,0xA9,
+            0xA5,0xA9,0xA5,0xA7,0xA9,0xAB,0xA3,0xA4,0x99,0x96,0x9A,0xA5,0xA8,0xA4,0xA1,0xA1,
+            0x9F,0x93,0xA6,0x9F,0x8A,0x84,0xA1,0x9F,0xA5,0xA9,0xA3,0xA9,0xA2,0xA4,0xA8,0xA8,
+            0xA4,0x9F,0xA6,0x9B,0xA5,0xA5,0xA5,0xA3,0x9B,0x95,0xA4,0x93,0x9C,0xA6,0x9A,0xA2,
+            0x9F,0xA3,0xA3,0xA0,0xA2,0xA3,0xA2,0xA4,0x8A,0x8C,0xA3,0x8C,0x9F,0xA2,0xA1,0xA1,
+            0x9A,0x9F,0x86,0x84,0x9B,0x9A,0x97,0x93,0x91,0x95,0x92,0x90,0x8D,0x87,0x80,0x74,
+            0x70,0x7C,0x7E,0x8A,0x89,0x92,0x91,0x98,0x91,0x96,0x9A,0x9A,0x92,0x9E,0x9C,0x7B,
+            0x90,0x9B,0x9F,0xA1,0xA0,0xA1,0x9F,0xA3,0x9F,0xA2,0xA3,0xA3,0xA2,0xA4,0xA4,0xA3,
+            0x98,0xA1,0xA2,0xA6,0x9C,0xA1,0xA5,0xA6,0xA7,0xA3,0xA7,0xA6,0xA8,0xA5,0xA3,0xA3,
+            0xA2,0x91,0x92,0xA6,0x9C,0xA8,0xAC,0xAA,0xA7,0x9F,0xAA,0xA8,0xA7,0xA6,0xAA,0xA1,
+            0x95,0x82,0xA5,0xA6,0x89,0x8C,0xA6,0xA6,0x75,0x80,0xA0,0xA2,0x82,0x8B,0xA0,0xA4,
+            0x9F,0x9B,0xA9,0x92,0xA9,0x78,0xA9,0xA4,0x94,0xA6,0xA8,0xA0,0xA3,0xA7,0xA4,0xA4,
+            0xA3,0xA9,0x7C,0xA7,0xA6,0xA5,0x75,0xA9,0xA8,0xA7,0xA5,0xA4,0xA6,0xA5,0xA9,0xA4,
+            0xA2,0xAA,0xA4,0x9D,0x97,0x93,0xA1,0xA3,0xA9,0xA8,0xA5,0xA9,0xA5,0xA6,0xA5,0xA3,
+            0x98,0xA1,0xA8,0x93,0x9E,0x9B,0xA9,0xA8,0xA1,0x8B,0xA9,0x95,0xA5,0x9C,0xA8,0xA6,
+            0x9C,0xA8,0xA5,0xAB,0xA9,0xA8,0xA8,0xAA,0xA4,0xA6,0xAA,0xAC,0xA7,0xAB,0xA8,0xA7,
+            0xA5,0xA3,0xAA,0xA9,0xA4,0xAA,0xA9,0xAA,0xA2,0xA7,0xA7,0xA8,0xA8,0xA6,0xA9,0xA6,
+            0xA4,0xA9,0xA9,0xAA,0xA8,0xA8,0xA5,0xAB,0x9F,0x98,0x9D,0xA3,0xA6,0xA0,0x9E,0xA1,
+            0x9E,0x9A,0xA5,0xA0,0x8D,0x86,0x9F,0x9F,0xA7,0xA9,0xA8,0xAB,0x65,0xA6,0xA8,0xA7,
+            0xA4,0xA7,0xA7,0x9C,0xA6,0xA5,0xA8,0xA1,0x9E,0x99,0xA6,0x97,0xA0,0xA4,0x9B,0xA3,
+            0xA2,0xA3,0xA5,0x9F,0xA4,0xA1,0xA1,0xA4,0x8D,0x8D,0xA3,0x90,0xA0,0xA1,0x9F,0x9F,
+            0x98,0x9F,0x89,0x85,0x9D,0x9C,0x98,0x98,0x92,0x96,0x92,0x91,0x8C,0x85,0x7E,0x73,
+            0x6D,0x80,0x83,0x8F,0x8C,0x92,0x94,0x96,0x8C,0x96,0x9D,0x99,0x9D,0x9D,0x9A,0x77,
+            0x95,0xA1,0x9D,0xA2,0xA1,0xA0,0x9B,0xA0,0x9C,0xA4,0xA4,0xA4,0xA1,0xA3,0xA3,0xA6,
+            0x97,0x9B,0xA8,0xA6,0xA4,0xA5,0xAA,0xAA,0xA2,0xA2,0xA7,0xA8,0xAA,0xA7,0xA5,0xA6,
+            0xA3,0x8C,0xAA,0xA7,0x9A,0xA7,0xA5,0xA9,0x9D,0x9C,0xA9,0xA7,0xA2,0xA8,0xA8,0xA4,
+            0x90,0x73,0x9F,0xA5,0x84,0x8A,0xA5,0xA5,0x71,0x80,0xA0,0xA2,0x7F,0x88,0xA4,0xA6,
+            0x9F,0xA7,0xA8,0x79,0xA6,0xA0,0xA7,0xA8,0x99,0xA6,0xA4,0xA0,0xA5,0xA9,0xA7,0xA7,
+            0x9F,0xA1,0x83,0xA7,0xA4,0xA7,0x78,0xA3,0xA2,0x9F,0xA0,0x9C,0xA6,0xA6,0xA7,0xA8,
+            0xA2,0xA3,0x8E,0x97,0x8F,0x8E,0x99,0x9F,0xA9,0xAB,0xA8,0xAC,0xA3,0xA4,0xA3,0xA2,
+            0x91,0x9F,0xA8,0x8F,0xA2,0x99,0xAA,0xAA,0xA3,0x8A,0xA9,0x94,0x9E,0x98,0xA9,0xAA,
+            0x9A,0xA8,0xA6,0xA9,0xA8,0xA6,0xA9,0xA8,0xA4,0xA4,0xA3,0xAC,0xA5,0xA8,0xA8,0xA9,
+            0x9A,0xA8,0xAA,0xA7,0xA2,0xAB,0xAA,0xA5,0xA3,0xA4,0xA8,0xA6,0xA7,0xA5,0xAA,0xA8,
+            0xA6,0xAA,0xAA,0xAA,0xA8,0xA9,0xA7,0xA8,0x93,0x95,0x9A,0xA7,0xA9,0xA8,0x9D,0xA0,
+            0xA0,0x93,0xA7,0xA3,0x81,0x82,0x9F,0x9F,0xA6,0xA8,0xA9,0xA7,0x85,0x9F,0xA5,0xA7,
+            0xA3,0xA1,0xA7,0x97,0xA3,0xA5,0xA7,0xA3,0xA2,0x9D,0xA5,0x9D,0xA6,0xA4,0xA3,0xA3,
+            0xA0,0xA4,0xA3,0xA2,0xA2,0xA3,0xA5,0xA5,0x88,0x8B,0xA0,0x8E,0xA0,0x9F,0x9E,0x96,
+            0x9C,0x9D,0x87,0x82,0x9D,0x95,0x96,0x96,0x92,0x93,0x91,0x92,0x8E,0x84,0x7F,0x70,
+            0x72,0x7D,0x83,0x8D,0x8A,0x92,0x94,0x95,0x8D,0x92,0x99,0x9A,0x9A,0x9D,0x9F,0x75,
+            0x93,0x9F,0xA1,0xA2,0xA2,0xA4,0xA2,0xA3,0x9A,0xA3,0xA2,0xA0,0xA0,0xA5,0xA3,0xA6,
+            0x9A,0x93,0xA6,0xA2,0xA3,0xA3,0xA8,0xA7,0xA3,0x94,0xA8,0xA5,0xA6,0xA6,0xA2,0xA7,
+            0xA0,0x88,0xA4,0xA7,0xA8,0xA7,0xA7,0xA9,0x9C,0x95,0xA8,0xA5,0xA5,0xA4,0xA8,0xA4,
+            0x8F,0x73,0x9C,0xA2,0x7E,0x87,0xA3,0xA7,0x68,0x7B,0x9B,0xA1,0x77,0x88,0x9F,0x9D,
+            0xA3,0xA6,0xA2,0x9B,0xAA,0x9A,0xA4,0xA8,0xA3,0xAA,0xA7,0x8E,0xA8,0xA5,0xA6,0xAA,
+            0xA4,0xA4,0x93,0xAA,0xA0,0xA7,0x77,0xA7,0xA8,0xA4,0xA3,0xA7,0xA8,0xA6,0xAA,0xA6,
+            0xA5,0xAB,0x94,0x93,0x89,0x80,0x9C,0xA0,0xA7,0xA8,0xA7,0xAA,0xA1,0xA1,0x92,0x9B,
+            0x91,0x8E,0xA7,0x82,0x9F,0x96,0xAB,0xAB,0x9D,0x81,0xA6,0x8A,0xA6,0x95,0xA9,0xA8,
+            0x9A,0xA7,0xA5,0xA7,0xA9,0xA7,0xAB,0xAA,0xA5,0xA3,0xAB,0xA8,0xA4,0xA5,0xA8,0xA7,
+            0xA3,0xA7,0xAB,0xA8,0xA2,0xA9,0xA9,0xA6,0xA6,0xA8,0xA8,0xAA,0xAA,0xA9,0xAA,0xA7,
+            0xA5,0xA7,0xA9,0xA9,0xA8,0xA8,0xA7,0xA9,0x96,0x95,0x98,0xA3,0xA8,0xA3,0x99,0xA0,
+            0x99,0x8A,0xA8,0xA2,0x8C,0x8B,0xA0,0x9B,0x9F,0xA7,0xA6,0xA7,0xA6,0xA7,0xA7,0xA7,
+            0xA5,0xA0,0xA6,0x97,0xA6,0xA7,0xA5,0xA4,0xA4,0xA3,0xA5,0xA3,0xA5,0xA3,0xA1,0xA5,
+            0xA2,0xA6,0xA6,0xA2,0xA4,0xA4,0xA3,0xA3,0x7F,0x86,0xA2,0x83,0xA2,0xA1,0x9F,0xA2,
+            0x9C,0x9E,0x8D,0x88,0x9C,0x9B,0x96,0x96,0x93,0x96,0x94,0x90,0x8F,0x86,0x80,0x73,
+            0x71,0x80,0x85,0x8E,0x90,0x93,0x95,0x97,0x91,0x96,0x9C,0x9C,0x9C,0x9E,0x9D,0x76,
+            0x93,0xA0,0xA0,0xA2,0xA3,0x9F,0xA2,0xA3,0x9C,0xA4,0xA1,0xA3,0xA4,0xA4,0xA3,0xA3,
+            0x9E,0x9C,0xA7,0xA5,0xA7,0xA3,0xA7,0xA7,0xA3,0x97,0xA6,0xA5,0xA8,0xA7,0xA4,0xA7,
+            0xA0,0x85,0xA6,0xA8,0xA8,0xA7,0xAA,0xA8,0xA0,0x9A,0xA7,0xA7,0xA6,0xA7,0xA9,0xA3,
+            0x94,0x74,0xA2,0xA6,0x7F,0x8A,0xA4,0xA8,0x69,0x7B,0x9C,0x9B,0x78,0x87,0xA1,0x9C,
+            0xA3,0xA5,0xA7,0x9D,0xAA,0x99,0xA7,0xA9,0xA6,0xA9,0xA6,0x9C,0xA7,0xA6,0xAC,0xA7,
+            0xA3,0xA6,0x80,0xA6,0xA2,0xA5,0x75,0xAA,0xA6,0xA5,0xA8,0xA8,0xAA,0xAA,0xA9,0xA6,
+            0xA5,0xA9,0x9B,0x99,0x88,0x88,0xA0,0x9E,0xA8,0xAA,0xA8,0xAA,0xA2,0xA2,0x9E,0x9A,
+            0x98,0x96,0xA9,0x85,0x9E,0x96,0xA8,0xA9,0x9E,0x82,0xA8,0x8F,0xA5,0x93,0xA7,0xA7,
+            0x9D,0xA8,0xA8,0xA4,0xAA,0xAC,0xA8,0xA7,0xA6,0xA2,0xA9,0xA7,0xA6,0xA5,0xA8,0xA6,
+            0xA7,0xA7,0xA9,0xAD,0xA3,0xA9,0xA7,0xA4,0xA7,0xA6,0xA8,0xAA,0xA8,0xA7,0xAA,0xA9,
+            0xA6,0xA9,0xA9,0xA8,0xA8,0xA8,0xAA,0xA9,0x9B,0x9B,0x97,0xA6,0xA8,0xA4,0x97,0xA0,
+            0xA1,0x8B,0xAA,0x9E,0x8E,0x8A,0x9E,0x9D,0xA6,0xA7,0xA6,0xA8,0xA5,0xA8,0xA7,0xA4,
+            0xA4,0xA2,0xA7,0x99,0xA7,0xAA,0xA4,0xA4,0xA5,0xA6,0xA5,0xA3,0xA8,0xA6,0xA4,0xA5,
+            0x9F,0xA5,0xA6,0xA1,0xA4,0xA7,0xA5,0xA2,0x7C,0x87,0xA2,0x8B,0x9F,0xA1,0x9E,0x9F,
+            0x98,0x9F,0x8A,0x86,0x9D,0x9A,0x96,0x90,0x93,0x94,0x82,0x90,0x8D,0x86,0x80,0x71,
+            0x5B,0x6A,0x76,0x7E,0x81,0x7E,0x87,0x8B,0x7F,0x86,0x92,0x91,0x8D,0x91,0x98,0x62,
+            0x83,0x95,0x99,0x99,0x98,0x9A,0x9B,0x9D,0x8E,0x9B,0x9C,0x9E,0xA3,0x95,0x98,0x9F,
+            0x93,0x8C,0xA4,0x98,0x9A,0x8F,0xA4,0x9F,0x9F,0x8A,0x8C,0xA3,0xA0,0xA3,0xA2,0xA5,
+            0x9F,0x7B,0x96,0x8A,0x99,0xA4,0xA4,0xA2,0x9E,0x89,0xA1,0x9C,0x95,0x9E,0x9D,0xA4,
+            0x8C,0x6D,0x90,0x9C,0x74,0x80,0x9C,0xA0,0x5A,0x6D,0x90,0x97,0x70,0x80,0x9C,0x9B,
+            0x95,0xA1,0x9E,0x99,0xA4,0x98,0xA7,0x9E,0x94,0x9B,0xA2,0x82,0xA3,0x97,0xA1,0xA1,
+            0xA0,0xA1,0x83,0xA4,0x97,0xA3,0x69,0xA7,0xA3,0x94,0x9E,0xA2,0xA8,0xA6,0xA5,0xA5,
+            0xA0,0xA8,0x86,0x85,0x7A,0x75,0x97,0x93,0x9E,0xA1,0x9E,0xA5,0x9A,0x98,0x95,0x98,
+            0x84,0x8F,0xA7,0x75,0x8F,0x82,0xA7,0xA9,0x7D,0x73,0xA1,0x7B,0xA7,0x89,0xA6,0xA6,
+            0x9B,0xA7,0xA7,0xA1,0xA6,0xA8,0xA8,0xA5,0xA1,0x9C,0xA8,0xA7,0xA2,0xA4,0xA6,0xA4,
+            0xA0,0xA7,0xA7,0xA2,0xA5,0xA8,0xA8,0xA8,0x98,0x9E,0x9F,0xA5,0xA6,0xA5,0xA7,0xA5,
+            0xA2,0xA4,0xA8,0xA6,0xA3,0xA8,0xA6,0xA5,0x8C,0x97,0x85,0x9A,0xA5,0xA3,0x8C,0x99,
+            0x8F,0x79,0x9F,0x7D,0x7D,0x80,0x8D,0x94,0x9B,0xA1,0x9C,0xA3,0xA1,0xA3,0xA2,0xA0,
+            0x9D,0x8F,0x9F,0x8B,0xA2,0xA4,0xA1,0x9E,0xA3,0xA0,0x9D,0x9F,0xA2,0xA0,0x9E,0xA0,
+            0x9E,0xA0,0x9F,0x9E,0x9C,0x91,0xA1,0xA0,0x7A,0x73,0x89,0x7B,0x97,0x98,0x8B,0x92,
+            0x88,0x9A,0x7F,0x7A,0x96,0x94,0x8C,0x83,0x8A,0x8B,0x88,0x88,0x82,0x7C,0x75,0x6B,
+            0x74,0x7C,0x89,0x8D,0x8E,0x8E,0x95,0x97,0x8D,0x8E,0x9C,0x9C,0x9A,0x9B,0x9E,0x6E,
+            0x93,0xA2,0xA2,0xA1,0x9E,0x98,0x9E,0xA2,0x9D,0x9D,0xA4,0x9D,0xA1,0xA2,0xA2,0xA2,
+            0x96,0x90,0xA3,0xA2,0xA3,0xA1,0xA6,0xA7,0xA2,0x91,0xA4,0xA3,0xA1,0xA7,0xA3,0xA5,
+            0xA2,0x85,0xA7,0xA6,0xA5,0xA7,0xA7,0xA4,0xA1,0x8D,0xA7,0xA4,0x9C,0xA6,0xA6,0xA5,
+            0x95,0x77,0x9E,0xA4,0x7B,0x85,0xA0,0xA3,0x60,0x77,0x93,0x9A,0x79,0x88,0x96,0x9F,
+            0x9F,0x9F,0xA1,0x9D,0xA5,0x9B,0xA4,0xA2,0xA1,0x9F,0xA5,0x98,0xA3,0xA2,0x9E,0xA6,
+            0x99,0x9C,0x82,0xA2,0x99,0xA3,0x6D,0xA7,0xA1,0x99,0x98,0xA6,0xA1,0x97,0xA6,0xA3,
+            0xA5,0xA8,0x86,0x87,0x82,0x7B,0x8C,0x96,0x9F,0xA3,0xA3,0xA5,0x93,0x98,0x9B,0x99,
+            0x91,0x8D,0xA6,0x7A,0x95,0x8D,0xA8,0xA6,0x96,0x77,0xA2,0x84,0xA4,0x8C,0xA6,0xA6,
+            0x96,0xA8,0xA9,0xA6,0xAA,0xA7,0xA9,0xA9,0xA6,0xA4,0xA8,0xA8,0xA8,0xA3,0xA4,0xA7,
+            0xA7,0xA8,0xA9,0xA5,0xA6,0xA8,0xAA,0xA6,0xA3,0xA8,0xA6,0xA7,0xA5,0xA2,0xA7,0xA5,
+            0xA6,0x98,0xA4,0xA6,0xA6,0xA6,0xA9,0xA6,0x87,0x97,0x8E,0x9F,0xA1,0x9E,0x92,0x9C,
+            0x91,0x83,0x99,0x99,0x80,0x85,0x97,0x95,0x9D,0x9F,0xA1,0xA3,0xA3,0xA2,0xA4,0xA4,
+            0x9B,0x9A,0xA5,0x8C,0xA0,0xA3,0xA8,0xA3,0xA2,0xA2,0xA4,0xA1,0xA7,0xA1,0xA3,0xA2,
+            0x94,0x9B,0xA0,0xA0,0x9E,0xA0,0x9E,0xA1,0x71,0x74,0x7B,0x80,0x8B,0x84,0x7E,0x7E,
+            0x98,0x9E,0x83,0x7D,0x9C,0x98,0x8E,0x8F,0x7A,0x87,0x84,0x87,0x89,0x80,0x79,0x72,
+            0x73,0x7B,0x89,0x8E,0x90,0x90,0x97,0x97,0x92,0x8B,0x9B,0x9D,0x9C,0x9D,0x9F,0x5B,
+            0x86,0xA1,0xA2,0xA2,0xA1,0xA1,0xA1,0xA0,0x9D,0xA0,0xA3,0x9B,0xA5,0xA3,0xA0,0x9D,
+            0x97,0x93,0xA7,0x9C,0xA5,0x9B,0xA6,0xA5,0xA6,0x90,0xA7,0xA3,0xA5,0xA6,0xA2,0x9A,
+            0xA1,0x6A,0xA8,0xA4,0xA4,0xA4,0xA9,0xAA,0xA0,0x8B,0xA7,0x9E,0x97,0x9C,0xA6,0xA5,
+            0x89,0x6E,0x96,0xA0,0x75,0x76,0x9E,0x9E,0x5C,0x73,0x96,0x9D,0x68,0x80,0x93,0x9E,
+            0x93,0xA3,0xA2,0x8F,0xAA,0x90,0xA0,0xA6,0x9A,0x99,0xA4,0x87,0xA0,0x96,0xA5,0xA2,
+            0x8A,0xA9,0x82,0xA5,0x97,0xA4,0x6C,0x9F,0xA3,0xA6,0x8F,0xA7,0xA8,0xA4,0xA6,0xA6,
+            0xA5,0xA9,0x9B,0x96,0x60,0x6C,0xA4,0xA8,0x73,0x8C,0xA9,0xA6,0xA6,0x94,0x7F,0x89,
+            0x87,0x89,0xAA,0x79,0x93,0x7E,0xA6,0xA7,0x93,0x76,0xA1,0x82,0xA5,0x83,0xA7,0xA7,
+            0x93,0xA9,0xA3,0xA0,0xAA,0xA4,0xA6,0xA8,0xA5,0xA5,0xA7,0xA8,0xA7,0xA6,0xA5,0xA8,
+            0xA4,0xA9,0xA7,0xA5,0xA5,0xA8,0xA6,0xA7,0x9C,0xA5,0xAB,0xA1,0xA7,0xA7,0xA9,0xA3,
+            0xA7,0x8D,0xA8,0xA6,0xA7,0xA5,0xAA,0xA3,0x81,0x81,0x93,0xA1,0xA0,0x9F,0x68,0x86,
+            0x9F,0x85,0xA6,0x94,0x84,0x82,0x92,0x8B,0xA4,0xA7,0xA4,0xA6,0xA6,0xA3,0xA7,0xA7,
+            0xA2,0x9C,0xA7,0x97,0xA5,0xA5,0xA7,0xA2,0x95,0xA2,0xA3,0xA4,0xA4,0xA1,0xA3,0xA3,
+            0x9B,0x9E,0xA3,0xA1,0xA1,0x9F,0xA3,0xA2,0x6D,0x71,0xA2,0x78,0xA2,0xA0,0x9E,0xA0,
+            0x9B,0x9D,0x82,0x7D,0x9C,0x96,0x8D,0x7B,0x95,0x95,0x92,0x91,0x8D,0x83,0x80,0x72,
+            0x75,0x7E,0x87,0x8E,0x8F,0x91,0x96,0x98,0x91,0x96,0x9D,0x9E,0x9B,0x9F,0x9D,0x72,
+            0x8E,0xA1,0xA3,0xA2,0xA1,0xA0,0xA3,0xA3,0xA1,0xA3,0xA1,0xA0,0xA5,0xA5,0xA4,0xA2,
+            0x95,0xA0,0xA7,0xA6,0xA5,0xA2,0xA4,0xA6,0xA0,0x9D,0xA7,0xA6,0xA7,0xA7,0xA5,0xA7,
+            0x98,0x8E,0xA9,0xA6,0xA8,0xA7,0xA9,0xA6,0xA6,0x9B,0xA9,0xA7,0xA2,0xA7,0xA8,0xA7,
+            0x9D,0x7E,0xA0,0xA2,0x7F,0x89,0xA4,0xA6,0x68,0x79,0x9C,0xA1,0x7A,0x87,0x9D,0xA4,
+            0xA4,0xA8,0xA2,0x9F,0xA7,0x9E,0xA7,0xAB,0xA0,0x9C,0xA8,0x9F,0xA1,0xAA,0xA4,0xA7,
+            0xA0,0xA6,0x7A,0xA6,0x9C,0xA5,0x6F,0xA9,0xA7,0xA5,0xA5,0xA9,0xA8,0xA9,0xA6,0xA7,
+            0xA8,0xA6,0x94,0x93,0x8A,0x8A,0x9F,0x9F,0xA8,0xA9,0xA8,0xA7,0xA3,0x9D,0xA3,0xA1,
+            0x96,0x9D,0xA6,0x89,0x97,0x95,0xA7,0xA9,0x9C,0x86,0xA4,0x8E,0xA8,0x95,0xA7,0xA5,
+            0x9C,0xA9,0xA5,0x9C,0xAA,0xA7,0xAA,0xAA,0xA8,0xA7,0xA7,0xA6,0xA9,0xA3,0xA7,0xA7,
+            0xA5,0xA7,0xAB,0xA5,0xA4,0xA9,0xA8,0xAA,0xA4,0xA9,0x9A,0xA9,0xA7,0xA9,0xAC,0xA9,
+            0xA6,0x7C,0xA8,0xA6,0xA9,0xA6,0xA9,0xA6,0x9E,0xA1,0x8D,0x9F,0xA7,0xA5,0x9C,0x9D,
+            0x90,0x90,0x99,0x9D,0x86,0x7E,0x9B,0x9B,0x9C,0xA7,0xA3,0xA4,0xA5,0xA5,0xA4,0xA4,
+            0xA5,0xA0,0xA5,0x9D,0xA4,0xA5,0xA5,0xA3,0xA2,0xA3,0xA5,0xA4,0xA6,0xA7,0xA5,0xA6,
+            0x6B,0x89,0x72,0x82,0x8D,0x84,0x7B,0x79,0x73,0x83,0x7E,0x85,0x95,0x8E,0x83,0x88,
+            0x9B,0x9F,0x80,0x83,0x9E,0x9C,0x96,0x97,0x80,0x90,0x87,0x8C,0x8C,0x82,0x7D,0x74,
+            0x71,0x7D,0x80,0x8C,0x8D,0x8D,0x94,0x96,0x91,0x99,0x8F,0x96,0x99,0x9C,0xA0,0x7B,
+            0x90,0xA1,0xA0,0xA2,0x9D,0xA2,0xA3,0xA2,0x9C,0xA2,0xA2,0xA1,0xA4,0xA5,0xA4,0xA0,
+            0x98,0xA1,0xA6,0xA6,0xA6,0xA2,0xA5,0x88,0xA3,0xA3,0xA6,0xA6,0xA9,0xA5,0xA4,0xA8,
+            0x9C,0x8F,0x99,0xA7,0xA7,0xA7,0xA9,0xA8,0xA5,0xA0,0xA8,0xA7,0xA4,0xA5,0xA7,0xA6,
+            0x9B,0x81,0x96,0xA5,0x86,0x8D,0x9F,0xA5,0x71,0x7C,0xA1,0xA1,0x81,0x8E,0xA2,0xA7,
+            0xA1,0xA2,0xA3,0x8B,0xA5,0x72,0xA9,0xA5,0xA2,0xA2,0xA7,0xA2,0xA4,0xA6,0xAA,0xA7,
+            0xA3,0xA8,0x79,0xA9,0xA1,0xA4,0x77,0xA8,0xA9,0xA9,0xA6,0xA8,0xA9,0xA5,0xA9,0xA4,
+            0xA2,0xA7,0x9A,0x9D,0x94,0x93,0xA3,0xA2,0xA8,0xAA,0xA7,0xA9,0xA7,0xA5,0xA4,0xA6,
+            0x9B,0xA1,0xAA,0x91,0x99,0x96,0xA8,0xA7,0xA2,0x8B,0xA8,0x90,0xA4,0x9C,0xA7,0xA6,
+            0x9C,0xA8,0xA7,0xAB,0xA8,0xA7,0xA8,0xA9,0xA7,0xA7,0xA9,0xA7,0xA5,0xA6,0xA5,0xA6,
+            0xA4,0xA9,0xA9,0xA6,0xA0,0xA8,0xA9,0xA7,0xA4,0xA8,0xA8,0xA8,0xA7,0xA9,0xA7,0xA8,
+            0xA5,0x75,0xA7,0xA9,0xA7,0xA7,0xA8,0xA8,0x9A,0x9F,0x94,0xA5,0xA6,0xA6,0x9F,0x9B,
+            0x9A,0x8D,0x97,0x99,0x87,0x85,0x9C,0x9C,0x94,0xA1,0x9B,0x9F,0x9E,0xA1,0xA4,0xA3,
+            0x9C,0xA0,0xA1,0x9D,0x9F,0xA2,0xA1,0xA2,0x9C,0xA0,0x9F,0xA1,0xA1,0xA1,0xA3,0xA0,
+            0x99,0xA2,0x9E,0x9D,0xA0,0xA0,0xA0,0xA2,0x8A,0x89,0xA0,0x88,0x9E,0x9E,0x9C,0x9E,
+            0x97,0x9B,0x88,0x80,0x9A,0x9A,0x96,0x98,0x92,0x94,0x8F,0x8F,0x8C,0x84,0x7F,0x74,
+            0x6D,0x82,0x85,0x8C,0x8F,0x91,0x95,0x97,0x8A,0x96,0x9B,0xA1,0x9D,0xA0,0xA1,0x76,
+            0x8C,0xA4,0xA2,0xA2,0x9F,0xA4,0xA2,0xA1,0xA0,0xA2,0xA5,0xA3,0xA4,0xA2,0xA3,0xA1,
+            0x94,0xA0,0xA6,0xA6,0xA5,0xA6,0x97,0xA9,0x9D,0x9E,0xA7,0xA7,0xA8,0xA5,0xA6,0xA5,
+            0x9C,0x88,0xA5,0xA6,0xA7,0xA8,0xAA,0xAA,0xA4,0x9C,0xA9,0xA7,0xA1,0xA6,0xA8,0xA4,
+            0x94,0x72,0xA2,0xA6,0x81,0x89,0xA3,0xA6,0x69,0x79,0x9D,0xA0,0x7B,0x89,0xA0,0xA6,
+            0xA3,0xA9,0xA6,0x74,0xA4,0x9E,0xA6,0xA8,0xA1,0xA0,0xA7,0x9F,0xA2,0xA9,0xA9,0xA6,
+            0x9D,0x9D,0x82,0xA7,0x9E,0xA3,0x78,0xA6,0xA4,0x9C,0x9F,0xA1,0xA5,0xA4,0xA8,0xA6,
+            0xA0,0xA1,0x8D,0x95,0x8E,0x8C,0xA2,0xA0,0xA5,0xAB,0xA7,0xAB,0xA7,0xA6,0xA2,0x9F,
+            0x98,0x9E,0xA9,0x8D,0x91,0x92,0xAB,0xA8,0x9C,0x86,0xA4,0x8E,0x9F,0x96,0xA5,0xA6,
+            0x9D,0xA5,0xA7,0xAB,0xAB,0xA8,0xA8,0xAA,0xA6,0xA8,0xAA,0xA9,0xA9,0xA8,0xA8,0xA8,
+            0xA2,0xA6,0xA8,0xA8,0xA7,0xAA,0xA8,0xA6,0xA0,0xA5,0xA7,0xA8,0xA8,0xAA,0xAC,0xAB,
+            0xA6,0x7C,0xA6,0xA7,0xA8,0xA8,0xA9,0xAA,0x9C,0x9A,0x8D,0xA6,0xA7,0xA6,0x9D,0x99,
+            0xA1,0x93,0xA1,0x9D,0x90,0x88,0x9E,0x9A,0x9D,0xA4,0xA2,0x9E,0xA2,0xA4,0xA3,0xA5,
+            0x9D,0x9F,0xA5,0xA1,0xA1,0xA1,0xA2,0xA3,0x9F,0xA1,0xA4,0x9B,0xA4,0xA2,0xA4,0xA3,
+            0x9A,0xA0,0x9E,0x9F,0xA4,0xA3,0xA3,0xA3,0x84,0x83,0xA0,0x7F,0x9E,0x9F,0x9F,0x92,
+            0x99,0x9C,0x88,0x88,0x9A,0x8E,0x95,0x97,0x8F,0x90,0x90,0x92,0x8E,0x85,0x7E,0x73,
+            0x73,0x80,0x80,0x8F,0x89,0x91,0x94,0x91,0x92,0x97,0x9B,0x9B,0x92,0xA0,0xA0,0x71,
+            0x91,0x9A,0x9F,0xA1,0x98,0xA5,0xA0,0x9F,0x9F,0xA2,0x9C,0xA2,0x9C,0xA3,0xA1,0xA1,
+            0x99,0x9B,0xA3,0xA3,0x9F,0xA5,0xA2,0x9F,0x9F,0x94,0xA5,0xA5,0xA0,0xA8,0xA7,0xA2,
+            0xA1,0x87,0xA4,0xA7,0xA2,0xA7,0xA9,0xA1,0xA3,0x95,0xA8,0xA5,0xA3,0xA5,0xA8,0xA5,
+            0x89,0x72,0x8A,0x94,0x78,0x82,0x99,0x96,0x63,0x76,0x99,0x9B,0x76,0x89,0x9E,0x9D,
+            0x9F,0x9C,0xA0,0x90,0x97,0x95,0xA6,0xA4,0xA1,0xA6,0x9F,0x9C,0x9E,0xA1,0xAA,0xA9,
+            0xA5,0xA8,0x7C,0xA7,0x99,0xA5,0x72,0xA4,0xA9,0xA3,0xA1,0xA8,0xA4,0xA9,0xA8,0xA6,
+            0xA5,0xA7,0x91,0x90,0x85,0x83,0xA0,0xA0,0xA6,0xA8,0xA9,0xAB,0xA0,0x9E,0x9F,0x9B,
+            0x8F,0x92,0xA3,0x7F,0x87,0x8C,0x9C,0x98,0x9C,0x7E,0x9B,0x88,0x9F,0x91,0xA6,0xA0,
+            0x9C,0xA8,0xA8,0xA7,0xA4,0xA4,0xAB,0xAA,0xA9,0xA3,0xA9,0xA9,0xA5,0xA4,0xA6,0xA5,
+            0xA5,0xA7,0xAA,0xA9,0xA4,0xA8,0xA9,0xA5,0xA3,0xA3,0xA8,0xA9,0xA6,0xA8,0xA9,0xA6,
+            0xA5,0x98,0xA8,0xA9,0xAA,0x9E,0xA6,0xAA,0x9A,0x99,0x91,0xA4,0xA7,0xA7,0x9A,0x9D,
+            0x9F,0x82,0xA6,0xA0,0x7D,0x88,0x9E,0x9D,0xA0,0xA6,0xA5,0xA9,0xA6,0xA6,0xA6,0xA7,
+            0xA4,0x9D,0xA7,0x9A,0xA8,0xA5,0xA2,0xA5,0x9F,0xA4,0xA5,0xA4,0xA4,0xA5,0xA3,0xA4,
+            0xA0,0xA5,0xA2,0x9E,0xA6,0xA4,0xA4,0xA5,0x7E,0x84,0xA0,0x86,0xA2,0xA1,0xA1,0x9E,
+            0x9C,0x9C,0x84,0x82,0x9E,0x9B,0x95,0x93,0x92,0x95,0x94,0x92,0x8C,0x87,0x80,0x71,
+            0x71,0x80,0x86,0x8D,0x90,0x92,0x96,0x9A,0x92,0x96,0x9C,0xA0,0x9F,0x9F,0xA1,0x75,
+            0x92,0xA0,0xA3,0xA0,0xA2,0xA4,0xA2,0xA3,0x9F,0xA2,0xA4,0xA1,0xA4,0xA4,0xA3,0xA4,
+            0x99,0x9D,0xA8,0x9D,0xA8,0xA5,0xA7,0xA7,0x9D,0x98,0xA8,0xA7,0xA6,0xA5,0xA6,0xA9,
+            0x9C,0x8A,0xA9,0xA6,0xA4,0xA8,0xA9,0xA9,0x9F,0x96,0xA7,0xA4,0xA5,0xA7,0xA6,0xA4,
+            0x96,0x75,0xA3,0xA5,0x80,0x89,0xA6,0xA8,0x66,0x77,0x9B,0xA3,0x77,0x8A,0xA3,0xA0,
+            0x9D,0xA7,0xA2,0x94,0xA7,0x98,0xA9,0xA8,0xA4,0xA5,0xA7,0x9D,0xA6,0xA3,0xA8,0xA9,
+            0xA7,0xA7,0x80,0xA8,0x9F,0xA6,0x79,0xA8,0xA8,0xA6,0xA3,0xA9,0xAA,0xAA,0xA6,0xA9,
+            0xA6,0xAC,0x97,0x95,0x84,0x84,0xA1,0xA1,0xA8,0xAB,0xA9,0xA9,0xA2,0x9F,0xA1,0x9D,
+            0x9A,0x98,0x9D,0x86,0x9C,0x96,0xA8,0xAB,0x9E,0x81,0xA7,0x8B,0xA5,0x95,0xA8,0xA7,
+            0x9D,0xAB,0xA6,0xAA,0xAA,0xA6,0xA8,0xAA,0xA8,0xA5,0xA9,0xAB,0xAA,0xA7,0xA9,0xA8,
+            0xA5,0xA8,0xAB,0x9B,0xA6,0xA8,0xAB,0xA8,0xA5,0xA9,0xA6,0xA8,0xA9,0xA7,0xA4,0x9D,
+            0xA7,0xAA,0xAA,0xA9,0xA8,0xA8,0xA9,0xA9,0x9E,0x99,0x93,0xA4,0xA8,0xA6,0x96,0x9F,
+            0x80,0x85,0x92,0x99,0x8F,0x8A,0x9F,0x96,0x8C,0x98,0x94,0x9D,0xA5,0xA3,0xAA,0xA6,
+            0x8A,0x97,0x95,0x96,0xA6,0xA5,0xA5,0xA6,0x9D,0x9F,0x99,0x97,0xA6,0xA7,0xA4,0xA7,
+            0x9B,0xA6,0xA2,0x9F,0xA4,0xA2,0xA5,0xA0,0x79,0x85,0x9A,0x83,0xA0,0x9C,0xA1,0xA0,
+            0x86,0x9A,0x8B,0x84,0x9C,0x9B,0x96,0x93,0x89,0x91,0x8B,0x8A,0x8D,0x86,0x80,0x71,
+            0x5F,0x6F,0x77,0x81,0x81,0x81,0x8A,0x8D,0x87,0x8D,0x94,0x96,0x91,0x90,0x99,0x6D,
+            0x90,0x9C,0x9B,0x9C,0x98,0x9B,0x9B,0x9F,0x91,0x92,0xA0,0x9F,0xA2,0x9D,0x9B,0xA3,
+            0x98,0x97,0xA3,0xA1,0x9F,0x90,0xA5,0xA6,0x9E,0x93,0x9E,0xA2,0xA1,0xA4,0x97,0xA5,
+            0x98,0x79,0x96,0xA2,0xA3,0xA0,0xA6,0x9B,0xA0,0x90,0xA6,0x9B,0x94,0x9D,0xA6,0xA4,
+            0x93,0x77,0x9B,0x9F,0x77,0x81,0xA3,0xA4,0x60,0x74,0x97,0x99,0x70,0x82,0x9A,0x9C,
+            0x95,0x97,0xA3,0xA3,0xA8,0xA0,0xA7,0x9D,0x9F,0x9C,0x9D,0x68,0xA2,0xA1,0xA9,0xA3,
+            0x9B,0xA9,0x87,0xA4,0x96,0xA5,0x64,0xA7,0xA5,0xA4,0x9B,0xA7,0xA8,0xA7,0xA7,0xA7,
+            0x9A,0xA9,0x8E,0x8B,0x82,0x83,0x99,0x96,0xA5,0xA6,0x9F,0xA8,0x99,0x9C,0x9A,0x97,
+            0x90,0x97,0xA5,0x7F,0x9D,0x8C,0xA8,0xA7,0x92,0x7B,0xA6,0x85,0xA7,0x95,0xA8,0xA7,
+            0x97,0xA8,0xA7,0xA2,0xA5,0xA6,0xA9,0xA9,0x9C,0xA1,0xA8,0xA4,0xA7,0xA7,0xA8,0xA6,
+            0xA1,0xA6,0xA8,0xA3,0xA3,0xA9,0xA9,0xA6,0x9F,0xA2,0xA8,0xA6,0xAA,0xA6,0xA8,0xA4,
+            0x9F,0xA4,0xA5,0xA8,0xA2,0xA6,0xA9,0xA7,0x93,0x8F,0x93,0xA1,0xA7,0xA4,0x91,0x9B,
+            0x98,0x82,0xA0,0x93,0x7F,0x81,0x95,0x96,0x97,0x8D,0x89,0x91,0x91,0x9C,0xA2,0xA8,
+            0x9F,0x98,0xA6,0x9A,0xA2,0xA4,0xA3,0xA1,0xA3,0x92,0xA3,0x97,0xA5,0x70,0xA1,0x9F,
+            0x9A,0x9E,0xA1,0xA1,0xA1,0x9D,0xA2,0xA3,0x7C,0x7D,0x9F,0x81,0x9F,0x9F,0x9F,0x9E,
+            0x8D,0x99,0x83,0x74,0x8C,0x97,0x91,0x8C,0x90,0x8E,0x8C,0x8C,0x85,0x80,0x78,0x70,
+            0x76,0x80,0x86,0x91,0x86,0x8A,0x94,0x9A,0x8A,0x98,0x9D,0x9D,0x9D,0x9F,0x9F,0x78,
+            0x9D,0xA3,0xA2,0xA1,0x9C,0xA0,0x9D,0xA2,0x8D,0xA1,0xA4,0xA4,0xA4,0xA2,0xA2,0xA2,
+            0x9F,0x9C,0xA3,0xA4,0xA6,0xA5,0xA8,0xA6,0xA6,0x96,0xA2,0xA3,0xA6,0xA7,0xA3,0xA8,
+            0xA4,0x87,0xA5,0xA5,0xA6,0xA8,0xA8,0xA5,0xA3,0x98,0xA8,0xA5,0xA4,0xA3,0xA7,0xA7,
+            0x99,0x7B,0xA0,0xA1,0x7E,0x82,0x9E,0xA4,0x69,0x7B,0x9E,0xA0,0x72,0x82,0x9D,0x9A,
+            0x98,0xA6,0xA1,0x9F,0xA4,0x9D,0xA7,0x9D,0xA0,0x9E,0xA6,0x9C,0xA1,0xA5,0xA8,0xA6,
+            0xA1,0x99,0x85,0xA8,0xA3,0xA8,0x73,0xA7,0xA1,0x99,0x91,0x9F,0x91,0xA1,0x94,0xA5,
+            0xA6,0xA7,0x91,0x95,0x8F,0x89,0x98,0x99,0xA3,0x9F,0x9C,0xA8,0x99,0x9E,0xA2,0xA1,
+            0x95,0x99,0xA8,0x87,0x9B,0x96,0xA8,0xA9,0x9B,0x84,0xA4,0x8D,0xA6,0x96,0xA7,0xA7,
+            0x9B,0xA9,0xA4,0xA2,0xA8,0xAA,0xA4,0xA6,0xA8,0xA3,0xA9,0xA7,0xA7,0xAA,0xA6,0xA7,
+            0xA7,0xA5,0xAA,0xA8,0xA2,0xA6,0xA8,0xA8,0xA5,0xA6,0xA6,0xA5,0x9A,0xA6,0xAA,0xA6,
+            0xA7,0xA3,0xA5,0xA5,0xA8,0xA6,0xA5,0xA6,0x99,0x97,0x72,0xA2,0xA2,0xA4,0x87,0x9B,
+            0x87,0x87,0x98,0x97,0x85,0x8A,0x9D,0x9E,0xA4,0x81,0x89,0x90,0x96,0x9C,0xA3,0xA5,
+            0x80,0xA1,0xA7,0x92,0xA0,0xA4,0xA3,0xA3,0xA5,0x97,0x80,0x98,0xA2,0x9F,0xA2,0xA7,
+            0x90,0x91,0xA4,0x9F,0xA2,0x98,0xA4,0xA1,0x79,0x87,0x9F,0x89,0xA0,0x9F,0x6F,0x92,
+            0x9A,0x9E,0x88,0x78,0x9C,0x99,0x92,0x95,0x94,0x93,0x8F,0x90,0x8A,0x86,0x80,0x70,
+            0x74,0x7F,0x85,0x91,0x8C,0x94,0x97,0x99,0x8D,0x97,0x9D,0x9F,0x9D,0xA0,0x9E,0x78,
+            0x9D,0xA4,0xA2,0xA1,0xA2,0xA2,0xA3,0xA3,0x88,0x9F,0xA5,0x9D,0xA5,0xA3,0xA2,0xA5,
+            0xA0,0x9C,0xA5,0xA7,0xA6,0xA5,0xA8,0xA7,0xA8,0x9A,0x9F,0xA3,0xA6,0xA5,0xA5,0xA7,
+            0xA6,0x81,0xA7,0xA5,0xA9,0xA9,0xAA,0xA5,0xA4,0x94,0xA9,0xA5,0xA2,0xA1,0xA4,0xA3,
+            0x99,0x7B,0x9F,0xA0,0x78,0x82,0xA4,0xA7,0x66,0x7D,0x9C,0x9D,0x6D,0x87,0x97,0xA2,
+            0x9A,0xA8,0xA2,0xA3,0xA9,0x9E,0x9F,0xA7,0x9E,0x99,0xA5,0x8E,0xA5,0x9B,0xA3,0xA8,
+            0xA8,0xA9,0x92,0xA9,0xA6,0xA6,0x6B,0xA7,0xA4,0xA8,0x96,0xA8,0xA8,0xA6,0xA8,0xA6,
+            0xA5,0xAA,0x94,0x94,0x8B,0x8C,0x9F,0xA0,0xA7,0xA8,0xA4,0xAA,0xA3,0xA2,0x9F,0x9F,
+            0x98,0x96,0xA5,0x85,0x9E,0x96,0xA7,0xA8,0x99,0x81,0xA9,0x8B,0xA5,0x98,0xA6,0xA6,
+            0x9E,0xAA,0xA9,0xA7,0xAA,0xA9,0xA8,0xA9,0xA4,0xA4,0xA7,0xA5,0xA9,0xA7,0xA8,0xA8,
+            0xA6,0xA7,0xAA,0xA7,0xA7,0xA7,0xA9,0xA6,0xA3,0xA6,0xA2,0xA8,0xA7,0xA4,0xA8,0xA9,
+            0xA7,0x8B,0xA9,0xA7,0xA7,0xA8,0xA4,0xA8,0x9C,0x8B,0x9E,0xA6,0xA6,0xA4,0x80,0x90,
+            0xA3,0x89,0xA6,0x9C,0x8A,0x87,0x9A,0x9E,0xA0,0xA3,0xA6,0xA6,0xA6,0xA6,0xA7,0xA6,
+            0xA1,0x9F,0xA7,0x9B,0xA6,0xA6,0xA5,0xA6,0xA4,0x9B,0xA1,0xA0,0xA5,0x9E,0xA1,0xA4,
+            0xA2,0xA6,0xA2,0x9E,0xA5,0xA2,0xA5,0xA2,0x71,0x86,0xA3,0x8B,0xA1,0x9F,0xA0,0xA1,
+            0x99,0x9D,0x89,0x84,0x9E,0x9B,0x96,0x96,0x95,0x95,0x93,0x90,0x8C,0x85,0x80,0x6E,
+            0x75,0x82,0x88,0x90,0x8C,0x90,0x96,0x98,0x8E,0x99,0x9C,0x9D,0x9D,0x9A,0xA0,0x61,
+            0x9C,0xA2,0xA3,0xA0,0xA3,0x9F,0xA1,0xA3,0x9F,0x9F,0xA4,0x9F,0xA2,0xA2,0xA4,0xA5,
+            0x98,0xA3,0xA7,0xA6,0xA5,0xA0,0xA7,0xA7,0x9F,0xA0,0xA0,0xA4,0x8F,0x81,0xA2,0xA2,
+            0xA2,0x82,0xA6,0xA5,0x9D,0xA5,0xA8,0xA8,0xA2,0x91,0xA6,0x9D,0x86,0xA0,0xA7,0xA7,
+            0x95,0x7A,0x9E,0xA6,0x82,0x7E,0x9F,0xA5,0x6A,0x7C,0x9A,0xA3,0x73,0x85,0x99,0x9E,
+            0x9C,0xA8,0xA6,0x9B,0xA8,0x9B,0xA8,0xA9,0x9F,0x98,0xA5,0x9E,0x9E,0xA3,0xA3,0xA7,
+            0xAA,0xA9,0x80,0xA9,0x93,0xA5,0x71,0xA9,0x9D,0xA5,0xA2,0xA3,0x83,0x9D,0xA4,0x9F,
+            0x8A,0xA8,0xA5,0xA1,0x61,0x71,0xA3,0xA1,0x87,0x92,0xA6,0xA3,0x84,0x9C,0x85,0x8D,
+            0x91,0x95,0xA7,0x87,0x9B,0x8C,0xA9,0xAA,0x9C,0x88,0xA8,0x8D,0xA4,0x8F,0xAB,0xA7,
+            0x97,0xA7,0xA5,0xA5,0xA6,0xA6,0xA8,0xA6,0xA2,0xA4,0xA8,0xA9,0xA4,0xA7,0xA3,0xA6,
+            0xA8,0xAA,0xAA,0xAA,0xA0,0xA8,0xAB,0xA9,0xA2,0xA4,0xA8,0xA4,0x8B,0xA6,0xA9,0xA3,
+            0xA6,0x89,0xA7,0xA4,0xA6,0xA5,0x91,0xA4,0x92,0x9B,0x99,0xA2,0x8F,0x99,0x98,0x9C,
+            0x9A,0x87,0x95,0x92,0x85,0x85,0x94,0x93,0x8B,0x9F,0x9B,0x94,0x9A,0x9D,0x9F,0xA1,
+            0x98,0x94,0xA3,0x9A,0x9C,0x9F,0x96,0xA1,0x7C,0x9A,0x9C,0x9F,0x9D,0x95,0x9D,0x9E,
+            0x97,0x9E,0x9C,0x9A,0x97,0x9B,0x9C,0x9E,0x80,0x78,0x9B,0x79,0x9B,0x9F,0x9C,0x99,
+            0x99,0x90,0x86,0x83,0x9A,0x97,0x93,0x94,0x93,0x95,0x92,0x8F,0x8C,0x85,0x80,0x70,
+            0x70,0x7E,0x7E,0x8C,0x89,0x8B,0x96,0x98,0x8C,0x96,0x98,0x9C,0x99,0x9D,0x9F,0x79,
+            0x96,0xA0,0x9F,0xA2,0xA0,0x9F,0xA1,0xA2,0x9F,0x9E,0xA2,0xA2,0xA6,0xA3,0xA4,0xA5,
+            0x9C,0xA0,0xA8,0xA4,0xA9,0xA6,0xA9,0xA6,0xA6,0xA5,0xA8,0xA5,0xA8,0xA7,0xA7,0xA4,
+            0xA0,0x96,0xA8,0xA1,0xA8,0xA9,0xA9,0xA7,0xA6,0xA2,0xA9,0xA9,0xA6,0xA6,0xAA,0xAA,
+            0x9F,0x86,0xA1,0xA6,0x86,0x8F,0x9C,0xA7,0x77,0x82,0xA3,0xA4,0x83,0x8F,0xA2,0x9A,
+            0x8D,0xA8,0xA3,0xA1,0xA7,0xA4,0xA4,0xA5,0xA1,0xA4,0xA9,0xA2,0xA6,0xA2,0xA5,0xA9,
+            0xA7,0xA7,0x7A,0xAA,0xA5,0xA7,0x71,0xAA,0xA8,0xA4,0xA5,0xAA,0xAA,0xA8,0xA7,0xA7,
+            0xA5,0xAB,0x9E,0x9C,0x81,0x81,0xA1,0xA1,0xA7,0xA7,0xA6,0xA8,0xA7,0xA1,0xA5,0xA1,
+            0x9D,0xA5,0xAA,0x92,0xA1,0x9E,0xA8,0xA7,0xA7,0x92,0xA7,0x95,0xA8,0xA1,0xA7,0xA7,
+            0xA0,0xA9,0xA8,0x9F,0xAA,0xA7,0xA9,0xAA,0xA6,0xA3,0xA9,0xA7,0xAB,0xA9,0xA5,0xA8,
+            0xA7,0xA8,0xAB,0xA7,0xA3,0xA9,0xAB,0xA9,0xA7,0xA4,0xA7,0xA5,0xA8,0xA6,0xA7,0xAC,
+            0xA5,0xA2,0xAB,0xA9,0xAA,0xA5,0x91,0xA9,0xA0,0xA1,0x9E,0xA5,0x93,0xA5,0x98,0xA2,
+            0xA0,0x9A,0xA6,0x99,0x88,0x87,0x9F,0xA0,0x9E,0x9D,0xA1,0xA6,0xA1,0x99,0xA6,0xA5,
+            0x9D,0xA0,0xA8,0xA5,0xA2,0xA7,0xA6,0xA3,0x9F,0xA0,0xA4,0xA4,0xA2,0xA2,0xA4,0xA5,
+            0x9F,0x9F,0xA2,0x9F,0xA2,0xA3,0xA2,0xA1,0x8F,0x88,0xA2,0x90,0xA1,0xA2,0x9F,0xA1,
+            0x9B,0x9C,0x8B,0x89,0x9D,0x9B,0x97,0x97,0x93,0x93,0x92,0x90,0x8C,0x86,0x7F,0x71,
+            0x70,0x82,0x86,0x90,0x8F,0x91,0x94,0x99,0x8D,0x9B,0x9B,0x9F,0x9C,0xA0,0xA0,0x76,
+            0x97,0xA2,0xA2,0xA5,0x9F,0xA1,0xA4,0xA2,0x90,0xA1,0xA6,0xA4,0xA2,0xA5,0xA5,0xA5,
+            0x97,0xA4,0xA7,0xA8,0xA6,0xA6,0xA8,0xA7,0x9E,0xA3,0xA3,0xA7,0xA8,0xA8,0xA4,0xA7,
+            0x9D,0x92,0xA8,0x98,0xA8,0xA9,0xA8,0xAA,0xA1,0x9F,0xA7,0xA8,0xA2,0xA6,0xA8,0xA6,
+            0x91,0x81,0xA3,0xA7,0x84,0x8B,0x9B,0xA6,0x70,0x80,0xA1,0xA4,0x7E,0x8A,0x9B,0xA5,
+            0xA0,0xAA,0xA8,0xA2,0xA7,0xA1,0xA8,0xA6,0xA1,0xA1,0xAA,0xA0,0xA0,0xA7,0xA6,0xA9,
+            0x9D,0x9C,0x7D,0xA9,0xA7,0xA5,0x77,0x98,0xA1,0x9A,0x9F,0x9B,0xA6,0xA2,0xA8,0xA6,
+            0xA5,0x9F,0x8D,0x98,0x7B,0x79,0xA0,0xA2,0xA4,0xA6,0xA9,0xA9,0xA6,0x9F,0xA3,0xA0,
+            0x99,0x9D,0xA8,0x8E,0xA0,0x9C,0xA9,0xAB,0xA2,0x8D,0xA8,0x93,0xA7,0xA0,0xA8,0xA8,
+            0x9D,0xA9,0xA6,0xA9,0xAB,0xA9,0xA8,0xAA,0xA2,0xA5,0xA8,0xA9,0xA5,0xA8,0xA4,0xA6,
+            0xA2,0xAA,0xA8,0xA9,0xA5,0xA8,0xA8,0xA9,0xA5,0xA4,0xA8,0xA7,0xAC,0xA8,0xA8,0xA8,
+            0xA6,0xA4,0xA6,0xA6,0xAA,0xA8,0xA8,0xA6,0x9C,0x9F,0x9F,0xA5,0xA6,0xA6,0x98,0x9F,
+            0xA0,0x93,0xA6,0x9E,0x8A,0x85,0xA0,0x9F,0xA3,0xA5,0xA5,0xA6,0xA2,0xA6,0xA5,0xAA,
+            0x95,0xA2,0xA6,0x9F,0xA0,0xA2,0xA5,0xA7,0x6D,0x89,0x92,0x96,0x9E,0xA0,0xA3,0xA5,
+            0x9E,0xA2,0x9F,0x9F,0xA3,0xA3,0xA4,0xA4,0x88,0x87,0x9E,0x87,0xA1,0x9F,0x9F,0x93,
+            0x9A,0x9C,0x8A,0x7E,0x9C,0x8F,0x90,0x97,0x91,0x91,0x90,0x90,0x8C,0x84,0x7E,0x70,
+            0x74,0x84,0x87,0x90,0x8D,0x95,0x97,0x9A,0x94,0x98,0x9C,0x9E,0x9F,0xA0,0xA0,0x77,
+            0x9E,0xA2,0xA3,0xA2,0xA5,0xA5,0xA4,0xA3,0x9A,0xA0,0xA5,0x9B,0xA6,0xA6,0xA4,0xA4,
+            0x9B,0xA1,0xA6,0xA8,0xA7,0xA4,0xA7,0xA9,0xA7,0x9C,0xA8,0xA6,0xA7,0xA8,0xA3,0xAA,
+            0xA2,0x7B,0xA9,0xA8,0xA5,0xA9,0xA9,0xA6,0xA4,0x9D,0xA6,0xA8,0xA4,0x9B,0xAA,0xA7,
+            0x99,0x7B,0xA1,0xA3,0x7B,0x85,0xA6,0xA4,0x62,0x7A,0x9B,0xA1,0x66,0x86,0xA1,0xA3,
+            0x9B,0xA8,0xA4,0x9F,0xA8,0x9D,0xA8,0xA9,0xA3,0xA8,0xA4,0x85,0xA6,0xA7,0xA9,0xA9,
+            0xA8,0xA9,0x88,0xAA,0xA3,0xA4,0x74,0xA8,0xA6,0xA9,0x96,0xAA,0xA9,0xA8,0xA9,0xA5,
+            0xA4,0xAA,0x99,0x97,0x81,0x84,0xA0,0xA2,0xA5,0xA5,0xAB,0xA9,0xA4,0xA0,0xA4,0xA2,
+            0x9A,0x95,0xA7,0x89,0x9C,0x9A,0xAA,0xA9,0xA0,0x81,0xAB,0x8C,0xA9,0x98,0xAA,0xA7,
+            0x9E,0xAA,0xA8,0xA8,0xAB,0xA8,0xAA,0xAA,0xA7,0xA4,0xA9,0xA9,0xAC,0xAB,0xA6,0xA6,
+            0xA9,0xA8,0xA9,0xA7,0xA4,0xAA,0xA9,0xA9,0xA4,0xA7,0xA6,0xA4,0xA7,0x9E,0xA8,0xA5,
+            0xA7,0xA3,0xA8,0xA7,0xA9,0xAA,0xA5,0xA9,0x9C,0x93,0x83,0xA3,0xA6,0xA3,0xA1,0x83,
+            0xA1,0x7B,0x9A,0x94,0x88,0x89,0x99,0x94,0x9F,0x8D,0x98,0x99,0x9F,0xA3,0xA7,0xA6,
+            0x9F,0x9D,0xA5,0x9C,0xA1,0xA3,0xA7,0xA6,0xA0,0xA2,0xA4,0xA5,0xA5,0xA4,0xA4,0xA4,
+            0x9E,0x98,0x9E,0x9E,0xA2,0xA1,0xA3,0xA3,0x66,0x80,0x9D,0x7F,0xA0,0xA0,0x9F,0x9F,
+            0x9A,0x96,0x8D,0x7E,0x9D,0x99,0x97,0x93,0x93,0x91,0x91,0x8F,0x8D,0x86,0x80,0x6D,
+            0x76,0x83,0x86,0x90,0x91,0x96,0x98,0x99,0x94,0x95,0x9C,0x9C,0x9E,0x9E,0x9D,0x72,
+            0x9D,0xA3,0xA1,0xA2,0xA3,0xA3,0xA1,0xA2,0x9C,0x9C,0xA4,0xA5,0xA6,0xA5,0xA3,0xA3,
+            0x9D,0xA0,0xA7,0xA8,0xA5,0x9F,0xA6,0xAA,0xA6,0x98,0xA9,0xA5,0xA4,0xA5,0xA3,0xA9,
+            0xA4,0x6D,0xA8,0xA6,0xAA,0xA6,0xA9,0xA4,0xA1,0x9A,0xA8,0xA7,0x94,0xA3,0xAA,0xA9,
+            0x95,0x72,0x98,0xA2,0x76,0x7F,0xA5,0xA6,0x5B,0x6E,0x97,0xA2,0x5F,0x83,0xA1,0xA3,
+            0x90,0xA1,0x99,0xA5,0xA8,0x9F,0x99,0xA8,0xA0,0xA9,0xA3,0x6F,0xA5,0xA7,0xA7,0xA7,
+            0xAA,0xA7,0x80,0xAA,0xA0,0xA3,0x74,0xA6,0xA4,0xA7,0x8D,0xAB,0xA0,0xA8,0xA5,0xA7,
+            0xA6,0xAB,0x9C,0x99,0x77,0x85,0x98,0x91,0xA5,0xA8,0xAA,0xA7,0xA2,0xA2,0xA2,0x9F,
+            0x8E,0x96,0xA6,0x80,0x90,0x90,0xAA,0xA9,0x92,0x75,0xA6,0x84,0xA3,0x90,0xA8,0xA9,
+            0x9C,0xA8,0xA6,0xA9,0xAB,0xAB,0xAB,0xAA,0x9A,0xA6,0xA6,0xAA,0xA9,0x9D,0xA4,0xA5,
+            0xA7,0xA8,0xA9,0xA7,0xA5,0xAA,0xA9,0xA9,0xA5,0xA8,0xA7,0xA5,0xA6,0xA8,0xA7,0xA7,
+            0xA8,0xA5,0xA7,0xA8,0xA5,0xA9,0xAB,0xA8,0x99,0x89,0x7A,0x9D,0xA7,0x9B,0x6D,0xA2,
+            0x99,0x8A,0xA0,0x9D,0x87,0x89,0x8B,0x86,0x9C,0x9F,0xA1,0xA1,0xA1,0x9B,0xA3,0x9F,
+            0x9D,0x98,0xA4,0x97,0xA0,0xA1,0xA1,0xA1,0xA2,0xA2,0xA2,0xA1,0xA3,0xA0,0xA3,0xA4,
+            0x9B,0xA2,0xA2,0x9E,0xA2,0xA3,0xA2,0xA3,0x4F,0x80,0x9C,0x83,0xA1,0x9E,0xA0,0x9D,
+            0x9C,0x8F,0x86,0x7E,0x99,0x9B,0x95,0x91,0x93,0x95,0x93,0x90,0x8D,0x85,0x7F,0x62,
+            0x5C,0x64,0x6C,0x68,0x64,0x6C,0x70,0x6E,0x72,0x80,0x80,0x88,0x7E,0x86,0x89,0x65,
+            0x71,0x8E,0x87,0x93,0x8A,0x8F,0x90,0x92,0x85,0x94,0x90,0x8D,0x91,0x8C,0x92,0x7A,
+            0x7D,0x97,0x9E,0x94,0x90,0x97,0xA2,0xA2,0x9A,0x98,0x9C,0xA1,0x9C,0xA1,0x9E,0x9E,
+            0x91,0x81,0x9D,0x91,0x9E,0xA3,0xA1,0xA2,0x98,0x91,0x9F,0xA1,0x92,0x97,0x9D,0x80,
+            0x8F,0x73,0x97,0x9D,0x79,0x82,0x9E,0xA2,0x61,0x74,0x94,0x99,0x71,0x80,0x94,0x9E,
+            0x96,0xA3,0xA3,0x9C,0xA5,0x9E,0x9F,0x9C,0x93,0x9F,0xA2,0x78,0x9C,0x92,0xA3,0xA7,
+            0x90,0xA4,0x82,0xA8,0xA0,0xA5,0x68,0xA5,0xA3,0xA3,0x9C,0xA5,0xA9,0xA7,0x9F,0xA6,
+            0x86,0xA8,0x8F,0x8E,0x87,0x84,0x9D,0x9B,0x94,0x9E,0xA3,0xA6,0x9D,0x9F,0x9B,0x83,
+            0x84,0x93,0xA8,0x7E,0x9C,0x8E,0x9D,0x9E,0x94,0x7E,0xA0,0x86,0xA3,0x91,0xA6,0x9D,
+            0x88,0xA6,0xA4,0xA5,0xA9,0xA8,0xA3,0xA6,0xA3,0xA1,0xA6,0xA7,0xA5,0x9E,0x9E,0x9C,
+            0xA6,0xA7,0xA8,0x9E,0xA2,0xA4,0xA7,0xA5,0x96,0x8C,0xA4,0xA5,0xA5,0xA4,0xA5,0xA6,
+            0xA4,0x99,0xA3,0xA6,0xA4,0x9F,0xA8,0xA6,0x93,0x8D,0x8E,0xA0,0xA6,0xA1,0x92,0x93,
+            0x8D,0x89,0xA4,0x93,0x79,0x7E,0x96,0x8F,0xA2,0xA4,0xA3,0xA2,0xA2,0x89,0xA6,0x9D,
+            0xA0,0x9C,0xA2,0x95,0xA2,0xA2,0xA2,0xA0,0xA2,0x99,0xA4,0x99,0xA4,0x9D,0x9E,0x8C,
+            0x90,0x9F,0xA1,0x98,0xA0,0x9D,0x9F,0x9A,0x81,0x81,0x9F,0x88,0x9F,0x9C,0x9E,0x8F,
+            0x76,0x97,0x85,0x7F,0x91,0x90,0x8F,0x83,0x75,0x8B,0x86,0x7E,0x79,0x77,0x6F,0x66,
+            0x70,0x71,0x79,0x74,0x6C,0x77,0x7A,0x76,0x7E,0x8F,0x89,0x8E,0x87,0x8C,0x90,0x70,
+            0x7F,0x95,0x90,0x98,0x91,0x93,0x94,0x94,0x8D,0x9B,0x97,0x8F,0x95,0x9C,0x90,0x82,
+            0x86,0xA1,0xA0,0x9E,0xA3,0xA1,0xA4,0xA5,0xA0,0x9B,0xA1,0xA3,0xA5,0xA4,0xA2,0xA3,
+            0x94,0x88,0xA5,0x9F,0xA2,0xA6,0xA8,0xA6,0x9B,0x9E,0xA4,0xA7,0xA1,0xA0,0xA5,0x86,
+            0x93,0x7C,0x9F,0xA5,0x82,0x84,0xA5,0xA5,0x69,0x7A,0x9F,0xA2,0x76,0x7B,0x99,0xA3,
+            0x9C,0xA6,0xA0,0x9D,0xA4,0x88,0xA4,0x9C,0xA1,0x9E,0xA9,0x9A,0xA3,0x83,0xA7,0xA5,
+            0x98,0x98,0x80,0xAA,0xA8,0x8D,0x75,0xA5,0xA3,0x9B,0x94,0xA5,0xA4,0x85,0xA8,0xA7,
+            0x8B,0xA5,0x95,0x9A,0x99,0x88,0x9E,0xA2,0x97,0xA4,0xA7,0xA9,0x99,0x7B,0x6A,0x8F,
+            0x8A,0x99,0xA6,0x8D,0xA1,0x9A,0x9E,0xA7,0xA3,0x86,0xA9,0x8F,0xA7,0x9C,0xA9,0xA3,
+            0x95,0xA8,0xA1,0xA7,0xA9,0xA7,0xAA,0xA6,0xAA,0xA3,0xA8,0xA5,0xA6,0xA7,0xA5,0x92,
+            0xA3,0xA9,0xA9,0xA6,0xA0,0xA9,0xA9,0xA7,0xA8,0xA8,0xA7,0xA5,0xA6,0xA5,0xA7,0xA8,
+            0x9D,0x9A,0xA2,0xA5,0xA9,0xA3,0x9B,0xAA,0x8B,0x9B,0x6B,0xA0,0xA6,0xA4,0x85,0x9A,
+            0x92,0x95,0xA6,0x9A,0x87,0x89,0x9D,0x98,0xA5,0xA9,0xA6,0xA7,0xA4,0xA5,0xA4,0xA2,
+            0xA2,0xA4,0xA4,0x94,0xA4,0xA5,0xA2,0xA6,0xA1,0x97,0xA2,0x95,0xA3,0xA3,0xA2,0x95,
+            0x94,0xA4,0xA2,0x9E,0xA1,0x9E,0xA5,0xA1,0x7D,0x8D,0xA0,0x92,0xA0,0x9F,0xA0,0x94,
+            0x8B,0x9D,0x87,0x84,0x9B,0x92,0x93,0x91,0x83,0x8A,0x91,0x89,0x83,0x80,0x79,0x69,
+            0x6F,0x6F,0x73,0x71,0x6A,0x77,0x79,0x78,0x79,0x88,0x88,0x8E,0x85,0x8B,0x8E,0x70,
+            0x7D,0x94,0x8F,0x96,0x91,0x8D,0x97,0x92,0x8D,0x97,0x97,0x8F,0x94,0x90,0x97,0x7F,
+            0x84,0x9F,0xA2,0x9A,0xA1,0x9A,0xA4,0xA4,0x9F,0x9B,0xA3,0xA4,0xA1,0x98,0x9E,0xA6,
+            0x94,0x82,0xA4,0x9F,0xA3,0x99,0xA3,0xA8,0x9C,0x97,0xA5,0xA5,0x9C,0x92,0xA2,0x85,
+            0x8F,0x7E,0xA0,0xA3,0x7E,0x84,0xA2,0xA7,0x66,0x7D,0x9A,0xA1,0x6F,0x82,0x98,0xA4,
+            0x9C,0x9C,0xA6,0x9D,0xA8,0x8A,0xA4,0xA7,0x98,0x98,0xA5,0x91,0x9E,0x88,0xA3,0xA9,
+            0x9C,0x8F,0x85,0xA8,0xA5,0x82,0x6D,0xA8,0xA4,0x91,0x96,0xA9,0xA8,0x8A,0xA8,0xA5,
+            0x90,0x90,0x9B,0x9C,0x95,0x85,0xA2,0xA3,0x9C,0x6C,0xA8,0xA8,0xA3,0x6F,0xA2,0x8A,
+            0x8E,0x99,0xA6,0x87,0xA1,0x92,0xA4,0xA4,0x9D,0x7E,0xA9,0x8E,0xA6,0x96,0xA8,0xA0,
+            0x90,0xA7,0xA6,0xA9,0xA9,0xA8,0xA9,0xA8,0xA9,0xA5,0xA7,0xA8,0xA5,0xA7,0xA5,0x9F,
+            0xA8,0xA7,0xA9,0xA5,0xA4,0xA7,0xA9,0xA7,0xA6,0xA7,0xA1,0xA6,0xA5,0xA7,0xA7,0xAC,
+            0xA4,0x9E,0xA5,0xA4,0xA6,0xA5,0xA1,0xAA,0x9B,0x8B,0x9F,0xA4,0xA6,0xA4,0x7B,0x91,
+            0x8E,0x8D,0xA2,0x99,0x8A,0x88,0x91,0x91,0xA1,0xA2,0xA3,0xA2,0xA1,0xA1,0x9F,0x99,
+            0xA3,0x9C,0xA5,0x9B,0xA3,0x95,0xA2,0x9A,0xA2,0x9A,0xA2,0xA2,0xA3,0x9D,0x9F,0x8D,
+            0x92,0x93,0xA2,0x9D,0xA1,0x8B,0x9E,0x98,0x73,0x87,0xA0,0x8F,0x9F,0x92,0x9E,0x92,
+            0x87,0x90,0x8D,0x81,0x9A,0x8E,0x95,0x88,0x80,0x8E,0x8A,0x89,0x81,0x7D,0x79,0x68,
+            0x6A,0x7A,0x7C,0x7C,0x74,0x7E,0x7A,0x87,0x87,0x94,0x92,0x97,0x8D,0x95,0x9A,0x77,
+            0x8B,0x9B,0x99,0xA2,0x9A,0x9C,0xA0,0xA0,0x99,0x9C,0x9C,0x9B,0x9D,0x9F,0xA0,0x8D,
+            0x8C,0xA4,0xA4,0xA5,0xA3,0xA2,0xA6,0xA6,0xA0,0xA3,0xA5,0xA4,0xA7,0xA6,0xA1,0xA7,
+            0x9A,0x94,0xA6,0xA4,0xA5,0xA3,0xA7,0xA9,0x91,0x9F,0xA7,0xA4,0xA4,0x9E,0xA8,0x92,
+            0x99,0x86,0xA2,0xA6,0x87,0x86,0xA8,0xA7,0x75,0x7F,0xA2,0xA3,0x82,0x84,0x94,0xA4,
+            0xA2,0xA0,0xA5,0xA7,0xA8,0x8B,0xA8,0xA7,0x8E,0x98,0xA4,0x9F,0x9F,0x84,0xA2,0xAA,
+            0x9B,0x9B,0x88,0xA8,0xA6,0x87,0x7A,0xA7,0xA7,0x97,0xA7,0xAC,0xAB,0x89,0xAB,0xA5,
+            0xA2,0x91,0x90,0x93,0x86,0x7C,0xA2,0xA2,0xA4,0x7A,0xA9,0x99,0xA4,0x75,0xA8,0x90,
+            0x97,0xA1,0xAA,0x90,0xA5,0x9F,0xAA,0xAA,0xA8,0x91,0xA8,0x95,0xA6,0xA0,0xA8,0xA6,
+            0x96,0xA6,0xA5,0xA9,0xAB,0xAA,0xA7,0xA9,0xA9,0xA3,0xA8,0xA8,0xA7,0xA9,0xAA,0xA7,
+            0xA6,0xA5,0xA9,0xAA,0xA2,0x98,0xAB,0xA8,0xA6,0xA2,0xA5,0xA7,0xAB,0xA7,0xA9,0xA8,
+            0xA6,0x98,0xAB,0xA9,0xA7,0xA6,0x99,0xA7,0x9A,0xA0,0x9C,0xA5,0xA6,0xA4,0x9D,0x9C,
+            0x9C,0x90,0xA5,0x99,0x90,0x8B,0x9F,0x9F,0xA0,0xA5,0xA6,0xA5,0xA3,0xA2,0xA5,0xA4,
+            0xA3,0xA2,0xA6,0x94,0xA5,0xA3,0xA4,0xA7,0xA5,0x9E,0xA4,0xA4,0xA4,0xA4,0xA3,0xA1,
+            0x9A,0xA1,0xA4,0xA3,0xA4,0xA0,0xA3,0xA2,0x8C,0x8A,0xA1,0x88,0xA1,0xA0,0xA3,0x9D,
+            0x93,0x9C,0x8C,0x8A,0x9D,0x9A,0x97,0x96,0x88,0x7A,0x91,0x8E,0x86,0x7C,0x7E,0x6C,
+            0x6D,0x7C,0x7E,0x82,0x7D,0x83,0x88,0x8E,0x8C,0x94,0x92,0x96,0x90,0x98,0x98,0x66,
+            0x80,0xA0,0x9E,0xA1,0x99,0xA0,0xA0,0xA0,0x9D,0xA0,0xA2,0x9E,0x9E,0xA0,0x9F,0x94,
+            0x92,0xA3,0xA6,0xA7,0xA3,0xA1,0xA8,0xA7,0xA4,0xA4,0xA4,0xA6,0xA7,0xA6,0xA0,0xA4,
+            0x9D,0x85,0xA9,0xA5,0xA8,0xA5,0xA3,0xA7,0xA3,0x9A,0xA5,0xA2,0xA0,0xA3,0xA7,0x9B,
+            0x87,0x80,0x9D,0xA2,0x86,0x82,0xA3,0xA4,0x70,0x83,0x9B,0x9B,0x7A,0x8A,0x9A,0xA1,
+            0x9F,0xA4,0xA7,0x9B,0xA7,0x8D,0xA9,0xA9,0xA1,0xA4,0xA7,0x97,0xA6,0xA2,0xA6,0xA7,
+            0xA3,0xA3,0x7D,0xAA,0x9D,0xA5,0x75,0xA7,0xA4,0xA6,0xA7,0xAC,0xA8,0xA8,0xA9,0xA9,
+            0xA5,0xA7,0xA6,0xA5,0x6B,0x7B,0xA9,0xA5,0x97,0x9A,0xA8,0xAA,0xA5,0xA5,0x8E,0x8F,
+            0x8E,0xA2,0xA8,0x87,0xA0,0x91,0xAA,0xA7,0x9B,0x8C,0xAA,0x8E,0xA3,0x9C,0xA7,0xA7,
+            0x9A,0xA8,0xA3,0xA8,0xA8,0xA8,0xA8,0xAB,0xA6,0xA8,0xA9,0xA9,0xA9,0xA8,0xA7,0xA3,
+            0x9F,0xAA,0xAB,0xA9,0xA5,0xA8,0xA6,0xA7,0xA5,0xA1,0xA6,0xA5,0xA8,0xA4,0xA9,0x9F,
+            0xA8,0x93,0xA5,0xA8,0xA7,0xA7,0xA0,0xA4,0x97,0x9C,0x94,0x9C,0xA8,0x9E,0x99,0x98,
+            0x97,0x97,0xA6,0x96,0x7D,0x82,0x9D,0x97,0xA4,0xA7,0xA5,0xA6,0xA5,0xA5,0xA8,0xA1,
+            0xA4,0xA4,0xA7,0xA1,0xA3,0xA5,0xA6,0xA6,0x74,0xA2,0xA5,0xA3,0xA6,0xA6,0xA4,0x9D,
+            0x89,0xA0,0xA3,0x9D,0x9C,0xA0,0xA4,0xA3,0x84,0x7B,0xA1,0x82,0xA0,0xA1,0xA1,0xA0,
+            0x7D,0x9D,0x8D,0x87,0x9B,0x9A,0x96,0x91,0x8F,0x95,0x90,0x8D,0x8A,0x82,0x7D,0x6B,
+            0x70,0x7B,0x7C,0x7B,0x73,0x7E,0x7E,0x89,0x86,0x96,0x95,0x99,0x92,0x97,0x9A,0x75,
+            0x8A,0x9E,0x9A,0x9F,0x99,0x9D,0xA2,0xA1,0x97,0xA3,0x9E,0x9F,0xA2,0xA1,0xA0,0x8F,
+            0x8D,0xA5,0xA6,0xA6,0xA7,0xA5,0xA7,0xA8,0x9E,0xA1,0xA7,0xA8,0xA5,0xA6,0xA3,0xA7,
+            0x9D,0x8F,0xA5,0xA6,0xA5,0xA4,0xA6,0xA9,0xA2,0xA0,0xA5,0xA7,0x9F,0xA5,0xA7,0x8E,
+            0x93,0x6B,0x9E,0xA5,0x84,0x8B,0xA8,0xA7,0x70,0x7E,0x9E,0xA3,0x7B,0x85,0x9E,0xA7,
+            0xA5,0xA6,0xA3,0x86,0xA7,0xA3,0x9E,0xA4,0x9F,0xA0,0xA6,0x9C,0xA5,0x90,0xA9,0xA9,
+            0x9D,0x9D,0x7C,0xAA,0xA5,0xA7,0x76,0xA1,0xA0,0x9B,0x94,0x9E,0xA4,0xA1,0xA9,0xA8,
+            0xA5,0x9C,0x89,0x94,0x84,0x85,0xA3,0xA4,0xA3,0xA6,0xAB,0xAA,0xA3,0xA3,0xA4,0x93,
+            0x93,0xA2,0xA6,0x8C,0xA0,0x9E,0xA9,0xAD,0x96,0x8E,0xA7,0x92,0xA8,0x9E,0xAA,0xA6,
+            0x99,0xA8,0xA4,0xA2,0xAB,0xA7,0xAC,0xAB,0xA6,0xA8,0xA8,0xAA,0xA7,0xAB,0xA7,0xA5,
+            0xA5,0xA8,0xA9,0xA9,0xA4,0xAA,0xAA,0xA8,0xA6,0x9F,0xA8,0xA8,0xA9,0xA6,0xA6,0xA9,
+            0xA3,0x9D,0xA6,0xA5,0xA8,0xA7,0x9D,0xA0,0x8E,0x9E,0x8F,0xA7,0xA5,0xA6,0x9F,0x9F,
+            0x99,0x99,0xA9,0x9C,0x88,0x89,0xA1,0x9E,0xA6,0xA8,0xA1,0xA6,0xA7,0xA3,0xA4,0xA2,
+            0xA4,0xA5,0xA6,0xA0,0x9E,0xA5,0xA6,0xA5,0xA4,0xA2,0xA3,0x9F,0xA3,0xA3,0xA2,0x9D,
+            0x9C,0xA2,0x9D,0xA0,0xA3,0xA2,0xA4,0xA4,0x80,0x80,0x9F,0x88,0xA0,0x9E,0x9F,0x96,
+            0x93,0x9E,0x89,0x86,0x9C,0x90,0x8D,0x94,0x88,0x91,0x91,0x8E,0x87,0x83,0x7B,0x6B,
+            0x72,0x74,0x78,0x72,0x6F,0x7B,0x84,0x80,0x84,0x8C,0x8F,0x90,0x8B,0x8F,0x8E,0x74,
+            0x83,0x97,0x93,0x9A,0x96,0x96,0x9B,0x98,0x92,0x9E,0x97,0x95,0x99,0x9E,0x99,0x81,
+            0x88,0xA4,0xA6,0xA0,0xA5,0xA2,0xA6,0xA7,0xA1,0x9E,0xA1,0xA4,0xA2,0xA8,0xA3,0xA4,
+            0x97,0x7F,0xA8,0xA5,0xA7,0xA9,0xA5,0xA8,0xA0,0x9B,0xA7,0xA6,0xA1,0x9B,0xA7,0x88,
+            0x95,0x7D,0x9D,0xA5,0x80,0x89,0xA5,0xA5,0x61,0x7C,0x9F,0xA0,0x6A,0x88,0xA4,0xA7,
+            0x9D,0xA4,0xA5,0x98,0xA7,0x9C,0xA7,0xA5,0xA7,0xA7,0xA4,0x8E,0xA7,0x9D,0xA8,0xA5,
+            0x9F,0xAA,0x8F,0xAB,0xA3,0xA6,0x7A,0xA8,0xA5,0xAA,0x9E,0xA9,0xA8,0xA6,0xA9,0xA7,
+            0x9C,0xA9,0x9E,0x9D,0x8D,0x8B,0xA2,0xA1,0xA5,0xA4,0xAC,0xAA,0xA1,0xA2,0x9F,0x8A,
+            0x93,0x9B,0xA8,0x8A,0x99,0x98,0xA5,0xAC,0xA0,0x80,0xA9,0x8C,0xA8,0x9A,0xA8,0xA6,
+            0x9E,0xA9,0xA3,0xAB,0xA8,0xA8,0xA9,0xAC,0xA8,0xA7,0xA9,0xA9,0xA8,0xA9,0xA7,0xA2,
+            0xA4,0xA6,0xA7,0xA9,0xA5,0xA9,0xA7,0xA9,0xA7,0xA8,0xA5,0xA4,0xA6,0xA5,0xA8,0xAB,
+            0xA4,0x97,0xA5,0xA8,0xA8,0xA6,0xA8,0xAB,0x9D,0x8F,0x84,0xA3,0xA6,0xA8,0xA1,0x8B,
+            0x92,0x8C,0xA5,0x9B,0x90,0x8D,0x99,0x92,0xA4,0xA1,0xA5,0xA6,0xA8,0xA5,0xA6,0xA5,
+            0xA5,0xA0,0xA4,0xA0,0xA4,0xA7,0xA8,0xA5,0xA5,0xA5,0xA5,0xA1,0xA4,0xA3,0xA6,0x9F,
+            0x9B,0xA5,0xA5,0xA0,0xA2,0xA5,0xA3,0xA3,0x69,0x87,0xA2,0x89,0xA2,0xA0,0xA0,0x9C,
+            0x8C,0x9C,0x90,0x88,0x9C,0x9B,0x96,0x90,0x82,0x94,0x91,0x8B,0x81,0x82,0x7C,0x68,
+            0x75,0x79,0x7D,0x78,0x70,0x7E,0x81,0x81,0x88,0x90,0x94,0x96,0x91,0x98,0x99,0x74,
+            0x88,0x9E,0x98,0x98,0x9A,0x9C,0x9D,0x9F,0x98,0x9C,0x9D,0x98,0x9B,0xA0,0xA0,0x8A,
+            0x8E,0xA4,0xA8,0xA3,0xA5,0xA4,0xA6,0xA6,0xA3,0x9D,0xA6,0xA7,0xA6,0xA8,0xA2,0xA7,
+            0x9C,0x7A,0xA9,0xA5,0xA8,0xA8,0xA7,0xA9,0xA0,0x9E,0xA7,0xA2,0xA4,0xA0,0xA8,0x8F,
+            0x95,0x76,0xA0,0xA5,0x7B,0x83,0xA6,0xA3,0x61,0x77,0x9A,0xA0,0x68,0x83,0xA2,0xA5,
+            0x93,0xA5,0x9F,0x98,0xA7,0xA0,0xA6,0xA7,0xA6,0xA7,0xA2,0x82,0xA7,0x89,0xA7,0xA8,
+            0xA1,0xA9,0x8D,0xAD,0x9D,0xA6,0x79,0xA9,0xA6,0xA9,0x96,0xA6,0xA9,0xA6,0xAA,0xA7,
+            0x9E,0xAB,0x9E,0x9D,0x7C,0x8E,0xA3,0xA3,0xA6,0xA4,0xA8,0xAA,0xA5,0xA4,0xA7,0x96,
+            0x96,0x9F,0xA3,0x86,0x9A,0x98,0xA8,0xA9,0x99,0x79,0xAA,0x89,0xA8,0x95,0xAD,0xA8,
+            0xA1,0xAA,0xA5,0xA9,0xA6,0xA8,0xA7,0xA8,0xA9,0xA5,0xA8,0xA9,0xA7,0xA8,0xA9,0xA7,
+            0xA3,0xA8,0xAA,0xA8,0xA2,0xA8,0xA9,0xA8,0xA6,0xA6,0xA8,0xA8,0xA6,0xA6,0xAB,0xA7,
+            0xA5,0x9C,0xA8,0xA8,0xA6,0xA7,0x99,0xA9,0x9D,0x89,0x7D,0x97,0xA7,0x9E,0x78,0xA4,
+            0x98,0x92,0xA9,0x9D,0x93,0x91,0x94,0x8F,0xA5,0xA6,0xAA,0xA7,0xA4,0xA5,0xA9,0xA6,
+            0xA4,0xA4,0xA9,0x9A,0xA7,0xA5,0xA5,0xA2,0xA4,0xA3,0xA6,0xA5,0xA8,0xA6,0xA6,0xA0,
+            0x9C,0xA3,0xA6,0x9D,0xA4,0xA5,0xA4,0xA3,0x59,0x86,0xA2,0x83,0x9F,0x9F,0xA1,0x9E,
+            0x91,0x9F,0x8C,0x84,0x9D,0x9D,0x98,0x8E,0x7A,0x94,0x91,0x8E,0x84,0x84,0x7D,0x65,
+            0x5D,0x5F,0x67,0x69,0x68,0x6C,0x6D,0x6F,0x6C,0x70,0x70,0x70,0x70,0x72,0x71,0x67,
+            0x6F,0x71,0x72,0x71,0x70,0x72,0x72,0x72,0x70,0x72,0x72,0x71,0x72,0x72,0x72,0x71,
+            0x6C,0x71,0x72,0x71,0x71,0x72,0x72,0x72,0x71,0x72,0x72,0x71,0x72,0x73,0x72,0x72,
+            0x70,0x6F,0x73,0x72,0x72,0x72,0x72,0x72,0x71,0x71,0x72,0x71,0x72,0x72,0x72,0x71,
+            0x71,0x6B,0x72,0x72,0x6D,0x6F,0x72,0x72,0x5C,0x6A,0x72,0x71,0x67,0x6F,0x72,0x73,
+            0x72,0x72,0x72,0x72,0x72,0x73,0x72,0x72,0x71,0x72,0x73,0x69,0x72,0x71,0x72,0x72,
+            0x72,0x72,0x70,0x72,0x71,0x73,0x6A,0x72,0x71,0x72,0x72,0x71,0x72,0x73,0x72,0x73,
+            0x72,0x72,0x72,0x71,0x6F,0x70,0x72,0x72,0x71,0x73,0x73,0x71,0x72,0x72,0x72,0x72,
+            0x70,0x71,0x73,0x6C,0x72,0x71,0x72,0x72,0x71,0x6E,0x73,0x6F,0x72,0x72,0x72,0x73,
+            0x72,0x72,0x72,0x72,0x72,0x73,0x72,0x72,0x71,0x72,0x73,0x71,0x72,0x73,0x72,0x72,
+            0x72,0x72,0x72,0x72,0x72,0x72,0x72,0x72,0x71,0x72,0x73,0x71,0x72,0x73,0x72,0x72,
+            0x72,0x72,0x73,0x72,0x72,0x73,0x72,0x73,0x71,0x71,0x72,0x71,0x72,0x73,0x71,0x72,
+            0x72,0x6F,0x73,0x72,0x6F,0x70,0x72,0x72,0x71,0x73,0x73,0x71,0x72,0x72,0x72,0x72,
+            0x72,0x72,0x72,0x72,0x72,0x73,0x72,0x72,0x71,0x72,0x73,0x71,0x73,0x73,0x72,0x73,
+            0x72,0x72,0x73,0x72,0x72,0x73,0x72,0x72,0x6D,0x6E,0x73,0x6F,0x72,0x73,0x72,0x72,
+            0x71,0x72,0x71,0x6C,0x72,0x72,0x72,0x71,0x71,0x72,0x71,0x70,0x70,0x6F,0x6C,0x64,
+            0x6F,0x70,0x71,0x6F,0x74,0x77,0x76,0x79,0x77,0x79,0x7A,0x79,0x7A,0x7A,0x7B,0x73,
+            0x72,0x7B,0x7B,0x7A,0x7A,0x7B,0x7A,0x7B,0x7A,0x7B,0x7B,0x79,0x7B,0x7B,0x7B,0x7A,
+            0x72,0x7B,0x7B,0x7B,0x7B,0x7A,0x7B,0x7A,0x7B,0x7A,0x7B,0x7A,0x7B,0x7B,0x7B,0x7B,
+            0x74,0x76,0x7A,0x79,0x7B,0x7B,0x7B,0x7B,0x7B,0x79,0x7B,0x79,0x7A,0x7A,0x7A,0x7A,
+            0x75,0x73,0x7B,0x7A,0x74,0x75,0x79,0x7A,0x63,0x72,0x7B,0x79,0x6A,0x73,0x7A,0x7B,
+            0x75,0x7A,0x7B,0x7A,0x7B,0x7A,0x7A,0x7A,0x7A,0x79,0x7B,0x78,0x7B,0x7B,0x7A,0x7A,
+            0x75,0x7A,0x77,0x79,0x79,0x7A,0x6B,0x7A,0x7A,0x7A,0x79,0x78,0x7A,0x7A,0x7A,0x7A,
+            0x74,0x7A,0x7A,0x78,0x78,0x78,0x79,0x78,0x7A,0x7A,0x7A,0x78,0x7A,0x7D,0x7D,0x7D,
+            0x73,0x7C,0x7D,0x78,0x7C,0x7B,0x7C,0x7D,0x7C,0x77,0x7D,0x79,0x7D,0x7B,0x7D,0x7D,
+            0x76,0x7D,0x7D,0x7C,0x7C,0x7D,0x7D,0x7C,0x7C,0x7C,0x7D,0x7A,0x7D,0x7D,0x7D,0x7D,
+            0x76,0x7D,0x7D,0x7C,0x7C,0x7D,0x7C,0x7D,0x7C,0x7D,0x7D,0x7B,0x7D,0x7D,0x7C,0x7D,
+            0x76,0x7D,0x7D,0x7C,0x7C,0x7D,0x7C,0x7C,0x7A,0x7C,0x70,0x7B,0x7D,0x7D,0x76,0x7C,
+            0x76,0x7A,0x7C,0x7B,0x7A,0x7A,0x7B,0x7B,0x7D,0x7C,0x7D,0x7A,0x7D,0x7D,0x7C,0x7B,
+            0x76,0x7C,0x7C,0x7A,0x7C,0x7C,0x7C,0x7C,0x7B,0x7C,0x7C,0x7A,0x7D,0x7B,0x7B,0x7C,
+            0x75,0x7C,0x7C,0x7B,0x7B,0x7C,0x7C,0x7C,0x73,0x78,0x7C,0x78,0x7C,0x7C,0x7B,0x7B,
+            0x76,0x7C,0x79,0x77,0x7B,0x7C,0x7A,0x7A,0x7B,0x7B,0x7B,0x78,0x79,0x78,0x75,0x67,
+            0x76,0x70,0x78,0x76,0x73,0x7F,0x82,0x85,0x83,0x81,0x8F,0x91,0x8F,0x90,0x92,0x77,
+            0x85,0x99,0x96,0x9B,0x95,0x96,0x9E,0x9A,0x8E,0x9E,0x97,0x9A,0x9B,0x98,0x97,0x8C,
+            0x7A,0x98,0x9F,0x9B,0xA0,0x98,0xA2,0x99,0x9A,0x94,0xA2,0x9D,0xA3,0x9F,0xA2,0x9C,
+            0x8F,0x7E,0x9F,0x90,0xA0,0xA4,0xA2,0xA4,0x99,0x8C,0x9D,0xA0,0x9D,0x99,0x9C,0x92,
+            0x97,0x7A,0x9F,0x9D,0x78,0x82,0xA2,0xA4,0x63,0x7B,0x9A,0xA0,0x68,0x86,0x9F,0xA5,
+            0x9A,0xA2,0xA5,0x97,0xA4,0x9D,0xA1,0xA3,0x98,0x95,0xA8,0x8F,0x9D,0x9A,0x9D,0xA4,
+            0x9F,0xA4,0x88,0xA7,0xA0,0xA6,0x72,0xA6,0xA4,0xA7,0x93,0xA9,0xA2,0xA4,0xA8,0xA5,
+            0xA3,0xA7,0x95,0x93,0x8D,0x8D,0x9D,0xA2,0xA7,0xA4,0xA7,0xAA,0xA4,0xA3,0xA0,0xA1,
+            0x89,0x96,0xA6,0x7F,0x9E,0x8E,0xA9,0xAA,0x9A,0x7E,0xA6,0x8B,0xA7,0x94,0xA7,0xA7,
+            0x9B,0xA6,0xA9,0xA7,0xA8,0xA7,0xA7,0xA9,0xA7,0xA7,0xA7,0xA9,0xA8,0xA8,0xA6,0xA6,
+            0xA3,0xA6,0xA8,0xA8,0xA4,0xAA,0xA7,0xA8,0xA3,0xA5,0xA5,0xA7,0xA8,0xA7,0xA7,0xA7,
+            0xA7,0xA8,0xA9,0xA9,0xA7,0xA8,0xA3,0xA9,0x9C,0x87,0xA0,0xA4,0xA8,0xA4,0x78,0x92,
+            0x99,0x88,0x9C,0x93,0x88,0x81,0x98,0x8F,0xA4,0xA2,0xA7,0xA1,0xA2,0x99,0xA4,0xA2,
+            0x91,0x9E,0x9E,0x97,0xA6,0x94,0xA6,0x9B,0xA2,0x9F,0xA2,0xA0,0xA3,0xA0,0x85,0x9A,
+            0xA3,0xA2,0xA3,0x9C,0xA3,0xA5,0xA2,0xA1,0x6D,0x84,0xA1,0x8A,0xA0,0x9F,0xA0,0x9F,
+            0x9A,0x9D,0x8D,0x83,0x9D,0x9B,0x95,0x94,0x94,0x95,0x92,0x91,0x8D,0x86,0x7C,0x67,
+            0x74,0x78,0x73,0x77,0x79,0x78,0x7F,0x7D,0x7A,0x7B,0x7A,0x7A,0x7B,0x77,0x78,0x6F,
+            0x75,0x7A,0x7A,0x79,0x7A,0x79,0x7B,0x7C,0x7A,0x7B,0x7C,0x7F,0x7E,0x7F,0x80,0x7F,
+            0x7C,0x80,0x80,0x81,0x81,0x81,0x82,0x82,0x83,0x83,0x84,0x84,0x82,0x85,0x84,0x85,
+            0x84,0x83,0x86,0x86,0x84,0x87,0x86,0x86,0x87,0x85,0x86,0x86,0x88,0x87,0x88,0x88,
+            0x88,0x7E,0x89,0x89,0x7D,0x83,0x89,0x8C,0x6F,0x79,0x8A,0x8C,0x78,0x81,0x88,0x89,
+            0x8D,0x88,0x8C,0x8C,0x8D,0x8D,0x8E,0x8E,0x86,0x8A,0x8E,0x8C,0x8D,0x8F,0x8C,0x8F,
+            0x8E,0x8F,0x87,0x91,0x8F,0x91,0x79,0x90,0x90,0x8F,0x8D,0x92,0x8D,0x90,0x8F,0x90,
+            0x8F,0x90,0x87,0x89,0x7C,0x79,0x8F,0x91,0x91,0x92,0x8F,0x92,0x91,0x8F,0x91,0x92,
+            0x83,0x86,0x88,0x81,0x84,0x7D,0x85,0x85,0x86,0x80,0x86,0x81,0x85,0x84,0x84,0x85,
+            0x83,0x84,0x85,0x84,0x84,0x86,0x83,0x85,0x83,0x85,0x84,0x84,0x85,0x85,0x83,0x85,
+            0x85,0x85,0x85,0x84,0x84,0x85,0x82,0x82,0x84,0x83,0x85,0x84,0x82,0x84,0x82,0x83,
+            0x85,0x84,0x84,0x82,0x84,0x85,0x82,0x85,0x82,0x82,0x83,0x84,0x85,0x84,0x81,0x84,
+            0x83,0x7B,0x7F,0x81,0x80,0x7D,0x7F,0x80,0x80,0x82,0x7F,0x82,0x83,0x82,0x80,0x82,
+            0x82,0x83,0x84,0x7A,0x7D,0x83,0x80,0x7F,0x83,0x82,0x85,0x84,0x85,0x86,0x7F,0x80,
+            0x83,0x87,0x85,0x82,0x87,0x82,0x7C,0x8D,0x7F,0x7B,0x8F,0x7F,0x90,0x91,0x8D,0x94,
+            0x91,0x94,0x85,0x89,0x95,0x96,0x92,0x91,0x91,0x8C,0x91,0x8F,0x8C,0x86,0x7E,0x68,
+            0x6F,0x78,0x82,0x87,0x89,0x8E,0x91,0x95,0x58,0x97,0x97,0x99,0x98,0x8D,0x9B,0x79,
+            0x6D,0x9E,0x9D,0x9F,0xA1,0xA3,0xA2,0xA5,0x66,0xA4,0xA2,0xA5,0xA4,0xA4,0xA2,0xA1,
+            0x72,0xA1,0xA5,0xA7,0xA6,0xA4,0xA5,0xA6,0x6B,0xA4,0xA6,0xA6,0xA5,0xA7,0xA5,0xA4,
+            0x7B,0x95,0xAA,0x8D,0xA7,0xA7,0xA8,0xA8,0x70,0x9D,0xA2,0xA6,0xA2,0xA3,0xA7,0x9E,
+            0x7A,0x84,0x92,0xA7,0x87,0x89,0xA7,0xA7,0x6D,0x80,0x9C,0xA0,0x81,0x89,0x9C,0xA3,
+            0x7E,0xA4,0xA6,0x9C,0xA6,0xA3,0xA3,0xA5,0x76,0xA7,0xA7,0x9F,0xA1,0xA0,0xA5,0xA8,
+            0x86,0xA7,0x7E,0xA9,0xA7,0xA8,0x72,0xA8,0x78,0xA9,0xA4,0xAD,0xA7,0xA8,0xAA,0xA7,
+            0x8A,0xA5,0x97,0x99,0x86,0x84,0x94,0xA5,0x7B,0xA6,0xA8,0xAA,0xA5,0xA3,0xA2,0xA2,
+            0x83,0xA6,0xA5,0x8F,0xA1,0x98,0xA7,0xA9,0x7C,0x8F,0xA7,0x94,0xA5,0x9F,0xAA,0xA8,
+            0x8D,0xA8,0xA7,0xA8,0xA7,0xA9,0xA8,0xAB,0x7E,0xA7,0xA6,0xA9,0xAA,0xAA,0xAA,0xA6,
+            0x8D,0xA7,0xA6,0xA8,0xA6,0xA8,0xA8,0xA7,0x7F,0xA7,0xAA,0xA5,0xA7,0xA6,0xAC,0x98,
+            0x92,0xA1,0xAC,0xA7,0xAA,0xA9,0xA6,0xA7,0x80,0xA2,0x9D,0xA7,0xAA,0xA3,0x9F,0xA3,
+            0x8F,0x9C,0xA2,0x9A,0x84,0x89,0x9E,0x9F,0x82,0xA6,0xA7,0xA8,0xA5,0xA4,0xA9,0x85,
+            0x90,0xA6,0xA6,0xA4,0xA8,0xA8,0xA8,0xA9,0x7F,0xA4,0xA6,0xA5,0xA6,0xA5,0xA3,0xA4,
+            0x94,0xA2,0xA4,0x98,0xA3,0xA5,0xA5,0xA3,0x7F,0x86,0xA3,0x87,0xA1,0xA1,0xA1,0xA0,
+            0x90,0xA0,0x90,0x8B,0x9D,0x9A,0x97,0x99,0x84,0x94,0x91,0x90,0x8C,0x85,0x7E,0x67,
+            0x72,0x79,0x80,0x84,0x87,0x8B,0x8E,0x91,0x84,0x8C,0x97,0x9B,0x99,0x9D,0x9B,0x5F,
+            0x89,0xA0,0x9D,0x9F,0x98,0x99,0xA3,0x9E,0x94,0xA5,0xA3,0xA0,0xA5,0xA3,0x9F,0x9B,
+            0x83,0xA3,0xA5,0xA4,0xA8,0xA2,0x9D,0xA4,0x9D,0xA0,0xA6,0xA6,0xA9,0xA4,0xA5,0xA6,
+            0x99,0x7F,0xA4,0xA7,0xA7,0xA7,0xA6,0xA7,0x9D,0x92,0x9F,0x9E,0x9C,0x9C,0xA1,0x9C,
+            0x8B,0x78,0x91,0x9F,0x80,0x7B,0xA2,0xA5,0x68,0x78,0x94,0x99,0x72,0x82,0x9A,0x9F,
+            0x8C,0xA7,0xA3,0x8B,0xA6,0xA3,0xA7,0xA5,0x9E,0x9D,0xA9,0x93,0xA6,0xA9,0xA5,0xAA,
+            0x9D,0x9F,0x83,0xA5,0x94,0xA8,0x74,0xA1,0x9D,0x9F,0xA1,0x98,0xA2,0xA0,0xAB,0xA7,
+            0xA6,0x9D,0x8B,0x97,0x62,0x70,0xA3,0xA6,0x8E,0x93,0xA9,0xA9,0xA4,0xA0,0x86,0x92,
+            0x89,0x98,0xA5,0x83,0x96,0x8B,0xA8,0xAA,0x9A,0x85,0xA4,0x8A,0xA8,0x8E,0xA8,0xA3,
+            0x97,0xAB,0xAA,0xA5,0xA6,0xA8,0xAA,0xA8,0xA8,0xA9,0xAA,0xA9,0xA9,0xA8,0xA6,0xA7,
+            0xA2,0xA7,0xAA,0xA7,0xA6,0xA7,0xA7,0xA5,0x9C,0xA6,0xA7,0xA5,0xA4,0xA6,0xAA,0xA9,
+            0xA5,0x96,0xA9,0xA6,0xA6,0xA5,0x99,0x99,0x8E,0x98,0x95,0x99,0xA6,0x9E,0x97,0x98,
+            0x99,0x91,0xA0,0x9B,0x85,0x85,0x93,0x90,0xA3,0xA0,0xA3,0xA3,0xA1,0xA3,0xA4,0x9A,
+            0xA2,0xA0,0xA4,0xA0,0x9D,0xA2,0xA3,0x9D,0x7B,0xA2,0xA2,0x9D,0xA3,0xA0,0xA3,0xA1,
+            0x9A,0x9E,0x9F,0x98,0x9D,0x9C,0xA2,0xA4,0x7D,0x77,0x9C,0x78,0x9A,0x9C,0x9A,0x97,
+            0x9C,0x9D,0x8D,0x8B,0x9C,0x91,0x91,0x97,0x94,0x90,0x90,0x90,0x8D,0x84,0x7B,0x66,
+            0x78,0x77,0x7C,0x7F,0x7C,0x86,0x87,0x8C,0x83,0x82,0x93,0x93,0x91,0x96,0x99,0x75,
+            0x86,0x9D,0x9B,0x9E,0x9A,0x99,0x9E,0xA0,0x8E,0x9B,0x9D,0xA0,0xA0,0xA1,0xA1,0x95,
+            0x86,0xA0,0xA2,0xA1,0x9E,0xA0,0xA5,0x9E,0x97,0x96,0xA1,0xA2,0xA8,0xA4,0xA1,0x9F,
+            0x92,0x79,0xA1,0xA2,0xA4,0xA7,0xA2,0xA8,0x95,0x8C,0x9F,0xA5,0xA0,0x9B,0xA3,0x90,
+            0x94,0x7A,0x91,0x9F,0x79,0x83,0xA4,0xA4,0x5C,0x77,0x98,0xA0,0x63,0x84,0xA2,0xA2,
+            0x99,0xA1,0xA0,0x99,0xA8,0x9F,0xA7,0xA5,0xA5,0xA7,0xA6,0x89,0xA3,0x99,0xA8,0xA4,
+            0xA4,0xA8,0x8B,0xA6,0xA0,0xA6,0x77,0xAB,0xA5,0xA7,0x95,0xA9,0xA8,0xA8,0xA8,0xA7,
+            0xA7,0xAA,0x96,0x93,0x83,0x84,0x9E,0xA2,0xA8,0xA8,0xA6,0xA8,0xA3,0x9E,0xA2,0xA2,
+            0x86,0x96,0xA3,0x81,0x9C,0x94,0xA9,0xA8,0x9B,0x7B,0xA6,0x8B,0xAA,0x97,0xA8,0xA6,
+            0x9B,0xA7,0xA6,0xA1,0xA6,0xA8,0xA7,0xAC,0xA5,0xA8,0xA9,0xA9,0xA6,0xA8,0xAB,0xA6,
+            0xA8,0xA4,0xA8,0xA7,0xA6,0xA9,0xA9,0xA7,0xA4,0xA7,0xAA,0xA8,0xA5,0xA5,0xAC,0xA8,
+            0xA7,0xA6,0xA2,0xA6,0xA9,0xA8,0xA5,0xA6,0x9A,0x87,0x83,0xA3,0xA8,0xA3,0x9F,0x83,
+            0x8B,0x84,0x8A,0x9D,0x85,0x87,0x95,0x92,0x90,0xA1,0x9F,0xA2,0x9B,0x9F,0x9D,0xA6,
+            0x90,0x94,0x9E,0x9D,0x94,0x96,0x9F,0x95,0x8F,0x71,0xA1,0x9B,0xA0,0x87,0xA0,0x83,
+            0x8B,0xA2,0xA2,0x9C,0xA2,0x9C,0x99,0x9F,0x63,0x82,0xA1,0x85,0x9E,0xA1,0x90,0x9C,
+            0x90,0x9D,0x8D,0x86,0x9A,0x98,0x95,0x92,0x8D,0x92,0x92,0x90,0x8C,0x80,0x7F,0x64,
+            0x78,0x7A,0x7D,0x82,0x80,0x8A,0x88,0x90,0x7D,0x84,0x95,0x99,0x95,0x99,0x9B,0x72,
+            0x8B,0xA1,0x9D,0xA1,0x9C,0x9D,0xA1,0xA1,0x96,0x9D,0xA0,0xA0,0xA0,0xA1,0xA0,0x96,
+            0x8B,0x9F,0xA2,0xA3,0xA4,0xA0,0xA7,0xA5,0x9E,0x9B,0xA4,0xA7,0xA6,0xA6,0xA5,0xA0,
+            0x95,0x71,0xA5,0xA3,0xA5,0xA5,0xA5,0xA7,0x9D,0x8F,0xA0,0xA4,0x93,0x9D,0xA1,0x9E,
+            0x93,0x71,0x94,0xA0,0x76,0x81,0xA2,0xA5,0x5B,0x70,0x96,0x9D,0x63,0x7F,0xA2,0xA4,
+            0x91,0xA0,0x9C,0x98,0xA6,0x98,0x9E,0xA4,0xA2,0xA7,0xA3,0x77,0xA3,0x88,0xA4,0xA7,
+            0xA1,0xA8,0x8E,0xA7,0x9B,0xA5,0x77,0xA6,0xA3,0xA5,0x8A,0xA7,0xA6,0xA8,0xA8,0xA5,
+            0xA2,0xA8,0x99,0x99,0x75,0x84,0xA2,0xA3,0xA8,0xA6,0xA7,0xAA,0xA5,0xA0,0xA4,0x9F,
+            0x89,0x97,0xA5,0x80,0x93,0x91,0xA8,0xA9,0x91,0x76,0xA4,0x84,0xA6,0x90,0xAA,0xA7,
+            0x9F,0xA8,0xA5,0xA8,0xA8,0xA6,0xA8,0xA8,0xA9,0xA6,0xA8,0xA5,0xA7,0xA7,0xA7,0xA7,
+            0xA5,0xA8,0xA7,0xA7,0xA6,0xAA,0xA8,0xA9,0xA2,0xA8,0xA9,0xA4,0xA8,0xA0,0xA7,0xA7,
+            0xA4,0xA9,0xA7,0xA8,0xA8,0xA6,0x9F,0xA9,0x99,0x86,0x7F,0x9B,0xA7,0x9D,0x72,0xA1,
+            0x5C,0x87,0x97,0x97,0x8B,0x8E,0x8C,0x88,0x94,0x68,0x96,0x9B,0x98,0x9C,0x9F,0x9E,
+            0x99,0x9A,0x70,0x94,0x9A,0x9F,0xA0,0xA2,0x96,0x9B,0x98,0x73,0x99,0x9C,0x9F,0x9F,
+            0x93,0x9A,0x9C,0x98,0x76,0x9D,0x9E,0xA0,0x52,0x7F,0x98,0x82,0x9E,0x77,0x99,0x9B,
+            0x95,0x98,0x8A,0x7C,0x99,0x96,0x77,0x93,0x91,0x8D,0x8D,0x8E,0x8B,0x85,0x7E,0x60,
+            0x5D,0x69,0x76,0x7D,0x81,0x86,0x88,0x8A,0x89,0x81,0x8D,0x94,0x8D,0x91,0x98,0x65,
+            0x8A,0x99,0x98,0x9D,0x95,0x9F,0x92,0x9B,0x99,0x9D,0x98,0xA1,0x9F,0x90,0xA1,0x8F,
+            0x98,0x99,0xA0,0x9F,0x89,0x91,0xA1,0xA2,0xA0,0x8E,0x9B,0x98,0xA2,0xA5,0x9F,0xA5,
+            0x9B,0x7E,0xA3,0x86,0xA3,0xA5,0xA7,0xA3,0x9A,0x8C,0xA5,0x9F,0x92,0x99,0x96,0x8B,
+            0x8C,0x69,0x96,0x9D,0x77,0x7F,0xA2,0xA2,0x5B,0x6F,0x92,0x99,0x6D,0x7C,0x92,0x97,
+            0x94,0xA5,0x9D,0x99,0xA1,0x9D,0xA4,0x95,0x9A,0x94,0xA4,0x7E,0xA0,0x97,0xA7,0xA6,
+            0x9A,0xA8,0x7D,0xA3,0x9B,0xA5,0x71,0xA5,0xA1,0x9D,0x98,0xA5,0xA2,0xA6,0xA2,0xA6,
+            0x9D,0xA7,0x85,0x85,0x7F,0x7A,0x93,0x95,0xA2,0xA6,0xA7,0xA5,0x9D,0x98,0x99,0x8D,
+            0x89,0x8F,0xA7,0x65,0x9B,0x87,0xA5,0xA6,0x8E,0x77,0xA2,0x7B,0xA8,0x87,0xA9,0xA2,
+            0x9D,0xA9,0xA4,0xA5,0xA8,0xA5,0xA8,0xA9,0xA1,0x9C,0xA6,0xA6,0xA5,0xA8,0xA7,0xA6,
+            0xA1,0xA6,0x9F,0xA5,0xA7,0xA9,0xA7,0xA6,0x98,0xA7,0xA6,0xA3,0xA6,0xA2,0xA5,0xA7,
+            0xA2,0xA6,0xA4,0xA5,0xA4,0xA5,0x9F,0xA8,0x92,0x8D,0x90,0xA0,0xA5,0xA1,0x8E,0x97,
+            0x95,0x7F,0xA7,0x89,0x7C,0x7D,0x95,0x94,0xA6,0x9E,0xA1,0xA3,0xA3,0xA3,0xA5,0xA6,
+            0x9D,0x95,0xA4,0x92,0xA5,0xA5,0xA5,0xA3,0xA1,0x9E,0xA1,0x9B,0x9B,0xA0,0x9D,0xA1,
+            0x99,0x9C,0x9F,0x99,0xA0,0x9D,0x9F,0xA0,0x7C,0x7B,0x9B,0x82,0x9F,0x9E,0x97,0x9B,
+            0x86,0x98,0x83,0x7E,0x96,0x95,0x8A,0x89,0x8F,0x8C,0x87,0x87,0x82,0x7B,0x73,0x5D,
+            0x75,0x7E,0x87,0x8E,0x8E,0x94,0x93,0x95,0x93,0x93,0x9C,0x9A,0x99,0x9E,0x9F,0x72,
+            0x98,0xA1,0xA0,0x9F,0x9B,0xA1,0x96,0xA2,0x9D,0xA1,0xA2,0xA4,0xA3,0xA2,0xA4,0x9A,
+            0x9C,0xA1,0xA4,0xA7,0xA5,0xA1,0xA5,0xA5,0x9E,0x90,0xA5,0x8D,0xA6,0xA6,0xA2,0xA7,
+            0xA0,0x81,0xA4,0xA2,0xA3,0xA4,0xA2,0xA4,0xA1,0x93,0xA6,0xA3,0x96,0xA3,0xA7,0x8A,
+            0x97,0x78,0x9B,0xA2,0x7E,0x82,0xA4,0xA7,0x67,0x79,0x9A,0xA0,0x73,0x81,0xA3,0x9E,
+            0x9A,0xA6,0x9E,0x9A,0x9F,0x9A,0xA3,0x95,0xA1,0x9E,0xA5,0x9E,0xA4,0x9E,0xA8,0xA5,
+            0x9F,0x96,0x83,0xA2,0x97,0x9A,0x7A,0xA2,0x8B,0x87,0x93,0xA1,0x9B,0x9A,0xA2,0xA3,
+            0xA1,0xA2,0x8F,0x8B,0x86,0x82,0x98,0x98,0x91,0x93,0xA6,0xA7,0x88,0x93,0x8E,0x9A,
+            0x90,0x93,0xA7,0x82,0x9D,0x8E,0xA8,0xA6,0x93,0x7E,0xA6,0x89,0xA6,0x90,0xA7,0xA8,
+            0x9D,0xA7,0xA6,0xA8,0xA0,0xA7,0xA8,0xA8,0xA5,0xA4,0xA8,0xA5,0xA4,0xA7,0xA9,0xA6,
+            0xA6,0xA8,0xA8,0xA6,0xA3,0xA7,0xA8,0xA8,0x9B,0x9E,0xA6,0xA5,0xA6,0xA2,0xA7,0xA9,
+            0xA5,0xA8,0x9E,0xA6,0xA9,0xA5,0x96,0xA7,0x86,0x95,0x83,0xA3,0x9A,0x9E,0x85,0x9E,
+            0x9C,0x85,0xA8,0x9B,0x89,0x8D,0x99,0x9C,0xA0,0xA4,0xA5,0xA4,0xA5,0x96,0xA5,0xA5,
+            0x9D,0x9D,0xA4,0x8D,0xA1,0xA4,0xA6,0xA7,0xA1,0x9B,0xA4,0x9C,0xA2,0x8F,0xA2,0xA3,
+            0x9F,0xA4,0xA3,0x9E,0xA1,0x9F,0xA4,0xA2,0x7C,0x84,0xA1,0x88,0xA1,0x9B,0x9D,0x97,
+            0x97,0x9D,0x88,0x87,0x9B,0x94,0x95,0x91,0x94,0x92,0x93,0x90,0x8D,0x7F,0x7D,0x61,
+            0x77,0x7C,0x86,0x8F,0x8C,0x94,0x90,0x96,0x95,0x91,0x98,0x9C,0x97,0x9D,0x9E,0x53,
+            0x97,0xA2,0xA1,0xA3,0xA3,0xA2,0xA3,0xA3,0xA0,0xA2,0xA2,0xA4,0xA5,0xA1,0xA2,0x99,
+            0x9F,0x9C,0xA5,0xA5,0xA5,0xA3,0xA7,0xA4,0xA1,0x91,0xA5,0xA2,0xA5,0xA2,0xA4,0xA8,
+            0x9E,0x7D,0xA5,0xA2,0xA4,0xA2,0xA6,0xA4,0xA3,0x93,0xA5,0xA6,0x9F,0x9F,0xA5,0x97,
+            0x94,0x67,0x88,0x8C,0x6B,0x6F,0x9A,0x9B,0x60,0x79,0x9C,0xA1,0x6E,0x87,0x9D,0xA3,
+            0x9A,0xA1,0xA2,0x94,0xA7,0x98,0xA7,0xA6,0x9A,0x8E,0xA4,0x92,0xA0,0x9F,0x9F,0xA5,
+            0xA2,0xA6,0x82,0xA6,0x9A,0x9F,0x79,0xA5,0xA5,0xA1,0x98,0xA6,0xA3,0xA1,0xA4,0xA6,
+            0xA3,0xA7,0x90,0x8F,0x84,0x80,0x9A,0x9B,0xA4,0xA6,0xA7,0xA9,0x9D,0x8B,0x97,0x9E,
+            0x97,0x95,0xA7,0x80,0x9F,0x90,0xA9,0xA8,0x95,0x7C,0xA4,0x89,0xA8,0x8F,0xA8,0xA7,
+            0xA2,0xA6,0xA7,0xAB,0xAA,0xA4,0xA9,0xA9,0x9F,0xA3,0xAA,0xA6,0xA7,0xA4,0xA7,0xA7,
+            0xA3,0xA8,0xA8,0xA6,0xA7,0xA6,0x98,0xA8,0xA3,0xA8,0xA8,0xA4,0xA7,0xA0,0xA7,0xA7,
+            0xA3,0xA7,0xA8,0xAA,0xA8,0xA5,0xA4,0xA8,0x9B,0x87,0x9D,0xA2,0xA7,0xA1,0x7D,0x9A,
+            0x9C,0x80,0xA6,0x9D,0x90,0x8C,0x9E,0x98,0xA4,0xA7,0xA6,0xA5,0xA5,0xA4,0xA4,0xA6,
+            0x9F,0x9C,0xA5,0x95,0xA5,0xA4,0xA7,0xA6,0xA2,0xA0,0xA3,0xA1,0xA7,0x99,0xA3,0xA5,
+            0x9B,0xA1,0xA3,0x9C,0xA1,0x9F,0xA3,0xA1,0x71,0x88,0xA3,0x8B,0xA0,0x9D,0xA0,0x9D,
+            0x9A,0x9E,0x8E,0x84,0x9B,0x98,0x95,0x93,0x95,0x94,0x93,0x90,0x8D,0x83,0x7E,0x61,
+            0x76,0x7C,0x86,0x8E,0x8D,0x94,0x8F,0x97,0x98,0x97,0x96,0x9D,0x98,0x9C,0x9F,0x48,
+            0x99,0xA4,0xA2,0xA3,0x9F,0xA3,0xA2,0xA4,0xA2,0xA2,0xA3,0xA4,0xA5,0xA7,0xA4,0xA3,
+            0x9E,0xA3,0xA5,0xA6,0xA5,0xA4,0xA7,0xA9,0xA5,0x9C,0xA6,0xA7,0xA9,0xA9,0xA8,0xA7,
+            0x9E,0x88,0xA8,0xA4,0xA6,0xA9,0xA8,0xA7,0xA5,0x9B,0xA7,0xA8,0x9D,0xA6,0xA4,0xA3,
+            0x9B,0x5D,0x76,0x85,0x69,0x70,0x9A,0x9A,0x60,0x73,0xA2,0xA3,0x7A,0x86,0xA1,0xA5,
+            0xA0,0xA4,0xA4,0x9E,0xA8,0xA3,0xA7,0xA8,0x97,0x8F,0xA8,0xA2,0x9E,0xA5,0xA0,0xAA,
+            0xA3,0xA9,0x8E,0xA7,0x92,0xA2,0x7E,0xA6,0xA7,0xA6,0xA8,0xAA,0xA8,0xA6,0xA6,0xA6,
+            0xA6,0xAA,0x96,0x97,0x82,0x83,0xA1,0xA3,0xA7,0xA9,0xA9,0xA9,0xA5,0x94,0xA2,0x9D,
+            0x8F,0x9B,0xA9,0x89,0x9D,0x95,0xAA,0xAA,0xA0,0x85,0xA6,0x91,0xA7,0x98,0xAC,0xA6,
+            0x97,0xA7,0xA5,0xAA,0xAB,0xA6,0xAC,0xA8,0xA7,0xA5,0xAB,0xAD,0xA9,0xAB,0xA9,0x9E,
+            0xA3,0xA6,0xA9,0xA9,0x9B,0x99,0x9A,0xA8,0xA2,0xA5,0xA1,0x94,0xA8,0xA6,0xAA,0xA8,
+            0xA6,0xA8,0xAA,0xA8,0xA7,0xA7,0xA8,0xA8,0x9F,0x9D,0x9F,0xAA,0xA9,0xA5,0x89,0x9D,
+            0xA2,0x91,0xA7,0x91,0x90,0x8D,0xA3,0x9F,0xA8,0xA4,0xA7,0xA5,0xA8,0xA5,0xA6,0xA8,
+            0xA3,0xA0,0xA6,0x9D,0xA7,0xA6,0xA5,0xA8,0xA3,0xA0,0xA2,0xA4,0xA4,0x9E,0x9E,0xA6,
+            0xA2,0xA2,0xA2,0x9E,0xA4,0xA2,0xA4,0xA4,0x82,0x8B,0xA0,0x88,0x9F,0xA1,0xA0,0xA0,
+            0x9B,0x9E,0x8E,0x8C,0x9E,0x9B,0x94,0x98,0x95,0x96,0x92,0x90,0x8C,0x82,0x7E,0x60,
+            0x74,0x7C,0x84,0x85,0x8B,0x93,0x8F,0x97,0x94,0x90,0x97,0x9B,0x95,0x9A,0x9D,0x7C,
+            0x90,0xA1,0x9F,0xA2,0x9D,0xA2,0x9F,0x9C,0x9B,0xA0,0xA3,0xA3,0xA3,0xA4,0xA2,0xA2,
+            0x9E,0xA4,0xA6,0xA6,0xA5,0xA0,0xA8,0xA7,0xA3,0xA2,0xA8,0xA5,0xA7,0xA5,0xA8,0xA7,
+            0xA0,0x8E,0xA8,0x8E,0xA7,0xA6,0xA9,0xA8,0xA8,0x9F,0xA8,0xAA,0x9E,0xA6,0xAA,0xA6,
+            0x9C,0x81,0x9C,0xA7,0x8B,0x90,0xA3,0xA5,0x73,0x7B,0xA2,0xA2,0x82,0x8C,0xA4,0x9A,
+            0xA1,0xA6,0xA7,0x86,0xA7,0x72,0xAA,0xA7,0xA3,0x96,0xA9,0xA7,0xA5,0xA6,0xA6,0xAA,
+            0xA2,0xA6,0x7C,0xA7,0x96,0xA7,0x7D,0xA9,0xA7,0xA6,0xA7,0xA8,0xA9,0xA8,0xA8,0xA8,
+            0xA4,0xA8,0x9D,0x99,0x8B,0x8B,0xA3,0xA1,0xA8,0xA9,0xAB,0xA9,0xA6,0xA2,0xA5,0x9C,
+            0x9A,0x9D,0xA8,0x91,0xA2,0x9C,0xA1,0xAA,0xA6,0x88,0xA8,0x90,0xA6,0x9F,0xA7,0xA8,
+            0xA4,0xA9,0xA3,0xAA,0xA2,0xA7,0xA9,0xA9,0xA7,0xA7,0xAA,0xA7,0xA2,0xAA,0xA7,0xA8,
+            0xA6,0xA8,0x9A,0xA9,0xA6,0xA7,0xA9,0xA8,0xA5,0x9F,0xA8,0xA5,0xA8,0xA7,0xA7,0xAC,
+            0xA4,0xA6,0xAB,0xA8,0xA7,0xA7,0xA7,0xA4,0xA2,0xA0,0xA0,0xA5,0xA8,0xA6,0x89,0x9F,
+            0xA1,0x99,0xA2,0x9F,0x85,0x85,0x9A,0x99,0xA2,0xA0,0xA1,0xA1,0xA4,0xA5,0xA7,0xA3,
+            0xA0,0xA3,0xA4,0xA3,0xA4,0xA4,0xA7,0xA5,0xA3,0xA0,0xA3,0xA2,0xA4,0xA1,0xA5,0xA5,
+            0xA0,0xA1,0xA4,0x9E,0xA3,0xA1,0xA5,0xA0,0x8D,0x90,0xA0,0x93,0xA0,0x9F,0xA2,0x9C,
+            0x9C,0x9D,0x91,0x85,0x9C,0x9A,0x97,0x99,0x95,0x93,0x90,0x8E,0x8B,0x82,0x7D,0x5F,
+            0x71,0x7F,0x89,0x86,0x8E,0x87,0x91,0x95,0x88,0x8E,0x9C,0x9C,0x9B,0x93,0x9F,0x76,
+            0x8E,0x92,0xA3,0xA0,0x99,0x94,0xA3,0xA1,0x96,0x91,0xA4,0xA5,0x9C,0x90,0xA4,0xA2,
+            0x9B,0x99,0xAA,0xA7,0xA4,0x90,0xA7,0xA6,0x94,0x98,0xAA,0xA5,0xA6,0x8D,0xA6,0xA7,
+            0x9E,0x86,0xA8,0xA7,0xA5,0x92,0xAA,0xA8,0xA0,0x99,0xA7,0xA7,0x9C,0x94,0xA9,0xA3,
+            0x8F,0x71,0xA1,0xA4,0x85,0x8A,0xA3,0xA6,0x6D,0x77,0xA1,0xA3,0x7C,0x87,0xA2,0xA0,
+            0x9A,0x8F,0xA6,0x6C,0xA4,0xA7,0xAB,0xA3,0x9F,0x97,0xA8,0xA8,0xA4,0xA7,0xAA,0xA9,
+            0x88,0x8B,0x7D,0xAA,0x98,0xA4,0x7A,0xA0,0x88,0x8C,0xA0,0xA0,0xA0,0x9E,0xAA,0xAB,
+            0x99,0x87,0x89,0x92,0x83,0x85,0xA1,0xA2,0xA3,0x97,0xA9,0xAA,0xA2,0xA2,0xA1,0x9F,
+            0x97,0x9A,0xA7,0x8C,0x97,0x95,0xA8,0xA7,0xA3,0x86,0xA8,0x94,0xA4,0x9C,0xA8,0xA9,
+            0xA1,0xA0,0xA7,0xAA,0xA4,0xA7,0xAA,0xAA,0xA6,0xA1,0xAB,0xAA,0xA6,0xAA,0xA8,0xA6,
+            0xA4,0xA2,0xA9,0xA7,0xA6,0xA9,0x9E,0xA6,0xA5,0xA2,0xA8,0xA8,0xA5,0xA6,0xAC,0xA7,
+            0xA3,0x9E,0xA9,0xAA,0xA4,0xA6,0xA9,0xA0,0x8A,0x99,0x99,0xA4,0x99,0xA7,0x82,0x9D,
+            0x82,0x84,0x8F,0x92,0x91,0x89,0x8A,0x87,0x8D,0x86,0x86,0x97,0x9C,0x96,0x8B,0x87,
+            0x89,0x7A,0x94,0x86,0x91,0x97,0x8B,0x87,0x7A,0x83,0x99,0x91,0x9C,0x8F,0x8B,0x86,
+            0x72,0x85,0x87,0x94,0x92,0x91,0x9C,0x94,0x75,0x82,0x89,0x85,0x9A,0x97,0x99,0x91,
+            0x7E,0x87,0x7F,0x89,0x8E,0x89,0x92,0x96,0x83,0x8A,0x8F,0x8C,0x8A,0x82,0x79,0x5E,
+            0x77,0x7C,0x87,0x89,0x84,0x76,0x8C,0x8C,0x97,0x91,0x9C,0x9B,0x99,0xA0,0xA0,0x5C,
+            0x9C,0xA2,0xA0,0xA1,0x9E,0xA3,0xA3,0xA3,0x9E,0xA0,0xA4,0xA3,0x9E,0xA5,0xA3,0xA2,
+            0x96,0xA3,0xA6,0xA8,0x9C,0x9F,0xA5,0xA5,0xA5,0x96,0xA7,0xA4,0xA0,0xA8,0xA7,0xA4,
+            0x95,0x6D,0xA4,0xA3,0xA5,0xA8,0xA9,0xA9,0xA2,0x94,0x8B,0xA5,0x9B,0x9D,0xA7,0xA4,
+            0x72,0x6C,0x80,0x75,0x6B,0x6D,0x7A,0x7A,0x5B,0x71,0x97,0x98,0x64,0x82,0x9A,0xA0,
+            0x96,0xA2,0xA2,0x8E,0xA4,0x93,0xA6,0x9E,0xA5,0xA7,0xA2,0x89,0xA7,0x96,0xA8,0xA3,
+            0x93,0xA5,0x8E,0xA8,0x90,0xA7,0x73,0xA2,0xA3,0xA7,0x8F,0xA8,0xAA,0xA9,0xA7,0xA9,
+            0xA1,0xA5,0xA1,0x9D,0x5B,0x70,0xA2,0xA5,0x7B,0x90,0xA9,0xAB,0xA6,0xA3,0x81,0x8F,
+            0x7B,0x86,0x8A,0x76,0x79,0x7C,0x88,0x7F,0x98,0x79,0x9A,0x86,0xA9,0x8A,0xAB,0xA7,
+            0x99,0xA9,0xA7,0xA9,0xAB,0xA5,0xA7,0xA6,0xA8,0xA5,0xA9,0xA9,0xA7,0xA8,0xA5,0xA6,
+            0xA6,0xA7,0xA9,0xA9,0xA2,0xAB,0xA9,0xA8,0x9F,0xA4,0xAA,0xA5,0xA9,0xA6,0xA6,0xA9,
+            0xA3,0xA0,0xA7,0xA8,0xA6,0xA8,0xA9,0xA9,0x91,0x87,0x78,0xA0,0xA9,0x9D,0x92,0x83,
+            0x86,0x73,0x75,0x79,0x74,0x76,0x78,0x74,0xA0,0xA3,0x9E,0xA3,0xA7,0x99,0xA8,0xA6,
+            0x9A,0x9C,0xA2,0x98,0xA3,0xA4,0xA0,0xA4,0x8C,0x86,0x9B,0x9D,0x9F,0x9D,0x94,0x9E,
+            0x95,0xA1,0xA2,0x99,0xA1,0x95,0x9B,0xA0,0x63,0x74,0x9E,0x79,0x99,0xA1,0x93,0x9F,
+            0x9B,0x9D,0x8D,0x85,0x8F,0x95,0x91,0x91,0x95,0x94,0x93,0x91,0x88,0x84,0x7F,0x5B,
+            0x77,0x7F,0x87,0x8D,0x8D,0x92,0x95,0x95,0x94,0x93,0x9C,0x9E,0x98,0xA1,0xA0,0x71,
+            0x96,0xA3,0xA1,0xA1,0xA2,0xA4,0xA3,0xA3,0xA1,0xA1,0xA4,0x9A,0xA5,0xA4,0xA1,0x9F,
+            0x9A,0xA1,0xA7,0xA6,0xA4,0xA2,0xA2,0xA6,0x9F,0x9B,0xA7,0xA5,0xA7,0xAA,0xA6,0xA6,
+            0x9F,0x7A,0xA7,0xA5,0xA2,0xA2,0xA7,0xA3,0xA3,0x97,0xA4,0xA4,0x9B,0xA3,0xA9,0x9D,
+            0x8B,0x71,0x9A,0x97,0x7A,0x82,0x99,0x9D,0x60,0x72,0x9C,0xA1,0x6C,0x84,0xA0,0xA3,
+            0x99,0xA5,0xA4,0x88,0xA6,0x93,0xA7,0xA6,0xA4,0xA8,0xA4,0x8B,0x9F,0x93,0xA4,0xA6,
+            0xA2,0xA8,0x91,0xA3,0x90,0xA3,0x79,0xA5,0xA4,0xA5,0x97,0xA7,0xA7,0xA6,0xAB,0xA7,
+            0xA2,0x9F,0x98,0x8F,0x77,0x85,0x9D,0x9B,0xA7,0xA0,0xAA,0xA7,0x9C,0x9E,0xA1,0x9E,
+            0x8E,0x99,0xA3,0x81,0x97,0x8A,0xA2,0xA3,0x98,0x79,0xA7,0x88,0xA5,0x97,0xA8,0xA5,
+            0xA3,0xA6,0xA8,0xA1,0xA5,0xA8,0xAA,0xAB,0xA6,0xA4,0xA9,0xA8,0xA4,0xA8,0xA4,0xA7,
+            0xA5,0xA8,0xA8,0xA7,0x98,0xA5,0xA8,0xA6,0xA4,0xA9,0x9D,0xAA,0xA9,0xA3,0xA9,0xA9,
+            0xA3,0xA3,0xA7,0xA3,0x9B,0xA3,0xA4,0xA4,0x9F,0x8E,0x8A,0xA2,0xA4,0xA1,0x79,0x9E,
+            0x90,0x7B,0x81,0x86,0x87,0x7E,0x81,0x79,0xA5,0xA4,0xA6,0xA5,0xA7,0xA8,0xA8,0xA6,
+            0x71,0x7A,0x73,0x86,0x92,0x88,0x80,0x7F,0x6F,0x78,0x7B,0x82,0x8E,0x80,0x80,0x83,
+            0x8A,0x69,0x80,0x8B,0x95,0x8B,0x87,0x82,0x5C,0x79,0x96,0x87,0x9B,0x98,0x8D,0x93,
+            0x88,0x7A,0x88,0x7D,0x8F,0x88,0x7D,0x7F,0x8E,0x85,0x8E,0x8B,0x89,0x84,0x7C,0x58,
+            0x60,0x5E,0x63,0x67,0x6D,0x73,0x75,0x78,0x70,0x77,0x7E,0x7D,0x80,0x84,0x88,0x68,
+            0x6E,0x82,0x87,0x88,0x87,0x94,0x87,0x8B,0x8B,0x90,0x8F,0x8F,0x94,0x93,0x91,0x81,
+            0x7F,0x90,0x8D,0x8E,0x8B,0x8B,0x94,0x91,0x87,0x89,0x96,0x9B,0x97,0x9A,0x97,0x8A,
+            0x90,0x7B,0x96,0x8A,0x9C,0x98,0x99,0x96,0x93,0x86,0x98,0x96,0x96,0x96,0x97,0x78,
+            0x79,0x70,0x96,0x9A,0x77,0x7F,0x9C,0x98,0x5A,0x6E,0x8D,0x94,0x6C,0x7C,0x96,0x97,
+            0x92,0x9E,0x99,0x92,0x9B,0x88,0x9E,0x95,0x95,0x85,0xA2,0x82,0x97,0x9B,0x99,0x9D,
+            0x97,0x9B,0x85,0x95,0x90,0x9A,0x72,0xA2,0x9D,0x9C,0x98,0xA0,0x9E,0xA2,0x9E,0x9D,
+            0x9B,0xA0,0x8A,0x8A,0x77,0x76,0x97,0x7B,0x9E,0xA1,0xA2,0xA2,0x95,0x96,0x98,0x88,
+            0x8C,0x8F,0xA3,0x78,0x98,0x88,0xA9,0x94,0x91,0x77,0xA1,0x7C,0xA6,0x7F,0xA8,0xA3,
+            0x96,0xA4,0x9F,0x9D,0xA7,0xA6,0xA8,0xA5,0xA0,0x9F,0xA8,0xA7,0xA6,0xA6,0xA7,0xA6,
+            0xA3,0xA7,0xA9,0xA7,0xA7,0xA8,0xA8,0xA7,0x99,0xA5,0xA1,0xA7,0xA8,0xA5,0xA5,0xA8,
+            0xA4,0xA3,0xA4,0xA8,0xA5,0xA7,0xA5,0xA6,0x94,0x8D,0x8C,0xA0,0xA7,0xA2,0x8A,0x98,
+            0x9B,0x83,0xA3,0x7D,0x7F,0x7E,0x94,0x92,0x9D,0x80,0xA6,0xA6,0xA1,0xA6,0xA5,0xA5,
+            0x9D,0x90,0xA6,0x93,0xA2,0xA4,0xA1,0xA4,0xA4,0xA2,0x9E,0x9C,0xA1,0xA2,0xA1,0x9F,
+            0x95,0x9F,0x9E,0x9A,0x9F,0x9F,0xA2,0x99,0x73,0x7E,0x9A,0x82,0x9F,0x9F,0x9D,0x9C,
+            0x95,0x9D,0x81,0x7E,0x98,0x95,0x87,0x89,0x8C,0x8F,0x8A,0x87,0x83,0x7B,0x74,0x56,
+            0x70,0x6C,0x70,0x71,0x78,0x7F,0x81,0x82,0x7E,0x80,0x82,0x86,0x8A,0x8D,0x8E,0x77,
+            0x7C,0x87,0x88,0x91,0x82,0x97,0x8C,0x90,0x92,0x93,0x95,0x90,0x98,0x99,0x94,0x87,
+            0x80,0x98,0x92,0x9A,0x9A,0x9B,0x9C,0x9B,0x8D,0x91,0x9E,0x9B,0x9A,0x9A,0x98,0x91,
+            0x94,0x87,0x9D,0x96,0x9A,0x97,0x9C,0x9C,0x9B,0x93,0x9C,0x9B,0x9A,0x9A,0x9B,0x85,
+            0x7C,0x79,0x97,0xA0,0x7F,0x84,0x9E,0x9F,0x69,0x7D,0x9A,0x9D,0x75,0x82,0x9A,0x9A,
+            0x95,0xA0,0x9C,0x9A,0x9B,0x9A,0xA2,0x95,0x99,0x93,0xA1,0x9D,0x9B,0x9D,0xA3,0x9A,
+            0x95,0x94,0x88,0x9B,0x96,0x9C,0x7C,0x9C,0x79,0x7B,0x87,0x93,0x9C,0x9B,0x81,0x7F,
+            0x91,0x9D,0x8F,0x90,0x8B,0x85,0x9A,0x98,0x88,0x8B,0xA1,0xA4,0x9C,0x9D,0x8B,0x82,
+            0x8E,0x8C,0x9F,0x81,0x90,0x8D,0xA5,0xA5,0x97,0x82,0xA5,0x8D,0xA1,0x91,0xA2,0xA0,
+            0x98,0xA7,0xA1,0xA2,0xA1,0xA2,0xA1,0xA0,0xA1,0x9D,0xA7,0x9E,0x9C,0xA6,0xA5,0x99,
+            0x9C,0xA3,0xA6,0xA4,0xA3,0xA1,0xA8,0xA4,0x9E,0xA0,0xA5,0xA2,0xA4,0xA2,0xA5,0xA5,
+            0xA2,0xA3,0xA2,0xA6,0xA6,0xA5,0xA2,0xA1,0x86,0x98,0x89,0xA2,0x93,0xA3,0x89,0x97,
+            0x97,0x85,0x97,0x95,0x84,0x8B,0x9A,0x96,0x92,0x9F,0x91,0x96,0x92,0x91,0x9D,0x97,
+            0x92,0x8B,0xA0,0x8C,0x8E,0x9F,0x89,0x9B,0x99,0x8C,0x93,0x9A,0x8F,0x98,0x8F,0x93,
+            0x91,0x8C,0x98,0x9B,0x9E,0x9A,0x8E,0x97,0x7E,0x88,0x99,0x8C,0x92,0x9F,0x8F,0x92,
+            0x90,0x9A,0x8A,0x88,0x8E,0x91,0x93,0x8F,0x8F,0x90,0x92,0x8C,0x88,0x82,0x7A,0x55,
+            0x6D,0x66,0x6F,0x73,0x73,0x7B,0x7D,0x7F,0x7C,0x7C,0x85,0x86,0x8A,0x8C,0x8E,0x72,
+            0x6C,0x70,0x81,0x95,0x92,0x99,0x8F,0x96,0x92,0x8E,0x96,0x95,0x9A,0x99,0x97,0x89,
+            0x7C,0x89,0x93,0x9B,0x99,0x98,0x9E,0x99,0x97,0x93,0x9B,0x9B,0x9A,0x96,0x97,0x90,
+            0x91,0x83,0x9F,0x99,0xA0,0x9C,0xA1,0x9C,0x99,0x90,0x99,0x9D,0x98,0x99,0x99,0x87,
+            0x82,0x76,0x8E,0x9D,0x7C,0x83,0x9B,0x9A,0x65,0x7C,0x99,0x9D,0x71,0x89,0x8F,0x99,
+            0x97,0x9F,0x9C,0x8D,0x9B,0x8A,0xA1,0xA0,0x91,0x8E,0xA1,0x99,0x90,0x9C,0x9A,0x99,
+            0x95,0x9C,0x88,0x99,0x94,0x99,0x79,0xA2,0x9F,0xA2,0x9A,0xA4,0xA0,0xA2,0x9E,0x80,
+            0x97,0xA1,0x90,0x8A,0x8A,0x83,0x98,0x9D,0x9E,0xA4,0x9D,0x9E,0x98,0x98,0x82,0x83,
+            0x88,0x92,0x9F,0x83,0x98,0x8C,0xA5,0xA1,0x96,0x7F,0xA5,0x89,0xA1,0x8E,0xA3,0x9E,
+            0x9C,0xA2,0xA1,0xA3,0xA0,0xA3,0xA2,0xA0,0xA6,0x9B,0xA5,0xA3,0xA1,0xA7,0xA5,0x9D,
+            0x9F,0xA4,0xA6,0xA2,0x9E,0xA3,0xA6,0xA3,0xA1,0xA5,0xA3,0xA3,0xA2,0x9F,0xA6,0xA3,
+            0xA0,0x99,0xA8,0xA5,0xA2,0xA1,0xA5,0xA3,0x94,0x8D,0x9E,0xA3,0xA1,0xA2,0x82,0x96,
+            0x95,0x83,0x97,0x85,0x8B,0x82,0x98,0x97,0x97,0x9E,0x9A,0x9D,0x9B,0x9C,0x9E,0x9C,
+            0x9A,0x91,0x9D,0x92,0x9C,0x9E,0xA0,0xA0,0x9D,0x98,0x9E,0x9D,0x9E,0xA1,0x9C,0x98,
+            0x89,0x9C,0x9C,0x9D,0x9F,0x9C,0x9D,0x9B,0x75,0x84,0x9F,0x8F,0x9A,0x9D,0x9C,0x9A,
+            0x97,0x98,0x8D,0x88,0x99,0x96,0x94,0x92,0x91,0x90,0x92,0x90,0x8A,0x84,0x7C,0x53,
+            0x73,0x73,0x7A,0x7D,0x7F,0x85,0x8A,0x8C,0x85,0x84,0x91,0x92,0x92,0x97,0x98,0x73,
+            0x72,0x79,0x75,0x9B,0x98,0x9E,0x9E,0x9E,0x9A,0x9D,0x9F,0x9F,0x9C,0xA1,0x9F,0x94,
+            0x8E,0x9D,0xA0,0xA1,0xA1,0xA0,0xA2,0x9E,0x9D,0x9E,0xA2,0xA1,0x9F,0x9E,0x9D,0x9C,
+            0x97,0x88,0xA3,0xA2,0xA5,0xA2,0xA4,0xA3,0xA1,0x9A,0x9F,0x9C,0x99,0xA1,0xA4,0x98,
+            0x88,0x7E,0x9E,0xA1,0x85,0x8A,0xA1,0xA3,0x5D,0x7D,0xA0,0xA0,0x77,0x86,0x9F,0x9D,
+            0x9C,0x9F,0xA1,0xA2,0x9E,0xA0,0xA4,0xA1,0x92,0x8E,0xA0,0xA0,0x96,0xA3,0x9A,0xA1,
+            0x9D,0xA6,0x91,0xA2,0x7D,0xA3,0x7D,0xA4,0xA3,0xA4,0xA5,0xA3,0xA5,0xA6,0xA2,0xA3,
+            0x92,0xA2,0x95,0x95,0x7F,0x82,0x9C,0x9C,0x9D,0xA3,0xA5,0xAB,0xA1,0xA0,0xA0,0x93,
+            0x89,0x96,0xA4,0x82,0x9B,0x8D,0xA8,0xA1,0x9E,0x83,0xA0,0x84,0xA4,0x98,0xA4,0xA1,
+            0x9F,0xA3,0x9B,0x97,0xA5,0xA4,0xA8,0xA6,0xA3,0xA1,0xA8,0xA2,0xA5,0xA0,0xA4,0xA4,
+            0xA1,0xA5,0xA9,0xA4,0xA6,0xA7,0xA1,0xA7,0x9F,0xA6,0xA2,0xA4,0xA8,0xA1,0xA8,0xA5,
+            0xA5,0xA6,0xA7,0xA5,0xA4,0xA5,0xA5,0xA7,0x9F,0x9A,0x92,0xA3,0xA9,0xA1,0x94,0x86,
+            0x9A,0x92,0xA1,0xA3,0x92,0x8F,0x98,0x98,0x9E,0xA6,0xA3,0xA5,0xA6,0xA6,0xA5,0xA3,
+            0x9C,0xA1,0xA5,0x9D,0xA4,0xA5,0xA4,0xA3,0xA2,0xA0,0xA1,0xA2,0xA4,0x9F,0xA4,0x9F,
+            0x99,0x99,0xA1,0xA0,0xA3,0x9F,0xA1,0xA0,0x74,0x8E,0x9F,0x8B,0xA1,0x9F,0x9C,0x9D,
+            0x8E,0x9C,0x88,0x8B,0x9C,0x9C,0x90,0x96,0x91,0x93,0x92,0x8D,0x8A,0x84,0x7B,0x50,
+            0x70,0x73,0x7D,0x7C,0x83,0x8A,0x8E,0x8D,0x7D,0x8A,0x92,0x94,0x94,0x9A,0x96,0x77,
+            0x7D,0x86,0x9C,0x9E,0x9B,0x9E,0x9E,0x99,0x99,0x9D,0xA2,0xA2,0xA3,0xA2,0x9F,0x95,
+            0x92,0x9D,0xA1,0xA5,0xA3,0x9E,0xA7,0xA3,0x96,0x96,0xA4,0xA2,0xA3,0xA2,0xA2,0x9E,
+            0x9F,0x88,0xA5,0x8A,0xA7,0xA5,0xA7,0xA5,0xA7,0x90,0xA6,0x83,0x9C,0xA4,0xA6,0x9B,
+            0x93,0x7C,0x97,0xA0,0x80,0x87,0xA4,0xA6,0x68,0x79,0x9B,0x9E,0x77,0x83,0x9F,0xA2,
+            0x9B,0xA3,0xA2,0x82,0xA3,0x72,0xA9,0xA2,0xA2,0x91,0xA5,0x9E,0xA0,0x9C,0xA5,0xA3,
+            0xA3,0xA5,0x8C,0xA4,0x88,0xA4,0x7A,0xA5,0xA5,0xA9,0xA3,0xAA,0xA6,0xA4,0xA5,0xA5,
+            0xA2,0xA4,0x9A,0x8E,0x88,0x85,0xA1,0x90,0xA6,0xA8,0xA6,0xA7,0xA7,0xA2,0xA1,0x9C,
+            0x8E,0x91,0xA4,0x7F,0xA2,0x85,0xAD,0x8F,0x9B,0x7F,0xA7,0x88,0xA7,0x8E,0xA7,0xA3,
+            0x9D,0xA7,0xA6,0xA7,0xA7,0xA3,0xA9,0xA7,0xA8,0xA6,0xA8,0xA9,0xA2,0xA7,0xA7,0xA7,
+            0xA3,0xA7,0xAC,0xA8,0xA7,0xA7,0xAB,0xA8,0x95,0xA7,0xA9,0xA7,0xA8,0xA4,0xA8,0xA7,
+            0xA6,0xA6,0xA8,0xA8,0xA3,0xA6,0xA5,0xA9,0x9F,0x9C,0x9B,0xA2,0xA8,0xA5,0x9D,0x88,
+            0x9C,0x95,0xA2,0x9E,0x8C,0x80,0x98,0x94,0x9E,0xA2,0x9C,0xA5,0xA3,0xA4,0xA6,0xA3,
+            0x9E,0x9E,0xA3,0x9F,0xA4,0xA4,0xA2,0xA7,0xA2,0x9A,0xA0,0xA0,0xA3,0xA4,0x9E,0xA3,
+            0x9D,0xA2,0xA3,0x9D,0xA2,0xA2,0xA3,0x9F,0x86,0x80,0xA1,0x8B,0x9E,0xA1,0xA0,0xA0,
+            0x98,0x9C,0x92,0x80,0x9D,0x9C,0x94,0x95,0x90,0x94,0x93,0x8C,0x8C,0x83,0x7B,0x4D,
+            0x6D,0x6F,0x79,0x7A,0x7E,0x85,0x8B,0x8A,0x80,0x85,0x90,0x90,0x93,0x95,0x94,0x6D,
+            0x84,0x83,0x99,0x9A,0x98,0x9B,0x9E,0x95,0x95,0x9E,0x9C,0xA0,0x9E,0xA2,0x9D,0x96,
+            0x8C,0x9D,0x9F,0xA2,0xA2,0xA0,0xA1,0xA1,0x8F,0x98,0xA1,0xA1,0x97,0x9F,0xA4,0x9F,
+            0x9C,0x86,0xA3,0xA3,0xA2,0xA2,0xA5,0xA1,0x9F,0x97,0xA4,0xA0,0x94,0x9A,0x9E,0x97,
+            0x84,0x6E,0x92,0x9E,0x82,0x85,0xA3,0xA4,0x60,0x70,0x9C,0x9B,0x70,0x82,0x9E,0x9F,
+            0x9D,0xA6,0xA3,0x6A,0xA0,0x94,0xA6,0xA1,0x9D,0x97,0xA6,0x9F,0x9C,0xA6,0xA2,0xA1,
+            0x98,0x9B,0x85,0x9E,0x7E,0xA2,0x74,0x94,0x9A,0x9D,0x9C,0x93,0x9C,0x9C,0xA4,0x78,
+            0x95,0x95,0x89,0x94,0x81,0x84,0x98,0x92,0x9C,0xA8,0xA9,0xA5,0xA1,0x9C,0xA2,0x75,
+            0x86,0x96,0xA8,0x7D,0x84,0x84,0xA6,0xA7,0x95,0x7E,0x9C,0x7D,0xA4,0x97,0xA6,0xA4,
+            0x91,0xA7,0xA8,0xA6,0xA2,0xA7,0xA4,0xA7,0xA4,0xA6,0xA9,0xA4,0xA1,0xA9,0xA9,0xA2,
+            0xA3,0xA5,0xAA,0xA5,0xA6,0xA9,0xA5,0x9E,0x99,0xA6,0xA8,0xA6,0xA6,0x9F,0xAA,0xA6,
+            0x9C,0xA5,0xA6,0xA1,0xA3,0xA2,0x9F,0xA9,0x8C,0x9B,0x9A,0x9C,0x98,0x9C,0x96,0x80,
+            0x97,0x7E,0x8C,0x92,0x81,0x85,0x92,0x85,0x99,0x97,0x91,0x8E,0x93,0x95,0x9E,0x9C,
+            0x96,0x98,0x97,0x87,0x95,0x97,0x92,0x91,0x96,0x96,0x9A,0x97,0x94,0x96,0x97,0x95,
+            0x92,0x92,0x91,0x94,0x9C,0x9A,0x96,0x96,0x79,0x7F,0x93,0x7D,0x95,0x97,0x93,0x92,
+            0x94,0x98,0x8E,0x8C,0x97,0x8D,0x90,0x94,0x8C,0x8D,0x8D,0x8D,0x8A,0x7F,0x75,0x49,
+            0x70,0x6E,0x75,0x76,0x7A,0x7E,0x86,0x87,0x82,0x7F,0x8A,0x8B,0x8E,0x8C,0x94,0x6A,
+            0x86,0x96,0x8D,0x96,0x90,0x84,0x91,0x99,0x94,0x9A,0x96,0x99,0x9A,0x98,0x9B,0x8E,
+            0x86,0x9A,0x99,0x9F,0x9E,0x96,0xA0,0xA0,0x95,0x96,0xA0,0x9F,0x9E,0x95,0x9F,0x9C,
+            0x97,0x7B,0xA0,0x9E,0x9F,0x98,0xA1,0x9F,0x9D,0x90,0x9A,0x99,0x91,0x94,0xA1,0x8C,
+            0x85,0x6D,0x97,0x9D,0x77,0x80,0x9C,0xA0,0x57,0x6B,0x98,0x97,0x66,0x7C,0x99,0x9B,
+            0x98,0x9E,0x9E,0x90,0x9E,0x91,0xA4,0xA3,0x9A,0x9E,0xA2,0x90,0x9B,0xA0,0xA0,0x9D,
+            0x9A,0x9E,0x8B,0x9D,0x77,0xA0,0x6D,0xA2,0x91,0xA1,0x96,0xA4,0xA1,0xA2,0xA0,0x7B,
+            0x9B,0xA0,0x8B,0x8F,0x7E,0x7D,0x97,0x9D,0x9F,0x9F,0xA4,0xA5,0x9F,0x9C,0xA1,0x7B,
+            0x81,0x8F,0xA3,0x77,0x7D,0x7F,0xA7,0xA3,0x8F,0x76,0x99,0x78,0x9C,0x90,0xA4,0x9E,
+            0x8C,0xA1,0xA3,0xA0,0x9B,0xA1,0xA2,0xA4,0xA2,0xA1,0xA6,0xA0,0x9B,0xA1,0xA5,0x97,
+            0x9E,0xA5,0xA7,0xA2,0x9F,0xA6,0xA8,0xA2,0x9D,0xA3,0xA0,0xA5,0xA1,0xA0,0xA6,0xA0,
+            0x98,0x9B,0xA6,0xA1,0xA1,0xA2,0xA5,0xA5,0x96,0x87,0x7A,0x9C,0x9F,0x97,0x91,0x84,
+            0x84,0x76,0x86,0x7E,0x7C,0x80,0x79,0x80,0x89,0x8F,0x80,0x85,0x7B,0x81,0x8A,0x86,
+            0x89,0x86,0x88,0x83,0x8B,0x81,0x7A,0x86,0x8D,0x7B,0x7A,0x84,0x86,0x7D,0x83,0x84,
+            0x8A,0x8D,0x72,0x95,0x89,0x8C,0x8F,0x8F,0x68,0x70,0x79,0x76,0x97,0x95,0x8D,0x91,
+            0x88,0x8B,0x82,0x84,0x8F,0x92,0x8A,0x89,0x8B,0x89,0x7F,0x8A,0x81,0x82,0x7A,0x42,
+            0x5A,0x68,0x76,0x6C,0x7A,0x80,0x85,0x6E,0x7F,0x80,0x82,0x89,0x8C,0x8B,0x92,0x45,
+            0x71,0x8F,0x8D,0x8F,0x8A,0x54,0x90,0x92,0x90,0x97,0x98,0x99,0x9E,0x9A,0x9A,0x77,
+            0x85,0x76,0x96,0x98,0x86,0x5C,0x9F,0x96,0x96,0x84,0x9D,0x9B,0x94,0x93,0x9B,0x90,
+            0x7C,0x58,0x9E,0x99,0x91,0x83,0x95,0x9D,0x92,0x76,0x98,0x86,0x7D,0x7D,0x9C,0x71,
+            0x74,0x52,0x81,0x80,0x5B,0x60,0x8D,0x8C,0x39,0x4F,0x7A,0x80,0x4A,0x5F,0x7F,0x7F,
+            0x5F,0x86,0x85,0x79,0x84,0x78,0x8C,0x89,0x77,0x7F,0x80,0x72,0x9D,0x8A,0x88,0x82,
+            0x88,0xA1,0x87,0x9C,0x75,0x9D,0x4B,0x93,0x8D,0x9A,0x81,0xA1,0xA3,0xA5,0x9F,0x94,
+            0x87,0x9E,0x86,0x85,0x54,0x67,0x8E,0x85,0x80,0x91,0xA3,0xA2,0x96,0x9A,0x84,0x67,
+            0x65,0x74,0xA3,0x5C,0x5F,0x59,0x9B,0x9A,0x7C,0x5C,0x8E,0x57,0x94,0x73,0x9D,0x92,
+            0x59,0x86,0x84,0x78,0x83,0x7F,0x8A,0x81,0x92,0x98,0xA8,0xA6,0xA2,0xA4,0xA8,0x8E,
+            0x86,0xA5,0xA6,0x7C,0xA4,0xA7,0xA6,0x93,0x85,0x8E,0xA1,0xA4,0xA7,0xA2,0xA8,0x9E,
+            0x81,0x8D,0x9B,0x91,0x6A,0x80,0x9C,0x98,0x65,0x6F,0x61,0x7E,0xA6,0x81,0x5A,0x67,
+            0x73,0x74,0x77,0x71,0x77,0x70,0x6C,0x65,0x75,0x7F,0x86,0x87,0x8D,0x8D,0x89,0x88,
+            0x69,0x7D,0x7B,0x7A,0x7B,0x72,0x7F,0x7F,0x99,0x8D,0xA0,0x8C,0xA2,0x92,0xA2,0x8D,
+            0x67,0x79,0x77,0x97,0xA0,0x99,0x8E,0x90,0x4F,0x4E,0xA1,0x5B,0xA0,0x9E,0x9D,0x90,
+            0x71,0x99,0x74,0x67,0x9C,0x99,0x70,0x7C,0x8D,0x93,0x91,0x89,0x88,0x83,0x79,0x2E,
+        };
+        // clang-format on
+
+        return frequencies;
+    }
+} // namespace mem
+
+#endif // MEM_BIGRAM_FREQUENCIES_BRICK_H
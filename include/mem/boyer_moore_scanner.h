@@ -21,6 +21,7 @@
 #define MEM_BOYER_MOORE_SCANNER_BRICK_H
 
 #include "pattern.h"
+#include "scan_stats.h"
 
 namespace mem
 {
@@ -47,6 +48,8 @@ namespace mem
         boyer_moore_scanner(const pattern& pattern, std::size_t min_bc_skip, std::size_t min_gs_skip);
 
         pointer scan(region range) const;
+
+        std::size_t pattern_size() const noexcept;
     };
 
     static constexpr const std::size_t default_min_bc_skip {5};
@@ -171,18 +174,25 @@ namespace mem
         return i;
     }
 
+    MEM_STRONG_INLINE std::size_t boyer_moore_scanner::pattern_size() const noexcept
+    {
+        return pattern_->size();
+    }
+
     inline pointer boyer_moore_scanner::scan(region range) const
     {
+        MEM_SCAN_STATS_SCOPE("boyer_moore_scanner", *pattern_, range);
+
         const std::size_t trimmed_size = pattern_->trimmed_size();
 
         if (!trimmed_size)
-            return nullptr;
+            return MEM_SCAN_STATS_RESULT(nullptr);
 
         const std::size_t original_size = pattern_->size();
         const std::size_t region_size = range.size;
 
         if (original_size > region_size)
-            return nullptr;
+            return MEM_SCAN_STATS_RESULT(nullptr);
 
         const byte* const region_base = range.start.as<const byte*>();
         const byte* const region_end = region_base + region_size;
@@ -213,18 +223,21 @@ namespace mem
                     if (MEM_LIKELY(skip != 0)) [[MEM_ATTR_LIKELY]]
                         continue;
 
+                    MEM_SCAN_STATS_ADD(anchor_hits, 1);
+
                     for (std::size_t i = last; MEM_LIKELY((current[i] & pat_masks[i]) == pat_bytes[i]); --i)
                     {
                         [[MEM_ATTR_LIKELY]];
 
                         if (MEM_UNLIKELY(i == 0)) [[MEM_ATTR_UNLIKELY]]
-                            return current;
+                            return MEM_SCAN_STATS_RESULT(current);
                     }
 
+                    MEM_SCAN_STATS_ADD(verify_failures, 1);
                     ++current;
                 }
 
-                return nullptr;
+                return MEM_SCAN_STATS_RESULT(nullptr);
             }
             else
             {
@@ -238,13 +251,13 @@ namespace mem
                         [[MEM_ATTR_LIKELY]];
 
                         if (MEM_UNLIKELY(i == 0)) [[MEM_ATTR_UNLIKELY]]
-                            return current;
+                            return MEM_SCAN_STATS_RESULT(current);
                     }
 
                     ++current;
                 }
 
-                return nullptr;
+                return MEM_SCAN_STATS_RESULT(nullptr);
             }
         }
         else
@@ -262,24 +275,28 @@ namespace mem
 
                     std::size_t i = last;
 
+                    MEM_SCAN_STATS_ADD(anchor_hits, *current == pat_bytes[i]);
+
                     while (MEM_LIKELY(*current == pat_bytes[i]))
                     {
                         [[MEM_ATTR_LIKELY]];
 
                         if (MEM_UNLIKELY(i == 0)) [[MEM_ATTR_UNLIKELY]]
-                            return current;
+                            return MEM_SCAN_STATS_RESULT(current);
 
                         --current;
                         --i;
                     }
 
+                    MEM_SCAN_STATS_ADD(verify_failures, i != last);
+
                     const std::size_t bc_skip = pat_skips[*current];
                     const std::size_t gs_skip = pat_suffixes[i];
 
                     current += (bc_skip > gs_skip) ? bc_skip : gs_skip;
                 }
 
-                return nullptr;
+                return MEM_SCAN_STATS_RESULT(nullptr);
             }
             else if (pat_skips)
             {
@@ -293,18 +310,21 @@ namespace mem
                     if (MEM_LIKELY(skip != 0)) [[MEM_ATTR_LIKELY]]
                         continue;
 
+                    MEM_SCAN_STATS_ADD(anchor_hits, 1);
+
                     for (std::size_t i = last; MEM_LIKELY(current[i] == pat_bytes[i]); --i)
                     {
                         [[MEM_ATTR_LIKELY]];
 
                         if (MEM_UNLIKELY(i == 0)) [[MEM_ATTR_UNLIKELY]]
-                            return current;
+                            return MEM_SCAN_STATS_RESULT(current);
                     }
 
+                    MEM_SCAN_STATS_ADD(verify_failures, 1);
                     ++current;
                 }
 
-                return nullptr;
+                return MEM_SCAN_STATS_RESULT(nullptr);
             }
             else
             {
@@ -317,13 +337,13 @@ namespace mem
                         [[MEM_ATTR_LIKELY]];
 
                         if (MEM_UNLIKELY(i == 0)) [[MEM_ATTR_UNLIKELY]]
-                            return current;
+                            return MEM_SCAN_STATS_RESULT(current);
                     }
 
                     ++current;
                 }
 
-                return nullptr;
+                return MEM_SCAN_STATS_RESULT(nullptr);
             }
         }
     }
@@ -0,0 +1,432 @@
+/*
+    Copyright 2018 Brick
+
+    Permission is hereby granted, free of charge, to any person obtaining a copy of this software
+    and associated documentation files (the "Software"), to deal in the Software without restriction,
+    including without limitation the rights to use, copy, modify, merge, publish, distribute,
+    sublicense, and/or sell copies of the Software, and to permit persons to whom the Software is
+    furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included in all copies or
+    substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING
+    BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+    NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM,
+    DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+    OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+*/
+
+#ifndef MEM_FUNCTION_INDEX_BRICK_H
+#define MEM_FUNCTION_INDEX_BRICK_H
+
+#include "module.h"
+#include "slice.h"
+
+#include <algorithm>
+#include <cstring>
+#include <vector>
+
+namespace mem
+{
+    // A sorted index of the function ranges in a module, read from its unwind tables.
+    // ELF modules use the binary search table in .eh_frame_hdr (or walk .eh_frame when the table is missing).
+    // PE modules use the RUNTIME_FUNCTION entries in .pdata, and so are only supported on x86-64.
+    // Functions without unwind information (such as leaf functions on Windows) are not included.
+    class function_index
+    {
+    private:
+        std::vector<region> functions_ {};
+
+    public:
+        function_index() = default;
+
+        explicit function_index(std::vector<region> functions);
+        explicit function_index(module image);
+
+        // Returns the function containing the address, or an empty region if there is none
+        region function_containing(pointer address) const noexcept;
+
+        // All functions which overlap the range
+        slice<const region> functions_in(region range) const noexcept;
+
+        // Calls func(function, address) for each match inside of a function in the range.
+        // Each function is scanned separately, so the matches are grouped by function, and matches which span
+        // the boundary between two functions are not found.
+        template <typename Scanner, typename Func>
+        pointer scan(Scanner& scanner, region range, Func func) const;
+
+        slice<const region> functions() const noexcept;
+
+        std::size_t size() const noexcept;
+    };
+
+#if defined(__unix__)
+    namespace internal
+    {
+        enum : byte
+        {
+            eh_pe_absptr = 0x00,
+            eh_pe_uleb128 = 0x01,
+            eh_pe_udata2 = 0x02,
+            eh_pe_udata4 = 0x03,
+            eh_pe_udata8 = 0x04,
+            eh_pe_sleb128 = 0x09,
+            eh_pe_sdata2 = 0x0A,
+            eh_pe_sdata4 = 0x0B,
+            eh_pe_sdata8 = 0x0C,
+
+            eh_pe_pcrel = 0x10,
+            eh_pe_datarel = 0x30,
+
+            eh_pe_indirect = 0x80,
+            eh_pe_omit = 0xFF,
+        };
+
+        template <typename T>
+        MEM_STRONG_INLINE T read_unaligned(const byte*& ptr) noexcept
+        {
+            T result;
+            std::memcpy(&result, ptr, sizeof(result));
+            ptr += sizeof(result);
+
+            return result;
+        }
+
+        inline std::uint64_t read_uleb128(const byte*& ptr) noexcept
+        {
+            std::uint64_t result = 0;
+            unsigned shift = 0;
+
+            while (true)
+            {
+                const byte value = *ptr++;
+
+                if (shift < 64)
+                    result |= std::uint64_t(value & 0x7F) << shift;
+
+                shift += 7;
+
+                if (!(value & 0x80))
+                    break;
+            }
+
+            return result;
+        }
+
+        inline std::int64_t read_sleb128(const byte*& ptr) noexcept
+        {
+            std::uint64_t result = 0;
+            unsigned shift = 0;
+            byte value;
+
+            do
+            {
+                value = *ptr++;
+
+                if (shift < 64)
+                    result |= std::uint64_t(value & 0x7F) << shift;
+
+                shift += 7;
+            } while (value & 0x80);
+
+            if ((shift < 64) && (value & 0x40))
+                result |= ~std::uint64_t(0) << shift;
+
+            return static_cast<std::int64_t>(result);
+        }
+
+        // Reads a pointer encoded with the eh_pe_* encoding. Returns false for unsupported encodings.
+        inline bool read_eh_pointer(const byte*& ptr, byte encoding, pointer data_base, std::uintptr_t& result) noexcept
+        {
+            result = 0;
+
+            if (encoding == eh_pe_omit)
+                return true;
+
+            const byte* const here = ptr;
+            std::uint64_t value = 0;
+
+            switch (encoding & 0x0F)
+            {
+                case eh_pe_absptr: value = read_unaligned<std::uintptr_t>(ptr); break;
+                case eh_pe_uleb128: value = read_uleb128(ptr); break;
+                case eh_pe_udata2: value = read_unaligned<std::uint16_t>(ptr); break;
+                case eh_pe_udata4: value = read_unaligned<std::uint32_t>(ptr); break;
+                case eh_pe_udata8: value = read_unaligned<std::uint64_t>(ptr); break;
+                case eh_pe_sleb128: value = static_cast<std::uint64_t>(read_sleb128(ptr)); break;
+                case eh_pe_sdata2: value = static_cast<std::uint64_t>(read_unaligned<std::int16_t>(ptr)); break;
+                case eh_pe_sdata4: value = static_cast<std::uint64_t>(read_unaligned<std::int32_t>(ptr)); break;
+                case eh_pe_sdata8: value = static_cast<std::uint64_t>(read_unaligned<std::int64_t>(ptr)); break;
+                default: return false;
+            }
+
+            switch (encoding & 0x70)
+            {
+                case eh_pe_absptr: break;
+                case eh_pe_pcrel: value += pointer(here).as<std::uintptr_t>(); break;
+                case eh_pe_datarel: value += data_base.as<std::uintptr_t>(); break;
+                default: return false;
+            }
+
+            result = static_cast<std::uintptr_t>(value);
+
+            if (encoding & eh_pe_indirect)
+                result = pointer(result).as<const std::uintptr_t&>();
+
+            return true;
+        }
+
+        // Returns the FDE pointer encoding of a CIE, from the 'R' entry of its augmentation
+        inline byte read_cie_fde_encoding(const byte* cie) noexcept
+        {
+            std::uint64_t length = read_unaligned<std::uint32_t>(cie);
+
+            if (length == 0xFFFFFFFF)
+                cie += 8;
+
+            cie += 4; // CIE ID
+
+            const byte version = *cie++;
+            const char* const augmentation = reinterpret_cast<const char*>(cie);
+            cie += std::strlen(augmentation) + 1;
+
+            if (augmentation[0] != 'z')
+                return eh_pe_absptr;
+
+            read_uleb128(cie); // Code alignment factor
+            read_sleb128(cie); // Data alignment factor
+
+            if (version == 1)
+                ++cie; // Return address register
+            else
+                read_uleb128(cie);
+
+            read_uleb128(cie); // Augmentation data length
+
+            for (const char* aug = augmentation + 1; *aug; ++aug)
+            {
+                switch (*aug)
+                {
+                    case 'R': return *cie;
+
+                    case 'L': ++cie; break;
+
+                    case 'P':
+                    {
+                        const byte encoding = *cie++;
+                        std::uintptr_t personality;
+
+                        if (!read_eh_pointer(cie, encoding, nullptr, personality))
+                            return eh_pe_omit;
+
+                        break;
+                    }
+
+                    case 'S':
+                    case 'B': break;
+
+                    default: return eh_pe_omit;
+                }
+            }
+
+            return eh_pe_absptr;
+        }
+
+        // Reads the range of an FDE, returning nullptr once the terminator is reached
+        inline const byte* read_fde_range(const byte* fde, region& result) noexcept
+        {
+            result = region();
+
+            const byte* ptr = fde;
+            std::uint64_t length = read_unaligned<std::uint32_t>(ptr);
+
+            if (length == 0)
+                return nullptr;
+
+            if (length == 0xFFFFFFFF)
+                length = read_unaligned<std::uint64_t>(ptr);
+
+            const byte* const next = ptr + length;
+            const byte* const id_ptr = ptr;
+            const std::uint32_t cie_offset = read_unaligned<std::uint32_t>(ptr);
+
+            if (cie_offset == 0) // This is a CIE
+                return next;
+
+            const byte encoding = read_cie_fde_encoding(id_ptr - cie_offset);
+
+            if (encoding == eh_pe_omit)
+                return next;
+
+            std::uintptr_t pc_begin = 0;
+            std::uintptr_t pc_range = 0;
+
+            if (read_eh_pointer(ptr, encoding, nullptr, pc_begin) &&
+                read_eh_pointer(ptr, encoding & 0x0F, nullptr, pc_range))
+                result = region(pc_begin, pc_range);
+
+            return next;
+        }
+    } // namespace internal
+#endif
+
+    inline function_index::function_index(std::vector<region> functions)
+        : functions_(std::move(functions))
+    {
+        functions_.erase(std::remove_if(functions_.begin(), functions_.end(),
+                             [](const region& function) { return (function.size == 0) || !function.start; }),
+            functions_.end());
+
+        std::sort(functions_.begin(), functions_.end(),
+            [](const region& lhs, const region& rhs) { return lhs.start < rhs.start; });
+    }
+
+#if defined(_WIN32)
+    inline function_index::function_index(module image)
+    {
+        std::vector<region> functions;
+
+#    if defined(MEM_ARCH_X86_64)
+        const IMAGE_DATA_DIRECTORY& exception_data_dir =
+            image.nt_headers().OptionalHeader.DataDirectory[IMAGE_DIRECTORY_ENTRY_EXCEPTION];
+
+        const std::size_t count = exception_data_dir.Size / sizeof(IMAGE_RUNTIME_FUNCTION_ENTRY);
+        const IMAGE_RUNTIME_FUNCTION_ENTRY* entries =
+            image.start.add(exception_data_dir.VirtualAddress).as<const IMAGE_RUNTIME_FUNCTION_ENTRY*>();
+
+        functions.reserve(count);
+
+        for (std::size_t i = 0; i < count; ++i)
+        {
+            if (entries[i].EndAddress > entries[i].BeginAddress)
+            {
+                functions.emplace_back(
+                    image.start.add(entries[i].BeginAddress), entries[i].EndAddress - entries[i].BeginAddress);
+            }
+        }
+#    endif
+
+        *this = function_index(std::move(functions));
+    }
+#elif defined(__unix__)
+    inline function_index::function_index(module image)
+    {
+        const pointer bias = image.load_bias();
+
+        std::vector<region> functions;
+
+        for (const ElfW(Phdr) & segment : image.program_headers())
+        {
+            if (segment.p_type != PT_GNU_EH_FRAME)
+                continue;
+
+            const byte* const header = bias.add(segment.p_vaddr).as<const byte*>();
+
+            if (header[0] != 1) // Version
+                break;
+
+            const byte eh_frame_ptr_enc = header[1];
+            const byte fde_count_enc = header[2];
+            const byte table_enc = header[3];
+
+            const byte* ptr = header + 4;
+            std::uintptr_t eh_frame = 0;
+            std::uintptr_t fde_count = 0;
+
+            if (!internal::read_eh_pointer(ptr, eh_frame_ptr_enc, header, eh_frame) ||
+                !internal::read_eh_pointer(ptr, fde_count_enc, header, fde_count))
+                break;
+
+            region function;
+
+            if ((fde_count_enc != internal::eh_pe_omit) && (table_enc != internal::eh_pe_omit))
+            {
+                functions.reserve(fde_count);
+
+                for (std::size_t i = 0; i < fde_count; ++i)
+                {
+                    std::uintptr_t initial_loc = 0;
+                    std::uintptr_t fde = 0;
+
+                    if (!internal::read_eh_pointer(ptr, table_enc, header, initial_loc) ||
+                        !internal::read_eh_pointer(ptr, table_enc, header, fde))
+                        break;
+
+                    internal::read_fde_range(pointer(fde).as<const byte*>(), function);
+                    functions.push_back(function);
+                }
+            }
+            else if (eh_frame)
+            {
+                for (const byte* fde = pointer(eh_frame).as<const byte*>(); fde;)
+                {
+                    fde = internal::read_fde_range(fde, function);
+                    functions.push_back(function);
+                }
+            }
+
+            break;
+        }
+
+        *this = function_index(std::move(functions));
+    }
+#endif
+
+    inline region function_index::function_containing(pointer address) const noexcept
+    {
+        auto iter = std::upper_bound(functions_.begin(), functions_.end(), address,
+            [](pointer lhs, const region& rhs) { return lhs < rhs.start; });
+
+        if ((iter != functions_.begin()) && (iter - 1)->contains(address))
+            return *(iter - 1);
+
+        return region();
+    }
+
+    inline slice<const region> function_index::functions_in(region range) const noexcept
+    {
+        auto first = std::upper_bound(functions_.begin(), functions_.end(), range.start,
+            [](pointer lhs, const region& rhs) { return lhs < rhs.start; });
+
+        if ((first != functions_.begin()) && (first - 1)->contains(range.start))
+            --first;
+
+        const auto last = std::lower_bound(first, functions_.end(), range.start + range.size,
+            [](const region& lhs, pointer rhs) { return lhs.start < rhs; });
+
+        return {functions_.data() + (first - functions_.begin()), functions_.data() + (last - functions_.begin())};
+    }
+
+    template <typename Scanner, typename Func>
+    inline pointer function_index::scan(Scanner& scanner, region range, Func func) const
+    {
+        const pointer range_end = range.start + range.size;
+
+        for (const region& function : functions_in(range))
+        {
+            const pointer start = (std::max)(function.start, range.start);
+            const pointer end = (std::min)(function.start + function.size, range_end);
+
+            const pointer result = scanner(region(start, static_cast<std::size_t>(end - start)),
+                [&function, &func](pointer address) { return func(function, address); });
+
+            if (result)
+                return result;
+        }
+
+        return nullptr;
+    }
+
+    MEM_STRONG_INLINE slice<const region> function_index::functions() const noexcept
+    {
+        return {functions_.data(), functions_.size()};
+    }
+
+    MEM_STRONG_INLINE std::size_t function_index::size() const noexcept
+    {
+        return functions_.size();
+    }
+} // namespace mem
+
+#endif // MEM_FUNCTION_INDEX_BRICK_H
@@ -22,6 +22,9 @@
 
 #include "defines.h"
 
+#include <cstring>
+#include <type_traits>
+
 namespace mem
 {
     class hasher
@@ -40,6 +43,17 @@ namespace mem
         std::uint32_t digest() const noexcept;
     };
 
+    // Hashes and compares null-terminated strings, for containers keyed on strings which outlive them
+    struct string_hash
+    {
+        std::size_t operator()(const char* string) const noexcept;
+    };
+
+    struct string_equal
+    {
+        bool operator()(const char* lhs, const char* rhs) const noexcept;
+    };
+
     MEM_STRONG_INLINE hasher::hasher(std::uint32_t seed) noexcept
         : hash_(seed)
     {}
@@ -76,6 +90,20 @@ namespace mem
 
         return hash;
     }
+
+    MEM_STRONG_INLINE std::size_t string_hash::operator()(const char* string) const noexcept
+    {
+        hasher hash;
+
+        hash.update(string, std::strlen(string));
+
+        return hash.digest();
+    }
+
+    MEM_STRONG_INLINE bool string_equal::operator()(const char* lhs, const char* rhs) const noexcept
+    {
+        return !std::strcmp(lhs, rhs);
+    }
 } // namespace mem
 
 #endif // MEM_HASHER_BRICK_H
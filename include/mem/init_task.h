@@ -0,0 +1,368 @@
+/*
+    Copyright 2018 Brick
+
+    Permission is hereby granted, free of charge, to any person obtaining a copy of this software
+    and associated documentation files (the "Software"), to deal in the Software without restriction,
+    including without limitation the rights to use, copy, modify, merge, publish, distribute,
+    sublicense, and/or sell copies of the Software, and to permit persons to whom the Software is
+    furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included in all copies or
+    substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING
+    BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+    NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM,
+    DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+    OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+*/
+
+#ifndef MEM_INIT_TASK_BRICK_H
+#define MEM_INIT_TASK_BRICK_H
+
+#include "defines.h"
+#include "macros.h"
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstdio>
+#include <cstring>
+#include <deque>
+#include <initializer_list>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace mem
+{
+    struct init_task_timing
+    {
+        const char* name;
+        std::chrono::nanoseconds duration;
+        std::size_t thread;
+    };
+
+    struct init_report
+    {
+        // Sorted from slowest to fastest
+        std::vector<init_task_timing> timings;
+        std::chrono::nanoseconds wall_time;
+        std::size_t thread_count;
+
+        // Prints the wall time, followed by the slowest tasks
+        void print(std::FILE* output, std::size_t max_count = SIZE_MAX) const;
+    };
+
+    // Like init_function, but the callbacks are run in parallel on a work stealing thread pool.
+    // A task only starts once all of the tasks it depends on (by name) have finished. Unknown dependencies are
+    // ignored, and tasks which are part of a dependency cycle are run one at a time once everything else is done.
+    // Targets including this header need to link against the platform's thread library
+    // (e.g. Threads::Threads in CMake).
+    class init_task
+    {
+    public:
+        using callback_t = void (*)();
+
+        init_task(const char* name, callback_t callback, std::initializer_list<const char*> dependencies = {});
+        init_task(init_task*& parent, const char* name, callback_t callback,
+            std::initializer_list<const char*> dependencies = {});
+
+        init_task(const init_task&) = delete;
+        init_task(init_task&&) = delete;
+
+        // Runs every task, using up to thread_count threads (or one per hardware thread, if zero)
+        static init_report run(std::size_t thread_count = 0, init_task*& root = ROOT(), bool clear = true);
+
+        static init_task*& ROOT() noexcept;
+
+    private:
+        const char* name_ {nullptr};
+        callback_t callback_ {nullptr};
+        std::vector<const char*> dependencies_ {};
+        init_task* next_ {nullptr};
+    };
+
+    namespace internal
+    {
+        class init_task_pool
+        {
+        public:
+            using clock = std::chrono::steady_clock;
+
+            struct node
+            {
+                const char* name;
+                void (*callback)();
+                std::vector<std::size_t> dependents;
+                std::atomic<std::size_t> remaining;
+                bool finished;
+            };
+
+            init_task_pool(std::vector<node>& nodes, std::vector<init_task_timing>& timings, std::size_t threads);
+
+            void run();
+
+        private:
+            struct worker_queue
+            {
+                std::mutex lock;
+                std::deque<std::size_t> tasks;
+            };
+
+            std::vector<node>& nodes_;
+            std::vector<init_task_timing>& timings_;
+            std::vector<worker_queue> queues_;
+
+            // The number of tasks which are queued or running
+            std::atomic<std::size_t> outstanding_ {0};
+
+            std::mutex wake_lock_;
+            std::condition_variable wake_;
+
+            void push(std::size_t thread, std::size_t task);
+            bool pop(std::size_t thread, std::size_t& task);
+            void work(std::size_t thread);
+        };
+
+        inline init_task_pool::init_task_pool(
+            std::vector<node>& nodes, std::vector<init_task_timing>& timings, std::size_t threads)
+            : nodes_(nodes)
+            , timings_(timings)
+            , queues_(threads)
+        {}
+
+        inline void init_task_pool::push(std::size_t thread, std::size_t task)
+        {
+            {
+                std::lock_guard<std::mutex> guard(queues_[thread].lock);
+                queues_[thread].tasks.push_back(task);
+            }
+
+            std::lock_guard<std::mutex> guard(wake_lock_);
+            wake_.notify_one();
+        }
+
+        inline bool init_task_pool::pop(std::size_t thread, std::size_t& task)
+        {
+            // Take the newest task from our own queue, otherwise steal the oldest task from another queue
+            {
+                std::lock_guard<std::mutex> guard(queues_[thread].lock);
+
+                if (!queues_[thread].tasks.empty())
+                {
+                    task = queues_[thread].tasks.back();
+                    queues_[thread].tasks.pop_back();
+
+                    return true;
+                }
+            }
+
+            for (std::size_t i = 1; i < queues_.size(); ++i)
+            {
+                worker_queue& victim = queues_[(thread + i) % queues_.size()];
+
+                std::lock_guard<std::mutex> guard(victim.lock);
+
+                if (!victim.tasks.empty())
+                {
+                    task = victim.tasks.front();
+                    victim.tasks.pop_front();
+
+                    return true;
+                }
+            }
+
+            return false;
+        }
+
+        inline void init_task_pool::work(std::size_t thread)
+        {
+            while (outstanding_ != 0)
+            {
+                std::size_t task;
+
+                if (!pop(thread, task))
+                {
+                    std::unique_lock<std::mutex> guard(wake_lock_);
+
+                    if (outstanding_ != 0)
+                        wake_.wait_for(guard, std::chrono::milliseconds(1));
+
+                    continue;
+                }
+
+                node& current = nodes_[task];
+
+                const clock::time_point start = clock::now();
+                current.callback();
+                const clock::time_point end = clock::now();
+
+                timings_[task] = {current.name, end - start, thread};
+                current.finished = true;
+
+                for (std::size_t dependent : current.dependents)
+                {
+                    if (--nodes_[dependent].remaining == 0)
+                    {
+                        ++outstanding_;
+                        push(thread, dependent);
+                    }
+                }
+
+                if (--outstanding_ == 0)
+                {
+                    std::lock_guard<std::mutex> guard(wake_lock_);
+                    wake_.notify_all();
+                }
+            }
+        }
+
+        inline void init_task_pool::run()
+        {
+            std::size_t next = 0;
+
+            for (std::size_t i = 0; i < nodes_.size(); ++i)
+            {
+                if (nodes_[i].remaining == 0)
+                {
+                    ++outstanding_;
+                    queues_[next++ % queues_.size()].tasks.push_back(i);
+                }
+            }
+
+            std::vector<std::thread> threads;
+            threads.reserve(queues_.size() - 1);
+
+            for (std::size_t i = 1; i < queues_.size(); ++i)
+                threads.emplace_back(&init_task_pool::work, this, i);
+
+            work(0);
+
+            for (std::thread& thread : threads)
+                thread.join();
+        }
+    } // namespace internal
+
+    inline void init_report::print(std::FILE* output, std::size_t max_count) const
+    {
+        std::fprintf(output, "%zu init tasks took %.3f ms on %zu threads\n", timings.size(),
+            static_cast<double>(wall_time.count()) / 1e6, thread_count);
+
+        for (std::size_t i = 0; (i < timings.size()) && (i < max_count); ++i)
+        {
+            std::fprintf(output, "%10.3f ms  [%zu] %s\n", static_cast<double>(timings[i].duration.count()) / 1e6,
+                timings[i].thread, timings[i].name ? timings[i].name : "<unnamed>");
+        }
+    }
+
+    inline init_task::init_task(
+        const char* name, callback_t callback, std::initializer_list<const char*> dependencies)
+        : init_task(ROOT(), name, callback, dependencies)
+    {}
+
+    inline init_task::init_task(init_task*& parent, const char* name, callback_t callback,
+        std::initializer_list<const char*> dependencies)
+        : name_(name)
+        , callback_(callback)
+        , dependencies_(dependencies)
+        , next_(parent)
+    {
+        parent = this;
+    }
+
+    MEM_STRONG_INLINE init_task*& init_task::ROOT() noexcept
+    {
+        static init_task* root {nullptr};
+
+        return root;
+    }
+
+    inline init_report init_task::run(std::size_t thread_count, init_task*& root, bool clear)
+    {
+        using clock = internal::init_task_pool::clock;
+
+        const clock::time_point start = clock::now();
+
+        std::vector<init_task*> tasks;
+
+        for (init_task* i = root; i; i = i->next_)
+        {
+            if (i->callback_)
+                tasks.push_back(i);
+        }
+
+        // The list is built in reverse order of construction
+        std::reverse(tasks.begin(), tasks.end());
+
+        if (clear)
+        {
+            for (init_task* i = root; i;)
+            {
+                init_task* j = i->next_;
+                i->next_ = nullptr;
+                i = j;
+            }
+
+            root = nullptr;
+        }
+
+        std::vector<internal::init_task_pool::node> nodes(tasks.size());
+
+        for (std::size_t i = 0; i < tasks.size(); ++i)
+        {
+            nodes[i].name = tasks[i]->name_;
+            nodes[i].callback = tasks[i]->callback_;
+            nodes[i].remaining = 0;
+            nodes[i].finished = false;
+        }
+
+        for (std::size_t i = 0; i < tasks.size(); ++i)
+        {
+            for (const char* dependency : tasks[i]->dependencies_)
+            {
+                for (std::size_t j = 0; j < tasks.size(); ++j)
+                {
+                    if ((j != i) && tasks[j]->name_ && !std::strcmp(tasks[j]->name_, dependency))
+                    {
+                        nodes[j].dependents.push_back(i);
+                        ++nodes[i].remaining;
+                    }
+                }
+            }
+
+            if (clear)
+                tasks[i]->callback_ = nullptr;
+        }
+
+        if (thread_count == 0)
+            thread_count = (std::max<std::size_t>)(std::thread::hardware_concurrency(), 1);
+
+        thread_count = (std::min)(thread_count, (std::max<std::size_t>)(tasks.size(), 1));
+
+        std::vector<init_task_timing> timings(tasks.size());
+
+        internal::init_task_pool(nodes, timings, thread_count).run();
+
+        // Anything left over is part of a cycle
+        for (std::size_t i = 0; i < nodes.size(); ++i)
+        {
+            if (!nodes[i].finished)
+            {
+                const clock::time_point task_start = clock::now();
+                nodes[i].callback();
+                timings[i] = {nodes[i].name, clock::now() - task_start, 0};
+            }
+        }
+
+        std::stable_sort(timings.begin(), timings.end(),
+            [](const init_task_timing& lhs, const init_task_timing& rhs) { return lhs.duration > rhs.duration; });
+
+        return {std::move(timings), clock::now() - start, thread_count};
+    }
+} // namespace mem
+
+#define mem_run_task static mem::init_task mem_paste(run_task_, __LINE__)
+
+#endif // MEM_INIT_TASK_BRICK_H
@@ -0,0 +1,396 @@
+/*
+    Copyright 2018 Brick
+
+    Permission is hereby granted, free of charge, to any person obtaining a copy of this software
+    and associated documentation files (the "Software"), to deal in the Software without restriction,
+    including without limitation the rights to use, copy, modify, merge, publish, distribute,
+    sublicense, and/or sell copies of the Software, and to permit persons to whom the Software is
+    furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included in all copies or
+    substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING
+    BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+    NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM,
+    DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+    OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+*/
+
+#ifndef MEM_ITANIUM_RTTI_BRICK_H
+#define MEM_ITANIUM_RTTI_BRICK_H
+
+#include "hasher.h"
+#include "module.h"
+
+#if defined(_MSC_VER)
+#    error mem::itanium_rtti requires the Itanium C++ ABI
+#endif
+
+#if !defined(MEM_ITANIUM_RTTI_USE_GENERIC)
+#    if defined(MEM_SIMD_AVX2)
+#        include <immintrin.h>
+#    elif defined(MEM_SIMD_SSE2)
+#        include <emmintrin.h>
+#    else
+#        define MEM_ITANIUM_RTTI_USE_GENERIC
+#    endif
+#endif
+
+#if !defined(MEM_ITANIUM_RTTI_USE_GENERIC)
+#    include "arch.h"
+#endif
+
+#include <algorithm>
+#include <cstring>
+#include <typeinfo>
+#include <unordered_map>
+#include <vector>
+
+namespace mem
+{
+    namespace itanium_rtti
+    {
+        struct class_type_info;
+        struct si_class_type_info;
+        struct vmi_class_type_info;
+        struct base_class_type_info;
+
+        struct class_type_info // __cxxabiv1::__class_type_info
+        {
+            const void* vtable;
+            const char* name;
+        };
+
+        struct si_class_type_info // __cxxabiv1::__si_class_type_info
+        {
+            class_type_info type;
+            const class_type_info* base_type;
+        };
+
+        struct base_class_type_info // __cxxabiv1::__base_class_type_info
+        {
+            const class_type_info* base_type;
+            long offset_flags; // bit 0 set = virtual, bit 1 set = public, offset in the upper bits
+        };
+
+        struct vmi_class_type_info // __cxxabiv1::__vmi_class_type_info
+        {
+            class_type_info type;
+            unsigned int flags;
+            unsigned int base_count;
+            base_class_type_info base_info[1];
+        };
+
+        enum class type_kind : std::uint8_t
+        {
+            class_type,
+            si_class_type,
+            vmi_class_type,
+        };
+
+        // The address points of the __cxxabiv1 type_info vtables, as stored in the first slot of every type_info
+        struct abi_vtables
+        {
+            pointer class_type {nullptr};
+            pointer si_class_type {nullptr};
+            pointer vmi_class_type {nullptr};
+
+            static abi_vtables current() noexcept;
+        };
+
+        struct type_entry
+        {
+            const class_type_info* type {nullptr};
+            type_kind kind {type_kind::class_type};
+
+            // Address points of every vtable which references this type
+            std::vector<pointer> vtables {};
+
+            const char* name() const noexcept;
+        };
+
+        class type_index
+        {
+        private:
+            std::vector<type_entry> types_ {};
+            std::unordered_map<const char*, std::size_t, string_hash, string_equal> names_ {};
+
+        public:
+            type_index() = default;
+
+            explicit type_index(module range, const abi_vtables& abi = abi_vtables::current());
+
+            const type_entry* find_type(const char* name) const;
+            const type_entry* find_type(const class_type_info* type) const;
+
+            template <typename Func>
+            void enum_types(Func func) const;
+
+            std::size_t size() const noexcept;
+        };
+
+        namespace internal
+        {
+            struct abi_base
+            {};
+
+            struct abi_other_base
+            {};
+
+            struct abi_single : abi_base
+            {};
+
+            struct abi_multiple
+                : abi_base
+                , abi_other_base
+            {};
+
+            template <typename T>
+            MEM_STRONG_INLINE pointer get_type_vtable() noexcept
+            {
+                return pointer(&typeid(T)).at<const pointer>(0);
+            }
+
+            template <typename Func>
+            inline void scan_pointer_values(region range, const std::uintptr_t (&values)[3], Func func);
+
+            inline bool is_type_name(const char* name) noexcept;
+        } // namespace internal
+
+        inline abi_vtables abi_vtables::current() noexcept
+        {
+            abi_vtables result;
+
+            result.class_type = internal::get_type_vtable<internal::abi_base>();
+            result.si_class_type = internal::get_type_vtable<internal::abi_single>();
+            result.vmi_class_type = internal::get_type_vtable<internal::abi_multiple>();
+
+            return result;
+        }
+
+        MEM_STRONG_INLINE const char* type_entry::name() const noexcept
+        {
+            const char* result = type->name;
+
+            // Types which are not guaranteed to have a unique name (such as those in anonymous namespaces) are prefixed with '*'
+            return (*result == '*') ? result + 1 : result;
+        }
+
+        template <typename Func>
+        inline void internal::scan_pointer_values(region range, const std::uintptr_t (&values)[3], Func func)
+        {
+            const byte* ptr = range.start.align_up(sizeof(void*)).as<const byte*>();
+            const byte* const end = range.start.add(range.size).align_down(sizeof(void*)).as<const byte*>();
+
+#if !defined(MEM_ITANIUM_RTTI_USE_GENERIC)
+#    if defined(MEM_SIMD_AVX2)
+#        define l_SIMD_TYPE __m256i
+#        define l_SIMD_LOAD(x) _mm256_loadu_si256(reinterpret_cast<const __m256i*>(x))
+#        define l_SIMD_OR(x, y) _mm256_or_si256(x, y)
+#        if defined(MEM_ARCH_X86_64)
+#            define l_SIMD_FILL(x) _mm256_set1_epi64x(static_cast<long long>(x))
+#            define l_SIMD_CMPEQ(x, y) _mm256_cmpeq_epi64(x, y)
+#            define l_SIMD_MOVEMASK(x) _mm256_movemask_pd(_mm256_castsi256_pd(x))
+#        else
+#            define l_SIMD_FILL(x) _mm256_set1_epi32(static_cast<int>(x))
+#            define l_SIMD_CMPEQ(x, y) _mm256_cmpeq_epi32(x, y)
+#            define l_SIMD_MOVEMASK(x) _mm256_movemask_ps(_mm256_castsi256_ps(x))
+#        endif
+#    elif defined(MEM_SIMD_SSE2)
+#        define l_SIMD_TYPE __m128i
+#        define l_SIMD_LOAD(x) _mm_loadu_si128(reinterpret_cast<const __m128i*>(x))
+#        define l_SIMD_OR(x, y) _mm_or_si128(x, y)
+#        if defined(MEM_ARCH_X86_64)
+#            define l_SIMD_FILL(x) _mm_set1_epi64x(static_cast<long long>(x))
+// SSE2 has no 64-bit compare, so require both halves to match
+#            define l_SIMD_CMPEQ(x, y) \
+                _mm_and_si128(_mm_cmpeq_epi32(x, y), _mm_shuffle_epi32(_mm_cmpeq_epi32(x, y), 0xB1))
+#            define l_SIMD_MOVEMASK(x) _mm_movemask_pd(_mm_castsi128_pd(x))
+#        else
+#            define l_SIMD_FILL(x) _mm_set1_epi32(static_cast<int>(x))
+#            define l_SIMD_CMPEQ(x, y) _mm_cmpeq_epi32(x, y)
+#            define l_SIMD_MOVEMASK(x) _mm_movemask_ps(_mm_castsi128_ps(x))
+#        endif
+#    else
+#        error Sorry, No Potatoes
+#    endif
+
+            const l_SIMD_TYPE value0 = l_SIMD_FILL(values[0]);
+            const l_SIMD_TYPE value1 = l_SIMD_FILL(values[1]);
+            const l_SIMD_TYPE value2 = l_SIMD_FILL(values[2]);
+
+            while (MEM_LIKELY((end - ptr) >= static_cast<std::ptrdiff_t>(sizeof(l_SIMD_TYPE))))
+            {
+                const l_SIMD_TYPE current = l_SIMD_LOAD(ptr);
+
+                unsigned int mask = static_cast<unsigned int>(l_SIMD_MOVEMASK(l_SIMD_OR(
+                    l_SIMD_OR(l_SIMD_CMPEQ(current, value0), l_SIMD_CMPEQ(current, value1)),
+                    l_SIMD_CMPEQ(current, value2))));
+
+                while (MEM_UNLIKELY(mask != 0))
+                {
+                    if (func(pointer(ptr + (bsf(mask) * sizeof(void*)))))
+                        return;
+
+                    mask &= mask - 1;
+                }
+
+                ptr += sizeof(l_SIMD_TYPE);
+            }
+
+#    undef l_SIMD_TYPE
+#    undef l_SIMD_LOAD
+#    undef l_SIMD_OR
+#    undef l_SIMD_FILL
+#    undef l_SIMD_CMPEQ
+#    undef l_SIMD_MOVEMASK
+#endif
+
+            for (; ptr < end; ptr += sizeof(void*))
+            {
+                const std::uintptr_t value = *reinterpret_cast<const std::uintptr_t*>(ptr);
+
+                if ((value == values[0]) || (value == values[1]) || (value == values[2]))
+                {
+                    if (func(pointer(ptr)))
+                        return;
+                }
+            }
+        }
+
+        inline bool internal::is_type_name(const char* name) noexcept
+        {
+            if (*name == '*')
+                ++name;
+
+            // <nested-name>, <substitution>, <local-name> or <source-name>
+            return (*name == 'N') || (*name == 'S') || (*name == 'Z') || ((*name >= '1') && (*name <= '9'));
+        }
+
+        inline type_index::type_index(module range, const abi_vtables& abi)
+        {
+            const std::uintptr_t abi_values[3] {abi.class_type.as<std::uintptr_t>(),
+                abi.si_class_type.as<std::uintptr_t>(), abi.vmi_class_type.as<std::uintptr_t>()};
+
+            std::vector<region> segments;
+
+            range.enum_segments([&segments](region segment, prot_flags prot) {
+                if (prot & prot_flags::R)
+                    segments.push_back(segment);
+
+                return false;
+            });
+
+            std::unordered_map<std::uintptr_t, std::size_t> addresses;
+
+            for (region segment : segments)
+            {
+                internal::scan_pointer_values(segment, abi_values, [&](pointer address) {
+                    if (!segment.contains<class_type_info>(address))
+                        return false;
+
+                    const class_type_info& type = address.as<const class_type_info&>();
+
+                    if (!range.contains(type.name) || !internal::is_type_name(type.name))
+                        return false;
+
+                    type_entry entry;
+                    entry.type = &type;
+
+                    const pointer vtable = type.vtable;
+
+                    if (vtable == abi.si_class_type)
+                        entry.kind = type_kind::si_class_type;
+                    else if (vtable == abi.vmi_class_type)
+                        entry.kind = type_kind::vmi_class_type;
+                    else
+                        entry.kind = type_kind::class_type;
+
+                    if (names_.emplace(entry.name(), types_.size()).second)
+                    {
+                        addresses.emplace(address.as<std::uintptr_t>(), types_.size());
+                        types_.push_back(std::move(entry));
+                    }
+
+                    return false;
+                });
+            }
+
+            if (types_.empty())
+                return;
+
+            std::uintptr_t min_type = UINTPTR_MAX;
+            std::uintptr_t max_type = 0;
+
+            for (const auto& address : addresses)
+            {
+                min_type = (std::min)(min_type, address.first);
+                max_type = (std::max)(max_type, address.first);
+            }
+
+            // A vtable is preceded by its offset-to-top and type_info pointer.
+            // The offset-to-top is zero for the primary vtable, and negative for secondary vtables.
+            for (region segment : segments)
+            {
+                const std::uintptr_t* slot = segment.start.align_up(sizeof(void*)).as<const std::uintptr_t*>();
+                const std::uintptr_t* const end =
+                    segment.start.add(segment.size).align_down(sizeof(void*)).as<const std::uintptr_t*>();
+
+                if (slot >= end)
+                    continue;
+
+                for (++slot; slot < end; ++slot)
+                {
+                    const std::uintptr_t value = *slot;
+
+                    if (MEM_LIKELY((value < min_type) || (value > max_type)))
+                        continue;
+
+                    const std::intptr_t offset_to_top = static_cast<std::intptr_t>(slot[-1]);
+
+                    if ((offset_to_top > 0) || (offset_to_top < -0x10000000) ||
+                        (offset_to_top % static_cast<std::intptr_t>(sizeof(void*))))
+                        continue;
+
+                    const auto find = addresses.find(value);
+
+                    if (find != addresses.end())
+                        types_[find->second].vtables.push_back(slot + 1);
+                }
+            }
+        }
+
+        inline const type_entry* type_index::find_type(const char* name) const
+        {
+            if (*name == '*')
+                ++name;
+
+            const auto find = names_.find(name);
+
+            return (find != names_.end()) ? &types_[find->second] : nullptr;
+        }
+
+        inline const type_entry* type_index::find_type(const class_type_info* type) const
+        {
+            return find_type(type->name);
+        }
+
+        template <typename Func>
+        inline void type_index::enum_types(Func func) const
+        {
+            for (const type_entry& type : types_)
+            {
+                if (func(type))
+                    break;
+            }
+        }
+
+        MEM_STRONG_INLINE std::size_t type_index::size() const noexcept
+        {
+            return types_.size();
+        }
+    } // namespace itanium_rtti
+} // namespace mem
+
+#endif // MEM_ITANIUM_RTTI_BRICK_H
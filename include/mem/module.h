@@ -24,14 +24,21 @@
 #include "prot_flags.h"
 #include "slice.h"
 
+#include <climits>
 #include <cstdio>
 #include <cstdlib>
+#include <cstring>
 #include <memory>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <vector>
 
 #if defined(_WIN32)
 #    if !defined(WIN32_LEAN_AND_MEAN)
 #        define WIN32_LEAN_AND_MEAN
 #    endif
+#    include "pe_image.h"
 #    include <Windows.h>
 #    include <intrin.h>
 #    if defined(_WIN64)
@@ -53,6 +60,40 @@
 
 namespace mem
 {
+#if defined(_WIN32)
+    using export_table = pe_export_table;
+#elif defined(__unix__)
+    // A view of the dynamic symbol table, which uses the DT_GNU_HASH or DT_HASH table to find exports by name.
+    // Like dlsym, only the default version of a versioned symbol is found.
+    // GNU indirect functions are not returned, since their address is only known once their resolver has been called.
+    class elf_export_table
+    {
+    private:
+        pointer bias_ {nullptr};
+
+        const ElfW(Sym)* symbols_ {nullptr};
+        const char* strings_ {nullptr};
+
+        const std::uint32_t* gnu_hash_ {nullptr};
+        const std::uint32_t* sysv_hash_ {nullptr};
+        const ElfW(Versym)* versions_ {nullptr};
+
+        pointer resolve(std::size_t index, const char* name) const noexcept;
+
+    public:
+        constexpr elf_export_table() noexcept = default;
+
+        elf_export_table(pointer bias, const ElfW(Sym) * symbols, const char* strings, const std::uint32_t* gnu_hash,
+            const std::uint32_t* sysv_hash, const ElfW(Versym) * versions = nullptr) noexcept;
+
+        pointer find_export(const char* name) const noexcept;
+
+        explicit operator bool() const noexcept;
+    };
+
+    using export_table = elf_export_table;
+#endif
+
     class module : public region
     {
     public:
@@ -71,6 +112,8 @@ namespace mem
         const ElfW(Ehdr) & elf_header();
         slice<const ElfW(Phdr)> program_headers();
         slice<const ElfW(Shdr)> section_headers();
+
+        pointer load_bias();
 #endif
 
         static module named(const char* name);
@@ -81,10 +124,17 @@ namespace mem
         template <typename Func>
         void enum_segments(Func func);
 
+        template <typename Func>
+        void enum_sections(Func func);
+
+        region section(const char* name);
+
 #if defined(_WIN32)
         template <typename Func>
         void enum_exports(Func func);
 #endif
+
+        export_table exports();
     };
 
 #if defined(_WIN32)
@@ -197,6 +247,19 @@ namespace mem
         }
     }
 
+    template <typename Func>
+    inline void module::enum_sections(Func func)
+    {
+        for (const IMAGE_SECTION_HEADER& section : section_headers())
+        {
+            char name[IMAGE_SIZEOF_SHORT_NAME + 1] {};
+            std::memcpy(name, section.Name, IMAGE_SIZEOF_SHORT_NAME);
+
+            if (func(static_cast<const char*>(name), region(start.add(section.VirtualAddress), section.Misc.VirtualSize)))
+                return;
+        }
+    }
+
     template <typename Func>
     MEM_STRONG_INLINE void module::enum_exports(Func func)
     {
@@ -227,6 +290,23 @@ namespace mem
         }
     }
 
+    inline export_table module::exports()
+    {
+        const IMAGE_DATA_DIRECTORY& export_data_dir =
+            nt_headers().OptionalHeader.DataDirectory[IMAGE_DIRECTORY_ENTRY_EXPORT];
+
+        if (export_data_dir.Size < sizeof(IMAGE_EXPORT_DIRECTORY))
+            return {};
+
+        const IMAGE_EXPORT_DIRECTORY& export_dir =
+            start.add(export_data_dir.VirtualAddress).as<const IMAGE_EXPORT_DIRECTORY&>();
+
+        return {start, start.add(export_dir.AddressOfNames).as<const std::uint32_t*>(),
+            start.add(export_dir.AddressOfNameOrdinals).as<const std::uint16_t*>(),
+            start.add(export_dir.AddressOfFunctions).as<const std::uint32_t*>(), export_dir.NumberOfNames,
+            export_dir.NumberOfFunctions};
+    }
+
 #elif defined(__unix__)
     // https://github.com/torvalds/linux/blob/master/fs/binfmt_elf.c
     inline std::size_t total_mapping_size(const ElfW(Phdr) * cmds, std::size_t count)
@@ -297,6 +377,421 @@ namespace mem
         return {shdr, ehdr.e_shnum};
     }
 
+    MEM_STRONG_INLINE pointer module::load_bias()
+    {
+        // The module starts at the first PT_LOAD segment, which contains the ELF header
+        for (const ElfW(Phdr) & segment : program_headers())
+        {
+            if (segment.p_type == PT_LOAD)
+                return start.sub(segment.p_vaddr - segment.p_offset);
+        }
+
+        return start;
+    }
+
+    namespace internal
+    {
+        MEM_STRONG_INLINE std::uint32_t elf_gnu_hash(const char* name) noexcept
+        {
+            std::uint32_t hash = 5381;
+
+            for (; *name; ++name)
+                hash = (hash * 33) + static_cast<unsigned char>(*name);
+
+            return hash;
+        }
+
+        MEM_STRONG_INLINE std::uint32_t elf_sysv_hash(const char* name) noexcept
+        {
+            std::uint32_t hash = 0;
+
+            for (; *name; ++name)
+            {
+                hash = (hash << 4) + static_cast<unsigned char>(*name);
+
+                const std::uint32_t high = hash & 0xF0000000;
+
+                if (high)
+                    hash ^= high >> 24;
+
+                hash &= ~high;
+            }
+
+            return hash;
+        }
+    } // namespace internal
+
+    MEM_STRONG_INLINE elf_export_table::elf_export_table(pointer bias, const ElfW(Sym) * symbols, const char* strings,
+        const std::uint32_t* gnu_hash, const std::uint32_t* sysv_hash, const ElfW(Versym) * versions) noexcept
+        : bias_(bias)
+        , symbols_(symbols)
+        , strings_(strings)
+        , gnu_hash_(gnu_hash)
+        , sysv_hash_(sysv_hash)
+        , versions_(versions)
+    {}
+
+    MEM_STRONG_INLINE pointer elf_export_table::resolve(std::size_t index, const char* name) const noexcept
+    {
+        const ElfW(Sym)& symbol = symbols_[index];
+
+        if (symbol.st_shndx == SHN_UNDEF || symbol.st_value == 0)
+            return nullptr;
+
+        switch (ELF32_ST_TYPE(symbol.st_info))
+        {
+            case STT_NOTYPE:
+            case STT_OBJECT:
+            case STT_FUNC: break;
+
+            default: return nullptr;
+        }
+
+        // Skip local symbols, and versions which are hidden (0x8000) because they are not the default
+        if (versions_ && ((versions_[index] == VER_NDX_LOCAL) || (versions_[index] & 0x8000)))
+            return nullptr;
+
+        if (std::strcmp(strings_ + symbol.st_name, name))
+            return nullptr;
+
+        return bias_.add(symbol.st_value);
+    }
+
+    inline pointer elf_export_table::find_export(const char* name) const noexcept
+    {
+        if (gnu_hash_)
+        {
+            using bloom_word = ElfW(Addr);
+
+            constexpr std::uint32_t bloom_bits = sizeof(bloom_word) * CHAR_BIT;
+
+            const std::uint32_t bucket_count = gnu_hash_[0];
+            const std::uint32_t symbol_offset = gnu_hash_[1];
+            const std::uint32_t bloom_size = gnu_hash_[2];
+            const std::uint32_t bloom_shift = gnu_hash_[3];
+
+            const bloom_word* bloom = reinterpret_cast<const bloom_word*>(gnu_hash_ + 4);
+            const std::uint32_t* buckets = reinterpret_cast<const std::uint32_t*>(bloom + bloom_size);
+            const std::uint32_t* chain = buckets + bucket_count;
+
+            const std::uint32_t hash = internal::elf_gnu_hash(name);
+
+            const bloom_word word = bloom[(hash / bloom_bits) % bloom_size];
+            const bloom_word mask =
+                (bloom_word(1) << (hash % bloom_bits)) | (bloom_word(1) << ((hash >> bloom_shift) % bloom_bits));
+
+            if ((word & mask) != mask)
+                return nullptr;
+
+            std::uint32_t index = buckets[hash % bucket_count];
+
+            if (index < symbol_offset)
+                return nullptr;
+
+            while (true)
+            {
+                const std::uint32_t chain_hash = chain[index - symbol_offset];
+
+                if ((hash | 1) == (chain_hash | 1))
+                {
+                    if (pointer result = resolve(index, name))
+                        return result;
+                }
+
+                if (chain_hash & 1)
+                    break;
+
+                ++index;
+            }
+
+            return nullptr;
+        }
+
+        if (sysv_hash_)
+        {
+            const std::uint32_t bucket_count = sysv_hash_[0];
+            const std::uint32_t* buckets = sysv_hash_ + 2;
+            const std::uint32_t* chain = buckets + bucket_count;
+
+            for (std::uint32_t index = buckets[internal::elf_sysv_hash(name) % bucket_count]; index != STN_UNDEF;
+                 index = chain[index])
+            {
+                if (pointer result = resolve(index, name))
+                    return result;
+            }
+        }
+
+        return nullptr;
+    }
+
+    MEM_STRONG_INLINE elf_export_table::operator bool() const noexcept
+    {
+        return symbols_ && strings_ && (gnu_hash_ || sysv_hash_);
+    }
+
+    inline export_table module::exports()
+    {
+        const pointer bias = load_bias();
+
+        for (const ElfW(Phdr) & segment : program_headers())
+        {
+            if (segment.p_type != PT_DYNAMIC)
+                continue;
+
+            const ElfW(Sym)* symbols = nullptr;
+            const char* strings = nullptr;
+            const std::uint32_t* gnu_hash = nullptr;
+            const std::uint32_t* sysv_hash = nullptr;
+            const ElfW(Versym)* versions = nullptr;
+
+            for (const ElfW(Dyn)* dyn = bias.add(segment.p_vaddr).as<const ElfW(Dyn)*>(); dyn->d_tag != DT_NULL; ++dyn)
+            {
+                // Some loaders relocate the dynamic section in place, others leave it relative to the load bias
+                pointer address = dyn->d_un.d_ptr;
+
+                if (!contains(address))
+                    address = bias.add(dyn->d_un.d_ptr);
+
+                switch (dyn->d_tag)
+                {
+                    case DT_SYMTAB: symbols = address.as<const ElfW(Sym)*>(); break;
+                    case DT_STRTAB: strings = address.as<const char*>(); break;
+                    case DT_GNU_HASH: gnu_hash = address.as<const std::uint32_t*>(); break;
+                    case DT_HASH: sysv_hash = address.as<const std::uint32_t*>(); break;
+                    case DT_VERSYM: versions = address.as<const ElfW(Versym)*>(); break;
+                }
+            }
+
+            return {bias, symbols, strings, gnu_hash, sysv_hash, versions};
+        }
+
+        return {};
+    }
+
+    namespace internal
+    {
+        struct elf_section
+        {
+            std::string name;
+            ElfW(Addr) address;
+            std::size_t size;
+        };
+
+        struct elf_section_cache
+        {
+            std::mutex lock;
+
+            // The number of unloaded objects when the layouts were cached. Once anything is unloaded, a different
+            // object could be loaded at the same address, so the layouts are all discarded.
+            unsigned long long subs {0};
+
+            std::unordered_map<std::uintptr_t, std::shared_ptr<const std::vector<elf_section>>> layouts;
+        };
+
+        inline elf_section_cache& get_elf_section_cache()
+        {
+            static elf_section_cache cache;
+
+            return cache;
+        }
+
+        inline int dl_subs_callback(struct dl_phdr_info* info, std::size_t size, void* data)
+        {
+            if (size >= offsetof(struct dl_phdr_info, dlpi_subs) + sizeof(info->dlpi_subs))
+                *static_cast<unsigned long long*>(data) = info->dlpi_subs;
+
+            return 1;
+        }
+
+        struct dl_path_query
+        {
+            pointer start {nullptr};
+            const char* result {nullptr};
+        };
+
+        inline int dl_path_callback(struct dl_phdr_info* info, std::size_t size, void* data)
+        {
+            (void) size;
+
+            dl_path_query* query = static_cast<dl_path_query*>(data);
+
+            for (int i = 0; i < info->dlpi_phnum; ++i)
+            {
+                if (info->dlpi_phdr[i].p_type == PT_LOAD)
+                {
+                    if (pointer(info->dlpi_addr + info->dlpi_phdr[i].p_vaddr) != query->start)
+                        return 0;
+
+                    // The main executable is reported without a name
+                    query->result = (info->dlpi_name && *info->dlpi_name) ? info->dlpi_name : "/proc/self/exe";
+
+                    return 1;
+                }
+            }
+
+            return 0;
+        }
+
+        class elf_file_reader
+        {
+        private:
+            slice<const ElfW(Phdr)> segments_;
+            pointer bias_;
+            pointer start_;
+            std::FILE* file_ {nullptr};
+
+        public:
+            elf_file_reader(slice<const ElfW(Phdr)> segments, pointer bias, pointer start)
+                : segments_(segments)
+                , bias_(bias)
+                , start_(start)
+            {}
+
+            ~elf_file_reader()
+            {
+                if (file_)
+                    std::fclose(file_);
+            }
+
+            elf_file_reader(const elf_file_reader&) = delete;
+            elf_file_reader& operator=(const elf_file_reader&) = delete;
+
+            bool read(std::size_t offset, void* buffer, std::size_t length)
+            {
+                // Prefer the mapped image, and only fall back to the file for data outside of any PT_LOAD segment
+                for (const ElfW(Phdr) & segment : segments_)
+                {
+                    if (segment.p_type != PT_LOAD)
+                        continue;
+
+                    if (offset < segment.p_offset || offset - segment.p_offset > segment.p_filesz ||
+                        length > segment.p_filesz - (offset - segment.p_offset))
+                        continue;
+
+                    std::memcpy(buffer, bias_.add(segment.p_vaddr + (offset - segment.p_offset)).as<const void*>(),
+                        length);
+
+                    return true;
+                }
+
+                if (!file_)
+                {
+                    dl_path_query query;
+                    query.start = start_;
+
+                    if (dl_iterate_phdr(&dl_path_callback, &query) != 1)
+                        return false;
+
+                    file_ = std::fopen(query.result, "rb");
+
+                    if (!file_)
+                        return false;
+                }
+
+                if (std::fseek(file_, static_cast<long>(offset), SEEK_SET))
+                    return false;
+
+                return std::fread(buffer, 1, length, file_) == length;
+            }
+        };
+
+        inline std::vector<elf_section> load_elf_sections(module& image)
+        {
+            std::vector<elf_section> results;
+
+            const ElfW(Ehdr)& ehdr = image.elf_header();
+
+            if (!ehdr.e_shoff)
+                return results;
+
+            elf_file_reader reader(image.program_headers(), image.load_bias(), image.start);
+
+            std::size_t section_count = ehdr.e_shnum;
+            std::size_t string_index = ehdr.e_shstrndx;
+
+            // Large section counts and indices are stored in the first section header
+            if (section_count == 0 || string_index == SHN_XINDEX)
+            {
+                ElfW(Shdr) first;
+
+                if (!reader.read(ehdr.e_shoff, &first, sizeof(first)))
+                    return results;
+
+                if (section_count == 0)
+                    section_count = first.sh_size;
+
+                if (string_index == SHN_XINDEX)
+                    string_index = first.sh_link;
+            }
+
+            if (string_index >= section_count)
+                return results;
+
+            std::vector<ElfW(Shdr)> headers(section_count);
+
+            if (!reader.read(ehdr.e_shoff, headers.data(), headers.size() * sizeof(ElfW(Shdr))))
+                return results;
+
+            const ElfW(Shdr)& string_header = headers[string_index];
+
+            std::vector<char> strings(string_header.sh_size + 1);
+
+            if (!reader.read(string_header.sh_offset, strings.data(), string_header.sh_size))
+                return results;
+
+            for (const ElfW(Shdr) & header : headers)
+            {
+                if (!(header.sh_flags & SHF_ALLOC) || header.sh_name >= string_header.sh_size)
+                    continue;
+
+                results.push_back({&strings[header.sh_name], header.sh_addr, header.sh_size});
+            }
+
+            return results;
+        }
+    } // namespace internal
+
+    template <typename Func>
+    inline void module::enum_sections(Func func)
+    {
+        internal::elf_section_cache& cache = internal::get_elf_section_cache();
+
+        unsigned long long subs = 0;
+        dl_iterate_phdr(&internal::dl_subs_callback, &subs);
+
+        std::unique_lock<std::mutex> lock(cache.lock);
+
+        if (cache.subs != subs)
+        {
+            cache.layouts.clear();
+            cache.subs = subs;
+        }
+
+        auto find = cache.layouts.find(start.as<std::uintptr_t>());
+
+        if (find == cache.layouts.end())
+        {
+            find = cache.layouts
+                       .emplace(start.as<std::uintptr_t>(),
+                           std::make_shared<const std::vector<internal::elf_section>>(
+                               internal::load_elf_sections(*this)))
+                       .first;
+        }
+
+        // Keeps the layout alive even if the cache is cleared while enumerating
+        const std::shared_ptr<const std::vector<internal::elf_section>> sections = find->second;
+
+        lock.unlock();
+
+        const pointer bias = load_bias();
+
+        for (const internal::elf_section& section : *sections)
+        {
+            if (func(section.name.c_str(), region(bias.add(section.address), section.size)))
+                return;
+        }
+    }
+
     template <typename Func>
     MEM_STRONG_INLINE void module::enum_segments(Func func)
     {
@@ -437,6 +932,22 @@ namespace mem
     }
 #    endif
 #endif
+
+    inline region module::section(const char* name)
+    {
+        region result;
+
+        enum_sections([&](const char* section_name, region range) {
+            if (std::strcmp(section_name, name))
+                return false;
+
+            result = range;
+
+            return true;
+        });
+
+        return result;
+    }
 } // namespace mem
 
 #endif // MEM_MODULE_BRICK_H
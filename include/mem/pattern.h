@@ -23,6 +23,7 @@
 #include "char_queue.h"
 #include "mem.h"
 
+#include <iterator>
 #include <string>
 #include <vector>
 
@@ -278,13 +279,16 @@ namespace mem
 
         const byte* current = address.as<const byte*>();
 
+        if (trimmed_size() == 0)
+            return true;
+
         const std::size_t last = trimmed_size() - 1;
 
         if (needs_masks())
         {
             const byte* const pat_masks = masks();
 
-            for (std::size_t i = last; MEM_LIKELY((current[i] & pat_masks[i]) != pat_bytes[i]); --i)
+            for (std::size_t i = last; MEM_LIKELY((current[i] & pat_masks[i]) == pat_bytes[i]); --i)
             {
                 if (MEM_UNLIKELY(i == 0))
                     return true;
@@ -294,7 +298,7 @@ namespace mem
         }
         else
         {
-            for (std::size_t i = last; MEM_LIKELY(current[i] != pat_bytes[i]); --i)
+            for (std::size_t i = last; MEM_LIKELY(current[i] == pat_bytes[i]); --i)
             {
                 if (MEM_UNLIKELY(i == 0))
                     return true;
@@ -371,18 +375,185 @@ namespace mem
         return result;
     }
 
+    template <typename Scanner>
+    class match_iterator
+    {
+    private:
+        Scanner* scanner_ {nullptr};
+        typename Scanner::scan_state state_ {};
+        mem::pointer current_ {nullptr};
+
+    public:
+        using iterator_category = std::input_iterator_tag;
+        using value_type = mem::pointer;
+        using difference_type = std::ptrdiff_t;
+        using pointer = const value_type*;
+        using reference = const value_type&;
+
+        match_iterator() = default;
+
+        match_iterator(Scanner* scanner, region range);
+
+        reference operator*() const noexcept;
+        pointer operator->() const noexcept;
+
+        match_iterator& operator++();
+        match_iterator operator++(int);
+
+        bool operator==(const match_iterator& rhs) const noexcept;
+        bool operator!=(const match_iterator& rhs) const noexcept;
+    };
+
+    template <typename Scanner>
+    class match_range
+    {
+    private:
+        Scanner* scanner_ {nullptr};
+        region range_ {};
+
+    public:
+        match_range(Scanner* scanner, region range) noexcept;
+
+        match_iterator<Scanner> begin() const;
+        match_iterator<Scanner> end() const noexcept;
+    };
+
     template <typename Scanner>
     class scanner_base
     {
     public:
+        // The progress of a scan, so it can be resumed after each match.
+        // By default this is just the rest of the range. Scanners which can resume in the middle of their scan loop
+        // (such as simd_scanner) replace scan_state, start_scan and scan_next.
+        struct scan_state
+        {
+            region range;
+        };
+
+        scan_state start_scan(region range) const noexcept;
+
+        // Returns the next match of the scan, or nullptr once there are none left
+        pointer scan_next(scan_state& state);
+
         pointer operator()(region range);
 
         template <typename Func>
         pointer operator()(region range, Func func);
 
         std::vector<pointer> scan_all(region range);
+
+        // Lazily scans for each match as the range is iterated, without allocating.
+        // Each step resumes the scan from the previous match (see scan_state).
+        match_range<Scanner> matches(region range);
+
+        // Writes up to max matches to output, and returns the number written
+        template <typename OutputIt>
+        std::size_t scan_into(region range, OutputIt output, std::size_t max = SIZE_MAX);
+
+        // Counts matches, stopping once limit is reached
+        std::size_t count(region range, std::size_t limit = SIZE_MAX);
+
+        // Returns the only match, or nullptr if there are none or more than one
+        pointer scan_unique(region range);
+
+        // Returns the last match. The range is scanned in growing chunks from the end,
+        // so the cost depends on the distance to the match rather than the size of the range.
+        pointer scan_reverse(region range);
+
+        // Returns the match closest to origin, within max_distance bytes of it.
+        // Chunks are scanned outwards from origin on both sides, and ties favour the match after origin.
+        pointer scan_nearest(region range, pointer origin, std::size_t max_distance = SIZE_MAX);
     };
 
+    template <typename Scanner>
+    inline match_iterator<Scanner>::match_iterator(Scanner* scanner, region range)
+        : scanner_(scanner)
+        , state_(scanner->start_scan(range))
+        , current_(scanner->scan_next(state_))
+    {
+        if (!current_)
+            scanner_ = nullptr;
+    }
+
+    template <typename Scanner>
+    MEM_STRONG_INLINE typename match_iterator<Scanner>::reference match_iterator<Scanner>::operator*() const noexcept
+    {
+        return current_;
+    }
+
+    template <typename Scanner>
+    MEM_STRONG_INLINE typename match_iterator<Scanner>::pointer match_iterator<Scanner>::operator->() const noexcept
+    {
+        return &current_;
+    }
+
+    template <typename Scanner>
+    inline match_iterator<Scanner>& match_iterator<Scanner>::operator++()
+    {
+        current_ = scanner_->scan_next(state_);
+
+        if (!current_)
+            scanner_ = nullptr;
+
+        return *this;
+    }
+
+    template <typename Scanner>
+    inline match_iterator<Scanner> match_iterator<Scanner>::operator++(int)
+    {
+        match_iterator result = *this;
+        ++*this;
+        return result;
+    }
+
+    template <typename Scanner>
+    MEM_STRONG_INLINE bool match_iterator<Scanner>::operator==(const match_iterator& rhs) const noexcept
+    {
+        return (scanner_ == rhs.scanner_) && (current_ == rhs.current_);
+    }
+
+    template <typename Scanner>
+    MEM_STRONG_INLINE bool match_iterator<Scanner>::operator!=(const match_iterator& rhs) const noexcept
+    {
+        return !(*this == rhs);
+    }
+
+    template <typename Scanner>
+    MEM_STRONG_INLINE match_range<Scanner>::match_range(Scanner* scanner, region range) noexcept
+        : scanner_(scanner)
+        , range_(range)
+    {}
+
+    template <typename Scanner>
+    MEM_STRONG_INLINE match_iterator<Scanner> match_range<Scanner>::begin() const
+    {
+        return match_iterator<Scanner>(scanner_, range_);
+    }
+
+    template <typename Scanner>
+    MEM_STRONG_INLINE match_iterator<Scanner> match_range<Scanner>::end() const noexcept
+    {
+        return match_iterator<Scanner>();
+    }
+
+    template <typename Scanner>
+    MEM_STRONG_INLINE typename scanner_base<Scanner>::scan_state scanner_base<Scanner>::start_scan(
+        region range) const noexcept
+    {
+        return {range};
+    }
+
+    template <typename Scanner>
+    inline pointer scanner_base<Scanner>::scan_next(scan_state& state)
+    {
+        const pointer result = static_cast<Scanner*>(this)->scan(state.range);
+
+        if (result)
+            state.range = state.range.sub_region(result + 1);
+
+        return result;
+    }
+
     template <typename Scanner>
     MEM_STRONG_INLINE pointer scanner_base<Scanner>::operator()(region range)
     {
@@ -393,22 +564,15 @@ namespace mem
     template <typename Func>
     inline pointer scanner_base<Scanner>::operator()(region range, Func func)
     {
-        while (true)
-        {
-            const pointer result = static_cast<Scanner*>(this)->scan(range);
+        Scanner* const scanner = static_cast<Scanner*>(this);
 
-            if (result)
-            {
-                if (func(result))
-                {
-                    return result;
-                }
+        typename Scanner::scan_state state = scanner->start_scan(range);
 
-                range = range.sub_region(result + 1);
-            }
-            else
+        while (const pointer result = scanner->scan_next(state))
+        {
+            if (func(result))
             {
-                break;
+                return result;
             }
         }
 
@@ -428,6 +592,165 @@ namespace mem
 
         return results;
     }
+
+    template <typename Scanner>
+    MEM_STRONG_INLINE match_range<Scanner> scanner_base<Scanner>::matches(region range)
+    {
+        return match_range<Scanner>(static_cast<Scanner*>(this), range);
+    }
+
+    template <typename Scanner>
+    template <typename OutputIt>
+    inline std::size_t scanner_base<Scanner>::scan_into(region range, OutputIt output, std::size_t max)
+    {
+        Scanner* const scanner = static_cast<Scanner*>(this);
+
+        typename Scanner::scan_state state = scanner->start_scan(range);
+
+        std::size_t count = 0;
+
+        while (count < max)
+        {
+            const pointer result = scanner->scan_next(state);
+
+            if (!result)
+                break;
+
+            *output = result;
+            ++output;
+            ++count;
+        }
+
+        return count;
+    }
+
+    template <typename Scanner>
+    inline std::size_t scanner_base<Scanner>::count(region range, std::size_t limit)
+    {
+        Scanner* const scanner = static_cast<Scanner*>(this);
+
+        typename Scanner::scan_state state = scanner->start_scan(range);
+
+        std::size_t result = 0;
+
+        while (result < limit && scanner->scan_next(state))
+            ++result;
+
+        return result;
+    }
+
+    template <typename Scanner>
+    inline pointer scanner_base<Scanner>::scan_unique(region range)
+    {
+        Scanner* const scanner = static_cast<Scanner*>(this);
+
+        typename Scanner::scan_state state = scanner->start_scan(range);
+
+        const pointer result = scanner->scan_next(state);
+
+        if (!result || scanner->scan_next(state))
+            return nullptr;
+
+        return result;
+    }
+
+    namespace internal
+    {
+        static constexpr const std::size_t min_scan_chunk {0x1000};
+        static constexpr const std::size_t max_scan_chunk {0x100000};
+    } // namespace internal
+
+    template <typename Scanner>
+    inline pointer scanner_base<Scanner>::scan_reverse(region range)
+    {
+        Scanner* const scanner = static_cast<Scanner*>(this);
+
+        const std::size_t size = scanner->pattern_size();
+
+        if (size > range.size)
+            return nullptr;
+
+        // Inclusive bounds of the possible match addresses
+        const std::uintptr_t first = range.start.as<std::uintptr_t>();
+        std::uintptr_t last = first + (range.size - size);
+
+        for (std::size_t chunk = internal::min_scan_chunk;; chunk = (std::min)(chunk * 2, internal::max_scan_chunk))
+        {
+            const std::uintptr_t start = ((last - first) >= chunk) ? (last - chunk + 1) : first;
+
+            pointer result = nullptr;
+
+            (*this)(region(start, (last - start) + size), [&result](pointer found) {
+                result = found;
+
+                return false;
+            });
+
+            if (result || start == first)
+                return result;
+
+            last = start - 1;
+        }
+    }
+
+    template <typename Scanner>
+    inline pointer scanner_base<Scanner>::scan_nearest(region range, pointer origin, std::size_t max_distance)
+    {
+        Scanner* const scanner = static_cast<Scanner*>(this);
+
+        const std::size_t size = scanner->pattern_size();
+
+        if (size > range.size)
+            return nullptr;
+
+        const std::uintptr_t first = range.start.as<std::uintptr_t>();
+        const std::uintptr_t last = first + (range.size - size);
+        const std::uintptr_t center = origin.as<std::uintptr_t>();
+
+        // Each step searches the match addresses at a distance of [inner, far] from the origin
+        std::size_t inner = 0;
+
+        for (std::size_t chunk = internal::min_scan_chunk;; chunk = (std::min)(chunk * 2, internal::max_scan_chunk))
+        {
+            const std::size_t far = ((max_distance - inner) < (chunk - 1)) ? max_distance : (inner + (chunk - 1));
+
+            pointer forward = nullptr;
+            pointer backward = nullptr;
+
+            const bool forward_done = (center > last) || ((last - center) < inner);
+            const bool backward_done = (center < first) || ((center - first) < (std::max)(inner, std::size_t(1)));
+
+            if (!forward_done)
+            {
+                const std::uintptr_t start = (std::max)(center + inner, first);
+                const std::uintptr_t end = ((last - center) > far) ? (center + far) : last;
+
+                if (start <= end)
+                    forward = scanner->scan(region(start, (end - start) + size));
+            }
+
+            if (!backward_done)
+            {
+                const std::uintptr_t end = (std::min)(center - (std::max)(inner, std::size_t(1)), last);
+                const std::uintptr_t start = ((center - first) > far) ? (center - far) : first;
+
+                if (start <= end)
+                    backward = scan_reverse(region(start, (end - start) + size));
+            }
+
+            if (forward && backward)
+                return ((forward.as<std::uintptr_t>() - center) <= (center - backward.as<std::uintptr_t>())) ? forward
+                                                                                                           : backward;
+
+            if (forward || backward)
+                return forward ? forward : backward;
+
+            if ((forward_done && backward_done) || far >= max_distance)
+                return nullptr;
+
+            inner = far + 1;
+        }
+    }
 } // namespace mem
 
 #include "simd_scanner.h"
@@ -22,7 +22,9 @@
 
 #include "hasher.h"
 #include "pattern.h"
+#include "scan_stats.h"
 
+#include <iterator>
 #include <unordered_map>
 
 #include <istream>
@@ -37,6 +39,9 @@ namespace mem
         {
             std::vector<pointer> results {};
             bool checked {false};
+
+            // False if the scan stopped early, in which case only the first results are known
+            bool complete {true};
         };
 
         region region_;
@@ -44,6 +49,8 @@ namespace mem
 
         static std::uint32_t hash_pattern(const pattern& pattern);
 
+        const pattern_results& find_results(const pattern& pattern, std::size_t max);
+
     public:
         pattern_cache(region range);
 
@@ -80,14 +87,15 @@ namespace mem
 
     inline pointer pattern_cache::scan(const pattern& pattern, std::size_t index, std::size_t expected)
     {
-        const auto& results = scan_all(pattern);
-
-        if (results.size() != expected)
+        if (index >= expected)
         {
             return nullptr;
         }
 
-        if (index >= results.size())
+        // Only scan far enough to know whether there are more results than expected
+        const auto& results = find_results(pattern, expected + 1).results;
+
+        if (results.size() != expected)
         {
             return nullptr;
         }
@@ -97,47 +105,65 @@ namespace mem
 
     inline const std::vector<pointer>& pattern_cache::scan_all(const pattern& pattern)
     {
+        return find_results(pattern, SIZE_MAX).results;
+    }
+
+    inline const pattern_cache::pattern_results& pattern_cache::find_results(const pattern& pattern, std::size_t max)
+    {
+        MEM_SCAN_STATS_SCOPE("pattern_cache", pattern, region_);
+
         const std::uint32_t hash = hash_pattern(pattern);
 
         auto find = results_.find(hash);
 
         if (find != results_.end())
         {
-            if (!find->second.checked)
-            {
-                bool changed = false;
+            pattern_results& entry = find->second;
+
+            bool valid = entry.complete || (entry.results.size() >= max);
 
-                for (pointer result : find->second.results)
+            if (valid && !entry.checked)
+            {
+                for (pointer result : entry.results)
                 {
                     if (!pattern.match(result))
                     {
-                        changed = true;
+                        valid = false;
 
                         break;
                     }
                 }
+            }
 
-                if (changed)
-                {
-                    default_scanner scanner(pattern);
+            if (valid)
+            {
+                MEM_SCAN_STATS_ADD(cache_hits, 1);
+                MEM_SCAN_STATS_ADD(matches, entry.results.size());
 
-                    find->second.results = scanner.scan_all(region_);
-                }
+                entry.checked = true;
+
+                return entry;
             }
         }
         else
         {
-            pattern_results results;
+            find = results_.emplace(hash, pattern_results()).first;
+        }
 
-            default_scanner scanner(pattern);
-            results.results = scanner.scan_all(region_);
+        pattern_results& entry = find->second;
 
-            find = results_.emplace(hash, std::move(results)).first;
-        }
+        default_scanner scanner(pattern);
+
+        entry.results.clear();
+        scanner.scan_into(region_, std::back_inserter(entry.results), max);
+
+        entry.complete = entry.results.size() < max;
+        entry.checked = true;
 
-        find->second.checked = true;
+        MEM_SCAN_STATS_ADD(cache_misses, 1);
+        MEM_SCAN_STATS_ADD(matches, entry.results.size());
 
-        return find->second.results;
+        return entry;
     }
 
     namespace stream
@@ -168,10 +194,22 @@ namespace mem
         stream::write<std::uint32_t>(output, 0x50415443); // PATC
         stream::write<std::uint32_t>(output, sizeof(std::size_t));
         stream::write<std::size_t>(output, region_.size);
-        stream::write<std::size_t>(output, results_.size());
+
+        std::size_t pattern_count = 0;
 
         for (const auto& pattern : results_)
         {
+            if (pattern.second.complete)
+                ++pattern_count;
+        }
+
+        stream::write<std::size_t>(output, pattern_count);
+
+        for (const auto& pattern : results_)
+        {
+            if (!pattern.second.complete)
+                continue;
+
             stream::write<std::uint32_t>(output, pattern.first);
             stream::write<std::size_t>(output, pattern.second.results.size());
 
@@ -186,7 +224,7 @@ namespace mem
     {
         try
         {
-            if (stream::read<std::uint32_t>(input) == 0x50415443)
+            if (stream::read<std::uint32_t>(input) != 0x50415443)
                 return false;
 
             if (stream::read<std::uint32_t>(input) != sizeof(std::size_t))
@@ -0,0 +1,364 @@
+/*
+    Copyright 2018 Brick
+
+    Permission is hereby granted, free of charge, to any person obtaining a copy of this software
+    and associated documentation files (the "Software"), to deal in the Software without restriction,
+    including without limitation the rights to use, copy, modify, merge, publish, distribute,
+    sublicense, and/or sell copies of the Software, and to permit persons to whom the Software is
+    furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included in all copies or
+    substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING
+    BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+    NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM,
+    DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+    OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+*/
+
+#ifndef MEM_PATTERN_SET_BRICK_H
+#define MEM_PATTERN_SET_BRICK_H
+
+#include "pattern.h"
+
+#include <algorithm>
+#include <utility>
+#include <vector>
+
+namespace mem
+{
+    // Searches for a large set of patterns at once.
+    // The longest literal run of each pattern is compiled into an Aho-Corasick automaton, and the rest of the pattern
+    // is only checked with pattern::match when its run is found. Patterns without any literal bytes are scanned
+    // separately with the default scanner. As with the scanners, empty patterns and patterns of only wildcards never
+    // match.
+    // The shallowest states, in breadth first order, have a full 256-entry transition table, so most bytes take a
+    // single lookup. Deeper states search their sorted edges, and follow failure links until one matches or a state
+    // with a full table is reached.
+    class pattern_set
+    {
+    private:
+        static constexpr const std::size_t max_key_size {16};
+        static constexpr const std::uint32_t no_state {UINT32_MAX};
+
+        // At most 1 MiB of full transition tables
+        static constexpr const std::size_t max_dense_states {1024};
+
+        struct entry
+        {
+            const pattern* pat;
+            std::size_t index;
+            std::size_t offset;
+            std::size_t key_size;
+        };
+
+        struct edge
+        {
+            byte value;
+            std::uint32_t target;
+        };
+
+        struct state
+        {
+            std::uint32_t edges;
+            std::uint32_t num_edges;
+            std::uint32_t fail;
+            std::uint32_t outputs;
+            std::uint32_t num_outputs;
+            std::uint32_t output_link;
+            std::uint32_t transitions;
+        };
+
+        std::vector<entry> entries_ {};
+        std::vector<entry> fallback_ {};
+
+        std::vector<state> states_ {};
+        std::vector<edge> edges_ {};
+        std::vector<std::uint32_t> outputs_ {};
+        std::vector<std::uint32_t> transitions_ {};
+
+        std::uint32_t find_edge(std::uint32_t from, byte value) const noexcept;
+        std::uint32_t next_state(std::uint32_t from, byte value) const noexcept;
+
+    public:
+        pattern_set() = default;
+
+        pattern_set(const std::vector<const pattern*>& patterns);
+
+        // Calls func(address, index) for each match, where index is the position of the pattern in the original list.
+        // Matches are reported in order of the end of their literal run, followed by the matches of any patterns
+        // without literals.
+        template <typename Func>
+        pointer scan(region range, Func func) const;
+
+        // Returns all matches, sorted by address
+        std::vector<std::pair<pointer, std::size_t>> scan_all(region range) const;
+
+        std::size_t state_count() const noexcept;
+    };
+
+    inline pattern_set::pattern_set(const std::vector<const pattern*>& patterns)
+    {
+        for (std::size_t i = 0; i < patterns.size(); ++i)
+        {
+            const pattern* pat = patterns[i];
+
+            if (pat == nullptr || pat->trimmed_size() == 0)
+                continue;
+
+            const byte* const masks = pat->masks();
+            const std::size_t trimmed_size = pat->trimmed_size();
+
+            std::size_t best_offset = 0;
+            std::size_t best_size = 0;
+
+            for (std::size_t j = 0; j < trimmed_size;)
+            {
+                if (masks[j] != 0xFF)
+                {
+                    ++j;
+
+                    continue;
+                }
+
+                std::size_t k = j;
+
+                while (k < trimmed_size && masks[k] == 0xFF)
+                    ++k;
+
+                if (k - j > best_size)
+                {
+                    best_offset = j;
+                    best_size = k - j;
+                }
+
+                j = k;
+            }
+
+            if (best_size == 0)
+            {
+                fallback_.push_back({pat, i, 0, 0});
+
+                continue;
+            }
+
+            entries_.push_back({pat, i, best_offset, (std::min)(best_size, std::size_t(max_key_size))});
+        }
+
+        // Build the trie, with temporary child lists
+        std::vector<std::vector<edge>> children(1);
+        std::vector<std::vector<std::uint32_t>> outputs(1);
+
+        for (std::size_t i = 0; i < entries_.size(); ++i)
+        {
+            const entry& e = entries_[i];
+            const byte* const key = e.pat->bytes() + e.offset;
+
+            std::uint32_t current = 0;
+
+            for (std::size_t j = 0; j < e.key_size; ++j)
+            {
+                std::uint32_t next = no_state;
+
+                for (const edge& child : children[current])
+                {
+                    if (child.value == key[j])
+                    {
+                        next = child.target;
+
+                        break;
+                    }
+                }
+
+                if (next == no_state)
+                {
+                    next = static_cast<std::uint32_t>(children.size());
+                    children[current].push_back({key[j], next});
+                    children.emplace_back();
+                    outputs.emplace_back();
+                }
+
+                current = next;
+            }
+
+            outputs[current].push_back(static_cast<std::uint32_t>(i));
+        }
+
+        // Flatten the trie into contiguous edge and output tables
+        states_.resize(children.size());
+
+        for (std::size_t i = 0; i < children.size(); ++i)
+        {
+            std::sort(children[i].begin(), children[i].end(),
+                [](const edge& lhs, const edge& rhs) { return lhs.value < rhs.value; });
+
+            state& s = states_[i];
+
+            s.edges = static_cast<std::uint32_t>(edges_.size());
+            s.num_edges = static_cast<std::uint32_t>(children[i].size());
+            s.fail = 0;
+            s.outputs = static_cast<std::uint32_t>(outputs_.size());
+            s.num_outputs = static_cast<std::uint32_t>(outputs[i].size());
+            s.output_link = no_state;
+            s.transitions = no_state;
+
+            edges_.insert(edges_.end(), children[i].begin(), children[i].end());
+            outputs_.insert(outputs_.end(), outputs[i].begin(), outputs[i].end());
+        }
+
+        // Compute the failure and output links, and the transition tables, in breadth first order.
+        // A state's failure link is shallower, so its table (if it has one) is always built first.
+        std::vector<std::uint32_t> queue {0};
+        queue.reserve(states_.size());
+
+        for (std::size_t i = 0; i < queue.size(); ++i)
+        {
+            const std::uint32_t current = queue[i];
+
+            if (i < max_dense_states)
+            {
+                const std::size_t table = transitions_.size();
+                transitions_.resize(table + 256);
+
+                if (current != 0)
+                {
+                    const std::uint32_t fail_table = states_[states_[current].fail].transitions;
+
+                    std::copy(transitions_.begin() + static_cast<std::ptrdiff_t>(fail_table),
+                        transitions_.begin() + static_cast<std::ptrdiff_t>(fail_table + 256),
+                        transitions_.begin() + static_cast<std::ptrdiff_t>(table));
+                }
+
+                for (std::uint32_t j = 0; j < states_[current].num_edges; ++j)
+                {
+                    const edge child = edges_[states_[current].edges + j];
+
+                    transitions_[table + child.value] = child.target;
+                }
+
+                states_[current].transitions = static_cast<std::uint32_t>(table);
+            }
+
+            for (std::uint32_t j = 0; j < states_[current].num_edges; ++j)
+            {
+                const edge child = edges_[states_[current].edges + j];
+
+                const std::uint32_t fail = (current != 0) ? next_state(states_[current].fail, child.value) : 0;
+                state& target = states_[child.target];
+
+                target.fail = fail;
+                target.output_link = (states_[fail].num_outputs != 0) ? fail : states_[fail].output_link;
+
+                queue.push_back(child.target);
+            }
+        }
+    }
+
+    MEM_STRONG_INLINE std::uint32_t pattern_set::find_edge(std::uint32_t from, byte value) const noexcept
+    {
+        const state& s = states_[from];
+        const edge* const edges = edges_.data() + s.edges;
+
+        for (std::uint32_t i = 0; i < s.num_edges; ++i)
+        {
+            if (edges[i].value == value)
+                return edges[i].target;
+
+            if (edges[i].value > value)
+                break;
+        }
+
+        return no_state;
+    }
+
+    MEM_STRONG_INLINE std::uint32_t pattern_set::next_state(std::uint32_t from, byte value) const noexcept
+    {
+        // The root always has a transition table, so this stops at it
+        while (states_[from].transitions == no_state)
+        {
+            const std::uint32_t next = find_edge(from, value);
+
+            if (next != no_state)
+                return next;
+
+            from = states_[from].fail;
+        }
+
+        return transitions_[states_[from].transitions + value];
+    }
+
+    template <typename Func>
+    inline pointer pattern_set::scan(region range, Func func) const
+    {
+        const byte* const region_base = range.start.as<const byte*>();
+        const byte* const region_end = region_base + range.size;
+
+        if (!states_.empty())
+        {
+            std::uint32_t current = 0;
+
+            for (const byte* ptr = region_base; ptr < region_end; ++ptr)
+            {
+                current = next_state(current, *ptr);
+
+                std::uint32_t output = (states_[current].num_outputs != 0) ? current : states_[current].output_link;
+
+                for (; MEM_UNLIKELY(output != no_state); output = states_[output].output_link)
+                {
+                    const state& s = states_[output];
+
+                    for (std::uint32_t i = 0; i < s.num_outputs; ++i)
+                    {
+                        const entry& e = entries_[outputs_[s.outputs + i]];
+
+                        const std::size_t key_start = static_cast<std::size_t>(ptr - region_base) + 1 - e.key_size;
+
+                        if (key_start < e.offset)
+                            continue;
+
+                        const byte* const candidate = region_base + (key_start - e.offset);
+
+                        if (e.pat->size() > static_cast<std::size_t>(region_end - candidate))
+                            continue;
+
+                        if (e.pat->match(candidate) && func(pointer(candidate), e.index))
+                            return candidate;
+                    }
+                }
+            }
+        }
+
+        for (const entry& e : fallback_)
+        {
+            const pointer result = default_scanner(*e.pat)(range, [&](pointer address) { return func(address, e.index); });
+
+            if (result)
+                return result;
+        }
+
+        return nullptr;
+    }
+
+    inline std::vector<std::pair<pointer, std::size_t>> pattern_set::scan_all(region range) const
+    {
+        std::vector<std::pair<pointer, std::size_t>> results;
+
+        scan(range, [&results](pointer address, std::size_t index) {
+            results.emplace_back(address, index);
+
+            return false;
+        });
+
+        std::sort(results.begin(), results.end());
+
+        return results;
+    }
+
+    MEM_STRONG_INLINE std::size_t pattern_set::state_count() const noexcept
+    {
+        return states_.size();
+    }
+} // namespace mem
+
+#endif // MEM_PATTERN_SET_BRICK_H
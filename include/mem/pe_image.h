@@ -0,0 +1,799 @@
+/*
+    Copyright 2018 Brick
+
+    Permission is hereby granted, free of charge, to any person obtaining a copy of this software
+    and associated documentation files (the "Software"), to deal in the Software without restriction,
+    including without limitation the rights to use, copy, modify, merge, publish, distribute,
+    sublicense, and/or sell copies of the Software, and to permit persons to whom the Software is
+    furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included in all copies or
+    substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING
+    BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+    NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM,
+    DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+    OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+*/
+
+#ifndef MEM_PE_IMAGE_BRICK_H
+#define MEM_PE_IMAGE_BRICK_H
+
+#include "mem.h"
+#include "prot_flags.h"
+#include "protect.h"
+#include "slice.h"
+
+#include <cstdio>
+#include <cstring>
+#include <vector>
+
+namespace mem
+{
+    // Platform independent PE definitions, for analysing images which were not loaded by the OS
+    namespace pe
+    {
+        struct image_dos_header
+        {
+            std::uint16_t e_magic;
+            std::uint16_t e_unused[29];
+            std::int32_t e_lfanew;
+        };
+
+        struct image_file_header
+        {
+            std::uint16_t Machine;
+            std::uint16_t NumberOfSections;
+            std::uint32_t TimeDateStamp;
+            std::uint32_t PointerToSymbolTable;
+            std::uint32_t NumberOfSymbols;
+            std::uint16_t SizeOfOptionalHeader;
+            std::uint16_t Characteristics;
+        };
+
+        struct image_data_directory
+        {
+            std::uint32_t VirtualAddress;
+            std::uint32_t Size;
+        };
+
+        struct image_optional_header32
+        {
+            std::uint16_t Magic;
+            std::uint8_t MajorLinkerVersion;
+            std::uint8_t MinorLinkerVersion;
+            std::uint32_t SizeOfCode;
+            std::uint32_t SizeOfInitializedData;
+            std::uint32_t SizeOfUninitializedData;
+            std::uint32_t AddressOfEntryPoint;
+            std::uint32_t BaseOfCode;
+            std::uint32_t BaseOfData;
+            std::uint32_t ImageBase;
+            std::uint32_t SectionAlignment;
+            std::uint32_t FileAlignment;
+            std::uint16_t MajorOperatingSystemVersion;
+            std::uint16_t MinorOperatingSystemVersion;
+            std::uint16_t MajorImageVersion;
+            std::uint16_t MinorImageVersion;
+            std::uint16_t MajorSubsystemVersion;
+            std::uint16_t MinorSubsystemVersion;
+            std::uint32_t Win32VersionValue;
+            std::uint32_t SizeOfImage;
+            std::uint32_t SizeOfHeaders;
+            std::uint32_t CheckSum;
+            std::uint16_t Subsystem;
+            std::uint16_t DllCharacteristics;
+            std::uint32_t SizeOfStackReserve;
+            std::uint32_t SizeOfStackCommit;
+            std::uint32_t SizeOfHeapReserve;
+            std::uint32_t SizeOfHeapCommit;
+            std::uint32_t LoaderFlags;
+            std::uint32_t NumberOfRvaAndSizes;
+            image_data_directory DataDirectory[16];
+        };
+
+        struct image_optional_header64
+        {
+            std::uint16_t Magic;
+            std::uint8_t MajorLinkerVersion;
+            std::uint8_t MinorLinkerVersion;
+            std::uint32_t SizeOfCode;
+            std::uint32_t SizeOfInitializedData;
+            std::uint32_t SizeOfUninitializedData;
+            std::uint32_t AddressOfEntryPoint;
+            std::uint32_t BaseOfCode;
+            std::uint64_t ImageBase;
+            std::uint32_t SectionAlignment;
+            std::uint32_t FileAlignment;
+            std::uint16_t MajorOperatingSystemVersion;
+            std::uint16_t MinorOperatingSystemVersion;
+            std::uint16_t MajorImageVersion;
+            std::uint16_t MinorImageVersion;
+            std::uint16_t MajorSubsystemVersion;
+            std::uint16_t MinorSubsystemVersion;
+            std::uint32_t Win32VersionValue;
+            std::uint32_t SizeOfImage;
+            std::uint32_t SizeOfHeaders;
+            std::uint32_t CheckSum;
+            std::uint16_t Subsystem;
+            std::uint16_t DllCharacteristics;
+            std::uint64_t SizeOfStackReserve;
+            std::uint64_t SizeOfStackCommit;
+            std::uint64_t SizeOfHeapReserve;
+            std::uint64_t SizeOfHeapCommit;
+            std::uint32_t LoaderFlags;
+            std::uint32_t NumberOfRvaAndSizes;
+            image_data_directory DataDirectory[16];
+        };
+
+        struct image_section_header
+        {
+            char Name[8];
+            std::uint32_t VirtualSize;
+            std::uint32_t VirtualAddress;
+            std::uint32_t SizeOfRawData;
+            std::uint32_t PointerToRawData;
+            std::uint32_t PointerToRelocations;
+            std::uint32_t PointerToLinenumbers;
+            std::uint16_t NumberOfRelocations;
+            std::uint16_t NumberOfLinenumbers;
+            std::uint32_t Characteristics;
+        };
+
+        struct image_export_directory
+        {
+            std::uint32_t Characteristics;
+            std::uint32_t TimeDateStamp;
+            std::uint16_t MajorVersion;
+            std::uint16_t MinorVersion;
+            std::uint32_t Name;
+            std::uint32_t Base;
+            std::uint32_t NumberOfFunctions;
+            std::uint32_t NumberOfNames;
+            std::uint32_t AddressOfFunctions;
+            std::uint32_t AddressOfNames;
+            std::uint32_t AddressOfNameOrdinals;
+        };
+
+        struct image_base_relocation
+        {
+            std::uint32_t VirtualAddress;
+            std::uint32_t SizeOfBlock;
+        };
+
+        static constexpr const std::uint16_t dos_signature {0x5A4D};  // MZ
+        static constexpr const std::uint32_t nt_signature {0x00004550}; // PE00
+
+        static constexpr const std::uint16_t nt_optional_hdr32_magic {0x10B};
+        static constexpr const std::uint16_t nt_optional_hdr64_magic {0x20B};
+
+        static constexpr const std::size_t directory_entry_export {0};
+        static constexpr const std::size_t directory_entry_exception {3};
+        static constexpr const std::size_t directory_entry_basereloc {5};
+
+        static constexpr const std::uint32_t scn_mem_execute {0x20000000};
+        static constexpr const std::uint32_t scn_mem_read {0x40000000};
+        static constexpr const std::uint32_t scn_mem_write {0x80000000};
+
+        static constexpr const std::uint16_t rel_based_absolute {0};
+        static constexpr const std::uint16_t rel_based_highlow {3};
+        static constexpr const std::uint16_t rel_based_dir64 {10};
+    } // namespace pe
+
+    // A view of an export directory, which can find exports by name without allocating
+    class pe_export_table
+    {
+    private:
+        pointer base_ {nullptr};
+
+        const std::uint32_t* names_ {nullptr};
+        const std::uint16_t* ordinals_ {nullptr};
+        const std::uint32_t* functions_ {nullptr};
+
+        std::uint32_t name_count_ {0};
+        std::uint32_t func_count_ {0};
+
+    public:
+        constexpr pe_export_table() noexcept = default;
+
+        pe_export_table(pointer base, const std::uint32_t* names, const std::uint16_t* ordinals,
+            const std::uint32_t* functions, std::uint32_t name_count, std::uint32_t func_count) noexcept;
+
+        pointer find_export(const char* name) const noexcept;
+
+        std::size_t size() const noexcept;
+    };
+
+    // A PE file laid out at its virtual addresses, as the loader would, but without resolving imports or running any code
+    class pe_image : public region
+    {
+    private:
+        std::size_t mapping_size_ {0};
+        std::uint64_t image_base_ {0};
+
+        bool load(std::FILE* file, bool relocate);
+        void release() noexcept;
+
+        template <typename T>
+        const T* rva(std::uint32_t address, std::size_t count = 1) const noexcept;
+
+        // Null unless the string is terminated within the image
+        const char* rva_string(std::uint32_t address) const noexcept;
+
+    public:
+        pe_image() = default;
+        ~pe_image();
+
+        pe_image(pe_image&& rhs) noexcept;
+        pe_image(const pe_image&) = delete;
+
+        pe_image& operator=(pe_image&& rhs) noexcept;
+        pe_image& operator=(const pe_image&) = delete;
+
+        static pe_image open(const char* path, bool relocate = true);
+
+        explicit operator bool() const noexcept;
+
+        const pe::image_dos_header& dos_header() const;
+        const pe::image_file_header& file_header() const;
+        slice<const pe::image_section_header> section_headers() const;
+
+        bool is_64bit() const;
+        pe::image_data_directory data_directory(std::size_t index) const;
+
+        // The base address which absolute pointers in the image currently refer to
+        std::uint64_t image_base() const noexcept;
+
+        bool relocate(std::uint64_t new_base);
+
+        template <typename Func>
+        void enum_segments(Func func) const;
+
+        template <typename Func>
+        void enum_exports(Func func) const;
+
+        pe_export_table exports() const;
+    };
+
+    MEM_STRONG_INLINE pe_export_table::pe_export_table(pointer base, const std::uint32_t* names,
+        const std::uint16_t* ordinals, const std::uint32_t* functions, std::uint32_t name_count,
+        std::uint32_t func_count) noexcept
+        : base_(base)
+        , names_(names)
+        , ordinals_(ordinals)
+        , functions_(functions)
+        , name_count_(name_count)
+        , func_count_(func_count)
+    {}
+
+    inline pointer pe_export_table::find_export(const char* name) const noexcept
+    {
+        // The export name table is sorted lexically, so it can be binary searched in place
+        std::uint32_t low = 0;
+        std::uint32_t high = name_count_;
+
+        while (low < high)
+        {
+            const std::uint32_t mid = low + ((high - low) / 2);
+            const int cmp = std::strcmp(base_.add(names_[mid]).as<const char*>(), name);
+
+            if (cmp < 0)
+            {
+                low = mid + 1;
+            }
+            else if (cmp > 0)
+            {
+                high = mid;
+            }
+            else
+            {
+                const std::uint16_t ordinal = ordinals_[mid];
+
+                return (ordinal < func_count_) ? base_.add(functions_[ordinal]) : nullptr;
+            }
+        }
+
+        return nullptr;
+    }
+
+    MEM_STRONG_INLINE std::size_t pe_export_table::size() const noexcept
+    {
+        return name_count_;
+    }
+
+    namespace internal
+    {
+        inline bool read_file(std::FILE* file, std::size_t offset, void* buffer, std::size_t length)
+        {
+            if (std::fseek(file, static_cast<long>(offset), SEEK_SET))
+                return false;
+
+            return std::fread(buffer, 1, length, file) == length;
+        }
+
+        inline void* reserve_image(std::uint64_t preferred_base, std::size_t length, bool is_64bit)
+        {
+            void* hint = (preferred_base <= UINTPTR_MAX) ? pointer(static_cast<std::uintptr_t>(preferred_base)).as<void*>()
+                                                         : nullptr;
+
+#if defined(_WIN32)
+            void* result = VirtualAlloc(hint, length, MEM_RESERVE | MEM_COMMIT, PAGE_READWRITE);
+
+            if (result == nullptr)
+                result = VirtualAlloc(nullptr, length, MEM_RESERVE | MEM_COMMIT, PAGE_READWRITE);
+
+            return result;
+#elif defined(__unix__)
+            void* result = mmap(hint, length, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+
+            if (result == MAP_FAILED)
+                return nullptr;
+
+#    if defined(MAP_32BIT)
+            // Keep 32-bit images below 4GB, so they can still be relocated
+            if (!is_64bit && (pointer(result).add(length).as<std::uintptr_t>() > UINT32_MAX))
+            {
+                void* low = mmap(nullptr, length, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS | MAP_32BIT, -1, 0);
+
+                if (low != MAP_FAILED)
+                {
+                    munmap(result, length);
+                    result = low;
+                }
+            }
+#    else
+            (void) is_64bit;
+#    endif
+
+            return result;
+#endif
+        }
+    } // namespace internal
+
+    inline pe_image::~pe_image()
+    {
+        release();
+    }
+
+    inline pe_image::pe_image(pe_image&& rhs) noexcept
+        : region(rhs)
+        , mapping_size_(rhs.mapping_size_)
+        , image_base_(rhs.image_base_)
+    {
+        rhs.start = nullptr;
+        rhs.size = 0;
+        rhs.mapping_size_ = 0;
+        rhs.image_base_ = 0;
+    }
+
+    inline pe_image& pe_image::operator=(pe_image&& rhs) noexcept
+    {
+        if (this != &rhs)
+        {
+            release();
+
+            start = rhs.start;
+            size = rhs.size;
+            mapping_size_ = rhs.mapping_size_;
+            image_base_ = rhs.image_base_;
+
+            rhs.start = nullptr;
+            rhs.size = 0;
+            rhs.mapping_size_ = 0;
+            rhs.image_base_ = 0;
+        }
+
+        return *this;
+    }
+
+    inline void pe_image::release() noexcept
+    {
+        if (start)
+        {
+#if defined(_WIN32)
+            VirtualFree(start.as<void*>(), 0, MEM_RELEASE);
+#elif defined(__unix__)
+            munmap(start.as<void*>(), mapping_size_);
+#endif
+        }
+
+        start = nullptr;
+        size = 0;
+        mapping_size_ = 0;
+        image_base_ = 0;
+    }
+
+    inline pe_image pe_image::open(const char* path, bool relocate)
+    {
+        pe_image result;
+
+        std::FILE* file = std::fopen(path, "rb");
+
+        if (file)
+        {
+            if (!result.load(file, relocate))
+                result.release();
+
+            std::fclose(file);
+        }
+
+        return result;
+    }
+
+    inline bool pe_image::load(std::FILE* file, bool relocate)
+    {
+        if (std::fseek(file, 0, SEEK_END))
+            return false;
+
+        const long file_end = std::ftell(file);
+
+        if (file_end <= 0)
+            return false;
+
+        const std::size_t file_size = static_cast<std::size_t>(file_end);
+
+        pe::image_dos_header dos;
+
+        if (!internal::read_file(file, 0, &dos, sizeof(dos)) || (dos.e_magic != pe::dos_signature) || (dos.e_lfanew < 0))
+            return false;
+
+        const std::size_t nt_offset = static_cast<std::size_t>(dos.e_lfanew);
+
+        struct
+        {
+            std::uint32_t Signature;
+            pe::image_file_header FileHeader;
+            pe::image_optional_header64 OptionalHeader;
+        } nt;
+
+        std::memset(&nt, 0, sizeof(nt));
+
+        if (!internal::read_file(file, nt_offset, &nt, 4 + sizeof(pe::image_file_header) + sizeof(std::uint16_t)))
+            return false;
+
+        if (nt.Signature != pe::nt_signature)
+            return false;
+
+        std::uint64_t image_base = 0;
+        std::size_t image_size = 0;
+        std::size_t header_size = 0;
+
+        if (nt.OptionalHeader.Magic == pe::nt_optional_hdr64_magic)
+        {
+            if (!internal::read_file(file, nt_offset + 4 + sizeof(pe::image_file_header), &nt.OptionalHeader,
+                    sizeof(pe::image_optional_header64)))
+                return false;
+
+            image_base = nt.OptionalHeader.ImageBase;
+            image_size = nt.OptionalHeader.SizeOfImage;
+            header_size = nt.OptionalHeader.SizeOfHeaders;
+        }
+        else if (nt.OptionalHeader.Magic == pe::nt_optional_hdr32_magic)
+        {
+            pe::image_optional_header32 optional;
+
+            if (!internal::read_file(file, nt_offset + 4 + sizeof(pe::image_file_header), &optional, sizeof(optional)))
+                return false;
+
+            image_base = optional.ImageBase;
+            image_size = optional.SizeOfImage;
+            header_size = optional.SizeOfHeaders;
+        }
+        else
+        {
+            return false;
+        }
+
+        const std::size_t section_offset = nt_offset + 4 + sizeof(pe::image_file_header) + nt.FileHeader.SizeOfOptionalHeader;
+        const std::size_t section_end = section_offset + nt.FileHeader.NumberOfSections * sizeof(pe::image_section_header);
+
+        if ((header_size < section_end) || (header_size > image_size) || (header_size > file_size))
+            return false;
+
+        const std::size_t page = page_size();
+        const std::size_t mapping_size = (image_size + page - 1) / page * page;
+
+        void* base = internal::reserve_image(image_base, mapping_size, nt.OptionalHeader.Magic == pe::nt_optional_hdr64_magic);
+
+        if (base == nullptr)
+            return false;
+
+        start = base;
+        size = image_size;
+        mapping_size_ = mapping_size;
+        image_base_ = image_base;
+
+        if (!internal::read_file(file, 0, base, header_size))
+            return false;
+
+        for (const pe::image_section_header& section : section_headers())
+        {
+            std::size_t raw_size = section.SizeOfRawData;
+            const std::size_t raw_offset = section.PointerToRawData;
+
+            if (section.VirtualSize && (section.VirtualSize < raw_size))
+                raw_size = section.VirtualSize;
+
+            if (!raw_size)
+                continue;
+
+            if ((section.VirtualAddress > image_size) || (raw_size > (image_size - section.VirtualAddress)))
+                return false;
+
+            if ((raw_offset > file_size) || (raw_size > (file_size - raw_offset)))
+                return false;
+
+            byte* const dest = static_cast<byte*>(base) + section.VirtualAddress;
+            std::size_t mapped = 0;
+
+#if defined(__unix__)
+            // Map whole pages straight from the file when both the section and its raw data are page aligned
+            if (!(section.VirtualAddress % page) && !(raw_offset % page) && (raw_size >= page))
+            {
+                mapped = raw_size / page * page;
+
+                if (mmap(dest, mapped, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_FIXED, fileno(file),
+                        static_cast<off_t>(raw_offset)) == MAP_FAILED)
+                    return false;
+            }
+#endif
+
+            if ((mapped != raw_size) && !internal::read_file(file, raw_offset + mapped, dest + mapped, raw_size - mapped))
+                return false;
+        }
+
+        if (relocate && (image_base_ != start.as<std::uintptr_t>()))
+            this->relocate(start.as<std::uintptr_t>());
+
+        return true;
+    }
+
+    MEM_STRONG_INLINE pe_image::operator bool() const noexcept
+    {
+        return start != nullptr;
+    }
+
+    template <typename T>
+    MEM_STRONG_INLINE const T* pe_image::rva(std::uint32_t address, std::size_t count) const noexcept
+    {
+        return region::contains(start.add(address), sizeof(T) * count) ? start.add(address).as<const T*>() : nullptr;
+    }
+
+    inline const char* pe_image::rva_string(std::uint32_t address) const noexcept
+    {
+        if (address >= size)
+            return nullptr;
+
+        const char* const result = start.add(address).as<const char*>();
+
+        return std::memchr(result, 0, size - address) ? result : nullptr;
+    }
+
+    MEM_STRONG_INLINE const pe::image_dos_header& pe_image::dos_header() const
+    {
+        return start.at<const pe::image_dos_header>(0);
+    }
+
+    MEM_STRONG_INLINE const pe::image_file_header& pe_image::file_header() const
+    {
+        return start.at<const pe::image_file_header>(static_cast<std::size_t>(dos_header().e_lfanew) + 4);
+    }
+
+    inline slice<const pe::image_section_header> pe_image::section_headers() const
+    {
+        const pe::image_file_header& header = file_header();
+
+        const std::size_t offset = static_cast<std::size_t>(dos_header().e_lfanew) + 4 + sizeof(pe::image_file_header) +
+            header.SizeOfOptionalHeader;
+
+        return {start.add(offset).as<const pe::image_section_header*>(), header.NumberOfSections};
+    }
+
+    MEM_STRONG_INLINE bool pe_image::is_64bit() const
+    {
+        return start.at<const std::uint16_t>(static_cast<std::size_t>(dos_header().e_lfanew) + 4 +
+                   sizeof(pe::image_file_header)) == pe::nt_optional_hdr64_magic;
+    }
+
+    inline pe::image_data_directory pe_image::data_directory(std::size_t index) const
+    {
+        const std::size_t offset = static_cast<std::size_t>(dos_header().e_lfanew) + 4 + sizeof(pe::image_file_header);
+
+        std::uint32_t count = 0;
+        const pe::image_data_directory* directories = nullptr;
+
+        if (is_64bit())
+        {
+            const pe::image_optional_header64& optional = start.at<const pe::image_optional_header64>(offset);
+
+            count = optional.NumberOfRvaAndSizes;
+            directories = optional.DataDirectory;
+        }
+        else
+        {
+            const pe::image_optional_header32& optional = start.at<const pe::image_optional_header32>(offset);
+
+            count = optional.NumberOfRvaAndSizes;
+            directories = optional.DataDirectory;
+        }
+
+        if ((index >= count) || (index >= 16))
+            return {0, 0};
+
+        return directories[index];
+    }
+
+    MEM_STRONG_INLINE std::uint64_t pe_image::image_base() const noexcept
+    {
+        return image_base_;
+    }
+
+    inline bool pe_image::relocate(std::uint64_t new_base)
+    {
+        if (new_base == image_base_)
+            return true;
+
+        const bool is_64 = is_64bit();
+
+        if (!is_64 && ((new_base + size) > UINT32_MAX))
+            return false;
+
+        const pe::image_data_directory reloc_dir = data_directory(pe::directory_entry_basereloc);
+
+        if (!reloc_dir.Size)
+            return false;
+
+        const std::uint64_t delta = new_base - image_base_;
+
+        const byte* block = rva<byte>(reloc_dir.VirtualAddress, reloc_dir.Size);
+
+        if (block == nullptr)
+            return false;
+
+        const byte* const block_end = block + reloc_dir.Size;
+
+        while (static_cast<std::size_t>(block_end - block) >= sizeof(pe::image_base_relocation))
+        {
+            const pe::image_base_relocation& header = *reinterpret_cast<const pe::image_base_relocation*>(block);
+
+            if ((header.SizeOfBlock < sizeof(header)) || (header.SizeOfBlock > static_cast<std::size_t>(block_end - block)))
+                break;
+
+            const std::uint16_t* entries = reinterpret_cast<const std::uint16_t*>(block + sizeof(header));
+            const std::size_t count = (header.SizeOfBlock - sizeof(header)) / sizeof(std::uint16_t);
+
+            for (std::size_t i = 0; i < count; ++i)
+            {
+                const std::uint16_t type = static_cast<std::uint16_t>(entries[i] >> 12);
+                const std::uint32_t offset = header.VirtualAddress + (entries[i] & 0xFFFu);
+
+                if (type == pe::rel_based_dir64)
+                {
+                    if (std::uint64_t* value = const_cast<std::uint64_t*>(rva<std::uint64_t>(offset)))
+                        *value += delta;
+                }
+                else if (type == pe::rel_based_highlow)
+                {
+                    if (std::uint32_t* value = const_cast<std::uint32_t*>(rva<std::uint32_t>(offset)))
+                        *value += static_cast<std::uint32_t>(delta);
+                }
+            }
+
+            block += header.SizeOfBlock;
+        }
+
+        image_base_ = new_base;
+
+        return true;
+    }
+
+    template <typename Func>
+    inline void pe_image::enum_segments(Func func) const
+    {
+        for (const pe::image_section_header& section : section_headers())
+        {
+            mem::region range(start.add(section.VirtualAddress), section.VirtualSize);
+
+            if (!range.size || !region::contains(range))
+                continue;
+
+            prot_flags prot = prot_flags::NONE;
+
+            if (section.Characteristics & pe::scn_mem_read)
+                prot |= prot_flags::R;
+
+            if (section.Characteristics & pe::scn_mem_write)
+                prot |= prot_flags::W;
+
+            if (section.Characteristics & pe::scn_mem_execute)
+                prot |= prot_flags::X;
+
+            if (func(range, prot))
+                return;
+        }
+    }
+
+    template <typename Func>
+    inline void pe_image::enum_exports(Func func) const
+    {
+        const pe::image_data_directory export_data_dir = data_directory(pe::directory_entry_export);
+
+        if (export_data_dir.Size < sizeof(pe::image_export_directory))
+            return;
+
+        const pe::image_export_directory* export_dir = rva<pe::image_export_directory>(export_data_dir.VirtualAddress);
+
+        if (export_dir == nullptr)
+            return;
+
+        const std::uint32_t name_count = export_dir->NumberOfNames;
+        const std::uint32_t func_count = export_dir->NumberOfFunctions;
+
+        const std::uint32_t* const names = rva<std::uint32_t>(export_dir->AddressOfNames, name_count);
+        const std::uint16_t* const ordinals = rva<std::uint16_t>(export_dir->AddressOfNameOrdinals, name_count);
+        const std::uint32_t* const functions = rva<std::uint32_t>(export_dir->AddressOfFunctions, func_count);
+
+        if (!functions || (name_count && (!names || !ordinals)))
+            return;
+
+        std::vector<bool> named(func_count);
+
+        for (std::uint32_t i = 0; i < name_count; ++i)
+        {
+            const std::uint16_t ordinal = ordinals[i];
+
+            const char* name = rva_string(names[i]);
+
+            if (ordinal >= func_count || name == nullptr)
+                continue;
+
+            named[ordinal] = true;
+
+            if (func(name, ordinal, start.add(functions[ordinal])))
+                return;
+        }
+
+        for (std::uint32_t i = 0; i < func_count; ++i)
+        {
+            if (!named[i] && functions[i])
+            {
+                if (func(static_cast<const char*>(nullptr), static_cast<std::uint16_t>(i), start.add(functions[i])))
+                    return;
+            }
+        }
+    }
+
+    inline pe_export_table pe_image::exports() const
+    {
+        const pe::image_data_directory export_data_dir = data_directory(pe::directory_entry_export);
+
+        if (export_data_dir.Size < sizeof(pe::image_export_directory))
+            return {};
+
+        const pe::image_export_directory* export_dir = rva<pe::image_export_directory>(export_data_dir.VirtualAddress);
+
+        if (export_dir == nullptr)
+            return {};
+
+        const std::uint32_t name_count = export_dir->NumberOfNames;
+        const std::uint32_t func_count = export_dir->NumberOfFunctions;
+
+        const std::uint32_t* const names = rva<std::uint32_t>(export_dir->AddressOfNames, name_count);
+        const std::uint16_t* const ordinals = rva<std::uint16_t>(export_dir->AddressOfNameOrdinals, name_count);
+        const std::uint32_t* const functions = rva<std::uint32_t>(export_dir->AddressOfFunctions, func_count);
+
+        if (!names || !ordinals || !functions)
+            return {};
+
+        for (std::uint32_t i = 0; i < name_count; ++i)
+        {
+            if (!rva_string(names[i]))
+                return {};
+        }
+
+        return {start, names, ordinals, functions, name_count, func_count};
+    }
+} // namespace mem
+
+#endif // MEM_PE_IMAGE_BRICK_H
@@ -0,0 +1,277 @@
+/*
+    Copyright 2018 Brick
+
+    Permission is hereby granted, free of charge, to any person obtaining a copy of this software
+    and associated documentation files (the "Software"), to deal in the Software without restriction,
+    including without limitation the rights to use, copy, modify, merge, publish, distribute,
+    sublicense, and/or sell copies of the Software, and to permit persons to whom the Software is
+    furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included in all copies or
+    substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING
+    BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+    NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM,
+    DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+    OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+*/
+
+#ifndef MEM_POINTER_MAP_BRICK_H
+#define MEM_POINTER_MAP_BRICK_H
+
+#include "module.h"
+#include "pointer_scanner.h"
+#include "protect.h"
+
+#include <algorithm>
+#include <cstring>
+#include <unordered_set>
+#include <vector>
+
+namespace mem
+{
+    // A chain of pointers from a static address to a target, where
+    // target = [[[base] + offsets[0]] + offsets[1] ...] + offsets[n - 1]
+    struct pointer_path
+    {
+        pointer base;
+        std::vector<std::size_t> offsets;
+    };
+
+    // A snapshot of the pointers in memory, stored as a reverse index from each target to the slots pointing at it
+    class pointer_map
+    {
+    private:
+        struct entry
+        {
+            std::uintptr_t target;
+            std::uintptr_t source;
+
+            bool operator<(const entry& rhs) const noexcept
+            {
+                return (target != rhs.target) ? (target < rhs.target) : (source < rhs.source);
+            }
+        };
+
+        std::vector<entry> entries_ {};
+
+    public:
+        pointer_map() = default;
+
+        // Stores every aligned pointer in the sources which points into the targets
+        pointer_map(const std::vector<region>& sources, const std::vector<region>& targets);
+
+        // Stores every aligned pointer in writable memory which points into readable memory.
+        // Other threads should not unmap any memory while the snapshot is taken.
+        static pointer_map snapshot();
+
+        // Calls func(source, target) for each slot pointing into [address - max_offset, address]
+        template <typename Func>
+        void find_sources(pointer address, std::size_t max_offset, Func func) const;
+
+        // Searches backwards from the target for chains of up to max_depth pointers, each followed by an offset of at
+        // most max_offset, which start inside one of the static ranges. Shorter paths are found first.
+        std::vector<pointer_path> find_paths(pointer target, const std::vector<region>& statics, std::size_t max_depth,
+            std::size_t max_offset, std::size_t max_results = SIZE_MAX) const;
+
+        // Returns the writable segments of a module, for use as static ranges
+        static std::vector<region> static_ranges(module image);
+
+        std::size_t size() const noexcept;
+    };
+
+    namespace internal
+    {
+        // An append-only array in its own pages. Unlike a heap allocation, growing it never frees heap memory, which
+        // the allocator could return to the system while it is still being scanned.
+        template <typename T>
+        class page_array
+        {
+        private:
+            T* data_ {nullptr};
+            std::size_t size_ {0};
+            std::size_t capacity_ {0};
+
+        public:
+            page_array() = default;
+
+            page_array(const page_array&) = delete;
+            page_array& operator=(const page_array&) = delete;
+
+            ~page_array()
+            {
+                if (data_)
+                    protect_free(data_, capacity_ * sizeof(T));
+            }
+
+            bool push_back(const T& value)
+            {
+                if (size_ == capacity_)
+                {
+                    const std::size_t capacity = capacity_ ? (capacity_ * 2) : (page_size() / sizeof(T));
+                    T* data = static_cast<T*>(protect_alloc(capacity * sizeof(T), prot_flags::RW));
+
+                    if (data == nullptr)
+                        return false;
+
+                    if (data_)
+                    {
+                        std::memcpy(data, data_, size_ * sizeof(T));
+                        protect_free(data_, capacity_ * sizeof(T));
+                    }
+
+                    data_ = data;
+                    capacity_ = capacity;
+                }
+
+                data_[size_++] = value;
+
+                return true;
+            }
+
+            const T* begin() const noexcept
+            {
+                return data_;
+            }
+
+            const T* end() const noexcept
+            {
+                return data_ + size_;
+            }
+        };
+    } // namespace internal
+
+    inline pointer_map::pointer_map(const std::vector<region>& sources, const std::vector<region>& targets)
+    {
+        std::vector<region> merged = targets;
+        internal::merge_pointer_ranges(merged);
+
+        // The sources may include the heap, so nothing is allocated or freed on it until they have all been scanned
+        internal::page_array<entry> found;
+        bool complete = true;
+
+        for (const region& source : sources)
+        {
+            // Only scan aligned slots
+            const pointer start = source.start.align_up(sizeof(void*));
+
+            if (start >= source.start + source.size)
+                continue;
+
+            internal::scan_merged_pointers(region(start, source.size - static_cast<std::size_t>(start - source.start)),
+                merged, sizeof(void*), [&found, &complete](pointer slot, pointer value) {
+                    complete = found.push_back({value.as<std::uintptr_t>(), slot.as<std::uintptr_t>()});
+
+                    return !complete;
+                });
+
+            if (!complete)
+                break;
+        }
+
+        entries_.assign(found.begin(), found.end());
+
+        std::sort(entries_.begin(), entries_.end());
+    }
+
+    inline pointer_map pointer_map::snapshot()
+    {
+        const std::vector<region> targets = readable_regions();
+        const std::vector<region> sources = readable_regions(prot_flags::RW);
+
+        return pointer_map(sources, targets);
+    }
+
+    template <typename Func>
+    inline void pointer_map::find_sources(pointer address, std::size_t max_offset, Func func) const
+    {
+        const std::uintptr_t upper = address.as<std::uintptr_t>();
+        const std::uintptr_t lower = (upper > max_offset) ? (upper - max_offset) : 0;
+
+        auto iter = std::lower_bound(entries_.begin(), entries_.end(), lower,
+            [](const entry& lhs, std::uintptr_t rhs) { return lhs.target < rhs; });
+
+        for (; (iter != entries_.end()) && (iter->target <= upper); ++iter)
+            func(pointer(iter->source), pointer(iter->target));
+    }
+
+    inline std::vector<pointer_path> pointer_map::find_paths(pointer target, const std::vector<region>& statics,
+        std::size_t max_depth, std::size_t max_offset, std::size_t max_results) const
+    {
+        struct node
+        {
+            pointer address;
+            std::size_t parent;
+            std::size_t offset;
+            std::size_t depth;
+        };
+
+        std::vector<region> sorted_statics = statics;
+
+        std::sort(sorted_statics.begin(), sorted_statics.end(),
+            [](const region& lhs, const region& rhs) { return lhs.start < rhs.start; });
+
+        const auto is_static = [&sorted_statics](pointer address) {
+            auto iter = std::upper_bound(sorted_statics.begin(), sorted_statics.end(), address,
+                [](pointer lhs, const region& rhs) { return lhs < rhs.start; });
+
+            return (iter != sorted_statics.begin()) && (iter - 1)->contains(address);
+        };
+
+        std::vector<pointer_path> results;
+        std::vector<node> nodes {{target, SIZE_MAX, 0, 0}};
+        std::unordered_set<std::uintptr_t> visited {target.as<std::uintptr_t>()};
+
+        // The nodes vector doubles as the BFS queue
+        for (std::size_t i = 0; (i < nodes.size()) && (results.size() < max_results); ++i)
+        {
+            if (nodes[i].depth >= max_depth)
+                continue;
+
+            find_sources(nodes[i].address, max_offset, [&](pointer source, pointer value) {
+                if (results.size() >= max_results)
+                    return;
+
+                const std::size_t offset = static_cast<std::size_t>(nodes[i].address - value);
+
+                if (is_static(source))
+                {
+                    pointer_path path {source, {offset}};
+
+                    for (std::size_t j = i; nodes[j].parent != SIZE_MAX; j = nodes[j].parent)
+                        path.offsets.push_back(nodes[j].offset);
+
+                    results.push_back(std::move(path));
+                }
+                else if (visited.insert(source.as<std::uintptr_t>()).second)
+                {
+                    nodes.push_back({source, i, offset, nodes[i].depth + 1});
+                }
+            });
+        }
+
+        return results;
+    }
+
+    inline std::vector<region> pointer_map::static_ranges(module image)
+    {
+        std::vector<region> results;
+
+        image.enum_segments([&results](region range, prot_flags prot) {
+            if (prot & prot_flags::W)
+                results.push_back(range);
+
+            return false;
+        });
+
+        return results;
+    }
+
+    MEM_STRONG_INLINE std::size_t pointer_map::size() const noexcept
+    {
+        return entries_.size();
+    }
+} // namespace mem
+
+#endif // MEM_POINTER_MAP_BRICK_H
@@ -0,0 +1,373 @@
+/*
+    Copyright 2018 Brick
+
+    Permission is hereby granted, free of charge, to any person obtaining a copy of this software
+    and associated documentation files (the "Software"), to deal in the Software without restriction,
+    including without limitation the rights to use, copy, modify, merge, publish, distribute,
+    sublicense, and/or sell copies of the Software, and to permit persons to whom the Software is
+    furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included in all copies or
+    substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING
+    BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+    NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM,
+    DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+    OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+*/
+
+#ifndef MEM_POINTER_SCANNER_BRICK_H
+#define MEM_POINTER_SCANNER_BRICK_H
+
+#include "mem.h"
+
+#if !defined(MEM_POINTER_SCANNER_USE_GENERIC)
+#    if defined(MEM_SIMD_AVX2)
+#        include <immintrin.h>
+#    elif defined(MEM_SIMD_SSE2)
+#        include <emmintrin.h>
+#    else
+#        define MEM_POINTER_SCANNER_USE_GENERIC
+#    endif
+#endif
+
+#if !defined(MEM_POINTER_SCANNER_USE_GENERIC)
+#    include "arch.h"
+#endif
+
+#include <algorithm>
+#include <cstring>
+#include <vector>
+
+namespace mem
+{
+    // Calls func(slot, value) for each pointer sized slot in haystack, every stride bytes, whose value points into
+    // targets. Stops and returns the slot if func returns true.
+    template <typename Func>
+    pointer scan_pointers(region haystack, region targets, std::size_t stride, Func func);
+
+    // Returns every slot in haystack which points into targets
+    std::vector<pointer> scan_pointers(region haystack, region targets, std::size_t stride = sizeof(void*));
+
+    // Same as above, but for any of several target ranges
+    template <typename Func>
+    pointer scan_pointers(region haystack, std::vector<region> targets, std::size_t stride, Func func);
+
+    std::vector<pointer> scan_pointers(
+        region haystack, std::vector<region> targets, std::size_t stride = sizeof(void*));
+
+    namespace internal
+    {
+        MEM_STRONG_INLINE std::uintptr_t load_pointer(const byte* slot) noexcept
+        {
+            std::uintptr_t result;
+            std::memcpy(&result, slot, sizeof(result));
+            return result;
+        }
+
+        // Above this many target ranges, slots are filtered by the hull of the ranges and then binary searched
+        constexpr std::size_t max_pointer_ranges = 4;
+
+        // Calls func for each slot whose value is inside any of the Count ranges [lower, lower + size)
+        template <std::size_t Count, typename Func>
+        inline pointer scan_pointer_slots(region haystack, const std::uintptr_t* lower, const std::uintptr_t* size,
+            std::size_t stride, Func& func)
+        {
+            if (haystack.size < sizeof(std::uintptr_t) || stride == 0)
+                return nullptr;
+
+            const byte* ptr = haystack.start.as<const byte*>();
+            const byte* const region_end = ptr + haystack.size;
+            const byte* const end = region_end - sizeof(std::uintptr_t) + 1;
+
+#if !defined(MEM_POINTER_SCANNER_USE_GENERIC)
+#    if defined(MEM_SIMD_AVX2)
+#        define l_SIMD_TYPE __m256i
+#        define l_SIMD_LOAD(x) _mm256_loadu_si256(reinterpret_cast<const __m256i*>(x))
+#        define l_SIMD_OR(x, y) _mm256_or_si256(x, y)
+#        if defined(MEM_ARCH_X86_64)
+#            define l_SIMD_FILL(x) _mm256_set1_epi64x(static_cast<long long>(x))
+#            define l_SIMD_IN_RANGE(x, i) \
+                _mm256_cmpgt_epi64(upper_value[i], _mm256_xor_si256(_mm256_sub_epi64(x, lower_value[i]), sign_value))
+#            define l_SIMD_MOVEMASK(x) static_cast<unsigned int>(_mm256_movemask_pd(_mm256_castsi256_pd(x)))
+#        else
+#            define l_SIMD_FILL(x) _mm256_set1_epi32(static_cast<int>(x))
+#            define l_SIMD_IN_RANGE(x, i) \
+                _mm256_cmpgt_epi32(upper_value[i], _mm256_xor_si256(_mm256_sub_epi32(x, lower_value[i]), sign_value))
+#            define l_SIMD_MOVEMASK(x) static_cast<unsigned int>(_mm256_movemask_ps(_mm256_castsi256_ps(x)))
+#        endif
+#    elif defined(MEM_SIMD_SSE2)
+#        define l_SIMD_TYPE __m128i
+#        define l_SIMD_LOAD(x) _mm_loadu_si128(reinterpret_cast<const __m128i*>(x))
+#        define l_SIMD_OR(x, y) _mm_or_si128(x, y)
+#        if defined(MEM_ARCH_X86_64)
+#            define l_SIMD_FILL(x) _mm_set_epi32(static_cast<int>((x) >> 32), static_cast<int>(x), \
+                static_cast<int>((x) >> 32), static_cast<int>(x))
+            // SSE2 has no 64-bit compare, so combine the compares of each half
+#            define l_SIMD_IN_RANGE(x, i) \
+                in_range_sse2(_mm_xor_si128(_mm_sub_epi64(x, lower_value[i]), sign_value), upper_value[i])
+#            define l_SIMD_MOVEMASK(x) static_cast<unsigned int>(_mm_movemask_pd(_mm_castsi128_pd(x)))
+#        else
+#            define l_SIMD_FILL(x) _mm_set1_epi32(static_cast<int>(x))
+#            define l_SIMD_IN_RANGE(x, i) \
+                _mm_cmpgt_epi32(upper_value[i], _mm_xor_si128(_mm_sub_epi32(x, lower_value[i]), sign_value))
+#            define l_SIMD_MOVEMASK(x) static_cast<unsigned int>(_mm_movemask_ps(_mm_castsi128_ps(x)))
+#        endif
+#    else
+#        error Sorry, No Potatoes
+#    endif
+
+            if (stride == sizeof(std::uintptr_t))
+            {
+                constexpr std::size_t lanes = sizeof(l_SIMD_TYPE) / sizeof(std::uintptr_t);
+
+                l_SIMD_TYPE lower_value[Count];
+                l_SIMD_TYPE upper_value[Count];
+
+                // Compare unsigned values by flipping their sign bits
+#    if defined(MEM_SIMD_AVX2) || !defined(MEM_ARCH_X86_64)
+                const std::uintptr_t sign = std::uintptr_t(1) << ((sizeof(std::uintptr_t) * 8) - 1);
+
+                const l_SIMD_TYPE sign_value = l_SIMD_FILL(sign);
+
+                for (std::size_t i = 0; i < Count; ++i)
+                {
+                    lower_value[i] = l_SIMD_FILL(lower[i]);
+                    upper_value[i] = l_SIMD_FILL(size[i] ^ sign);
+                }
+#    else
+                const __m128i sign_value = _mm_set1_epi32(static_cast<int>(0x80000000));
+
+                for (std::size_t i = 0; i < Count; ++i)
+                {
+                    lower_value[i] = l_SIMD_FILL(lower[i]);
+                    upper_value[i] = _mm_xor_si128(l_SIMD_FILL(size[i]), sign_value);
+                }
+
+                const auto in_range_sse2 = [](__m128i value, __m128i upper) {
+                    const __m128i greater = _mm_cmpgt_epi32(upper, value);
+                    const __m128i equal = _mm_cmpeq_epi32(upper, value);
+
+                    return _mm_or_si128(
+                        greater, _mm_and_si128(equal, _mm_shuffle_epi32(greater, _MM_SHUFFLE(2, 2, 0, 0))));
+                };
+#    endif
+
+                // Each lane is tested against every range, and the results are combined before extracting the mask
+                const auto in_range = [&](l_SIMD_TYPE value) {
+                    l_SIMD_TYPE result = l_SIMD_IN_RANGE(value, 0);
+
+                    for (std::size_t i = 1; i < Count; ++i)
+                        result = l_SIMD_OR(result, l_SIMD_IN_RANGE(value, i));
+
+                    return l_SIMD_MOVEMASK(result);
+                };
+
+                const auto report = [&](const byte* base, unsigned int mask) -> const byte* {
+                    do
+                    {
+                        const byte* slot = base + (bsf(mask) * sizeof(std::uintptr_t));
+
+                        if (func(pointer(slot), pointer(load_pointer(slot))))
+                            return slot;
+
+                        mask &= mask - 1;
+                    } while (mask);
+
+                    return nullptr;
+                };
+
+                while (static_cast<std::size_t>(region_end - ptr) >= sizeof(l_SIMD_TYPE) * 4)
+                {
+                    const l_SIMD_TYPE value0 = l_SIMD_LOAD(ptr);
+                    const l_SIMD_TYPE value1 = l_SIMD_LOAD(ptr + sizeof(l_SIMD_TYPE));
+                    const l_SIMD_TYPE value2 = l_SIMD_LOAD(ptr + (sizeof(l_SIMD_TYPE) * 2));
+                    const l_SIMD_TYPE value3 = l_SIMD_LOAD(ptr + (sizeof(l_SIMD_TYPE) * 3));
+
+                    const unsigned int mask = in_range(value0) | (in_range(value1) << lanes) |
+                        (in_range(value2) << (lanes * 2)) | (in_range(value3) << (lanes * 3));
+
+                    if (MEM_UNLIKELY(mask != 0)) [[MEM_ATTR_UNLIKELY]]
+                    {
+                        if (const byte* result = report(ptr, mask))
+                            return result;
+                    }
+
+                    ptr += sizeof(l_SIMD_TYPE) * 4;
+                }
+
+                while (static_cast<std::size_t>(region_end - ptr) >= sizeof(l_SIMD_TYPE))
+                {
+                    const unsigned int mask = in_range(l_SIMD_LOAD(ptr));
+
+                    if (MEM_UNLIKELY(mask != 0)) [[MEM_ATTR_UNLIKELY]]
+                    {
+                        if (const byte* result = report(ptr, mask))
+                            return result;
+                    }
+
+                    ptr += sizeof(l_SIMD_TYPE);
+                }
+            }
+
+#    undef l_SIMD_TYPE
+#    undef l_SIMD_LOAD
+#    undef l_SIMD_OR
+#    undef l_SIMD_FILL
+#    undef l_SIMD_IN_RANGE
+#    undef l_SIMD_MOVEMASK
+#endif
+
+            for (; ptr < end; ptr += stride)
+            {
+                const std::uintptr_t value = load_pointer(ptr);
+
+                bool found = false;
+
+                for (std::size_t i = 0; i < Count; ++i)
+                    found |= (value - lower[i]) < size[i];
+
+                if (MEM_UNLIKELY(found) && func(pointer(ptr), pointer(value)))
+                    return ptr;
+
+                if (static_cast<std::size_t>(end - ptr) <= stride)
+                    break;
+            }
+
+            return nullptr;
+        }
+    } // namespace internal
+
+    template <typename Func>
+    inline pointer scan_pointers(region haystack, region targets, std::size_t stride, Func func)
+    {
+        if (!targets.size)
+            return nullptr;
+
+        const std::uintptr_t lower = targets.start.as<std::uintptr_t>();
+        const std::uintptr_t size = targets.size;
+
+        return internal::scan_pointer_slots<1>(haystack, &lower, &size, stride, func);
+    }
+
+    inline std::vector<pointer> scan_pointers(region haystack, region targets, std::size_t stride)
+    {
+        std::vector<pointer> results;
+
+        scan_pointers(haystack, targets, stride, [&results](pointer slot, pointer) {
+            results.push_back(slot);
+
+            return false;
+        });
+
+        return results;
+    }
+
+    namespace internal
+    {
+        // Sorts the targets and merges overlapping ranges, so each value can be found with one binary search
+        inline void merge_pointer_ranges(std::vector<region>& targets)
+        {
+            targets.erase(std::remove_if(targets.begin(), targets.end(), [](const region& range) { return !range.size; }),
+                targets.end());
+
+            if (targets.empty())
+                return;
+
+            std::sort(targets.begin(), targets.end(),
+                [](const region& lhs, const region& rhs) { return lhs.start < rhs.start; });
+
+            std::size_t count = 0;
+
+            for (std::size_t i = 1; i < targets.size(); ++i)
+            {
+                region& last = targets[count];
+
+                if (targets[i].start <= last.start.add(last.size))
+                {
+                    const pointer end = (std::max)(last.start.add(last.size), targets[i].start.add(targets[i].size));
+                    last.size = static_cast<std::size_t>(end - last.start);
+                }
+                else
+                {
+                    targets[++count] = targets[i];
+                }
+            }
+
+            targets.resize(count + 1);
+        }
+
+        // Same as scan_pointers, for targets already passed through merge_pointer_ranges. Does not allocate.
+        template <typename Func>
+        inline pointer scan_merged_pointers(
+            region haystack, const std::vector<region>& targets, std::size_t stride, Func func)
+        {
+            if (targets.empty())
+                return nullptr;
+
+            // A few ranges are compared directly against each slot
+            if (targets.size() <= max_pointer_ranges)
+            {
+                std::uintptr_t lowers[max_pointer_ranges];
+                std::uintptr_t sizes[max_pointer_ranges];
+
+                for (std::size_t i = 0; i < targets.size(); ++i)
+                {
+                    lowers[i] = targets[i].start.as<std::uintptr_t>();
+                    sizes[i] = targets[i].size;
+                }
+
+                switch (targets.size())
+                {
+                    case 1: return scan_pointer_slots<1>(haystack, lowers, sizes, stride, func);
+                    case 2: return scan_pointer_slots<2>(haystack, lowers, sizes, stride, func);
+                    case 3: return scan_pointer_slots<3>(haystack, lowers, sizes, stride, func);
+                    default: return scan_pointer_slots<4>(haystack, lowers, sizes, stride, func);
+                }
+            }
+
+            const std::uintptr_t lower = targets.front().start.as<std::uintptr_t>();
+            const std::uintptr_t upper = targets.back().start.as<std::uintptr_t>() + targets.back().size;
+
+            // Otherwise, vector compares against the hull of all ranges filter out most slots, and the rest are
+            // binary searched
+            auto filter = [&](pointer slot, pointer value) {
+                auto find = std::upper_bound(targets.begin(), targets.end(), value,
+                    [](pointer lhs, const region& rhs) { return lhs < rhs.start; });
+
+                if (find == targets.begin() || !(--find)->contains(value))
+                    return false;
+
+                return func(slot, value);
+            };
+
+            const std::uintptr_t size = upper - lower;
+
+            return scan_pointer_slots<1>(haystack, &lower, &size, stride, filter);
+        }
+    } // namespace internal
+
+    template <typename Func>
+    inline pointer scan_pointers(region haystack, std::vector<region> targets, std::size_t stride, Func func)
+    {
+        internal::merge_pointer_ranges(targets);
+
+        return internal::scan_merged_pointers(haystack, targets, stride, func);
+    }
+
+    inline std::vector<pointer> scan_pointers(region haystack, std::vector<region> targets, std::size_t stride)
+    {
+        std::vector<pointer> results;
+
+        scan_pointers(haystack, std::move(targets), stride, [&results](pointer slot, pointer) {
+            results.push_back(slot);
+
+            return false;
+        });
+
+        return results;
+    }
+} // namespace mem
+
+#endif // MEM_POINTER_SCANNER_BRICK_H
@@ -24,6 +24,9 @@
 #include "prot_flags.h"
 
 #include <cstdio>
+#include <cstring>
+#include <utility>
+#include <vector>
 
 #if defined(_WIN32)
 #    if !defined(WIN32_LEAN_AND_MEAN)
@@ -35,6 +38,7 @@
 #        define _GNU_SOURCE
 #    endif
 #    include <cinttypes>
+#    include <fcntl.h>
 #    include <sys/mman.h>
 #    include <unistd.h>
 #else
@@ -52,6 +56,10 @@ namespace mem
 
     bool protect_modify(void* memory, std::size_t length, prot_flags flags, prot_flags* old_flags = nullptr);
 
+    // Returns the committed regions of the current process which have all of the required flags, sorted and with
+    // adjacent regions merged
+    std::vector<region> readable_regions(prot_flags required = prot_flags::R);
+
 #if defined(__unix__)
     struct region_info
     {
@@ -66,6 +74,11 @@ namespace mem
     int iter_proc_maps(int (*callback)(region_info*, void*), void* data);
 #endif
 
+#if defined(__linux__)
+    // Reads the /proc/self/pagemap entry of each page, starting at the page containing start
+    bool read_pagemap(pointer start, std::size_t pages, std::uint64_t* entries);
+#endif
+
     class protect : public region
     {
     private:
@@ -251,6 +264,100 @@ namespace mem
     }
 #endif
 
+#if defined(__linux__)
+    inline bool read_pagemap(pointer start, std::size_t pages, std::uint64_t* entries)
+    {
+        const int fd = open("/proc/self/pagemap", O_RDONLY | O_CLOEXEC);
+
+        if (fd < 0)
+            return false;
+
+        const std::size_t total = pages * sizeof(std::uint64_t);
+        off_t offset = static_cast<off_t>((start.as<std::uintptr_t>() / page_size()) * sizeof(std::uint64_t));
+
+        std::size_t done = 0;
+
+        while (done < total)
+        {
+            const ssize_t result = pread(fd, reinterpret_cast<byte*>(entries) + done, total - done, offset);
+
+            if (result <= 0)
+                break;
+
+            done += static_cast<std::size_t>(result);
+            offset += result;
+        }
+
+        close(fd);
+
+        return done == total;
+    }
+#endif
+
+#if defined(__unix__)
+    namespace internal
+    {
+        struct region_query
+        {
+            prot_flags required;
+            std::vector<region> results;
+        };
+
+        inline int readable_regions_callback(region_info* region, void* data)
+        {
+            region_query* query = static_cast<region_query*>(data);
+
+            if (!(region->prot & PROT_READ) || ((to_prot_flags(region->prot) & query->required) != query->required))
+                return 0;
+
+            // Reading these can fault, or has side effects
+            if (region->path_name && (!std::strncmp(region->path_name, "[vvar", 5) ||
+                                         !std::strncmp(region->path_name, "[vsyscall]", 10) ||
+                                         !std::strncmp(region->path_name, "/dev/", 5)))
+                return 0;
+
+            query->results.emplace_back(region->start, region->end - region->start);
+
+            return 0;
+        }
+    } // namespace internal
+#endif
+
+    inline std::vector<region> readable_regions(prot_flags required)
+    {
+        required |= prot_flags::R;
+
+        std::vector<region> regions;
+
+#if defined(_WIN32)
+        MEMORY_BASIC_INFORMATION info;
+
+        for (pointer address = nullptr; VirtualQuery(address.as<const void*>(), &info, sizeof(info));
+             address = pointer(info.BaseAddress).add(info.RegionSize))
+        {
+            if ((info.State == MEM_COMMIT) && !(info.Protect & (PAGE_GUARD | PAGE_NOACCESS)) &&
+                ((to_prot_flags(info.Protect) & required) == required))
+                regions.emplace_back(info.BaseAddress, info.RegionSize);
+        }
+#elif defined(__unix__)
+        internal::region_query query {required, {}};
+        iter_proc_maps(&internal::readable_regions_callback, &query);
+        regions = std::move(query.results);
+#endif
+
+        std::vector<region> results;
+
+        for (const region& range : regions)
+        {
+            if (!results.empty() && (results.back().start + results.back().size == range.start))
+                results.back().size += range.size;
+            else
+                results.push_back(range);
+        }
+
+        return results;
+    }
+
     MEM_STRONG_INLINE protect::protect(region range, prot_flags flags)
         : region(range)
         , old_flags_(prot_flags::INVALID)
@@ -0,0 +1,404 @@
+/*
+    Copyright 2018 Brick
+
+    Permission is hereby granted, free of charge, to any person obtaining a copy of this software
+    and associated documentation files (the "Software"), to deal in the Software without restriction,
+    including without limitation the rights to use, copy, modify, merge, publish, distribute,
+    sublicense, and/or sell copies of the Software, and to permit persons to whom the Software is
+    furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included in all copies or
+    substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING
+    BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+    NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM,
+    DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+    OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+*/
+
+#ifndef MEM_REGION_SNAPSHOT_BRICK_H
+#define MEM_REGION_SNAPSHOT_BRICK_H
+
+#include "mem.h"
+#include "protect.h"
+
+#if !defined(MEM_REGION_SNAPSHOT_USE_GENERIC)
+#    if defined(MEM_SIMD_AVX2)
+#        include <immintrin.h>
+#    elif defined(MEM_SIMD_SSE2)
+#        include <emmintrin.h>
+#    else
+#        define MEM_REGION_SNAPSHOT_USE_GENERIC
+#    endif
+#endif
+
+#if defined(__linux__)
+#    include <fcntl.h>
+#    include <unistd.h>
+#endif
+
+#include <algorithm>
+#include <atomic>
+#include <cstring>
+#include <vector>
+
+namespace mem
+{
+    // A copy of a region of memory, which can be diffed against and updated from the current memory.
+    // On Linux, the soft-dirty bits from /proc/self/pagemap are used to skip any pages which have not been written
+    // since the last update, so an update only costs as much as the pages which were dirtied.
+    // Otherwise (or after another snapshot has reset the soft-dirty bits), every page is compared.
+    // Soft-dirty bits are process wide, so only one snapshot can track them at a time. Use a region_snapshot_group
+    // to update several snapshots from the same reset.
+    // Writes which race with an update may not be seen until their page is written again.
+    class region_snapshot
+    {
+    private:
+        friend class region_snapshot_group;
+
+        region range_ {};
+        std::vector<byte> data_ {};
+        std::uint64_t epoch_ {0};
+
+        void reset_dirty();
+
+        // The pagemap entries of each page in the range, or nothing if every page needs to be compared
+        std::vector<std::uint64_t> read_dirty() const;
+
+        template <typename Func>
+        void compare(const std::vector<std::uint64_t>& entries, Func func);
+
+    public:
+        region_snapshot() = default;
+
+        explicit region_snapshot(region range);
+
+        // Calls func(range) for each range of bytes which changed since the last update, then updates the snapshot
+        template <typename Func>
+        void update(Func func);
+
+        std::vector<region> update();
+
+        region range() const noexcept;
+        const byte* data() const noexcept;
+
+        // Whether the next update can skip clean pages
+        bool tracking() const noexcept;
+    };
+
+    // Updates several snapshots with a single reset of the soft-dirty bits, so they all keep tracking.
+    // The snapshots are not owned by the group, and must outlive it (or be removed).
+    // Updating or creating a snapshot outside of the group stops the others from tracking until the next update.
+    class region_snapshot_group
+    {
+    private:
+        std::vector<region_snapshot*> snapshots_ {};
+
+    public:
+        void add(region_snapshot& snapshot);
+        void remove(region_snapshot& snapshot);
+
+        // Calls func(snapshot, range) for each range of bytes which changed in each snapshot since the last update
+        template <typename Func>
+        void update(Func func);
+
+        std::size_t size() const noexcept;
+    };
+
+    namespace internal
+    {
+#if defined(__linux__)
+        inline std::atomic<std::uint64_t>& soft_dirty_epoch()
+        {
+            static std::atomic<std::uint64_t> epoch {0};
+
+            return epoch;
+        }
+
+        inline bool clear_soft_dirty()
+        {
+            const int fd = open("/proc/self/clear_refs", O_WRONLY | O_CLOEXEC);
+
+            if (fd < 0)
+                return false;
+
+            const bool success = write(fd, "4", 1) == 1;
+
+            close(fd);
+
+            if (success)
+                ++soft_dirty_epoch();
+
+            return success;
+        }
+
+        MEM_STRONG_INLINE bool is_soft_dirty(std::uint64_t entry) noexcept
+        {
+            return (entry >> 55) & 1;
+        }
+
+        // Kernels without CONFIG_MEM_SOFT_DIRTY accept clear_refs but never set the bit, so check it actually works
+        inline bool soft_dirty_supported()
+        {
+            static const bool supported = [] {
+                const std::size_t size = page_size();
+                byte* page = static_cast<byte*>(protect_alloc(size, prot_flags::RW));
+
+                if (page == nullptr)
+                    return false;
+
+                bool result = false;
+                std::uint64_t entry = 0;
+
+                page[0] = 1;
+
+                if (clear_soft_dirty() && read_pagemap(page, 1, &entry) && !is_soft_dirty(entry))
+                {
+                    page[0] = 2;
+
+                    result = read_pagemap(page, 1, &entry) && is_soft_dirty(entry);
+                }
+
+                protect_free(page, size);
+
+                return result;
+            }();
+
+            return supported;
+        }
+
+        // Resets the soft-dirty bits, returning the new epoch, or 0 if they cannot be tracked
+        inline std::uint64_t reset_soft_dirty()
+        {
+            if (soft_dirty_supported() && clear_soft_dirty())
+                return soft_dirty_epoch();
+
+            return 0;
+        }
+#endif
+
+        // Returns true if the 64 bytes at lhs and rhs are equal
+        MEM_STRONG_INLINE bool equal_64(const byte* lhs, const byte* rhs) noexcept
+        {
+#if !defined(MEM_REGION_SNAPSHOT_USE_GENERIC)
+#    if defined(MEM_SIMD_AVX2)
+            const __m256i lhs0 = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(lhs));
+            const __m256i lhs1 = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(lhs + 32));
+            const __m256i rhs0 = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(rhs));
+            const __m256i rhs1 = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(rhs + 32));
+
+            const __m256i diff = _mm256_or_si256(_mm256_xor_si256(lhs0, rhs0), _mm256_xor_si256(lhs1, rhs1));
+
+            return _mm256_testz_si256(diff, diff) != 0;
+#    elif defined(MEM_SIMD_SSE2)
+            __m128i equal = _mm_set1_epi8(-1);
+
+            for (std::size_t i = 0; i < 64; i += 16)
+            {
+                equal = _mm_and_si128(equal,
+                    _mm_cmpeq_epi8(_mm_loadu_si128(reinterpret_cast<const __m128i*>(lhs + i)),
+                        _mm_loadu_si128(reinterpret_cast<const __m128i*>(rhs + i))));
+            }
+
+            return _mm_movemask_epi8(equal) == 0xFFFF;
+#    else
+#        error Sorry, No Potatoes
+#    endif
+#else
+            return !std::memcmp(lhs, rhs, 64);
+#endif
+        }
+    } // namespace internal
+
+    inline region_snapshot::region_snapshot(region range)
+        : range_(range)
+    {
+        reset_dirty();
+
+        data_.resize(range.size);
+
+        if (range.size)
+            std::memcpy(data_.data(), range.start.as<const void*>(), range.size);
+    }
+
+    inline void region_snapshot::reset_dirty()
+    {
+#if defined(__linux__)
+        epoch_ = internal::reset_soft_dirty();
+#endif
+    }
+
+    inline std::vector<std::uint64_t> region_snapshot::read_dirty() const
+    {
+        std::vector<std::uint64_t> entries;
+
+#if defined(__linux__)
+        if (range_.size && tracking())
+        {
+            const std::size_t page = page_size();
+            const pointer first_page = range_.start.align_down(page);
+            const std::size_t page_count =
+                static_cast<std::size_t>(range_.start.add(range_.size).align_up(page) - first_page) / page;
+
+            entries.resize(page_count);
+
+            if (!read_pagemap(first_page, page_count, entries.data()))
+                entries.clear();
+        }
+#endif
+
+        return entries;
+    }
+
+    template <typename Func>
+    inline void region_snapshot::update(Func func)
+    {
+        if (!range_.size)
+            return;
+
+        const std::vector<std::uint64_t> entries = read_dirty();
+
+        reset_dirty();
+
+        compare(entries, func);
+    }
+
+    template <typename Func>
+    inline void region_snapshot::compare(const std::vector<std::uint64_t>& entries, Func func)
+    {
+        if (!range_.size)
+            return;
+
+        const std::size_t page = page_size();
+        const pointer first_page = range_.start.align_down(page);
+        const std::size_t page_count =
+            static_cast<std::size_t>(range_.start.add(range_.size).align_up(page) - first_page) / page;
+
+        byte* const copy = data_.data();
+        const byte* const current = range_.start.as<const byte*>();
+
+        std::size_t changed_start = 0;
+        std::size_t changed_end = 0;
+
+        const auto report = [&](std::size_t start, std::size_t end) {
+            if ((changed_end == start) && (changed_end != changed_start))
+            {
+                changed_end = end;
+
+                return;
+            }
+
+            if (changed_end != changed_start)
+                func(region(range_.start.add(changed_start), changed_end - changed_start));
+
+            changed_start = start;
+            changed_end = end;
+        };
+
+        for (std::size_t i = 0; i < page_count; ++i)
+        {
+            if (!entries.empty() && !internal::is_soft_dirty(entries[i]))
+                continue;
+
+            // The part of this page inside the range
+            const std::size_t page_offset = static_cast<std::size_t>(first_page.add(i * page) - range_.start);
+            const std::size_t start = (i == 0) ? 0 : page_offset;
+            const std::size_t end = (std::min)(page_offset + page, range_.size);
+
+            std::size_t offset = start;
+
+            for (; offset < end; offset += 64)
+            {
+                const std::size_t chunk_end = (std::min)(offset + 64, end);
+
+                if (((chunk_end - offset) == 64) && internal::equal_64(current + offset, copy + offset))
+                    continue;
+
+                for (std::size_t j = offset; j < chunk_end; ++j)
+                {
+                    if (current[j] != copy[j])
+                    {
+                        const byte value = current[j];
+
+                        report(j, j + 1);
+
+                        copy[j] = value;
+                    }
+                }
+            }
+        }
+
+        report(0, 0);
+    }
+
+    inline std::vector<region> region_snapshot::update()
+    {
+        std::vector<region> results;
+
+        update([&results](region changed) { results.push_back(changed); });
+
+        return results;
+    }
+
+    MEM_STRONG_INLINE region region_snapshot::range() const noexcept
+    {
+        return range_;
+    }
+
+    MEM_STRONG_INLINE const byte* region_snapshot::data() const noexcept
+    {
+        return data_.data();
+    }
+
+    MEM_STRONG_INLINE bool region_snapshot::tracking() const noexcept
+    {
+#if defined(__linux__)
+        return (epoch_ != 0) && (epoch_ == internal::soft_dirty_epoch());
+#else
+        return false;
+#endif
+    }
+
+    inline void region_snapshot_group::add(region_snapshot& snapshot)
+    {
+        if (std::find(snapshots_.begin(), snapshots_.end(), &snapshot) == snapshots_.end())
+            snapshots_.push_back(&snapshot);
+    }
+
+    inline void region_snapshot_group::remove(region_snapshot& snapshot)
+    {
+        snapshots_.erase(std::remove(snapshots_.begin(), snapshots_.end(), &snapshot), snapshots_.end());
+    }
+
+    template <typename Func>
+    inline void region_snapshot_group::update(Func func)
+    {
+        std::vector<std::vector<std::uint64_t>> entries;
+        entries.reserve(snapshots_.size());
+
+        for (region_snapshot* snapshot : snapshots_)
+            entries.push_back(snapshot->read_dirty());
+
+        std::uint64_t epoch = 0;
+
+#if defined(__linux__)
+        epoch = internal::reset_soft_dirty();
+#endif
+
+        for (std::size_t i = 0; i < snapshots_.size(); ++i)
+        {
+            region_snapshot& snapshot = *snapshots_[i];
+
+            snapshot.epoch_ = epoch;
+            snapshot.compare(entries[i], [&](region changed) { func(snapshot, changed); });
+        }
+    }
+
+    MEM_STRONG_INLINE std::size_t region_snapshot_group::size() const noexcept
+    {
+        return snapshots_.size();
+    }
+} // namespace mem
+
+#endif // MEM_REGION_SNAPSHOT_BRICK_H
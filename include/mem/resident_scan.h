@@ -0,0 +1,266 @@
+/*
+    Copyright 2018 Brick
+
+    Permission is hereby granted, free of charge, to any person obtaining a copy of this software
+    and associated documentation files (the "Software"), to deal in the Software without restriction,
+    including without limitation the rights to use, copy, modify, merge, publish, distribute,
+    sublicense, and/or sell copies of the Software, and to permit persons to whom the Software is
+    furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included in all copies or
+    substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING
+    BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+    NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM,
+    DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+    OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+*/
+
+#ifndef MEM_RESIDENT_SCAN_BRICK_H
+#define MEM_RESIDENT_SCAN_BRICK_H
+
+#include "mem.h"
+#include "protect.h"
+
+#include <algorithm>
+#include <cstring>
+#include <vector>
+
+namespace mem
+{
+    // Returns the parts of the range which have to be read to scan it.
+    // Anonymous pages which have never been touched are known to be zero, and so are left out. File backed pages which
+    // are not resident are also left out if skip_file_backed is set.
+    // Where the residency of the pages can't be queried, returns the whole range.
+    std::vector<region> resident_regions(region range, bool skip_file_backed = false);
+
+    // Scans the range like scanner(range, func), without reading (and so faulting in) the pages left out by
+    // resident_regions. Matches which span a resident page and a zero page are still found, but matches which span
+    // a skipped file backed page are not. Patterns which can match all zero bytes, or which are larger than a page,
+    // scan the whole range.
+    template <typename Scanner, typename Func>
+    pointer scan_resident(Scanner& scanner, region range, Func func, bool skip_file_backed = false);
+
+    template <typename Scanner>
+    std::vector<pointer> scan_resident_all(Scanner& scanner, region range, bool skip_file_backed = false);
+
+    namespace internal
+    {
+        enum class page_state : std::uint8_t
+        {
+            scan, // Has to be read
+            zero, // Never touched anonymous memory
+            skip, // Skipped file backed memory
+        };
+
+        struct page_run
+        {
+            region range;
+            page_state state;
+        };
+
+#if defined(__linux__)
+        struct mapping_query
+        {
+            region range;
+            std::vector<std::pair<region, bool>> mappings;
+        };
+
+        inline int mapping_query_callback(region_info* info, void* data)
+        {
+            mapping_query* query = static_cast<mapping_query*>(data);
+            const region mapping(info->start, info->end - info->start);
+
+            if ((mapping.start < query->range.start + query->range.size) &&
+                (query->range.start < mapping.start + mapping.size))
+            {
+                // Only private anonymous memory is known to be zero before it is touched
+                const bool anonymous = (info->flags & MAP_PRIVATE) &&
+                    ((info->flags & MAP_ANONYMOUS) || (info->path_name && (info->path_name[0] == '[')));
+
+                query->mappings.emplace_back(mapping, anonymous);
+            }
+
+            return 0;
+        }
+#endif
+
+        // Splits the range into runs of pages with the same state
+        inline std::vector<page_run> classify_pages(region range, bool skip_file_backed)
+        {
+            std::vector<page_run> runs;
+
+            if (!range.size)
+                return runs;
+
+#if defined(__linux__)
+            mapping_query query {range, {}};
+            iter_proc_maps(&mapping_query_callback, &query);
+
+            const std::size_t page = page_size();
+            const pointer range_end = range.start + range.size;
+            const pointer first_page = range.start.align_down(page);
+            const std::size_t page_count = static_cast<std::size_t>(range_end.align_up(page) - first_page) / page;
+
+            // Read the pagemap in chunks, so memory use doesn't grow with the range
+            constexpr std::size_t chunk_pages = 4096;
+            std::vector<std::uint64_t> entries((std::min)(page_count, chunk_pages));
+
+            std::size_t mapping = 0;
+
+            for (std::size_t i = 0; i < page_count; i += entries.size())
+            {
+                const std::size_t count = (std::min)(page_count - i, entries.size());
+
+                if (!read_pagemap(first_page.add(i * page), count, entries.data()))
+                    return {page_run {range, page_state::scan}};
+
+                for (std::size_t j = 0; j < count; ++j)
+                {
+                    const pointer address = first_page.add((i + j) * page);
+
+                    while ((mapping < query.mappings.size()) &&
+                        (query.mappings[mapping].first.start + query.mappings[mapping].first.size <= address))
+                        ++mapping;
+
+                    page_state state = page_state::scan;
+
+                    // Neither present (bit 63) nor swapped (bit 62)
+                    if (!(entries[j] >> 62) && (mapping < query.mappings.size()) &&
+                        query.mappings[mapping].first.contains(address))
+                    {
+                        if (query.mappings[mapping].second)
+                            state = page_state::zero;
+                        else if (skip_file_backed)
+                            state = page_state::skip;
+                    }
+
+                    const pointer start = (std::max)(address, range.start);
+                    const pointer end = (std::min)(address + page, range_end);
+
+                    if (!runs.empty() && (runs.back().state == state))
+                        runs.back().range.size += static_cast<std::size_t>(end - start);
+                    else
+                        runs.push_back({region(start, static_cast<std::size_t>(end - start)), state});
+                }
+            }
+#else
+            (void) skip_file_backed;
+
+            runs.push_back({range, page_state::scan});
+#endif
+
+            return runs;
+        }
+    } // namespace internal
+
+    inline std::vector<region> resident_regions(region range, bool skip_file_backed)
+    {
+        std::vector<region> results;
+
+        for (const internal::page_run& run : internal::classify_pages(range, skip_file_backed))
+        {
+            if (run.state == internal::page_state::scan)
+                results.push_back(run.range);
+        }
+
+        return results;
+    }
+
+    template <typename Scanner, typename Func>
+    inline pointer scan_resident(Scanner& scanner, region range, Func func, bool skip_file_backed)
+    {
+        const std::size_t size = scanner.pattern_size();
+
+        if ((size == 0) || (size > page_size()))
+            return scanner(range, func);
+
+        std::vector<byte> buffer((size - 1) * 2);
+
+        // A pattern which matches zeros could also match inside of the zero pages
+        buffer.resize((std::max)(buffer.size(), size));
+
+        if (scanner(region(buffer.data(), size)))
+            return scanner(range, func);
+
+        const std::vector<internal::page_run> runs = internal::classify_pages(range, skip_file_backed);
+
+        // Scans the bytes before (or after) a run, with the zero page bytes filled in
+        const auto scan_edge = [&](pointer base, std::size_t length, std::size_t limit) -> pointer {
+            pointer result = nullptr;
+
+            scanner(region(buffer.data(), length), [&](pointer match) {
+                const std::size_t offset = static_cast<std::size_t>(match - pointer(buffer.data()));
+
+                if ((offset < limit) && func(base.add(offset)))
+                {
+                    result = base.add(offset);
+
+                    return true;
+                }
+
+                return false;
+            });
+
+            return result;
+        };
+
+        for (std::size_t i = 0; i < runs.size(); ++i)
+        {
+            const internal::page_run& run = runs[i];
+
+            if (run.state != internal::page_state::scan)
+                continue;
+
+            if ((size > 1) && (i != 0) && (runs[i - 1].state == internal::page_state::zero))
+            {
+                const std::size_t gap = (std::min)(size - 1, runs[i - 1].range.size);
+                const std::size_t head = (std::min)(size - 1, run.range.size);
+
+                std::memset(buffer.data(), 0, gap);
+                std::memcpy(buffer.data() + gap, run.range.start.as<const void*>(), head);
+
+                if (const pointer result = scan_edge(run.range.start - gap, gap + head, gap))
+                    return result;
+            }
+
+            if (const pointer result = scanner(run.range, func))
+                return result;
+
+            if ((size > 1) && (i + 1 != runs.size()) && (runs[i + 1].state == internal::page_state::zero))
+            {
+                const std::size_t gap = (std::min)(size - 1, runs[i + 1].range.size);
+                const std::size_t tail = (std::min)(size - 1, run.range.size);
+                const pointer tail_start = run.range.start.add(run.range.size - tail);
+
+                std::memcpy(buffer.data(), tail_start.as<const void*>(), tail);
+                std::memset(buffer.data() + tail, 0, gap);
+
+                if (const pointer result = scan_edge(tail_start, tail + gap, tail))
+                    return result;
+            }
+        }
+
+        return nullptr;
+    }
+
+    template <typename Scanner>
+    inline std::vector<pointer> scan_resident_all(Scanner& scanner, region range, bool skip_file_backed)
+    {
+        std::vector<pointer> results;
+
+        scan_resident(
+            scanner, range,
+            [&results](pointer result) {
+                results.push_back(result);
+
+                return false;
+            },
+            skip_file_backed);
+
+        return results;
+    }
+} // namespace mem
+
+#endif // MEM_RESIDENT_SCAN_BRICK_H
@@ -0,0 +1,225 @@
+/*
+    Copyright 2018 Brick
+
+    Permission is hereby granted, free of charge, to any person obtaining a copy of this software
+    and associated documentation files (the "Software"), to deal in the Software without restriction,
+    including without limitation the rights to use, copy, modify, merge, publish, distribute,
+    sublicense, and/or sell copies of the Software, and to permit persons to whom the Software is
+    furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included in all copies or
+    substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING
+    BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+    NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM,
+    DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+    OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+*/
+
+#ifndef MEM_RESUMABLE_SCAN_BRICK_H
+#define MEM_RESUMABLE_SCAN_BRICK_H
+
+#include "pattern.h"
+
+#include <chrono>
+#include <utility>
+#include <vector>
+
+namespace mem
+{
+    // A scan which can be run a little at a time, with a limit on the bytes or time spent by each step.
+    // The scanner is owned by the scan, so any state it adapts while scanning (such as the anchor order of
+    // simd_scanner) is kept between steps.
+    template <typename Scanner>
+    class resumable_scan
+    {
+    public:
+        using clock = std::chrono::steady_clock;
+
+    private:
+        Scanner scanner_;
+        region range_ {};
+        std::size_t pattern_size_ {0};
+
+        // The number of start positions which have been scanned, out of positions_
+        std::size_t position_ {0};
+        std::size_t positions_ {0};
+
+        // The chunk size used by timed steps, adapted to how fast the scanner runs
+        std::size_t chunk_ {internal::min_scan_chunk * 16};
+
+        bool cancelled_ {false};
+        std::vector<pointer> results_ {};
+
+        template <typename Func>
+        void scan_chunk(std::size_t length, Func& func);
+
+    public:
+        resumable_scan(Scanner scanner, region range);
+
+        // Scans up to budget more start positions, calling func(address) for each match.
+        // If func returns true, the scan is cancelled. Returns true once the scan is done.
+        template <typename Func>
+        bool step(std::size_t budget, Func func);
+
+        // Same as above, but adds each match to results()
+        bool step(std::size_t budget);
+
+        // Scans until the budget of time runs out, checking the time after every chunk
+        template <typename Rep, typename Period, typename Func>
+        bool step(std::chrono::duration<Rep, Period> budget, Func func);
+
+        template <typename Rep, typename Period>
+        bool step(std::chrono::duration<Rep, Period> budget);
+
+        void cancel() noexcept;
+
+        // True once the whole range has been scanned, or the scan was cancelled
+        bool done() const noexcept;
+        bool cancelled() const noexcept;
+
+        // The fraction of the range which has been scanned, from 0 to 1
+        double progress() const noexcept;
+
+        // The address of the next start position to be scanned
+        pointer position() const noexcept;
+
+        const std::vector<pointer>& results() const noexcept;
+
+        Scanner& scanner() noexcept;
+    };
+
+    template <typename Scanner>
+    inline resumable_scan<Scanner>::resumable_scan(Scanner scanner, region range)
+        : scanner_(std::move(scanner))
+        , range_(range)
+        , pattern_size_(scanner_.pattern_size())
+        , positions_((pattern_size_ && (range.size >= pattern_size_)) ? (range.size - pattern_size_ + 1) : 0)
+    {}
+
+    template <typename Scanner>
+    template <typename Func>
+    inline void resumable_scan<Scanner>::scan_chunk(std::size_t length, Func& func)
+    {
+        const std::size_t end = ((positions_ - position_) < length) ? positions_ : (position_ + length);
+
+        // Only matches which start before the end of the chunk fit inside of it
+        const region chunk(range_.start.add(position_), (end - position_) + pattern_size_ - 1);
+
+        const pointer result = scanner_(chunk, [&func](pointer address) { return func(address); });
+
+        if (result)
+        {
+            cancelled_ = true;
+            position_ = static_cast<std::size_t>(result - range_.start) + 1;
+        }
+        else
+        {
+            position_ = end;
+        }
+    }
+
+    template <typename Scanner>
+    template <typename Func>
+    inline bool resumable_scan<Scanner>::step(std::size_t budget, Func func)
+    {
+        if (!done() && budget)
+            scan_chunk(budget, func);
+
+        return done();
+    }
+
+    template <typename Scanner>
+    inline bool resumable_scan<Scanner>::step(std::size_t budget)
+    {
+        return step(budget, [this](pointer address) {
+            results_.push_back(address);
+
+            return false;
+        });
+    }
+
+    template <typename Scanner>
+    template <typename Rep, typename Period, typename Func>
+    inline bool resumable_scan<Scanner>::step(std::chrono::duration<Rep, Period> budget, Func func)
+    {
+        const clock::time_point start = clock::now();
+        const clock::duration limit = std::chrono::duration_cast<clock::duration>(budget);
+
+        clock::time_point now = start;
+
+        while (!done() && ((now - start) < limit))
+        {
+            scan_chunk(chunk_, func);
+
+            const clock::time_point after = clock::now();
+            const clock::duration taken = after - now;
+
+            // Aim for chunks which take less than a quarter of the budget, so a step doesn't overrun by much
+            if (((taken * 8) < limit) && (chunk_ < internal::max_scan_chunk))
+                chunk_ *= 2;
+            else if (((taken * 4) > limit) && (chunk_ > internal::min_scan_chunk))
+                chunk_ /= 2;
+
+            now = after;
+        }
+
+        return done();
+    }
+
+    template <typename Scanner>
+    template <typename Rep, typename Period>
+    inline bool resumable_scan<Scanner>::step(std::chrono::duration<Rep, Period> budget)
+    {
+        return step(budget, [this](pointer address) {
+            results_.push_back(address);
+
+            return false;
+        });
+    }
+
+    template <typename Scanner>
+    MEM_STRONG_INLINE void resumable_scan<Scanner>::cancel() noexcept
+    {
+        cancelled_ = true;
+    }
+
+    template <typename Scanner>
+    MEM_STRONG_INLINE bool resumable_scan<Scanner>::done() const noexcept
+    {
+        return cancelled_ || (position_ >= positions_);
+    }
+
+    template <typename Scanner>
+    MEM_STRONG_INLINE bool resumable_scan<Scanner>::cancelled() const noexcept
+    {
+        return cancelled_;
+    }
+
+    template <typename Scanner>
+    inline double resumable_scan<Scanner>::progress() const noexcept
+    {
+        return positions_ ? (static_cast<double>(position_) / static_cast<double>(positions_)) : 1.0;
+    }
+
+    template <typename Scanner>
+    MEM_STRONG_INLINE pointer resumable_scan<Scanner>::position() const noexcept
+    {
+        return range_.start.add(position_);
+    }
+
+    template <typename Scanner>
+    MEM_STRONG_INLINE const std::vector<pointer>& resumable_scan<Scanner>::results() const noexcept
+    {
+        return results_;
+    }
+
+    template <typename Scanner>
+    MEM_STRONG_INLINE Scanner& resumable_scan<Scanner>::scanner() noexcept
+    {
+        return scanner_;
+    }
+} // namespace mem
+
+#endif // MEM_RESUMABLE_SCAN_BRICK_H
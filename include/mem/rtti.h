@@ -20,17 +20,36 @@
 #ifndef MEM_RTTI_BRICK_H
 #define MEM_RTTI_BRICK_H
 
+#include "hasher.h"
 #include "mem.h"
 
 #if defined(MEM_ARCH_X86) || defined(MEM_ARCH_X86_64)
-#    if !defined(_WIN32)
-#        error mem::rtti only supports windows
-#    endif // !_WIN32
+#    if defined(MEM_RTTI_DEMANGLE) && !defined(_WIN32)
+#        error MEM_RTTI_DEMANGLE is only supported on windows
+#    endif
 #else
 #    error mem::rtti only supports x86 and x64
 #endif
 
+#if !defined(MEM_RTTI_USE_GENERIC)
+#    if defined(MEM_SIMD_AVX2)
+#        include <immintrin.h>
+#    elif defined(MEM_SIMD_SSE2)
+#        include <emmintrin.h>
+#    else
+#        define MEM_RTTI_USE_GENERIC
+#    endif
+#endif
+
+#if !defined(MEM_RTTI_USE_GENERIC)
+#    include "arch.h"
+#endif
+
+#include <cstring>
 #include <functional>
+#include <string>
+#include <unordered_map>
+#include <vector>
 
 namespace mem
 {
@@ -119,6 +138,38 @@ namespace mem
                 callback);
         const RTTITypeDescriptor* find_rtti_type(const region& region, const char* name);
 
+        // Indexes every complete object locator in a region once, so types can be found by their decorated name
+        class rtti_index
+        {
+        public:
+            struct type_entry
+            {
+                const RTTITypeDescriptor* type {nullptr};
+                std::vector<const RTTICompleteObjectLocator*> locators {};
+                std::vector<const void**> vtables {};
+            };
+
+        private:
+            std::vector<type_entry> types_ {};
+            std::unordered_map<const char*, std::size_t, string_hash, string_equal> names_ {};
+            std::unordered_map<std::uintptr_t, std::size_t> locators_ {};
+
+            std::size_t add_locator(const region& region, const RTTICompleteObjectLocator* locator);
+
+        public:
+            rtti_index() = default;
+
+            explicit rtti_index(const region& region);
+
+            const type_entry* find_type(const char* decorated_name) const;
+            const type_entry* find_type(const RTTITypeDescriptor* type) const;
+
+            template <typename Func>
+            void enum_types(Func func) const;
+
+            std::size_t size() const noexcept;
+        };
+
         inline constexpr bool check_rtti_signature(std::uint32_t signature) noexcept
         {
 #if defined(MEM_ARCH_X86_64)
@@ -276,6 +327,226 @@ namespace mem
             }
         }
 
+        namespace internal
+        {
+            inline const RTTITypeDescriptor* get_locator_type(
+                const region& region, const RTTICompleteObjectLocator* locator)
+            {
+                const RTTITypeDescriptor* type = locator->get_type(region);
+
+                if (!type || !region.contains<RTTITypeDescriptor>(type))
+                    return nullptr;
+
+                if (!region.contains<void*>(type->vTable))
+                    return nullptr;
+
+                if (std::strncmp(type->DecoratedName, ".?", 2))
+                    return nullptr;
+
+                return type;
+            }
+
+#if defined(MEM_ARCH_X86_64)
+            // Finds every 4-byte aligned locator with a valid signature which points to itself
+            template <typename Func>
+            inline void scan_locators(const region& region, Func func)
+            {
+                const byte* const base = region.start.as<const byte*>();
+                const std::size_t size = region.size;
+
+                if (size < sizeof(RTTICompleteObjectLocator))
+                    return;
+
+                std::size_t offset = static_cast<std::size_t>(region.start.align_up(4) - region.start);
+
+#    if !defined(MEM_RTTI_USE_GENERIC)
+#        if defined(MEM_SIMD_AVX2)
+#            define l_SIMD_TYPE __m256i
+#            define l_SIMD_LOAD(x) _mm256_loadu_si256(reinterpret_cast<const __m256i*>(x))
+#            define l_SIMD_FILL32(x) _mm256_set1_epi32(static_cast<int>(x))
+#            define l_SIMD_LANES32(x) \
+                _mm256_add_epi32(l_SIMD_FILL32(x), _mm256_set_epi32(28, 24, 20, 16, 12, 8, 4, 0))
+#            define l_SIMD_ADD32(x, y) _mm256_add_epi32(x, y)
+#            define l_SIMD_CMPEQ_AND(x, y, z, w) _mm256_and_si256(_mm256_cmpeq_epi32(x, y), _mm256_cmpeq_epi32(z, w))
+#            define l_SIMD_MOVEMASK32(x) _mm256_movemask_ps(_mm256_castsi256_ps(x))
+#        elif defined(MEM_SIMD_SSE2)
+#            define l_SIMD_TYPE __m128i
+#            define l_SIMD_LOAD(x) _mm_loadu_si128(reinterpret_cast<const __m128i*>(x))
+#            define l_SIMD_FILL32(x) _mm_set1_epi32(static_cast<int>(x))
+#            define l_SIMD_LANES32(x) _mm_add_epi32(l_SIMD_FILL32(x), _mm_set_epi32(12, 8, 4, 0))
+#            define l_SIMD_ADD32(x, y) _mm_add_epi32(x, y)
+#            define l_SIMD_CMPEQ_AND(x, y, z, w) _mm_and_si128(_mm_cmpeq_epi32(x, y), _mm_cmpeq_epi32(z, w))
+#            define l_SIMD_MOVEMASK32(x) _mm_movemask_ps(_mm_castsi128_ps(x))
+#        else
+#            error Sorry, No Potatoes
+#        endif
+
+                const std::size_t self_offset = offsetof(RTTICompleteObjectLocator, pSelf);
+
+                const l_SIMD_TYPE signature = l_SIMD_FILL32(1);
+                const l_SIMD_TYPE stride = l_SIMD_FILL32(sizeof(l_SIMD_TYPE));
+                l_SIMD_TYPE rvas = l_SIMD_LANES32(offset);
+
+                while (MEM_LIKELY((offset + self_offset + sizeof(l_SIMD_TYPE)) <= size))
+                {
+                    unsigned int mask = static_cast<unsigned int>(l_SIMD_MOVEMASK32(l_SIMD_CMPEQ_AND(
+                        l_SIMD_LOAD(base + offset), signature, l_SIMD_LOAD(base + offset + self_offset), rvas)));
+
+                    while (MEM_UNLIKELY(mask != 0))
+                    {
+                        if (func(reinterpret_cast<const RTTICompleteObjectLocator*>(base + offset + (bsf(mask) * 4))))
+                            return;
+
+                        mask &= mask - 1;
+                    }
+
+                    offset += sizeof(l_SIMD_TYPE);
+                    rvas = l_SIMD_ADD32(rvas, stride);
+                }
+
+#        undef l_SIMD_TYPE
+#        undef l_SIMD_LOAD
+#        undef l_SIMD_FILL32
+#        undef l_SIMD_LANES32
+#        undef l_SIMD_ADD32
+#        undef l_SIMD_CMPEQ_AND
+#        undef l_SIMD_MOVEMASK32
+#    endif
+
+                for (; offset + sizeof(RTTICompleteObjectLocator) <= size; offset += 4)
+                {
+                    const RTTICompleteObjectLocator* locator =
+                        reinterpret_cast<const RTTICompleteObjectLocator*>(base + offset);
+
+                    if (locator->check_signature() && (locator->pSelf == offset))
+                    {
+                        if (func(locator))
+                            return;
+                    }
+                }
+            }
+#endif // MEM_ARCH_X86_64
+        } // namespace internal
+
+        inline std::size_t rtti_index::add_locator(const region& region, const RTTICompleteObjectLocator* locator)
+        {
+            const auto find = locators_.find(pointer(locator).as<std::uintptr_t>());
+
+            if (find != locators_.end())
+                return find->second;
+
+            const RTTITypeDescriptor* type = internal::get_locator_type(region, locator);
+
+            std::size_t index = SIZE_MAX;
+
+            if (type)
+            {
+                index = names_.emplace(type->DecoratedName, types_.size()).first->second;
+
+                if (index == types_.size())
+                {
+                    types_.emplace_back();
+                    types_.back().type = type;
+                }
+
+                types_[index].locators.push_back(locator);
+            }
+
+            locators_.emplace(pointer(locator).as<std::uintptr_t>(), index);
+
+            return index;
+        }
+
+        inline rtti_index::rtti_index(const region& region)
+        {
+            std::uintptr_t min_locator = region.start.as<std::uintptr_t>();
+            std::uintptr_t max_locator = region.start.add(region.size).as<std::uintptr_t>();
+
+#if defined(MEM_ARCH_X86_64)
+            min_locator = UINTPTR_MAX;
+            max_locator = 0;
+
+            internal::scan_locators(region, [&](const RTTICompleteObjectLocator* locator) {
+                if (add_locator(region, locator) != SIZE_MAX)
+                {
+                    const std::uintptr_t address = pointer(locator).as<std::uintptr_t>();
+
+                    if (address < min_locator)
+                        min_locator = address;
+
+                    if (address > max_locator)
+                        max_locator = address;
+                }
+
+                return false;
+            });
+#endif // MEM_ARCH_X86_64
+
+            if (min_locator > max_locator)
+                return;
+
+            const std::uintptr_t* slot = region.start.align_up(sizeof(void*)).as<const std::uintptr_t*>();
+            const std::uintptr_t* const end =
+                region.start.add(region.size).align_down(sizeof(void*)).as<const std::uintptr_t*>();
+
+            for (; slot < end; ++slot)
+            {
+                const std::uintptr_t value = *slot;
+
+                if (MEM_LIKELY((value < min_locator) || (value > max_locator)))
+                    continue;
+
+#if defined(MEM_ARCH_X86_64)
+                const auto find = locators_.find(value);
+
+                if (find == locators_.end())
+                    continue;
+
+                const std::size_t index = find->second;
+#else
+                if (!region.contains<RTTICompleteObjectLocator>(value))
+                    continue;
+
+                const RTTICompleteObjectLocator* locator = pointer(value).as<const RTTICompleteObjectLocator*>();
+
+                if (!locator->check_signature())
+                    continue;
+
+                const std::size_t index = add_locator(region, locator);
+#endif // MEM_ARCH_X86_64
+
+                if (index != SIZE_MAX)
+                    types_[index].vtables.push_back(pointer(slot + 1).as<const void**>());
+            }
+        }
+
+        inline const rtti_index::type_entry* rtti_index::find_type(const char* decorated_name) const
+        {
+            const auto find = names_.find(decorated_name);
+
+            return (find != names_.end()) ? &types_[find->second] : nullptr;
+        }
+
+        inline const rtti_index::type_entry* rtti_index::find_type(const RTTITypeDescriptor* type) const
+        {
+            return find_type(type->DecoratedName);
+        }
+
+        template <typename Func>
+        inline void rtti_index::enum_types(Func func) const
+        {
+            for (const type_entry& type : types_)
+            {
+                if (func(type))
+                    break;
+            }
+        }
+
+        MEM_STRONG_INLINE std::size_t rtti_index::size() const noexcept
+        {
+            return types_.size();
+        }
+
 #if defined(MEM_RTTI_DEMANGLE)
         inline const RTTITypeDescriptor* find_rtti_type(const region& region, const char* name)
         {
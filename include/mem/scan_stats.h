@@ -0,0 +1,318 @@
+/*
+    Copyright 2018 Brick
+
+    Permission is hereby granted, free of charge, to any person obtaining a copy of this software
+    and associated documentation files (the "Software"), to deal in the Software without restriction,
+    including without limitation the rights to use, copy, modify, merge, publish, distribute,
+    sublicense, and/or sell copies of the Software, and to permit persons to whom the Software is
+    furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included in all copies or
+    substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING
+    BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+    NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM,
+    DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+    OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+*/
+#ifndef MEM_SCAN_STATS_BRICK_H
+#define MEM_SCAN_STATS_BRICK_H
+
+// Opt-in scan instrumentation. Define MEM_SCAN_STATS (or configure with -DMEM_SCAN_STATS=ON) and install a sink with
+// set_scan_stats_sink to receive one record per scan. Without it, the hooks below expand to nothing.
+
+#if defined(MEM_SCAN_STATS)
+
+#    include "mem.h"
+
+#    if defined(MEM_ARCH_X86) || defined(MEM_ARCH_X86_64)
+#        include "arch.h"
+#    endif
+
+#    include <algorithm>
+#    include <atomic>
+#    include <chrono>
+#    include <map>
+#    include <mutex>
+#    include <ostream>
+#    include <string>
+#    include <utility>
+#    include <vector>
+
+namespace mem
+{
+    class pattern;
+
+    struct scan_stats
+    {
+        std::uint64_t scans {0};
+        std::uint64_t bytes_scanned {0};
+
+        // Candidates which passed the anchor filter, and how many of those were then rejected
+        std::uint64_t anchor_hits {0};
+        std::uint64_t verify_failures {0};
+
+        // Times the anchor bytes were reordered after a failed verification
+        std::uint64_t reorders {0};
+
+        std::uint64_t matches {0};
+        std::uint64_t cache_hits {0};
+        std::uint64_t cache_misses {0};
+
+        // rdtsc ticks on x86, nanoseconds elsewhere
+        std::uint64_t cycles {0};
+
+        scan_stats& operator+=(const scan_stats& rhs) noexcept;
+    };
+
+    class scan_stats_sink
+    {
+    public:
+        virtual ~scan_stats_sink() = default;
+
+        // Called once per scan, from the scanning thread
+        virtual void record(const char* scanner, const pattern& pattern, const scan_stats& stats) = 0;
+    };
+
+    // The sink must outlive any scans which may record to it
+    void set_scan_stats_sink(scan_stats_sink* sink) noexcept;
+    scan_stats_sink* get_scan_stats_sink() noexcept;
+
+    // Aggregates the records of each scanner and pattern
+    class scan_stats_collector : public scan_stats_sink
+    {
+    public:
+        struct entry
+        {
+            std::string scanner;
+            std::string pattern;
+            scan_stats stats;
+        };
+
+        void record(const char* scanner, const pattern& pattern, const scan_stats& stats) override;
+
+        // Sorted from most to fewest cycles
+        std::vector<entry> entries() const;
+
+        void clear();
+
+        void write_json(std::ostream& output) const;
+        void write_csv(std::ostream& output) const;
+
+    private:
+        mutable std::mutex mutex_ {};
+        std::map<std::pair<std::string, std::string>, scan_stats> stats_ {};
+    };
+
+    namespace internal
+    {
+        inline std::atomic<scan_stats_sink*>& scan_stats_sink_ref() noexcept
+        {
+            static std::atomic<scan_stats_sink*> sink {nullptr};
+
+            return sink;
+        }
+
+        // The stats of the innermost scan running on this thread, or null if nothing is being recorded
+        inline scan_stats*& current_scan_stats() noexcept
+        {
+            static thread_local scan_stats* current {nullptr};
+
+            return current;
+        }
+
+        MEM_STRONG_INLINE std::uint64_t scan_stats_ticks() noexcept
+        {
+#    if defined(MEM_ARCH_X86) || defined(MEM_ARCH_X86_64)
+            return rdtsc();
+#    else
+            return static_cast<std::uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(
+                std::chrono::steady_clock::now().time_since_epoch())
+                                                  .count());
+#    endif
+        }
+
+        class scan_stats_scope
+        {
+        private:
+            const char* name_;
+            const pattern& pattern_;
+            region range_;
+            scan_stats_sink* sink_;
+            scan_stats* previous_;
+            scan_stats stats_ {};
+            std::uint64_t start_ {0};
+
+        public:
+            scan_stats_scope(const char* name, const pattern& pattern, region range) noexcept;
+            ~scan_stats_scope();
+
+            scan_stats_scope(const scan_stats_scope&) = delete;
+            scan_stats_scope& operator=(const scan_stats_scope&) = delete;
+
+            pointer result(pointer value) noexcept;
+        };
+    } // namespace internal
+
+    inline scan_stats& scan_stats::operator+=(const scan_stats& rhs) noexcept
+    {
+        scans += rhs.scans;
+        bytes_scanned += rhs.bytes_scanned;
+        anchor_hits += rhs.anchor_hits;
+        verify_failures += rhs.verify_failures;
+        reorders += rhs.reorders;
+        matches += rhs.matches;
+        cache_hits += rhs.cache_hits;
+        cache_misses += rhs.cache_misses;
+        cycles += rhs.cycles;
+
+        return *this;
+    }
+
+    inline void set_scan_stats_sink(scan_stats_sink* sink) noexcept
+    {
+        internal::scan_stats_sink_ref().store(sink, std::memory_order_release);
+    }
+
+    inline scan_stats_sink* get_scan_stats_sink() noexcept
+    {
+        return internal::scan_stats_sink_ref().load(std::memory_order_acquire);
+    }
+
+    namespace internal
+    {
+        inline scan_stats_scope::scan_stats_scope(const char* name, const pattern& pattern, region range) noexcept
+            : name_(name)
+            , pattern_(pattern)
+            , range_(range)
+            , sink_(get_scan_stats_sink())
+            , previous_(current_scan_stats())
+        {
+            stats_.scans = 1;
+            current_scan_stats() = sink_ ? &stats_ : nullptr;
+            start_ = scan_stats_ticks();
+        }
+
+        inline scan_stats_scope::~scan_stats_scope()
+        {
+            stats_.cycles = scan_stats_ticks() - start_;
+            current_scan_stats() = previous_;
+
+            if (sink_)
+                sink_->record(name_, pattern_, stats_);
+        }
+
+        inline pointer scan_stats_scope::result(pointer value) noexcept
+        {
+            if (value)
+            {
+                stats_.bytes_scanned = static_cast<std::uint64_t>(value - range_.start);
+                ++stats_.matches;
+            }
+            else
+            {
+                stats_.bytes_scanned = range_.size;
+            }
+
+            return value;
+        }
+    } // namespace internal
+} // namespace mem
+
+#    define MEM_SCAN_STATS_SCOPE(NAME, PATTERN, RANGE) \
+        mem::internal::scan_stats_scope mem_scan_stats_scope_(NAME, PATTERN, RANGE)
+
+#    define MEM_SCAN_STATS_ADD(FIELD, VALUE)                                             \
+        do                                                                               \
+        {                                                                                \
+            if (mem::scan_stats* mem_scan_stats_ = mem::internal::current_scan_stats()) \
+                mem_scan_stats_->FIELD += (VALUE);                                       \
+        } while (false)
+
+#    define MEM_SCAN_STATS_RESULT(RESULT) mem_scan_stats_scope_.result(RESULT)
+
+#    include "pattern.h"
+
+namespace mem
+{
+    inline void scan_stats_collector::record(const char* scanner, const pattern& pattern, const scan_stats& stats)
+    {
+        std::pair<std::string, std::string> key {scanner, pattern.to_string()};
+
+        std::lock_guard<std::mutex> lock(mutex_);
+
+        stats_[std::move(key)] += stats;
+    }
+
+    inline std::vector<scan_stats_collector::entry> scan_stats_collector::entries() const
+    {
+        std::vector<entry> results;
+
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+
+            results.reserve(stats_.size());
+
+            for (const auto& stats : stats_)
+                results.push_back({stats.first.first, stats.first.second, stats.second});
+        }
+
+        std::stable_sort(results.begin(), results.end(),
+            [](const entry& lhs, const entry& rhs) { return lhs.stats.cycles > rhs.stats.cycles; });
+
+        return results;
+    }
+
+    inline void scan_stats_collector::clear()
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+
+        stats_.clear();
+    }
+
+    inline void scan_stats_collector::write_json(std::ostream& output) const
+    {
+        const std::vector<entry> results = entries();
+
+        output << "[";
+
+        for (std::size_t i = 0; i < results.size(); ++i)
+        {
+            const entry& e = results[i];
+
+            output << (i ? ",\n " : "\n ") << "{\"scanner\":\"" << e.scanner << "\",\"pattern\":\"" << e.pattern
+                   << "\",\"scans\":" << e.stats.scans << ",\"bytes_scanned\":" << e.stats.bytes_scanned
+                   << ",\"anchor_hits\":" << e.stats.anchor_hits
+                   << ",\"verify_failures\":" << e.stats.verify_failures << ",\"reorders\":" << e.stats.reorders
+                   << ",\"matches\":" << e.stats.matches << ",\"cache_hits\":" << e.stats.cache_hits
+                   << ",\"cache_misses\":" << e.stats.cache_misses << ",\"cycles\":" << e.stats.cycles << "}";
+        }
+
+        output << (results.empty() ? "]\n" : "\n]\n");
+    }
+
+    inline void scan_stats_collector::write_csv(std::ostream& output) const
+    {
+        output << "scanner,pattern,scans,bytes_scanned,anchor_hits,verify_failures,reorders,matches,cache_hits,"
+                  "cache_misses,cycles\n";
+
+        for (const entry& e : entries())
+        {
+            output << e.scanner << ',' << e.pattern << ',' << e.stats.scans << ',' << e.stats.bytes_scanned << ','
+                   << e.stats.anchor_hits << ',' << e.stats.verify_failures << ',' << e.stats.reorders << ','
+                   << e.stats.matches << ',' << e.stats.cache_hits << ',' << e.stats.cache_misses << ','
+                   << e.stats.cycles << '\n';
+        }
+    }
+} // namespace mem
+
+#else
+
+#    define MEM_SCAN_STATS_SCOPE(NAME, PATTERN, RANGE) static_cast<void>(0)
+#    define MEM_SCAN_STATS_ADD(FIELD, VALUE) static_cast<void>(0)
+#    define MEM_SCAN_STATS_RESULT(RESULT) (RESULT)
+
+#endif
+
+#endif // MEM_SCAN_STATS_BRICK_H
@@ -36,7 +36,10 @@
 #    include "arch.h"
 #endif
 
+#include "scan_stats.h"
+
 #include <algorithm>
+#include <cmath>
 
 namespace mem
 {
@@ -59,16 +62,52 @@ namespace mem
         std::vector<scan_byte> bytes_ {};
         std::size_t num_literals_ {};
 
-        const byte* scan_literals(const byte* start, const byte* end);
+        // Kept between scans, so the anchor order keeps adapting across consecutive matches
+        std::uint32_t rng_ {1};
+
+        // Matches are only reported at addresses which are a multiple of this
+        std::size_t alignment_ {1};
+
+        void select_anchors(const byte* bigram_frequencies);
+
+    public:
+        // Where the vector loop left off, along with the candidates from the last block which have not been returned
+        struct scan_state
+        {
+            const byte* ptr {nullptr};
+            const byte* end {nullptr};
+            const byte* base {nullptr};
+            std::uint32_t pending {0};
+
+            // Just past the last match, where the next match can start. Pending lanes can be before ptr.
+            const byte* next {nullptr};
+        };
+
+    private:
+        template <bool Aligned>
+        const byte* scan_literals(scan_state& state);
+        std::size_t count_literals(const byte* start, const byte* end) const;
 
     public:
         simd_scanner() = default;
 
         simd_scanner(const pattern& pattern);
         simd_scanner(const pattern& pattern, const byte* frequencies);
+        simd_scanner(const pattern& pattern, const byte* frequencies, std::size_t alignment);
+
+        // Uses a bigram table (see bigram_frequencies.h) to pick the pair of anchors least likely to match together
+        simd_scanner(const pattern& pattern, const byte* frequencies, std::size_t alignment,
+            const byte* bigram_frequencies);
 
         pointer scan(region range);
 
+        scan_state start_scan(region range) const noexcept;
+        pointer scan_next(scan_state& state);
+
+        std::size_t pattern_size() const noexcept;
+
+        std::size_t count(region range, std::size_t limit = SIZE_MAX);
+
         static const byte* default_frequencies() noexcept;
     };
 
@@ -77,7 +116,18 @@ namespace mem
     {}
 
     inline simd_scanner::simd_scanner(const pattern& _pattern, const byte* frequencies)
+        : simd_scanner(_pattern, frequencies, 1)
+    {}
+
+    inline simd_scanner::simd_scanner(const pattern& _pattern, const byte* frequencies, std::size_t alignment)
+        : simd_scanner(_pattern, frequencies, alignment, nullptr)
+    {}
+
+    // The alignment must be a power of two
+    inline simd_scanner::simd_scanner(
+        const pattern& _pattern, const byte* frequencies, std::size_t alignment, const byte* bigram_frequencies)
         : pattern_(&_pattern)
+        , alignment_(alignment ? alignment : 1)
     {
         const std::size_t trimmed_size = pattern_->trimmed_size();
         const byte* const bytes = pattern_->bytes();
@@ -111,6 +161,9 @@ namespace mem
 
         num_literals_ = bytes_.size();
 
+        if (bigram_frequencies && num_literals_ > 2)
+            select_anchors(bigram_frequencies);
+
         for (std::size_t i = 0; i < trimmed_size; ++i)
         {
             std::uint8_t v = bytes[i];
@@ -148,12 +201,153 @@ namespace mem
         return frequencies;
     }
 
-    MEM_NOINLINE inline const byte* simd_scanner::scan_literals(const byte* ptr, const byte* end)
+    namespace internal
+    {
+        // Maps a bigram cost (-log2(p) in eighths of a bit) back to a probability
+        inline const double* bigram_probabilities() noexcept
+        {
+            static const struct table
+            {
+                double values[256];
+
+                table() noexcept
+                {
+                    for (std::size_t i = 0; i < 256; ++i)
+                        values[i] = std::exp2(static_cast<double>(i) / -8.0);
+                }
+            } probabilities;
+
+            return probabilities.values;
+        }
+    } // namespace internal
+
+    inline void simd_scanner::select_anchors(const byte* bigram_frequencies)
+    {
+        const double* const probabilities = internal::bigram_probabilities();
+
+        // The probability of each byte, summed over every byte which could follow it
+        double marginals[256] {};
+
+        const auto get_marginal = [&](byte value) {
+            double& result = marginals[value];
+
+            if (result == 0.0)
+            {
+                for (std::size_t i = 0; i < 256; ++i)
+                    result += probabilities[bigram_frequencies[(static_cast<std::size_t>(value) << 8) | i]];
+            }
+
+            return result;
+        };
+
+        const std::size_t trimmed_size = pattern_->trimmed_size();
+
+        std::vector<std::size_t> literal_at(trimmed_size, SIZE_MAX);
+
+        for (std::size_t i = 0; i < num_literals_; ++i)
+            literal_at[bytes_[i].offset] = i;
+
+        std::size_t best_first = 0;
+        std::size_t best_second = 1;
+        double best_probability = 2.0;
+
+        const auto consider = [&](std::size_t first, std::size_t second, double probability) {
+            if (probability < best_probability)
+            {
+                best_first = first;
+                best_second = second;
+                best_probability = probability;
+            }
+        };
+
+        // Adjacent literals, which are rated as a pair
+        for (std::size_t i = 0; i < num_literals_; ++i)
+        {
+            const std::size_t offset = bytes_[i].offset;
+
+            if (offset + 1 >= trimmed_size || literal_at[offset + 1] == SIZE_MAX)
+                continue;
+
+            const std::size_t j = literal_at[offset + 1];
+            const std::size_t bigram = (static_cast<std::size_t>(bytes_[i].value) << 8) | bytes_[j].value;
+
+            consider(i, j, probabilities[bigram_frequencies[bigram]]);
+        }
+
+        // Otherwise, the rarest few bytes are assumed to be independent
+        std::size_t rarest[4];
+        const std::size_t num_rarest = (std::min)(num_literals_, std::size_t(4));
+
+        for (std::size_t i = 0; i < num_literals_; ++i)
+        {
+            std::size_t j = (std::min)(i, num_rarest - 1);
+
+            if (i >= num_rarest && get_marginal(bytes_[i].value) >= get_marginal(bytes_[rarest[j]].value))
+                continue;
+
+            for (; j > 0 && get_marginal(bytes_[i].value) < get_marginal(bytes_[rarest[j - 1]].value); --j)
+                rarest[j] = rarest[j - 1];
+
+            rarest[j] = i;
+        }
+
+        for (std::size_t i = 0; i < num_rarest; ++i)
+        {
+            for (std::size_t j = i + 1; j < num_rarest; ++j)
+            {
+                const scan_byte lhs = bytes_[rarest[i]];
+                const scan_byte rhs = bytes_[rarest[j]];
+
+                if (lhs.offset + 1 != rhs.offset && rhs.offset + 1 != lhs.offset)
+                    consider(rarest[i], rarest[j], get_marginal(lhs.value) * get_marginal(rhs.value));
+            }
+        }
+
+        if (get_marginal(bytes_[best_second].value) < get_marginal(bytes_[best_first].value))
+            std::swap(best_first, best_second);
+
+        // Move the anchors to the front, keeping the order of everything else
+        const scan_byte first = bytes_[best_first];
+        const scan_byte second = bytes_[best_second];
+
+        bytes_.erase(bytes_.begin() + static_cast<std::ptrdiff_t>((std::max)(best_first, best_second)));
+        bytes_.erase(bytes_.begin() + static_cast<std::ptrdiff_t>((std::min)(best_first, best_second)));
+        bytes_.insert(bytes_.begin(), {first, second});
+    }
+
+    template <bool Aligned>
+    MEM_NOINLINE inline const byte* simd_scanner::scan_literals(scan_state& state)
     {
+#if !defined(MEM_SIMD_SCANNER_USE_GENERIC)
+        // The rest of the candidates from the block of the last match have already been checked
+        if (state.pending)
+        {
+            const byte* const result = state.base + bsf(state.pending);
+            state.pending &= state.pending - 1;
+            return result;
+        }
+#endif
+
         const std::size_t num_literals = num_literals_;
+        const std::size_t step = Aligned ? alignment_ : 1;
+
+        const byte* ptr = state.ptr;
+        const byte* const end = state.end;
+
+        if (Aligned)
+            ptr = pointer(ptr).align_up(alignment_).as<const byte*>();
+
+        if (ptr >= end)
+        {
+            state.ptr = end;
+            return nullptr;
+        }
 
         if (num_literals == 0)
+        {
+            state.ptr = ptr + step;
             return ptr;
+        }
 
         scan_byte* const bytes = bytes_.data();
 
@@ -175,7 +369,9 @@ namespace mem
             {                                        \
                 mismatch;                            \
             }
-#        define l_SIMD_FIRST_MATCH(x) bsf(_mm256_movemask_epi8(x))
+#        define l_SIMD_BITS(x) static_cast<unsigned int>(_mm256_movemask_epi8(x))
+#        define l_SIMD_LOAD(x) _mm256_loadu_si256(reinterpret_cast<const __m256i*>(x))
+#        define l_SIMD_AND(x, y) _mm256_and_si256(x, y)
 #    elif defined(MEM_SIMD_SSE2)
 #        define l_SIMD_TYPE __m128i
 #        define l_SIMD_MASK unsigned int
@@ -194,13 +390,18 @@ namespace mem
             {                                                        \
                 mismatch;                                            \
             }
-#        define l_SIMD_FIRST_MATCH(x) bsf(x)
+#        define l_SIMD_BITS(x) (x)
+#        define l_SIMD_LOAD(x) _mm_loadu_si128(reinterpret_cast<const __m128i*>(x))
+#        define l_SIMD_AND(x, y) _mm_and_si128(x, y)
 #    else
 #        error Sorry, No Potatoes
 #    endif
 
 #    define l_SIMD_SIZEOF(N) (sizeof(l_SIMD_TYPE) * N)
 
+        // Clears the lanes of candidates which are not aligned
+#    define l_SIMD_ALIGN(x) (Aligned ? l_SIMD_AND(x, lane_mask) : x)
+
         if ((end - ptr) < static_cast<std::ptrdiff_t>(l_SIMD_SIZEOF(1)))
         {
             const scan_byte anchor = bytes[0];
@@ -209,23 +410,30 @@ namespace mem
             {
                 if (MEM_LIKELY(ptr[anchor.offset] != anchor.value))
                 {
-                    ++ptr;
+                    ptr += step;
                     continue;
                 }
 
+                MEM_SCAN_STATS_ADD(anchor_hits, 1);
+
                 for (std::size_t i = 1;; ++i)
                 {
                     if (i == num_literals)
+                    {
+                        state.ptr = ptr + step;
                         return ptr;
+                    }
 
                     if (ptr[bytes[i].offset] != bytes[i].value)
                     {
-                        ++ptr;
+                        MEM_SCAN_STATS_ADD(verify_failures, 1);
+                        ptr += step;
                         break;
                     }
                 }
             }
 
+            state.ptr = end;
             return nullptr;
         }
 
@@ -233,67 +441,92 @@ namespace mem
         scan_byte* const bytes_start = &bytes[(num_literals > 1) ? 2 : 1];
         scan_byte* const bytes_end = &bytes[num_literals];
         l_SIMD_MASK mask;
-        std::uint32_t rng = 1;
-        bool tailed = false;
 
         std::size_t anchor_offset0 = bytes[0].offset;
         std::size_t anchor_offset1 = bytes[(num_literals > 1) ? 1 : 0].offset;
         l_SIMD_TYPE anchor_value0 = l_SIMD_FILL32(bytes[0].value32);
         l_SIMD_TYPE anchor_value1 = l_SIMD_FILL32(bytes[(num_literals > 1) ? 1 : 0].value32);
 
+        // Every block starts at the same offset from an aligned address, so the lanes can be masked up front
+        byte lanes[l_SIMD_SIZEOF(1)] {};
+
+        if (Aligned)
+        {
+            for (std::size_t i = 0; i < l_SIMD_SIZEOF(1); ++i)
+                lanes[i] = pointer(ptr + i).align_down(alignment_) == pointer(ptr + i) ? 0xFF : 0x00;
+        }
+
+        l_SIMD_TYPE lane_mask = l_SIMD_LOAD(lanes);
+
     retry:
         while (MEM_LIKELY(ptr < simd_end)) [[MEM_ATTR_LIKELY]]
         {
-            const l_SIMD_TYPE value0 = l_SIMD_LOAD_EQ(ptr + anchor_offset0, anchor_value0);
+            const l_SIMD_TYPE value0 = l_SIMD_ALIGN(l_SIMD_LOAD_EQ(ptr + anchor_offset0, anchor_value0));
             const l_SIMD_TYPE value1 = l_SIMD_LOAD_EQ(ptr + anchor_offset1, anchor_value1);
             ptr += l_SIMD_SIZEOF(1);
             l_SIMD_TEST_HEAD(value0, value1, mask, goto match);
 
             if (ptr >= simd_end)
                 break;
-            const l_SIMD_TYPE value2 = l_SIMD_LOAD_EQ(ptr + anchor_offset0, anchor_value0);
+            const l_SIMD_TYPE value2 = l_SIMD_ALIGN(l_SIMD_LOAD_EQ(ptr + anchor_offset0, anchor_value0));
             const l_SIMD_TYPE value3 = l_SIMD_LOAD_EQ(ptr + anchor_offset1, anchor_value1);
             ptr += l_SIMD_SIZEOF(1);
             l_SIMD_TEST_HEAD(value2, value3, mask, goto match);
 
             if (ptr >= simd_end)
                 break;
-            const l_SIMD_TYPE value4 = l_SIMD_LOAD_EQ(ptr + anchor_offset0, anchor_value0);
+            const l_SIMD_TYPE value4 = l_SIMD_ALIGN(l_SIMD_LOAD_EQ(ptr + anchor_offset0, anchor_value0));
             const l_SIMD_TYPE value5 = l_SIMD_LOAD_EQ(ptr + anchor_offset1, anchor_value1);
             ptr += l_SIMD_SIZEOF(1);
             l_SIMD_TEST_HEAD(value4, value5, mask, goto match);
 
             if (ptr >= simd_end)
                 break;
-            const l_SIMD_TYPE value6 = l_SIMD_LOAD_EQ(ptr + anchor_offset0, anchor_value0);
+            const l_SIMD_TYPE value6 = l_SIMD_ALIGN(l_SIMD_LOAD_EQ(ptr + anchor_offset0, anchor_value0));
             const l_SIMD_TYPE value7 = l_SIMD_LOAD_EQ(ptr + anchor_offset1, anchor_value1);
             ptr += l_SIMD_SIZEOF(1);
             l_SIMD_TEST_HEAD(value6, value7, mask, goto match);
         }
 
-        if (MEM_LIKELY(!tailed)) [[MEM_ATTR_LIKELY]]
+        // The final block overlaps the previous one, but only lanes which did not match are checked again.
+        // A scan resumed past simd_end goes through the scalar loop instead.
+        if (MEM_LIKELY(ptr < end)) [[MEM_ATTR_LIKELY]]
         {
-            tailed = true;
             ptr = end;
-            const l_SIMD_TYPE value0 = l_SIMD_LOAD_EQ(simd_end + anchor_offset0, anchor_value0);
+
+            if (Aligned)
+            {
+                for (std::size_t i = 0; i < l_SIMD_SIZEOF(1); ++i)
+                    lanes[i] = pointer(simd_end + i).align_down(alignment_) == pointer(simd_end + i) ? 0xFF : 0x00;
+
+                lane_mask = l_SIMD_LOAD(lanes);
+            }
+
+            const l_SIMD_TYPE value0 = l_SIMD_ALIGN(l_SIMD_LOAD_EQ(simd_end + anchor_offset0, anchor_value0));
             const l_SIMD_TYPE value1 = l_SIMD_LOAD_EQ(simd_end + anchor_offset1, anchor_value1);
             l_SIMD_TEST_HEAD(value0, value1, mask, goto match);
         }
 
+        state.ptr = end;
         return nullptr;
 
     match:
+        MEM_SCAN_STATS_ADD(anchor_hits, 1);
+
         scan_byte* needle = bytes_start;
 
 #    if defined l_SIMD_TEST_ONE
         if (l_SIMD_TEST_ONE(mask))
         {
-            const byte* here = ptr + l_SIMD_FIRST_MATCH(mask) - l_SIMD_SIZEOF(1);
+            const byte* here = ptr + bsf(mask) - l_SIMD_SIZEOF(1);
 
             while (true)
             {
                 if (MEM_UNLIKELY(needle >= bytes_end)) [[MEM_ATTR_UNLIKELY]]
+                {
+                    state.ptr = ptr;
                     return here;
+                }
                 ++needle;
                 if (here[needle[-1].offset] != needle[-1].value)
                     break;
@@ -305,7 +538,16 @@ namespace mem
             while (true)
             {
                 if (MEM_UNLIKELY(needle >= bytes_end)) [[MEM_ATTR_UNLIKELY]]
-                    return ptr + l_SIMD_FIRST_MATCH(mask) - l_SIMD_SIZEOF(1);
+                {
+                    // Every remaining lane matched all of the literals, so keep them for the next call
+                    const unsigned int bits = l_SIMD_BITS(mask);
+
+                    state.ptr = ptr;
+                    state.base = ptr - l_SIMD_SIZEOF(1);
+                    state.pending = bits & (bits - 1);
+
+                    return state.base + bsf(bits);
+                }
                 const l_SIMD_TYPE value =
                     l_SIMD_LOAD_EQ(ptr + needle->offset - l_SIMD_SIZEOF(1), l_SIMD_FILL32(needle->value32));
                 ++needle;
@@ -313,11 +555,15 @@ namespace mem
             }
         }
 
-        std::uint32_t x = rng;
-        rng = (x * 1664525) + 1013904223;
+        MEM_SCAN_STATS_ADD(verify_failures, 1);
+
+        std::uint32_t x = rng_;
+        rng_ = (x * 1664525) + 1013904223;
 
         if (x & 0x80000000)
         {
+            MEM_SCAN_STATS_ADD(reorders, 1);
+
             needle -= 2;
             scan_byte y = needle[1];
 
@@ -340,13 +586,17 @@ namespace mem
         goto retry;
 
 #    undef l_SIMD_TYPE
+#    undef l_SIMD_MASK
 #    undef l_SIMD_FILL32
+#    undef l_SIMD_LOAD_EQ
+#    undef l_SIMD_TEST_HEAD
+#    undef l_SIMD_TEST_ONE
+#    undef l_SIMD_TEST_TAIL
+#    undef l_SIMD_BITS
 #    undef l_SIMD_LOAD
-#    undef l_SIMD_CMPEQ
-#    undef l_SIMD_MOVEMASK
+#    undef l_SIMD_AND
+#    undef l_SIMD_ALIGN
 #    undef l_SIMD_SIZEOF
-#    undef l_SIMD_LOAD_EQ
-#    undef l_SIMD_TEST
 #else
         while (ptr < end)
         {
@@ -355,71 +605,171 @@ namespace mem
             if (ptr == end)
                 break;
 
+            if (Aligned && pointer(ptr).align_down(alignment_) != pointer(ptr))
+            {
+                ptr = pointer(ptr).align_up(alignment_).as<const byte*>();
+                continue;
+            }
+
+            MEM_SCAN_STATS_ADD(anchor_hits, 1);
+
             std::size_t i = 1;
 
             for (;; ++i)
             {
                 if (i == num_literals)
+                {
+                    state.ptr = ptr + step;
                     return ptr;
+                }
 
                 needle = bytes[i];
                 if (ptr[needle.offset] != needle.value)
                     break;
             }
 
+            MEM_SCAN_STATS_ADD(verify_failures, 1);
+            MEM_SCAN_STATS_ADD(reorders, 1);
+
             bytes[i] = bytes[i - 1];
             bytes[i - 1] = needle;
-            ++ptr;
+            ptr += step;
         }
 
+        state.ptr = end;
         return nullptr;
 #endif
     }
 
-    MEM_NOINLINE inline pointer simd_scanner::scan(region range)
+    MEM_STRONG_INLINE std::size_t simd_scanner::pattern_size() const noexcept
+    {
+        return pattern_->size();
+    }
+
+    MEM_NOINLINE inline std::size_t simd_scanner::count_literals(const byte* ptr, const byte* end) const
+    {
+        const scan_byte anchor0 = bytes_[0];
+        const scan_byte anchor1 = bytes_[(num_literals_ > 1) ? 1 : 0];
+
+        std::size_t result = 0;
+
+#if !defined(MEM_SIMD_SCANNER_USE_GENERIC)
+#    if defined(MEM_SIMD_AVX2)
+#        define l_SIMD_TYPE __m256i
+#        define l_SIMD_FILL32(x) _mm256_set1_epi32(static_cast<int>(x))
+#        define l_SIMD_LOAD_EQ(x, y) _mm256_cmpeq_epi8(_mm256_loadu_si256(reinterpret_cast<const __m256i*>(x)), y)
+#        define l_SIMD_COUNT(x, y) popcount(static_cast<unsigned int>(_mm256_movemask_epi8(_mm256_and_si256(x, y))))
+#    elif defined(MEM_SIMD_SSE2)
+#        define l_SIMD_TYPE __m128i
+#        define l_SIMD_FILL32(x) _mm_set1_epi32(static_cast<int>(x))
+#        define l_SIMD_LOAD_EQ(x, y) _mm_cmpeq_epi8(_mm_loadu_si128(reinterpret_cast<const __m128i*>(x)), y)
+#        define l_SIMD_COUNT(x, y) popcount(static_cast<unsigned int>(_mm_movemask_epi8(_mm_and_si128(x, y))))
+#    else
+#        error Sorry, No Potatoes
+#    endif
+
+        const l_SIMD_TYPE value0 = l_SIMD_FILL32(anchor0.value32);
+        const l_SIMD_TYPE value1 = l_SIMD_FILL32(anchor1.value32);
+
+        for (; static_cast<std::size_t>(end - ptr) >= sizeof(l_SIMD_TYPE); ptr += sizeof(l_SIMD_TYPE))
+        {
+            result += l_SIMD_COUNT(
+                l_SIMD_LOAD_EQ(ptr + anchor0.offset, value0), l_SIMD_LOAD_EQ(ptr + anchor1.offset, value1));
+        }
+
+#    undef l_SIMD_TYPE
+#    undef l_SIMD_FILL32
+#    undef l_SIMD_LOAD_EQ
+#    undef l_SIMD_COUNT
+#endif
+
+        for (; ptr < end; ++ptr)
+        {
+            if (ptr[anchor0.offset] == anchor0.value && ptr[anchor1.offset] == anchor1.value)
+                ++result;
+        }
+
+        return result;
+    }
+
+    inline std::size_t simd_scanner::count(region range, std::size_t limit)
     {
         const std::size_t trimmed_size = pattern_->trimmed_size();
 
-        if (!trimmed_size)
-            return nullptr;
+        // A literal byte or pair can be counted directly from the anchor compare masks
+        if (limit == SIZE_MAX && alignment_ == 1 && trimmed_size != 0 && num_literals_ == trimmed_size &&
+            num_literals_ <= 2)
+        {
+            const std::size_t original_size = pattern_->size();
+
+            if (original_size > range.size)
+                return 0;
+
+            const byte* const region_base = range.start.as<const byte*>();
+
+            return count_literals(region_base, region_base + (range.size - original_size + 1));
+        }
+
+        return scanner_base::count(range, limit);
+    }
+
+    MEM_STRONG_INLINE pointer simd_scanner::scan(region range)
+    {
+        scan_state state = start_scan(range);
+
+        return scan_next(state);
+    }
+
+    inline simd_scanner::scan_state simd_scanner::start_scan(region range) const noexcept
+    {
+        scan_state state;
 
         const std::size_t original_size = pattern_->size();
-        const std::size_t region_size = range.size;
 
-        if (original_size > region_size)
-            return nullptr;
+        if (pattern_->trimmed_size() && original_size <= range.size)
+        {
+            state.ptr = range.start.as<const byte*>();
+            state.end = state.ptr + (range.size - original_size + 1);
+            state.next = state.ptr;
+        }
 
-        const byte* const region_base = range.start.as<const byte*>();
-        const byte* const region_end = region_base + region_size;
+        return state;
+    }
 
-        const byte* ptr = region_base;
-        const byte* end = region_end - original_size + 1;
+    MEM_NOINLINE inline pointer simd_scanner::scan_next(scan_state& state)
+    {
+        MEM_SCAN_STATS_SCOPE("simd_scanner", *pattern_,
+            (state.next < state.end)
+                ? region(state.next, static_cast<std::size_t>(state.end - state.next) + pattern_->size() - 1)
+                : region());
 
         const byte* const masks = pattern_->masks();
 
-        while (ptr < end)
+        while (const byte* ptr = (alignment_ != 1) ? scan_literals<true>(state) : scan_literals<false>(state))
         {
-            ptr = scan_literals(ptr, end);
-
-            if (ptr == nullptr)
-                return nullptr;
+            // Alignments larger than a vector are only partially masked by scan_literals
+            if (alignment_ != 1 && pointer(ptr).align_down(alignment_) != pointer(ptr))
+                continue;
 
             for (std::size_t i = num_literals_;; ++i)
             {
                 if (i == bytes_.size())
-                    return ptr;
+                {
+                    state.next = ptr + 1;
+                    return MEM_SCAN_STATS_RESULT(ptr);
+                }
 
                 const std::size_t offset = bytes_[i].offset;
 
                 if ((ptr[offset] & masks[offset]) != bytes_[i].value)
                 {
-                    ++ptr;
+                    MEM_SCAN_STATS_ADD(verify_failures, 1);
                     break;
                 }
             }
         }
 
-        return nullptr;
+        return MEM_SCAN_STATS_RESULT(nullptr);
     }
 } // namespace mem
 
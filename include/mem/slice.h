@@ -89,7 +89,7 @@ namespace mem
     template <typename T>
     MEM_STRONG_INLINE constexpr slice<T>::slice(T* begin, T* end) noexcept
         : start_(begin)
-        , size_(end - begin)
+        , size_(static_cast<std::size_t>(end - begin))
     {}
 
     template <typename T>
@@ -0,0 +1,187 @@
+/*
+    Copyright 2018 Brick
+
+    Permission is hereby granted, free of charge, to any person obtaining a copy of this software
+    and associated documentation files (the "Software"), to deal in the Software without restriction,
+    including without limitation the rights to use, copy, modify, merge, publish, distribute,
+    sublicense, and/or sell copies of the Software, and to permit persons to whom the Software is
+    furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included in all copies or
+    substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING
+    BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+    NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM,
+    DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+    OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+*/
+
+#ifndef MEM_STRING_REFERENCES_BRICK_H
+#define MEM_STRING_REFERENCES_BRICK_H
+
+#include "function_index.h"
+#include "module.h"
+#include "pattern_set.h"
+#include "xref_index.h"
+
+#include <algorithm>
+#include <cstring>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace mem
+{
+    struct string_reference
+    {
+        std::size_t index;
+        pointer string;
+        pointer source;
+        xref_kind kind;
+
+        // The function containing the source, or an empty region if it is unknown
+        region function;
+    };
+
+    // Resolves many null-terminated strings to the code which references them.
+    // All of the strings are found with a single pass over each data segment, and then all of their references are
+    // found with a single pass over each code segment.
+    class string_reference_resolver
+    {
+    private:
+        std::vector<pattern> patterns_ {};
+        pattern_set set_ {};
+
+    public:
+        explicit string_reference_resolver(const std::vector<std::string>& strings);
+
+        string_reference_resolver(const string_reference_resolver&) = delete;
+        string_reference_resolver(string_reference_resolver&&) = default;
+
+        // Returns all (address, index) pairs of strings inside the range, sorted by address
+        std::vector<std::pair<pointer, std::size_t>> find_strings(region range) const;
+
+        // Returns all strings inside the readable, non-executable segments of the module
+        std::vector<std::pair<pointer, std::size_t>> find_strings(module image) const;
+
+        // Returns all references from the code to the strings, sorted by index and then source.
+        // If functions is not null, it is used to find the function containing each reference.
+        std::vector<string_reference> find_references(region code,
+            const std::vector<std::pair<pointer, std::size_t>>& strings,
+            const function_index* functions = nullptr) const;
+
+        // Returns all references from the executable segments of the module to its strings
+        std::vector<string_reference> find_references(module image, const function_index* functions = nullptr) const;
+
+        std::size_t size() const noexcept;
+    };
+
+    inline string_reference_resolver::string_reference_resolver(const std::vector<std::string>& strings)
+    {
+        patterns_.reserve(strings.size());
+
+        for (const std::string& string : strings)
+            patterns_.emplace_back(string.c_str(), nullptr, string.size() + 1);
+
+        std::vector<const pattern*> patterns;
+        patterns.reserve(patterns_.size());
+
+        for (const pattern& pat : patterns_)
+            patterns.push_back(&pat);
+
+        set_ = pattern_set(patterns);
+    }
+
+    inline std::vector<std::pair<pointer, std::size_t>> string_reference_resolver::find_strings(region range) const
+    {
+        return set_.scan_all(range);
+    }
+
+    inline std::vector<std::pair<pointer, std::size_t>> string_reference_resolver::find_strings(module image) const
+    {
+        std::vector<std::pair<pointer, std::size_t>> results;
+
+        image.enum_segments([&](region range, prot_flags prot) {
+            if ((prot & prot_flags::R) && !(prot & prot_flags::X))
+            {
+                set_.scan(range, [&results](pointer address, std::size_t index) {
+                    results.emplace_back(address, index);
+
+                    return false;
+                });
+            }
+
+            return false;
+        });
+
+        std::sort(results.begin(), results.end());
+
+        return results;
+    }
+
+    inline std::vector<string_reference> string_reference_resolver::find_references(region code,
+        const std::vector<std::pair<pointer, std::size_t>>& strings, const function_index* functions) const
+    {
+        std::vector<string_reference> results;
+
+        if (strings.empty())
+            return results;
+
+        const auto bounds = std::minmax_element(strings.begin(), strings.end());
+        const region targets(bounds.first->first, static_cast<std::size_t>(bounds.second->first - bounds.first->first) + 1);
+
+        const xref_index index(code, targets);
+
+        for (const auto& string : strings)
+        {
+            for (const xref& ref : index.find(string.first))
+            {
+                const region function = functions ? functions->function_containing(ref.source) : region();
+
+                results.push_back({string.second, string.first, ref.source, ref.kind, function});
+            }
+        }
+
+        std::sort(results.begin(), results.end(), [](const string_reference& lhs, const string_reference& rhs) {
+            return (lhs.index != rhs.index) ? (lhs.index < rhs.index) : (lhs.source < rhs.source);
+        });
+
+        return results;
+    }
+
+    inline std::vector<string_reference> string_reference_resolver::find_references(
+        module image, const function_index* functions) const
+    {
+        const std::vector<std::pair<pointer, std::size_t>> strings = find_strings(image);
+
+        std::vector<string_reference> results;
+
+        if (strings.empty())
+            return results;
+
+        image.enum_segments([&](region range, prot_flags prot) {
+            if (prot & prot_flags::X)
+            {
+                std::vector<string_reference> refs = find_references(range, strings, functions);
+
+                results.insert(results.end(), refs.begin(), refs.end());
+            }
+
+            return false;
+        });
+
+        std::sort(results.begin(), results.end(), [](const string_reference& lhs, const string_reference& rhs) {
+            return (lhs.index != rhs.index) ? (lhs.index < rhs.index) : (lhs.source < rhs.source);
+        });
+
+        return results;
+    }
+
+    MEM_STRONG_INLINE std::size_t string_reference_resolver::size() const noexcept
+    {
+        return patterns_.size();
+    }
+} // namespace mem
+
+#endif // MEM_STRING_REFERENCES_BRICK_H
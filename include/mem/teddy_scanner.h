@@ -0,0 +1,357 @@
+/*
+    Copyright 2018 Brick
+
+    Permission is hereby granted, free of charge, to any person obtaining a copy of this software
+    and associated documentation files (the "Software"), to deal in the Software without restriction,
+    including without limitation the rights to use, copy, modify, merge, publish, distribute,
+    sublicense, and/or sell copies of the Software, and to permit persons to whom the Software is
+    furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included in all copies or
+    substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING
+    BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+    NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM,
+    DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+    OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+*/
+
+#ifndef MEM_TEDDY_SCANNER_BRICK_H
+#define MEM_TEDDY_SCANNER_BRICK_H
+
+#include "pattern.h"
+
+#if !defined(MEM_TEDDY_SCANNER_USE_GENERIC)
+#    if defined(MEM_SIMD_AVX2)
+#        include <immintrin.h>
+#    elif defined(MEM_SIMD_SSSE3)
+#        include <tmmintrin.h>
+#    else
+#        define MEM_TEDDY_SCANNER_USE_GENERIC
+#    endif
+#endif
+
+#if !defined(MEM_TEDDY_SCANNER_USE_GENERIC)
+#    include "arch.h"
+#endif
+
+#include <algorithm>
+#include <utility>
+#include <vector>
+
+namespace mem
+{
+    // Searches for a small set of patterns at once.
+    // Candidate positions are found by looking up the low and high nibbles of a short fingerprint of each pattern
+    // (the "Teddy" algorithm), and are then verified with pattern::match.
+    class teddy_scanner
+    {
+    private:
+        static constexpr const std::size_t max_buckets {8};
+        static constexpr const std::size_t max_window {3};
+
+        struct entry
+        {
+            const pattern* pat;
+            std::size_t index;
+            std::size_t offset;
+        };
+
+        std::vector<entry> entries_ {};
+        std::size_t bucket_starts_[max_buckets + 1] {};
+
+        std::size_t window_ {0};
+
+        byte lo_[max_window][16] {};
+        byte hi_[max_window][16] {};
+
+        unsigned int candidates(const byte* ptr) const noexcept;
+
+        template <typename Func>
+        const byte* verify(const byte* start, const byte* end, const byte* here, unsigned int buckets, Func& func) const;
+
+    public:
+        teddy_scanner() = default;
+
+        teddy_scanner(const std::vector<const pattern*>& patterns);
+
+        // Calls func(address, index) for each match, where index is the position of the pattern in the original list.
+        // Matches are reported in order of their fingerprint, so patterns with different fingerprint offsets may not
+        // be reported in address order.
+        template <typename Func>
+        pointer scan(region range, Func func) const;
+
+        // Returns all matches, sorted by address
+        std::vector<std::pair<pointer, std::size_t>> scan_all(region range) const;
+    };
+
+    inline teddy_scanner::teddy_scanner(const std::vector<const pattern*>& patterns)
+    {
+        window_ = max_window;
+
+        for (std::size_t i = 0; i < patterns.size(); ++i)
+        {
+            const pattern* pat = patterns[i];
+
+            if (pat == nullptr || pat->trimmed_size() == 0)
+                continue;
+
+            entries_.push_back({pat, i, 0});
+            window_ = (std::min)(window_, pat->trimmed_size());
+        }
+
+        if (entries_.empty())
+        {
+            window_ = 0;
+
+            return;
+        }
+
+        const auto count_bits = [](byte value) {
+            std::size_t count = 0;
+
+            for (; value; value &= value - 1)
+                ++count;
+
+            return count;
+        };
+
+        // Use the most specific window of each pattern as its fingerprint
+        for (entry& e : entries_)
+        {
+            const byte* const masks = e.pat->masks();
+            std::size_t best_bits = 0;
+
+            for (std::size_t offset = 0; offset + window_ <= e.pat->trimmed_size(); ++offset)
+            {
+                std::size_t bits = 0;
+
+                for (std::size_t j = 0; j < window_; ++j)
+                    bits += count_bits(masks[offset + j]);
+
+                if (bits > best_bits)
+                {
+                    best_bits = bits;
+                    e.offset = offset;
+                }
+            }
+        }
+
+        // Group patterns with similar fingerprints into the same bucket, to reduce false positives
+        std::sort(entries_.begin(), entries_.end(), [this](const entry& lhs, const entry& rhs) {
+            for (std::size_t j = 0; j < window_; ++j)
+            {
+                const byte lhs_value = lhs.pat->bytes()[lhs.offset + j];
+                const byte rhs_value = rhs.pat->bytes()[rhs.offset + j];
+
+                if (lhs_value != rhs_value)
+                    return lhs_value < rhs_value;
+            }
+
+            return lhs.index < rhs.index;
+        });
+
+        const std::size_t num_entries = entries_.size();
+        const std::size_t num_buckets = (num_entries < max_buckets) ? num_entries : max_buckets;
+
+        for (std::size_t bucket = 0; bucket <= max_buckets; ++bucket)
+            bucket_starts_[bucket] = (std::min)(bucket, num_buckets) * num_entries / num_buckets;
+
+        for (std::size_t bucket = 0; bucket < num_buckets; ++bucket)
+        {
+            const byte bit = static_cast<byte>(1u << bucket);
+
+            for (std::size_t i = bucket_starts_[bucket]; i < bucket_starts_[bucket + 1]; ++i)
+            {
+                const entry& e = entries_[i];
+
+                for (std::size_t j = 0; j < window_; ++j)
+                {
+                    const unsigned int value = e.pat->bytes()[e.offset + j];
+                    const unsigned int mask = e.pat->masks()[e.offset + j];
+
+                    for (unsigned int nibble = 0; nibble < 16; ++nibble)
+                    {
+                        if (((nibble ^ value) & mask & 0xF) == 0)
+                            lo_[j][nibble] |= bit;
+
+                        if (((nibble ^ (value >> 4)) & (mask >> 4)) == 0)
+                            hi_[j][nibble] |= bit;
+                    }
+                }
+            }
+        }
+    }
+
+    MEM_STRONG_INLINE unsigned int teddy_scanner::candidates(const byte* ptr) const noexcept
+    {
+        unsigned int result = 0xFF;
+
+        for (std::size_t j = 0; j < window_; ++j)
+            result &= lo_[j][ptr[j] & 0xF] & hi_[j][ptr[j] >> 4];
+
+        return result;
+    }
+
+    template <typename Func>
+    inline const byte* teddy_scanner::verify(
+        const byte* start, const byte* end, const byte* here, unsigned int buckets, Func& func) const
+    {
+        for (std::size_t bucket = 0; buckets; ++bucket, buckets >>= 1)
+        {
+            if (!(buckets & 1))
+                continue;
+
+            for (std::size_t i = bucket_starts_[bucket]; i < bucket_starts_[bucket + 1]; ++i)
+            {
+                const entry& e = entries_[i];
+
+                if (static_cast<std::size_t>(here - start) < e.offset)
+                    continue;
+
+                const byte* const candidate = here - e.offset;
+
+                if (e.pat->size() > static_cast<std::size_t>(end - candidate))
+                    continue;
+
+                if (e.pat->match(candidate) && func(pointer(candidate), e.index))
+                    return candidate;
+            }
+        }
+
+        return nullptr;
+    }
+
+    template <typename Func>
+    inline pointer teddy_scanner::scan(region range, Func func) const
+    {
+        if (window_ == 0 || range.size < window_)
+            return nullptr;
+
+        const byte* const region_base = range.start.as<const byte*>();
+        const byte* const region_end = region_base + range.size;
+
+        const byte* ptr = region_base;
+        const byte* const end = region_end - window_ + 1;
+
+#if !defined(MEM_TEDDY_SCANNER_USE_GENERIC)
+#    if defined(MEM_SIMD_AVX2)
+#        define l_SIMD_TYPE __m256i
+#        define l_SIMD_TABLE(x) _mm256_broadcastsi128_si256(_mm_loadu_si128(reinterpret_cast<const __m128i*>(x)))
+#        define l_SIMD_FILL8(x) _mm256_set1_epi8(static_cast<char>(x))
+#        define l_SIMD_LOAD(x) _mm256_loadu_si256(reinterpret_cast<const __m256i*>(x))
+#        define l_SIMD_STORE(x, y) _mm256_storeu_si256(reinterpret_cast<__m256i*>(x), y)
+#        define l_SIMD_AND(x, y) _mm256_and_si256(x, y)
+#        define l_SIMD_SHUFFLE(x, y) _mm256_shuffle_epi8(x, y)
+#        define l_SIMD_HIGH_NIBBLES(x) _mm256_srli_epi16(x, 4)
+#        define l_SIMD_NONZERO(x) \
+            (~static_cast<unsigned int>(_mm256_movemask_epi8(_mm256_cmpeq_epi8(x, _mm256_setzero_si256()))))
+#    elif defined(MEM_SIMD_SSSE3)
+#        define l_SIMD_TYPE __m128i
+#        define l_SIMD_TABLE(x) _mm_loadu_si128(reinterpret_cast<const __m128i*>(x))
+#        define l_SIMD_FILL8(x) _mm_set1_epi8(static_cast<char>(x))
+#        define l_SIMD_LOAD(x) _mm_loadu_si128(reinterpret_cast<const __m128i*>(x))
+#        define l_SIMD_STORE(x, y) _mm_storeu_si128(reinterpret_cast<__m128i*>(x), y)
+#        define l_SIMD_AND(x, y) _mm_and_si128(x, y)
+#        define l_SIMD_SHUFFLE(x, y) _mm_shuffle_epi8(x, y)
+#        define l_SIMD_HIGH_NIBBLES(x) _mm_srli_epi16(x, 4)
+#        define l_SIMD_NONZERO(x) \
+            (~static_cast<unsigned int>(_mm_movemask_epi8(_mm_cmpeq_epi8(x, _mm_setzero_si128()))) & 0xFFFF)
+#    else
+#        error Sorry, No Potatoes
+#    endif
+
+        if (static_cast<std::size_t>(end - ptr) >= sizeof(l_SIMD_TYPE))
+        {
+            const byte* const simd_end = end - sizeof(l_SIMD_TYPE);
+            const l_SIMD_TYPE nibble_mask = l_SIMD_FILL8(0x0F);
+
+            l_SIMD_TYPE lo_tables[max_window];
+            l_SIMD_TYPE hi_tables[max_window];
+
+            for (std::size_t j = 0; j < window_; ++j)
+            {
+                lo_tables[j] = l_SIMD_TABLE(lo_[j]);
+                hi_tables[j] = l_SIMD_TABLE(hi_[j]);
+            }
+
+            byte lanes[sizeof(l_SIMD_TYPE)];
+
+            while (ptr <= simd_end)
+            {
+                l_SIMD_TYPE result = l_SIMD_FILL8(0xFF);
+
+                for (std::size_t j = 0; j < window_; ++j)
+                {
+                    const l_SIMD_TYPE value = l_SIMD_LOAD(ptr + j);
+                    const l_SIMD_TYPE lo = l_SIMD_SHUFFLE(lo_tables[j], l_SIMD_AND(value, nibble_mask));
+                    const l_SIMD_TYPE hi =
+                        l_SIMD_SHUFFLE(hi_tables[j], l_SIMD_AND(l_SIMD_HIGH_NIBBLES(value), nibble_mask));
+
+                    result = l_SIMD_AND(result, l_SIMD_AND(lo, hi));
+                }
+
+                unsigned int mask = l_SIMD_NONZERO(result);
+
+                if (MEM_UNLIKELY(mask != 0)) [[MEM_ATTR_UNLIKELY]]
+                {
+                    l_SIMD_STORE(lanes, result);
+
+                    do
+                    {
+                        const unsigned int lane = bsf(mask);
+
+                        if (const byte* match = verify(region_base, region_end, ptr + lane, lanes[lane], func))
+                            return match;
+
+                        mask &= mask - 1;
+                    } while (mask != 0);
+                }
+
+                ptr += sizeof(l_SIMD_TYPE);
+            }
+        }
+
+#    undef l_SIMD_TYPE
+#    undef l_SIMD_TABLE
+#    undef l_SIMD_FILL8
+#    undef l_SIMD_LOAD
+#    undef l_SIMD_STORE
+#    undef l_SIMD_AND
+#    undef l_SIMD_SHUFFLE
+#    undef l_SIMD_HIGH_NIBBLES
+#    undef l_SIMD_NONZERO
+#endif
+
+        for (; ptr < end; ++ptr)
+        {
+            const unsigned int buckets = candidates(ptr);
+
+            if (MEM_UNLIKELY(buckets != 0)) [[MEM_ATTR_UNLIKELY]]
+            {
+                if (const byte* match = verify(region_base, region_end, ptr, buckets, func))
+                    return match;
+            }
+        }
+
+        return nullptr;
+    }
+
+    inline std::vector<std::pair<pointer, std::size_t>> teddy_scanner::scan_all(region range) const
+    {
+        std::vector<std::pair<pointer, std::size_t>> results;
+
+        scan(range, [&results](pointer address, std::size_t index) {
+            results.emplace_back(address, index);
+
+            return false;
+        });
+
+        std::sort(results.begin(), results.end());
+
+        return results;
+    }
+} // namespace mem
+
+#endif // MEM_TEDDY_SCANNER_BRICK_H
@@ -0,0 +1,613 @@
+/*
+    Copyright 2018 Brick
+
+    Permission is hereby granted, free of charge, to any person obtaining a copy of this software
+    and associated documentation files (the "Software"), to deal in the Software without restriction,
+    including without limitation the rights to use, copy, modify, merge, publish, distribute,
+    sublicense, and/or sell copies of the Software, and to permit persons to whom the Software is
+    furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included in all copies or
+    substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING
+    BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+    NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM,
+    DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+    OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+*/
+
+#ifndef MEM_VALUE_SCANNER_BRICK_H
+#define MEM_VALUE_SCANNER_BRICK_H
+
+#include "mem.h"
+#include "protect.h"
+
+#if !defined(MEM_VALUE_SCANNER_USE_GENERIC)
+#    if defined(MEM_SIMD_AVX2)
+#        include <immintrin.h>
+#    elif defined(MEM_SIMD_SSE2)
+#        include <emmintrin.h>
+#    else
+#        define MEM_VALUE_SCANNER_USE_GENERIC
+#    endif
+#endif
+
+#include "arch.h"
+
+#include <algorithm>
+#include <cstring>
+#include <type_traits>
+#include <vector>
+
+namespace mem
+{
+    enum class scan_op : std::uint8_t
+    {
+        equal,     // value == a
+        not_equal, // value != a
+        less,      // value < a
+        greater,   // value > a
+        between,   // a <= value <= b
+
+        // Compared against the value from the previous scan, so only valid for next_scan
+        changed,
+        unchanged,
+        increased,
+        decreased,
+    };
+
+    // Searches memory for a typed value, then narrows the results with repeated scans as the value changes.
+    // Candidates are stored per 64 KiB block, either as a bitmap or as a list of offsets (whichever is smaller),
+    // along with their last value unless they are all known to be equal.
+    // The memory is read directly, so it should not be unmapped while a scan is running.
+    template <typename T>
+    class value_scanner
+    {
+        static_assert(std::is_arithmetic<T>::value, "Invalid Value Type");
+
+    private:
+        static constexpr const std::size_t max_block_size {0x10000};
+
+        struct block
+        {
+            pointer start;
+            std::size_t slots;
+            std::size_t count;
+
+            std::vector<std::uint64_t> bitmap; // One bit per slot, when the candidates are dense
+            std::vector<std::uint16_t> offsets; // The slot of each candidate, when they are sparse
+            std::vector<T> values;              // The value of each candidate, unless they are all equal to value
+            T value;
+        };
+
+        std::size_t stride_ {sizeof(T)};
+        std::size_t count_ {0};
+        std::vector<block> blocks_ {};
+        std::vector<std::uint16_t> scratch_ {};
+
+        T load(const block& b, std::size_t slot) const noexcept;
+
+        void store(block& b, const std::vector<std::uint16_t>& slots);
+
+        template <typename Func>
+        static void enum_candidates(const block& b, Func func);
+
+        template <scan_op Op>
+        std::size_t first_scan_op(const std::vector<region>& ranges, T a, T b);
+
+        template <scan_op Op>
+        std::size_t next_scan_op(T a, T b);
+
+    public:
+        explicit value_scanner(std::size_t stride = sizeof(T));
+
+        // Scans each slot of the ranges, every stride bytes, for values matching op.
+        // Returns the number of candidates.
+        std::size_t first_scan(const std::vector<region>& ranges, scan_op op, T a = T(), T b = T());
+
+        // Same as above, but scans all readable memory
+        std::size_t first_scan(scan_op op, T a = T(), T b = T());
+
+        // Rescans the remaining candidates, keeping those which match op.
+        // Candidates which are no longer readable are dropped.
+        std::size_t next_scan(scan_op op, T a = T(), T b = T());
+
+        // Calls func(address, value) for each candidate, where value is its value during the last scan
+        template <typename Func>
+        void enum_results(Func func) const;
+
+        std::vector<pointer> results(std::size_t max = SIZE_MAX) const;
+
+        std::size_t size() const noexcept;
+
+        // The approximate number of bytes used to store the candidates
+        std::size_t memory_usage() const noexcept;
+
+        void reset();
+    };
+
+    namespace internal
+    {
+        // Op is a template parameter so that the switch is resolved outside of the scan loops
+        template <scan_op Op, typename T>
+        MEM_STRONG_INLINE bool test_value(T value, T previous, T a, T b) noexcept
+        {
+            switch (Op)
+            {
+                case scan_op::equal: return value == a;
+                case scan_op::not_equal: return value != a;
+                case scan_op::less: return value < a;
+                case scan_op::greater: return value > a;
+                case scan_op::between: return (value >= a) & (value <= b); // Not &&, so it has no branch
+                case scan_op::changed: return value != previous;
+                case scan_op::unchanged: return value == previous;
+                case scan_op::increased: return value > previous;
+                case scan_op::decreased: return value < previous;
+            }
+
+            return false;
+        }
+
+        // Sets the bit of each slot in data which is bitwise equal to value, where size is 1, 2, 4 or 8
+        inline void find_equal_slots(
+            const byte* data, std::size_t slots, const byte* value, std::size_t size, std::uint64_t* bitmap) noexcept
+        {
+            std::size_t slot = 0;
+
+#if !defined(MEM_VALUE_SCANNER_USE_GENERIC)
+#    if defined(MEM_SIMD_AVX2)
+#        define l_SIMD_TYPE __m256i
+#        define l_SIMD_LOAD(x) _mm256_loadu_si256(reinterpret_cast<const __m256i*>(x))
+#        define l_SIMD_CMPEQ_MASK(x, y) static_cast<std::uint32_t>(_mm256_movemask_epi8(_mm256_cmpeq_epi8(x, y)))
+#    elif defined(MEM_SIMD_SSE2)
+#        define l_SIMD_TYPE __m128i
+#        define l_SIMD_LOAD(x) _mm_loadu_si128(reinterpret_cast<const __m128i*>(x))
+#        define l_SIMD_CMPEQ_MASK(x, y) static_cast<std::uint32_t>(_mm_movemask_epi8(_mm_cmpeq_epi8(x, y)))
+#    else
+#        error Sorry, No Potatoes
+#    endif
+
+            byte fill[sizeof(l_SIMD_TYPE)];
+
+            for (std::size_t i = 0; i < sizeof(l_SIMD_TYPE); ++i)
+                fill[i] = value[i % size];
+
+            const l_SIMD_TYPE needle = l_SIMD_LOAD(fill);
+            const std::size_t lanes = sizeof(l_SIMD_TYPE) / size;
+
+            // The first bit of each slot
+            std::uint32_t starts = 0;
+
+            for (std::size_t i = 0; i < 32; i += size)
+                starts |= std::uint32_t(1) << i;
+
+            for (; (slots - slot) >= lanes; slot += lanes, data += sizeof(l_SIMD_TYPE))
+            {
+                std::uint32_t mask = l_SIMD_CMPEQ_MASK(l_SIMD_LOAD(data), needle);
+
+                // A slot only matches if all of its bytes do
+                if (size >= 2)
+                    mask &= mask >> 1;
+
+                if (size >= 4)
+                    mask &= mask >> 2;
+
+                if (size >= 8)
+                    mask &= mask >> 4;
+
+                mask &= starts;
+
+                while (mask)
+                {
+                    const std::size_t index = slot + (bsf(mask) / size);
+
+                    bitmap[index / 64] |= std::uint64_t(1) << (index % 64);
+
+                    mask &= mask - 1;
+                }
+            }
+
+#    undef l_SIMD_TYPE
+#    undef l_SIMD_LOAD
+#    undef l_SIMD_CMPEQ_MASK
+#endif
+
+            for (; slot < slots; ++slot, data += size)
+            {
+                if (!std::memcmp(data, value, size))
+                    bitmap[slot / 64] |= std::uint64_t(1) << (slot % 64);
+            }
+        }
+
+        // Packs 64 bytes of 0 or 1 into a bitmask
+        MEM_STRONG_INLINE std::uint64_t pack_bits(const byte* hits) noexcept
+        {
+#if !defined(MEM_VALUE_SCANNER_USE_GENERIC)
+#    if defined(MEM_SIMD_AVX2)
+            // Move bit 0 of each byte into its sign bit
+            const std::uint32_t lo = static_cast<std::uint32_t>(
+                _mm256_movemask_epi8(_mm256_slli_epi16(_mm256_loadu_si256(reinterpret_cast<const __m256i*>(hits)), 7)));
+            const std::uint32_t hi = static_cast<std::uint32_t>(_mm256_movemask_epi8(
+                _mm256_slli_epi16(_mm256_loadu_si256(reinterpret_cast<const __m256i*>(hits + 32)), 7)));
+
+            return std::uint64_t(lo) | (std::uint64_t(hi) << 32);
+#    elif defined(MEM_SIMD_SSE2)
+            std::uint64_t result = 0;
+
+            for (std::size_t i = 0; i < 64; i += 16)
+            {
+                const __m128i value = _mm_slli_epi16(_mm_loadu_si128(reinterpret_cast<const __m128i*>(hits + i)), 7);
+
+                result |= std::uint64_t(static_cast<std::uint32_t>(_mm_movemask_epi8(value))) << i;
+            }
+
+            return result;
+#    else
+#        error Sorry, No Potatoes
+#    endif
+#else
+            std::uint64_t result = 0;
+
+            for (std::size_t i = 0; i < 64; ++i)
+                result |= std::uint64_t(hits[i]) << i;
+
+            return result;
+#endif
+        }
+
+        // Returns a bitmask of which of the count (at most 64) values in data, every stride bytes, match Op.
+        // The compares are written to a byte array first, so the loop has no dependency between slots and can be
+        // vectorized, particularly when the values are contiguous.
+        template <scan_op Op, typename T>
+        inline std::uint64_t test_slots(const byte* data, std::size_t count, std::size_t stride, T a, T b) noexcept
+        {
+            byte hits[64] {};
+
+            if (stride == sizeof(T))
+            {
+                for (std::size_t i = 0; i < count; ++i)
+                {
+                    T value;
+                    std::memcpy(&value, data + (i * sizeof(T)), sizeof(value));
+                    hits[i] = static_cast<byte>(test_value<Op>(value, value, a, b));
+                }
+            }
+            else
+            {
+                for (std::size_t i = 0; i < count; ++i)
+                {
+                    T value;
+                    std::memcpy(&value, data + (i * stride), sizeof(value));
+                    hits[i] = static_cast<byte>(test_value<Op>(value, value, a, b));
+                }
+            }
+
+            return pack_bits(hits);
+        }
+
+        // Sets hits[i] if values[i] matches Op, compared against previous[i] (or previous[0] if uniform)
+        template <scan_op Op, typename T>
+        inline void test_values(
+            const T* values, const T* previous, bool uniform, std::size_t count, T a, T b, byte* hits) noexcept
+        {
+            if (uniform)
+            {
+                const T value = previous[0];
+
+                for (std::size_t i = 0; i < count; ++i)
+                    hits[i] = static_cast<byte>(test_value<Op>(values[i], value, a, b));
+            }
+            else
+            {
+                for (std::size_t i = 0; i < count; ++i)
+                    hits[i] = static_cast<byte>(test_value<Op>(values[i], previous[i], a, b));
+            }
+        }
+
+        // Returns true if range is entirely inside one of the sorted regions
+        inline bool is_inside(const std::vector<region>& regions, region range) noexcept
+        {
+            auto iter = std::upper_bound(regions.begin(), regions.end(), range.start,
+                [](pointer lhs, const region& rhs) { return lhs < rhs.start; });
+
+            return (iter != regions.begin()) && (iter - 1)->contains(range);
+        }
+    } // namespace internal
+
+    template <typename T>
+    inline value_scanner<T>::value_scanner(std::size_t stride)
+        : stride_(stride ? stride : 1)
+    {}
+
+    template <typename T>
+    MEM_STRONG_INLINE T value_scanner<T>::load(const block& b, std::size_t slot) const noexcept
+    {
+        T result;
+        std::memcpy(&result, b.start.add(slot * stride_).template as<const void*>(), sizeof(result));
+        return result;
+    }
+
+    template <typename T>
+    inline void value_scanner<T>::store(block& b, const std::vector<std::uint16_t>& slots)
+    {
+        b.count = slots.size();
+        b.bitmap.clear();
+        b.offsets.clear();
+
+        // Use whichever of a bitmap or a list of offsets is smaller
+        if ((b.count * sizeof(std::uint16_t) * 8) < b.slots)
+        {
+            b.offsets.assign(slots.begin(), slots.end());
+        }
+        else
+        {
+            b.bitmap.resize((b.slots + 63) / 64);
+
+            for (std::uint16_t slot : slots)
+                b.bitmap[slot / 64] |= std::uint64_t(1) << (slot % 64);
+        }
+
+        b.bitmap.shrink_to_fit();
+        b.offsets.shrink_to_fit();
+    }
+
+    template <typename T>
+    template <typename Func>
+    inline void value_scanner<T>::enum_candidates(const block& b, Func func)
+    {
+        if (!b.offsets.empty())
+        {
+            for (std::size_t i = 0; i < b.offsets.size(); ++i)
+                func(std::size_t(b.offsets[i]), i);
+        }
+        else
+        {
+            std::size_t index = 0;
+
+            for (std::size_t i = 0; i < b.bitmap.size(); ++i)
+            {
+                for (std::uint64_t bits = b.bitmap[i]; bits; bits &= bits - 1)
+                    func((i * 64) + bsf64(bits), index++);
+            }
+        }
+    }
+
+    template <typename T>
+    inline std::size_t value_scanner<T>::first_scan(const std::vector<region>& ranges, scan_op op, T a, T b)
+    {
+        reset();
+
+        switch (op)
+        {
+            case scan_op::equal: return first_scan_op<scan_op::equal>(ranges, a, b);
+            case scan_op::not_equal: return first_scan_op<scan_op::not_equal>(ranges, a, b);
+            case scan_op::less: return first_scan_op<scan_op::less>(ranges, a, b);
+            case scan_op::greater: return first_scan_op<scan_op::greater>(ranges, a, b);
+            case scan_op::between: return first_scan_op<scan_op::between>(ranges, a, b);
+
+            // There are no previous values to compare against
+            case scan_op::changed:
+            case scan_op::unchanged:
+            case scan_op::increased:
+            case scan_op::decreased: return 0;
+        }
+
+        return 0;
+    }
+
+    template <typename T>
+    template <scan_op Op>
+    inline std::size_t value_scanner<T>::first_scan_op(const std::vector<region>& ranges, T a, T b)
+    {
+        const bool simd_equal = (Op == scan_op::equal) && std::is_integral<T>::value && (stride_ == sizeof(T)) &&
+            (sizeof(T) == 1 || sizeof(T) == 2 || sizeof(T) == 4 || sizeof(T) == 8);
+
+        for (const region& range : ranges)
+        {
+            if (range.size < sizeof(T))
+                continue;
+
+            const std::size_t total_slots = ((range.size - sizeof(T)) / stride_) + 1;
+            const std::size_t block_slots = (std::max<std::size_t>)(max_block_size / stride_, 1);
+
+            for (std::size_t first = 0; first < total_slots; first += block_slots)
+            {
+                block current {};
+                current.start = range.start.add(first * stride_);
+                current.slots = (std::min)(block_slots, total_slots - first);
+                current.value = a;
+                current.bitmap.resize((current.slots + 63) / 64);
+
+                if (simd_equal)
+                {
+                    internal::find_equal_slots(current.start.template as<const byte*>(), current.slots,
+                        reinterpret_cast<const byte*>(&a), sizeof(T), current.bitmap.data());
+                }
+                else
+                {
+                    const byte* const data = current.start.template as<const byte*>();
+
+                    for (std::size_t i = 0; i < current.bitmap.size(); ++i)
+                    {
+                        const std::size_t base = i * 64;
+                        const std::size_t count = (std::min<std::size_t>)(current.slots - base, 64);
+
+                        current.bitmap[i] = internal::test_slots<Op>(data + (base * stride_), count, stride_, a, b);
+                    }
+                }
+
+                scratch_.clear();
+
+                enum_candidates(current, [this](std::size_t slot, std::size_t) {
+                    scratch_.push_back(static_cast<std::uint16_t>(slot));
+                });
+
+                if (scratch_.empty())
+                    continue;
+
+                if (Op != scan_op::equal)
+                {
+                    current.values.reserve(scratch_.size());
+
+                    for (std::uint16_t slot : scratch_)
+                        current.values.push_back(load(current, slot));
+                }
+
+                store(current, scratch_);
+
+                count_ += current.count;
+                blocks_.push_back(std::move(current));
+            }
+        }
+
+        return count_;
+    }
+
+    template <typename T>
+    inline std::size_t value_scanner<T>::first_scan(scan_op op, T a, T b)
+    {
+        return first_scan(readable_regions(), op, a, b);
+    }
+
+    template <typename T>
+    inline std::size_t value_scanner<T>::next_scan(scan_op op, T a, T b)
+    {
+        switch (op)
+        {
+            case scan_op::equal: return next_scan_op<scan_op::equal>(a, b);
+            case scan_op::not_equal: return next_scan_op<scan_op::not_equal>(a, b);
+            case scan_op::less: return next_scan_op<scan_op::less>(a, b);
+            case scan_op::greater: return next_scan_op<scan_op::greater>(a, b);
+            case scan_op::between: return next_scan_op<scan_op::between>(a, b);
+            case scan_op::changed: return next_scan_op<scan_op::changed>(a, b);
+            case scan_op::unchanged: return next_scan_op<scan_op::unchanged>(a, b);
+            case scan_op::increased: return next_scan_op<scan_op::increased>(a, b);
+            case scan_op::decreased: return next_scan_op<scan_op::decreased>(a, b);
+        }
+
+        return count_;
+    }
+
+    template <typename T>
+    template <scan_op Op>
+    inline std::size_t value_scanner<T>::next_scan_op(T a, T b)
+    {
+        const std::vector<region> regions = readable_regions();
+
+        count_ = 0;
+
+        std::vector<T> values;
+        std::vector<byte> hits;
+
+        for (block& current : blocks_)
+        {
+            if (!internal::is_inside(regions, region(current.start, ((current.slots - 1) * stride_) + sizeof(T))))
+            {
+                current.count = 0;
+
+                continue;
+            }
+
+            scratch_.clear();
+            values.clear();
+
+            // Gather the current values, so they can be compared against the previous values in one pass
+            enum_candidates(current, [&](std::size_t slot, std::size_t) {
+                scratch_.push_back(static_cast<std::uint16_t>(slot));
+                values.push_back(load(current, slot));
+            });
+
+            hits.resize(values.size());
+
+            const bool uniform = current.values.empty();
+
+            internal::test_values<Op>(values.data(), uniform ? &current.value : current.values.data(), uniform,
+                values.size(), a, b, hits.data());
+
+            std::size_t kept = 0;
+
+            for (std::size_t i = 0; i < hits.size(); ++i)
+            {
+                if (hits[i])
+                {
+                    scratch_[kept] = scratch_[i];
+                    values[kept] = values[i];
+                    ++kept;
+                }
+            }
+
+            scratch_.resize(kept);
+            values.resize((Op != scan_op::equal) ? kept : 0);
+
+            store(current, scratch_);
+
+            current.value = a;
+            current.values.assign(values.begin(), values.end());
+            current.values.shrink_to_fit();
+
+            count_ += current.count;
+        }
+
+        blocks_.erase(std::remove_if(blocks_.begin(), blocks_.end(), [](const block& b) { return b.count == 0; }),
+            blocks_.end());
+
+        return count_;
+    }
+
+    template <typename T>
+    template <typename Func>
+    inline void value_scanner<T>::enum_results(Func func) const
+    {
+        for (const block& current : blocks_)
+        {
+            enum_candidates(current, [&](std::size_t slot, std::size_t index) {
+                func(current.start.add(slot * stride_), current.values.empty() ? current.value : current.values[index]);
+            });
+        }
+    }
+
+    template <typename T>
+    inline std::vector<pointer> value_scanner<T>::results(std::size_t max) const
+    {
+        std::vector<pointer> results;
+        results.reserve((std::min)(count_, max));
+
+        enum_results([&results, max](pointer address, T) {
+            if (results.size() < max)
+                results.push_back(address);
+        });
+
+        return results;
+    }
+
+    template <typename T>
+    MEM_STRONG_INLINE std::size_t value_scanner<T>::size() const noexcept
+    {
+        return count_;
+    }
+
+    template <typename T>
+    inline std::size_t value_scanner<T>::memory_usage() const noexcept
+    {
+        std::size_t total = blocks_.capacity() * sizeof(block);
+
+        for (const block& current : blocks_)
+        {
+            total += current.bitmap.capacity() * sizeof(std::uint64_t);
+            total += current.offsets.capacity() * sizeof(std::uint16_t);
+            total += current.values.capacity() * sizeof(T);
+        }
+
+        return total;
+    }
+
+    template <typename T>
+    inline void value_scanner<T>::reset()
+    {
+        count_ = 0;
+        blocks_.clear();
+    }
+} // namespace mem
+
+#endif // MEM_VALUE_SCANNER_BRICK_H
@@ -0,0 +1,239 @@
+/*
+    Copyright 2018 Brick
+
+    Permission is hereby granted, free of charge, to any person obtaining a copy of this software
+    and associated documentation files (the "Software"), to deal in the Software without restriction,
+    including without limitation the rights to use, copy, modify, merge, publish, distribute,
+    sublicense, and/or sell copies of the Software, and to permit persons to whom the Software is
+    furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included in all copies or
+    substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING
+    BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+    NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM,
+    DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+    OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+*/
+
+#ifndef MEM_XREF_INDEX_BRICK_H
+#define MEM_XREF_INDEX_BRICK_H
+
+#include "mem.h"
+#include "slice.h"
+
+#if !defined(MEM_XREF_INDEX_USE_GENERIC)
+#    if defined(MEM_SIMD_AVX2)
+#        include <immintrin.h>
+#    elif defined(MEM_SIMD_SSE2)
+#        include <emmintrin.h>
+#    else
+#        define MEM_XREF_INDEX_USE_GENERIC
+#    endif
+#endif
+
+#if !defined(MEM_XREF_INDEX_USE_GENERIC)
+#    include "arch.h"
+#endif
+
+#include <algorithm>
+#include <cstring>
+#include <vector>
+
+namespace mem
+{
+    enum class xref_kind : std::uint8_t
+    {
+        call,             // E8 rel32
+        jump,             // E9 rel32
+        conditional_jump, // 0F 8x rel32
+        lea,              // REX.W 8D /r [rip + disp32]
+    };
+
+    struct xref
+    {
+        pointer target;
+        pointer source;
+        xref_kind kind;
+    };
+
+    // An index of the rel32 calls, jumps and RIP-relative LEAs in x86-64 code, sorted by their target.
+    // Instructions are found by matching their encodings rather than by disassembling, so only references
+    // which land inside the target region are kept.
+    class xref_index
+    {
+    private:
+        std::vector<xref> xrefs_ {};
+
+        void add_candidate(region code, region targets, const byte* here);
+
+    public:
+        xref_index() = default;
+
+        explicit xref_index(region code);
+        xref_index(region code, region targets);
+
+        // All references to exactly this address
+        slice<const xref> find(pointer target) const noexcept;
+
+        // All references to an address inside of this range
+        slice<const xref> find(region targets) const noexcept;
+
+        slice<const xref> xrefs() const noexcept;
+
+        std::size_t size() const noexcept;
+    };
+
+    inline xref_index::xref_index(region code)
+        : xref_index(code, code)
+    {}
+
+    inline xref_index::xref_index(region code, region targets)
+    {
+        const byte* ptr = code.start.as<const byte*>();
+        const byte* const end = ptr + code.size;
+
+#if !defined(MEM_XREF_INDEX_USE_GENERIC)
+#    if defined(MEM_SIMD_AVX2)
+#        define l_SIMD_TYPE __m256i
+#        define l_SIMD_FILL8(x) _mm256_set1_epi8(static_cast<char>(x))
+#        define l_SIMD_LOAD(x) _mm256_loadu_si256(reinterpret_cast<const __m256i*>(x))
+#        define l_SIMD_OR(x, y) _mm256_or_si256(x, y)
+#        define l_SIMD_CMPEQ(x, y) _mm256_cmpeq_epi8(x, y)
+#        define l_SIMD_MOVEMASK(x) static_cast<unsigned int>(_mm256_movemask_epi8(x))
+#    elif defined(MEM_SIMD_SSE2)
+#        define l_SIMD_TYPE __m128i
+#        define l_SIMD_FILL8(x) _mm_set1_epi8(static_cast<char>(x))
+#        define l_SIMD_LOAD(x) _mm_loadu_si128(reinterpret_cast<const __m128i*>(x))
+#        define l_SIMD_OR(x, y) _mm_or_si128(x, y)
+#        define l_SIMD_CMPEQ(x, y) _mm_cmpeq_epi8(x, y)
+#        define l_SIMD_MOVEMASK(x) static_cast<unsigned int>(_mm_movemask_epi8(x))
+#    else
+#        error Sorry, No Potatoes
+#    endif
+
+        const l_SIMD_TYPE call_opcode = l_SIMD_FILL8(0xE8);
+        const l_SIMD_TYPE jump_opcode = l_SIMD_FILL8(0xE9);
+        const l_SIMD_TYPE escape_opcode = l_SIMD_FILL8(0x0F);
+        const l_SIMD_TYPE lea_opcode = l_SIMD_FILL8(0x8D);
+
+        for (; static_cast<std::size_t>(end - ptr) >= sizeof(l_SIMD_TYPE); ptr += sizeof(l_SIMD_TYPE))
+        {
+            const l_SIMD_TYPE value = l_SIMD_LOAD(ptr);
+
+            unsigned int mask = l_SIMD_MOVEMASK(
+                l_SIMD_OR(l_SIMD_OR(l_SIMD_CMPEQ(value, call_opcode), l_SIMD_CMPEQ(value, jump_opcode)),
+                    l_SIMD_OR(l_SIMD_CMPEQ(value, escape_opcode), l_SIMD_CMPEQ(value, lea_opcode))));
+
+            while (mask)
+            {
+                add_candidate(code, targets, ptr + bsf(mask));
+                mask &= mask - 1;
+            }
+        }
+
+#    undef l_SIMD_TYPE
+#    undef l_SIMD_FILL8
+#    undef l_SIMD_LOAD
+#    undef l_SIMD_OR
+#    undef l_SIMD_CMPEQ
+#    undef l_SIMD_MOVEMASK
+#endif
+
+        for (; ptr < end; ++ptr)
+        {
+            const byte value = *ptr;
+
+            if (value == 0xE8 || value == 0xE9 || value == 0x0F || value == 0x8D)
+                add_candidate(code, targets, ptr);
+        }
+
+        std::sort(xrefs_.begin(), xrefs_.end(), [](const xref& lhs, const xref& rhs) {
+            return (lhs.target < rhs.target) || ((lhs.target == rhs.target) && (lhs.source < rhs.source));
+        });
+    }
+
+    MEM_STRONG_INLINE void xref_index::add_candidate(region code, region targets, const byte* here)
+    {
+        const byte* const start = code.start.as<const byte*>();
+        const std::size_t remaining = static_cast<std::size_t>((start + code.size) - here);
+
+        const byte* source = here;
+        std::size_t length = 0;
+        xref_kind kind;
+
+        switch (here[0])
+        {
+            case 0xE8:
+                kind = xref_kind::call;
+                length = 5;
+                break;
+
+            case 0xE9:
+                kind = xref_kind::jump;
+                length = 5;
+                break;
+
+            case 0x0F:
+                if (remaining < 2 || (here[1] & 0xF0) != 0x80)
+                    return;
+
+                kind = xref_kind::conditional_jump;
+                length = 6;
+                break;
+
+            case 0x8D:
+                // Requires a REX.W prefix, and a ModRM of [rip + disp32]
+                if (here == start || (here[-1] & 0xF8) != 0x48 || remaining < 2 || (here[1] & 0xC7) != 0x05)
+                    return;
+
+                kind = xref_kind::lea;
+                source = here - 1;
+                length = 7;
+                break;
+
+            default: return;
+        }
+
+        if (static_cast<std::size_t>((start + code.size) - source) < length)
+            return;
+
+        std::int32_t displacement;
+        std::memcpy(&displacement, source + length - 4, sizeof(displacement));
+
+        const pointer target = pointer(source + length).as<std::uintptr_t>() +
+            static_cast<std::uintptr_t>(static_cast<std::intptr_t>(displacement));
+
+        if (targets.contains(target))
+            xrefs_.push_back({target, source, kind});
+    }
+
+    inline slice<const xref> xref_index::find(pointer target) const noexcept
+    {
+        return find(region(target, 1));
+    }
+
+    inline slice<const xref> xref_index::find(region targets) const noexcept
+    {
+        const auto lower = std::lower_bound(xrefs_.begin(), xrefs_.end(), targets.start,
+            [](const xref& lhs, pointer rhs) { return lhs.target < rhs; });
+
+        const auto upper = std::lower_bound(lower, xrefs_.end(), targets.start.add(targets.size),
+            [](const xref& lhs, pointer rhs) { return lhs.target < rhs; });
+
+        return {xrefs_.data() + (lower - xrefs_.begin()), xrefs_.data() + (upper - xrefs_.begin())};
+    }
+
+    MEM_STRONG_INLINE slice<const xref> xref_index::xrefs() const noexcept
+    {
+        return {xrefs_.data(), xrefs_.size()};
+    }
+
+    MEM_STRONG_INLINE std::size_t xref_index::size() const noexcept
+    {
+        return xrefs_.size();
+    }
+} // namespace mem
+
+#endif // MEM_XREF_INDEX_BRICK_H
@@ -25,6 +25,7 @@
 #include <mem/slice.h>
 
 #include <mem/init_function.h>
+#include <mem/init_task.h>
 
 #include <mem/cmd_param.h>
 #include <mem/cmd_param-inl.h>
@@ -33,22 +34,48 @@
 #include <mem/pattern_cache.h>
 
 #include <mem/simd_scanner.h>
+#include <mem/bigram_frequencies.h>
 #include <mem/boyer_moore_scanner.h>
+#include <mem/teddy_scanner.h>
+#include <mem/pattern_set.h>
+#include <mem/pointer_scanner.h>
+#include <mem/xref_index.h>
+#include <mem/string_references.h>
+#include <mem/function_index.h>
+#include <mem/value_scanner.h>
+#include <mem/pointer_map.h>
+#include <mem/region_snapshot.h>
+#include <mem/resident_scan.h>
+#include <mem/resumable_scan.h>
+#include <mem/async_scan.h>
+#include <mem/scan_stats.h>
 
 #include <mem/prot_flags.h>
 #include <mem/protect.h>
 
 #include <mem/module.h>
+#include <mem/pe_image.h>
 #include <mem/aligned_alloc.h>
 #include <mem/execution_handler.h>
 
 #include <mem/macros.h>
 
-#if defined(_WIN32)
+#if defined(MEM_ARCH_X86) || defined(MEM_ARCH_X86_64)
 # include <mem/rtti.h>
 #endif
 
+#if defined(__unix__)
+# include <mem/itanium_rtti.h>
+# include <dlfcn.h>
+#endif
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <initializer_list>
+#include <sstream>
 #include <string>
+#include <thread>
 #include <unordered_set>
 
 #include "doctest.h"
@@ -93,6 +120,12 @@ TEST_CASE("mem::pattern constructor")
     CHECK_NOTHROW(check_pattern(mem::pattern("\x12\x34\x56\x78\xAB", nullptr, 5), 5, 5, false, "\x12\x34\x56\x78\xAB", "\xFF\xFF\xFF\xFF\xFF"));
 }
 
+template <typename Container, typename T>
+void write_image_value(Container& image, size_t offset, T value)
+{
+    memcpy(reinterpret_cast<char*>(image.data()) + offset, &value, sizeof(value));
+}
+
 void check_pattern_results(mem::region whole_region, const mem::pattern& pattern, const std::vector<uint8_t>& scan_data, const std::unordered_set<size_t>& offsets)
 {
     REQUIRE(scan_data.size() <= whole_region.size);
@@ -119,6 +152,30 @@ void check_pattern_results(mem::region whole_region, const mem::pattern& pattern
 
     REQUIRE(scan_results_set.size() == offsets.size());
 
+    REQUIRE(scanner.count(whole_region) == offsets.size());
+    REQUIRE(scanner.count(whole_region, 1) == (offsets.empty() ? 0 : 1));
+    REQUIRE(scanner.scan_unique(whole_region) == ((offsets.size() == 1) ? scan_results.front() : mem::pointer(nullptr)));
+
+    std::vector<mem::pointer> lazy_results;
+
+    for (mem::pointer result : scanner.matches(whole_region))
+        lazy_results.push_back(result);
+
+    REQUIRE(lazy_results == scan_results);
+
+    std::vector<mem::pointer> output_results(offsets.size() + 1);
+
+    REQUIRE(scanner.scan_into(whole_region, output_results.begin()) == offsets.size());
+    REQUIRE(std::equal(scan_results.begin(), scan_results.end(), output_results.begin()));
+
+    if (!offsets.empty())
+    {
+        mem::pointer first_result;
+
+        REQUIRE(scanner.scan_into(whole_region, &first_result, 1) == 1);
+        REQUIRE(first_result == scan_results.front());
+    }
+
     for (auto expected : offsets)
     {
         REQUIRE(scan_results_set.find(expected) != scan_results_set.end());
@@ -163,6 +220,18 @@ TEST_CASE("mem::pattern scan")
         0, 2, 4, 6
     }));
 
+    CHECK_NOTHROW(check_pattern_results(scan_region, mem::pattern("01 02"), {
+        0x01, 0x02, 0x01, 0x02, 0x01, 0x02, 0x01, 0x02, 0x01, 0x02, 0x01, 0x02, 0x01, 0x02, 0x01, 0x02, 0x01, 0x02, 0x01, 0x02, 0x01
+    }, {
+        0, 2, 4, 6, 8, 10, 12, 14, 16, 18
+    }));
+
+    CHECK_NOTHROW(check_pattern_results(scan_region, mem::pattern("09 ?"), {
+        0x00, 0x09, 0x00, 0x00, 0x09
+    }, {
+        1
+    }));
+
     CHECK_NOTHROW(check_pattern_results(scan_region, mem::pattern(""), {
 
     }, {
@@ -190,125 +259,1861 @@ TEST_CASE("mem::pattern scan")
     mem::protect_free(raw_data, raw_size);
 }
 
-TEST_CASE("mem::region contains")
+TEST_CASE("mem::pattern_cache")
 {
-    REQUIRE(mem::region(0x1234, 0x10).contains(mem::region(0x1234, 0x10)));
-    REQUIRE(mem::region(0x1234, 0x10).contains(mem::region(0x1235, 0x09)));
-    REQUIRE(!mem::region(0x1234, 0x10).contains(mem::region(0x1235, 0x10)));
+    std::vector<uint8_t> data(0x1000);
 
-    REQUIRE(mem::region(0x1234, 0x10).contains(0x1234, 0x10));
-    REQUIRE(mem::region(0x1234, 0x10).contains(0x1235, 0x09));
-    REQUIRE(!mem::region(0x1234, 0x10).contains(0x1235, 0x10));
+    for (size_t i = 0; i < data.size(); ++i)
+        data[i] = static_cast<uint8_t>((i * 7) ^ (i >> 3));
 
-    REQUIRE(mem::region(0x1234, 0x10).contains(0x1234));
-    REQUIRE(mem::region(0x1234, 0x10).contains(0x1234 + 0x9));
-    REQUIRE(mem::region(0x1234, 1).contains(0x1234));
-    REQUIRE(!mem::region(0x1234, 0x10).contains(0x1233));
-    REQUIRE(!mem::region(0x1234, 0x10).contains(0x1234 + 0x10));
-    REQUIRE(!mem::region(0x1234, 0).contains(0x1234));
+    const uint8_t unique[] {0xDE, 0xAD, 0xBE, 0xEF, 0x13, 0x37};
 
-    REQUIRE(mem::region(0x1234, 4).contains<int>(0x1234));
-    REQUIRE(mem::region(0x1234, 4).contains<int>(0x1234));
-    REQUIRE(!mem::region(0x1234, 3).contains<int>(0x1234));
-    REQUIRE(!mem::region(0x1235, 3).contains<int>(0x1234));
+    memcpy(&data[0x800], unique, sizeof(unique));
+
+    mem::region range(data.data(), data.size());
+
+    const mem::pattern unique_pattern("DE AD BE EF 13 37");
+    const mem::pattern common_pattern("07");
+
+    mem::simd_scanner common_scanner(common_pattern);
+
+    REQUIRE(common_scanner.count(range) == common_scanner.scan_all(range).size());
+    REQUIRE(common_scanner.count(range) > 2);
+
+    mem::pattern_cache cache(range);
+
+    REQUIRE(cache.scan(unique_pattern) == range.start.add(0x800));
+    REQUIRE(cache.scan(common_pattern) == nullptr);
+    REQUIRE(cache.scan_all(common_pattern).size() == common_scanner.count(range));
+
+    mem::pattern_cache partial(range);
+
+    REQUIRE(partial.scan(common_pattern) == nullptr);
+    REQUIRE(partial.scan(unique_pattern) == range.start.add(0x800));
+
+    std::stringstream stream;
+    partial.save(stream);
+
+    mem::pattern_cache loaded(range);
+
+    REQUIRE(loaded.load(stream));
+    REQUIRE(loaded.scan(unique_pattern) == range.start.add(0x800));
+    REQUIRE(loaded.scan_all(common_pattern).size() == common_scanner.count(range));
 }
 
-void check_pointer_aligment(mem::pointer address, size_t alignment, mem::pointer aligned_down, mem::pointer aligned_up)
+template <typename Scanner>
+void check_directional_scans(const mem::pattern& pattern, mem::region range)
 {
-    REQUIRE(address.align_down(alignment) == aligned_down);
-    REQUIRE(address.align_up(alignment) == aligned_up);
+    Scanner scanner(pattern);
+
+    const std::vector<mem::pointer> results = scanner.scan_all(range);
+
+    REQUIRE(results.size() > 1);
+    REQUIRE(scanner.scan_reverse(range) == results.back());
+
+    mem::region head(range.start, static_cast<size_t>(results[1] - range.start));
+
+    REQUIRE(scanner.scan_reverse(head) == results[0]);
+
+    for (size_t origin = 0; origin < range.size; origin += 0x1357)
+    {
+        for (size_t max_distance : {size_t(0x10), size_t(0x800), size_t(0x4000), SIZE_MAX})
+        {
+            const mem::pointer center = range.start.add(origin);
+
+            mem::pointer expected = nullptr;
+            size_t expected_distance = SIZE_MAX;
+
+            for (mem::pointer result : results)
+            {
+                const size_t distance = static_cast<size_t>((result >= center) ? (result - center) : (center - result));
+
+                if (distance <= max_distance && (distance < expected_distance || (distance == expected_distance && result > center)))
+                {
+                    expected = result;
+                    expected_distance = distance;
+                }
+            }
+
+            REQUIRE(scanner.scan_nearest(range, center, max_distance) == expected);
+        }
+    }
 }
 
-TEST_CASE("mem::pointer align")
+TEST_CASE("mem::scanner_base directional")
 {
-    CHECK_NOTHROW(check_pointer_aligment(13, 1, 13, 13));
-    CHECK_NOTHROW(check_pointer_aligment(13, 2, 12, 14));
-    CHECK_NOTHROW(check_pointer_aligment(13, 5, 10, 15));
-    CHECK_NOTHROW(check_pointer_aligment(16, 5, 15, 20));
-    CHECK_NOTHROW(check_pointer_aligment(14, 5, 10, 15));
-    CHECK_NOTHROW(check_pointer_aligment(15, 15, 15, 15));
+    std::vector<uint8_t> data(0x30000);
+
+    const uint8_t needle[] {0x48, 0x8B, 0x05, 0x11, 0x22, 0x33, 0x44, 0xC3};
+
+    for (size_t offset : {size_t(0x10), size_t(0x1FFC), size_t(0x2000), size_t(0x9123), size_t(0x1A000), size_t(0x2FFF8)})
+        memcpy(&data[offset], needle, sizeof(needle));
+
+    mem::region range(data.data(), data.size());
+    mem::pattern pattern("48 8B 05 ? ? ? ? C3");
+
+    check_directional_scans<mem::simd_scanner>(pattern, range);
+    check_directional_scans<mem::boyer_moore_scanner>(pattern, range);
+
+    REQUIRE(mem::simd_scanner(pattern).scan_reverse(mem::region(data.data(), 0x10)) == nullptr);
+    REQUIRE(mem::simd_scanner(pattern).scan_nearest(range, range.start.add(0x5000), 0x100) == nullptr);
 }
 
-template <typename T>
-void check_any_pointer()
+TEST_CASE("mem::simd_scanner alignment")
 {
-    mem::pointer result(0x1234);
+    std::vector<uint8_t> data(0x1000 + 64);
 
-    REQUIRE(result.as<T>() == static_cast<T>(result.any()));
+    for (size_t i = 0; i < data.size(); ++i)
+        data[i] = static_cast<uint8_t>(i % 3);
+
+    const mem::pointer base = mem::pointer(data.data()).align_up(64);
+
+    mem::region range(base, 0x1000);
+
+    for (size_t i = 0; i < range.size; i += 11)
+        range.start.at<uint8_t>(i) = 0xAA;
+
+    for (const char* text : {"AA", "AA 00", "AA ? 02", "AA ? ? ?1 ? ? ? ? ? ? ? AA"})
+    {
+        const mem::pattern pattern(text);
+        const std::vector<mem::pointer> results = mem::simd_scanner(pattern).scan_all(range);
+
+        for (size_t alignment : {size_t(1), size_t(2), size_t(4), size_t(8), size_t(16), size_t(64)})
+        {
+            for (size_t offset : {size_t(0), size_t(1), size_t(3)})
+            {
+                mem::region sub_range(range.start.add(offset), range.size - offset);
+
+                std::vector<mem::pointer> expected;
+
+                for (mem::pointer result : results)
+                {
+                    if (result >= sub_range.start && result.align_down(alignment) == result)
+                        expected.push_back(result);
+                }
+
+                mem::simd_scanner scanner(pattern, mem::simd_scanner::default_frequencies(), alignment);
+
+                REQUIRE(!expected.empty());
+                REQUIRE(scanner.scan_all(sub_range) == expected);
+                REQUIRE(scanner.count(sub_range) == expected.size());
+            }
+        }
+    }
 }
 
-TEST_CASE("mem::pointer any")
+TEST_CASE("mem::simd_scanner resume")
 {
-    CHECK_NOTHROW(check_any_pointer<uintptr_t>());
-    CHECK_NOTHROW(check_any_pointer<int*>());
-    CHECK_NOTHROW(check_any_pointer<void*>());
+    std::vector<uint8_t> data(200);
+
+    uint32_t seed = 11;
+
+    for (uint8_t& value : data)
+    {
+        seed = (seed * 1664525) + 1013904223;
+        value = static_cast<uint8_t>((seed >> 28) & 3);
+    }
+
+    for (const char* text : {"01", "01 01", "00 ? 02", "03 ?1 01 01", "01 02 03 00 01 02 03 00 01 02 03 00 01 02 03 00 01"})
+    {
+        const mem::pattern pattern(text);
+
+        for (size_t alignment : {size_t(1), size_t(4)})
+        {
+            // Sizes around the vector sizes, so that matches land in the final overlapping block
+            for (size_t size : {size_t(5), size_t(16), size_t(17), size_t(31), size_t(32), size_t(33), size_t(47), size_t(64), size_t(200)})
+            {
+                const mem::region range(data.data(), size);
+
+                std::vector<mem::pointer> expected;
+
+                for (size_t i = 0; i + pattern.size() <= size; ++i)
+                {
+                    if (range.start.add(i).align_down(alignment) != range.start.add(i))
+                        continue;
+
+                    size_t j = 0;
+
+                    while (j < pattern.size() && (data[i + j] & pattern.masks()[j]) == pattern.bytes()[j])
+                        ++j;
+
+                    if (j == pattern.size())
+                        expected.push_back(range.start.add(i));
+                }
+
+                mem::simd_scanner scanner(pattern, mem::simd_scanner::default_frequencies(), alignment);
+
+                REQUIRE(scanner.scan_all(range) == expected);
+
+                std::vector<mem::pointer> lazy;
+
+                for (mem::pointer result : scanner.matches(range))
+                    lazy.push_back(result);
+
+                REQUIRE(lazy == expected);
+                REQUIRE(scanner.count(range, SIZE_MAX - 1) == expected.size());
+            }
+        }
+    }
 }
 
-void check_hex_conversion(const void* data, size_t length, bool upper_case, bool padded, const char* expected)
+TEST_CASE("mem::simd_scanner bigrams")
 {
-    REQUIRE(mem::as_hex({ data, length }, upper_case, padded) == expected);
+    const uint8_t common[8] {0x48, 0x8B, 0x89, 0x00, 0x24, 0xE8, 0x0F, 0xC3};
+
+    std::vector<uint8_t> data(0x4000);
+    uint32_t state = 1;
+
+    // Only common x86 bytes, so the anchors get plenty of false positives
+    for (uint8_t& value : data)
+    {
+        state = (state * 1664525) + 1013904223;
+        value = common[state >> 29];
+    }
+
+    const mem::region range(data.data(), data.size());
+
+    for (const char* text : {"48 8B 89", "E8 ? ? ? ? 48 8B ? ? 48 89", "48 89 ? 24 ? 0F", "00 00 C3 48", "E8 00 ?8 ? 24",
+             "0F ? 89 24 C3 48 8B 00 E8"})
+    {
+        const mem::pattern pattern(text);
+
+        for (size_t alignment : {size_t(1), size_t(4)})
+        {
+            mem::simd_scanner scanner(pattern, mem::simd_scanner::default_frequencies(), alignment);
+            mem::simd_scanner bigram_scanner(
+                pattern, mem::simd_scanner::default_frequencies(), alignment, mem::bigram_frequencies());
+
+            const std::vector<mem::pointer> expected = scanner.scan_all(range);
+
+            REQUIRE(bigram_scanner.scan_all(range) == expected);
+            REQUIRE(bigram_scanner.count(range) == expected.size());
+        }
+    }
 }
 
-TEST_CASE("mem::as_hex")
+TEST_CASE("mem::scan_pointers")
 {
-    CHECK_NOTHROW(check_hex_conversion("\x01\x23\x45\x67\x89\xAB\xCD\xEF", 8, true,  true, "01 23 45 67 89 AB CD EF"));
-    CHECK_NOTHROW(check_hex_conversion("\x01\x23\x45\x67\x89\xAB\xCD\xEF", 8, false, true, "01 23 45 67 89 ab cd ef"));
-    CHECK_NOTHROW(check_hex_conversion("\x01\x23\x45\x67\x89\xAB\xCD\xEF", 8, true,  false, "0123456789ABCDEF"));
-    CHECK_NOTHROW(check_hex_conversion("\x01\x23\x45\x67\x89\xAB\xCD\xEF", 8, false, false, "0123456789abcdef"));
+    std::vector<uint8_t> targets(0x1000);
+    std::vector<uint8_t> other_targets(0x100);
+
+    const uintptr_t target_start = reinterpret_cast<uintptr_t>(targets.data());
+    const uintptr_t other_start = reinterpret_cast<uintptr_t>(other_targets.data());
+
+    std::vector<uintptr_t> slots(1001);
+
+    uint32_t seed = 3;
+
+    for (uintptr_t& slot : slots)
+    {
+        seed = (seed * 1664525) + 1013904223;
+
+        switch (seed >> 29)
+        {
+            case 0: slot = target_start + (seed % targets.size()); break;
+            case 1: slot = target_start - 1 - (seed % 4); break;
+            case 2: slot = target_start + targets.size() + (seed % 4); break;
+            case 3: slot = other_start + (seed % other_targets.size()); break;
+            case 4: slot = target_start ^ (uintptr_t(1) << (seed % (sizeof(uintptr_t) * 8))); break;
+            default: slot = seed; break;
+        }
+    }
+
+    slots[0] = target_start;
+    slots[slots.size() - 1] = target_start + targets.size() - 1;
+
+    const mem::region target_region(targets.data(), targets.size());
+    const mem::region other_region(other_targets.data(), other_targets.size());
+
+    for (size_t offset : {size_t(0), size_t(3)})
+    {
+        for (size_t stride : {sizeof(uintptr_t), size_t(4), size_t(16)})
+        {
+            const mem::region haystack(mem::pointer(slots.data()).add(offset), (slots.size() * sizeof(uintptr_t)) - offset);
+
+            std::vector<mem::pointer> expected;
+            std::vector<mem::pointer> expected_multi;
+
+            for (size_t i = 0; i + sizeof(uintptr_t) <= haystack.size; i += stride)
+            {
+                uintptr_t raw;
+                std::memcpy(&raw, haystack.start.add(i).as<const void*>(), sizeof(raw));
+                const mem::pointer value = raw;
+
+                if (target_region.contains(value))
+                    expected.push_back(haystack.start.add(i));
+
+                if (target_region.contains(value) || other_region.contains(value))
+                    expected_multi.push_back(haystack.start.add(i));
+            }
+
+            if (offset == 0)
+                REQUIRE(!expected.empty());
+
+            REQUIRE(mem::scan_pointers(haystack, target_region, stride) == expected);
+            REQUIRE(mem::scan_pointers(haystack, {other_region, target_region, mem::region(targets.data(), 0x10)}, stride) == expected_multi);
+        }
+    }
+
+    const mem::region haystack(slots.data(), slots.size() * sizeof(uintptr_t));
+
+    REQUIRE(mem::scan_pointers(haystack, target_region, sizeof(uintptr_t), [](mem::pointer, mem::pointer) { return true; }) == haystack.start);
+    REQUIRE(mem::scan_pointers(haystack, mem::region(targets.data(), 0)).empty());
 }
 
-void check_unescape_string(const char* string, const void* data, size_t length, bool strict)
+TEST_CASE("mem::scan_pointers separate ranges")
 {
-    std::vector<mem::byte> unescaped = mem::unescape(string, strlen(string), strict);
+    const uintptr_t high = ~uintptr_t(0) - 0xFFFF;
 
-    REQUIRE(unescaped.size() == length);
-    REQUIRE(memcmp(unescaped.data(), data, length) == 0);
+    std::vector<mem::region> ranges {mem::region(uintptr_t(0x10000), 0x1000), mem::region(high, 0x100)};
+
+    std::vector<uintptr_t> slots(257);
+
+    uint32_t seed = 7;
+
+    for (uintptr_t& slot : slots)
+    {
+        seed = (seed * 1664525) + 1013904223;
+
+        switch (seed >> 29)
+        {
+            case 0: slot = 0x10000 + (seed % 0x1000); break;
+            case 1: slot = high + (seed % 0x100); break;
+            case 2: slot = 0x11000 + (seed % 0x100); break; // Inside the hull, but not either range
+            case 3: slot = high - 1 - (seed % 4); break;
+            case 4: slot = high + 0x100 + (seed % 4); break;
+            case 5: slot = 0x20000 + (seed % 0x400); break;
+            default: slot = seed; break;
+        }
+    }
+
+    const mem::region haystack(slots.data(), slots.size() * sizeof(uintptr_t));
+
+    for (size_t count : {size_t(2), size_t(4), size_t(6)})
+    {
+        // Extra ranges (up to the hull fallback) between the first two
+        while (ranges.size() < count)
+            ranges.emplace_back(uintptr_t(0x20000 + (ranges.size() * 0x100)), 0x80);
+
+        std::vector<mem::pointer> expected;
+
+        for (const uintptr_t& slot : slots)
+        {
+            if (std::any_of(ranges.begin(), ranges.end(), [&](const mem::region& range) { return range.contains(slot); }))
+                expected.push_back(&slot);
+        }
+
+        REQUIRE(expected.size() > slots.size() / 8);
+        REQUIRE(mem::scan_pointers(haystack, ranges) == expected);
+    }
 }
 
-#if defined(_MSC_VER)
-# pragma warning(push)
-# pragma warning(disable: 4125) // warning C4125: decimal digit terminates octal escape sequence
-#endif
+void write_rel32(std::vector<uint8_t>& code, size_t offset, std::initializer_list<uint8_t> opcode, size_t target)
+{
+    std::copy(opcode.begin(), opcode.end(), code.begin() + static_cast<std::ptrdiff_t>(offset));
 
-TEST_CASE("mem::unescape")
+    const size_t next = offset + opcode.size() + 4;
+    write_image_value(code, offset + opcode.size(), static_cast<int32_t>(static_cast<int64_t>(target) - static_cast<int64_t>(next)));
+}
+
+TEST_CASE("mem::xref_index")
 {
-    CHECK_NOTHROW(check_unescape_string(R"(\x12\x34)", "\x12\x34", 2, true));
-    CHECK_NOTHROW(check_unescape_string(R"(\0\1\10)", "\0\1\10", 3, true));
-    CHECK_NOTHROW(check_unescape_string(R"(\0\1\1011)", "\0\1\1011", 4, true));
-    CHECK_NOTHROW(check_unescape_string(R"(\1\2\3)", "\1\2\3", 3, true));
-    CHECK_NOTHROW(check_unescape_string(R"(Hello There)", "Hello There", 11, true));
-    CHECK_NOTHROW(check_unescape_string(R"(Hello\nThere)", "Hello\nThere", 11, true));
-    CHECK_NOTHROW(check_unescape_string(R"(Hello \"Bob)", "Hello \"Bob", 10, true));
+    std::vector<uint8_t> code(0x400, 0x90);
 
-    CHECK_NOTHROW(check_unescape_string(R"(I am a \U0001F9F1)", "I am a \xF0\x9F\xA7\xB1", 11, true));
+    write_rel32(code, 0x10, {0xE8}, 0x100);
+    write_rel32(code, 0x20, {0xE9}, 0x100);
+    write_rel32(code, 0x30, {0x0F, 0x84}, 0x200);
+    write_rel32(code, 0x41, {0x48, 0x8D, 0x05}, 0x200);
+    write_rel32(code, 0x3F0, {0x4C, 0x8D, 0x0D}, 0x300);
+    write_rel32(code, 0x60, {0xE8}, 0x1000);
+    write_rel32(code, 0x70, {0x8D, 0x05}, 0x300);
 
-    CHECK_NOTHROW(check_unescape_string(R"(\x123456!)", "V!", 2, false));
-    CHECK_NOTHROW(check_unescape_string(R"(\567ABC)", "wABC", 4, false));
-    CHECK_NOTHROW(check_unescape_string(R"(\xz)", "\0z", 2, false));
-    CHECK_NOTHROW(check_unescape_string(R"(\yz)", "yz", 2, false));
+    code[0x3FD] = 0xE8;
 
-    CHECK_NOTHROW(check_unescape_string(R"(\x123456)", "", 0, true));
-    CHECK_NOTHROW(check_unescape_string(R"(\567ABC)", "", 0, true));
-    CHECK_NOTHROW(check_unescape_string(R"(\xz)", "", 0, true));
-    CHECK_NOTHROW(check_unescape_string(R"(\yz)", "", 0, true));
+    mem::region range(code.data(), code.size());
+    mem::xref_index index(range);
+
+    REQUIRE(index.size() == 5);
+
+    const mem::slice<const mem::xref> calls = index.find(range.start.add(0x100));
+
+    REQUIRE(calls.size() == 2);
+    REQUIRE(calls[0].source == range.start.add(0x10));
+    REQUIRE(calls[0].kind == mem::xref_kind::call);
+    REQUIRE(calls[1].source == range.start.add(0x20));
+    REQUIRE(calls[1].kind == mem::xref_kind::jump);
+
+    const mem::slice<const mem::xref> data_refs = index.find(mem::region(range.start.add(0x200), 0x101));
+
+    REQUIRE(data_refs.size() == 3);
+    REQUIRE(data_refs[0].kind == mem::xref_kind::conditional_jump);
+    REQUIRE(data_refs[1].source == range.start.add(0x41));
+    REQUIRE(data_refs[1].kind == mem::xref_kind::lea);
+    REQUIRE(data_refs[2].target == range.start.add(0x300));
+    REQUIRE(data_refs[2].source == range.start.add(0x3F0));
+
+    REQUIRE(index.find(range.start.add(0x101)).empty());
+    REQUIRE(mem::xref_index(range, mem::region(range.start.add(0x100), 1)).size() == 2);
 }
 
-#if defined(_MSC_VER)
-# pragma warning(pop)
-#endif
+TEST_CASE("mem::string_reference_resolver")
+{
+    std::vector<uint8_t> image(0x400, 0x90);
 
-void check_prot_flags_roundtrip(mem::prot_flags flags)
+    const char* const strings[] {"first string", "second", "unused"};
+    std::copy_n(strings[0], std::strlen(strings[0]) + 1, image.begin() + 0x200);
+    std::copy_n(strings[1], std::strlen(strings[1]) + 1, image.begin() + 0x280);
+    std::copy_n("second!", 8, image.begin() + 0x300);
+
+    write_rel32(image, 0x10, {0x48, 0x8D, 0x05}, 0x200);
+    write_rel32(image, 0x20, {0x48, 0x8D, 0x0D}, 0x280);
+    write_rel32(image, 0x30, {0x4C, 0x8D, 0x05}, 0x200);
+    write_rel32(image, 0x40, {0x48, 0x8D, 0x15}, 0x300);
+
+    const mem::region code(image.data(), 0x100);
+    const mem::region data(image.data() + 0x100, 0x300);
+
+    mem::string_reference_resolver resolver({strings[0], strings[1], strings[2]});
+
+    REQUIRE(resolver.size() == 3);
+
+    const std::vector<std::pair<mem::pointer, size_t>> found = resolver.find_strings(data);
+
+    REQUIRE(found.size() == 2);
+    REQUIRE(found[0] == std::make_pair(mem::pointer(image.data() + 0x200), size_t(0)));
+    REQUIRE(found[1] == std::make_pair(mem::pointer(image.data() + 0x280), size_t(1)));
+
+    const std::vector<mem::string_reference> refs = resolver.find_references(code, found);
+
+    REQUIRE(refs.size() == 3);
+    REQUIRE(refs[0].index == 0);
+    REQUIRE(refs[0].source == code.start.add(0x10));
+    REQUIRE(refs[1].index == 0);
+    REQUIRE(refs[1].source == code.start.add(0x30));
+    REQUIRE(refs[2].index == 1);
+    REQUIRE(refs[2].string == data.start.add(0x180));
+    REQUIRE(refs[2].kind == mem::xref_kind::lea);
+    REQUIRE(refs[0].function.size == 0);
+
+    const mem::function_index functions({mem::region(code.start, 0x18), mem::region(code.start.add(0x18), 0x10)});
+    const std::vector<mem::string_reference> func_refs = resolver.find_references(code, found, &functions);
+
+    REQUIRE(func_refs.size() == 3);
+    REQUIRE(func_refs[0].function == mem::region(code.start, 0x18));
+    REQUIRE(func_refs[1].function.size == 0);
+    REQUIRE(func_refs[2].function == mem::region(code.start.add(0x18), 0x10));
+
+    REQUIRE(resolver.find_references(code, {}).empty());
+
+    static const char self_string[] = "mem::string_reference_resolver self test";
+    mem::string_reference_resolver self_resolver({self_string});
+
+    const std::vector<std::pair<mem::pointer, size_t>> self_found = self_resolver.find_strings(mem::module::self());
+
+    REQUIRE(std::find(self_found.begin(), self_found.end(), std::make_pair(mem::pointer(self_string), size_t(0))) != self_found.end());
+}
+
+TEST_CASE("mem::function_index")
 {
-    mem::prot_flags new_flags = mem::to_prot_flags(mem::from_prot_flags(flags));
+    std::vector<uint8_t> code(0x100, 0xCC);
 
-    REQUIRE(flags == new_flags);
+    code[0x18] = 0xAB;
+    code[0x48] = 0xAB;
+    code[0x70] = 0xAB;
+
+    const mem::region range(code.data(), code.size());
+    const mem::region first(range.start.add(0x10), 0x20);
+    const mem::region second(range.start.add(0x40), 0x20);
+
+    mem::function_index index({second, first, mem::region(range.start.add(0x80), 0)});
+
+    REQUIRE(index.size() == 2);
+    REQUIRE(index.functions()[0] == first);
+    REQUIRE(index.functions()[1] == second);
+
+    REQUIRE(index.function_containing(range.start.add(0x10)) == first);
+    REQUIRE(index.function_containing(range.start.add(0x2F)) == first);
+    REQUIRE(index.function_containing(range.start.add(0x30)) == mem::region());
+    REQUIRE(index.function_containing(range.start.add(0x5F)) == second);
+    REQUIRE(index.function_containing(range.start.add(0x05)) == mem::region());
+
+    REQUIRE(index.functions_in(mem::region(range.start.add(0x20), 0x30)).size() == 2);
+    REQUIRE(index.functions_in(mem::region(range.start.add(0x30), 0x10)).empty());
+    REQUIRE(index.functions_in(range).size() == 2);
+
+    mem::pattern pattern("AB");
+    mem::default_scanner scanner(pattern);
+
+    std::vector<std::pair<mem::region, mem::pointer>> matches;
+
+    index.scan(scanner, range, [&matches](mem::region function, mem::pointer address) {
+        matches.emplace_back(function, address);
+
+        return false;
+    });
+
+    REQUIRE(matches.size() == 2);
+    REQUIRE(matches[0] == std::make_pair(first, range.start.add(0x18)));
+    REQUIRE(matches[1] == std::make_pair(second, range.start.add(0x48)));
+
+#if defined(__unix__) || defined(MEM_ARCH_X86_64)
+    mem::function_index self(mem::module::self());
+
+    REQUIRE(self.size() != 0);
+
+    const mem::pointer function = &write_rel32;
+
+    REQUIRE(self.function_containing(function).start == function);
+#endif
 }
 
-TEST_CASE("mem::prot_flags")
+TEST_CASE("mem::value_scanner")
 {
-    CHECK_NOTHROW(check_prot_flags_roundtrip(mem::prot_flags::NONE));
-    CHECK_NOTHROW(check_prot_flags_roundtrip(mem::prot_flags::R));
-    CHECK_NOTHROW(check_prot_flags_roundtrip(mem::prot_flags::RW));
-    CHECK_NOTHROW(check_prot_flags_roundtrip(mem::prot_flags::RX));
-    CHECK_NOTHROW(check_prot_flags_roundtrip(mem::prot_flags::RWX));
+    std::vector<int32_t> values(0x20007, 0);
+
+    values[5] = 42;
+    values[0x100] = 42;
+    values[0x12345] = 42;
+    values.back() = 42;
+
+    const std::vector<mem::region> ranges {mem::region(values.data(), values.size() * sizeof(int32_t))};
+
+    mem::value_scanner<int32_t> scanner;
+
+    REQUIRE(scanner.first_scan(ranges, mem::scan_op::equal, 42) == 4);
+    REQUIRE(scanner.results() ==
+        std::vector<mem::pointer> {&values[5], &values[0x100], &values[0x12345], &values.back()});
+    REQUIRE(scanner.results(1).size() == 1);
+    REQUIRE(scanner.memory_usage() < ranges[0].size / 64);
+
+    values[5] = 43;
+    values[0x100] = 41;
+
+    REQUIRE(scanner.next_scan(mem::scan_op::changed) == 2);
+
+    values[5] = 50;
+
+    REQUIRE(scanner.next_scan(mem::scan_op::increased) == 1);
+    REQUIRE(scanner.next_scan(mem::scan_op::unchanged) == 1);
+
+    scanner.enum_results([&values](mem::pointer address, int32_t value) {
+        REQUIRE(address == &values[5]);
+        REQUIRE(value == 50);
+    });
+
+    REQUIRE(scanner.first_scan(ranges, mem::scan_op::equal, 0) == values.size() - 4);
+    REQUIRE(scanner.memory_usage() < ranges[0].size / 16);
+    REQUIRE(scanner.first_scan(ranges, mem::scan_op::between, 41, 42) == 3);
+    REQUIRE(scanner.next_scan(mem::scan_op::less, 42) == 1);
+    REQUIRE(scanner.results() == std::vector<mem::pointer> {&values[0x100]});
+    REQUIRE(scanner.first_scan(ranges, mem::scan_op::changed) == 0);
+
+    std::vector<uint8_t> bytes(100, 0);
+    const int16_t needle = 0x1234;
+    std::memcpy(&bytes[3], &needle, sizeof(needle));
+
+    mem::value_scanner<int16_t> unaligned(1);
+
+    REQUIRE(unaligned.first_scan({mem::region(bytes.data(), bytes.size())}, mem::scan_op::equal, needle) == 1);
+    REQUIRE(unaligned.results()[0] == &bytes[3]);
+
+    std::vector<float> floats(1000, 1.0f);
+    floats[10] = 2.5f;
+
+    mem::value_scanner<float> float_scanner;
+
+    REQUIRE(float_scanner.first_scan({mem::region(floats.data(), floats.size() * sizeof(float))},
+                mem::scan_op::between, 2.0f, 3.0f) == 1);
+
+    floats[10] = 2.0f;
+
+    REQUIRE(float_scanner.next_scan(mem::scan_op::decreased) == 1);
+
+    const std::vector<mem::region> readable = mem::readable_regions();
+    const int local = 0;
+
+    REQUIRE(std::any_of(readable.begin(), readable.end(), [&](const mem::region& range) { return range.contains(&local); }));
+    REQUIRE(std::any_of(readable.begin(), readable.end(), [&](const mem::region& range) { return range.contains(floats.data()); }));
 }
+
+TEST_CASE("mem::value_scanner ops")
+{
+    std::vector<float> values(333);
+
+    uint32_t seed = 5;
+
+    const auto next = [&seed] {
+        seed = (seed * 1664525) + 1013904223;
+
+        return static_cast<float>(seed >> 28);
+    };
+
+    for (float& value : values)
+        value = next();
+
+    const std::vector<mem::region> ranges {mem::region(values.data(), values.size() * sizeof(float))};
+
+    const auto expected = [](const std::vector<float>& current, const std::vector<float>& previous, size_t stride,
+                              bool (*test)(float, float)) {
+        size_t count = 0;
+
+        for (size_t i = 0; i < current.size(); i += stride)
+            count += test(current[i], previous[i]);
+
+        return count;
+    };
+
+    for (size_t stride : {size_t(1), size_t(3)})
+    {
+        mem::value_scanner<float> scanner(stride * sizeof(float));
+
+        REQUIRE(scanner.first_scan(ranges, mem::scan_op::equal, 7.0f) == expected(values, values, stride, [](float v, float) { return v == 7.0f; }));
+        REQUIRE(scanner.first_scan(ranges, mem::scan_op::not_equal, 7.0f) == expected(values, values, stride, [](float v, float) { return v != 7.0f; }));
+        REQUIRE(scanner.first_scan(ranges, mem::scan_op::less, 7.0f) == expected(values, values, stride, [](float v, float) { return v < 7.0f; }));
+        REQUIRE(scanner.first_scan(ranges, mem::scan_op::greater, 7.0f) == expected(values, values, stride, [](float v, float) { return v > 7.0f; }));
+        REQUIRE(scanner.first_scan(ranges, mem::scan_op::between, 3.0f, 9.0f) == expected(values, values, stride, [](float v, float) { return (v >= 3.0f) && (v <= 9.0f); }));
+
+        REQUIRE(scanner.first_scan(ranges, mem::scan_op::not_equal, -1.0f) == (values.size() + stride - 1) / stride);
+
+        std::vector<float> previous = values;
+
+        for (float& value : values)
+            value = next();
+
+        REQUIRE(scanner.next_scan(mem::scan_op::increased) == expected(values, previous, stride, [](float v, float p) { return v > p; }));
+
+        scanner.enum_results([&](mem::pointer address, float value) { REQUIRE(*address.as<const float*>() == value); });
+
+        REQUIRE(scanner.first_scan(ranges, mem::scan_op::not_equal, -1.0f) == (values.size() + stride - 1) / stride);
+
+        previous = values;
+
+        for (size_t i = 0; i < values.size(); i += 5)
+            values[i] += 1.0f;
+
+        REQUIRE(scanner.next_scan(mem::scan_op::changed) == expected(values, previous, stride, [](float v, float p) { return v != p; }));
+        REQUIRE(scanner.next_scan(mem::scan_op::unchanged) == expected(values, previous, stride, [](float v, float p) { return v != p; }));
+
+        REQUIRE(scanner.first_scan(ranges, mem::scan_op::not_equal, -1.0f) == (values.size() + stride - 1) / stride);
+
+        previous = values;
+
+        for (float& value : values)
+            value = next();
+
+        REQUIRE(scanner.next_scan(mem::scan_op::decreased) == expected(values, previous, stride, [](float v, float p) { return v < p; }));
+    }
+}
+
+TEST_CASE("mem::pointer_map")
+{
+    std::vector<uintptr_t> statics(16);
+    std::vector<uintptr_t> first(8);
+    std::vector<uintptr_t> second(8);
+
+    const mem::pointer target = &second[5];
+
+    statics[2] = reinterpret_cast<uintptr_t>(&first[0]);
+    statics[5] = reinterpret_cast<uintptr_t>(&second[4]);
+    first[3] = reinterpret_cast<uintptr_t>(&second[1]);
+    second[0] = reinterpret_cast<uintptr_t>(&first[0]);
+
+    const mem::region static_range(statics.data(), statics.size() * sizeof(uintptr_t));
+    const mem::region first_range(first.data(), first.size() * sizeof(uintptr_t));
+    const mem::region second_range(second.data(), second.size() * sizeof(uintptr_t));
+
+    mem::pointer_map map({static_range, first_range, second_range}, {first_range, second_range});
+
+    REQUIRE(map.size() == 4);
+
+    std::vector<mem::pointer> sources;
+
+    map.find_sources(&first[0], 0, [&sources](mem::pointer source, mem::pointer) { sources.push_back(source); });
+
+    REQUIRE(sources.size() == 2);
+    REQUIRE(std::count(sources.begin(), sources.end(), &statics[2]) == 1);
+    REQUIRE(std::count(sources.begin(), sources.end(), &second[0]) == 1);
+
+    const std::vector<mem::pointer_path> paths = map.find_paths(target, {static_range}, 3, 64);
+
+    REQUIRE(paths.size() == 2);
+    REQUIRE(paths[0].base == &statics[5]);
+    REQUIRE(paths[0].offsets == std::vector<size_t> {8});
+    REQUIRE(paths[1].base == &statics[2]);
+    REQUIRE(paths[1].offsets == std::vector<size_t> {24, 32});
+
+    for (const mem::pointer_path& path : paths)
+    {
+        mem::pointer address = path.base;
+
+        for (size_t offset : path.offsets)
+            address = address.as<mem::pointer&>().add(offset);
+
+        REQUIRE(address == target);
+    }
+
+    REQUIRE(map.find_paths(target, {static_range}, 1, 64).size() == 1);
+    REQUIRE(map.find_paths(target, {static_range}, 3, 16).size() == 1);
+    REQUIRE(map.find_paths(target, {static_range}, 3, 64, 1).size() == 1);
+    REQUIRE(map.find_paths(target, {static_range}, 0, 64).empty());
+
+    REQUIRE(!mem::pointer_map::static_ranges(mem::module::self()).empty());
+}
+
+struct pointer_map_node
+{
+    uintptr_t padding[3];
+    uintptr_t* field;
+};
+
+static pointer_map_node* pointer_map_root = nullptr;
+
+// AddressSanitizer's shadow memory is mapped writable, but faults when read through instrumented code
+#if defined(__SANITIZE_ADDRESS__)
+#    define MEM_TEST_ASAN
+#elif defined(__has_feature)
+#    if __has_feature(address_sanitizer)
+#        define MEM_TEST_ASAN
+#    endif
+#endif
+
+TEST_CASE("mem::pointer_map snapshot")
+{
+    std::unique_ptr<uintptr_t[]> values(new uintptr_t[4]());
+    std::unique_ptr<pointer_map_node> node(new pointer_map_node());
+
+    node->field = values.get();
+    pointer_map_root = node.get();
+
+    const auto contains = [](const std::vector<mem::region>& regions, mem::pointer address) {
+        return std::any_of(
+            regions.begin(), regions.end(), [address](const mem::region& range) { return range.contains(address); });
+    };
+
+    const std::vector<mem::region> writable = mem::readable_regions(mem::prot_flags::RW);
+
+    REQUIRE(contains(writable, &pointer_map_root));
+    REQUIRE(contains(writable, node.get()));
+    REQUIRE(!contains(writable, mem::pointer(&mem::pointer_map::snapshot)));
+    REQUIRE(contains(mem::readable_regions(), mem::pointer(&mem::pointer_map::snapshot)));
+
+#if !defined(MEM_TEST_ASAN)
+    const mem::pointer target = &values[1];
+    const mem::pointer_map map = mem::pointer_map::snapshot();
+    const std::vector<mem::pointer_path> paths =
+        map.find_paths(target, mem::pointer_map::static_ranges(mem::module::self()), 2, 64);
+
+    const auto found = std::find_if(
+        paths.begin(), paths.end(), [](const mem::pointer_path& path) { return path.base == &pointer_map_root; });
+
+    REQUIRE(found != paths.end());
+    REQUIRE(found->offsets == std::vector<size_t> {offsetof(pointer_map_node, field), sizeof(uintptr_t)});
+#endif
+
+    pointer_map_root = nullptr;
+}
+
+TEST_CASE("mem::region_snapshot")
+{
+    const size_t page_size = mem::page_size();
+    const size_t size = page_size * 16;
+
+    uint8_t* data = static_cast<uint8_t*>(mem::protect_alloc(size, mem::prot_flags::RW));
+    REQUIRE(data != nullptr);
+
+    std::memset(data, 0xAA, size);
+
+    mem::region_snapshot snapshot(mem::region(data, size));
+
+    REQUIRE(snapshot.update().empty());
+
+    std::memset(data + (page_size * 3) + 100, 0, 4);
+    data[page_size * 10] = 1;
+    data[(page_size * 12) - 1] = 1;
+    data[page_size * 12] = 1;
+
+    REQUIRE(snapshot.update() ==
+        std::vector<mem::region> {mem::region(data + (page_size * 3) + 100, 4), mem::region(data + (page_size * 10), 1),
+            mem::region(data + (page_size * 12) - 1, 2)});
+    REQUIRE(snapshot.update().empty());
+    REQUIRE(std::memcmp(snapshot.data(), data, size) == 0);
+
+    mem::region_snapshot partial(mem::region(data + 10, page_size * 2));
+
+    data[5] = 7;
+    data[12] = 7;
+    data[10 + (page_size * 2)] = 7;
+
+    REQUIRE(partial.update() == std::vector<mem::region> {mem::region(data + 12, 1)});
+
+    // Updating another snapshot resets the soft-dirty bits, so this one has to compare every page
+    data[page_size * 15] = 3;
+
+    REQUIRE(partial.update().empty());
+    REQUIRE(!snapshot.tracking());
+    REQUIRE(snapshot.update() == std::vector<mem::region> {mem::region(data + 5, 1),
+        mem::region(data + 12, 1), mem::region(data + 10 + (page_size * 2), 1), mem::region(data + (page_size * 15), 1)});
+
+    mem::region_snapshot_group group;
+    group.add(snapshot);
+    group.add(partial);
+    group.add(snapshot);
+
+    REQUIRE(group.size() == 2);
+
+    std::vector<std::pair<const mem::region_snapshot*, mem::region>> changes;
+    const auto record = [&changes](const mem::region_snapshot& owner, mem::region changed) {
+        changes.emplace_back(&owner, changed);
+    };
+
+    group.update(record);
+
+    // Both snapshots are updated from the same reset, so they keep tracking together
+    REQUIRE(snapshot.tracking() == partial.tracking());
+#if defined(__linux__)
+    if (mem::internal::soft_dirty_supported())
+        REQUIRE(snapshot.tracking());
+#endif
+
+    data[page_size] = 9;
+    data[page_size * 14] = 9;
+    changes.clear();
+    group.update(record);
+
+    REQUIRE(changes.size() == 3);
+    REQUIRE(changes[0] == std::make_pair(static_cast<const mem::region_snapshot*>(&snapshot), mem::region(data + page_size, 1)));
+    REQUIRE(changes[1] == std::make_pair(static_cast<const mem::region_snapshot*>(&snapshot), mem::region(data + (page_size * 14), 1)));
+    REQUIRE(changes[2] == std::make_pair(static_cast<const mem::region_snapshot*>(&partial), mem::region(data + page_size, 1)));
+    REQUIRE(snapshot.tracking() == partial.tracking());
+#if defined(__linux__)
+    if (mem::internal::soft_dirty_supported())
+        REQUIRE(snapshot.tracking());
+#endif
+
+    group.remove(partial);
+    REQUIRE(group.size() == 1);
+
+    mem::protect_free(data, size);
+}
+
+TEST_CASE("mem::scan_resident")
+{
+    const size_t page_size = mem::page_size();
+    const size_t size = page_size * 64;
+
+    uint8_t* data = static_cast<uint8_t*>(mem::protect_alloc(size, mem::prot_flags::RW));
+    REQUIRE(data != nullptr);
+
+    const mem::region range(data, size);
+
+    data[0] = 0x11;
+    data[(page_size * 10) + 100] = 0x11;
+    data[(page_size * 12) - 2] = 0x55;
+    data[(page_size * 12) - 1] = 0x66;
+    data[page_size * 40] = 0x77;
+    data[(page_size * 40) + 1] = 0x88;
+
+    const std::vector<mem::region> resident {mem::region(data, page_size),
+        mem::region(data + (page_size * 10), page_size * 2), mem::region(data + (page_size * 40), page_size)};
+
+    REQUIRE(mem::resident_regions(range) == resident);
+
+    mem::pattern crossing_after("55 66 00 00");
+    mem::default_scanner after_scanner(crossing_after);
+
+    REQUIRE(mem::scan_resident_all(after_scanner, range) == std::vector<mem::pointer> {data + (page_size * 12) - 2});
+
+    mem::pattern crossing_before("00 00 77 88");
+    mem::default_scanner before_scanner(crossing_before);
+
+    REQUIRE(mem::scan_resident_all(before_scanner, range) == std::vector<mem::pointer> {data + (page_size * 40) - 2});
+    REQUIRE(mem::scan_resident_all(before_scanner, mem::region(data + (page_size * 40) - 1, page_size)).empty());
+
+    mem::pattern inside("11 00 00");
+    mem::default_scanner inside_scanner(inside);
+
+    REQUIRE(mem::scan_resident_all(inside_scanner, range) ==
+        std::vector<mem::pointer> {data, data + (page_size * 10) + 100});
+
+    // None of the zero pages were touched by the scans
+    REQUIRE(mem::resident_regions(range) == resident);
+
+    mem::pattern zeros("00 00");
+    mem::default_scanner zero_scanner(zeros);
+
+    REQUIRE(mem::scan_resident(zero_scanner, range, [](mem::pointer) { return true; }) == data + 1);
+
+    mem::protect_free(data, size);
+}
+
+TEST_CASE("mem::resumable_scan")
+{
+    std::vector<uint8_t> data(0x40000);
+
+    for (size_t i = 0; i < data.size(); ++i)
+        data[i] = static_cast<uint8_t>((i * 7) ^ (i >> 5));
+
+    const size_t offsets[] {0, 998, 1999, 2003, 0x1FFFE, data.size() - 4};
+
+    for (size_t offset : offsets)
+        std::copy_n("\xDE\xAD\xBE\xEF", 4, data.begin() + static_cast<std::ptrdiff_t>(offset));
+
+    const mem::region range(data.data(), data.size());
+
+    mem::pattern pattern("DE AD BE EF");
+    mem::default_scanner scanner(pattern);
+
+    const std::vector<mem::pointer> expected = scanner.scan_all(range);
+
+    REQUIRE(expected.size() == 6);
+
+    mem::resumable_scan<mem::default_scanner> bytes(scanner, range);
+
+    REQUIRE(bytes.progress() == 0.0);
+
+    size_t steps = 0;
+
+    for (double last = 0.0; !bytes.step(1000); ++steps)
+    {
+        REQUIRE(bytes.progress() > last);
+        last = bytes.progress();
+    }
+
+    REQUIRE(steps == (data.size() - 4) / 1000);
+    REQUIRE(bytes.results() == expected);
+    REQUIRE(bytes.progress() == 1.0);
+    REQUIRE(!bytes.cancelled());
+    REQUIRE(bytes.step(1000));
+
+    mem::resumable_scan<mem::default_scanner> timed(scanner, range);
+
+    while (!timed.step(std::chrono::microseconds(200)))
+        continue;
+
+    REQUIRE(timed.results() == expected);
+
+    mem::resumable_scan<mem::default_scanner> stopped(scanner, range);
+
+    std::vector<mem::pointer> found;
+
+    REQUIRE(stopped.step(data.size(), [&found](mem::pointer address) {
+        found.push_back(address);
+
+        return found.size() == 3;
+    }));
+    REQUIRE(stopped.cancelled());
+    REQUIRE(found == std::vector<mem::pointer>(expected.begin(), expected.begin() + 3));
+    REQUIRE(stopped.position() == expected[2] + 1);
+
+    mem::resumable_scan<mem::default_scanner> cancelled(scanner, range);
+
+    REQUIRE(!cancelled.step(0x100));
+    cancelled.cancel();
+    REQUIRE(cancelled.done());
+    REQUIRE(cancelled.step(0x100));
+    REQUIRE(cancelled.position() == range.start.add(0x100));
+
+    mem::resumable_scan<mem::default_scanner> empty(scanner, mem::region(data.data(), 3));
+
+    REQUIRE(empty.done());
+    REQUIRE(empty.progress() == 1.0);
+}
+
+#if defined(__cpp_impl_coroutine) && (__cpp_impl_coroutine >= 201902L)
+# include <deque>
+# include <exception>
+# include <functional>
+
+struct queue_executor
+{
+    std::deque<std::function<void()>>* queue;
+
+    void execute(std::function<void()> func) const
+    {
+        queue->push_back(std::move(func));
+    }
+};
+
+struct detached_task
+{
+    struct promise_type
+    {
+        detached_task get_return_object() noexcept { return {}; }
+        std::suspend_never initial_suspend() noexcept { return {}; }
+        std::suspend_never final_suspend() noexcept { return {}; }
+        void return_void() noexcept {}
+        void unhandled_exception() { std::terminate(); }
+    };
+};
+
+detached_task run_async_scan(queue_executor executor, mem::default_scanner scanner, mem::region range, std::vector<mem::pointer>& results, bool& finished)
+{
+    results = co_await mem::async_scan(executor, scanner, range, 0x1000);
+    finished = true;
+}
+
+TEST_CASE("mem::async_scan")
+{
+    std::vector<uint8_t> data(0x10000);
+
+    for (size_t offset : {size_t(0x10), size_t(0xFFE), size_t(0x8000), data.size() - 2})
+    {
+        data[offset] = 0x12;
+        data[offset + 1] = 0x34;
+    }
+
+    const mem::region range(data.data(), data.size());
+
+    mem::pattern pattern("12 34");
+    mem::default_scanner scanner(pattern);
+
+    std::deque<std::function<void()>> queue;
+    std::vector<mem::pointer> results;
+    bool finished = false;
+
+    run_async_scan({&queue}, scanner, range, results, finished);
+
+    REQUIRE(!finished);
+
+    size_t steps = 0;
+
+    for (; !queue.empty(); ++steps)
+    {
+        std::function<void()> func = std::move(queue.front());
+        queue.pop_front();
+        func();
+    }
+
+    REQUIRE(finished);
+    REQUIRE(steps == 16);
+    REQUIRE(results == scanner.scan_all(range));
+    REQUIRE(results.size() == 4);
+}
+#endif
+
+TEST_CASE("mem::init_task")
+{
+    static std::atomic<int> counter {0};
+    static int started[8] {};
+    static int finished[8] {};
+
+#define TASK(INDEX) [] {                                            \
+        started[INDEX] = counter.load();                            \
+        std::this_thread::sleep_for(std::chrono::milliseconds(2));  \
+        finished[INDEX] = ++counter;                                \
+    }
+
+    mem::init_task* root = nullptr;
+
+    mem::init_task a(root, "a", TASK(0));
+    mem::init_task b(root, "b", TASK(1));
+    mem::init_task c(root, "c", TASK(2), {"a", "b"});
+    mem::init_task d(root, "d", TASK(3), {"c"});
+    mem::init_task e(root, "e", TASK(4));
+    mem::init_task f(root, "f", TASK(5), {"g"});
+    mem::init_task g(root, "g", TASK(6), {"f"});
+    mem::init_task h(root, "h", TASK(7), {"missing"});
+
+#undef TASK
+
+    const mem::init_report report = mem::init_task::run(4, root);
+
+    REQUIRE(root == nullptr);
+    REQUIRE(report.thread_count == 4);
+    REQUIRE(report.timings.size() == 8);
+
+    for (int i = 0; i < 8; ++i)
+        REQUIRE(finished[i] != 0);
+
+    REQUIRE(started[2] >= std::max(finished[0], finished[1]));
+    REQUIRE(started[3] >= finished[2]);
+
+    for (size_t i = 1; i < report.timings.size(); ++i)
+        REQUIRE(report.timings[i - 1].duration >= report.timings[i].duration);
+
+    REQUIRE(report.wall_time >= report.timings[0].duration);
+
+    std::FILE* output = std::tmpfile();
+    REQUIRE(output != nullptr);
+
+    report.print(output, 3);
+    REQUIRE(std::ftell(output) > 0);
+
+    std::fclose(output);
+
+    REQUIRE(mem::init_task::run(4, root).timings.empty());
+}
+
+#if defined(MEM_SCAN_STATS)
+TEST_CASE("mem::scan_stats")
+{
+    std::vector<uint8_t> data(0x4000, 0x12);
+
+    for (size_t offset : {size_t(0x100), size_t(0x2000), size_t(0x3F00)})
+    {
+        data[offset] = 0x12;
+        data[offset + 1] = 0x34;
+        data[offset + 2] = 0x56;
+    }
+
+    data[0x1001] = 0x44;
+    data[0x1002] = 0x56;
+
+    const mem::region range(data.data(), data.size());
+
+    mem::pattern pattern("12 34 56");
+    mem::pattern masked("12 3? 56");
+
+    mem::scan_stats_collector collector;
+    mem::set_scan_stats_sink(&collector);
+
+    REQUIRE(mem::simd_scanner(pattern).scan_all(range).size() == 3);
+    REQUIRE(mem::boyer_moore_scanner(pattern, 1, 1).scan_all(range).size() == 3);
+    REQUIRE(mem::simd_scanner(masked).scan_all(range).size() == 3);
+
+    mem::pattern_cache cache(range);
+    REQUIRE(cache.scan_all(pattern).size() == 3);
+    REQUIRE(cache.scan_all(pattern).size() == 3);
+
+    mem::set_scan_stats_sink(nullptr);
+
+    // Not recorded
+    mem::simd_scanner(pattern).scan(range);
+
+    const std::vector<mem::scan_stats_collector::entry> entries = collector.entries();
+    REQUIRE(entries.size() == 4);
+
+    for (size_t i = 1; i < entries.size(); ++i)
+        REQUIRE(entries[i - 1].stats.cycles >= entries[i].stats.cycles);
+
+    const auto find = [&](const char* scanner, const mem::pattern& pat) {
+        for (const auto& entry : entries)
+        {
+            if (entry.scanner == scanner && entry.pattern == pat.to_string())
+                return entry.stats;
+        }
+
+        FAIL("Missing entry");
+        return mem::scan_stats();
+    };
+
+    const mem::scan_stats simd = find("simd_scanner", pattern);
+    REQUIRE(simd.scans == 8);
+    REQUIRE(simd.matches == 6);
+    REQUIRE(simd.bytes_scanned > 0);
+    REQUIRE(simd.anchor_hits >= simd.matches);
+
+    const mem::scan_stats boyer_moore = find("boyer_moore_scanner", pattern);
+    REQUIRE(boyer_moore.scans == 4);
+    REQUIRE(boyer_moore.matches == 3);
+    REQUIRE(boyer_moore.anchor_hits == boyer_moore.matches + boyer_moore.verify_failures);
+
+    const mem::scan_stats simd_masked = find("simd_scanner", masked);
+    REQUIRE(simd_masked.matches == 3);
+    REQUIRE(simd_masked.verify_failures > 0);
+
+    const mem::scan_stats cached = find("pattern_cache", pattern);
+    REQUIRE(cached.scans == 2);
+    REQUIRE(cached.cache_hits == 1);
+    REQUIRE(cached.cache_misses == 1);
+    REQUIRE(cached.matches == 6);
+
+    std::ostringstream json;
+    collector.write_json(json);
+    REQUIRE(json.str().find("\"scanner\":\"boyer_moore_scanner\"") != std::string::npos);
+    REQUIRE(json.str().find("\"cache_hits\":1") != std::string::npos);
+
+    std::ostringstream csv;
+    collector.write_csv(csv);
+    const std::string lines = csv.str();
+    REQUIRE(std::count(lines.begin(), lines.end(), '\n') == 5);
+
+    collector.clear();
+    REQUIRE(collector.entries().empty());
+
+    // Dense matches are returned from pending lanes, behind where the scan resumes
+    std::vector<uint8_t> dense(0x1000);
+
+    for (size_t i = 0; i < dense.size(); ++i)
+        dense[i] = (i & 1) ? 0x42 : 0x41;
+
+    mem::set_scan_stats_sink(&collector);
+    REQUIRE(mem::simd_scanner(mem::pattern("41 42")).scan_all({dense.data(), dense.size()}).size() == 0x800);
+    mem::set_scan_stats_sink(nullptr);
+
+    REQUIRE(collector.entries().size() == 1);
+    REQUIRE(collector.entries()[0].stats.matches == 0x800);
+    REQUIRE(collector.entries()[0].stats.bytes_scanned <= dense.size());
+}
+#endif
+
+TEST_CASE("mem::teddy_scanner")
+{
+    size_t page_size = mem::page_size();
+
+    size_t raw_size = page_size * (2 + 2); // 2 Pages + Guard Page Before/After
+    uint8_t* raw_data = static_cast<uint8_t*>(mem::protect_alloc(raw_size, mem::prot_flags::RW));
+
+    mem::protect_modify(raw_data, page_size, mem::prot_flags::NONE);
+    mem::protect_modify(raw_data + raw_size - page_size, page_size, mem::prot_flags::NONE);
+
+    mem::region scan_region(raw_data + page_size, raw_size - (2 * page_size));
+    uint8_t* data = scan_region.start.as<uint8_t*>();
+
+    uint32_t seed = 1;
+
+    for (size_t i = 0; i < scan_region.size; ++i)
+    {
+        seed = (seed * 1664525) + 1013904223;
+        data[i] = static_cast<uint8_t>(seed >> 24);
+    }
+
+    const mem::pattern patterns[] {
+        mem::pattern("DE AD BE EF"),
+        mem::pattern("? ? 48 8B 05 ? ? ? ? C3"),
+        mem::pattern("E8 ?? ?? ?? ?? 90"),
+        mem::pattern("01 ?2 3? 45"),
+        mem::pattern("CC CC"),
+        mem::pattern("40 53 48 83 EC 20"),
+        mem::pattern("F0 0F"),
+        mem::pattern("55 48 89 E5 41 57 41 56"),
+        mem::pattern("AB"),
+        mem::pattern(""),
+    };
+
+    const uint8_t planted[][10] {
+        {0xDE, 0xAD, 0xBE, 0xEF},
+        {0x11, 0x22, 0x48, 0x8B, 0x05, 0x00, 0x00, 0x00, 0x00, 0xC3},
+        {0xE8, 0x10, 0x20, 0x30, 0x40, 0x90},
+        {0x01, 0x52, 0x37, 0x45},
+    };
+
+    memcpy(data + 100, planted[0], 4);
+    memcpy(data + 1000, planted[1], 10);
+    memcpy(data + page_size - 3, planted[2], 6);
+    memcpy(data + 3000, planted[3], 4);
+    memcpy(data + scan_region.size - 4, planted[0], 4);
+
+    std::vector<const mem::pattern*> pattern_list;
+
+    for (const mem::pattern& pattern : patterns)
+        pattern_list.push_back(&pattern);
+
+    mem::teddy_scanner scanner(pattern_list);
+
+    std::vector<std::pair<mem::pointer, size_t>> expected;
+
+    for (size_t i = 0; i < pattern_list.size(); ++i)
+    {
+        for (mem::pointer result : mem::simd_scanner(*pattern_list[i]).scan_all(scan_region))
+            expected.emplace_back(result, i);
+    }
+
+    std::sort(expected.begin(), expected.end());
+
+    REQUIRE(expected.size() > 20);
+    REQUIRE(scanner.scan_all(scan_region) == expected);
+
+    for (size_t i = 1; i < 16; ++i)
+    {
+        mem::region sub_region(scan_region.start.add(i), scan_region.size - (i * 2));
+
+        std::vector<std::pair<mem::pointer, size_t>> sub_expected;
+
+        for (const auto& result : expected)
+        {
+            if (sub_region.contains(result.first, pattern_list[result.second]->size()))
+                sub_expected.push_back(result);
+        }
+
+        REQUIRE(scanner.scan_all(sub_region) == sub_expected);
+    }
+
+    const mem::pointer first = scanner.scan(scan_region, [](mem::pointer, size_t index) { return index == 3; });
+
+    REQUIRE(first == scan_region.start.add(3000));
+    REQUIRE(mem::teddy_scanner().scan_all(scan_region).empty());
+
+    mem::protect_free(raw_data, raw_size);
+}
+
+TEST_CASE("mem::pattern_set")
+{
+    std::vector<uint8_t> data(0x4000);
+
+    uint32_t seed = 7;
+
+    const auto next_random = [&seed] {
+        seed = (seed * 1664525) + 1013904223;
+
+        return seed >> 16;
+    };
+
+    for (uint8_t& value : data)
+        value = static_cast<uint8_t>(next_random() % 24);
+
+    std::vector<mem::pattern> patterns;
+
+    for (size_t i = 0; i < 400; ++i)
+    {
+        const size_t length = 2 + (next_random() % 24);
+        const size_t offset = next_random() % (data.size() - length);
+
+        std::string text;
+
+        for (size_t j = 0; j < length; ++j)
+        {
+            const uint32_t kind = next_random() % 8;
+
+            if (j != 0)
+                text += ' ';
+
+            if (kind == 0)
+                text += '?';
+            else if (kind == 1)
+                text += mem::as_hex({&data[offset + j], 1}).substr(0, 1) + '?';
+            else
+                text += mem::as_hex({&data[offset + j], 1});
+        }
+
+        patterns.emplace_back(text.c_str());
+    }
+
+    patterns.emplace_back("? ?2");
+    patterns.emplace_back("? ? ?");
+    patterns.emplace_back("");
+
+    std::vector<const mem::pattern*> pattern_list;
+
+    for (const mem::pattern& pattern : patterns)
+        pattern_list.push_back(&pattern);
+
+    mem::pattern_set set(pattern_list);
+    mem::region scan_region(data.data(), data.size());
+
+    std::vector<std::pair<mem::pointer, size_t>> expected;
+
+    for (size_t i = 0; i < pattern_list.size(); ++i)
+    {
+        for (mem::pointer result : mem::simd_scanner(*pattern_list[i]).scan_all(scan_region))
+            expected.emplace_back(result, i);
+    }
+
+    std::sort(expected.begin(), expected.end());
+
+    REQUIRE(expected.size() > 400);
+    REQUIRE(set.state_count() > 1024); // More than have full transition tables
+    REQUIRE(set.scan_all(scan_region) == expected);
+
+    // Patterns of only wildcards are ignored, like empty patterns
+    REQUIRE(std::none_of(expected.begin(), expected.end(), [&pattern_list](const std::pair<mem::pointer, size_t>& result) {
+        return pattern_list[result.second]->trimmed_size() == 0;
+    }));
+
+    mem::region sub_region(scan_region.start.add(5), scan_region.size - 10);
+
+    std::vector<std::pair<mem::pointer, size_t>> sub_expected;
+
+    for (const auto& result : expected)
+    {
+        if (sub_region.contains(result.first, pattern_list[result.second]->size()))
+            sub_expected.push_back(result);
+    }
+
+    REQUIRE(set.scan_all(sub_region) == sub_expected);
+    REQUIRE(mem::pattern_set().scan_all(scan_region).empty());
+}
+
+TEST_CASE("mem::region contains")
+{
+    REQUIRE(mem::region(0x1234, 0x10).contains(mem::region(0x1234, 0x10)));
+    REQUIRE(mem::region(0x1234, 0x10).contains(mem::region(0x1235, 0x09)));
+    REQUIRE(!mem::region(0x1234, 0x10).contains(mem::region(0x1235, 0x10)));
+
+    REQUIRE(mem::region(0x1234, 0x10).contains(0x1234, 0x10));
+    REQUIRE(mem::region(0x1234, 0x10).contains(0x1235, 0x09));
+    REQUIRE(!mem::region(0x1234, 0x10).contains(0x1235, 0x10));
+
+    REQUIRE(mem::region(0x1234, 0x10).contains(0x1234));
+    REQUIRE(mem::region(0x1234, 0x10).contains(0x1234 + 0x9));
+    REQUIRE(mem::region(0x1234, 1).contains(0x1234));
+    REQUIRE(!mem::region(0x1234, 0x10).contains(0x1233));
+    REQUIRE(!mem::region(0x1234, 0x10).contains(0x1234 + 0x10));
+    REQUIRE(!mem::region(0x1234, 0).contains(0x1234));
+
+    REQUIRE(mem::region(0x1234, 4).contains<int>(0x1234));
+    REQUIRE(mem::region(0x1234, 4).contains<int>(0x1234));
+    REQUIRE(!mem::region(0x1234, 3).contains<int>(0x1234));
+    REQUIRE(!mem::region(0x1235, 3).contains<int>(0x1234));
+}
+
+void check_pointer_aligment(mem::pointer address, size_t alignment, mem::pointer aligned_down, mem::pointer aligned_up)
+{
+    REQUIRE(address.align_down(alignment) == aligned_down);
+    REQUIRE(address.align_up(alignment) == aligned_up);
+}
+
+TEST_CASE("mem::pointer align")
+{
+    CHECK_NOTHROW(check_pointer_aligment(13, 1, 13, 13));
+    CHECK_NOTHROW(check_pointer_aligment(13, 2, 12, 14));
+    CHECK_NOTHROW(check_pointer_aligment(13, 5, 10, 15));
+    CHECK_NOTHROW(check_pointer_aligment(16, 5, 15, 20));
+    CHECK_NOTHROW(check_pointer_aligment(14, 5, 10, 15));
+    CHECK_NOTHROW(check_pointer_aligment(15, 15, 15, 15));
+}
+
+template <typename T>
+void check_any_pointer()
+{
+    mem::pointer result(0x1234);
+
+    REQUIRE(result.as<T>() == static_cast<T>(result.any()));
+}
+
+TEST_CASE("mem::pointer any")
+{
+    CHECK_NOTHROW(check_any_pointer<uintptr_t>());
+    CHECK_NOTHROW(check_any_pointer<int*>());
+    CHECK_NOTHROW(check_any_pointer<void*>());
+}
+
+void check_hex_conversion(const void* data, size_t length, bool upper_case, bool padded, const char* expected)
+{
+    REQUIRE(mem::as_hex({ data, length }, upper_case, padded) == expected);
+}
+
+TEST_CASE("mem::as_hex")
+{
+    CHECK_NOTHROW(check_hex_conversion("\x01\x23\x45\x67\x89\xAB\xCD\xEF", 8, true,  true, "01 23 45 67 89 AB CD EF"));
+    CHECK_NOTHROW(check_hex_conversion("\x01\x23\x45\x67\x89\xAB\xCD\xEF", 8, false, true, "01 23 45 67 89 ab cd ef"));
+    CHECK_NOTHROW(check_hex_conversion("\x01\x23\x45\x67\x89\xAB\xCD\xEF", 8, true,  false, "0123456789ABCDEF"));
+    CHECK_NOTHROW(check_hex_conversion("\x01\x23\x45\x67\x89\xAB\xCD\xEF", 8, false, false, "0123456789abcdef"));
+}
+
+void check_unescape_string(const char* string, const void* data, size_t length, bool strict)
+{
+    std::vector<mem::byte> unescaped = mem::unescape(string, strlen(string), strict);
+
+    REQUIRE(unescaped.size() == length);
+    REQUIRE(memcmp(unescaped.data(), data, length) == 0);
+}
+
+#if defined(_MSC_VER)
+# pragma warning(push)
+# pragma warning(disable: 4125) // warning C4125: decimal digit terminates octal escape sequence
+#endif
+
+TEST_CASE("mem::unescape")
+{
+    CHECK_NOTHROW(check_unescape_string(R"(\x12\x34)", "\x12\x34", 2, true));
+    CHECK_NOTHROW(check_unescape_string(R"(\0\1\10)", "\0\1\10", 3, true));
+    CHECK_NOTHROW(check_unescape_string(R"(\0\1\1011)", "\0\1\1011", 4, true));
+    CHECK_NOTHROW(check_unescape_string(R"(\1\2\3)", "\1\2\3", 3, true));
+    CHECK_NOTHROW(check_unescape_string(R"(Hello There)", "Hello There", 11, true));
+    CHECK_NOTHROW(check_unescape_string(R"(Hello\nThere)", "Hello\nThere", 11, true));
+    CHECK_NOTHROW(check_unescape_string(R"(Hello \"Bob)", "Hello \"Bob", 10, true));
+
+    CHECK_NOTHROW(check_unescape_string(R"(I am a \U0001F9F1)", "I am a \xF0\x9F\xA7\xB1", 11, true));
+
+    CHECK_NOTHROW(check_unescape_string(R"(\x123456!)", "V!", 2, false));
+    CHECK_NOTHROW(check_unescape_string(R"(\567ABC)", "wABC", 4, false));
+    CHECK_NOTHROW(check_unescape_string(R"(\xz)", "\0z", 2, false));
+    CHECK_NOTHROW(check_unescape_string(R"(\yz)", "yz", 2, false));
+
+    CHECK_NOTHROW(check_unescape_string(R"(\x123456)", "", 0, true));
+    CHECK_NOTHROW(check_unescape_string(R"(\567ABC)", "", 0, true));
+    CHECK_NOTHROW(check_unescape_string(R"(\xz)", "", 0, true));
+    CHECK_NOTHROW(check_unescape_string(R"(\yz)", "", 0, true));
+}
+
+#if defined(_MSC_VER)
+# pragma warning(pop)
+#endif
+
+void check_prot_flags_roundtrip(mem::prot_flags flags)
+{
+    mem::prot_flags new_flags = mem::to_prot_flags(mem::from_prot_flags(flags));
+
+    REQUIRE(flags == new_flags);
+}
+
+TEST_CASE("mem::prot_flags")
+{
+    CHECK_NOTHROW(check_prot_flags_roundtrip(mem::prot_flags::NONE));
+    CHECK_NOTHROW(check_prot_flags_roundtrip(mem::prot_flags::R));
+    CHECK_NOTHROW(check_prot_flags_roundtrip(mem::prot_flags::RW));
+    CHECK_NOTHROW(check_prot_flags_roundtrip(mem::prot_flags::RX));
+    CHECK_NOTHROW(check_prot_flags_roundtrip(mem::prot_flags::RWX));
+}
+
+#if defined(__unix__)
+struct itanium_rtti_base
+{
+    virtual ~itanium_rtti_base() = default;
+
+    virtual int value() const
+    {
+        return 1;
+    }
+};
+
+struct itanium_rtti_derived : itanium_rtti_base
+{
+    int value() const override
+    {
+        return 2;
+    }
+};
+
+TEST_CASE("mem::itanium_rtti::type_index")
+{
+    itanium_rtti_derived derived;
+
+    mem::itanium_rtti::type_index index(mem::module::self());
+
+    const mem::itanium_rtti::type_entry* base_type = index.find_type("17itanium_rtti_base");
+    const mem::itanium_rtti::type_entry* derived_type = index.find_type("20itanium_rtti_derived");
+
+    REQUIRE(base_type != nullptr);
+    REQUIRE(derived_type != nullptr);
+    REQUIRE(index.find_type("22itanium_rtti_not_found") == nullptr);
+
+    REQUIRE(base_type->kind == mem::itanium_rtti::type_kind::class_type);
+    REQUIRE(derived_type->kind == mem::itanium_rtti::type_kind::si_class_type);
+
+    REQUIRE(mem::pointer(derived_type->type) == mem::pointer(&typeid(itanium_rtti_derived)));
+    REQUIRE(mem::pointer(reinterpret_cast<const mem::itanium_rtti::si_class_type_info*>(derived_type->type)->base_type) == mem::pointer(base_type->type));
+
+    const mem::pointer vtable = mem::pointer(&derived).at<const mem::pointer>(0);
+
+    REQUIRE(std::find(derived_type->vtables.begin(), derived_type->vtables.end(), vtable) != derived_type->vtables.end());
+    REQUIRE(derived.value() == 2);
+}
+#endif
+
+#if defined(__GLIBC__)
+TEST_CASE("mem::module exports")
+{
+    mem::module libc = mem::module::named("libc.so.6");
+
+    REQUIRE(libc.size != 0);
+
+    mem::export_table exports = libc.exports();
+
+    REQUIRE(exports);
+
+    const mem::pointer qsort_export = exports.find_export("qsort");
+
+    REQUIRE(qsort_export != nullptr);
+    REQUIRE(libc.contains(qsort_export));
+    REQUIRE(exports.find_export("malloc") != nullptr);
+    REQUIRE(exports.find_export("mem_export_not_found") == nullptr);
+
+    void* const handle = dlopen("libc.so.6", RTLD_NOW | RTLD_NOLOAD);
+    REQUIRE(handle != nullptr);
+
+    // These have older hidden versions next to the default one
+    for (const char* name : {"glob", "sched_setaffinity", "realpath", "pthread_cond_wait", "fopen"})
+    {
+        const std::string symbol = name;
+        CAPTURE(symbol);
+        REQUIRE(exports.find_export(name) == dlsym(handle, name));
+    }
+
+    // The default version of memcpy is an indirect function, so its address is only known to dlsym
+    REQUIRE(exports.find_export("memcpy") == nullptr);
+
+    dlclose(handle);
+}
+#endif
+
+static const char module_section_string[] = "mem::module section";
+
+static int module_section_function(int value)
+{
+    return value * 3;
+}
+
+TEST_CASE("mem::module section")
+{
+    mem::module self = mem::module::self();
+
+    const mem::region text = self.section(".text");
+
+    REQUIRE(text.size != 0);
+    REQUIRE(text.contains(mem::pointer(&module_section_function)));
+    REQUIRE(module_section_function(2) == 6);
+
+#if defined(__unix__)
+    const mem::region rodata = self.section(".rodata");
+
+    REQUIRE(rodata.contains(mem::pointer(module_section_string)));
+    REQUIRE(self.section(".rodata") == rodata);
+#else
+    REQUIRE(self.section(".rdata").contains(mem::pointer(module_section_string)));
+#endif
+
+    REQUIRE(self.section(".mem_not_found").size == 0);
+
+    size_t section_count = 0;
+
+    self.enum_sections([&](const char* name, mem::region range) {
+        REQUIRE(name != nullptr);
+        REQUIRE(self.contains(range));
+
+        ++section_count;
+
+        return false;
+    });
+
+    REQUIRE(section_count > 2);
+}
+
+#if defined(MEM_ARCH_X86_64)
+
+void write_image_locator(std::vector<uint64_t>& image, size_t offset, uint32_t signature, uint32_t type, uint32_t self)
+{
+    const uint32_t locator[6] {signature, 0, 0, type, 0, self};
+
+    memcpy(reinterpret_cast<char*>(image.data()) + offset, locator, sizeof(locator));
+}
+
+TEST_CASE("mem::rtti::rtti_index")
+{
+    std::vector<uint64_t> image(0x1000 / sizeof(uint64_t));
+    mem::region region(image.data(), image.size() * sizeof(uint64_t));
+
+    write_image_value(image, 0x100, region.start.add(0x800).as<uintptr_t>());
+    memcpy(reinterpret_cast<char*>(image.data()) + 0x110, ".?AVrtti_test@@", 16);
+
+    write_image_locator(image, 0x200, 1, 0x100, 0x200);
+    write_image_locator(image, 0x220, 1, 0x100, 0x220);
+    write_image_locator(image, 0x240, 1, 0x100, 0x1234);
+    write_image_locator(image, 0x280, 0, 0x100, 0x280);
+
+    write_image_value(image, 0x400, region.start.add(0x200).as<uintptr_t>());
+    write_image_value(image, 0x500, region.start.add(0x240).as<uintptr_t>());
+    write_image_value(image, 0x600, region.start.add(0x220).as<uintptr_t>());
+    write_image_value(image, 0x700, region.start.add(0x280).as<uintptr_t>());
+
+    mem::rtti::rtti_index index(region);
+
+    REQUIRE(index.size() == 1);
+    REQUIRE(index.find_type(".?AVrtti_missing@@") == nullptr);
+
+    const mem::rtti::rtti_index::type_entry* type = index.find_type(".?AVrtti_test@@");
+
+    REQUIRE(type != nullptr);
+    REQUIRE(mem::pointer(type->type) == region.start.add(0x100));
+
+    REQUIRE(type->locators.size() == 2);
+    REQUIRE(type->vtables.size() == 2);
+    REQUIRE(mem::pointer(type->vtables[0]) == region.start.add(0x408));
+    REQUIRE(mem::pointer(type->vtables[1]) == region.start.add(0x608));
+}
+#endif
+
+std::vector<uint8_t> make_pe_image()
+{
+    std::vector<uint8_t> file(0x3000);
+
+    write_image_value<std::vector<uint8_t>, uint16_t>(file, 0x00, 0x5A4D);   // e_magic
+    write_image_value<std::vector<uint8_t>, int32_t>(file, 0x3C, 0x80);      // e_lfanew
+    write_image_value<std::vector<uint8_t>, uint32_t>(file, 0x80, 0x4550);   // Signature
+    write_image_value<std::vector<uint8_t>, uint16_t>(file, 0x84, 0x8664);   // Machine
+    write_image_value<std::vector<uint8_t>, uint16_t>(file, 0x86, 2);        // NumberOfSections
+    write_image_value<std::vector<uint8_t>, uint16_t>(file, 0x94, 240);      // SizeOfOptionalHeader
+    write_image_value<std::vector<uint8_t>, uint16_t>(file, 0x98, 0x20B);    // Magic
+    write_image_value<std::vector<uint8_t>, uint64_t>(file, 0xB0, 0x140000000); // ImageBase
+    write_image_value<std::vector<uint8_t>, uint32_t>(file, 0xB8, 0x1000);   // SectionAlignment
+    write_image_value<std::vector<uint8_t>, uint32_t>(file, 0xBC, 0x200);    // FileAlignment
+    write_image_value<std::vector<uint8_t>, uint32_t>(file, 0xD0, 0x4000);   // SizeOfImage
+    write_image_value<std::vector<uint8_t>, uint32_t>(file, 0xD4, 0x400);    // SizeOfHeaders
+    write_image_value<std::vector<uint8_t>, uint32_t>(file, 0x104, 16);      // NumberOfRvaAndSizes
+    write_image_value<std::vector<uint8_t>, uint32_t>(file, 0x108, 0x2000);  // Export Directory
+    write_image_value<std::vector<uint8_t>, uint32_t>(file, 0x10C, 0x100);
+    write_image_value<std::vector<uint8_t>, uint32_t>(file, 0x130, 0x2800);  // Base Relocation Directory
+    write_image_value<std::vector<uint8_t>, uint32_t>(file, 0x134, 12);
+
+    const uint32_t text[10] {0x7865742E, 0x74, 0x100, 0x1000, 0x200, 0x400, 0, 0, 0, 0x60000020};
+    const uint32_t rdata[10] {0x6164722E, 0x6174, 0x2000, 0x2000, 0x2000, 0x1000, 0, 0, 0, 0x40000040};
+
+    memcpy(&file[0x188], text, sizeof(text));
+    memcpy(&file[0x188 + 40], rdata, sizeof(rdata));
+
+    memcpy(&file[0x400], "MEM_TEXT", 8);
+
+    const uint32_t exports[6] {1, 3, 2, 0x2100, 0x2110, 0x2118};
+    const uint32_t functions[3] {0x1000, 0x1010, 0x1020};
+    const uint32_t names[2] {0x2120, 0x2128};
+    const uint16_t ordinals[2] {0, 2};
+
+    memcpy(&file[0x1010], exports, sizeof(exports));
+    memcpy(&file[0x1100], functions, sizeof(functions));
+    memcpy(&file[0x1110], names, sizeof(names));
+    memcpy(&file[0x1118], ordinals, sizeof(ordinals));
+    memcpy(&file[0x1120], "alpha", 6);
+    memcpy(&file[0x1128], "beta", 5);
+
+    write_image_value<std::vector<uint8_t>, uint64_t>(file, 0x1200, 0x140000000 + 0x1010);
+
+    const uint32_t reloc[2] {0x2000, 12};
+    const uint16_t reloc_entries[2] {(10 << 12) | 0x200, 0};
+
+    memcpy(&file[0x1800], reloc, sizeof(reloc));
+    memcpy(&file[0x1808], reloc_entries, sizeof(reloc_entries));
+
+    return file;
+}
+
+TEST_CASE("mem::pe_image")
+{
+    const char* path = "mem_pe_image_test.bin";
+
+    {
+        std::vector<uint8_t> file = make_pe_image();
+        FILE* output = fopen(path, "wb");
+        REQUIRE(output != nullptr);
+        REQUIRE(fwrite(file.data(), 1, file.size(), output) == file.size());
+        fclose(output);
+    }
+
+    mem::pe_image image = mem::pe_image::open(path);
+    remove(path);
+
+    REQUIRE(image);
+    REQUIRE(image.size == 0x4000);
+    REQUIRE(image.is_64bit());
+    REQUIRE(image.image_base() == image.start.as<uintptr_t>());
+
+    std::vector<std::pair<mem::region, mem::prot_flags>> segments;
+
+    image.enum_segments([&segments](mem::region range, mem::prot_flags prot) {
+        segments.emplace_back(range, prot);
+
+        return false;
+    });
+
+    REQUIRE(segments.size() == 2);
+    REQUIRE(segments[0].first == mem::region(image.start.add(0x1000), 0x100));
+    REQUIRE(segments[0].second == mem::prot_flags::RX);
+    REQUIRE(segments[1].first == mem::region(image.start.add(0x2000), 0x2000));
+    REQUIRE(segments[1].second == mem::prot_flags::R);
+
+    REQUIRE(memcmp(image.start.add(0x1000).as<const void*>(), "MEM_TEXT", 8) == 0);
+    REQUIRE(image.start.at<const uint64_t>(0x2200) == image.start.add(0x1010).as<uintptr_t>());
+
+    REQUIRE(image.relocate(0x150000000));
+    REQUIRE(image.image_base() == 0x150000000);
+    REQUIRE(image.start.at<const uint64_t>(0x2200) == 0x150001010);
+
+    std::vector<std::string> names;
+    std::vector<uint16_t> ordinals;
+    std::vector<mem::pointer> functions;
+
+    image.enum_exports([&](const char* name, uint16_t ordinal, mem::pointer function) {
+        names.emplace_back(name ? name : "");
+        ordinals.push_back(ordinal);
+        functions.push_back(function);
+
+        return false;
+    });
+
+    REQUIRE(names == std::vector<std::string> {"alpha", "beta", ""});
+    REQUIRE(ordinals == std::vector<uint16_t> {0, 2, 1});
+    REQUIRE(functions == std::vector<mem::pointer> {image.start.add(0x1000), image.start.add(0x1020), image.start.add(0x1010)});
+
+    mem::pe_export_table exports = image.exports();
+
+    REQUIRE(exports.size() == 2);
+    REQUIRE(exports.find_export("alpha") == image.start.add(0x1000));
+    REQUIRE(exports.find_export("beta") == image.start.add(0x1020));
+    REQUIRE(exports.find_export("gamma") == nullptr);
+    REQUIRE(exports.find_export("") == nullptr);
+
+    mem::pe_image moved = std::move(image);
+
+    REQUIRE(!image);
+    REQUIRE(moved);
+
+    // A name which runs off the end of the image
+    {
+        std::vector<uint8_t> file = make_pe_image();
+        write_image_value<std::vector<uint8_t>, uint32_t>(file, 0x1114, 0x3FFC);
+        memcpy(&file[0x2FFC], "beta", 4);
+
+        FILE* output = fopen(path, "wb");
+        REQUIRE(output != nullptr);
+        REQUIRE(fwrite(file.data(), 1, file.size(), output) == file.size());
+        fclose(output);
+    }
+
+    mem::pe_image truncated = mem::pe_image::open(path);
+    remove(path);
+
+    REQUIRE(truncated);
+    REQUIRE(truncated.exports().size() == 0);
+
+    names.clear();
+
+    truncated.enum_exports([&](const char* name, uint16_t, mem::pointer) {
+        names.emplace_back(name ? name : "");
+
+        return false;
+    });
+
+    REQUIRE(names == std::vector<std::string> {"alpha", "", ""});
+}
+
+#if defined(MEM_ARCH_X86_64)
+TEST_CASE("mem::rtti::rtti_index pe_image")
+{
+    std::vector<uint8_t> file = make_pe_image();
+
+    // Type descriptor at 0x2300, locator at 0x2400 and a vtable at 0x2508, all in .rdata
+    write_image_value<std::vector<uint8_t>, uint64_t>(file, 0x1300, 0x140000000 + 0x2600);
+    memcpy(&file[0x1310], ".?AVpe_rtti_test@@", 19);
+
+    const uint32_t locator[6] {1, 0, 0, 0x2300, 0, 0x2400};
+    memcpy(&file[0x1400], locator, sizeof(locator));
+
+    write_image_value<std::vector<uint8_t>, uint64_t>(file, 0x1500, 0x140000000 + 0x2400);
+    write_image_value<std::vector<uint8_t>, uint64_t>(file, 0x1508, 0x140000000 + 0x1000);
+
+    const uint32_t reloc[2] {0x2000, 20};
+    const uint16_t reloc_entries[6] {(10 << 12) | 0x200, (10 << 12) | 0x300, (10 << 12) | 0x500, (10 << 12) | 0x508, 0, 0};
+
+    memcpy(&file[0x1800], reloc, sizeof(reloc));
+    memcpy(&file[0x1808], reloc_entries, sizeof(reloc_entries));
+    write_image_value<std::vector<uint8_t>, uint32_t>(file, 0x134, 20);
+
+    const char* path = "mem_rtti_pe_image_test.bin";
+
+    {
+        FILE* output = fopen(path, "wb");
+        REQUIRE(output != nullptr);
+        REQUIRE(fwrite(file.data(), 1, file.size(), output) == file.size());
+        fclose(output);
+    }
+
+    mem::pe_image image = mem::pe_image::open(path);
+    remove(path);
+
+    REQUIRE(image);
+
+    mem::rtti::rtti_index index(image);
+
+    REQUIRE(index.size() == 1);
+
+    const mem::rtti::rtti_index::type_entry* type = index.find_type(".?AVpe_rtti_test@@");
+
+    REQUIRE(type != nullptr);
+    REQUIRE(mem::pointer(type->type) == image.start.add(0x2300));
+    REQUIRE(type->locators.size() == 1);
+    REQUIRE(mem::pointer(type->locators[0]) == image.start.add(0x2400));
+    REQUIRE(type->vtables.size() == 1);
+    REQUIRE(mem::pointer(type->vtables[0]) == image.start.add(0x2508));
+    REQUIRE(mem::pointer(type->vtables[0][0]) == image.start.add(0x1000));
+}
+#endif